@@ -0,0 +1,918 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    platformstl/filesystem/indexed_file_lines.hpp
+ *
+ * Purpose: Zero-copy, line-offset-indexed view of a text file's lines.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * Home:    http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* STLSOFT:C++98:FILE_EXCEPTED */
+/* STLSOFT:C++03:FILE_EXCEPTED */
+
+#ifndef PLATFORMSTL_INCL_PLATFORMSTL_FILESYSTEM_HPP_INDEXED_FILE_LINES
+#define PLATFORMSTL_INCL_PLATFORMSTL_FILESYSTEM_HPP_INDEXED_FILE_LINES
+
+/* File version */
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define PLATFORMSTL_VER_PLATFORMSTL_FILESYSTEM_HPP_INDEXED_FILE_LINES_MAJOR    1
+# define PLATFORMSTL_VER_PLATFORMSTL_FILESYSTEM_HPP_INDEXED_FILE_LINES_MINOR    0
+# define PLATFORMSTL_VER_PLATFORMSTL_FILESYSTEM_HPP_INDEXED_FILE_LINES_REVISION 1
+# define PLATFORMSTL_VER_PLATFORMSTL_FILESYSTEM_HPP_INDEXED_FILE_LINES_EDIT     2
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/** \file platformstl/filesystem/indexed_file_lines.hpp
+ *
+ * \brief [C++] Definition of the platformstl::basic_indexed_file_lines
+ *   class template
+ *   (\ref group__library__FileSystem "File System" Library).
+ */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef PLATFORMSTL_INCL_PLATFORMSTL_HPP_PLATFORMSTL
+# include <platformstl/platformstl.hpp>
+#endif /* !PLATFORMSTL_INCL_PLATFORMSTL_HPP_PLATFORMSTL */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+# ifndef PLATFORMSTL_INCL_PLATFORMSTL_EXCEPTION_HPP_INVALID_FILE_TYPE_EXCEPTION
+#  include <platformstl/exception/invalid_file_type_exception.hpp>
+# endif /* !PLATFORMSTL_INCL_PLATFORMSTL_EXCEPTION_HPP_INVALID_FILE_TYPE_EXCEPTION */
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+#ifndef PLATFORMSTL_INCL_PLATFORMSTL_FILESYSTEM_HPP_READONLY_MEMORY_MAPPED_FILE
+# include <platformstl/filesystem/readonly_memory_mapped_file.hpp>
+#endif /* !PLATFORMSTL_INCL_PLATFORMSTL_FILESYSTEM_HPP_READONLY_MEMORY_MAPPED_FILE */
+#ifndef PLATFORMSTL_INCL_PLATFORMSTL_FILESYSTEM_HANDLES_HPP_MEMORY_MAPPED_FILE_VIEW_HANDLE
+# include <platformstl/filesystem/handles/memory_mapped_file_view_handle.hpp>
+#endif /* !PLATFORMSTL_INCL_PLATFORMSTL_FILESYSTEM_HANDLES_HPP_MEMORY_MAPPED_FILE_VIEW_HANDLE */
+#ifndef PLATFORMSTL_INCL_PLATFORMSTL_SYNCH_REFCOUNT_POLICIES_HPP_REFCOUNT_POLICY_MULTI_THREADED
+# include <platformstl/synch/refcount_policies/refcount_policy_multi_threaded.hpp>
+#endif /* !PLATFORMSTL_INCL_PLATFORMSTL_SYNCH_REFCOUNT_POLICIES_HPP_REFCOUNT_POLICY_MULTI_THREADED */
+#ifndef STLSOFT_INCL_STLSOFT_CONVERSION_HPP_CHAR_CONVERSIONS
+# include <stlsoft/conversion/w2m.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_CONVERSION_HPP_CHAR_CONVERSIONS */
+#ifndef STLSOFT_INCL_STLSOFT_SHIMS_ACCESS_STRING_H_FWD
+# include <stlsoft/shims/access/string/fwd.h>
+#endif /* !STLSOFT_INCL_STLSOFT_SHIMS_ACCESS_STRING_H_FWD */
+#ifndef STLSOFT_INCL_STLSOFT_STRING_HPP_STRING_VIEW
+# include <stlsoft/string/string_view.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_STRING_HPP_STRING_VIEW */
+#ifndef STLSOFT_INCL_STLSOFT_UTIL_BITS_H_TEST_FUNCTIONS
+# include <stlsoft/util/bits/test_functions.h>
+#endif /* !STLSOFT_INCL_STLSOFT_UTIL_BITS_H_TEST_FUNCTIONS */
+
+#ifndef STLSOFT_INCL_ITERATOR
+# define STLSOFT_INCL_ITERATOR
+# include <iterator>
+#endif /* !STLSOFT_INCL_ITERATOR */
+#ifndef STLSOFT_INCL_NEW
+# define STLSOFT_INCL_NEW
+# include <new>
+#endif /* !STLSOFT_INCL_NEW */
+#ifndef STLSOFT_INCL_THREAD
+# define STLSOFT_INCL_THREAD
+# include <thread>
+#endif /* !STLSOFT_INCL_THREAD */
+#ifndef STLSOFT_INCL_VECTOR
+# define STLSOFT_INCL_VECTOR
+# include <vector>
+#endif /* !STLSOFT_INCL_VECTOR */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#if defined(__AVX2__)
+# define PLATFORMSTL_FILESYSTEM_INDEXED_FILE_LINES_USE_AVX2_
+#endif
+#if defined(__SSE2__) || \
+    defined(_M_X64) || \
+    (   defined(_M_IX86_FP) && \
+        _M_IX86_FP >= 2)
+# define PLATFORMSTL_FILESYSTEM_INDEXED_FILE_LINES_USE_SSE2_
+#endif
+
+#if defined(PLATFORMSTL_FILESYSTEM_INDEXED_FILE_LINES_USE_AVX2_)
+# include <immintrin.h>
+#elif defined(PLATFORMSTL_FILESYSTEM_INDEXED_FILE_LINES_USE_SSE2_)
+# include <emmintrin.h>
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#if defined(STLSOFT_NO_NAMESPACE) || \
+    defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+/* There is no stlsoft namespace, so must define ::platformstl */
+namespace platformstl
+{
+#else
+/* Define stlsoft::platformstl_project */
+namespace stlsoft
+{
+namespace platformstl_project
+{
+#endif /* STLSOFT_NO_NAMESPACE */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions
+ */
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+namespace ximpl_indexed_file_lines
+{
+
+    /* Records the start of the line, if any, that follows the (CR, LF, or
+     * NUL) character at pos. Returns false if the character is NUL.
+     *
+     * A line starts after every LF, and after every CR that is not
+     * followed by an LF, except where that would be at the end of the
+     * file. This gives the same lines as basic_file_lines, which accepts
+     * any mix of CRLF, LF, and CR line endings.
+     */
+    template<
+        ss_typename_param_k C
+    ,   ss_typename_param_k O
+    >
+    inline
+    bool
+    on_eol_or_nul(
+        C const*        base
+    ,   ss_size_t       cch
+    ,   ss_size_t       pos
+    ,   std::vector<O>& starts
+    )
+    {
+        switch (base[pos])
+        {
+        case '\0':
+            return false;
+        case '\n':
+            if (pos + 1 != cch)
+            {
+                starts.push_back(static_cast<O>(pos + 1));
+            }
+            break;
+        case '\r':
+            if (pos + 1 != cch &&
+                '\n' != base[pos + 1])
+            {
+                starts.push_back(static_cast<O>(pos + 1));
+            }
+            break;
+        }
+
+        return true;
+    }
+
+    /* Appends to starts the offsets of all lines that begin in the range
+     * (from, to]. Returns false if a NUL is encountered in [from, to).
+     */
+    template<
+        ss_typename_param_k C
+    ,   ss_typename_param_k O
+    >
+    inline
+    bool
+    scan_chunk(
+        C const*        base
+    ,   ss_size_t       cch
+    ,   ss_size_t       from
+    ,   ss_size_t       to
+    ,   std::vector<O>& starts
+    )
+    {
+        for (ss_size_t pos = from; pos != to; ++pos)
+        {
+            C const ch = base[pos];
+
+            if ('\n' == ch ||
+                '\r' == ch ||
+                '\0' == ch)
+            {
+                if (!on_eol_or_nul(base, cch, pos, starts))
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    template <ss_typename_param_k O>
+    inline
+    bool
+    scan_chunk(
+        ss_char_a_t const*  base
+    ,   ss_size_t           cch
+    ,   ss_size_t           from
+    ,   ss_size_t           to
+    ,   std::vector<O>&     starts
+    )
+    {
+        ss_size_t pos = from;
+
+        // Compare a block at a time against CR, LF, and NUL, and visit only
+        // the matching positions
+
+#if defined(PLATFORMSTL_FILESYSTEM_INDEXED_FILE_LINES_USE_AVX2_)
+
+        __m256i const   cr32    =   _mm256_set1_epi8('\r');
+        __m256i const   lf32    =   _mm256_set1_epi8('\n');
+        __m256i const   nul32   =   _mm256_setzero_si256();
+
+        for (; to - pos >= 32; pos += 32)
+        {
+            __m256i const   v       =   _mm256_loadu_si256(reinterpret_cast<__m256i const*>(base + pos));
+            __m256i const   m       =   _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, cr32), _mm256_cmpeq_epi8(v, lf32)), _mm256_cmpeq_epi8(v, nul32));
+            ss_uint32_t     mask    =   static_cast<ss_uint32_t>(_mm256_movemask_epi8(m));
+
+            for (; 0 != mask; mask &= mask - 1)
+            {
+                if (!on_eol_or_nul(base, cch, pos + STLSOFT_NS_QUAL(stlsoft_C_count_trailing_zero_bits_in_32bit_unsigned_integer)(mask), starts))
+                {
+                    return false;
+                }
+            }
+        }
+#endif /* PLATFORMSTL_FILESYSTEM_INDEXED_FILE_LINES_USE_AVX2_ */
+
+#if defined(PLATFORMSTL_FILESYSTEM_INDEXED_FILE_LINES_USE_SSE2_)
+
+        __m128i const   cr16    =   _mm_set1_epi8('\r');
+        __m128i const   lf16    =   _mm_set1_epi8('\n');
+        __m128i const   nul16   =   _mm_setzero_si128();
+
+        for (; to - pos >= 16; pos += 16)
+        {
+            __m128i const   v       =   _mm_loadu_si128(reinterpret_cast<__m128i const*>(base + pos));
+            __m128i const   m       =   _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, cr16), _mm_cmpeq_epi8(v, lf16)), _mm_cmpeq_epi8(v, nul16));
+            ss_uint32_t     mask    =   static_cast<ss_uint32_t>(_mm_movemask_epi8(m));
+
+            for (; 0 != mask; mask &= mask - 1)
+            {
+                if (!on_eol_or_nul(base, cch, pos + STLSOFT_NS_QUAL(stlsoft_C_count_trailing_zero_bits_in_32bit_unsigned_integer)(mask), starts))
+                {
+                    return false;
+                }
+            }
+        }
+#endif /* PLATFORMSTL_FILESYSTEM_INDEXED_FILE_LINES_USE_SSE2_ */
+
+        return scan_chunk<ss_char_a_t, O>(base, cch, pos, to, starts);
+    }
+
+} /* namespace ximpl_indexed_file_lines */
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * classes
+ */
+
+/** Maps a text file and presents its lines as a random-access sequence of
+ * string views into the mapping
+ *
+ * \ingroup group__library__FileSystem
+ *
+ * Unlike \link platformstl::basic_file_lines basic_file_lines\endlink,
+ * which copies the file contents and holds a string per line, this class
+ * keeps the mapping and builds only a compact index of line start offsets
+ * (32-bit for files under 4GB, otherwise 64-bit). Each line's view is
+ * calculated on access. The index is built by a vectorised search for
+ * line-ends and, for large files, by splitting the file into chunks that
+ * are indexed in parallel.
+ *
+ * Lines are delimited by CRLF, LF, or CR, in any combination, exactly as
+ * for \c basic_file_lines.
+ *
+ * \note The views refer to the mapping, and so are invalidated when the
+ *   instance is destroyed.
+ *
+ * \param C The character type
+ * \param R The reference-counting policy type of the mapping
+ */
+template<
+    ss_typename_param_k C
+,   ss_typename_param_k R = platformstl::refcount_policy_multi_threaded
+>
+class basic_indexed_file_lines
+{
+public: // types
+    typedef basic_indexed_file_lines<C, R>                  class_type;
+    typedef C                                               char_type;
+    typedef stlsoft::basic_string_view<C>                   value_type;
+    typedef ss_size_t                                       size_type;
+    typedef ss_ptrdiff_t                                    difference_type;
+    typedef ss_bool_t                                       bool_type;
+private:
+    typedef R                                               refcount_policy_type_;
+    typedef std::vector<ss_uint32_t>                        offsets32_type_;
+    typedef std::vector<ss_uint64_t>                        offsets64_type_;
+#if 0
+#elif defined(PLATFORMSTL_OS_IS_UNIX)
+    typedef UNIXSTL_NS_QUAL(memory_mapped_file_view_handle)<R>
+                                                            HRW_HandleAdaptor_type_;
+    typedef UNIXSTL_NS_QUAL(readonly_memory_mapped_file_base)<R>
+                                                            mmf_type_;
+#elif defined(PLATFORMSTL_OS_IS_WINDOWS)
+    typedef WINSTL_NS_QUAL(memory_mapped_file_view_handle)<R>
+                                                            HRW_HandleAdaptor_type_;
+    typedef WINSTL_NS_QUAL(readonly_memory_mapped_file_base)<R>
+                                                            mmf_type_;
+#else
+# error Platform is not discriminated
+#endif
+public:
+    typedef ss_typename_type_k HRW_HandleAdaptor_type_::HRW_Ref_type
+                                                            HRW_Ref_type;
+
+    /// Random-access iterator over the lines
+    class const_iterator
+    {
+    public: // types
+        typedef std::random_access_iterator_tag                 iterator_category;
+        typedef ss_typename_type_k class_type::value_type       value_type;
+        typedef ss_typename_type_k class_type::difference_type  difference_type;
+        typedef value_type const*                               pointer;
+        typedef value_type                                      reference;
+
+    public: // construction
+        const_iterator()
+            : m_lines(ss_nullptr_k)
+            , m_index(0)
+        {}
+    private:
+        friend class basic_indexed_file_lines<C, R>;
+
+        const_iterator(
+            class_type const*   lines
+        ,   size_type           index
+        )
+            : m_lines(lines)
+            , m_index(index)
+        {}
+
+    public: // operations
+        reference operator *() const
+        {
+            return (*m_lines)[m_index];
+        }
+        reference operator [](difference_type n) const
+        {
+            return (*m_lines)[m_index + n];
+        }
+
+        const_iterator& operator ++()
+        {
+            ++m_index;
+
+            return *this;
+        }
+        const_iterator operator ++(int)
+        {
+            const_iterator r(*this);
+
+            ++m_index;
+
+            return r;
+        }
+        const_iterator& operator --()
+        {
+            --m_index;
+
+            return *this;
+        }
+        const_iterator operator --(int)
+        {
+            const_iterator r(*this);
+
+            --m_index;
+
+            return r;
+        }
+        const_iterator& operator +=(difference_type n)
+        {
+            m_index += n;
+
+            return *this;
+        }
+        const_iterator& operator -=(difference_type n)
+        {
+            m_index -= n;
+
+            return *this;
+        }
+        const_iterator operator +(difference_type n) const
+        {
+            return const_iterator(m_lines, m_index + n);
+        }
+        const_iterator operator -(difference_type n) const
+        {
+            return const_iterator(m_lines, m_index - n);
+        }
+        difference_type operator -(const_iterator const& rhs) const
+        {
+            return static_cast<difference_type>(m_index - rhs.m_index);
+        }
+
+    public: // comparison
+        bool operator ==(const_iterator const& rhs) const
+        {
+            STLSOFT_MESSAGE_ASSERT("comparing iterators from different sequences", m_lines == rhs.m_lines);
+
+            return m_index == rhs.m_index;
+        }
+        bool operator !=(const_iterator const& rhs) const
+        {
+            return !operator ==(rhs);
+        }
+        bool operator <(const_iterator const& rhs) const
+        {
+            return m_index < rhs.m_index;
+        }
+        bool operator >(const_iterator const& rhs) const
+        {
+            return rhs.m_index < m_index;
+        }
+        bool operator <=(const_iterator const& rhs) const
+        {
+            return !(rhs.m_index < m_index);
+        }
+        bool operator >=(const_iterator const& rhs) const
+        {
+            return !(m_index < rhs.m_index);
+        }
+
+    private: // fields
+        class_type const*   m_lines;
+        size_type           m_index;
+    };
+    typedef const_iterator                                  iterator;
+
+public: // constants
+    enum
+    {
+        /// The minimum number of characters that will be given to each
+        /// thread when indexing in parallel
+        min_chars_per_thread    =   1024 * 1024
+    };
+
+public: // construction
+    /// Creates an empty instance
+    basic_indexed_file_lines()
+        : m_mmf()
+        , m_base(ss_nullptr_k)
+        , m_cch(0)
+        , m_offsets32()
+        , m_offsets64()
+    {}
+    /// Creates an instance from the (contents of) the given path, indexing
+    /// with as many threads as the hardware supports
+    template <ss_typename_param_k S>
+    ss_explicit_k
+    basic_indexed_file_lines(S const& path)
+        : m_mmf()
+        , m_base(ss_nullptr_k)
+        , m_cch(0)
+        , m_offsets32()
+        , m_offsets64()
+    {
+        create_(path, 0);
+    }
+    /// Creates an instance from the (contents of) the given path, indexing
+    /// with at most \c numThreads threads
+    ///
+    /// \param path The path of the file, or a reference to an existing
+    ///   mapping
+    /// \param numThreads The maximum number of threads (including the
+    ///   calling thread) with which to build the index. If 0, the value of
+    ///   <code>std::thread::hardware_concurrency()</code> is used
+    template <ss_typename_param_k S>
+    basic_indexed_file_lines(
+        S const&    path
+    ,   size_type   numThreads
+    )
+        : m_mmf()
+        , m_base(ss_nullptr_k)
+        , m_cch(0)
+        , m_offsets32()
+        , m_offsets64()
+    {
+        create_(path, numThreads);
+    }
+    /// Release all resources
+    ~basic_indexed_file_lines() STLSOFT_NOEXCEPT
+    {}
+    /// Move constructor
+    basic_indexed_file_lines(class_type&& rhs) STLSOFT_NOEXCEPT
+        : m_mmf(std::move(rhs.m_mmf))
+        , m_base(rhs.m_base)
+        , m_cch(rhs.m_cch)
+        , m_offsets32(std::move(rhs.m_offsets32))
+        , m_offsets64(std::move(rhs.m_offsets64))
+    {
+        rhs.m_base  =   ss_nullptr_k;
+        rhs.m_cch   =   0;
+        rhs.m_offsets32.clear();
+        rhs.m_offsets64.clear();
+    }
+private:
+    basic_indexed_file_lines(class_type const&) STLSOFT_COPY_CONSTRUCTION_PROSCRIBED;
+    void operator =(class_type const&) STLSOFT_COPY_ASSIGNMENT_PROSCRIBED;
+
+public: // accessors
+    /// Returns the number of lines in the file
+    size_type size() const STLSOFT_NOEXCEPT
+    {
+        return m_offsets32.size() + m_offsets64.size();
+    }
+
+    /// Indicates whethere there are any lines in the file
+    bool_type empty() const STLSOFT_NOEXCEPT
+    {
+        return 0u == size();
+    }
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+    HRW_Ref_type mmf() const
+    {
+        return m_mmf;
+    }
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+    /// Returns a view of the line at \c index, excluding its line-end
+    ///
+    /// \note The behaviour is undefined if index >= size()
+    value_type operator [](size_type index) const
+    {
+        STLSOFT_MESSAGE_ASSERT("index out of range", index < size());
+
+        size_type const b   =   line_start_(index);
+        size_type       e   =   (index + 1 == size()) ? m_cch : line_start_(index + 1);
+
+        if (e != b &&
+            '\n' == m_base[e - 1])
+        {
+            --e;
+        }
+        if (e != b &&
+            '\r' == m_base[e - 1])
+        {
+            --e;
+        }
+
+        return value_type(m_base + b, e - b);
+    }
+
+    /// Returns the offset, in characters, of the start of the line at
+    /// \c index from the start of the file
+    ///
+    /// \note The behaviour is undefined if index >= size()
+    size_type line_offset(size_type index) const
+    {
+        STLSOFT_MESSAGE_ASSERT("index out of range", index < size());
+
+        return line_start_(index);
+    }
+
+    /// Begins the iteration
+    ///
+    /// \return An iterator representing the start of the sequence
+    const_iterator begin() const
+    {
+        return const_iterator(this, 0);
+    }
+
+    /// Ends the iteration
+    ///
+    /// \return An iterator representing the end of the sequence
+    const_iterator end() const
+    {
+        return const_iterator(this, size());
+    }
+
+private: // implementation
+    size_type line_start_(size_type index) const
+    {
+        return m_offsets64.empty()
+                    ? static_cast<size_type>(m_offsets32[index])
+                    : static_cast<size_type>(m_offsets64[index]);
+    }
+
+    template <ss_typename_param_k S>
+    void create_(S const& path, size_type numThreads)
+    {
+        create_2_(numThreads, path, &path);
+    }
+
+    // Overloads for the same types as basic_file_lines
+
+    void create_2_(size_type numThreads, ss_char_a_t const* path, ss_char_a_t const* const volatile*)
+    {
+        create_from_path_(path, numThreads);
+    }
+    void create_2_(size_type numThreads, ss_char_w_t const* path, ss_char_w_t const* const volatile*)
+    {
+        create_from_path_(path, numThreads);
+    }
+
+    void create_2_(size_type numThreads, ss_char_a_t* path, ss_char_a_t* const volatile*)
+    {
+        create_from_path_(path, numThreads);
+    }
+    void create_2_(size_type numThreads, ss_char_w_t* path, ss_char_w_t* const volatile*)
+    {
+        create_from_path_(path, numThreads);
+    }
+
+    void create_2_(size_type numThreads, HRW_Ref_type const& ref, HRW_Ref_type const volatile*)
+    {
+        create_from_ref_(ref, "", numThreads);
+    }
+
+    template <ss_typename_param_k S>
+    void create_2_(size_type numThreads, S const& path, ...)
+    {
+        create_from_path_(STLSOFT_NS_QUAL(c_str_ptr)(path), numThreads);
+    }
+
+    template <ss_typename_param_k C2>
+    void create_from_path_(C2 const* path, size_type numThreads)
+    {
+        HRW_Ref_type ref = mmf_type_(path).get();
+
+        create_from_ref_(ref, path, numThreads);
+    }
+
+    void create_from_ref_(HRW_Ref_type mmf, ss_char_w_t const* path, size_type numThreads)
+    {
+        create_from_ref_(mmf, stlsoft::w2m(path), numThreads);
+    }
+
+    void create_from_ref_(HRW_Ref_type mmf, ss_char_a_t const* path, size_type numThreads)
+    {
+        STLSOFT_ASSERT(NULL != path);
+
+        char_type const* const  base    =   static_cast<char_type const*>(mmf->handle.memory);
+        size_type const         cch     =   static_cast<size_type>(mmf->handle.size / sizeof(char_type));
+        bool                    isText;
+
+        if (cch <= 0xffffffffu)
+        {
+            isText = build_index_(base, cch, numThreads, m_offsets32);
+        }
+        else
+        {
+            isText = build_index_(base, cch, numThreads, m_offsets64);
+        }
+
+        if (!isText)
+        {
+            m_offsets32.clear();
+            m_offsets64.clear();
+
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+            STLSOFT_THROW_X(invalid_file_type_exception("file is binary (or unsupported text encoding)", 0, path));
+#else /* STLSOFT_CF_EXCEPTION_SUPPORT */
+            return;
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+        }
+
+        if (!empty())
+        {
+            m_mmf   =   mmf;
+            m_base  =   base;
+            m_cch   =   cch;
+        }
+    }
+
+    template <ss_typename_param_k O>
+    static
+    bool
+    build_index_(
+        char_type const*    base
+    ,   size_type           cch
+    ,   size_type           numThreads
+    ,   std::vector<O>&     offsets
+    )
+    {
+        namespace ximpl = ximpl_indexed_file_lines;
+
+        if (0 == cch)
+        {
+            return true;
+        }
+
+        if (0 == numThreads)
+        {
+            numThreads = std::thread::hardware_concurrency();
+        }
+
+        size_type numChunks = cch / min_chars_per_thread;
+
+        if (numChunks > numThreads)
+        {
+            numChunks = numThreads;
+        }
+
+        offsets.push_back(0);
+
+        if (numChunks < 2)
+        {
+            offsets.reserve(1 + cch / 64);
+
+            return ximpl::scan_chunk(base, cch, 0, cch, offsets);
+        }
+
+        // Each chunk's line starts are found independently, since whether
+        // a position starts a line depends only on the character(s)
+        // immediately before it, and then concatenated in chunk order
+
+        size_type const             chunkSize   =   cch / numChunks;
+        std::vector<std::vector<O>> chunkStarts(numChunks);
+        std::vector<char>           chunkIsText(numChunks, 1);
+        std::vector<char>           chunkFailed(numChunks, 0);
+        std::vector<std::thread>    threads;
+
+        threads.reserve(numChunks - 1);
+
+        auto const scan = [&](size_type i) {
+
+            size_type const from    =   i * chunkSize;
+            size_type const to      =   (i + 1 == numChunks) ? cch : from + chunkSize;
+
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+            try
+            {
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+                chunkStarts[i].reserve(1 + (to - from) / 64);
+
+                chunkIsText[i] = ximpl::scan_chunk(base, cch, from, to, chunkStarts[i]);
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+            }
+            catch (std::bad_alloc&)
+            {
+                chunkFailed[i] = 1;
+            }
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+        };
+
+        for (size_type i = 1; i != numChunks; ++i)
+        {
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+            try
+            {
+                threads.emplace_back(scan, i);
+            }
+            catch (std::exception&)
+            {
+                // could not start a thread, so do it on this one
+
+                scan(i);
+            }
+#else /* ? STLSOFT_CF_EXCEPTION_SUPPORT */
+            threads.emplace_back(scan, i);
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+        }
+
+        scan(0);
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        size_type total = 1;
+
+        for (size_type i = 0; i != numChunks; ++i)
+        {
+            if (0 != chunkFailed[i])
+            {
+                STLSOFT_THROW_X(std::bad_alloc());
+            }
+
+            if (0 == chunkIsText[i])
+            {
+                return false;
+            }
+
+            total += chunkStarts[i].size();
+        }
+
+        offsets.reserve(total);
+
+        for (size_type i = 0; i != numChunks; ++i)
+        {
+            offsets.insert(offsets.end(), chunkStarts[i].begin(), chunkStarts[i].end());
+        }
+
+        return true;
+    }
+
+private: // fields
+    HRW_Ref_type        m_mmf;
+    char_type const*    m_base;
+    size_type           m_cch;
+    offsets32_type_     m_offsets32;
+    offsets64_type_     m_offsets64;
+};
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * typedefs for commonly encountered types
+ */
+
+/** Specialisation of the basic_indexed_file_lines template for the ANSI character type \c char
+ *
+ * \ingroup group__library__FileSystem
+ */
+typedef basic_indexed_file_lines<ss_char_a_t>               indexed_file_lines_a;
+
+/** Specialisation of the basic_indexed_file_lines template for the Unicode character type \c wchar_t
+ *
+ * \ingroup group__library__FileSystem
+ */
+typedef basic_indexed_file_lines<ss_char_w_t>               indexed_file_lines_w;
+
+#ifdef TCHAR
+
+/** Specialisation of the basic_indexed_file_lines template for the Win32 character type \c TCHAR
+ *
+ * \ingroup group__library__FileSystem
+ */
+typedef basic_indexed_file_lines<TCHAR>                     indexed_file_lines;
+#else /* ? TCHAR */
+
+typedef indexed_file_lines_a                                indexed_file_lines;
+#endif /* TCHAR */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#if defined(STLSOFT_NO_NAMESPACE) || \
+    defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+} /* namespace platformstl */
+#else
+} /* namespace platformstl_project */
+} /* namespace stlsoft */
+#endif /* STLSOFT_NO_NAMESPACE */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !PLATFORMSTL_INCL_PLATFORMSTL_FILESYSTEM_HPP_INDEXED_FILE_LINES */
+
+/* ///////////////////////////// end of file //////////////////////////// */
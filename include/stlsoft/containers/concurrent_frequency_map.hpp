@@ -0,0 +1,748 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    stlsoft/containers/concurrent_frequency_map.hpp
+ *
+ * Purpose: Definition of the concurrent_frequency_map container class
+ *          template.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * Home:    http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* STLSOFT:C++98:FILE_EXCEPTED */
+/* STLSOFT:C++03:FILE_EXCEPTED */
+
+/** \file stlsoft/containers/concurrent_frequency_map.hpp
+ *
+ * \brief [C++] Definition of the stlsoft::concurrent_frequency_map
+ *   container class template
+ *   (\ref group__library__Container "Container" Library).
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_CONTAINERS_HPP_CONCURRENT_FREQUENCY_MAP
+#define STLSOFT_INCL_STLSOFT_CONTAINERS_HPP_CONCURRENT_FREQUENCY_MAP
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_CONCURRENT_FREQUENCY_MAP_MAJOR      1
+# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_CONCURRENT_FREQUENCY_MAP_MINOR      0
+# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_CONCURRENT_FREQUENCY_MAP_REVISION   0
+# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_CONCURRENT_FREQUENCY_MAP_EDIT       1
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_H_STLSOFT
+# include <stlsoft/stlsoft.h>
+#endif /* !STLSOFT_INCL_STLSOFT_H_STLSOFT */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+#ifndef STLSOFT_INCL_STLSOFT_CONTAINERS_HPP_FREQUENCY_MAP
+# include <stlsoft/containers/frequency_map.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_CONTAINERS_HPP_FREQUENCY_MAP */
+#ifndef STLSOFT_INCL_STLSOFT_LIMITS_H_INTEGRAL_LIMITS
+# include <stlsoft/limits/integral_limits.h>
+#endif /* !STLSOFT_INCL_STLSOFT_LIMITS_H_INTEGRAL_LIMITS */
+
+#ifndef STLSOFT_INCL_ATOMIC
+# define STLSOFT_INCL_ATOMIC
+# include <atomic>
+#endif /* !STLSOFT_INCL_ATOMIC */
+#ifndef STLSOFT_INCL_ITERATOR
+# define STLSOFT_INCL_ITERATOR
+# include <iterator>
+#endif /* !STLSOFT_INCL_ITERATOR */
+#ifndef STLSOFT_INCL_MEMORY
+# define STLSOFT_INCL_MEMORY
+# include <memory>
+#endif /* !STLSOFT_INCL_MEMORY */
+#ifndef STLSOFT_INCL_MUTEX
+# define STLSOFT_INCL_MUTEX
+# include <mutex>
+#endif /* !STLSOFT_INCL_MUTEX */
+#ifndef STLSOFT_INCL_THREAD
+# define STLSOFT_INCL_THREAD
+# include <thread>
+#endif /* !STLSOFT_INCL_THREAD */
+#ifndef STLSOFT_INCL_VECTOR
+# define STLSOFT_INCL_VECTOR
+# include <vector>
+#endif /* !STLSOFT_INCL_VECTOR */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef STLSOFT_NO_NAMESPACE
+namespace stlsoft
+{
+#endif /* STLSOFT_NO_NAMESPACE */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * implementation
+ */
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+namespace ximpl_concurrent_frequency_map {
+
+    /* A minimal test-and-test-and-set spin lock, satisfying the standard
+     * BasicLockable requirements. Shard critical sections are a single
+     * map update, so spinning is preferable to sleeping; the spinning
+     * thread yields periodically so that it cannot starve a pre-empted
+     * lock holder on an over-subscribed machine.
+     */
+    class spin_lock
+    {
+    public:
+        spin_lock() STLSOFT_NOEXCEPT
+            : m_locked(false)
+        {}
+    private:
+        spin_lock(spin_lock const&) STLSOFT_COPY_CONSTRUCTION_PROSCRIBED;
+        void operator =(spin_lock const&) STLSOFT_COPY_ASSIGNMENT_PROSCRIBED;
+
+    public:
+        void lock() STLSOFT_NOEXCEPT
+        {
+            for (unsigned spins = 0; m_locked.exchange(true, std::memory_order_acquire); )
+            {
+                for (; m_locked.load(std::memory_order_relaxed); )
+                {
+                    if (0 == (++spins % 64))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+        }
+        void unlock() STLSOFT_NOEXCEPT
+        {
+            m_locked.store(false, std::memory_order_release);
+        }
+
+    private:
+        std::atomic<bool>   m_locked;
+    };
+
+    /* Rounds up to the next power of two, in the range [1, 2^16] */
+    inline
+    ss_size_t
+    round_shard_count(
+        ss_size_t n
+    ) STLSOFT_NOEXCEPT
+    {
+        ss_size_t r = 1;
+
+        for (; r < n && r < 0x10000; r <<= 1)
+        {}
+
+        return r;
+    }
+
+    /* Maps a hash to a shard index using the high bits of a Fibonacci
+     * multiply, so that shard selection does not correlate with the
+     * bucket selection (typically hash % bucket_count) within each
+     * shard's own unordered map
+     */
+    inline
+    ss_size_t
+    shard_index_from_hash(
+        ss_size_t   hash
+    ,   unsigned    shift
+    ) STLSOFT_NOEXCEPT
+    {
+        ss_uint64_t const h = static_cast<ss_uint64_t>(hash) * STLSOFT_GEN_UINT64_SUFFIX(0x9e3779b97f4a7c15);
+
+        return static_cast<ss_size_t>(h >> shift);
+    }
+} /* namespace ximpl_concurrent_frequency_map */
+
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * classes
+ */
+
+/** Thread-safe counterpart of
+ *   \link stlsoft::frequency_map frequency_map\endlink
+ *
+ * \ingroup group__library__Container
+ *
+ * \tparam T_value The value type of the container
+ * \tparam T_traits The traits type of each shard's frequency_map, such as
+ *   frequency_map_traits_unordered or frequency_map_traits_ordered
+ * \tparam T_hash The hash function type, used to partition keys between
+ *   the shards
+ *
+ * Keys are hash-partitioned between a power-of-two number of shards, each
+ * of which is a \c frequency_map guarded by its own spin lock, and padded
+ * so that no two shards' locks share a cache line. A push() therefore
+ * contends only with other pushes of keys in the same shard, and, given
+ * enough shards (the default is four per hardware thread), almost always
+ * acquires its lock uncontended.
+ *
+ * merge() partitions its argument before locking, and so acquires each
+ * shard's lock at most once, however many entries are merged.
+ *
+ * snapshot() acquires all shards' locks (always in the same order, and
+ * never while holding any other) and so yields a consistent, point-in-time
+ * copy as a \c frequency_map. begin() takes such a snapshot, which is
+ * shared by all iterators copied from it, so that iteration - including a
+ * range-based <code>for</code> - is over a consistent view, however many
+ * pushes occur during it.
+ *
+ * \note The attributes size(), total() and empty() and the accessor
+ *   count() are computed without a snapshot, and so are only exact when no
+ *   other thread is pushing.
+ */
+template<
+    ss_typename_param_k T_value
+,   ss_typename_param_k T_traits    =   frequency_map_traits_unordered<T_value>
+,   ss_typename_param_k T_hash      =   std::hash<T_value>
+>
+class concurrent_frequency_map
+    : public stl_collection_tag
+{
+public: // types
+    /// This type
+    typedef concurrent_frequency_map<
+        T_value
+    ,   T_traits
+    ,   T_hash
+    >                                                       class_type;
+    /// The snapshot type
+    typedef frequency_map<
+        T_value
+    ,   T_traits
+    >                                                       snapshot_type;
+    /// The value type
+    typedef ss_typename_type_k snapshot_type::value_type    value_type;
+    /// The key type
+    typedef ss_typename_type_k snapshot_type::key_type      key_type;
+    /// The count type
+    typedef ss_typename_type_k snapshot_type::count_type    count_type;
+    /// The non-mutating (const) reference type
+    typedef ss_typename_type_k snapshot_type::const_reference
+                                                            const_reference;
+    /// The hash type
+    typedef T_hash                                          hash_type;
+    /// The size type
+    typedef ss_size_t                                       size_type;
+    /// The difference type
+    typedef ss_ptrdiff_t                                    difference_type;
+    /// The boolean type
+    typedef ss_bool_t                                       bool_type;
+    class                                                   const_iterator;
+private:
+    typedef ximpl_concurrent_frequency_map::spin_lock       lock_type_;
+    typedef std::lock_guard<lock_type_>                     lock_scope_type_;
+
+    enum { cache_line_size_ = 64 };
+
+    struct shard_type_
+    {
+        char            leading_padding_[cache_line_size_];
+        lock_type_      mx;
+        snapshot_type   map;
+    };
+
+public: // construction
+    /// Creates an empty instance, with four shards per hardware thread
+    concurrent_frequency_map()
+        : stl_collection_tag()
+        , m_numShards(ximpl_concurrent_frequency_map::round_shard_count(4 * default_concurrency_()))
+        , m_shift(shift_from_shard_count_(m_numShards))
+        , m_shards(new shard_type_[m_numShards])
+        , m_hash()
+    {}
+    /// Creates an empty instance with at least the given number of shards
+    ///
+    /// \param numShards The number of shards. It is rounded up to a power
+    ///   of two, and is at least 1
+    explicit
+    concurrent_frequency_map(
+        size_type numShards
+    )
+        : stl_collection_tag()
+        , m_numShards(ximpl_concurrent_frequency_map::round_shard_count(numShards))
+        , m_shift(shift_from_shard_count_(m_numShards))
+        , m_shards(new shard_type_[m_numShards])
+        , m_hash()
+    {}
+private:
+    concurrent_frequency_map(class_type const&) STLSOFT_COPY_CONSTRUCTION_PROSCRIBED;
+    void operator =(class_type const&) STLSOFT_COPY_ASSIGNMENT_PROSCRIBED;
+
+public: // operations
+    /// Pushes an entry onto the map
+    ///
+    /// \param key The record key
+    ///
+    /// \return The count of \c key after the push
+    count_type push(key_type const& key)
+    {
+        shard_type_&        shard = shard_for_(key);
+        lock_scope_type_    scope(shard.mx);
+
+        return shard.map.push(key);
+    }
+
+    /// Pushes an entry onto the map with a count of \c n
+    ///
+    /// \param key The record key
+    /// \param n The number by which to to insert/increase the count
+    ///   associated with \c key
+    void push_n(
+        key_type const&     key
+    ,   count_type          n
+    )
+    {
+        shard_type_&        shard = shard_for_(key);
+        lock_scope_type_    scope(shard.mx);
+
+        shard.map.push_n(key, n);
+    }
+
+    /// Merges in all entries from the given map
+    ///
+    /// \note Each shard is updated atomically, but the merge as a whole is
+    ///   not: a concurrent snapshot() may observe some shards merged and
+    ///   others not
+    class_type& merge(snapshot_type const& rhs)
+    {
+        std::vector<std::vector<value_type const*> > partitions(m_numShards);
+
+        { for (ss_typename_type_k snapshot_type::const_iterator i = rhs.begin(); rhs.end() != i; ++i)
+        {
+            partitions[shard_index_(i->first)].push_back(&*i);
+        }}
+
+        { for (size_type s = 0; s != m_numShards; ++s)
+        {
+            if (!partitions[s].empty())
+            {
+                shard_type_&        shard = m_shards[s];
+                lock_scope_type_    scope(shard.mx);
+
+                { for (value_type const* entry : partitions[s])
+                {
+                    shard.map.push_n(entry->first, entry->second);
+                }}
+            }
+        }}
+
+        return *this;
+    }
+
+    /// Merges in all entries from the given map
+    class_type& operator +=(snapshot_type const& rhs)
+    {
+        return merge(rhs);
+    }
+
+    /// Removes all entries from the map
+    void clear() STLSOFT_NOEXCEPT
+    {
+        { for (size_type s = 0; s != m_numShards; ++s)
+        {
+            lock_scope_type_ scope(m_shards[s].mx);
+
+            m_shards[s].map.clear();
+        }}
+    }
+
+public: // accessors
+    /// Returns the count associated with the entry representing the given
+    /// key, or 0 if no such entry exists.
+    count_type count(key_type const& key) const
+    {
+        shard_type_&        shard = shard_for_(key);
+        lock_scope_type_    scope(shard.mx);
+
+        return shard.map.count(key);
+    }
+
+    /// Returns the count associated with the entry representing the given
+    /// key, or 0 if no such entry exists.
+    count_type operator [](key_type const& key) const
+    {
+        return count(key);
+    }
+
+    /// Determines whether the given key is held in the instance
+    bool contains(key_type const& key) const
+    {
+        shard_type_&        shard = shard_for_(key);
+        lock_scope_type_    scope(shard.mx);
+
+        return shard.map.contains(key);
+    }
+
+    /// Obtains a consistent, point-in-time copy of the instance's entries
+    snapshot_type snapshot() const
+    {
+        snapshot_type r;
+
+        lock_all_();
+
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+        try
+        {
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+
+            { for (size_type s = 0; s != m_numShards; ++s)
+            {
+                r.merge(m_shards[s].map);
+            }}
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+        }
+        catch (...)
+        {
+            unlock_all_();
+
+            throw;
+        }
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+
+        unlock_all_();
+
+        return r;
+    }
+
+public: // attributes
+    /// Indicates whether the map is empty
+    bool_type empty() const
+    {
+        { for (size_type s = 0; s != m_numShards; ++s)
+        {
+            lock_scope_type_ scope(m_shards[s].mx);
+
+            if (!m_shards[s].map.empty())
+            {
+                return false;
+            }
+        }}
+
+        return true;
+    }
+
+    /// The number of unique entries in the map
+    size_type size() const
+    {
+        size_type n = 0;
+
+        { for (size_type s = 0; s != m_numShards; ++s)
+        {
+            lock_scope_type_ scope(m_shards[s].mx);
+
+            n += m_shards[s].map.size();
+        }}
+
+        return n;
+    }
+
+    /// The number of non-unique entries in the map
+    count_type total() const
+    {
+        count_type n = 0;
+
+        { for (size_type s = 0; s != m_numShards; ++s)
+        {
+            lock_scope_type_ scope(m_shards[s].mx);
+
+            n += m_shards[s].map.total();
+        }}
+
+        return n;
+    }
+
+    /// The number of shards
+    size_type num_shards() const STLSOFT_NOEXCEPT
+    {
+        return m_numShards;
+    }
+
+public: // iteration
+    /// A non-mutating (const) iterator representing the start of a
+    /// snapshot of the instance's entries
+    const_iterator begin() const
+    {
+        return const_iterator(std::make_shared<snapshot_type const>(snapshot()));
+    }
+    /// A non-mutating (const) iterator representing the end-point of any
+    /// snapshot of the instance's entries
+    const_iterator end() const
+    {
+        return const_iterator();
+    }
+
+    /// A non-mutating (const) iterator representing the start of a
+    /// snapshot of the instance's entries
+    const_iterator cbegin() const
+    {
+        return begin();
+    }
+    /// A non-mutating (const) iterator representing the end-point of any
+    /// snapshot of the instance's entries
+    const_iterator cend() const
+    {
+        return end();
+    }
+
+private: // implementation
+    static size_type default_concurrency_() STLSOFT_NOEXCEPT
+    {
+        unsigned const n = std::thread::hardware_concurrency();
+
+        return (0 == n) ? 1u : n;
+    }
+
+    static unsigned shift_from_shard_count_(size_type numShards) STLSOFT_NOEXCEPT
+    {
+        unsigned shift = 64;
+
+        for (; numShards > 1; numShards >>= 1)
+        {
+            --shift;
+        }
+
+        return shift;
+    }
+
+    size_type shard_index_(key_type const& key) const
+    {
+        // a shift of 64 is undefined, so a single shard is special-cased
+
+        if (1 == m_numShards)
+        {
+            return 0;
+        }
+
+        return ximpl_concurrent_frequency_map::shard_index_from_hash(m_hash(key), m_shift);
+    }
+
+    shard_type_& shard_for_(key_type const& key) const
+    {
+        return m_shards[shard_index_(key)];
+    }
+
+    void lock_all_() const STLSOFT_NOEXCEPT
+    {
+        { for (size_type s = 0; s != m_numShards; ++s)
+        {
+            m_shards[s].mx.lock();
+        }}
+    }
+
+    void unlock_all_() const STLSOFT_NOEXCEPT
+    {
+        { for (size_type s = m_numShards; 0 != s; --s)
+        {
+            m_shards[s - 1].mx.unlock();
+        }}
+    }
+
+private: // fields
+    size_type const                 m_numShards;
+    unsigned const                  m_shift;
+    std::unique_ptr<shard_type_[]>  m_shards;
+    hash_type                       m_hash;
+};
+
+
+/** Non-mutating (const) forward iterator for
+ *   \link stlsoft::concurrent_frequency_map concurrent_frequency_map\endlink
+ *
+ * \ingroup group__library__Container
+ *
+ * Each non-end iterator shares ownership of the snapshot taken when
+ * <code>begin()</code> was called, so it remains valid independently of
+ * the container and of any subsequent pushes.
+ */
+template<
+    ss_typename_param_k T_value
+,   ss_typename_param_k T_traits
+,   ss_typename_param_k T_hash
+>
+class concurrent_frequency_map<T_value, T_traits, T_hash>::const_iterator
+{
+private: // types
+    typedef ss_typename_type_k concurrent_frequency_map<T_value, T_traits, T_hash>::snapshot_type
+                                                            snapshot_type_;
+    typedef ss_typename_type_k snapshot_type_::const_iterator
+                                                            underlying_iterator_type_;
+    friend class concurrent_frequency_map<T_value, T_traits, T_hash>;
+public:
+    /// This type
+    typedef const_iterator                                  class_type;
+    /// The iterator category
+    typedef std::forward_iterator_tag                       iterator_category;
+    /// The value type
+    typedef ss_typename_type_k snapshot_type_::value_type   value_type;
+    /// The difference type
+    typedef ss_ptrdiff_t                                    difference_type;
+    /// The pointer type
+    typedef value_type const*                               pointer;
+    /// The reference type
+    typedef value_type const&                               reference;
+
+public: // construction
+    /// Constructs an end iterator
+    const_iterator()
+        : m_snapshot()
+        , m_it()
+    {}
+private:
+    explicit
+    const_iterator(std::shared_ptr<snapshot_type_ const> snapshot)
+        : m_snapshot(snapshot)
+        , m_it(snapshot->begin())
+    {
+        normalise_();
+    }
+
+public: // iteration
+    /// Dereferences the iterator
+    value_type const& operator *() const
+    {
+        STLSOFT_MESSAGE_ASSERT("attempting to dereference an end iterator", !is_end_());
+
+        return *m_it;
+    }
+    /// Dereferences the iterator
+    value_type const* operator ->() const
+    {
+        STLSOFT_MESSAGE_ASSERT("attempting to dereference an end iterator", !is_end_());
+
+        return &*m_it;
+    }
+
+    /// Pre-increment operator
+    class_type& operator ++()
+    {
+        STLSOFT_MESSAGE_ASSERT("attempting to increment an end iterator", !is_end_());
+
+        ++m_it;
+
+        normalise_();
+
+        return *this;
+    }
+    /// Post-increment operator
+    class_type operator ++(int)
+    {
+        class_type r(*this);
+
+        operator ++();
+
+        return r;
+    }
+
+public: // comparison
+    /// Evaluates whether two instances are equal
+    bool equal(class_type const& rhs) const
+    {
+        if (is_end_())
+        {
+            return rhs.is_end_();
+        }
+        else
+        {
+            return m_snapshot == rhs.m_snapshot && m_it == rhs.m_it;
+        }
+    }
+
+    /// Evaluates whether two instances are equal
+    friend bool operator ==(class_type const& lhs, class_type const& rhs)
+    {
+        return lhs.equal(rhs);
+    }
+    /// Evaluates whether two instances are not equal
+    friend bool operator !=(class_type const& lhs, class_type const& rhs)
+    {
+        return !lhs.equal(rhs);
+    }
+
+private: // implementation
+    bool is_end_() const STLSOFT_NOEXCEPT
+    {
+        return !m_snapshot;
+    }
+
+    // an iterator that has reached the end of its snapshot releases it, so
+    // that it compares equal to end()
+    void normalise_()
+    {
+        if (m_snapshot->end() == m_it)
+        {
+            m_snapshot.reset();
+            m_it = underlying_iterator_type_();
+        }
+    }
+
+private: // fields
+    std::shared_ptr<snapshot_type_ const>   m_snapshot;
+    underlying_iterator_type_               m_it;
+};
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef STLSOFT_NO_NAMESPACE
+} /* namespace stlsoft */
+#endif /* STLSOFT_NO_NAMESPACE */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !STLSOFT_INCL_STLSOFT_CONTAINERS_HPP_CONCURRENT_FREQUENCY_MAP */
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -54,9 +54,9 @@
 
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 # define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_FREQUENCY_MAP_MAJOR     2
-# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_FREQUENCY_MAP_MINOR     10
-# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_FREQUENCY_MAP_REVISION  1
-# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_FREQUENCY_MAP_EDIT      56
+# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_FREQUENCY_MAP_MINOR     11
+# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_FREQUENCY_MAP_REVISION  0
+# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_FREQUENCY_MAP_EDIT      57
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 
@@ -79,6 +79,11 @@
 #ifndef STLSOFT_INCL_STLSOFT_COLLECTIONS_UTIL_HPP_COLLECTIONS
 # include <stlsoft/collections/util/collections.hpp>
 #endif /* !STLSOFT_INCL_STLSOFT_COLLECTIONS_UTIL_HPP_COLLECTIONS */
+#if __cplusplus >= 201103L
+# ifndef STLSOFT_INCL_STLSOFT_CONTAINERS_UTIL_HPP_FLAT_COUNT_TABLE
+#  include <stlsoft/containers/util/flat_count_table.hpp>
+# endif /* !STLSOFT_INCL_STLSOFT_CONTAINERS_UTIL_HPP_FLAT_COUNT_TABLE */
+#endif /* C++11+ */
 #ifndef STLSOFT_INCL_STLSOFT_META_HPP_IS_INTEGRAL_TYPE
 # include <stlsoft/meta/is_integral_type.hpp>
 #endif /* !STLSOFT_INCL_STLSOFT_META_HPP_IS_INTEGRAL_TYPE */
@@ -211,6 +216,44 @@ struct frequency_map_traits_unordered
     /// The non-mutating (const) reverse iterator type
     typedef void                                            const_reverse_iterator;
 };
+
+/** @brief Flat (open-addressing) traits for stlsoft::frequency_map
+ *
+ * @tparam T_value The value type of the  specialisation of
+ *   stlsoft::frequency_map
+ * @tparam T_count The count type of the  specialisation of
+ *   stlsoft::frequency_map
+ *
+ * The map type is stlsoft::flat_count_table, which holds its entries (and
+ * their counts) in place in a single array, rather than in one node per
+ * entry, so it avoids an allocation per entry at the cost of scattering
+ * keys that an identity hash would otherwise keep adjacent. As with
+ * frequency_map_traits_unordered, iteration order is unspecified.
+ */
+template <
+    ss_typename_param_k T_value
+,   ss_typename_param_k T_count = ss_typename_type_k frequency_map_traits_base<T_value>::count_type
+>
+struct frequency_map_traits_flat
+{
+    /// The value type
+    typedef T_value                                         value_type;
+    /// The count type
+    typedef T_count                                         count_type;
+    /// The hash type
+    typedef STLSOFT_NS_QUAL_STD(hash)<T_value>              hash_type;
+    /// The key-equal type
+    typedef STLSOFT_NS_QUAL_STD(equal_to)<T_value>          key_equal_type;
+    /// The map type
+    typedef flat_count_table<
+        value_type
+    ,   count_type
+    ,   hash_type
+    ,   key_equal_type
+    >                                                       map_type;
+    /// The non-mutating (const) reverse iterator type
+    typedef void                                            const_reverse_iterator;
+};
 #endif /* C++11+ */
 
 
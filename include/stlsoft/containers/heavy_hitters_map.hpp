@@ -0,0 +1,767 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    stlsoft/containers/heavy_hitters_map.hpp
+ *
+ * Purpose: Definition of the heavy_hitters_map container class template.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * Home:    http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+
+/* STLSOFT:C++98:FILE_EXCEPTED */
+/* STLSOFT:C++03:FILE_EXCEPTED */
+
+/** \file stlsoft/containers/heavy_hitters_map.hpp
+ *
+ * \brief [C++] Definition of the stlsoft::heavy_hitters_map container
+ *   class template
+ *   (\ref group__library__Container "Container" Library).
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_CONTAINERS_HPP_HEAVY_HITTERS_MAP
+#define STLSOFT_INCL_STLSOFT_CONTAINERS_HPP_HEAVY_HITTERS_MAP
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_HEAVY_HITTERS_MAP_MAJOR     1
+# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_HEAVY_HITTERS_MAP_MINOR     0
+# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_HEAVY_HITTERS_MAP_REVISION  0
+# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_HEAVY_HITTERS_MAP_EDIT      1
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_H_STLSOFT
+# include <stlsoft/stlsoft.h>
+#endif /* !STLSOFT_INCL_STLSOFT_H_STLSOFT */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+#ifndef STLSOFT_INCL_STLSOFT_COLLECTIONS_UTIL_HPP_COLLECTIONS
+# include <stlsoft/collections/util/collections.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_COLLECTIONS_UTIL_HPP_COLLECTIONS */
+#ifndef STLSOFT_INCL_STLSOFT_CONTAINERS_HPP_FREQUENCY_MAP
+# include <stlsoft/containers/frequency_map.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_CONTAINERS_HPP_FREQUENCY_MAP */
+#ifndef STLSOFT_INCL_STLSOFT_META_HPP_IS_INTEGRAL_TYPE
+# include <stlsoft/meta/is_integral_type.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_META_HPP_IS_INTEGRAL_TYPE */
+#ifndef STLSOFT_INCL_STLSOFT_UTIL_HPP_STD_SWAP
+# include <stlsoft/util/std_swap.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_UTIL_HPP_STD_SWAP */
+
+#ifndef STLSOFT_INCL_ALGORITHM
+# define STLSOFT_INCL_ALGORITHM
+# include <algorithm>
+#endif /* !STLSOFT_INCL_ALGORITHM */
+#ifndef STLSOFT_INCL_FUNCTIONAL
+# define STLSOFT_INCL_FUNCTIONAL
+# include <functional>
+#endif /* !STLSOFT_INCL_FUNCTIONAL */
+#ifndef STLSOFT_INCL_TYPE_TRAITS
+# define STLSOFT_INCL_TYPE_TRAITS
+# include <type_traits>
+#endif /* !STLSOFT_INCL_TYPE_TRAITS */
+#ifndef STLSOFT_INCL_UNORDERED_MAP
+# define STLSOFT_INCL_UNORDERED_MAP
+# include <unordered_map>
+#endif /* !STLSOFT_INCL_UNORDERED_MAP */
+#ifndef STLSOFT_INCL_VECTOR
+# define STLSOFT_INCL_VECTOR
+# include <vector>
+#endif /* !STLSOFT_INCL_VECTOR */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef STLSOFT_NO_NAMESPACE
+namespace stlsoft
+{
+#endif /* STLSOFT_NO_NAMESPACE */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * classes
+ */
+
+/** An entry in a
+ *   \link stlsoft::heavy_hitters_map heavy_hitters_map\endlink
+ *
+ * \ingroup group__library__Container
+ *
+ * The members \c first and \c second are named as those of the value type
+ * of \link stlsoft::frequency_map frequency_map\endlink, so that code that
+ * iterates one may iterate the other unchanged.
+ *
+ * The true number of occurrences of \c first lies in the range
+ * <code>[second - error, second]</code>.
+ */
+template<
+    ss_typename_param_k T_value
+,   ss_typename_param_k T_count
+>
+struct heavy_hitters_map_entry
+{
+    /// The key
+    T_value first;
+    /// The estimated count, which never underestimates the true count
+    T_count second;
+    /// The maximum amount by which \c second may overestimate the true
+    /// count
+    T_count error;
+
+    /// The guaranteed (minimum) count
+    T_count guaranteed() const STLSOFT_NOEXCEPT
+    {
+        return second - error;
+    }
+};
+
+/** Bounded-memory, approximate counterpart of
+ *   \link stlsoft::frequency_map frequency_map\endlink that monitors only
+ *   the most frequent keys
+ *
+ * \ingroup group__library__Container
+ *
+ * \tparam T_value The value type of the container
+ * \tparam T_count The count type
+ * \tparam T_hash The hash function type
+ * \tparam T_equal The key equality function type
+ *
+ * Implements the <em>Space-Saving</em> algorithm (Metwally, Agrawal and
+ * El Abbadi, 2005). At most capacity() keys are monitored, each with an
+ * estimated count and an error bound. When a key that is not monitored is
+ * pushed into a full instance, it replaces the monitored key with the
+ * smallest count, inheriting that count as its error. Consequently, after
+ * \c N pushes with a capacity of \c m:
+ *
+ * - every monitored key's count overestimates its true count by at most
+ *   its \c error, which is no greater than error_bound(), which is no
+ *   greater than <code>N / m</code>;
+ * - every key whose true count exceeds error_bound() is monitored.
+ *
+ * The monitored keys are held in a binary min-heap (by count) that is
+ * indexed by a hash table, so that each push() is <code>O(1)</code> to
+ * find the key and <code>O(log m)</code> to reorder the heap, and memory
+ * use is <code>O(m)</code> however many distinct keys are pushed.
+ */
+template<
+    ss_typename_param_k T_value
+,   ss_typename_param_k T_count =   ss_typename_type_k frequency_map_traits_base<T_value>::count_type
+,   ss_typename_param_k T_hash  =   std::hash<T_value>
+,   ss_typename_param_k T_equal =   std::equal_to<T_value>
+>
+class heavy_hitters_map
+    : public stl_collection_tag
+{
+public: // types
+    /// This type
+    typedef heavy_hitters_map<
+        T_value
+    ,   T_count
+    ,   T_hash
+    ,   T_equal
+    >                                                       class_type;
+    /// The key type
+    typedef T_value                                         key_type;
+    /// The count type
+    typedef T_count                                         count_type;
+    /// The value type
+    typedef heavy_hitters_map_entry<
+        T_value
+    ,   T_count
+    >                                                       value_type;
+    /// The non-mutating (const) reference type
+    typedef value_type const&                               const_reference;
+    /// The hash type
+    typedef T_hash                                          hash_type;
+    /// The key equality type
+    typedef T_equal                                         key_equal_type;
+    /// The size type
+    typedef ss_size_t                                       size_type;
+    /// The difference type
+    typedef ss_ptrdiff_t                                    difference_type;
+    /// The boolean type
+    typedef ss_bool_t                                       bool_type;
+private:
+    typedef std::vector<value_type>                         entries_type_;
+    // the heap holds each entry's count, as well as its index, so that
+    // sifting compares adjacent heap nodes, rather than scattered entries
+    struct heap_node_
+    {
+        count_type  count;
+        size_type   entryIndex;
+    };
+    typedef std::vector<heap_node_>                         heap_type_;
+    typedef std::vector<size_type>                          indexes_type_;
+    typedef std::unordered_map<
+        key_type
+    ,   size_type
+    ,   hash_type
+    ,   key_equal_type
+    >                                                       index_type_;
+public:
+    /// The non-mutating (const) iterator type
+    typedef ss_typename_type_k entries_type_::const_iterator
+                                                            const_iterator;
+
+public: // construction
+    /// Creates an empty instance that monitors at most \c capacity keys
+    ///
+    /// \param capacity The maximum number of monitored keys. Must be
+    ///   greater than 0
+    explicit
+    heavy_hitters_map(
+        size_type capacity
+    )
+        : stl_collection_tag()
+        , m_capacity(capacity)
+        , m_entries()
+        , m_heap()
+        , m_heapPositions()
+        , m_index()
+        , m_total(0)
+        , m_hasEvicted(false)
+    {
+        STLSOFT_STATIC_ASSERT(0 != stlsoft::is_integral_type<count_type>::value);
+
+        STLSOFT_MESSAGE_ASSERT("capacity must be greater than 0", 0 != capacity);
+
+        if (0 == m_capacity)
+        {
+            m_capacity = 1;
+        }
+
+        m_entries.reserve(m_capacity);
+        m_heap.reserve(m_capacity);
+        m_heapPositions.reserve(m_capacity);
+        m_index.reserve(m_capacity);
+    }
+
+public: // operations
+    /// Pushes an entry onto the map
+    ///
+    /// \param key The record key
+    ///
+    /// \return The estimated count of \c key after the push
+    ///
+    /// \note <b>Thread-safety</b>: it is strongly exception-safe - if an
+    ///   entry cannot be added, the state of the instance will be unchanged
+    count_type push(key_type const& key)
+    {
+        return push_(key, 1);
+    }
+
+    /// Pushes an entry onto the map with a count of \c n
+    ///
+    /// \param key The record key
+    /// \param n The number by which to to insert/increase the count
+    ///   associated with \c key
+    ///
+    /// \note <b>Thread-safety</b>: it is strongly exception-safe - if an
+    ///   entry cannot be added, the state of the instance will be unchanged
+    void push_n(
+        key_type const&     key
+    ,   count_type          n
+    )
+    {
+        if (0 != n)
+        {
+            push_(key, n);
+        }
+    }
+
+    /// Removes all entries from the map
+    void clear() STLSOFT_NOEXCEPT
+    {
+        STLSOFT_ASSERT(is_valid());
+
+        m_entries.clear();
+        m_heap.clear();
+        m_heapPositions.clear();
+        m_index.clear();
+        m_total = 0;
+        m_hasEvicted = false;
+
+        STLSOFT_ASSERT(is_valid());
+    }
+
+    /// Swaps the state of the instance with another
+    void swap(class_type& rhs) STLSOFT_NOEXCEPT
+    {
+        STLSOFT_ASSERT(is_valid());
+
+        std_swap(m_capacity, rhs.m_capacity);
+        m_entries.swap(rhs.m_entries);
+        m_heap.swap(rhs.m_heap);
+        m_heapPositions.swap(rhs.m_heapPositions);
+        m_index.swap(rhs.m_index);
+        std_swap(m_total, rhs.m_total);
+        std_swap(m_hasEvicted, rhs.m_hasEvicted);
+
+        STLSOFT_ASSERT(is_valid());
+    }
+
+public: // search
+    /// Determines whether the given key is monitored
+    bool contains(key_type const& key) const
+    {
+        STLSOFT_ASSERT(is_valid());
+
+        return m_index.end() != m_index.find(key);
+    }
+
+    /// Searches for the entry of the given key, returning end() if it is
+    /// not monitored
+    const_iterator find(key_type const& key) const
+    {
+        STLSOFT_ASSERT(is_valid());
+
+        ss_typename_type_k index_type_::const_iterator const it = m_index.find(key);
+
+        return (m_index.end() != it) ? m_entries.begin() + static_cast<difference_type>(it->second) : m_entries.end();
+    }
+
+public: // accessors
+    /// Returns the estimated count associated with the entry representing
+    /// the given key, or 0 if it is not monitored
+    ///
+    /// \remarks The true count of a key that is not monitored is at most
+    ///   error_bound()
+    count_type operator [](key_type const& key) const
+    {
+        return count(key);
+    }
+
+    /// Returns the estimated count associated with the entry representing
+    /// the given key, or 0 if it is not monitored
+    ///
+    /// \remarks The true count of a key that is not monitored is at most
+    ///   error_bound()
+    count_type count(key_type const& key) const
+    {
+        STLSOFT_ASSERT(is_valid());
+
+        ss_typename_type_k index_type_::const_iterator const it = m_index.find(key);
+
+        return (m_index.end() != it) ? m_entries[it->second].second : 0;
+    }
+
+    /// Returns (up to) the \c k monitored entries with the highest
+    /// estimated counts, in descending order of count
+    ///
+    /// \remarks An entry \c e at position \c i is certainly among the true
+    ///   top <code>i + 1</code> keys if <code>e.guaranteed()</code> is
+    ///   greater than or equal to the count of the entry at position
+    ///   <code>i + 1</code> (or to error_bound(), if there is none)
+    std::vector<value_type> top(size_type k) const
+    {
+        STLSOFT_ASSERT(is_valid());
+
+        entries_type_ r(m_entries);
+
+        if (k > r.size())
+        {
+            k = r.size();
+        }
+
+        std::partial_sort(r.begin(), r.begin() + static_cast<difference_type>(k), r.end(), &class_type::precedes_);
+
+        r.erase(r.begin() + static_cast<difference_type>(k), r.end());
+
+        return r;
+    }
+
+public: // attributes
+    /// Indicates whether the map is empty
+    bool_type empty() const STLSOFT_NOEXCEPT
+    {
+        STLSOFT_ASSERT(is_valid());
+
+        return m_entries.empty();
+    }
+
+    /// The number of monitored entries in the map
+    ///
+    /// \remarks This is never more than capacity()
+    size_type size() const STLSOFT_NOEXCEPT
+    {
+        STLSOFT_ASSERT(is_valid());
+
+        return m_entries.size();
+    }
+
+    /// The maximum number of monitored entries
+    size_type capacity() const STLSOFT_NOEXCEPT
+    {
+        return m_capacity;
+    }
+
+    /// The number of non-unique entries pushed onto the map
+    ///
+    /// \remarks This is exact, and is equal to the sum of the estimated
+    ///   counts of all monitored entries
+    count_type total() const STLSOFT_NOEXCEPT
+    {
+        STLSOFT_ASSERT(is_valid());
+
+        return m_total;
+    }
+
+    /// The upper bound on the true count of any key that is not monitored,
+    /// and on the \c error of any key that is
+    ///
+    /// \remarks This is 0 until more than capacity() distinct keys have
+    ///   been pushed, and is never greater than
+    ///   <code>total() / capacity()</code>
+    count_type error_bound() const STLSOFT_NOEXCEPT
+    {
+        STLSOFT_ASSERT(is_valid());
+
+        return m_hasEvicted ? m_heap[0].count : 0;
+    }
+
+public: // iteration
+    /// A non-mutating (const) iterator representing the start of the
+    /// (unordered) sequence of monitored entries
+    const_iterator begin() const
+    {
+        STLSOFT_ASSERT(is_valid());
+
+        return m_entries.begin();
+    }
+    /// A non-mutating (const) iterator representing the end-point of the
+    /// (unordered) sequence of monitored entries
+    const_iterator end() const
+    {
+        STLSOFT_ASSERT(is_valid());
+
+        return m_entries.end();
+    }
+
+    /// A non-mutating (const) iterator representing the start of the
+    /// (unordered) sequence of monitored entries
+    const_iterator cbegin() const
+    {
+        return begin();
+    }
+    /// A non-mutating (const) iterator representing the end-point of the
+    /// (unordered) sequence of monitored entries
+    const_iterator cend() const
+    {
+        return end();
+    }
+
+private: // implementation
+    static bool precedes_(value_type const& lhs, value_type const& rhs)
+    {
+        if (lhs.second != rhs.second)
+        {
+            return lhs.second > rhs.second;
+        }
+
+        return lhs.error < rhs.error;
+    }
+
+    count_type push_(key_type const& key, count_type n)
+    {
+        STLSOFT_ASSERT(is_valid());
+
+        ss_typename_type_k index_type_::const_iterator const it = m_index.find(key);
+        size_type                                           entryIndex;
+
+        if (m_index.end() != it)
+        {
+            entryIndex = it->second;
+
+            m_entries[entryIndex].second += n;
+        }
+        else if (m_entries.size() < m_capacity)
+        {
+            // all storage was reserved by the constructor, so only the
+            // index insertion, and the copying of the key, can throw
+
+            entryIndex = m_entries.size();
+
+            value_type const entry = { key, n, 0 };
+
+            m_index.insert(std::make_pair(key, entryIndex));
+
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+            try
+            {
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+
+                m_entries.push_back(entry);
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+            }
+            catch (...)
+            {
+                m_index.erase(key);
+
+                throw;
+            }
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+
+            heap_node_ const node = { n, entryIndex };
+
+            m_heap.push_back(node);
+            m_heapPositions.push_back(entryIndex);
+
+            sift_up_(entryIndex);
+        }
+        else
+        {
+            // evict the entry with the smallest count, which is at the root
+            // of the heap, and give its count to the new key as its error
+
+            entryIndex = m_heap[0].entryIndex;
+
+            value_type& entry = m_entries[entryIndex];
+
+#if __cplusplus >= 201703L
+            rekey_(entry, key, entryIndex, std::integral_constant<bool, std::is_nothrow_swappable<key_type>::value>());
+#else /* ? C++17+ */
+            rekey_(entry, key, entryIndex, std::false_type());
+#endif /* C++17+ */
+
+            entry.error     =   entry.second;
+            entry.second    +=  n;
+
+            m_hasEvicted = true;
+        }
+
+        m_total += n;
+
+        count_type const r = m_entries[entryIndex].second;
+
+        size_type const position = m_heapPositions[entryIndex];
+
+        m_heap[position].count = r;
+
+        sift_down_(position);
+
+        STLSOFT_ASSERT(is_valid());
+
+        return r;
+    }
+
+#if __cplusplus >= 201703L
+    // Re-keys the evicted entry's index node, rather than freeing it and
+    // allocating another. Both copies of the key are made before the node
+    // is extracted, and are then swapped into place, so that nothing can
+    // throw between the extraction and the (non-allocating, since the
+    // index has just shrunk) reinsertion
+    void rekey_(value_type& entry, key_type const& key, size_type /* entryIndex */, std::true_type)
+    {
+        key_type                                    newKey(key);
+        key_type                                    indexKey(key);
+        ss_typename_type_k index_type_::node_type   node = m_index.extract(entry.first);
+
+        std_swap(node.key(), indexKey);
+
+        m_index.insert(std::move(node));
+
+        std_swap(entry.first, newKey);
+    }
+#endif /* C++17+ */
+
+    // Re-keys the evicted entry by indexing the new key before unindexing
+    // the old one, so that a failure to assign the key can be undone. The
+    // old key is unindexed via an iterator, since it no longer exists once
+    // the assignment has been made
+    void rekey_(value_type& entry, key_type const& key, size_type entryIndex, std::false_type)
+    {
+        ss_typename_type_k index_type_::iterator const  newIt = m_index.insert(std::make_pair(key, entryIndex)).first;
+        ss_typename_type_k index_type_::iterator const  oldIt = m_index.find(entry.first);
+
+        STLSOFT_ASSERT(m_index.end() != oldIt);
+
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+        try
+        {
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+
+            entry.first = key;
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+        }
+        catch (...)
+        {
+            m_index.erase(newIt);
+
+            throw;
+        }
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+
+        m_index.erase(oldIt);
+    }
+
+    void place_(size_type position, heap_node_ const& node) STLSOFT_NOEXCEPT
+    {
+        m_heap[position] = node;
+        m_heapPositions[node.entryIndex] = position;
+    }
+
+    void sift_up_(size_type position) STLSOFT_NOEXCEPT
+    {
+        heap_node_ const node = m_heap[position];
+
+        for (; 0 != position; )
+        {
+            size_type const parent = (position - 1) / 2;
+
+            if (!(node.count < m_heap[parent].count))
+            {
+                break;
+            }
+
+            place_(position, m_heap[parent]);
+
+            position = parent;
+        }
+
+        place_(position, node);
+    }
+
+    void sift_down_(size_type position) STLSOFT_NOEXCEPT
+    {
+        heap_node_ const    node    =   m_heap[position];
+        size_type const     n       =   m_heap.size();
+
+        for (;;)
+        {
+            size_type   least   =   2 * position + 1;
+
+            if (least >= n)
+            {
+                break;
+            }
+            if (least + 1 < n &&
+                m_heap[least + 1].count < m_heap[least].count)
+            {
+                ++least;
+            }
+
+            if (!(m_heap[least].count < node.count))
+            {
+                break;
+            }
+
+            place_(position, m_heap[least]);
+
+            position = least;
+        }
+
+        place_(position, node);
+    }
+
+    bool is_valid() const STLSOFT_NOEXCEPT
+    {
+        if (m_entries.size() > m_capacity)
+        {
+            return false;
+        }
+
+        if (m_entries.size() != m_heap.size() ||
+            m_entries.size() != m_heapPositions.size() ||
+            m_entries.size() != m_index.size())
+        {
+            return false;
+        }
+
+        if (m_entries.empty() != (0u == m_total))
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+private: // fields
+    size_type       m_capacity;
+    entries_type_   m_entries;          // entries, in order of admission
+    heap_type_      m_heap;             // entry indexes, as min-heap by count
+    indexes_type_   m_heapPositions;    // heap position, by entry index
+    index_type_     m_index;            // entry index, by key
+    count_type      m_total;
+    bool            m_hasEvicted;
+};
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * swapping
+ */
+
+template<
+    ss_typename_param_k T_value
+,   ss_typename_param_k T_count
+,   ss_typename_param_k T_hash
+,   ss_typename_param_k T_equal
+>
+inline void swap(
+    heavy_hitters_map<T_value, T_count, T_hash, T_equal>&   lhs
+,   heavy_hitters_map<T_value, T_count, T_hash, T_equal>&   rhs
+) STLSOFT_NOEXCEPT
+{
+    lhs.swap(rhs);
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef STLSOFT_NO_NAMESPACE
+} /* namespace stlsoft */
+#endif /* STLSOFT_NO_NAMESPACE */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !STLSOFT_INCL_STLSOFT_CONTAINERS_HPP_HEAVY_HITTERS_MAP */
+
+/* ///////////////////////////// end of file //////////////////////////// */
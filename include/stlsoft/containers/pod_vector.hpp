@@ -4,7 +4,7 @@
  * Purpose: Contains the pod_vector class.
  *
  * Created: 23rd December 2003
- * Updated: 27th September 2024
+ * Updated: 16th October 2026
  *
  * Thanks:  Chris Newcombe for requesting sufficient enhancements to
  *          auto_buffer such that pod_vector was born. Christian Roessel,
@@ -13,7 +13,7 @@
  *
  * Home:    http://stlsoft.org/
  *
- * Copyright (c) 2019-2024, Matthew Wilson and Synesis Information Systems
+ * Copyright (c) 2019-2026, Matthew Wilson and Synesis Information Systems
  * Copyright (c) 2003-2019, Matthew Wilson and Synesis Software
  * All rights reserved.
  *
@@ -58,9 +58,9 @@
 
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 # define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_POD_VECTOR_MAJOR       4
-# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_POD_VECTOR_MINOR       3
-# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_POD_VECTOR_REVISION    3
-# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_POD_VECTOR_EDIT        99
+# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_POD_VECTOR_MINOR       4
+# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_POD_VECTOR_REVISION    1
+# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_POD_VECTOR_EDIT        100
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 
@@ -115,6 +115,138 @@ namespace stlsoft
 #endif /* STLSOFT_NO_NAMESPACE */
 
 
+/* /////////////////////////////////////////////////////////////////////////
+ * growth policies
+ */
+
+/** Growth policy for \link stlsoft::pod_vector pod_vector\endlink that
+ *   increases the capacity by (up to) the internal size each time it is
+ *   exceeded
+ *
+ * \ingroup group__library__Container
+ *
+ * This is the historical behaviour of \c pod_vector, and is the default
+ * policy unless \c STLSOFT_POD_VECTOR_USE_GEOMETRIC_GROWTH is defined.
+ *
+ * \note Because the increment is constant, a sequence of \c n calls to
+ *   \c push_back() copies O(n<sup>2</sup>) elements.
+ */
+struct pod_vector_linear_growth_policy
+{
+    /// Calculates the new capacity
+    ///
+    /// \param currentCapacity The current capacity
+    /// \param requiredSize The number of elements required. Always greater
+    ///   than \c currentCapacity
+    /// \param internalSize The size of the vector's internal buffer
+    static
+    ss_size_t
+    new_capacity(
+        ss_size_t   currentCapacity
+    ,   ss_size_t   requiredSize
+    ,   ss_size_t   internalSize
+    ) STLSOFT_NOEXCEPT
+    {
+        STLSOFT_SUPPRESS_UNUSED(currentCapacity);
+
+        ss_size_t const capacity = internalSize + requiredSize;
+
+        return capacity - capacity % internalSize;
+    }
+};
+
+/** Growth policy for \link stlsoft::pod_vector pod_vector\endlink that
+ *   multiplies the capacity by <code>V_numerator / V_denominator</code>
+ *   each time it is exceeded
+ *
+ * \ingroup group__library__Container
+ *
+ * \param V_numerator The numerator of the growth factor
+ * \param V_denominator The denominator of the growth factor
+ *
+ * The default factor is 1.5; use
+ * <code>pod_vector_geometric_growth_policy<2, 1></code> for doubling. A
+ * sequence of \c n calls to \c push_back() copies O(n) elements.
+ */
+template <
+    ss_size_t   V_numerator     =   3
+,   ss_size_t   V_denominator   =   2
+>
+struct pod_vector_geometric_growth_policy
+{
+    /// Calculates the new capacity
+    ///
+    /// \param currentCapacity The current capacity
+    /// \param requiredSize The number of elements required. Always greater
+    ///   than \c currentCapacity
+    /// \param internalSize The size of the vector's internal buffer
+    static
+    ss_size_t
+    new_capacity(
+        ss_size_t   currentCapacity
+    ,   ss_size_t   requiredSize
+    ,   ss_size_t   internalSize
+    ) STLSOFT_NOEXCEPT
+    {
+        STLSOFT_STATIC_ASSERT(V_numerator > V_denominator);
+        STLSOFT_STATIC_ASSERT(V_denominator > 0);
+
+        ss_size_t const base        =   (currentCapacity < internalSize) ? internalSize : currentCapacity;
+        ss_size_t const increment   =   (base / V_denominator) * (V_numerator - V_denominator);
+        ss_size_t const grown       =   base + increment;
+
+        // on overflow, fall back to what is required
+
+        if (grown < base)
+        {
+            return requiredSize;
+        }
+
+        return (grown < requiredSize) ? requiredSize : grown;
+    }
+};
+
+/** Growth policy for \link stlsoft::pod_vector pod_vector\endlink that
+ *   increases the capacity to exactly that required
+ *
+ * \ingroup group__library__Container
+ *
+ * This minimises memory use, at the cost of a reallocation (and copy) on
+ * every insertion that exceeds the capacity. It is suitable only where
+ * insertions are rare, or are preceded by a call to \c reserve().
+ */
+struct pod_vector_exact_growth_policy
+{
+    /// Calculates the new capacity
+    ///
+    /// \param currentCapacity The current capacity
+    /// \param requiredSize The number of elements required. Always greater
+    ///   than \c currentCapacity
+    /// \param internalSize The size of the vector's internal buffer
+    static
+    ss_size_t
+    new_capacity(
+        ss_size_t   currentCapacity
+    ,   ss_size_t   requiredSize
+    ,   ss_size_t   internalSize
+    ) STLSOFT_NOEXCEPT
+    {
+        STLSOFT_SUPPRESS_UNUSED(currentCapacity);
+        STLSOFT_SUPPRESS_UNUSED(internalSize);
+
+        return requiredSize;
+    }
+};
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# ifdef STLSOFT_POD_VECTOR_USE_GEOMETRIC_GROWTH
+#  define STLSOFT_POD_VECTOR_DEFAULT_GROWTH_POLICY_         pod_vector_geometric_growth_policy<>
+# else /* ? STLSOFT_POD_VECTOR_USE_GEOMETRIC_GROWTH */
+#  define STLSOFT_POD_VECTOR_DEFAULT_GROWTH_POLICY_         pod_vector_linear_growth_policy
+# endif /* STLSOFT_POD_VECTOR_USE_GEOMETRIC_GROWTH */
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+
 /* /////////////////////////////////////////////////////////////////////////
  * classes
  */
@@ -122,6 +254,20 @@ namespace stlsoft
 /** Efficient vector class for use with POD types only
  *
  * \ingroup group__library__Container
+ *
+ * \param T_value The value type
+ * \param T_allocator The allocator type
+ * \param V_internalSize The number of elements in the internal buffer
+ * \param T_growthPolicy The policy that determines the new capacity when
+ *   an insertion exceeds the current capacity. One of
+ *   \link stlsoft::pod_vector_linear_growth_policy pod_vector_linear_growth_policy\endlink,
+ *   \link stlsoft::pod_vector_geometric_growth_policy pod_vector_geometric_growth_policy\endlink
+ *   or
+ *   \link stlsoft::pod_vector_exact_growth_policy pod_vector_exact_growth_policy\endlink,
+ *   or any type with a compatible static <code>new_capacity()</code>
+ *   method. Defaults to \c pod_vector_linear_growth_policy or, if
+ *   \c STLSOFT_POD_VECTOR_USE_GEOMETRIC_GROWTH is defined,
+ *   <code>pod_vector_geometric_growth_policy<></code>
  */
 template <
     ss_typename_param_k T_value
@@ -129,9 +275,11 @@ template <
     defined(STLSOFT_CF_TEMPLATE_CLASS_DEFAULT_FUNDAMENTAL_ARGUMENT_SUPPORT)
 ,   ss_typename_param_k T_allocator         =   ss_typename_type_def_k allocator_selector<T_value>::allocator_type
 ,   ss_size_t           V_internalSize      =   64
+,   ss_typename_param_k T_growthPolicy      =   STLSOFT_POD_VECTOR_DEFAULT_GROWTH_POLICY_
 #else /* ? STLSOFT_CF_TEMPLATE_CLASS_DEFAULT_CLASS_ARGUMENT_SUPPORT && STLSOFT_CF_TEMPLATE_CLASS_DEFAULT_FUNDAMENTAL_ARGUMENT_SUPPORT */
 ,   ss_typename_param_k T_allocator      /* =   ss_typename_type_def_k STLSOFT_NS_QUAL(allocator_selector)<T_value>::allocator_type */
 ,   ss_size_t           V_internalSize   /* =   64 */
+,   ss_typename_param_k T_growthPolicy   /* =   pod_vector_linear_growth_policy */
 #endif /* STLSOFT_CF_TEMPLATE_CLASS_DEFAULT_CLASS_ARGUMENT_SUPPORT && STLSOFT_CF_TEMPLATE_CLASS_DEFAULT_FUNDAMENTAL_ARGUMENT_SUPPORT */
 >
 class pod_vector
@@ -150,11 +298,14 @@ public:
     typedef ss_typename_type_k buffer_type_::value_type     value_type;
     /// The allocator type
     typedef ss_typename_type_k buffer_type_::allocator_type allocator_type;
+    /// The growth policy type
+    typedef T_growthPolicy                                  growth_policy_type;
     /// The current specialisation of the type
     typedef pod_vector<
         T_value
     ,   T_allocator
     ,   V_internalSize
+    ,   T_growthPolicy
     >                                                       class_type;
     /// The reference type
     typedef ss_typename_type_k buffer_type_::reference      reference;
@@ -239,6 +390,7 @@ public:
     void        clear();
     void        swap(class_type& rhs);
     void        reserve(size_type cItems) /* stlsoft_throw_1(STLSOFT_NS_QUAL_STD(bad_alloc) ) */;
+    void        shrink_to_fit() /* stlsoft_throw_1(STLSOFT_NS_QUAL_STD(bad_alloc) ) */;
 // NOTE: resize() is split into two, so the one-param version can be very quick
     void        resize(size_type cItems) /* stlsoft_throw_1(STLSOFT_NS_QUAL_STD(bad_alloc) ) */;
     void        resize(size_type cItems, value_type const& value) /* stlsoft_throw_1(STLSOFT_NS_QUAL_STD(bad_alloc) ) */;
@@ -286,12 +438,13 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
 ss_bool_t
 operator ==(
-    pod_vector<T_value, T_allocator, V_internalSize> const& lhs
-,   pod_vector<T_value, T_allocator, V_internalSize> const& rhs
+    pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy> const& lhs
+,   pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy> const& rhs
 )
 {
     if (lhs.size() != rhs.size())
@@ -301,7 +454,7 @@ operator ==(
     else
     {
 #if 0
-        for (ss_typename_type_k pod_vector<T_value, T_allocator, V_internalSize>::size_type i = 0, size = lhs.size(); i < size; ++i)
+        for (ss_typename_type_k pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::size_type i = 0, size = lhs.size(); i < size; ++i)
         {
             if (lhs[i] != rhs[i])
             {
@@ -311,7 +464,7 @@ operator ==(
 
         return true;
 #else /* ? 0 */
-        return 0 == memcmp(&lhs[0], &rhs[0], sizeof(ss_typename_type_k pod_vector<T_value, T_allocator, V_internalSize>::size_type) * lhs.size());
+        return 0 == memcmp(&lhs[0], &rhs[0], sizeof(ss_typename_type_k pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::value_type) * lhs.size());
 #endif /* 0 */
     }
 }
@@ -320,12 +473,13 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
 ss_bool_t
 operator !=(
-    pod_vector<T_value, T_allocator, V_internalSize> const& lhs
-,   pod_vector<T_value, T_allocator, V_internalSize> const& rhs
+    pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy> const& lhs
+,   pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy> const& rhs
 )
 {
     return !operator ==(lhs, rhs);
@@ -340,12 +494,13 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
 void
 swap(
-    pod_vector<T_value, T_allocator, V_internalSize>&   lhs
-,   pod_vector<T_value, T_allocator, V_internalSize>&   rhs
+    pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>&   lhs
+,   pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>&   rhs
 )
 {
     lhs.swap(rhs);
@@ -367,7 +522,7 @@ swap(
      defined(STLSOFT_CF_FUNCTION_SIGNATURE_FULL_ARG_QUALIFICATION_REQUIRED) || \
      0
 
-#  define STLSOFT_pod_vector_pt_(pt)                        ss_typename_type_ret_k pod_vector<T_value, T_allocator, V_internalSize>::pt
+#  define STLSOFT_pod_vector_pt_(pt)                        ss_typename_type_ret_k pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::pt
 # else
 
 #  define STLSOFT_pod_vector_pt_(pt)                        pt
@@ -378,7 +533,7 @@ swap(
      defined(STLSOFT_CF_FUNCTION_SIGNATURE_FULL_ARG_QUALIFICATION_REQUIRED_EXCEPT_ARGS) || \
      0
 
-#  define STLSOFT_pod_vector_rt_(qrt, rrt)                  ss_typename_type_k pod_vector<T_value, T_allocator, V_internalSize>::qrt
+#  define STLSOFT_pod_vector_rt_(qrt, rrt)                  ss_typename_type_k pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::qrt
 # else
 
 #  define STLSOFT_pod_vector_rt_(qrt, rrt)                  rrt
@@ -389,10 +544,11 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
-ss_typename_type_ret_k pod_vector<T_value, T_allocator, V_internalSize>::pointer
-pod_vector<T_value, T_allocator, V_internalSize>::begin_()
+ss_typename_type_ret_k pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::pointer
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::begin_()
 {
     return m_buffer.data();
 }
@@ -401,10 +557,11 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
-ss_typename_type_ret_k pod_vector<T_value, T_allocator, V_internalSize>::const_pointer
-pod_vector<T_value, T_allocator, V_internalSize>::begin_() const
+ss_typename_type_ret_k pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::const_pointer
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::begin_() const
 {
     return m_buffer.data();
 }
@@ -413,10 +570,11 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
 void
-pod_vector<T_value, T_allocator, V_internalSize>::range_check_(
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::range_check_(
     STLSOFT_pod_vector_pt_(size_type) index
 ) const /* stlsoft_throw_1(STLSOFT_NS_QUAL_STD(out_of_range) ) */
 {
@@ -436,23 +594,25 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
 ss_bool_t
-pod_vector<T_value, T_allocator, V_internalSize>::resize_(
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::resize_(
     STLSOFT_pod_vector_pt_(size_type) cItems
 ) /* stlsoft_throw_1(STLSOFT_NS_QUAL_STD(bad_alloc) ) */
 {
-    // This method is only called for insertions, so we can make some assumptions.
+    // This method is called for insertions and for resize(), and never
+    // reduces the capacity.
 
     size_type   curr_capacity   =   capacity();
 
     // We only resize the internal buffer if it is not large enough
     if (cItems > curr_capacity)
     {
-        size_type   capacity = m_buffer.internal_size() + cItems;
+        size_type const capacity = growth_policy_type::new_capacity(curr_capacity, cItems, m_buffer.internal_size());
 
-        capacity -= capacity % m_buffer.internal_size();
+        STLSOFT_ASSERT(capacity >= cItems);
 
         if (!m_buffer.resize(capacity))
         {
@@ -470,10 +630,11 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
 ss_bool_t
-pod_vector<T_value, T_allocator, V_internalSize>::is_valid_() const
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::is_valid_() const
 {
     if (m_buffer.size() < m_cItems)
     {
@@ -490,10 +651,11 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
 /* ss_explicit_k */
-pod_vector<T_value, T_allocator, V_internalSize>::pod_vector(
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::pod_vector(
     STLSOFT_pod_vector_pt_(size_type) cItems /* = 0 */
 )
     : m_buffer(cItems)
@@ -510,9 +672,10 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
-pod_vector<T_value, T_allocator, V_internalSize>::pod_vector(
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::pod_vector(
     STLSOFT_pod_vector_pt_(size_type)           cItems
 ,   STLSOFT_pod_vector_pt_(value_type) const&   value
 )
@@ -530,9 +693,10 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
-pod_vector<T_value, T_allocator, V_internalSize>::pod_vector(
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::pod_vector(
     STLSOFT_pod_vector_pt_(class_type) const& rhs
 )
     : m_buffer(rhs.size())
@@ -549,9 +713,10 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
-pod_vector<T_value, T_allocator, V_internalSize>::pod_vector(
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::pod_vector(
     STLSOFT_pod_vector_pt_(const_iterator)  first
 ,   STLSOFT_pod_vector_pt_(const_iterator)  last
 )
@@ -572,10 +737,11 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
-pod_vector<T_value, T_allocator, V_internalSize>&
-pod_vector<T_value, T_allocator, V_internalSize>::operator =(
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>&
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::operator =(
     STLSOFT_pod_vector_pt_(class_type) const& rhs
 )
 {
@@ -599,10 +765,11 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
-ss_typename_type_ret_k pod_vector<T_value, T_allocator, V_internalSize>::iterator
-pod_vector<T_value, T_allocator, V_internalSize>::begin()
+ss_typename_type_ret_k pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::iterator
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::begin()
 {
     STLSOFT_ASSERT(is_valid_());
 
@@ -613,10 +780,11 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
-ss_typename_type_ret_k pod_vector<T_value, T_allocator, V_internalSize>::const_iterator
-pod_vector<T_value, T_allocator, V_internalSize>::begin() const
+ss_typename_type_ret_k pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::const_iterator
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::begin() const
 {
     STLSOFT_ASSERT(is_valid_());
 
@@ -627,10 +795,11 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
-ss_typename_type_ret_k pod_vector<T_value, T_allocator, V_internalSize>::iterator
-pod_vector<T_value, T_allocator, V_internalSize>::end()
+ss_typename_type_ret_k pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::iterator
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::end()
 {
     STLSOFT_ASSERT(is_valid_());
 
@@ -641,10 +810,11 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
-ss_typename_type_ret_k pod_vector<T_value, T_allocator, V_internalSize>::const_iterator
-pod_vector<T_value, T_allocator, V_internalSize>::end() const
+ss_typename_type_ret_k pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::const_iterator
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::end() const
 {
     STLSOFT_ASSERT(is_valid_());
 
@@ -656,10 +826,11 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
-ss_typename_type_ret_k pod_vector<T_value, T_allocator, V_internalSize>::reverse_iterator
-pod_vector<T_value, T_allocator, V_internalSize>::rbegin()
+ss_typename_type_ret_k pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::reverse_iterator
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::rbegin()
 {
     STLSOFT_ASSERT(is_valid_());
 
@@ -670,10 +841,11 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
-ss_typename_type_ret_k pod_vector<T_value, T_allocator, V_internalSize>::const_reverse_iterator
-pod_vector<T_value, T_allocator, V_internalSize>::rbegin() const
+ss_typename_type_ret_k pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::const_reverse_iterator
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::rbegin() const
 {
     STLSOFT_ASSERT(is_valid_());
 
@@ -684,10 +856,11 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
-ss_typename_type_ret_k pod_vector<T_value, T_allocator, V_internalSize>::reverse_iterator
-pod_vector<T_value, T_allocator, V_internalSize>::rend()
+ss_typename_type_ret_k pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::reverse_iterator
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::rend()
 {
     STLSOFT_ASSERT(is_valid_());
 
@@ -698,10 +871,11 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
-ss_typename_type_ret_k pod_vector<T_value, T_allocator, V_internalSize>::const_reverse_iterator
-pod_vector<T_value, T_allocator, V_internalSize>::rend() const
+ss_typename_type_ret_k pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::const_reverse_iterator
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::rend() const
 {
     STLSOFT_ASSERT(is_valid_());
 
@@ -715,10 +889,11 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
 STLSOFT_pod_vector_rt_(size_type, ss_size_t)
-pod_vector<T_value, T_allocator, V_internalSize>::size() const
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::size() const
 {
     STLSOFT_ASSERT(is_valid_());
 
@@ -729,10 +904,11 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
 STLSOFT_pod_vector_rt_(size_type, ss_size_t)
-pod_vector<T_value, T_allocator, V_internalSize>::capacity() const
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::capacity() const
 {
     STLSOFT_ASSERT(is_valid_());
 
@@ -743,10 +919,11 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
 STLSOFT_pod_vector_rt_(size_type, ss_size_t)
-pod_vector<T_value, T_allocator, V_internalSize>::max_size() const
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::max_size() const
 {
     STLSOFT_ASSERT(is_valid_());
 
@@ -757,10 +934,11 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
 ss_bool_t
-pod_vector<T_value, T_allocator, V_internalSize>::empty() const
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::empty() const
 {
     STLSOFT_ASSERT(is_valid_());
 
@@ -771,10 +949,11 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
-ss_typename_type_ret_k pod_vector<T_value, T_allocator, V_internalSize>::allocator_type
-pod_vector<T_value, T_allocator, V_internalSize>::get_allocator() const
+ss_typename_type_ret_k pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::allocator_type
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::get_allocator() const
 {
     STLSOFT_ASSERT(is_valid_());
 
@@ -786,10 +965,11 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
 STLSOFT_pod_vector_rt_(reference, T_value&)
-pod_vector<T_value, T_allocator, V_internalSize>::at(
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::at(
     STLSOFT_pod_vector_pt_(size_type) index
 )
 {
@@ -806,10 +986,11 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
 STLSOFT_pod_vector_rt_(const_reference, T_value const&)
-pod_vector<T_value, T_allocator, V_internalSize>::at(
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::at(
     STLSOFT_pod_vector_pt_(size_type) index
 ) const
 {
@@ -826,10 +1007,11 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
 STLSOFT_pod_vector_rt_(reference, T_value&)
-pod_vector<T_value, T_allocator, V_internalSize>::operator [](
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::operator [](
     STLSOFT_pod_vector_pt_(size_type) index
 )
 {
@@ -846,10 +1028,11 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
 STLSOFT_pod_vector_rt_(const_reference, T_value const&)
-pod_vector<T_value, T_allocator, V_internalSize>::operator [](
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::operator [](
     STLSOFT_pod_vector_pt_(size_type) index
 ) const
 {
@@ -864,10 +1047,11 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
 STLSOFT_pod_vector_rt_(reference, T_value&)
-pod_vector<T_value, T_allocator, V_internalSize>::front()
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::front()
 {
     STLSOFT_ASSERT(is_valid_());
 
@@ -880,10 +1064,11 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
 STLSOFT_pod_vector_rt_(const_reference, T_value const&)
-pod_vector<T_value, T_allocator, V_internalSize>::front() const
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::front() const
 {
     STLSOFT_ASSERT(is_valid_());
 
@@ -896,10 +1081,11 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
 STLSOFT_pod_vector_rt_(reference, T_value&)
-pod_vector<T_value, T_allocator, V_internalSize>::back()
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::back()
 {
     STLSOFT_ASSERT(is_valid_());
 
@@ -913,10 +1099,11 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
 STLSOFT_pod_vector_rt_(const_reference, T_value const&)
-pod_vector<T_value, T_allocator, V_internalSize>::back() const
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::back() const
 {
     STLSOFT_ASSERT(is_valid_());
 
@@ -931,10 +1118,11 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
 void
-pod_vector<T_value, T_allocator, V_internalSize>::clear()
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::clear()
 {
     STLSOFT_ASSERT(is_valid_());
 
@@ -950,11 +1138,12 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
 void
-pod_vector<T_value, T_allocator, V_internalSize>::swap(
-    pod_vector<T_value, T_allocator, V_internalSize>& rhs
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::swap(
+    pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>& rhs
 )
 {
     STLSOFT_ASSERT(is_valid_());
@@ -969,10 +1158,11 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
 void
-pod_vector<T_value, T_allocator, V_internalSize>::reserve(
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::reserve(
     STLSOFT_pod_vector_pt_(size_type) cItems
 ) /* stlsoft_throw_1(STLSOFT_NS_QUAL_STD(bad_alloc) ) */
 {
@@ -993,10 +1183,46 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
+>
+inline
+void
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::shrink_to_fit() /* stlsoft_throw_1(STLSOFT_NS_QUAL_STD(bad_alloc) ) */
+{
+    STLSOFT_ASSERT(is_valid_());
+
+    if (0 == m_cItems)
+    {
+        m_buffer.resize(0);
+    }
+    else if (m_cItems < m_buffer.size())
+    {
+        // auto_buffer does not give up any of its allocated block when
+        // contracted, so the elements are copied into a buffer of the
+        // exact size, which is then exchanged
+
+        buffer_type_ buffer(m_cItems);
+
+        if (buffer.size() == m_cItems)
+        {
+            pod_copy_n(buffer.data(), begin_(), m_cItems);
+
+            m_buffer.swap(buffer);
+        }
+    }
+
+    STLSOFT_ASSERT(is_valid_());
+}
+
+template <
+    ss_typename_param_k T_value
+,   ss_typename_param_k T_allocator
+,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
 void
-pod_vector<T_value, T_allocator, V_internalSize>::resize(
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::resize(
     STLSOFT_pod_vector_pt_(size_type) cItems
 ) /* stlsoft_throw_1(STLSOFT_NS_QUAL_STD(bad_alloc) ) */
 {
@@ -1011,24 +1237,35 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
 void
-pod_vector<T_value, T_allocator, V_internalSize>::resize(
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::resize(
     STLSOFT_pod_vector_pt_(size_type)           cItems
 ,   STLSOFT_pod_vector_pt_(value_type) const&   value
 ) /* stlsoft_throw_1(STLSOFT_NS_QUAL_STD(bad_alloc) ) */
 {
     STLSOFT_ASSERT(is_valid_());
 
-    if (m_buffer.resize(cItems))
+    if (0 == cItems)
+    {
+        clear();
+    }
+    else
     {
-        if (m_cItems < cItems)
+        // Growth is subject to the growth policy, and contraction leaves
+        // the capacity unchanged
+
+        size_type const prev_size = m_cItems;
+
+        if (resize_(cItems))
         {
-            pod_fill_n(begin_() + m_cItems, cItems - m_cItems, value);
+            if (prev_size < cItems)
+            {
+                pod_fill_n(begin_() + prev_size, cItems - prev_size, value);
+            }
         }
-
-        m_cItems = cItems;
     }
 
     STLSOFT_ASSERT(is_valid_());
@@ -1038,16 +1275,24 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
 void
-pod_vector<T_value, T_allocator, V_internalSize>::push_back(
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::push_back(
     STLSOFT_pod_vector_pt_(value_type) const& value
 )
 {
     STLSOFT_ASSERT(is_valid_());
 
-    insert(end(), value);
+    if (m_cItems < m_buffer.size())
+    {
+        begin_()[m_cItems++] = value;
+    }
+    else
+    {
+        insert(end(), value);
+    }
 
     STLSOFT_ASSERT(is_valid_());
 }
@@ -1056,10 +1301,11 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
 void
-pod_vector<T_value, T_allocator, V_internalSize>::pop_back()
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::pop_back()
 {
     STLSOFT_ASSERT(is_valid_());
 
@@ -1077,10 +1323,11 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
 void
-pod_vector<T_value, T_allocator, V_internalSize>::assign(
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::assign(
     STLSOFT_pod_vector_pt_(const_iterator)  first
 ,   STLSOFT_pod_vector_pt_(const_iterator)  last
 )
@@ -1100,10 +1347,11 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
 void
-pod_vector<T_value, T_allocator, V_internalSize>::assign(
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::assign(
     STLSOFT_pod_vector_pt_(size_type)           cItems
 ,   STLSOFT_pod_vector_pt_(value_type) const&   value /* = value_type() */
 )
@@ -1123,10 +1371,11 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
-ss_typename_type_ret_k pod_vector<T_value, T_allocator, V_internalSize>::iterator
-pod_vector<T_value, T_allocator, V_internalSize>::insert(
+ss_typename_type_ret_k pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::iterator
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::insert(
     STLSOFT_pod_vector_pt_(iterator)            it
 ,   STLSOFT_pod_vector_pt_(value_type) const&   value /* = value_type() */
 )
@@ -1149,10 +1398,11 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
 void
-pod_vector<T_value, T_allocator, V_internalSize>::insert(
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::insert(
     STLSOFT_pod_vector_pt_(iterator)            it
 ,   STLSOFT_pod_vector_pt_(size_type)           cItems
 ,   STLSOFT_pod_vector_pt_(value_type) const&   value
@@ -1187,10 +1437,11 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
 void
-pod_vector<T_value, T_allocator, V_internalSize>::insert(
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::insert(
     STLSOFT_pod_vector_pt_(iterator)        it
 ,   STLSOFT_pod_vector_pt_(const_iterator)  first
 ,   STLSOFT_pod_vector_pt_(const_iterator)  last
@@ -1226,10 +1477,11 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
-ss_typename_type_ret_k pod_vector<T_value, T_allocator, V_internalSize>::iterator
-pod_vector<T_value, T_allocator, V_internalSize>::erase(
+ss_typename_type_ret_k pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::iterator
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::erase(
     STLSOFT_pod_vector_pt_(iterator) it
 )
 {
@@ -1259,10 +1511,11 @@ template <
     ss_typename_param_k T_value
 ,   ss_typename_param_k T_allocator
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_growthPolicy
 >
 inline
-ss_typename_type_ret_k pod_vector<T_value, T_allocator, V_internalSize>::iterator
-pod_vector<T_value, T_allocator, V_internalSize>::erase(
+ss_typename_type_ret_k pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::iterator
+pod_vector<T_value, T_allocator, V_internalSize, T_growthPolicy>::erase(
     STLSOFT_pod_vector_pt_(iterator)    first
 ,   STLSOFT_pod_vector_pt_(iterator)    last
 )
@@ -1311,12 +1564,13 @@ namespace std
         ss_typename_param_k         T_value
     ,   ss_typename_param_k         T_allocator
     ,   STLSOFT_NS_QUAL(ss_size_t)  V_internalSize
+    ,   ss_typename_param_k         T_growthPolicy
     >
     inline
     void
     swap(
-        STLSOFT_NS_QUAL(pod_vector)<T_value, T_allocator, V_internalSize>&  lhs
-    ,   STLSOFT_NS_QUAL(pod_vector)<T_value, T_allocator, V_internalSize>&  rhs
+        STLSOFT_NS_QUAL(pod_vector)<T_value, T_allocator, V_internalSize, T_growthPolicy>&  lhs
+    ,   STLSOFT_NS_QUAL(pod_vector)<T_value, T_allocator, V_internalSize, T_growthPolicy>&  rhs
     )
     {
         lhs.swap(rhs);
@@ -5,11 +5,11 @@
  *          character points it contains.
  *
  * Created: 5th November 2024
- * Updated: 23rd November 2024
+ * Updated: 16th October 2026
  *
  * Home:    http://stlsoft.org/
  *
- * Copyright (c) 2024, Matthew Wilson and Synesis Information Systems
+ * Copyright (c) 2024-2026, Matthew Wilson and Synesis Information Systems
  * All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
@@ -53,9 +53,9 @@
 
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 # define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_UNICODE_POINT_MAP_MAJOR     1
-# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_UNICODE_POINT_MAP_MINOR     0
-# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_UNICODE_POINT_MAP_REVISION  2
-# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_UNICODE_POINT_MAP_EDIT      2
+# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_UNICODE_POINT_MAP_MINOR     1
+# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_UNICODE_POINT_MAP_REVISION  1
+# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_UNICODE_POINT_MAP_EDIT      4
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 
@@ -79,6 +79,9 @@
 #ifndef STLSOFT_INCL_STLSOFT_UTIL_STD_HPP_ITERATOR_GENERATORS
 # include <stlsoft/util/std/iterator_generators.hpp>
 #endif /* !STLSOFT_INCL_STLSOFT_UTIL_STD_HPP_ITERATOR_GENERATORS */
+#ifndef STLSOFT_INCL_STLSOFT_UTIL_BITS_H_TEST_FUNCTIONS
+# include <stlsoft/util/bits/test_functions.h>
+#endif /* !STLSOFT_INCL_STLSOFT_UTIL_BITS_H_TEST_FUNCTIONS */
 #ifndef STLSOFT_INCL_STLSOFT_UTIL_HPP_STD_SWAP
 # include <stlsoft/util/std_swap.hpp>
 #endif /* !STLSOFT_INCL_STLSOFT_UTIL_HPP_STD_SWAP */
@@ -86,8 +89,34 @@
 #if __cplusplus >= 201103L
 # include <initializer_list>
 #endif
+#include <new>
+#include <thread>
 #include <unordered_map>
 #include <utility>
+#include <vector>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#if !defined(STLSOFT_CONTAINERS_UNICODE_POINT_MAP_NO_USE_SIMD)
+# if defined(__AVX2__)
+#  define STLSOFT_CONTAINERS_UNICODE_POINT_MAP_USE_AVX2_
+# endif
+# if defined(__SSE2__) || \
+     defined(_M_X64) || \
+     (   defined(_M_IX86_FP) && \
+         _M_IX86_FP >= 2)
+#  define STLSOFT_CONTAINERS_UNICODE_POINT_MAP_USE_SSE2_
+# endif
+#endif /* !STLSOFT_CONTAINERS_UNICODE_POINT_MAP_NO_USE_SIMD */
+
+#if defined(STLSOFT_CONTAINERS_UNICODE_POINT_MAP_USE_AVX2_)
+# include <immintrin.h>
+#elif defined(STLSOFT_CONTAINERS_UNICODE_POINT_MAP_USE_SSE2_)
+# include <emmintrin.h>
+#endif
 
 
 /* /////////////////////////////////////////////////////////////////////////
@@ -100,6 +129,99 @@ namespace stlsoft
 #endif /* STLSOFT_NO_NAMESPACE */
 
 
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions
+ */
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+namespace ximpl_unicode_point_map {
+
+    /* Decodes the (non-ASCII) UTF-8 sequence starting at p, returning its
+     * length (2-4), or 0 if it is ill-formed (including overlong forms,
+     * surrogates, and values above U+10FFFF) or incomplete, as per Table
+     * 3-7 of the Unicode Standard
+     */
+    inline
+    ss_size_t
+    decode_utf8_sequence(
+        ss_uint8_t const*   p
+    ,   ss_uint8_t const*   end
+    ,   ss_uint32_t*        pt
+    ) STLSOFT_NOEXCEPT
+    {
+        ss_uint32_t const   b0  =   p[0];
+        ss_size_t const     n   =   static_cast<ss_size_t>(end - p);
+
+        STLSOFT_ASSERT(b0 >= 0x80);
+
+        if (b0 < 0xC2)
+        {
+            // continuation byte, or lead of an overlong 2-byte form
+
+            return 0;
+        }
+        else if (b0 < 0xE0)
+        {
+            if (n < 2 ||
+                0x80 != (p[1] & 0xC0))
+            {
+                return 0;
+            }
+
+            *pt = ((b0 & 0x1F) << 6) | (p[1] & 0x3Fu);
+
+            return 2;
+        }
+        else if (b0 < 0xF0)
+        {
+            // the range of the second byte excludes overlong forms (after
+            // E0) and surrogates (after ED)
+            ss_uint32_t const lo = (0xE0 == b0) ? 0xA0 : 0x80;
+            ss_uint32_t const hi = (0xED == b0) ? 0x9F : 0xBF;
+
+            if (n < 3 ||
+                p[1] < lo ||
+                p[1] > hi ||
+                0x80 != (p[2] & 0xC0))
+            {
+                return 0;
+            }
+
+            *pt = ((b0 & 0x0F) << 12) | ((p[1] & 0x3Fu) << 6) | (p[2] & 0x3Fu);
+
+            return 3;
+        }
+        else if (b0 < 0xF5)
+        {
+            // the range of the second byte excludes overlong forms (after
+            // F0) and values above U+10FFFF (after F4)
+            ss_uint32_t const lo = (0xF0 == b0) ? 0x90 : 0x80;
+            ss_uint32_t const hi = (0xF4 == b0) ? 0x8F : 0xBF;
+
+            if (n < 4 ||
+                p[1] < lo ||
+                p[1] > hi ||
+                0x80 != (p[2] & 0xC0) ||
+                0x80 != (p[3] & 0xC0))
+            {
+                return 0;
+            }
+
+            *pt = ((b0 & 0x07) << 18) | ((p[1] & 0x3Fu) << 12) | ((p[2] & 0x3Fu) << 6) | (p[3] & 0x3Fu);
+
+            return 4;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+} /* namespace ximpl_unicode_point_map */
+
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+
 /* /////////////////////////////////////////////////////////////////////////
  * classes
  */
@@ -228,6 +350,14 @@ public:
     };
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
+public: // constants
+    enum
+    {
+        /// The minimum number of characters that will be given to each
+        /// thread when decoding in parallel
+        min_chars_per_thread    =   1024 * 1024
+    };
+
 
 public: // construction
     /// Constructs an empty instance
@@ -253,14 +383,13 @@ public: // operations
     void
     clear() STLSOFT_NOEXCEPT;
 
-#if 0 // TODO: implement these methods in next version
-
+    /// Adds the counts of all points in \c rhs to this instance
     class_type&
     merge(class_type const& rhs);
 
+    /// Adds the counts of all points in \c rhs to this instance
     class_type&
     operator +=(class_type const& rhs);
-#endif
 
     void
     push(key_type key);
@@ -271,6 +400,46 @@ public: // operations
     ,   count_type  count
     );
 
+    /// Decodes the given UTF-8 string, and pushes each of its points
+    ///
+    /// \param s The string. May be \c nullptr iff \c cch is 0
+    /// \param cch The number of bytes in the string
+    ///
+    /// \return The number of bytes decoded. If this is less than \c cch,
+    ///   the byte at that position begins an ill-formed or incomplete
+    ///   sequence, and neither it nor any following byte is pushed
+    ///
+    /// \note Runs of ASCII characters are counted 16 (or, with AVX2, 32)
+    ///   at a time, and all counts for ASCII characters are added to the
+    ///   instance once, when decoding is complete
+    size_type
+    push_utf8(
+        char_type const*    s
+    ,   size_type           cch
+    );
+
+    /// Decodes the given UTF-8 string with at most \c numThreads
+    /// threads, and pushes each of its points
+    ///
+    /// \param s The string. May be \c nullptr iff \c cch is 0
+    /// \param cch The number of bytes in the string
+    /// \param numThreads The maximum number of threads (including the
+    ///   calling thread) with which to decode. If 0, the value of
+    ///   <code>std::thread::hardware_concurrency()</code> is used
+    ///
+    /// \return The same as push_utf8(s, cch)
+    ///
+    /// The string is divided at character boundaries into chunks of at
+    /// least \c min_chars_per_thread bytes, each of which is decoded into
+    /// a separate instance, which are then merged into this one. This
+    /// suits large buffers, such as the contents of a memory-mapped file
+    size_type
+    push_utf8(
+        char_type const*    s
+    ,   size_type           cch
+    ,   size_type           numThreads
+    );
+
     void
     swap(class_type& rhs) STLSOFT_NOEXCEPT;
 
@@ -315,6 +484,8 @@ public: // iteration
 
 
 private: // implementation
+    void
+    push_point_(unicode_point_type pt);
 
 
 private: // fields
@@ -455,9 +626,9 @@ unicode_point_map::const_iterator::operator ++()
 
     if (m_vec_iter != m_collection->m_vec.end())
     {
-        while (m_vec_iter != m_collection->m_vec.end())
+        for (++m_vec_iter; m_vec_iter != m_collection->m_vec.end(); ++m_vec_iter)
         {
-            if (0 != *++m_vec_iter)
+            if (0 != *m_vec_iter)
             {
                 break;
             }
@@ -576,14 +747,38 @@ unicode_point_map::clear() STLSOFT_NOEXCEPT
     m_map.clear();
 }
 
-#if 0
+inline
+unicode_point_map::class_type&
+unicode_point_map::merge(class_type const& rhs)
+{
+    // (when merging with itself, each count is read once, before it is
+    // doubled, and no element is added or - since doubling a non-0 count
+    // cannot yield 0 - removed, so no iterator is invalidated)
 
-class_type&
-merge(class_type const& rhs);
+    { for (size_type i = 0, n = rhs.m_vec.size(); i != n; ++i)
+    {
+        count_type const count = rhs.m_vec[i];
 
-class_type&
-operator +=(class_type const& rhs);
-#endif
+        if (0 != count)
+        {
+            push_n(static_cast<unicode_point_type>(i), count);
+        }
+    }}
+
+    { for (map_type_::const_iterator i = rhs.m_map.begin(); rhs.m_map.end() != i; ++i)
+    {
+        push_n((*i).first, (*i).second);
+    }}
+
+    return *this;
+}
+
+inline
+unicode_point_map::class_type&
+unicode_point_map::operator +=(class_type const& rhs)
+{
+    return merge(rhs);
+}
 
 inline
 void
@@ -660,6 +855,264 @@ unicode_point_map::push_n(
     }
 }
 
+inline
+unicode_point_map::size_type
+unicode_point_map::push_utf8(
+    char_type const*    s
+,   size_type           cch
+)
+{
+    namespace ximpl = ximpl_unicode_point_map;
+
+    STLSOFT_ASSERT(NULL != s || 0 == cch);
+
+    if (0 == cch)
+    {
+        return 0;
+    }
+
+    // ASCII characters are tallied in 4 interleaved histograms, so that
+    // runs of the same character do not serialise on a single counter
+
+    count_type              ascii[4][128] = {};
+    ss_uint8_t const* const begin   =   reinterpret_cast<ss_uint8_t const*>(s);
+    ss_uint8_t const* const end     =   begin + cch;
+    ss_uint8_t const*       p       =   begin;
+
+    for (; end != p; )
+    {
+#if defined(STLSOFT_CONTAINERS_UNICODE_POINT_MAP_USE_AVX2_)
+
+        for (; end - p >= 32; p += 32)
+        {
+            ss_uint32_t const mask = static_cast<ss_uint32_t>(_mm256_movemask_epi8(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(p))));
+
+            if (0 != mask)
+            {
+                size_type const n = stlsoft_C_count_trailing_zero_bits_in_32bit_unsigned_integer(mask);
+
+                { for (size_type i = 0; i != n; ++i)
+                {
+                    ++ascii[i % 4][p[i]];
+                }}
+
+                p += n;
+
+                break;
+            }
+
+            { for (size_type i = 0; i != 32; i += 4)
+            {
+                ++ascii[0][p[i + 0]];
+                ++ascii[1][p[i + 1]];
+                ++ascii[2][p[i + 2]];
+                ++ascii[3][p[i + 3]];
+            }}
+        }
+#endif /* STLSOFT_CONTAINERS_UNICODE_POINT_MAP_USE_AVX2_ */
+
+#if defined(STLSOFT_CONTAINERS_UNICODE_POINT_MAP_USE_SSE2_)
+
+        for (; end - p >= 16; p += 16)
+        {
+            ss_uint32_t const mask = static_cast<ss_uint32_t>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(p))));
+
+            if (0 != mask)
+            {
+                size_type const n = stlsoft_C_count_trailing_zero_bits_in_32bit_unsigned_integer(mask);
+
+                { for (size_type i = 0; i != n; ++i)
+                {
+                    ++ascii[i % 4][p[i]];
+                }}
+
+                p += n;
+
+                break;
+            }
+
+            { for (size_type i = 0; i != 16; i += 4)
+            {
+                ++ascii[0][p[i + 0]];
+                ++ascii[1][p[i + 1]];
+                ++ascii[2][p[i + 2]];
+                ++ascii[3][p[i + 3]];
+            }}
+        }
+
+        if (end == p)
+        {
+            break;
+        }
+#endif /* STLSOFT_CONTAINERS_UNICODE_POINT_MAP_USE_SSE2_ */
+
+        if (*p < 0x80)
+        {
+            ++ascii[0][*p++];
+        }
+        else
+        {
+            unicode_point_type  pt;
+            size_type const     n = ximpl::decode_utf8_sequence(p, end, &pt);
+
+            if (0 == n)
+            {
+                break;
+            }
+
+            push_point_(pt);
+
+            p += n;
+        }
+    }
+
+    { for (unicode_point_type c = 0; 128 != c; ++c)
+    {
+        count_type const count = ascii[0][c] + ascii[1][c] + ascii[2][c] + ascii[3][c];
+
+        if (0 != count)
+        {
+            push_n(c, count);
+        }
+    }}
+
+    return static_cast<size_type>(p - begin);
+}
+
+inline
+unicode_point_map::size_type
+unicode_point_map::push_utf8(
+    char_type const*    s
+,   size_type           cch
+,   size_type           numThreads
+)
+{
+    STLSOFT_ASSERT(NULL != s || 0 == cch);
+
+    if (0 == numThreads)
+    {
+        numThreads = std::thread::hardware_concurrency();
+    }
+
+    size_type numChunks = cch / min_chars_per_thread;
+
+    if (numChunks > numThreads)
+    {
+        numChunks = numThreads;
+    }
+
+    if (numChunks < 2)
+    {
+        return push_utf8(s, cch);
+    }
+
+    // Each chunk boundary is moved forward past (at most 3) continuation
+    // bytes, so that - for well-formed input - no sequence is divided.
+    // Should any chunk but the last not be decoded completely, then the
+    // input is decoded serially from that chunk's start, so that the
+    // result is exactly that of push_utf8(s, cch)
+
+    size_type const                 chunkSize   =   cch / numChunks;
+    std::vector<size_type>          bounds(numChunks + 1);
+    std::vector<class_type>         maps;
+    std::vector<size_type>          chunkDecoded(numChunks, 0);
+    std::vector<char>               chunkFailed(numChunks, 0);
+    std::vector<std::thread>        threads;
+
+    bounds[0] = 0;
+    bounds[numChunks] = cch;
+
+    for (size_type i = 1; i != numChunks; ++i)
+    {
+        size_type b = i * chunkSize;
+
+        for (size_type j = 0; j != 3 && 0x80 == (static_cast<ss_uint8_t>(s[b]) & 0xC0); ++j)
+        {
+            ++b;
+        }
+
+        bounds[i] = b;
+    }
+
+    maps.reserve(numChunks);
+
+    for (size_type i = 0; i != numChunks; ++i)
+    {
+        maps.emplace_back(static_cast<unicode_point_type>(m_vec.size()));
+    }
+
+    threads.reserve(numChunks - 1);
+
+    auto const decode = [&](size_type i) {
+
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+        try
+        {
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+            chunkDecoded[i] = maps[i].push_utf8(s + bounds[i], bounds[i + 1] - bounds[i]);
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+        }
+        catch (std::bad_alloc&)
+        {
+            chunkFailed[i] = 1;
+        }
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+    };
+
+    for (size_type i = 1; i != numChunks; ++i)
+    {
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+        try
+        {
+            threads.emplace_back(decode, i);
+        }
+        catch (std::exception&)
+        {
+            // could not start a thread, so do it on this one
+
+            decode(i);
+        }
+#else /* ? STLSOFT_CF_EXCEPTION_SUPPORT */
+        threads.emplace_back(decode, i);
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+    }
+
+    decode(0);
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (size_type i = 0; i != numChunks; ++i)
+    {
+        if (0 != chunkFailed[i])
+        {
+            STLSOFT_THROW_X(std::bad_alloc());
+        }
+    }
+
+    for (size_type i = 0; i != numChunks; ++i)
+    {
+        size_type const len = bounds[i + 1] - bounds[i];
+
+        if (chunkDecoded[i] != len &&
+            i + 1 != numChunks)
+        {
+            return bounds[i] + push_utf8(s + bounds[i], cch - bounds[i]);
+        }
+
+        merge(maps[i]);
+
+        if (chunkDecoded[i] != len)
+        {
+            return bounds[i] + chunkDecoded[i];
+        }
+    }
+
+    return cch;
+}
+
 inline
 void
 unicode_point_map::swap(class_type& rhs) STLSOFT_NOEXCEPT
@@ -784,6 +1237,33 @@ unicode_point_map::cend() const
 {
     return const_iterator();
 }
+
+// implementation
+
+inline
+void
+unicode_point_map::push_point_(unicode_point_type pt)
+{
+    if (pt < m_vec.size())
+    {
+        count_type const prev = m_vec[pt]++;
+
+        if (0 == prev)
+        {
+            ++m_len;
+        }
+        else if (-1 == prev)
+        {
+            --m_len;
+        }
+
+        ++m_total;
+    }
+    else
+    {
+        push_n(pt, 1);
+    }
+}
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 
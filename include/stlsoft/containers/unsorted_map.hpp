@@ -4,11 +4,11 @@
  * Purpose:     An associative container that maintains the order of element insertion.
  *
  * Created:     12th February 2006
- * Updated:     11th March 2024
+ * Updated:     16th October 2026
  *
  * Home:        http://stlsoft.org/
  *
- * Copyright (c) 2019-2024, Matthew Wilson and Synesis Information Systems
+ * Copyright (c) 2019-2026, Matthew Wilson and Synesis Information Systems
  * Copyright (c) 2006-2019, Matthew Wilson and Synesis Software
  * All rights reserved.
  *
@@ -53,9 +53,9 @@
 
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 # define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_UNSORTED_MAP_MAJOR      1
-# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_UNSORTED_MAP_MINOR      3
-# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_UNSORTED_MAP_REVISION   7
-# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_UNSORTED_MAP_EDIT       35
+# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_UNSORTED_MAP_MINOR      4
+# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_UNSORTED_MAP_REVISION   1
+# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_UNSORTED_MAP_EDIT       37
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 
@@ -70,6 +70,24 @@ STLSOFT_COMPILER_IS_BORLAND:
  */
 
 
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#if __cplusplus >= 201103L && \
+    !defined(STLSOFT_UNSORTED_MAP_NO_HASH_INDEX)
+# define STLSOFT_UNSORTED_MAP_USE_HASH_INDEX_
+#endif
+
+/** The number of elements at which an unsorted_map builds its hash index.
+ * Below this, lookup is by linear search, which is faster for small maps
+ * and needs no extra memory
+ */
+#ifndef STLSOFT_UNSORTED_MAP_HASH_INDEX_THRESHOLD
+# define STLSOFT_UNSORTED_MAP_HASH_INDEX_THRESHOLD          (16)
+#endif /* !STLSOFT_UNSORTED_MAP_HASH_INDEX_THRESHOLD */
+
+
 /* /////////////////////////////////////////////////////////////////////////
  * includes
  */
@@ -93,6 +111,11 @@ STLSOFT_COMPILER_IS_BORLAND:
 #ifndef STLSOFT_INCL_STLSOFT_CONVERSION_HPP_SAP_CAST
 # include <stlsoft/conversion/sap_cast.hpp>
 #endif /* !STLSOFT_INCL_STLSOFT_CONVERSION_HPP_SAP_CAST */
+#ifdef STLSOFT_UNSORTED_MAP_USE_HASH_INDEX_
+# ifndef STLSOFT_INCL_STLSOFT_LIMITS_H_INTEGRAL_LIMITS
+#  include <stlsoft/limits/integral_limits.h>
+# endif /* !STLSOFT_INCL_STLSOFT_LIMITS_H_INTEGRAL_LIMITS */
+#endif /* STLSOFT_UNSORTED_MAP_USE_HASH_INDEX_ */
 #ifndef STLSOFT_INCL_STLSOFT_ITERATORS_HPP_MEMBER_SELECTOR_ITERATOR
 # include <stlsoft/iterators/member_selector_iterator.hpp>
 #endif /* !STLSOFT_INCL_STLSOFT_ITERATORS_HPP_MEMBER_SELECTOR_ITERATOR */
@@ -105,6 +128,19 @@ STLSOFT_COMPILER_IS_BORLAND:
 # define STLSOFT_INCL_FUNCTIONAL
 # include <functional>
 #endif /* !STLSOFT_INCL_FUNCTIONAL */
+#ifdef STLSOFT_UNSORTED_MAP_USE_HASH_INDEX_
+# ifndef STLSOFT_INCL_TYPE_TRAITS
+#  define STLSOFT_INCL_TYPE_TRAITS
+#  include <type_traits>
+# endif /* !STLSOFT_INCL_TYPE_TRAITS */
+#endif /* STLSOFT_UNSORTED_MAP_USE_HASH_INDEX_ */
+#if defined(STLSOFT_LF_ALLOCATOR_TRAITS_SUPPORT) || \
+    defined(STLSOFT_UNSORTED_MAP_USE_HASH_INDEX_)
+# ifndef STLSOFT_INCL_MEMORY
+#  define STLSOFT_INCL_MEMORY
+#  include <memory>
+# endif /* !STLSOFT_INCL_MEMORY */
+#endif /* STLSOFT_LF_ALLOCATOR_TRAITS_SUPPORT || STLSOFT_UNSORTED_MAP_USE_HASH_INDEX_ */
 #ifndef STLSOFT_INCL_UTILITY
 # define STLSOFT_INCL_UTILITY
 # include <utility>
@@ -125,6 +161,91 @@ namespace stlsoft
 #endif /* STLSOFT_NO_NAMESPACE */
 
 
+/* /////////////////////////////////////////////////////////////////////////
+ * implementation
+ */
+
+#if defined(STLSOFT_UNSORTED_MAP_USE_HASH_INDEX_) && \
+    !defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+
+namespace ximpl_unsorted_map {
+
+    /* Mixes the (possibly identity) hash, so that the low bits, from which
+     * the probe start is taken, are well distributed
+     */
+    inline
+    ss_size_t
+    mix_hash(
+        ss_size_t h
+    ) STLSOFT_NOEXCEPT
+    {
+        ss_uint64_t const m = static_cast<ss_uint64_t>(h) * STLSOFT_GEN_UINT64_SUFFIX(0x9e3779b97f4a7c15);
+
+        return static_cast<ss_size_t>(m ^ (m >> 32));
+    }
+
+    /* Determines whether H can be default-constructed and applied to a
+     * K, which is not so for std::hash<K> when K has no specialisation
+     */
+    template<   ss_typename_param_k H
+            ,   ss_typename_param_k K
+            >
+    struct is_usable_hash
+    {
+    private:
+        template <ss_typename_param_k H2>
+        static auto test_(int) -> decltype(static_cast<ss_size_t>(STLSOFT_NS_QUAL_STD(declval)<H2 const&>()(STLSOFT_NS_QUAL_STD(declval)<K const&>())), STLSOFT_NS_QUAL_STD(true_type)());
+        template <ss_typename_param_k H2>
+        static STLSOFT_NS_QUAL_STD(false_type) test_(...);
+
+    public:
+        static bool const value =   STLSOFT_NS_QUAL_STD(is_default_constructible)<H>::value &&
+                                    decltype(test_<H>(0))::value;
+    };
+
+    /* Holds the hash function, if it is usable; otherwise holds nothing,
+     * and the map does not build its index
+     */
+    template<   ss_typename_param_k H
+            ,   ss_typename_param_k K
+            ,   bool                B = is_usable_hash<H, K>::value
+            >
+    class hash_holder
+    {
+    public:
+        static bool const enabled = true;
+
+    public:
+        ss_size_t operator ()(K const& key) const
+        {
+            return m_hash(key);
+        }
+
+    private:
+        H   m_hash;
+    };
+
+    template<   ss_typename_param_k H
+            ,   ss_typename_param_k K
+            >
+    class hash_holder<H, K, false>
+    {
+    public:
+        static bool const enabled = false;
+
+    public:
+        ss_size_t operator ()(K const&) const
+        {
+            STLSOFT_MESSAGE_ASSERT("the index is not built without a usable hash function", false);
+
+            return 0;
+        }
+    };
+} /* namespace ximpl_unsorted_map */
+
+#endif /* STLSOFT_UNSORTED_MAP_USE_HASH_INDEX_ && !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+
 /* /////////////////////////////////////////////////////////////////////////
  * classes
  */
@@ -138,6 +259,19 @@ namespace stlsoft
  * \param T The container mapped type
  * \param P The comparison predicate type
  * \param A The allocator type
+ * \param H The hash function type (C++11 and later)
+ *
+ * Elements are held, in insertion order, in a single contiguous array.
+ * Lookup of keys - by find(), count(), push_back(), and erase() - is by
+ * linear search while the map is small. Once it holds
+ * \c STLSOFT_UNSORTED_MAP_HASH_INDEX_THRESHOLD elements, an open-addressing
+ * index of element positions is built (and thereafter maintained), so that
+ * lookup becomes O(1) on average, without disturbing the element order
+ * or layout. The index is built only if \c H can be default-constructed
+ * and applied to a key, so keys for which \c std::hash is not specialised
+ * are still supported, by linear search. (Define
+ * \c STLSOFT_UNSORTED_MAP_NO_HASH_INDEX to suppress the index, in which
+ * case \c H is not a parameter.)
  *
 \code
   stlsoft::unsorted_map
@@ -147,6 +281,9 @@ template<   ss_typename_param_k K
         ,   ss_typename_param_k T
         ,   ss_typename_param_k P   =   STLSOFT_NS_QUAL_STD(less)<K>
         ,   ss_typename_param_k A   =   ss_typename_type_def_k allocator_selector<T>::allocator_type
+#ifdef STLSOFT_UNSORTED_MAP_USE_HASH_INDEX_
+        ,   ss_typename_param_k H   =   STLSOFT_NS_QUAL_STD(hash)<K>
+#endif /* STLSOFT_UNSORTED_MAP_USE_HASH_INDEX_ */
         >
 class unsorted_map
     : public stl_collection_tag
@@ -162,15 +299,43 @@ public:
     typedef STLSOFT_NS_QUAL_STD(pair)<const K, T>                           value_type;
     /// The allocator type
     typedef A                                                               allocator_type;
+#ifdef STLSOFT_UNSORTED_MAP_USE_HASH_INDEX_
+    /// The hash function type
+    typedef H                                                               hasher;
+    /// This type
+    typedef unsorted_map<K, T, P, A, H>                                     class_type;
+#else /* ? STLSOFT_UNSORTED_MAP_USE_HASH_INDEX_ */
     /// This type
     typedef unsorted_map<K, T, P, A>                                        class_type;
+#endif /* STLSOFT_UNSORTED_MAP_USE_HASH_INDEX_ */
 private:
     typedef STLSOFT_NS_QUAL_STD(pair)<K, T>                                 internal_value_type_;
+#if defined(STLSOFT_LF_ALLOCATOR_TRAITS_SUPPORT)
+    typedef ss_typename_type_k STLSOFT_NS_QUAL_STD(allocator_traits)<A>::ss_template_qual_k rebind_alloc<internal_value_type_>
+                                                                            internal_allocator_type_;
+#elif defined(STLSOFT_LF_ALLOCATOR_REBIND_SUPPORT)
+    typedef ss_typename_type_k A::ss_template_qual_k rebind<internal_value_type_>::other
+                                                                            internal_allocator_type_;
+#else /* ? STLSOFT_LF_ALLOCATOR_TRAITS_SUPPORT */
+    typedef ss_typename_type_k allocator_selector<internal_value_type_>::allocator_type
+                                                                            internal_allocator_type_;
+#endif /* STLSOFT_LF_ALLOCATOR_TRAITS_SUPPORT */
     typedef STLSOFT_NS_QUAL_STD(vector)<internal_value_type_
-                                    ,   ss_typename_type_k allocator_selector<internal_value_type_>::allocator_type
+                                    ,   internal_allocator_type_
                                     >                                       container_type_;
 public:
     typedef ss_typename_type_k container_type_::size_type                   size_type;
+private:
+#ifdef STLSOFT_UNSORTED_MAP_USE_HASH_INDEX_
+    // Each slot holds 1 + the position of an element, or 0 if empty
+    typedef ss_typename_type_k STLSOFT_NS_QUAL_STD(allocator_traits)<A>::ss_template_qual_k rebind_alloc<size_type>
+                                                                            index_allocator_type_;
+    typedef STLSOFT_NS_QUAL_STD(vector)<size_type
+                                    ,   index_allocator_type_
+                                    >                                       index_type_;
+    typedef ximpl_unsorted_map::hash_holder<H, K>                           hash_holder_type_;
+#endif /* STLSOFT_UNSORTED_MAP_USE_HASH_INDEX_ */
+public:
     typedef ss_typename_type_k container_type_::difference_type             difference_type;
     typedef ss_bool_t                                                       bool_type;
     typedef value_type*                                                     pointer;
@@ -251,19 +416,19 @@ public:
 public:
     iterator    begin()
     {
-        return sap_cast<value_type*>(&*m_elements.begin());
+        return sap_cast<value_type*>(data_());
     }
     iterator    end()
     {
-        return sap_cast<value_type*>(&*m_elements.end());
+        return sap_cast<value_type*>(data_() + m_elements.size());
     }
     const_iterator  begin() const
     {
-        return sap_cast<value_type const*>(&*m_elements.begin());
+        return sap_cast<value_type const*>(data_());
     }
     const_iterator  end() const
     {
-        return sap_cast<value_type const*>(&*m_elements.end());
+        return sap_cast<value_type const*>(data_() + m_elements.size());
     }
 #if defined(STLSOFT_LF_BIDIRECTIONAL_ITERATOR_SUPPORT)
     reverse_iterator    rbegin()
@@ -285,17 +450,44 @@ public:
 #endif /* STLSOFT_LF_BIDIRECTIONAL_ITERATOR_SUPPORT */
 
 public:
-    size_type erase(key_type const& key)
+    /// Returns an iterator to the element with the given key, or end() if
+    /// there is none
+    iterator find(key_type const& key)
     {
-        ss_typename_type_k container_type_::iterator    it;
+        size_type const pos = find_position_(key);
 
-        it = STLSOFT_NS_QUAL_STD(find)( member_selector(m_elements.begin(), &internal_value_type_::first)
-                                    ,   member_selector(m_elements.end(), &internal_value_type_::first)
-                                    ,   key).base();
+        return (npos_() == pos) ? end() : begin() + difference_type(pos);
+    }
+    /// Returns an iterator to the element with the given key, or end() if
+    /// there is none
+    const_iterator find(key_type const& key) const
+    {
+        size_type const pos = find_position_(key);
+
+        return (npos_() == pos) ? end() : begin() + difference_type(pos);
+    }
+
+    /// The number (0 or 1) of elements with the given key
+    size_type count(key_type const& key) const
+    {
+        return (npos_() == find_position_(key)) ? 0u : 1u;
+    }
 
-        if (m_elements.end() != it)
+public:
+    size_type erase(key_type const& key)
+    {
+        size_type const pos = find_position_(key);
+
+        if (npos_() != pos)
         {
-            m_elements.erase(it);
+            m_elements.erase(m_elements.begin() + difference_type(pos));
+
+#ifdef STLSOFT_UNSORTED_MAP_USE_HASH_INDEX_
+            if (!m_index.empty())
+            {
+                index_erase_(pos);
+            }
+#endif /* STLSOFT_UNSORTED_MAP_USE_HASH_INDEX_ */
 
             return 1;
         }
@@ -310,24 +502,186 @@ public:
     }
     void push_back(key_type const& key, mapped_type const& value)
     {
-        ss_typename_type_k container_type_::iterator    it;
+        size_type const pos = find_position_(key);
+
+        if (npos_() != pos)
+        {
+            m_elements[pos].second = value;
+
+            return;
+        }
+
+#ifdef STLSOFT_UNSORTED_MAP_USE_HASH_INDEX_
+        // The index is grown before the element is added, and the index
+        // is (re)built into a copy, so that an exception leaves the map
+        // unchanged, or - if the index could not be built - with no index
+        // and lookup by linear search
+
+        if (!m_index.empty() &&
+            max_load_(m_index.size()) < m_elements.size() + 1)
+        {
+            rehash_(2 * m_index.size());
+        }
+
+        m_elements.push_back(internal_value_type_(key, value));
+
+        if (!m_index.empty())
+        {
+            index_insert_(m_index, m_elements.size() - 1);
+        }
+        else if (hash_holder_type_::enabled &&
+                 m_elements.size() >= size_type(STLSOFT_UNSORTED_MAP_HASH_INDEX_THRESHOLD))
+        {
+            size_type capacity = 8;
+
+            for (; max_load_(capacity) < m_elements.size(); capacity *= 2)
+            {}
+
+            rehash_(capacity);
+        }
+#else /* ? STLSOFT_UNSORTED_MAP_USE_HASH_INDEX_ */
+        m_elements.push_back(internal_value_type_(key, value));
+#endif /* STLSOFT_UNSORTED_MAP_USE_HASH_INDEX_ */
+    }
+
+private:
+    // (&*end() is not valid, and nor is &*begin() for an empty vector)
+    internal_value_type_* data_()
+    {
+        return m_elements.empty() ? NULL : &m_elements[0];
+    }
+    internal_value_type_ const* data_() const
+    {
+        return m_elements.empty() ? NULL : &m_elements[0];
+    }
+
+    static size_type npos_()
+    {
+        return ~size_type(0);
+    }
+
+    size_type find_position_(key_type const& key) const
+    {
+#ifdef STLSOFT_UNSORTED_MAP_USE_HASH_INDEX_
+        if (!m_index.empty())
+        {
+            size_type const mask = m_index.size() - 1;
+
+            for (size_type i = home_slot_(key, mask); ; i = (i + 1) & mask)
+            {
+                size_type const slot = m_index[i];
+
+                if (0 == slot)
+                {
+                    return npos_();
+                }
+
+                if (m_elements[slot - 1].first == key)
+                {
+                    return slot - 1;
+                }
+            }
+        }
+#endif /* STLSOFT_UNSORTED_MAP_USE_HASH_INDEX_ */
+
+        ss_typename_type_k container_type_::const_iterator  it;
 
         it = STLSOFT_NS_QUAL_STD(find)( member_selector(m_elements.begin(), &internal_value_type_::first)
                                     ,   member_selector(m_elements.end(), &internal_value_type_::first)
                                     ,   key).base();
 
-        if (m_elements.end() == it)
+        return (m_elements.end() == it) ? npos_() : size_type(it - m_elements.begin());
+    }
+
+#ifdef STLSOFT_UNSORTED_MAP_USE_HASH_INDEX_
+    // The index is at most 3/4 full, so that linear probe sequences are
+    // short; its size is always a power of 2
+    static size_type max_load_(size_type capacity)
+    {
+        return capacity / 2 + capacity / 4;
+    }
+
+    size_type home_slot_(key_type const& key, size_type mask) const
+    {
+        return ximpl_unsorted_map::mix_hash(m_hash(key)) & mask;
+    }
+
+    // Records the element at pos, which is known not to be in the index
+    void index_insert_(index_type_& index, size_type pos) const
+    {
+        size_type const mask = index.size() - 1;
+        size_type       i    = home_slot_(m_elements[pos].first, mask);
+
+        for (; 0 != index[i]; i = (i + 1) & mask)
+        {}
+
+        index[i] = pos + 1;
+    }
+
+    // Removes the (already erased) element at pos from the index, and
+    // adjusts the recorded positions of the elements that followed it
+    void index_erase_(size_type pos)
+    {
+        size_type const mask = m_index.size() - 1;
+        size_type       hole = npos_();
+
+        { for (size_type i = 0; i != m_index.size(); ++i)
+        {
+            size_type& slot = m_index[i];
+
+            if (pos + 1 == slot)
+            {
+                hole = i;
+                slot = 0;
+            }
+            else if (pos + 1 < slot)
+            {
+                --slot;
+            }
+        }}
+
+        STLSOFT_ASSERT(npos_() != hole);
+
+        // Backward-shift deletion: move up any following entries whose
+        // probe sequences pass through the hole, so that no tombstones
+        // are needed
+
+        for (size_type i = (hole + 1) & mask; 0 != m_index[i]; i = (i + 1) & mask)
         {
-            m_elements.push_back(value_type(key, value));
+            size_type const home = home_slot_(m_elements[m_index[i] - 1].first, mask);
+
+            // the entry may move to the hole only if its home is not in the
+            // (cyclic) range (hole, i]
+            if (((i - home) & mask) >= ((i - hole) & mask))
+            {
+                m_index[hole]   =   m_index[i];
+                m_index[i]      =   0;
+                hole            =   i;
+            }
         }
-        else
+    }
+
+    void rehash_(size_type capacity)
+    {
+        STLSOFT_ASSERT(0 == (capacity & (capacity - 1)));
+
+        index_type_ index(capacity, size_type(0));
+
+        for (size_type pos = 0; pos != m_elements.size(); ++pos)
         {
-            (*it).second = value;
+            index_insert_(index, pos);
         }
+
+        m_index.swap(index);
     }
+#endif /* STLSOFT_UNSORTED_MAP_USE_HASH_INDEX_ */
 
 private:
-    container_type_ m_elements;
+    container_type_     m_elements;
+#ifdef STLSOFT_UNSORTED_MAP_USE_HASH_INDEX_
+    index_type_         m_index;
+    hash_holder_type_   m_hash;
+#endif /* STLSOFT_UNSORTED_MAP_USE_HASH_INDEX_ */
 };
 
 /* ////////////////////////////////////////////////////////////////////// */
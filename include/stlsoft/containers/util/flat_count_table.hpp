@@ -0,0 +1,848 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    stlsoft/containers/util/flat_count_table.hpp
+ *
+ * Purpose: Definition of the flat_count_table class template, an
+ *          open-addressing hash table of key+count pairs.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * Home:    http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* STLSOFT:C++98:FILE_EXCEPTED */
+/* STLSOFT:C++03:FILE_EXCEPTED */
+
+/** \file stlsoft/containers/util/flat_count_table.hpp
+ *
+ * \brief [C++] Definition of the stlsoft::flat_count_table class
+ *   template
+ *   (\ref group__library__Container "Container" Library).
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_CONTAINERS_UTIL_HPP_FLAT_COUNT_TABLE
+#define STLSOFT_INCL_STLSOFT_CONTAINERS_UTIL_HPP_FLAT_COUNT_TABLE
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define STLSOFT_VER_STLSOFT_CONTAINERS_UTIL_HPP_FLAT_COUNT_TABLE_MAJOR     1
+# define STLSOFT_VER_STLSOFT_CONTAINERS_UTIL_HPP_FLAT_COUNT_TABLE_MINOR     0
+# define STLSOFT_VER_STLSOFT_CONTAINERS_UTIL_HPP_FLAT_COUNT_TABLE_REVISION  1
+# define STLSOFT_VER_STLSOFT_CONTAINERS_UTIL_HPP_FLAT_COUNT_TABLE_EDIT      2
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_H_STLSOFT
+# include <stlsoft/stlsoft.h>
+#endif /* !STLSOFT_INCL_STLSOFT_H_STLSOFT */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+#ifndef STLSOFT_INCL_STLSOFT_LIMITS_H_INTEGRAL_LIMITS
+# include <stlsoft/limits/integral_limits.h>
+#endif /* !STLSOFT_INCL_STLSOFT_LIMITS_H_INTEGRAL_LIMITS */
+#ifndef STLSOFT_INCL_STLSOFT_UTIL_BITS_H_TEST_FUNCTIONS
+# include <stlsoft/util/bits/test_functions.h>
+#endif /* !STLSOFT_INCL_STLSOFT_UTIL_BITS_H_TEST_FUNCTIONS */
+
+#ifndef STLSOFT_INCL_FUNCTIONAL
+# define STLSOFT_INCL_FUNCTIONAL
+# include <functional>
+#endif /* !STLSOFT_INCL_FUNCTIONAL */
+#ifndef STLSOFT_INCL_ITERATOR
+# define STLSOFT_INCL_ITERATOR
+# include <iterator>
+#endif /* !STLSOFT_INCL_ITERATOR */
+#ifndef STLSOFT_INCL_MEMORY
+# define STLSOFT_INCL_MEMORY
+# include <memory>
+#endif /* !STLSOFT_INCL_MEMORY */
+#ifndef STLSOFT_INCL_TYPE_TRAITS
+# define STLSOFT_INCL_TYPE_TRAITS
+# include <type_traits>
+#endif /* !STLSOFT_INCL_TYPE_TRAITS */
+#ifndef STLSOFT_INCL_UTILITY
+# define STLSOFT_INCL_UTILITY
+# include <utility>
+#endif /* !STLSOFT_INCL_UTILITY */
+
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#if defined(__SSE2__) || \
+    defined(_M_X64) || \
+    (   defined(_M_IX86_FP) && \
+        _M_IX86_FP >= 2)
+# define STLSOFT_CONTAINERS_UTIL_FLAT_COUNT_TABLE_USE_SSE2_
+#endif
+
+#if defined(STLSOFT_CONTAINERS_UTIL_FLAT_COUNT_TABLE_USE_SSE2_)
+# include <emmintrin.h>
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef STLSOFT_NO_NAMESPACE
+namespace stlsoft
+{
+#endif /* STLSOFT_NO_NAMESPACE */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * implementation
+ */
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+namespace ximpl_flat_count_table {
+
+    /* Each slot has a control byte, which is either empty_ctrl or the
+     * 7-bit tag (the low bits of the slot's key's mixed hash). Control
+     * bytes are examined a group at a time, so that a lookup usually
+     * compares a key only with the one it is looking for.
+     */
+    enum { group_width = 16 };
+
+    ss_uint8_t const empty_ctrl = 0x80;
+
+    /* Mask of the bytes in the group at p equal to tag */
+    inline
+    ss_uint32_t
+    match_tag(
+        ss_uint8_t const*   p
+    ,   ss_uint8_t          tag
+    ) STLSOFT_NOEXCEPT
+    {
+#if defined(STLSOFT_CONTAINERS_UTIL_FLAT_COUNT_TABLE_USE_SSE2_)
+
+        __m128i const group = _mm_loadu_si128(reinterpret_cast<__m128i const*>(p));
+
+        return static_cast<ss_uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(static_cast<char>(tag)))));
+#else
+
+        ss_uint32_t r = 0;
+
+        for (unsigned i = 0; i != group_width; ++i)
+        {
+            r |= static_cast<ss_uint32_t>(tag == p[i]) << i;
+        }
+
+        return r;
+#endif
+    }
+
+    /* Mask of the empty bytes in the group at p */
+    inline
+    ss_uint32_t
+    match_empty(
+        ss_uint8_t const*   p
+    ) STLSOFT_NOEXCEPT
+    {
+#if defined(STLSOFT_CONTAINERS_UTIL_FLAT_COUNT_TABLE_USE_SSE2_)
+
+        // only empty_ctrl has its high bit set
+
+        return static_cast<ss_uint32_t>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(p))));
+#else
+
+        ss_uint32_t r = 0;
+
+        for (unsigned i = 0; i != group_width; ++i)
+        {
+            r |= static_cast<ss_uint32_t>(empty_ctrl == p[i]) << i;
+        }
+
+        return r;
+#endif
+    }
+
+    /* Mixes the (possibly identity) hash, so that both the probe start
+     * (high bits) and the tag (low 7 bits) are well distributed
+     */
+    inline
+    ss_uint64_t
+    mix_hash(
+        ss_size_t h
+    ) STLSOFT_NOEXCEPT
+    {
+        ss_uint64_t const m = static_cast<ss_uint64_t>(h) * STLSOFT_GEN_UINT64_SUFFIX(0x9e3779b97f4a7c15);
+
+        return m ^ (m >> 32);
+    }
+} /* namespace ximpl_flat_count_table */
+
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * classes
+ */
+
+/** Open-addressing hash table of key+count pairs, used as the map type of
+ *   \link stlsoft::frequency_map_traits_flat frequency_map_traits_flat\endlink
+ *
+ * \ingroup group__library__Container
+ *
+ * \tparam T_key The key type
+ * \tparam T_count The count type
+ * \tparam T_hash The hash function type
+ * \tparam T_keyEqual The key-equality predicate type
+ *
+ * Entries are held in place in a single array of slots - with no per-entry
+ * allocation - alongside an array of one-byte control values, in the
+ * manner of SwissTable: lookups examine sixteen control bytes at a time
+ * (with SSE2, where available) and compare keys only for slots whose
+ * control byte matches seven bits of the key's hash. The table is grown,
+ * by doubling, when it would become more than 7/8 full.
+ *
+ * It provides only those operations required by
+ * \link stlsoft::frequency_map frequency_map\endlink: in particular, there
+ * is no erase(), which allows probing to be simpler (no tombstones).
+ */
+template<
+    ss_typename_param_k T_key
+,   ss_typename_param_k T_count
+,   ss_typename_param_k T_hash      =   std::hash<T_key>
+,   ss_typename_param_k T_keyEqual  =   std::equal_to<T_key>
+>
+class flat_count_table
+{
+public: // types
+    /// This type
+    typedef flat_count_table<
+        T_key
+    ,   T_count
+    ,   T_hash
+    ,   T_keyEqual
+    >                                                       class_type;
+    /// The key type
+    typedef T_key                                           key_type;
+    /// The count (mapped) type
+    typedef T_count                                         mapped_type;
+    /// The value type
+    typedef std::pair<T_key, T_count>                       value_type;
+    /// The non-mutating (const) reference type
+    typedef value_type const&                               const_reference;
+    /// The hash type
+    typedef T_hash                                          hasher;
+    /// The key-equal type
+    typedef T_keyEqual                                      key_equal;
+    /// The size type
+    typedef ss_size_t                                       size_type;
+    /// The difference type
+    typedef ss_ptrdiff_t                                    difference_type;
+    class                                                   const_iterator;
+    /// The iterator type
+    ///
+    /// \note Entries may not be modified via iterators
+    typedef const_iterator                                  iterator;
+private:
+    typedef std::allocator<value_type>                      allocator_type_;
+    typedef std::allocator_traits<allocator_type_>          allocator_traits_type_;
+
+public: // construction
+    /// Creates an empty instance, which does not allocate
+    flat_count_table() STLSOFT_NOEXCEPT
+        : m_ctrl(ss_nullptr_k)
+        , m_slots(ss_nullptr_k)
+        , m_capacity(0)
+        , m_size(0)
+        , m_hash()
+        , m_equal()
+    {}
+    /// Creates an instance that is a copy of \c rhs
+    flat_count_table(class_type const& rhs)
+        : m_ctrl(ss_nullptr_k)
+        , m_slots(ss_nullptr_k)
+        , m_capacity(0)
+        , m_size(0)
+        , m_hash(rhs.m_hash)
+        , m_equal(rhs.m_equal)
+    {
+        if (0 != rhs.m_size)
+        {
+            allocate_(rhs.m_capacity);
+
+            ::memcpy(m_ctrl, rhs.m_ctrl, rhs.m_capacity + ximpl_flat_count_table::group_width);
+
+            size_type i = 0;
+
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+            try
+            {
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+
+                for (; i != m_capacity; ++i)
+                {
+                    if (is_full_(i))
+                    {
+                        allocator_traits_type_::construct(m_allocator, m_slots + i, rhs.m_slots[i]);
+                    }
+                }
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+            }
+            catch (...)
+            {
+                destroy_slots_(i);
+                deallocate_();
+
+                throw;
+            }
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+
+            m_size = rhs.m_size;
+        }
+    }
+    /// Creates an instance by taking over the state of \c rhs, which is
+    /// left empty
+    flat_count_table(class_type&& rhs) STLSOFT_NOEXCEPT
+        : m_ctrl(rhs.m_ctrl)
+        , m_slots(rhs.m_slots)
+        , m_capacity(rhs.m_capacity)
+        , m_size(rhs.m_size)
+        , m_hash(rhs.m_hash)
+        , m_equal(rhs.m_equal)
+    {
+        rhs.m_ctrl      =   ss_nullptr_k;
+        rhs.m_slots     =   ss_nullptr_k;
+        rhs.m_capacity  =   0;
+        rhs.m_size      =   0;
+    }
+    /// Destroys the instance
+    ~flat_count_table() STLSOFT_NOEXCEPT
+    {
+        destroy_slots_(m_capacity);
+        deallocate_();
+    }
+    /// Copy-assigns from \c rhs
+    class_type& operator =(class_type const& rhs)
+    {
+        class_type(rhs).swap(*this);
+
+        return *this;
+    }
+    /// Move-assigns from \c rhs
+    class_type& operator =(class_type&& rhs) STLSOFT_NOEXCEPT
+    {
+        class_type(std::move(rhs)).swap(*this);
+
+        return *this;
+    }
+
+public: // operations
+    /// Returns a reference to the count associated with \c key, inserting
+    /// it, with a count of 0, if it does not already exist
+    ///
+    /// \note Inserting may invalidate iterators
+    mapped_type& operator [](key_type const& key)
+    {
+        ss_uint64_t const   h   =   ximpl_flat_count_table::mix_hash(m_hash(key));
+        ss_uint8_t const    tag =   static_cast<ss_uint8_t>(h & 0x7f);
+        size_type           index = 0;
+
+        if (find_index_(key, h, tag, &index))
+        {
+            return m_slots[index].second;
+        }
+
+        if (m_size + 1 > max_load_(m_capacity))
+        {
+            rehash_(0 == m_capacity ? size_type(ximpl_flat_count_table::group_width) : 2 * m_capacity);
+
+            index = find_empty_index_(h);
+        }
+
+        // the slot is constructed before it is marked as full, so that the
+        // instance is unchanged if construction throws
+
+        allocator_traits_type_::construct(m_allocator, m_slots + index, key, mapped_type());
+
+        set_ctrl_(index, tag);
+        ++m_size;
+
+        return m_slots[index].second;
+    }
+
+    /// Ensures that the instance can hold at least \c n entries without
+    /// being grown
+    void reserve(size_type n)
+    {
+        size_type capacity = (0 == m_capacity) ? size_type(ximpl_flat_count_table::group_width) : m_capacity;
+
+        for (; max_load_(capacity) < n; capacity *= 2)
+        {}
+
+        if (capacity != m_capacity)
+        {
+            rehash_(capacity);
+        }
+    }
+
+    /// Removes all entries, retaining the allocated capacity
+    void clear() STLSOFT_NOEXCEPT
+    {
+        if (0 != m_capacity)
+        {
+            destroy_slots_(m_capacity);
+
+            ::memset(m_ctrl, ximpl_flat_count_table::empty_ctrl, m_capacity + ximpl_flat_count_table::group_width);
+
+            m_size = 0;
+        }
+    }
+
+    /// Swaps the state of the given instance with this instance
+    void swap(class_type& rhs) STLSOFT_NOEXCEPT
+    {
+        std::swap(m_ctrl, rhs.m_ctrl);
+        std::swap(m_slots, rhs.m_slots);
+        std::swap(m_capacity, rhs.m_capacity);
+        std::swap(m_size, rhs.m_size);
+        std::swap(m_hash, rhs.m_hash);
+        std::swap(m_equal, rhs.m_equal);
+    }
+
+public: // search
+    /// Returns an iterator for the entry for the given key, or
+    /// <code>end()</code> if no such entry exists
+    const_iterator find(key_type const& key) const
+    {
+        ss_uint64_t const   h   =   ximpl_flat_count_table::mix_hash(m_hash(key));
+        ss_uint8_t const    tag =   static_cast<ss_uint8_t>(h & 0x7f);
+        size_type           index = 0;
+
+        if (find_index_(key, h, tag, &index))
+        {
+            return const_iterator(m_ctrl, m_slots, index, m_capacity);
+        }
+
+        return end();
+    }
+
+    /// The number of entries (0 or 1) for the given key
+    size_type count(key_type const& key) const
+    {
+        return end() != find(key);
+    }
+
+public: // attributes
+    /// The number of entries
+    size_type size() const STLSOFT_NOEXCEPT
+    {
+        return m_size;
+    }
+    /// Indicates whether there are no entries
+    bool empty() const STLSOFT_NOEXCEPT
+    {
+        return 0 == m_size;
+    }
+    /// The number of slots
+    size_type capacity() const STLSOFT_NOEXCEPT
+    {
+        return m_capacity;
+    }
+
+public: // iteration
+    /// A non-mutating (const) iterator representing the start of the
+    /// sequence
+    const_iterator begin() const STLSOFT_NOEXCEPT
+    {
+        const_iterator it(m_ctrl, m_slots, 0, m_capacity);
+
+        it.skip_empty_();
+
+        return it;
+    }
+    /// A non-mutating (const) iterator representing the end-point of the
+    /// sequence
+    const_iterator end() const STLSOFT_NOEXCEPT
+    {
+        return const_iterator(m_ctrl, m_slots, m_capacity, m_capacity);
+    }
+    /// A non-mutating (const) iterator representing the start of the
+    /// sequence
+    const_iterator cbegin() const STLSOFT_NOEXCEPT
+    {
+        return begin();
+    }
+    /// A non-mutating (const) iterator representing the end-point of the
+    /// sequence
+    const_iterator cend() const STLSOFT_NOEXCEPT
+    {
+        return end();
+    }
+
+private: // implementation
+    static size_type max_load_(size_type capacity) STLSOFT_NOEXCEPT
+    {
+        return capacity - capacity / 8;
+    }
+
+    bool is_full_(size_type index) const STLSOFT_NOEXCEPT
+    {
+        return 0 == (m_ctrl[index] & ximpl_flat_count_table::empty_ctrl);
+    }
+
+    // The first group_width control bytes are cloned after the last, so
+    // that a group may be loaded from any position without wrapping
+    void set_ctrl_(size_type index, ss_uint8_t tag) STLSOFT_NOEXCEPT
+    {
+        m_ctrl[index] = tag;
+
+        if (index < size_type(ximpl_flat_count_table::group_width))
+        {
+            m_ctrl[m_capacity + index] = tag;
+        }
+    }
+
+    bool find_index_(key_type const& key, ss_uint64_t h, ss_uint8_t tag, size_type* index) const
+    {
+        if (0 == m_capacity)
+        {
+            return false;
+        }
+
+        size_type const mask = m_capacity - 1;
+
+        for (size_type pos = static_cast<size_type>(h >> 7) & mask; ; pos = (pos + ximpl_flat_count_table::group_width) & mask)
+        {
+            ss_uint8_t const* const group = m_ctrl + pos;
+
+            for (ss_uint32_t matches = ximpl_flat_count_table::match_tag(group, tag); 0 != matches; matches &= matches - 1)
+            {
+                size_type const i = (pos + stlsoft_C_count_trailing_zero_bits_in_32bit_unsigned_integer(matches)) & mask;
+
+                if (m_equal(m_slots[i].first, key))
+                {
+                    *index = i;
+
+                    return true;
+                }
+            }
+
+            // Since there is no erasure, an entry is always placed in the
+            // first empty slot of its probe sequence, so reaching a group
+            // with an empty slot means the key is not present
+
+            ss_uint32_t const empties = ximpl_flat_count_table::match_empty(group);
+
+            if (0 != empties)
+            {
+                *index = (pos + stlsoft_C_count_trailing_zero_bits_in_32bit_unsigned_integer(empties)) & mask;
+
+                return false;
+            }
+        }
+    }
+
+    size_type find_empty_index_(ss_uint64_t h) const STLSOFT_NOEXCEPT
+    {
+        size_type const mask = m_capacity - 1;
+
+        for (size_type pos = static_cast<size_type>(h >> 7) & mask; ; pos = (pos + ximpl_flat_count_table::group_width) & mask)
+        {
+            ss_uint32_t const empties = ximpl_flat_count_table::match_empty(m_ctrl + pos);
+
+            if (0 != empties)
+            {
+                return (pos + stlsoft_C_count_trailing_zero_bits_in_32bit_unsigned_integer(empties)) & mask;
+            }
+        }
+    }
+
+    void allocate_(size_type capacity)
+    {
+        STLSOFT_ASSERT(ss_nullptr_k == m_ctrl);
+
+        m_slots = allocator_traits_type_::allocate(m_allocator, capacity);
+
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+        try
+        {
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+
+            m_ctrl = new ss_uint8_t[capacity + ximpl_flat_count_table::group_width];
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+        }
+        catch (...)
+        {
+            allocator_traits_type_::deallocate(m_allocator, m_slots, capacity);
+
+            m_slots = ss_nullptr_k;
+
+            throw;
+        }
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+
+        m_capacity = capacity;
+
+        ::memset(m_ctrl, ximpl_flat_count_table::empty_ctrl, capacity + ximpl_flat_count_table::group_width);
+    }
+
+    void deallocate_() STLSOFT_NOEXCEPT
+    {
+        if (ss_nullptr_k != m_ctrl)
+        {
+            allocator_traits_type_::deallocate(m_allocator, m_slots, m_capacity);
+
+            delete [] m_ctrl;
+
+            m_ctrl      =   ss_nullptr_k;
+            m_slots     =   ss_nullptr_k;
+            m_capacity  =   0;
+        }
+    }
+
+    // destroys the full slots in [0, n)
+    void destroy_slots_(size_type n) STLSOFT_NOEXCEPT
+    {
+        if (!std::is_trivially_destructible<value_type>::value)
+        {
+            for (size_type i = 0; i != n; ++i)
+            {
+                if (is_full_(i))
+                {
+                    allocator_traits_type_::destroy(m_allocator, m_slots + i);
+                }
+            }
+        }
+    }
+
+    void rehash_(size_type capacity)
+    {
+        class_type t;
+
+        t.m_hash    =   m_hash;
+        t.m_equal   =   m_equal;
+
+        t.allocate_(capacity);
+
+        { for (size_type i = 0; i != m_capacity; ++i)
+        {
+            if (is_full_(i))
+            {
+                ss_uint64_t const   h       =   ximpl_flat_count_table::mix_hash(m_hash(m_slots[i].first));
+                size_type const     index   =   t.find_empty_index_(h);
+
+                // t's destructor cleans up if this throws
+
+                allocator_traits_type_::construct(t.m_allocator, t.m_slots + index, std::move_if_noexcept(m_slots[i]));
+
+                t.set_ctrl_(index, static_cast<ss_uint8_t>(h & 0x7f));
+                ++t.m_size;
+            }
+        }}
+
+        t.swap(*this);
+    }
+
+private: // fields
+    ss_uint8_t*     m_ctrl;
+    value_type*     m_slots;
+    size_type       m_capacity;
+    size_type       m_size;
+    hasher          m_hash;
+    key_equal       m_equal;
+    allocator_type_ m_allocator;
+};
+
+
+/** Non-mutating (const) forward iterator for
+ *   \link stlsoft::flat_count_table flat_count_table\endlink
+ *
+ * \ingroup group__library__Container
+ */
+template<
+    ss_typename_param_k T_key
+,   ss_typename_param_k T_count
+,   ss_typename_param_k T_hash
+,   ss_typename_param_k T_keyEqual
+>
+class flat_count_table<T_key, T_count, T_hash, T_keyEqual>::const_iterator
+{
+private: // types
+    friend class flat_count_table<T_key, T_count, T_hash, T_keyEqual>;
+public:
+    /// This type
+    typedef const_iterator                                  class_type;
+    /// The iterator category
+    typedef std::forward_iterator_tag                       iterator_category;
+    /// The value type
+    typedef std::pair<T_key, T_count>                       value_type;
+    /// The difference type
+    typedef ss_ptrdiff_t                                    difference_type;
+    /// The pointer type
+    typedef value_type const*                               pointer;
+    /// The reference type
+    typedef value_type const&                               reference;
+
+public: // construction
+    /// Constructs an iterator that may only be assigned to
+    const_iterator() STLSOFT_NOEXCEPT
+        : m_ctrl(ss_nullptr_k)
+        , m_slots(ss_nullptr_k)
+        , m_index(0)
+        , m_capacity(0)
+    {}
+private:
+    const_iterator(
+        ss_uint8_t const*   ctrl
+    ,   value_type const*   slots
+    ,   ss_size_t           index
+    ,   ss_size_t           capacity
+    ) STLSOFT_NOEXCEPT
+        : m_ctrl(ctrl)
+        , m_slots(slots)
+        , m_index(index)
+        , m_capacity(capacity)
+    {}
+
+public: // iteration
+    /// Dereferences the iterator
+    reference operator *() const STLSOFT_NOEXCEPT
+    {
+        STLSOFT_MESSAGE_ASSERT("attempting to dereference an end iterator", m_index < m_capacity);
+
+        return m_slots[m_index];
+    }
+    /// Dereferences the iterator
+    pointer operator ->() const STLSOFT_NOEXCEPT
+    {
+        return &operator *();
+    }
+
+    /// Pre-increment operator
+    class_type& operator ++() STLSOFT_NOEXCEPT
+    {
+        STLSOFT_MESSAGE_ASSERT("attempting to increment an end iterator", m_index < m_capacity);
+
+        ++m_index;
+
+        skip_empty_();
+
+        return *this;
+    }
+    /// Post-increment operator
+    class_type operator ++(int) STLSOFT_NOEXCEPT
+    {
+        class_type r(*this);
+
+        operator ++();
+
+        return r;
+    }
+
+public: // comparison
+    /// Evaluates whether two instances are equal
+    bool equal(class_type const& rhs) const STLSOFT_NOEXCEPT
+    {
+        return m_index == rhs.m_index;
+    }
+
+    /// Evaluates whether two instances are equal
+    friend bool operator ==(class_type const& lhs, class_type const& rhs) STLSOFT_NOEXCEPT
+    {
+        return lhs.equal(rhs);
+    }
+    /// Evaluates whether two instances are not equal
+    friend bool operator !=(class_type const& lhs, class_type const& rhs) STLSOFT_NOEXCEPT
+    {
+        return !lhs.equal(rhs);
+    }
+
+private: // implementation
+    void skip_empty_() STLSOFT_NOEXCEPT
+    {
+        for (; m_index != m_capacity && 0 != (m_ctrl[m_index] & ximpl_flat_count_table::empty_ctrl); ++m_index)
+        {}
+    }
+
+private: // fields
+    ss_uint8_t const*   m_ctrl;
+    value_type const*   m_slots;
+    ss_size_t           m_index;
+    ss_size_t           m_capacity;
+};
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * swapping
+ */
+
+template<
+    ss_typename_param_k T_key
+,   ss_typename_param_k T_count
+,   ss_typename_param_k T_hash
+,   ss_typename_param_k T_keyEqual
+>
+inline void swap(
+    flat_count_table<T_key, T_count, T_hash, T_keyEqual>& lhs
+,   flat_count_table<T_key, T_count, T_hash, T_keyEqual>& rhs
+) STLSOFT_NOEXCEPT
+{
+    lhs.swap(rhs);
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef STLSOFT_NO_NAMESPACE
+} /* namespace stlsoft */
+#endif /* STLSOFT_NO_NAMESPACE */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !STLSOFT_INCL_STLSOFT_CONTAINERS_UTIL_HPP_FLAT_COUNT_TABLE */
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -4,11 +4,11 @@
  * Purpose:     Character-encoding scheme interconversion components.
  *
  * Created:     31st May 2003
- * Updated:     11th March 2024
+ * Updated:     16th October 2026
  *
  * Home:        http://stlsoft.org/
  *
- * Copyright (c) 2019-2024, Matthew Wilson and Synesis Information Systems
+ * Copyright (c) 2019-2026, Matthew Wilson and Synesis Information Systems
  * Copyright (c) 2003-2019, Matthew Wilson and Synesis Software
  * All rights reserved.
  *
@@ -44,7 +44,9 @@
 /** \file stlsoft/conversion/char_conversions.hpp
  *
  * \brief [C++] Definition of the stlsoft::multibyte2wide and
- *  stlsoft::wide2multibyte class templates
+ *  stlsoft::wide2multibyte class templates, and the
+ *  stlsoft::crt_char_conversion_policy and
+ *  stlsoft::utf8_char_conversion_policy conversion policies
  *   (\ref group__library__Conversion "Conversion" Library).
  */
 
@@ -53,9 +55,9 @@
 
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 # define STLSOFT_VER_STLSOFT_CONVERSION_HPP_CHAR_CONVERSIONS_MAJOR      5
-# define STLSOFT_VER_STLSOFT_CONVERSION_HPP_CHAR_CONVERSIONS_MINOR      3
-# define STLSOFT_VER_STLSOFT_CONVERSION_HPP_CHAR_CONVERSIONS_REVISION   4
-# define STLSOFT_VER_STLSOFT_CONVERSION_HPP_CHAR_CONVERSIONS_EDIT       121
+# define STLSOFT_VER_STLSOFT_CONVERSION_HPP_CHAR_CONVERSIONS_MINOR      4
+# define STLSOFT_VER_STLSOFT_CONVERSION_HPP_CHAR_CONVERSIONS_REVISION   0
+# define STLSOFT_VER_STLSOFT_CONVERSION_HPP_CHAR_CONVERSIONS_EDIT       122
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 
@@ -79,6 +81,9 @@
 # error stlsoft/conversion/char_conversions.hpp is not compatible with Visual C++ 5.0 or earlier
 #endif /* compiler */
 
+#ifndef STLSOFT_INCL_STLSOFT_CONVERSION_HPP_UTF8_TRANSCODING
+# include <stlsoft/conversion/utf8_transcoding.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_CONVERSION_HPP_UTF8_TRANSCODING */
 #ifndef STLSOFT_INCL_STLSOFT_SHIMS_ACCESS_HPP_STRING
 # include <stlsoft/shims/access/string.hpp>
 #endif /* !STLSOFT_INCL_STLSOFT_SHIMS_ACCESS_HPP_STRING */
@@ -89,7 +94,6 @@
 # ifndef STLSOFT_INCL_STLSOFT_ERROR_HPP_CONVERSION_ERROR
 #  include <stlsoft/error/conversion_error.hpp>
 # endif /* !STLSOFT_INCL_STLSOFT_ERROR_HPP_CONVERSION_ERROR */
-# include <errno.h>
 #endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
 
 #ifndef STLSOFT_INCL_STLSOFT_INTERNAL_H_SAFESTR
@@ -100,6 +104,15 @@
 # include <stlsoft/api/internal/memfns.h>
 #endif /* !STLSOFT_INCL_STLSOFT_API_internal_h_memfns */
 
+#ifndef STLSOFT_INCL_H_ERRNO
+# define STLSOFT_INCL_H_ERRNO
+# include <errno.h>
+#endif /* !STLSOFT_INCL_H_ERRNO */
+#ifndef STLSOFT_INCL_H_STDLIB
+# define STLSOFT_INCL_H_STDLIB
+# include <stdlib.h>
+#endif /* !STLSOFT_INCL_H_STDLIB */
+
 
 /* /////////////////////////////////////////////////////////////////////////
  * namespace
@@ -146,7 +159,16 @@ protected: // construction
         size_type cch
     )
         : parent_class_type(cch)
+        , m_length(length_from_size_(parent_class_type::size()))
     {}
+    convertible_buffer_(
+        convertible_buffer_ const& rhs
+    )
+        : parent_class_type(rhs.m_length + 1)
+        , m_length(length_from_size_(parent_class_type::size()))
+    {
+        STLSOFT_API_INTERNAL_memfns_memcpy(parent_class_type::data(), rhs.parent_class_type::data(), sizeof(char_type) * parent_class_type::size());
+    }
 
 /// \name Accessors
 /// @{
@@ -168,18 +190,11 @@ public:
 
     size_type size() const
     {
-        size_type n = parent_class_type::size();
-
 #ifdef STLSOFT_CF_EXCEPTION_SUPPORT
-        STLSOFT_ASSERT(0 != n);
-#else /* ? STLSOFT_CF_EXCEPTION_SUPPORT */
-        if (0 == n)
-        {
-            return 0;
-        }
+        STLSOFT_ASSERT(0 != parent_class_type::size());
 #endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
 
-        return n - 1;
+        return m_length;
     }
 /// @}
 
@@ -196,13 +211,279 @@ protected: // helpers
     size_type
     estimated_length_() const
     {
-        return parent_class_type::size() - 1;
+        return length_from_size_(parent_class_type::size());
     }
+
+    // Grows the capacity, excluding the nul-terminator, preserving the
+    // contents
+    //
+    // NOTE: the buffer is never shrunk, since auto_buffer would then
+    // deallocate with the smaller size; the converted length is instead
+    // recorded by set_length_()
+    bool
+    grow_(
+        size_type cch
+    )
+    {
+        STLSOFT_ASSERT(cch + 1 >= parent_class_type::size());
+
+        return parent_class_type::resize(cch + 1);
+    }
+
+    // Records the converted length, which must be within the capacity
+    void
+    set_length_(
+        size_type cch
+    ) STLSOFT_NOEXCEPT
+    {
+        STLSOFT_ASSERT(cch < parent_class_type::size());
+
+        m_length = cch;
+    }
+
+private:
+    static
+    size_type
+    length_from_size_(
+        size_type n
+    ) STLSOFT_NOEXCEPT
+    {
+        return (0 == n) ? 0 : n - 1;
+    }
+
+private: // fields
+    size_type   m_length;
+
+private: // not to be implemented
+    convertible_buffer_& operator =(convertible_buffer_ const&);
 };
 
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 
+/* /////////////////////////////////////////////////////////////////////////
+ * policies
+ */
+
+/** Conversion policy for stlsoft::multibyte2wide and
+ *   stlsoft::wide2multibyte that uses the (locale-dependent) C standard
+ *   library functions <code>mbstowcs()</code> and
+ *   <code>wcstombs()</code>.
+ *
+ * \ingroup group__library__Conversion
+ *
+ * A conversion policy provides the following static member functions,
+ * each of which returns 0 on success or an <code>errno</code> value on
+ * failure:
+ *
+ * - <code>multibyte_to_wide(s, cch, dest, cchDest, numRead,
+ *   numWritten)</code>, which converts as much of the multibyte string
+ *   <code>s</code> (of length <code>cch</code>) as will fit into the
+ *   <code>cchDest</code> characters of <code>dest</code>. A destination
+ *   of <code>cch</code> characters must always suffice;
+ * - <code>wide_to_multibyte(s, cch, dest, cchDest, numRead,
+ *   numWritten)</code>, which converts as much of the wide string
+ *   <code>s</code> as will fit into <code>dest</code>, reporting in
+ *   <code>*numRead</code> how much that is;
+ * - <code>wide_to_multibyte_length(s, cch, pcch)</code>, which reports a
+ *   sufficient destination length for the wide string <code>s</code>.
+ *
+ * In each case <code>dest</code> has space for a nul-terminator after
+ * <code>cchDest</code> characters, which the caller writes.
+ */
+struct crt_char_conversion_policy
+{
+    /// Converts a multibyte string to a wide string
+    static
+    int
+    multibyte_to_wide(
+        ss_char_a_t const*  s
+    ,   ss_size_t           cch
+    ,   ss_char_w_t*        dest
+    ,   ss_size_t           cchDest
+    ,   ss_size_t*          numRead
+    ,   ss_size_t*          numWritten
+    )
+    {
+        STLSOFT_ASSERT(cchDest >= cch);
+
+#ifdef STLSOFT_USING_SAFE_STR_FUNCTIONS
+        ss_size_t   numConverted;
+        int const   err = ::mbstowcs_s(&numConverted, dest, cchDest + 1, s, cch);
+
+        if (0 != err)
+        {
+            return err;
+        }
+
+        // the count includes the nul-terminator
+        *numWritten = (0 == numConverted) ? 0 : numConverted - 1;
+#else /* ? STLSOFT_USING_SAFE_STR_FUNCTIONS */
+        ss_size_t const n = ::mbstowcs(dest, s, cch);
+
+        if (static_cast<ss_size_t>(-1) == n)
+        {
+            return errno;
+        }
+
+        *numWritten = n;
+#endif /* STLSOFT_USING_SAFE_STR_FUNCTIONS */
+
+        *numRead = cch;
+
+        STLSOFT_SUPPRESS_UNUSED(cchDest);
+
+        return 0;
+    }
+
+    /// Converts a wide string to a multibyte string
+    ///
+    /// \note The C standard library functions do not report how much of
+    ///   the source was converted, so the whole of it is deemed to have
+    ///   been, and the result is truncated if <code>dest</code> is too
+    ///   small
+    static
+    int
+    wide_to_multibyte(
+        ss_char_w_t const*  s
+    ,   ss_size_t           cch
+    ,   ss_char_a_t*        dest
+    ,   ss_size_t           cchDest
+    ,   ss_size_t*          numRead
+    ,   ss_size_t*          numWritten
+    )
+    {
+#ifdef STLSOFT_USING_SAFE_STR_FUNCTIONS
+        ss_size_t   numConverted;
+        int const   err = ::wcstombs_s(&numConverted, dest, cchDest + 1, s, cchDest);
+
+        if (0 != err)
+        {
+            return err;
+        }
+
+        // the count includes the nul-terminator
+        *numWritten = (0 == numConverted) ? 0 : numConverted - 1;
+#else /* ? STLSOFT_USING_SAFE_STR_FUNCTIONS */
+        ss_size_t const n = ::wcstombs(dest, s, cchDest);
+
+        if (static_cast<ss_size_t>(-1) == n)
+        {
+            return errno;
+        }
+
+        *numWritten = n;
+#endif /* STLSOFT_USING_SAFE_STR_FUNCTIONS */
+
+        *numRead = cch;
+
+        return 0;
+    }
+
+    /// Reports a sufficient length for the conversion of a wide string
+    static
+    int
+    wide_to_multibyte_length(
+        ss_char_w_t const*  s
+    ,   ss_size_t           cch
+    ,   ss_size_t*          pcch
+    )
+    {
+        STLSOFT_SUPPRESS_UNUSED(s);
+
+        *pcch = cch * MB_CUR_MAX;
+
+        return 0;
+    }
+};
+
+/** Conversion policy for stlsoft::multibyte2wide and
+ *   stlsoft::wide2multibyte that transcodes between UTF-8 and UTF-16 or
+ *   UTF-32 (according to the size of <code>wchar_t</code>), independently
+ *   of the locale.
+ *
+ * \ingroup group__library__Conversion
+ *
+ * Ill-formed input - including overlong forms, surrogates and unpaired
+ * surrogates - is rejected with <code>EILSEQ</code>; use
+ * stlsoft::utf8_to_wide() or stlsoft::wide_to_utf8() directly to obtain
+ * the position of the error.
+ *
+ * \see crt_char_conversion_policy for a description of the members
+ */
+struct utf8_char_conversion_policy
+{
+    /// Converts a UTF-8 string to a wide string
+    static
+    int
+    multibyte_to_wide(
+        ss_char_a_t const*  s
+    ,   ss_size_t           cch
+    ,   ss_char_w_t*        dest
+    ,   ss_size_t           cchDest
+    ,   ss_size_t*          numRead
+    ,   ss_size_t*          numWritten
+    )
+    {
+        ss_size_t const n = STLSOFT_NS_QUAL(utf8_to_wide)(s, cch, dest, cchDest, numRead, NULL);
+
+        if (static_cast<ss_size_t>(-1) == n)
+        {
+            return EILSEQ;
+        }
+
+        *numWritten = n;
+
+        return 0;
+    }
+
+    /// Converts a wide string to a UTF-8 string
+    static
+    int
+    wide_to_multibyte(
+        ss_char_w_t const*  s
+    ,   ss_size_t           cch
+    ,   ss_char_a_t*        dest
+    ,   ss_size_t           cchDest
+    ,   ss_size_t*          numRead
+    ,   ss_size_t*          numWritten
+    )
+    {
+        ss_size_t const n = STLSOFT_NS_QUAL(wide_to_utf8)(s, cch, dest, cchDest, numRead, NULL);
+
+        if (static_cast<ss_size_t>(-1) == n)
+        {
+            return EILSEQ;
+        }
+
+        *numWritten = n;
+
+        return 0;
+    }
+
+    /// Reports the exact length of the UTF-8 form of a wide string
+    static
+    int
+    wide_to_multibyte_length(
+        ss_char_w_t const*  s
+    ,   ss_size_t           cch
+    ,   ss_size_t*          pcch
+    )
+    {
+        ss_size_t const n = STLSOFT_NS_QUAL(wide_to_utf8_length)(s, cch, NULL);
+
+        if (static_cast<ss_size_t>(-1) == n)
+        {
+            return EILSEQ;
+        }
+
+        *pcch = n;
+
+        return 0;
+    }
+};
+
+
 /* /////////////////////////////////////////////////////////////////////////
  * classes
  */
@@ -211,9 +492,21 @@ protected: // helpers
  *   (<code>whar_t</code>-based) string.
  *
  * \ingroup group__library__Conversion
+ *
+ * \tparam V_internalSize The number of characters that can be converted
+ *   without allocating
+ * \tparam T_policy The conversion policy, which defaults to
+ *   stlsoft::crt_char_conversion_policy. Specify
+ *   stlsoft::utf8_char_conversion_policy for locale-independent UTF-8
+ *   conversion
  */
 template <
-    ss_size_t V_internalSize
+    ss_size_t           V_internalSize
+#ifdef STLSOFT_CF_TEMPLATE_CLASS_DEFAULT_CLASS_ARGUMENT_SUPPORT
+,   ss_typename_param_k T_policy = crt_char_conversion_policy
+#else /* ? STLSOFT_CF_TEMPLATE_CLASS_DEFAULT_CLASS_ARGUMENT_SUPPORT */
+,   ss_typename_param_k T_policy
+#endif /* STLSOFT_CF_TEMPLATE_CLASS_DEFAULT_CLASS_ARGUMENT_SUPPORT */
 >
 class multibyte2wide
     : public convertible_buffer_<ss_char_w_t, ss_char_a_t, V_internalSize>
@@ -236,6 +529,8 @@ public:
     typedef ss_typename_type_k parent_class_type::size_type size_type;
     /// The pointer type
     typedef ss_typename_type_k parent_class_type::pointer   pointer;
+    /// The conversion policy type
+    typedef T_policy                                        policy_type;
 /// @}
 
 /// \name Construction
@@ -303,29 +598,31 @@ private:
         }
         else
         {
-            int         err;
-#ifdef STLSOFT_USING_SAFE_STR_FUNCTIONS
-            ss_size_t   numConverted;
+            // A multibyte string never converts to more wide characters
+            // than it has bytes, so a single pass always suffices
 
-            err = ::mbstowcs_s(&numConverted, data, size + 1, s, size);
+            size_type   numRead     =   0;
+            size_type   numWritten  =   0;
+            int const   err         =   policy_type::multibyte_to_wide(s, size, data, size, &numRead, &numWritten);
 
             if (0 != err)
             {
-#else /* ? STLSOFT_USING_SAFE_STR_FUNCTIONS */
-            if (static_cast<ss_size_t>(-1) == ::mbstowcs(data, s, size))
-            {
-                err = errno;
-#endif /* STLSOFT_USING_SAFE_STR_FUNCTIONS */
-
 #ifdef STLSOFT_CF_EXCEPTION_SUPPORT
                 STLSOFT_THROW_X(conversion_error("failed to convert multibyte string to wide string", err));
 #else /* ? STLSOFT_CF_EXCEPTION_SUPPORT */
                 data[0] = '\0';
+
+                parent_class_type::set_length_(0);
 #endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
-            } // '}'
+            }
             else
             {
-                data[size] = '\0';
+                STLSOFT_ASSERT(numRead == size);
+                STLSOFT_ASSERT(numWritten <= size);
+
+                data[numWritten] = '\0';
+
+                parent_class_type::set_length_(numWritten);
             }
         }
     }
@@ -340,10 +637,8 @@ private:
      0
 public:
     multibyte2wide(multibyte2wide const& rhs)
-        : parent_class_type(rhs.parent_class_type::size())
-    {
-        STLSOFT_API_INTERNAL_memfns_memcpy(this->parent_class_type::data_(), rhs.parent_class_type::data(), this->parent_class_type::size());
-    }
+        : parent_class_type(rhs)
+    {}
 private:
 # else /* compiler */
     multibyte2wide(multibyte2wide const&);
@@ -358,9 +653,21 @@ private:
  *    multibyte (<code>char</code>-based) string.
  *
  * \ingroup group__library__Conversion
+ *
+ * \tparam V_internalSize The number of characters that can be converted
+ *   without allocating
+ * \tparam T_policy The conversion policy, which defaults to
+ *   stlsoft::crt_char_conversion_policy. Specify
+ *   stlsoft::utf8_char_conversion_policy for locale-independent UTF-8
+ *   conversion
  */
 template <
-    ss_size_t V_internalSize
+    ss_size_t           V_internalSize
+#ifdef STLSOFT_CF_TEMPLATE_CLASS_DEFAULT_CLASS_ARGUMENT_SUPPORT
+,   ss_typename_param_k T_policy = crt_char_conversion_policy
+#else /* ? STLSOFT_CF_TEMPLATE_CLASS_DEFAULT_CLASS_ARGUMENT_SUPPORT */
+,   ss_typename_param_k T_policy
+#endif /* STLSOFT_CF_TEMPLATE_CLASS_DEFAULT_CLASS_ARGUMENT_SUPPORT */
 >
 class wide2multibyte
     : public convertible_buffer_<ss_char_a_t, ss_char_w_t, V_internalSize>
@@ -383,6 +690,8 @@ public:
     typedef ss_typename_type_k parent_class_type::size_type size_type;
     /// The pointer type
     typedef ss_typename_type_k parent_class_type::pointer   pointer;
+    /// The conversion policy type
+    typedef T_policy                                        policy_type;
 /// @}
 
 /// \name Construction
@@ -436,7 +745,7 @@ private:
 
     void prepare_(alt_char_type const* s, size_type size)
     {
-        pointer const data = parent_class_type::data_();
+        pointer data = parent_class_type::data_();
 
         // If the auto_buffer failed to allocate the required memory, and
         // we're not in an exception-environment, then size() will be zero
@@ -448,29 +757,70 @@ private:
         }
         else
         {
+            // The buffer is sized for one byte per wide character, which
+            // suffices for ASCII; if the policy reports that it ran out of
+            // room, the remainder is measured and the buffer grown to fit,
+            // so that the converted part is not reparsed
+
+            size_type   capacity    =   size;
+            size_type   numRead     =   0;
+            size_type   numWritten  =   0;
             int         err;
-#ifdef STLSOFT_USING_SAFE_STR_FUNCTIONS
-            ss_size_t   numConverted;
 
-            err = ::wcstombs_s(&numConverted, data, size + 1, s, size);
+            for (;;)
+            {
+                size_type   nr  =   0;
+                size_type   nw  =   0;
+
+                err = policy_type::wide_to_multibyte(s + numRead, size - numRead, data + numWritten, capacity - numWritten, &nr, &nw);
+
+                numRead     +=  nr;
+                numWritten  +=  nw;
+
+                if (0 != err ||
+                    size == numRead)
+                {
+                    break;
+                }
+
+                size_type remaining;
+
+                err = policy_type::wide_to_multibyte_length(s + numRead, size - numRead, &remaining);
+
+                if (0 != err)
+                {
+                    break;
+                }
+
+                capacity = numWritten + remaining;
+
+                if (!parent_class_type::grow_(capacity))
+                {
+                    err = ENOMEM;
+
+                    break;
+                }
+
+                data = parent_class_type::data_();
+            }
 
             if (0 != err)
             {
-#else /* ? STLSOFT_USING_SAFE_STR_FUNCTIONS */
-            if (static_cast<ss_size_t>(-1) == ::wcstombs(data, s, size))
-            {
-                err = errno;
-#endif /* STLSOFT_USING_SAFE_STR_FUNCTIONS */
-
 #ifdef STLSOFT_CF_EXCEPTION_SUPPORT
                 STLSOFT_THROW_X(conversion_error("failed to convert wide string to multibyte string", err));
 #else /* ? STLSOFT_CF_EXCEPTION_SUPPORT */
                 data[0] = '\0';
+
+                parent_class_type::set_length_(0);
 #endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
             }
             else
             {
-                data[size] = '\0';
+                STLSOFT_ASSERT(numWritten <= capacity);
+
+                data[numWritten] = '\0';
+
+                parent_class_type::set_length_(numWritten);
             }
         }
     }
@@ -484,10 +834,8 @@ private:
      0
 public:
     wide2multibyte(wide2multibyte const& rhs)
-        : parent_class_type(rhs.parent_class_type::size())
-    {
-        STLSOFT_API_INTERNAL_memfns_memcpy(this->parent_class_type::data_(), rhs.parent_class_type::data(), this->parent_class_type::size());
-    }
+        : parent_class_type(rhs)
+    {}
 private:
 # else /* compiler */
     wide2multibyte(wide2multibyte const&);
@@ -534,12 +882,25 @@ private:
  *
  * \ingroup group__library__Conversion
  */
-typedef multibyte2wide<256>                                 m2w;
+typedef multibyte2wide<256, crt_char_conversion_policy>     m2w;
 /** Type that converts a wide string to a multibyte string.
  *
  * \ingroup group__library__Conversion
  */
-typedef wide2multibyte<256>                                 w2m;
+typedef wide2multibyte<256, crt_char_conversion_policy>     w2m;
+
+/** Type that converts a UTF-8 string to a wide string, independently of
+ *   the locale.
+ *
+ * \ingroup group__library__Conversion
+ */
+typedef multibyte2wide<256, utf8_char_conversion_policy>    m2w_utf8;
+/** Type that converts a wide string to a UTF-8 string, independently of
+ *   the locale.
+ *
+ * \ingroup group__library__Conversion
+ */
+typedef wide2multibyte<256, utf8_char_conversion_policy>    w2m_utf8;
 
 /** [DEPRECATED] Type that converts a multibyte string to a wide string.
  *
@@ -547,14 +908,14 @@ typedef wide2multibyte<256>                                 w2m;
  *
  * \deprecated This name is deprecated in favour of stlsoft::m2w
  */
-typedef multibyte2wide<256>                                 a2w;
+typedef multibyte2wide<256, crt_char_conversion_policy>     a2w;
 /** [DEPRECATED] Type that converts a wide string to a multibyte string.
  *
  * \ingroup group__library__Conversion
  *
  * \deprecated This name is deprecated in favour of stlsoft::w2m
  */
-typedef wide2multibyte<256>                                 w2a;
+typedef wide2multibyte<256, crt_char_conversion_policy>     w2a;
 
 #if defined(UNICODE)
 
@@ -580,9 +941,10 @@ typedef w2a                                                 w2t;
  * \ingroup group__concept__Shim__string_access
  */
 template <
-    ss_size_t   V_internalSize
+    ss_size_t           V_internalSize
+,   ss_typename_param_k T_policy
 >
-inline ss_char_w_t const* c_str_ptr_null(STLSOFT_NS_QUAL(multibyte2wide)<V_internalSize> const& c)
+inline ss_char_w_t const* c_str_ptr_null(STLSOFT_NS_QUAL(multibyte2wide)<V_internalSize, T_policy> const& c)
 {
     return STLSOFT_NS_QUAL(c_str_ptr_null)(c.c_str());
 }
@@ -590,9 +952,10 @@ inline ss_char_w_t const* c_str_ptr_null(STLSOFT_NS_QUAL(multibyte2wide)<V_inter
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 
 template <
-    ss_size_t   V_internalSize
+    ss_size_t           V_internalSize
+,   ss_typename_param_k T_policy
 >
-inline ss_char_w_t const* c_str_ptr_null_w(STLSOFT_NS_QUAL(multibyte2wide)<V_internalSize> const& c)
+inline ss_char_w_t const* c_str_ptr_null_w(STLSOFT_NS_QUAL(multibyte2wide)<V_internalSize, T_policy> const& c)
 {
     return STLSOFT_NS_QUAL(c_str_ptr_null)(c.c_str());
 }
@@ -604,9 +967,10 @@ inline ss_char_w_t const* c_str_ptr_null_w(STLSOFT_NS_QUAL(multibyte2wide)<V_int
  * \ingroup group__concept__Shim__string_access
  */
 template <
-    ss_size_t   V_internalSize
+    ss_size_t           V_internalSize
+,   ss_typename_param_k T_policy
 >
-inline ss_char_w_t const* c_str_ptr(STLSOFT_NS_QUAL(multibyte2wide)<V_internalSize> const& c)
+inline ss_char_w_t const* c_str_ptr(STLSOFT_NS_QUAL(multibyte2wide)<V_internalSize, T_policy> const& c)
 {
     return c.c_str();
 }
@@ -614,9 +978,10 @@ inline ss_char_w_t const* c_str_ptr(STLSOFT_NS_QUAL(multibyte2wide)<V_internalSi
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 
 template <
-    ss_size_t   V_internalSize
+    ss_size_t           V_internalSize
+,   ss_typename_param_k T_policy
 >
-inline ss_char_w_t const* c_str_ptr_w(STLSOFT_NS_QUAL(multibyte2wide)<V_internalSize> const& c)
+inline ss_char_w_t const* c_str_ptr_w(STLSOFT_NS_QUAL(multibyte2wide)<V_internalSize, T_policy> const& c)
 {
     return c.c_str();
 }
@@ -627,9 +992,10 @@ inline ss_char_w_t const* c_str_ptr_w(STLSOFT_NS_QUAL(multibyte2wide)<V_internal
  * \ingroup group__concept__Shim__string_access
  */
 template <
-    ss_size_t   V_internalSize
+    ss_size_t           V_internalSize
+,   ss_typename_param_k T_policy
 >
-inline ss_char_w_t const* c_str_data(STLSOFT_NS_QUAL(multibyte2wide)<V_internalSize> const& c)
+inline ss_char_w_t const* c_str_data(STLSOFT_NS_QUAL(multibyte2wide)<V_internalSize, T_policy> const& c)
 {
     return c.data();
 }
@@ -637,9 +1003,10 @@ inline ss_char_w_t const* c_str_data(STLSOFT_NS_QUAL(multibyte2wide)<V_internalS
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 
 template <
-    ss_size_t   V_internalSize
+    ss_size_t           V_internalSize
+,   ss_typename_param_k T_policy
 >
-inline ss_char_w_t const* c_str_data_w(STLSOFT_NS_QUAL(multibyte2wide)<V_internalSize> const& c)
+inline ss_char_w_t const* c_str_data_w(STLSOFT_NS_QUAL(multibyte2wide)<V_internalSize, T_policy> const& c)
 {
     return c.data();
 }
@@ -650,9 +1017,10 @@ inline ss_char_w_t const* c_str_data_w(STLSOFT_NS_QUAL(multibyte2wide)<V_interna
  * \ingroup group__concept__Shim__string_access
  */
 template <
-    ss_size_t   V_internalSize
+    ss_size_t           V_internalSize
+,   ss_typename_param_k T_policy
 >
-inline ss_size_t c_str_len(STLSOFT_NS_QUAL(multibyte2wide)<V_internalSize> const& c)
+inline ss_size_t c_str_len(STLSOFT_NS_QUAL(multibyte2wide)<V_internalSize, T_policy> const& c)
 {
     return c.size();
 }
@@ -660,9 +1028,10 @@ inline ss_size_t c_str_len(STLSOFT_NS_QUAL(multibyte2wide)<V_internalSize> const
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 
 template <
-    ss_size_t   V_internalSize
+    ss_size_t           V_internalSize
+,   ss_typename_param_k T_policy
 >
-inline ss_size_t c_str_len_w(STLSOFT_NS_QUAL(multibyte2wide)<V_internalSize> const& c)
+inline ss_size_t c_str_len_w(STLSOFT_NS_QUAL(multibyte2wide)<V_internalSize, T_policy> const& c)
 {
     return c.size();
 }
@@ -675,9 +1044,10 @@ inline ss_size_t c_str_len_w(STLSOFT_NS_QUAL(multibyte2wide)<V_internalSize> con
  * \ingroup group__concept__Shim__string_access
  */
 template <
-    ss_size_t   V_internalSize
+    ss_size_t           V_internalSize
+,   ss_typename_param_k T_policy
 >
-inline ss_char_a_t const* c_str_ptr_null(STLSOFT_NS_QUAL(wide2multibyte)<V_internalSize> const& c)
+inline ss_char_a_t const* c_str_ptr_null(STLSOFT_NS_QUAL(wide2multibyte)<V_internalSize, T_policy> const& c)
 {
     return STLSOFT_NS_QUAL(c_str_ptr_null)(c.c_str());
 }
@@ -685,9 +1055,10 @@ inline ss_char_a_t const* c_str_ptr_null(STLSOFT_NS_QUAL(wide2multibyte)<V_inter
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 
 template <
-    ss_size_t   V_internalSize
+    ss_size_t           V_internalSize
+,   ss_typename_param_k T_policy
 >
-inline ss_char_a_t const* c_str_ptr_null_a(STLSOFT_NS_QUAL(wide2multibyte)<V_internalSize> const& c)
+inline ss_char_a_t const* c_str_ptr_null_a(STLSOFT_NS_QUAL(wide2multibyte)<V_internalSize, T_policy> const& c)
 {
     return STLSOFT_NS_QUAL(c_str_ptr_null)(c.c_str());
 }
@@ -698,9 +1069,10 @@ inline ss_char_a_t const* c_str_ptr_null_a(STLSOFT_NS_QUAL(wide2multibyte)<V_int
  * \ingroup group__concept__Shim__string_access
  */
 template <
-    ss_size_t   V_internalSize
+    ss_size_t           V_internalSize
+,   ss_typename_param_k T_policy
 >
-inline ss_char_a_t const* c_str_ptr(STLSOFT_NS_QUAL(wide2multibyte)<V_internalSize> const& c)
+inline ss_char_a_t const* c_str_ptr(STLSOFT_NS_QUAL(wide2multibyte)<V_internalSize, T_policy> const& c)
 {
     return c.c_str();
 }
@@ -708,9 +1080,10 @@ inline ss_char_a_t const* c_str_ptr(STLSOFT_NS_QUAL(wide2multibyte)<V_internalSi
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 
 template <
-    ss_size_t   V_internalSize
+    ss_size_t           V_internalSize
+,   ss_typename_param_k T_policy
 >
-inline ss_char_a_t const* c_str_ptr_a(STLSOFT_NS_QUAL(wide2multibyte)<V_internalSize> const& c)
+inline ss_char_a_t const* c_str_ptr_a(STLSOFT_NS_QUAL(wide2multibyte)<V_internalSize, T_policy> const& c)
 {
     return c.c_str();
 }
@@ -721,9 +1094,10 @@ inline ss_char_a_t const* c_str_ptr_a(STLSOFT_NS_QUAL(wide2multibyte)<V_internal
  * \ingroup group__concept__Shim__string_access
  */
 template <
-    ss_size_t   V_internalSize
+    ss_size_t           V_internalSize
+,   ss_typename_param_k T_policy
 >
-inline ss_char_a_t const* c_str_data(STLSOFT_NS_QUAL(wide2multibyte)<V_internalSize> const& c)
+inline ss_char_a_t const* c_str_data(STLSOFT_NS_QUAL(wide2multibyte)<V_internalSize, T_policy> const& c)
 {
     return c.data();
 }
@@ -731,9 +1105,10 @@ inline ss_char_a_t const* c_str_data(STLSOFT_NS_QUAL(wide2multibyte)<V_internalS
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 
 template <
-    ss_size_t   V_internalSize
+    ss_size_t           V_internalSize
+,   ss_typename_param_k T_policy
 >
-inline ss_char_a_t const* c_str_data_a(STLSOFT_NS_QUAL(wide2multibyte)<V_internalSize> const& c)
+inline ss_char_a_t const* c_str_data_a(STLSOFT_NS_QUAL(wide2multibyte)<V_internalSize, T_policy> const& c)
 {
     return c.data();
 }
@@ -744,9 +1119,10 @@ inline ss_char_a_t const* c_str_data_a(STLSOFT_NS_QUAL(wide2multibyte)<V_interna
  * \ingroup group__concept__Shim__string_access
  */
 template <
-    ss_size_t   V_internalSize
+    ss_size_t           V_internalSize
+,   ss_typename_param_k T_policy
 >
-inline ss_size_t c_str_len(STLSOFT_NS_QUAL(wide2multibyte)<V_internalSize> const& c)
+inline ss_size_t c_str_len(STLSOFT_NS_QUAL(wide2multibyte)<V_internalSize, T_policy> const& c)
 {
     return c.size();
 }
@@ -754,9 +1130,10 @@ inline ss_size_t c_str_len(STLSOFT_NS_QUAL(wide2multibyte)<V_internalSize> const
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 
 template <
-    ss_size_t   V_internalSize
+    ss_size_t           V_internalSize
+,   ss_typename_param_k T_policy
 >
-inline ss_size_t c_str_len_a(STLSOFT_NS_QUAL(wide2multibyte)<V_internalSize> const& c)
+inline ss_size_t c_str_len_a(STLSOFT_NS_QUAL(wide2multibyte)<V_internalSize, T_policy> const& c)
 {
     return c.size();
 }
@@ -771,6 +1148,7 @@ inline ss_size_t c_str_len_a(STLSOFT_NS_QUAL(wide2multibyte)<V_internalSize> con
  *
  * \tparam T_stream The stream type
  * \tparam V_internalSize The internal size of the multibyte2wide specialisation
+ * \tparam T_policy The conversion policy of the multibyte2wide specialisation
  *
  * \param stm The stream
  * \param c The converter
@@ -778,12 +1156,13 @@ inline ss_size_t c_str_len_a(STLSOFT_NS_QUAL(wide2multibyte)<V_internalSize> con
 template <
     ss_typename_param_k T_stream
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_policy
 >
 inline
 T_stream&
 operator <<(
-    T_stream&                                               stm
-,   STLSOFT_NS_QUAL(multibyte2wide)<V_internalSize> const&  c
+    T_stream&                                                       stm
+,   STLSOFT_NS_QUAL(multibyte2wide)<V_internalSize, T_policy> const&  c
 )
 {
     stm << c.c_str();
@@ -797,6 +1176,7 @@ operator <<(
  *
  * \tparam T_stream The stream type
  * \tparam V_internalSize The internal size of the wide2multibyte specialisation
+ * \tparam T_policy The conversion policy of the wide2multibyte specialisation
  *
  * \param stm The stream
  * \param c The converter
@@ -804,12 +1184,13 @@ operator <<(
 template <
     ss_typename_param_k T_stream
 ,   ss_size_t           V_internalSize
+,   ss_typename_param_k T_policy
 >
 inline
 T_stream&
 operator <<(
-    T_stream&                                               stm
-,   STLSOFT_NS_QUAL(wide2multibyte)<V_internalSize> const&  c
+    T_stream&                                                       stm
+,   STLSOFT_NS_QUAL(wide2multibyte)<V_internalSize, T_policy> const&  c
 )
 {
     stm << c.c_str();
@@ -841,26 +1222,28 @@ operator <<(
 # include <iosfwd>
 
 template <
-    STLSOFT_NS_QUAL(ss_size_t) V_internalSize
+    STLSOFT_NS_QUAL(ss_size_t)  V_internalSize
+,   ss_typename_param_k         T_policy
 >
 inline
 STLSOFT_NS_QUAL_STD(basic_ostream)<char>&
 operator <<(
-    STLSOFT_NS_QUAL_STD(basic_ostream)<char>&               stm
-,   STLSOFT_NS_QUAL(wide2multibyte)<V_internalSize> const&  c
+    STLSOFT_NS_QUAL_STD(basic_ostream)<char>&                       stm
+,   STLSOFT_NS_QUAL(wide2multibyte)<V_internalSize, T_policy> const&  c
 )
 {
     return stm << c.c_str();
 }
 
 template <
-    STLSOFT_NS_QUAL(ss_size_t) V_internalSize
+    STLSOFT_NS_QUAL(ss_size_t)  V_internalSize
+,   ss_typename_param_k         T_policy
 >
 inline
 STLSOFT_NS_QUAL_STD(basic_ostream)<wchar_t>&
 operator <<(
-    STLSOFT_NS_QUAL_STD(basic_ostream)<wchar_t>&            stm
-,   STLSOFT_NS_QUAL(multibyte2wide)<V_internalSize> const&  c
+    STLSOFT_NS_QUAL_STD(basic_ostream)<wchar_t>&                    stm
+,   STLSOFT_NS_QUAL(multibyte2wide)<V_internalSize, T_policy> const&  c
 )
 {
     return stm << c.c_str();
@@ -5,11 +5,11 @@
  *          decimal representation.
  *
  * Created: 7th April 2002
- * Updated: 5th November 2024
+ * Updated: 16th October 2026
  *
  * Home:    http://stlsoft.org/
  *
- * Copyright (c) 2019-2024, Matthew Wilson and Synesis Information Systems
+ * Copyright (c) 2019-2026, Matthew Wilson and Synesis Information Systems
  * Copyright (c) 2002-2019, Matthew Wilson and Synesis Software
  * All rights reserved.
  *
@@ -54,9 +54,9 @@
 
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 # define STLSOFT_VER_STLSOFT_CONVERSION_INTEGER_TO_STRING_HPP_INTEGER_TO_DECIMAL_STRING_MAJOR       5
-# define STLSOFT_VER_STLSOFT_CONVERSION_INTEGER_TO_STRING_HPP_INTEGER_TO_DECIMAL_STRING_MINOR       0
-# define STLSOFT_VER_STLSOFT_CONVERSION_INTEGER_TO_STRING_HPP_INTEGER_TO_DECIMAL_STRING_REVISION    20
-# define STLSOFT_VER_STLSOFT_CONVERSION_INTEGER_TO_STRING_HPP_INTEGER_TO_DECIMAL_STRING_EDIT        96
+# define STLSOFT_VER_STLSOFT_CONVERSION_INTEGER_TO_STRING_HPP_INTEGER_TO_DECIMAL_STRING_MINOR       1
+# define STLSOFT_VER_STLSOFT_CONVERSION_INTEGER_TO_STRING_HPP_INTEGER_TO_DECIMAL_STRING_REVISION    0
+# define STLSOFT_VER_STLSOFT_CONVERSION_INTEGER_TO_STRING_HPP_INTEGER_TO_DECIMAL_STRING_EDIT        97
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 
@@ -92,6 +92,9 @@
 #ifndef STLSOFT_INCL_STLSOFT_UTIL_HPP_SIGN_TRAITS
 # include <stlsoft/util/sign_traits.hpp>
 #endif /* !STLSOFT_INCL_STLSOFT_UTIL_HPP_SIGN_TRAITS */
+#ifndef STLSOFT_INCL_STLSOFT_UTIL_INCL_COUNT_DIGITS_H_COUNT_DECIMAL_DIGITS
+# include <stlsoft/util/count_digits/count_decimal_digits.h>
+#endif /* !STLSOFT_INCL_STLSOFT_UTIL_INCL_COUNT_DIGITS_H_COUNT_DECIMAL_DIGITS */
 
 #ifndef STLSOFT_INCL_STLSOFT_QUALITY_H_COVER
 # include <stlsoft/quality/cover.h>
@@ -124,47 +127,35 @@ namespace stlsoft
 
 STLSOFT_OPEN_WORKER_NS_(ximpl_I2S)
 
-/* get subscriptable pointer to array of decimal characters */
+/* get subscriptable pointer to array of the 100 pairs of decimal
+ * characters "00" to "99"
+ */
 template <ss_typename_param_k C>
 inline
 C const*
 #ifdef STLSOFT_CF_TEMPLATE_TYPE_REQUIRED_IN_ARGS
-# define STLSOFT_I2S_D2S_GET_DIGIT_CHARACTER(C) get_decimal_digit_character(static_cast<C*>(0))
-get_decimal_digit_character(C*)
+# define STLSOFT_I2S_D2S_GET_DIGIT_PAIRS(C)     get_decimal_digit_pairs(static_cast<C*>(0))
+get_decimal_digit_pairs(C*)
 #else /* ? STLSOFT_CF_TEMPLATE_TYPE_REQUIRED_IN_ARGS */
-# define STLSOFT_I2S_D2S_GET_DIGIT_CHARACTER(C) get_decimal_digit_character<C>()
-get_decimal_digit_character()
+# define STLSOFT_I2S_D2S_GET_DIGIT_PAIRS(C)     get_decimal_digit_pairs<C>()
+get_decimal_digit_pairs()
 #endif /* STLSOFT_CF_TEMPLATE_TYPE_REQUIRED_IN_ARGS */
 {
-    static C const s_characters[19] =
+    static C const s_pairs[200] =
     {
-            '9'
-        ,   '8'
-        ,   '7'
-        ,   '6'
-        ,   '5'
-        ,   '4'
-        ,   '3'
-        ,   '2'
-        ,   '1'
-        ,   '0'
-        ,   '1'
-        ,   '2'
-        ,   '3'
-        ,   '4'
-        ,   '5'
-        ,   '6'
-        ,   '7'
-        ,   '8'
-        ,   '9'
+            '0', '0', '0', '1', '0', '2', '0', '3', '0', '4', '0', '5', '0', '6', '0', '7', '0', '8', '0', '9'
+        ,   '1', '0', '1', '1', '1', '2', '1', '3', '1', '4', '1', '5', '1', '6', '1', '7', '1', '8', '1', '9'
+        ,   '2', '0', '2', '1', '2', '2', '2', '3', '2', '4', '2', '5', '2', '6', '2', '7', '2', '8', '2', '9'
+        ,   '3', '0', '3', '1', '3', '2', '3', '3', '3', '4', '3', '5', '3', '6', '3', '7', '3', '8', '3', '9'
+        ,   '4', '0', '4', '1', '4', '2', '4', '3', '4', '4', '4', '5', '4', '6', '4', '7', '4', '8', '4', '9'
+        ,   '5', '0', '5', '1', '5', '2', '5', '3', '5', '4', '5', '5', '5', '6', '5', '7', '5', '8', '5', '9'
+        ,   '6', '0', '6', '1', '6', '2', '6', '3', '6', '4', '6', '5', '6', '6', '6', '7', '6', '8', '6', '9'
+        ,   '7', '0', '7', '1', '7', '2', '7', '3', '7', '4', '7', '5', '7', '6', '7', '7', '7', '8', '7', '9'
+        ,   '8', '0', '8', '1', '8', '2', '8', '3', '8', '4', '8', '5', '8', '6', '8', '7', '8', '8', '8', '9'
+        ,   '9', '0', '9', '1', '9', '2', '9', '3', '9', '4', '9', '5', '9', '6', '9', '7', '9', '8', '9', '9'
     };
-#if 0
-    static C const* s_mid = s_characters + 9;
 
-    return s_mid;
-#else /* ? 0 */
-    return s_characters + 9;
-#endif /* 0 */
+    return s_pairs;
 }
 
 /* selector traits class for remainder type */
@@ -178,86 +169,87 @@ struct i2s_decimal_remainder_traits_t
 #endif
 };
 
-/* main conversion function (unsigned) */
+/* writes the decimal digits of i backwards from (but not including) end,
+ * two at a time from the table of digit pairs, returning a pointer to the
+ * first (most significant) digit
+ */
 template<
     ss_typename_param_k I
 ,   ss_typename_param_k C
 >
 inline
-C const*
-unsigned_integer_to_decimal_string(
-    C*          buf
-,   ss_size_t   cchBuf
-,   I /* const& */  i
+C*
+i2s_write_decimal_digits_backwards_(
+    C*  end
+,   I   i
 )
 {
-    STLSOFT_STATIC_ASSERT(0 != stlsoft::is_integral_type<I>::value);
-    STLSOFT_STATIC_ASSERT(0 == stlsoft::is_signed_type<I>::value);
-
     typedef i2s_decimal_remainder_traits_t<I>   remainder_traits_t;
+    typedef ss_typename_type_k remainder_traits_t::remainder_type   remainder_t;
 
-    C* end = buf + (cchBuf - 1);
-
-    // Whichever we do it, we write the nul-terminator (and move down
-    // one)
-    *end-- = '\0';
-
-    STLSOFT_COVER_MARK_LINE();
+    C const* const pairs = STLSOFT_I2S_D2S_GET_DIGIT_PAIRS(C);
 
-    if (0 == i)
+    for (; i >= 100; )
     {
         STLSOFT_COVER_MARK_LINE();
 
-        *end = '0';
+        remainder_t const rem = static_cast<remainder_t>(i % 100);
 
-        STLSOFT_ASSERT(buf <= end);
+        i /= 100;
 
-        return end;
+        end -= 2;
+        end[0] = pairs[2 * rem + 0];
+        end[1] = pairs[2 * rem + 1];
     }
-    else
+
+    if (i >= 10)
     {
         STLSOFT_COVER_MARK_LINE();
 
-#if 1
-        C const* const dchars = STLSOFT_I2S_D2S_GET_DIGIT_CHARACTER(C);
-#endif /* 0 */
+        remainder_t const rem = static_cast<remainder_t>(i);
 
-        C* p = end;
-
-        for (;;)
-        {
-            STLSOFT_COVER_MARK_LINE();
+        end -= 2;
+        end[0] = pairs[2 * rem + 0];
+        end[1] = pairs[2 * rem + 1];
+    }
+    else
+    {
+        STLSOFT_COVER_MARK_LINE();
 
-            ss_typename_type_k remainder_traits_t::remainder_type const rem = i %10;
+        *--end = static_cast<C>('0' + static_cast<remainder_t>(i));
+    }
 
-#if 0
-            *p = STLSOFT_I2S_D2S_GET_DIGIT_CHARACTER(C)[rem];
-#else /* ? 0 */
-            *p = dchars[rem];
-#endif /* 0 */
+    return end;
+}
 
-            i /= 10;
+/* main conversion function (unsigned) */
+template<
+    ss_typename_param_k I
+,   ss_typename_param_k C
+>
+inline
+C const*
+unsigned_integer_to_decimal_string(
+    C*          buf
+,   ss_size_t   cchBuf
+,   I /* const& */  i
+)
+{
+    STLSOFT_STATIC_ASSERT(0 != stlsoft::is_integral_type<I>::value);
+    STLSOFT_STATIC_ASSERT(0 == stlsoft::is_signed_type<I>::value);
 
-            if (0 == i)
-            {
-                STLSOFT_COVER_MARK_LINE();
+    C* const end = buf + (cchBuf - 1);
 
-                break;
-            }
-            else
-            {
-                STLSOFT_COVER_MARK_LINE();
+    // Whichever we do it, we write the nul-terminator
+    *end = '\0';
 
-                --p;
-            }
-        }
+    STLSOFT_COVER_MARK_LINE();
 
-        STLSOFT_COVER_MARK_LINE();
+    C const* const r = i2s_write_decimal_digits_backwards_(end, i);
 
-        STLSOFT_ASSERT(buf <= p);
+    STLSOFT_ASSERT(buf <= r);
 
-        return p;
-    }
+    return r;
 }
 
 /* secondary conversion function (unsigned) that calculates numWritten */
@@ -596,6 +588,124 @@ integer_to_decimal_string_if_signed_(
     return unsigned_integer_to_decimal_string(buf, cchBuf, i);
 }
 
+/* number of decimal digits in i */
+template <ss_typename_param_k I>
+inline
+ss_size_t
+i2s_count_decimal_digits_(
+    I   i
+)
+{
+    STLSOFT_STATIC_ASSERT(0 == stlsoft::is_signed_type<I>::value);
+
+    return (sizeof(I) > sizeof(ss_uint32_t))
+                ? static_cast<ss_size_t>(stlsoft_C_count_decimal_digits_uint64(static_cast<ss_uint64_t>(i)))
+                : static_cast<ss_size_t>(stlsoft_C_count_decimal_digits_uint32(static_cast<ss_uint32_t>(i)));
+}
+
+/* left-aligned conversion function (unsigned) */
+template<
+    ss_typename_param_k I
+,   ss_typename_param_k C
+>
+inline
+ss_size_t
+unsigned_integer_to_decimal_chars(
+    C*          buf
+,   ss_size_t   cchBuf
+,   I           i
+)
+{
+    STLSOFT_STATIC_ASSERT(0 != stlsoft::is_integral_type<I>::value);
+    STLSOFT_STATIC_ASSERT(0 == stlsoft::is_signed_type<I>::value);
+
+    ss_size_t const n = i2s_count_decimal_digits_(i);
+
+    if (n > cchBuf)
+    {
+        return 0;
+    }
+
+    i2s_write_decimal_digits_backwards_(buf + n, i);
+
+    return n;
+}
+
+/* left-aligned conversion function (signed) */
+template<
+    ss_typename_param_k I
+,   ss_typename_param_k C
+>
+inline
+ss_size_t
+signed_integer_to_decimal_chars(
+    C*          buf
+,   ss_size_t   cchBuf
+,   I           i
+)
+{
+    STLSOFT_STATIC_ASSERT(0 != stlsoft::is_integral_type<I>::value);
+    STLSOFT_STATIC_ASSERT(0 != stlsoft::is_signed_type<I>::value);
+
+    typedef ss_typename_type_k sign_traits<I>::unsigned_type    unsigned_t;
+
+    if (i < 0)
+    {
+        // negating in the unsigned type also handles the minimum value
+        unsigned_t const    u   =   static_cast<unsigned_t>(unsigned_t(0) - static_cast<unsigned_t>(i));
+        ss_size_t const     n   =   1 + i2s_count_decimal_digits_(u);
+
+        if (n > cchBuf)
+        {
+            return 0;
+        }
+
+        buf[0] = C('-');
+
+        i2s_write_decimal_digits_backwards_(buf + n, u);
+
+        return n;
+    }
+    else
+    {
+        return unsigned_integer_to_decimal_chars(buf, cchBuf, static_cast<unsigned_t>(i));
+    }
+}
+
+/* TMP compile-time selector of unsigned/signed left-aligned function */
+template<
+    ss_typename_param_k I
+,   ss_typename_param_k C
+>
+inline
+ss_size_t
+integer_to_decimal_chars_if_signed_(
+    yes_type
+,   C*          buf
+,   ss_size_t   cchBuf
+,   I const&    i
+)
+{
+    return signed_integer_to_decimal_chars(buf, cchBuf, i);
+}
+
+/* TMP compile-time selector of unsigned/signed left-aligned function */
+template<
+    ss_typename_param_k I
+,   ss_typename_param_k C
+>
+inline
+ss_size_t
+integer_to_decimal_chars_if_signed_(
+    no_type
+,   C*          buf
+,   ss_size_t   cchBuf
+,   I const&    i
+)
+{
+    return unsigned_integer_to_decimal_chars(buf, cchBuf, i);
+}
+
 STLSOFT_CLOSE_WORKER_NS_(ximpl_I2S)
 
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
@@ -704,6 +814,40 @@ integer_to_decimal_string(
 }
 #endif /* STLSOFT_CF_STATIC_ARRAY_SIZE_DETERMINATION_SUPPORT */
 
+/** Converts an integer value into a decimal string representation at the
+ * start of the given character buffer, without a nul-terminator, as is
+ * useful when appending many values to an output buffer.
+ *
+ * \param buf Pointer to the buffer
+ * \param cchBuf Number of character available in \c buf
+ * \param i The value to be converted to decimal string
+ *
+ * \return The number of characters written, or 0 if \c cchBuf is
+ *   insufficient, in which case nothing is written
+ *
+ * \pre nullptr != buf || 0 == cchBuf
+ */
+template<
+    ss_typename_param_k I
+,   ss_typename_param_k C
+>
+inline
+ss_size_t
+integer_to_decimal_chars(
+    C*          buf
+,   ss_size_t   cchBuf
+,   I const&    i
+)
+{
+    STLSOFT_MESSAGE_STATIC_ASSERT(0 != stlsoft::is_integral_type<I>::value, "value must be an integral type");
+
+    STLSOFT_ASSERT(ss_nullptr_k != buf || 0 == cchBuf);
+
+    typedef ss_typename_type_k is_signed_type<I>::type  signed_yesno_t;
+
+    return STLSOFT_WORKER_NS_QUAL_(ximpl_I2S, integer_to_decimal_chars_if_signed_)(signed_yesno_t(), buf, cchBuf, i);
+}
+
 
 /* /////////////////////////////////////////////////////////////////////////
  * namespace
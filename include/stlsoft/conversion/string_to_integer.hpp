@@ -4,7 +4,7 @@
  * Purpose: String to integer conversions.
  *
  * Created: 18th November 2008
- * Updated: 23rd October 2024
+ * Updated: 16th October 2026
  *
  * Thanks:  Chris Oldwood for righteous criticism of one of my hastily-
  *          written articles, which led to the creation of the
@@ -12,7 +12,7 @@
  *
  * Home:    http://stlsoft.org/
  *
- * Copyright (c) 2019-2024, Matthew Wilson and Synesis Information Systems
+ * Copyright (c) 2019-2026, Matthew Wilson and Synesis Information Systems
  * Copyright (c) 2008-2019, Matthew Wilson and Synesis Software
  * All rights reserved.
  *
@@ -57,9 +57,9 @@
 
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 # define STLSOFT_VER_STLSOFT_CONVERSION_HPP_STRING_TO_INTEGER_MAJOR     3
-# define STLSOFT_VER_STLSOFT_CONVERSION_HPP_STRING_TO_INTEGER_MINOR     0
-# define STLSOFT_VER_STLSOFT_CONVERSION_HPP_STRING_TO_INTEGER_REVISION  2
-# define STLSOFT_VER_STLSOFT_CONVERSION_HPP_STRING_TO_INTEGER_EDIT      74
+# define STLSOFT_VER_STLSOFT_CONVERSION_HPP_STRING_TO_INTEGER_MINOR     1
+# define STLSOFT_VER_STLSOFT_CONVERSION_HPP_STRING_TO_INTEGER_REVISION  1
+# define STLSOFT_VER_STLSOFT_CONVERSION_HPP_STRING_TO_INTEGER_EDIT      76
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 
@@ -74,6 +74,9 @@
 # pragma message(__FILE__)
 #endif /* STLSOFT_TRACE_INCLUDE */
 
+#ifndef STLSOFT_INCL_STLSOFT_LIMITS_H_INTEGRAL_LIMITS
+# include <stlsoft/limits/integral_limits.h>
+#endif /* !STLSOFT_INCL_STLSOFT_LIMITS_H_INTEGRAL_LIMITS */
 #ifndef STLSOFT_INCL_STLSOFT_UTIL_HPP_MINMAX
 # include <stlsoft/util/minmax.hpp>
 #endif /* !STLSOFT_INCL_STLSOFT_UTIL_HPP_MINMAX */
@@ -99,6 +102,32 @@
 # include <ctype.h>
 #endif /* !STLSOFT_INCL_H_CTYPE */
 
+/* SWAR (SIMD-within-a-register) parsing of 8 digits at a time requires
+ * 64-bit integers and a little-endian architecture
+ */
+
+#if !defined(STLSOFT_STRING_TO_INTEGER_NO_USE_SWAR)
+# if defined(STLSOFT_CF_64BIT_INT_SUPPORT) && \
+     (   (   defined(__BYTE_ORDER__) && \
+             defined(__ORDER_LITTLE_ENDIAN__) && \
+             __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) || \
+         defined(_M_IX86) || \
+         defined(_M_X64) || \
+         defined(_M_ARM64))
+#  define STLSOFT_STRING_TO_INTEGER_USE_SWAR_
+# endif
+#endif /* !STLSOFT_STRING_TO_INTEGER_NO_USE_SWAR */
+
+#if defined(STLSOFT_STRING_TO_INTEGER_USE_SWAR_)
+# ifndef STLSOFT_INCL_H_STRING
+#  define STLSOFT_INCL_H_STRING
+#  include <string.h>
+# endif /* !STLSOFT_INCL_H_STRING */
+# ifndef STLSOFT_INCL_STLSOFT_UTIL_BITS_H_TEST_FUNCTIONS
+#  include <stlsoft/util/bits/test_functions.h>
+# endif /* !STLSOFT_INCL_STLSOFT_UTIL_BITS_H_TEST_FUNCTIONS */
+#endif /* STLSOFT_STRING_TO_INTEGER_USE_SWAR_ */
+
 
 /* /////////////////////////////////////////////////////////////////////////
  * namespace
@@ -139,6 +168,121 @@ namespace
 
 struct ximpl_string_to_integer_util_
 {
+#ifdef STLSOFT_STRING_TO_INTEGER_USE_SWAR_
+
+    /// Number of leading characters (0-8) of the 8-byte little-endian
+    /// word \c v that are decimal digits
+    static
+    unsigned
+    swar_count_leading_digits_(
+        ss_uint64_t v
+    )
+    {
+        ss_uint64_t const   lo  =   v & STLSOFT_GEN_UINT64_SUFFIX(0x0f0f0f0f0f0f0f0f);
+        ss_uint64_t const   hi  =   v & STLSOFT_GEN_UINT64_SUFFIX(0xf0f0f0f0f0f0f0f0);
+        // each byte is non-0 iff the corresponding character is not a digit
+        ss_uint64_t const   x   =   (hi ^ STLSOFT_GEN_UINT64_SUFFIX(0x3030303030303030)) | ((lo + STLSOFT_GEN_UINT64_SUFFIX(0x0606060606060606)) & STLSOFT_GEN_UINT64_SUFFIX(0xf0f0f0f0f0f0f0f0));
+        ss_uint64_t const   m   =   (((x & STLSOFT_GEN_UINT64_SUFFIX(0x7f7f7f7f7f7f7f7f)) + STLSOFT_GEN_UINT64_SUFFIX(0x7f7f7f7f7f7f7f7f)) | x) & STLSOFT_GEN_UINT64_SUFFIX(0x8080808080808080);
+
+        // the lowest set byte of m marks the first non-digit; if there is
+        // none, the 64 trailing zeros yield 8
+        return stlsoft_C_count_trailing_zero_bits_in_64bit_unsigned_integer(m) / 8;
+    }
+
+    /// Value of the 8 decimal digits in the little-endian word \c v,
+    /// each byte of which holds a digit value (0-9), with the most
+    /// significant first
+    static
+    ss_uint64_t
+    swar_parse_8_digits_(
+        ss_uint64_t v
+    )
+    {
+        v = (v * 10 + (v >> 8)) & STLSOFT_GEN_UINT64_SUFFIX(0x00ff00ff00ff00ff);
+        v = (v * 100 + (v >> 16)) & STLSOFT_GEN_UINT64_SUFFIX(0x0000ffff0000ffff);
+        v = (v * 10000 + (v >> 32)) & STLSOFT_GEN_UINT64_SUFFIX(0x00000000ffffffff);
+
+        return v;
+    }
+
+    /// Consumes the leading decimal digits of the (multibyte) string, 8
+    /// at a time, accumulating them into \c *result
+    ///
+    /// \note Accumulation is in 64-bit unsigned arithmetic, and so wraps
+    ///   identically to the digit-at-a-time conversion
+    template <ss_typename_param_k I>
+    static
+    void
+    accumulate_digit_blocks_(
+        ss_char_a_t const** ps
+    ,   ss_size_t*          plen
+    ,   I*                  result
+    )
+    {
+        static ss_uint64_t const s_powers[] =
+        {
+                1
+            ,   10
+            ,   100
+            ,   1000
+            ,   10000
+            ,   100000
+            ,   1000000
+            ,   10000000
+            ,   100000000
+        };
+
+        ss_char_a_t const*  s   =   *ps;
+        ss_size_t           len =   *plen;
+        ss_uint64_t         acc =   static_cast<ss_uint64_t>(*result);
+
+        for (; len >= 8; )
+        {
+            STLSOFT_COVER_MARK_LINE();
+
+            ss_uint64_t v;
+
+            ::memcpy(&v, s, sizeof(v));
+
+            unsigned const n = swar_count_leading_digits_(v);
+
+            if (0 != n)
+            {
+                // shift the n digits up to the least significant end of
+                // the number, filling the vacated (most significant)
+                // positions with zeros
+                ss_uint64_t const d = (v & STLSOFT_GEN_UINT64_SUFFIX(0x0f0f0f0f0f0f0f0f)) << (8 * (8 - n));
+
+                acc =   acc * s_powers[n] + swar_parse_8_digits_(d);
+                s   +=  n;
+                len -=  n;
+            }
+
+            if (8 != n)
+            {
+                break;
+            }
+        }
+
+        *result =   static_cast<I>(acc);
+        *ps     =   s;
+        *plen   =   len;
+    }
+#endif /* STLSOFT_STRING_TO_INTEGER_USE_SWAR_ */
+
+    template<
+        ss_typename_param_k I
+    ,   ss_typename_param_k C
+    >
+    static
+    void
+    accumulate_digit_blocks_(
+        C const**   /* ps */
+    ,   ss_size_t*  /* plen */
+    ,   I*          /* result */
+    )
+    {}
+
     template<
         ss_typename_param_k I
     ,   ss_typename_param_k C
@@ -340,6 +484,10 @@ calc:
 
         *result = 0;
 
+        // consume as many digits as possible in blocks, where supported by
+        // the character type, leaving the remainder to the loop
+        accumulate_digit_blocks_(&s, &len, result);
+
         for (; 0 != len; ++s, --len)
         {
             STLSOFT_COVER_MARK_LINE();
@@ -897,6 +1045,72 @@ calc:
             return true;
         }
     }
+
+    template<
+        ss_typename_param_k I
+    ,   ss_typename_param_k C
+    >
+    static
+    ss_size_t
+    parse_integer_sequence_6_(
+        C const*    s
+    ,   ss_size_t   len
+    ,   C           delim
+    ,   I*          values
+    ,   ss_size_t   maxValues
+    ,   C const**   endptr
+    )
+    {
+        STLSOFT_ASSERT(NULL != values || 0 == maxValues);
+
+        C const* const  end =   s + len;
+        ss_size_t       n   =   0;
+
+        for (; n != maxValues && s != end; )
+        {
+            STLSOFT_COVER_MARK_LINE();
+
+            C const* ep;
+
+            if (!string_to_integer_len_5_(s, static_cast<ss_size_t>(end - s), &ep, &values[n], I()))
+            {
+                STLSOFT_COVER_MARK_LINE();
+
+                break;
+            }
+
+            STLSOFT_ASSERT(NULL != ep);
+
+            if (end == ep)
+            {
+                STLSOFT_COVER_MARK_LINE();
+
+                s = ep;
+            }
+            else
+            if (delim == *ep)
+            {
+                STLSOFT_COVER_MARK_LINE();
+
+                s = ep + 1;
+            }
+            else
+            {
+                STLSOFT_COVER_MARK_LINE();
+
+                break;
+            }
+
+            ++n;
+        }
+
+        if (NULL != endptr)
+        {
+            *endptr = s;
+        }
+
+        return n;
+    }
 };
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
@@ -1279,6 +1493,66 @@ try_parse_to(
 }
 
 
+/* parse_integer_sequence(C const*, size_t, C, I*, size_t, C const**) */
+
+/** Parses a sequence of delimited decimal numeric strings into an array of
+ * integers
+ *
+ * Each field - the characters up to the next \c delim or the end of the
+ * buffer - must comprise wholly a number, in the form accepted by
+ * try_parse_to(); a delimiter immediately following the last field is
+ * permitted.
+ *
+ * Some examples:
+<pre>
+  int         values[10];
+  char const* endptr;
+
+  stlsoft::parse_integer_sequence("1,-2,3", 6, ',', values, 10, &endptr); // returns 3; endptr -> ""
+
+  stlsoft::parse_integer_sequence("1,2,x,4", 7, ',', values, 10, &endptr); // returns 2; endptr -> "x,4"
+
+  stlsoft::parse_integer_sequence("1,2,3,4", 7, ',', values, 2, &endptr); // returns 2; endptr -> "3,4"
+</pre>
+ *
+ * \param s Pointer to the buffer. May be \c NULL only if \c len is 0
+ * \param len Number of characters in the buffer
+ * \param delim The delimiter character
+ * \param values Pointer to the array to receive the values
+ * \param maxValues The number of elements in \c values
+ * \param endptr Optional pointer to receive the position at which parsing
+ *   stopped, which is the start of the first field that could not be
+ *   parsed, or the first field not parsed because \c values was full, or
+ *   the end of the buffer
+ *
+ * \return The number of values parsed
+ *
+ * \note For multibyte strings, digits are parsed up to 8 at a time (on
+ *   platforms supporting 64-bit integers). Defining
+ *   \c STLSOFT_STRING_TO_INTEGER_NO_USE_SWAR disables this, for this and
+ *   all the length-limited parsing functions
+ */
+template <
+    ss_typename_param_k I
+,   ss_typename_param_k C
+>
+inline
+ss_size_t
+parse_integer_sequence(
+    C const*        s
+,   ss_size_t       len
+,   C               delim
+,   I*              values
+,   ss_size_t       maxValues
+,   C const**       endptr
+)
+{
+    STLSOFT_COVER_MARK_LINE();
+
+    return ximpl_string_to_integer_util_::parse_integer_sequence_6_(s, len, delim, values, maxValues, endptr);
+}
+
+
 /* /////////////////////////////////////////////////////////////////////////
  * code coverage
  */
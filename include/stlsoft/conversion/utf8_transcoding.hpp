@@ -0,0 +1,1460 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    stlsoft/conversion/utf8_transcoding.hpp
+ *
+ * Purpose: Locale-independent UTF-8 <=> UTF-16/UTF-32 transcoding.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * Home:    http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/** \file stlsoft/conversion/utf8_transcoding.hpp
+ *
+ * \brief [C++] Definition of the stlsoft::utf8_to_wide() and
+ *   stlsoft::wide_to_utf8() function suites, and the
+ *   stlsoft::basic_utf8_decoder and stlsoft::basic_utf8_encoder class
+ *   templates
+ *   (\ref group__library__Conversion "Conversion" Library).
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_CONVERSION_HPP_UTF8_TRANSCODING
+#define STLSOFT_INCL_STLSOFT_CONVERSION_HPP_UTF8_TRANSCODING
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define STLSOFT_VER_STLSOFT_CONVERSION_HPP_UTF8_TRANSCODING_MAJOR      1
+# define STLSOFT_VER_STLSOFT_CONVERSION_HPP_UTF8_TRANSCODING_MINOR      0
+# define STLSOFT_VER_STLSOFT_CONVERSION_HPP_UTF8_TRANSCODING_REVISION   0
+# define STLSOFT_VER_STLSOFT_CONVERSION_HPP_UTF8_TRANSCODING_EDIT       1
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_H_STLSOFT
+# include <stlsoft/stlsoft.h>
+#endif /* !STLSOFT_INCL_STLSOFT_H_STLSOFT */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#if !defined(STLSOFT_CONVERSION_UTF8_TRANSCODING_NO_USE_SIMD)
+# if defined(__AVX2__)
+#  define STLSOFT_CONVERSION_UTF8_TRANSCODING_USE_AVX2_
+# endif
+# if defined(__SSE2__) || \
+     defined(_M_X64) || \
+     (   defined(_M_IX86_FP) && \
+         _M_IX86_FP >= 2)
+#  define STLSOFT_CONVERSION_UTF8_TRANSCODING_USE_SSE2_
+# endif
+#endif /* !STLSOFT_CONVERSION_UTF8_TRANSCODING_NO_USE_SIMD */
+
+#if defined(STLSOFT_CONVERSION_UTF8_TRANSCODING_USE_AVX2_)
+# include <immintrin.h>
+#elif defined(STLSOFT_CONVERSION_UTF8_TRANSCODING_USE_SSE2_)
+# include <emmintrin.h>
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef STLSOFT_NO_NAMESPACE
+namespace stlsoft
+{
+#endif /* STLSOFT_NO_NAMESPACE */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions
+ */
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+namespace ximpl_utf8_transcoding {
+
+    enum status_type
+    {
+            status_ok           //!< All input consumed
+        ,   status_truncated    //!< Destination exhausted
+        ,   status_ill_formed   //!< Ill-formed input
+        ,   status_incomplete   //!< Input ends within a well-formed prefix
+    };
+
+    inline
+    ss_size_t
+    minimum_(
+        ss_size_t   n1
+    ,   ss_size_t   n2
+    ) STLSOFT_NOEXCEPT
+    {
+        return (n1 < n2) ? n1 : n2;
+    }
+
+    /* Decodes the (non-ASCII) UTF-8 sequence starting at p, returning its
+     * length (2-4), 0 if it is ill-formed (including overlong forms,
+     * surrogates, and values above U+10FFFF), or -1 if the input ends
+     * before a well-formed prefix is complete, as per Table 3-7 of the
+     * Unicode Standard
+     */
+    inline
+    int
+    decode_sequence(
+        ss_uint8_t const*   p
+    ,   ss_uint8_t const*   end
+    ,   ss_uint32_t*        pt
+    ) STLSOFT_NOEXCEPT
+    {
+        ss_uint32_t const   b0  =   p[0];
+        ss_size_t const     n   =   static_cast<ss_size_t>(end - p);
+        int                 len;
+        ss_uint32_t         lo  =   0x80;
+        ss_uint32_t         hi  =   0xBF;
+        ss_uint32_t         v;
+
+        STLSOFT_ASSERT(b0 >= 0x80);
+
+        if (b0 < 0xC2)
+        {
+            // continuation byte, or lead of an overlong 2-byte form
+
+            return 0;
+        }
+        else if (b0 < 0xE0)
+        {
+            len =   2;
+            v   =   b0 & 0x1F;
+        }
+        else if (b0 < 0xF0)
+        {
+            // the range of the second byte excludes overlong forms (after
+            // E0) and surrogates (after ED)
+            len =   3;
+            v   =   b0 & 0x0F;
+            lo  =   (0xE0 == b0) ? 0xA0 : 0x80;
+            hi  =   (0xED == b0) ? 0x9F : 0xBF;
+        }
+        else if (b0 < 0xF5)
+        {
+            // the range of the second byte excludes overlong forms (after
+            // F0) and values above U+10FFFF (after F4)
+            len =   4;
+            v   =   b0 & 0x07;
+            lo  =   (0xF0 == b0) ? 0x90 : 0x80;
+            hi  =   (0xF4 == b0) ? 0x8F : 0xBF;
+        }
+        else
+        {
+            return 0;
+        }
+
+        { for (int i = 1; i != len; ++i, lo = 0x80, hi = 0xBF)
+        {
+            if (static_cast<ss_size_t>(i) == n)
+            {
+                return -1;
+            }
+
+            ss_uint32_t const b = p[i];
+
+            if (b < lo ||
+                b > hi)
+            {
+                return 0;
+            }
+
+            v = (v << 6) | (b & 0x3F);
+        }}
+
+        *pt = v;
+
+        return len;
+    }
+
+    /* Writes the code point v as one (UTF-32, or UTF-16 in the BMP) or two
+     * (UTF-16 surrogate pair) units, returning the number written
+     */
+    template <ss_typename_param_k T_wide>
+    inline
+    ss_size_t
+    put_point(
+        ss_uint32_t v
+    ,   T_wide*     dest
+    ) STLSOFT_NOEXCEPT
+    {
+        if (2 == sizeof(T_wide) &&
+            v >= 0x10000)
+        {
+            v -= 0x10000;
+
+            dest[0] = static_cast<T_wide>(0xD800 + (v >> 10));
+            dest[1] = static_cast<T_wide>(0xDC00 + (v & 0x3FF));
+
+            return 2;
+        }
+        else
+        {
+            dest[0] = static_cast<T_wide>(v);
+
+            return 1;
+        }
+    }
+
+    /* Reads the code point starting at p, returning the number of units
+     * (1 or 2) consumed, 0 if ill-formed (unpaired surrogate, or value
+     * above U+10FFFF), or -1 if the input ends with a high surrogate
+     */
+    template <ss_typename_param_k T_wide>
+    inline
+    int
+    get_point(
+        T_wide const*   p
+    ,   T_wide const*   end
+    ,   ss_uint32_t*    pt
+    ) STLSOFT_NOEXCEPT
+    {
+        ss_uint32_t const v = (2 == sizeof(T_wide)) ? static_cast<ss_uint16_t>(p[0]) : static_cast<ss_uint32_t>(p[0]);
+
+        if (v - 0xD800u < 0x800u)
+        {
+            if (2 == sizeof(T_wide) &&
+                v < 0xDC00u)
+            {
+                if (p + 1 == end)
+                {
+                    return -1;
+                }
+
+                ss_uint32_t const v2 = static_cast<ss_uint16_t>(p[1]);
+
+                if (v2 - 0xDC00u < 0x400u)
+                {
+                    *pt = 0x10000 + ((v - 0xD800) << 10) + (v2 - 0xDC00);
+
+                    return 2;
+                }
+            }
+
+            return 0;
+        }
+        else if (v > 0x10FFFF)
+        {
+            return 0;
+        }
+        else
+        {
+            *pt = v;
+
+            return 1;
+        }
+    }
+
+    inline
+    ss_size_t
+    utf8_length_of(
+        ss_uint32_t v
+    ) STLSOFT_NOEXCEPT
+    {
+        return (v < 0x80) ? 1 : (v < 0x800) ? 2 : (v < 0x10000) ? 3 : 4;
+    }
+
+    inline
+    ss_size_t
+    put_utf8(
+        ss_uint32_t v
+    ,   ss_uint8_t* dest
+    ) STLSOFT_NOEXCEPT
+    {
+        if (v < 0x80)
+        {
+            dest[0] = static_cast<ss_uint8_t>(v);
+
+            return 1;
+        }
+        else if (v < 0x800)
+        {
+            dest[0] = static_cast<ss_uint8_t>(0xC0 | (v >> 6));
+            dest[1] = static_cast<ss_uint8_t>(0x80 | (v & 0x3F));
+
+            return 2;
+        }
+        else if (v < 0x10000)
+        {
+            dest[0] = static_cast<ss_uint8_t>(0xE0 | (v >> 12));
+            dest[1] = static_cast<ss_uint8_t>(0x80 | ((v >> 6) & 0x3F));
+            dest[2] = static_cast<ss_uint8_t>(0x80 | (v & 0x3F));
+
+            return 3;
+        }
+        else
+        {
+            dest[0] = static_cast<ss_uint8_t>(0xF0 | (v >> 18));
+            dest[1] = static_cast<ss_uint8_t>(0x80 | ((v >> 12) & 0x3F));
+            dest[2] = static_cast<ss_uint8_t>(0x80 | ((v >> 6) & 0x3F));
+            dest[3] = static_cast<ss_uint8_t>(0x80 | (v & 0x3F));
+
+            return 4;
+        }
+    }
+
+    /* Returns the length of the run of ASCII bytes starting at s, up to a
+     * maximum of n
+     */
+    inline
+    ss_size_t
+    count_ascii(
+        ss_uint8_t const*   s
+    ,   ss_size_t           n
+    ) STLSOFT_NOEXCEPT
+    {
+        ss_uint8_t const* const begin = s;
+
+#if defined(STLSOFT_CONVERSION_UTF8_TRANSCODING_USE_AVX2_)
+
+        for (; n >= 32; n -= 32, s += 32)
+        {
+            __m256i const v = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(s));
+
+            if (0 != _mm256_movemask_epi8(v))
+            {
+                break;
+            }
+        }
+#endif
+#if defined(STLSOFT_CONVERSION_UTF8_TRANSCODING_USE_SSE2_)
+
+        for (; n >= 16; n -= 16, s += 16)
+        {
+            __m128i const v = _mm_loadu_si128(reinterpret_cast<__m128i const*>(s));
+
+            if (0 != _mm_movemask_epi8(v))
+            {
+                break;
+            }
+        }
+#endif
+
+        for (; 0 != n && *s < 0x80; --n, ++s)
+        {}
+
+        return static_cast<ss_size_t>(s - begin);
+    }
+
+    /* Returns the length of the run of ASCII units starting at s, up to a
+     * maximum of n
+     */
+    template <ss_typename_param_k T_wide>
+    inline
+    ss_size_t
+    count_ascii(
+        T_wide const*   s
+    ,   ss_size_t       n
+    ) STLSOFT_NOEXCEPT
+    {
+        T_wide const* const begin = s;
+
+#if defined(STLSOFT_CONVERSION_UTF8_TRANSCODING_USE_SSE2_)
+
+        __m128i const zero = _mm_setzero_si128();
+
+        for (; n >= 16; n -= 16, s += 16)
+        {
+            __m128i const* const    p   =   reinterpret_cast<__m128i const*>(s);
+            __m128i                 v   =   _mm_or_si128(_mm_loadu_si128(p + 0), _mm_loadu_si128(p + 1));
+
+            if (2 == sizeof(T_wide))
+            {
+                v = _mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16(-0x80)), zero);
+            }
+            else
+            {
+                v = _mm_or_si128(v, _mm_or_si128(_mm_loadu_si128(p + 2), _mm_loadu_si128(p + 3)));
+                v = _mm_cmpeq_epi32(_mm_and_si128(v, _mm_set1_epi32(-0x80)), zero);
+            }
+
+            if (0xFFFF != _mm_movemask_epi8(v))
+            {
+                break;
+            }
+        }
+#endif
+
+        for (; 0 != n; --n, ++s)
+        {
+            ss_uint32_t const v = (2 == sizeof(T_wide)) ? static_cast<ss_uint16_t>(*s) : static_cast<ss_uint32_t>(*s);
+
+            if (v >= 0x80)
+            {
+                break;
+            }
+        }
+
+        return static_cast<ss_size_t>(s - begin);
+    }
+
+    /* Copies the run of ASCII bytes starting at s, up to a maximum of n,
+     * into dest, widening each to a UTF-16/UTF-32 unit, and returns its
+     * length
+     */
+    template <ss_typename_param_k T_wide>
+    inline
+    ss_size_t
+    widen_ascii(
+        ss_uint8_t const*   s
+    ,   ss_size_t           n
+    ,   T_wide*             dest
+    ) STLSOFT_NOEXCEPT
+    {
+        ss_uint8_t const* const begin = s;
+
+#if defined(STLSOFT_CONVERSION_UTF8_TRANSCODING_USE_AVX2_)
+
+        for (; n >= 32; n -= 32, s += 32, dest += 32)
+        {
+            __m256i const v = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(s));
+
+            if (0 != _mm256_movemask_epi8(v))
+            {
+                break;
+            }
+
+            __m128i const   lo  =   _mm256_castsi256_si128(v);
+            __m128i const   hi  =   _mm256_extracti128_si256(v, 1);
+            __m256i*        d   =   reinterpret_cast<__m256i*>(dest);
+
+            if (2 == sizeof(T_wide))
+            {
+                _mm256_storeu_si256(d + 0, _mm256_cvtepu8_epi16(lo));
+                _mm256_storeu_si256(d + 1, _mm256_cvtepu8_epi16(hi));
+            }
+            else
+            {
+                _mm256_storeu_si256(d + 0, _mm256_cvtepu8_epi32(lo));
+                _mm256_storeu_si256(d + 1, _mm256_cvtepu8_epi32(_mm_srli_si128(lo, 8)));
+                _mm256_storeu_si256(d + 2, _mm256_cvtepu8_epi32(hi));
+                _mm256_storeu_si256(d + 3, _mm256_cvtepu8_epi32(_mm_srli_si128(hi, 8)));
+            }
+        }
+#endif
+#if defined(STLSOFT_CONVERSION_UTF8_TRANSCODING_USE_SSE2_)
+
+        __m128i const zero = _mm_setzero_si128();
+
+        for (; n >= 16; n -= 16, s += 16, dest += 16)
+        {
+            __m128i const v = _mm_loadu_si128(reinterpret_cast<__m128i const*>(s));
+
+            if (0 != _mm_movemask_epi8(v))
+            {
+                break;
+            }
+
+            __m128i const   lo  =   _mm_unpacklo_epi8(v, zero);
+            __m128i const   hi  =   _mm_unpackhi_epi8(v, zero);
+            __m128i*        d   =   reinterpret_cast<__m128i*>(dest);
+
+            if (2 == sizeof(T_wide))
+            {
+                _mm_storeu_si128(d + 0, lo);
+                _mm_storeu_si128(d + 1, hi);
+            }
+            else
+            {
+                _mm_storeu_si128(d + 0, _mm_unpacklo_epi16(lo, zero));
+                _mm_storeu_si128(d + 1, _mm_unpackhi_epi16(lo, zero));
+                _mm_storeu_si128(d + 2, _mm_unpacklo_epi16(hi, zero));
+                _mm_storeu_si128(d + 3, _mm_unpackhi_epi16(hi, zero));
+            }
+        }
+#endif
+
+        for (; 0 != n && *s < 0x80; --n, ++s, ++dest)
+        {
+            *dest = static_cast<T_wide>(*s);
+        }
+
+        return static_cast<ss_size_t>(s - begin);
+    }
+
+    /* Copies the run of ASCII units starting at s, up to a maximum of n,
+     * into dest, narrowing each to a byte, and returns its length
+     */
+    template <ss_typename_param_k T_wide>
+    inline
+    ss_size_t
+    narrow_ascii(
+        T_wide const*   s
+    ,   ss_size_t       n
+    ,   ss_uint8_t*     dest
+    ) STLSOFT_NOEXCEPT
+    {
+        T_wide const* const begin = s;
+
+#if defined(STLSOFT_CONVERSION_UTF8_TRANSCODING_USE_SSE2_)
+
+        __m128i const zero = _mm_setzero_si128();
+
+        for (; n >= 16; n -= 16, s += 16, dest += 16)
+        {
+            __m128i const*  p   =   reinterpret_cast<__m128i const*>(s);
+            __m128i         packed;
+
+            if (2 == sizeof(T_wide))
+            {
+                __m128i const   v0  =   _mm_loadu_si128(p + 0);
+                __m128i const   v1  =   _mm_loadu_si128(p + 1);
+                __m128i const   hi  =   _mm_and_si128(_mm_or_si128(v0, v1), _mm_set1_epi16(-0x80));
+
+                if (0xFFFF != _mm_movemask_epi8(_mm_cmpeq_epi16(hi, zero)))
+                {
+                    break;
+                }
+
+                packed = _mm_packus_epi16(v0, v1);
+            }
+            else
+            {
+                __m128i const   v0  =   _mm_loadu_si128(p + 0);
+                __m128i const   v1  =   _mm_loadu_si128(p + 1);
+                __m128i const   v2  =   _mm_loadu_si128(p + 2);
+                __m128i const   v3  =   _mm_loadu_si128(p + 3);
+                __m128i const   hi  =   _mm_and_si128(_mm_or_si128(_mm_or_si128(v0, v1), _mm_or_si128(v2, v3)), _mm_set1_epi32(-0x80));
+
+                if (0xFFFF != _mm_movemask_epi8(_mm_cmpeq_epi32(hi, zero)))
+                {
+                    break;
+                }
+
+                packed = _mm_packus_epi16(_mm_packs_epi32(v0, v1), _mm_packs_epi32(v2, v3));
+            }
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dest), packed);
+        }
+#endif
+
+        for (; 0 != n; --n, ++s, ++dest)
+        {
+            ss_uint32_t const v = (2 == sizeof(T_wide)) ? static_cast<ss_uint16_t>(*s) : static_cast<ss_uint32_t>(*s);
+
+            if (v >= 0x80)
+            {
+                break;
+            }
+
+            *dest = static_cast<ss_uint8_t>(v);
+        }
+
+        return static_cast<ss_size_t>(s - begin);
+    }
+
+    /* Transcodes UTF-8 to UTF-16/UTF-32, stopping before the first
+     * ill-formed or incomplete sequence, or the first code point that
+     * will not fit in the destination
+     */
+    template <ss_typename_param_k T_wide>
+    inline
+    status_type
+    utf8_to_wide(
+        ss_uint8_t const*   s
+    ,   ss_size_t           cch
+    ,   T_wide*             dest
+    ,   ss_size_t           cchDest
+    ,   ss_size_t*          numRead
+    ,   ss_size_t*          numWritten
+    ) STLSOFT_NOEXCEPT
+    {
+        ss_uint8_t const* const begin       =   s;
+        ss_uint8_t const* const end         =   s + cch;
+        T_wide* const           destBegin   =   dest;
+        T_wide* const           destEnd     =   dest + cchDest;
+        status_type             status      =   status_ok;
+
+        for (; end != s; )
+        {
+            if (*s < 0x80)
+            {
+                ss_size_t const n = widen_ascii(s, minimum_(static_cast<ss_size_t>(end - s), static_cast<ss_size_t>(destEnd - dest)), dest);
+
+                s       +=  n;
+                dest    +=  n;
+
+                if (0 == n)
+                {
+                    status = status_truncated;
+
+                    break;
+                }
+            }
+            else
+            {
+                ss_uint32_t v = 0;
+                int const   r = decode_sequence(s, end, &v);
+
+                if (r <= 0)
+                {
+                    status = (0 == r) ? status_ill_formed : status_incomplete;
+
+                    break;
+                }
+
+                if (destEnd - dest < ((2 == sizeof(T_wide) && 4 == r) ? 2 : 1))
+                {
+                    status = status_truncated;
+
+                    break;
+                }
+
+                s       +=  r;
+                dest    +=  put_point(v, dest);
+            }
+        }
+
+        *numRead    =   static_cast<ss_size_t>(s - begin);
+        *numWritten =   static_cast<ss_size_t>(dest - destBegin);
+
+        return status;
+    }
+
+    /* Transcodes UTF-16/UTF-32 to UTF-8, stopping before the first
+     * ill-formed or incomplete code point, or the first that will not fit
+     * in the destination
+     */
+    template <ss_typename_param_k T_wide>
+    inline
+    status_type
+    wide_to_utf8(
+        T_wide const*       s
+    ,   ss_size_t           cch
+    ,   ss_uint8_t*         dest
+    ,   ss_size_t           cchDest
+    ,   ss_size_t*          numRead
+    ,   ss_size_t*          numWritten
+    ) STLSOFT_NOEXCEPT
+    {
+        T_wide const* const     begin       =   s;
+        T_wide const* const     end         =   s + cch;
+        ss_uint8_t* const       destBegin   =   dest;
+        ss_uint8_t* const       destEnd     =   dest + cchDest;
+        status_type             status      =   status_ok;
+
+        for (; end != s; )
+        {
+            ss_size_t const n = narrow_ascii(s, minimum_(static_cast<ss_size_t>(end - s), static_cast<ss_size_t>(destEnd - dest)), dest);
+
+            s       +=  n;
+            dest    +=  n;
+
+            if (end == s)
+            {
+                break;
+            }
+            if (destEnd == dest)
+            {
+                status = status_truncated;
+
+                break;
+            }
+
+            ss_uint32_t v = 0;
+            int const   r = get_point(s, end, &v);
+
+            if (r <= 0)
+            {
+                status = (0 == r) ? status_ill_formed : status_incomplete;
+
+                break;
+            }
+
+            if (static_cast<ss_size_t>(destEnd - dest) < utf8_length_of(v))
+            {
+                status = status_truncated;
+
+                break;
+            }
+
+            s       +=  r;
+            dest    +=  put_utf8(v, dest);
+        }
+
+        *numRead    =   static_cast<ss_size_t>(s - begin);
+        *numWritten =   static_cast<ss_size_t>(dest - destBegin);
+
+        return status;
+    }
+
+    inline
+    ss_size_t
+    utf8_to_wide_length(
+        ss_uint8_t const*   s
+    ,   ss_size_t           cch
+    ,   ss_size_t           unitSize
+    ,   ss_size_t*          errorPosition
+    ) STLSOFT_NOEXCEPT
+    {
+        ss_uint8_t const* const begin   =   s;
+        ss_uint8_t const* const end     =   s + cch;
+        ss_size_t               n       =   0;
+
+        for (; end != s; )
+        {
+            if (*s < 0x80)
+            {
+                ss_size_t const r = count_ascii(s, static_cast<ss_size_t>(end - s));
+
+                s   +=  r;
+                n   +=  r;
+            }
+            else
+            {
+                ss_uint32_t v = 0;
+                int const   r = decode_sequence(s, end, &v);
+
+                if (r <= 0)
+                {
+                    if (NULL != errorPosition)
+                    {
+                        *errorPosition = static_cast<ss_size_t>(s - begin);
+                    }
+
+                    return static_cast<ss_size_t>(-1);
+                }
+
+                s   +=  r;
+                n   +=  (2 == unitSize && 4 == r) ? 2 : 1;
+            }
+        }
+
+        return n;
+    }
+} /* namespace ximpl_utf8_transcoding */
+
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * functions
+ */
+
+/** Validates a UTF-8 string, and calculates the number of UTF-16 units
+ * required to represent it.
+ *
+ * \ingroup group__library__Conversion
+ *
+ * \param s The UTF-8 string. May be <code>NULL</code> only if
+ *   <code>cch</code> is 0
+ * \param cch The number of bytes in <code>s</code>
+ * \param errorPosition Optional pointer to a variable that will receive
+ *   the offset of the first ill-formed or incomplete sequence. May be
+ *   <code>NULL</code>
+ *
+ * \return The number of UTF-16 units, or <code>(ss_size_t)-1</code> if
+ *   the string is not well-formed
+ */
+inline
+ss_size_t
+utf8_to_utf16_length(
+    ss_char_a_t const*  s
+,   ss_size_t           cch
+,   ss_size_t*          errorPosition
+) STLSOFT_NOEXCEPT
+{
+    return ximpl_utf8_transcoding::utf8_to_wide_length(reinterpret_cast<ss_uint8_t const*>(s), cch, 2, errorPosition);
+}
+
+/** Validates a UTF-8 string, and calculates the number of UTF-32 units -
+ * i.e. code points - required to represent it.
+ *
+ * \ingroup group__library__Conversion
+ *
+ * \param s The UTF-8 string. May be <code>NULL</code> only if
+ *   <code>cch</code> is 0
+ * \param cch The number of bytes in <code>s</code>
+ * \param errorPosition Optional pointer to a variable that will receive
+ *   the offset of the first ill-formed or incomplete sequence. May be
+ *   <code>NULL</code>
+ *
+ * \return The number of UTF-32 units, or <code>(ss_size_t)-1</code> if
+ *   the string is not well-formed
+ */
+inline
+ss_size_t
+utf8_to_utf32_length(
+    ss_char_a_t const*  s
+,   ss_size_t           cch
+,   ss_size_t*          errorPosition
+) STLSOFT_NOEXCEPT
+{
+    return ximpl_utf8_transcoding::utf8_to_wide_length(reinterpret_cast<ss_uint8_t const*>(s), cch, 4, errorPosition);
+}
+
+/** Validates a UTF-8 string, and calculates the number of
+ * <code>wchar_t</code> units required to represent it.
+ *
+ * \ingroup group__library__Conversion
+ *
+ * \see stlsoft::utf8_to_utf16_length(), stlsoft::utf8_to_utf32_length()
+ */
+inline
+ss_size_t
+utf8_to_wide_length(
+    ss_char_a_t const*  s
+,   ss_size_t           cch
+,   ss_size_t*          errorPosition
+) STLSOFT_NOEXCEPT
+{
+    return ximpl_utf8_transcoding::utf8_to_wide_length(reinterpret_cast<ss_uint8_t const*>(s), cch, sizeof(ss_char_w_t), errorPosition);
+}
+
+/** Transcodes a UTF-8 string to UTF-16 or UTF-32, according to the size
+ * of the destination character type.
+ *
+ * \ingroup group__library__Conversion
+ *
+ * Conversion stops at the first ill-formed or incomplete sequence, or at
+ * the first code point that will not fit in the destination: no more than
+ * <code>cch</code> units are required.
+ *
+ * \param s The UTF-8 string. May be <code>NULL</code> only if
+ *   <code>cch</code> is 0
+ * \param cch The number of bytes in <code>s</code>
+ * \param dest The destination buffer
+ * \param cchDest The number of units available in <code>dest</code>
+ * \param numRead Optional pointer to a variable that will receive the
+ *   number of bytes consumed, which will be less than <code>cch</code> if
+ *   <code>dest</code> is too small. May be <code>NULL</code>
+ * \param errorPosition Optional pointer to a variable that will receive
+ *   the offset of the first ill-formed or incomplete sequence. May be
+ *   <code>NULL</code>
+ *
+ * \return The number of units written (without a nul-terminator), or
+ *   <code>(ss_size_t)-1</code> if the string is not well-formed
+ */
+template <ss_typename_param_k T_wide>
+inline
+ss_size_t
+utf8_to_wide(
+    ss_char_a_t const*  s
+,   ss_size_t           cch
+,   T_wide*             dest
+,   ss_size_t           cchDest
+,   ss_size_t*          numRead
+,   ss_size_t*          errorPosition
+) STLSOFT_NOEXCEPT
+{
+    STLSOFT_STATIC_ASSERT(2 == sizeof(T_wide) || 4 == sizeof(T_wide));
+
+    ss_size_t   nr;
+    ss_size_t   nw;
+
+    switch (ximpl_utf8_transcoding::utf8_to_wide(reinterpret_cast<ss_uint8_t const*>(s), cch, dest, cchDest, &nr, &nw))
+    {
+    case    ximpl_utf8_transcoding::status_ill_formed:
+    case    ximpl_utf8_transcoding::status_incomplete:
+
+        if (NULL != errorPosition)
+        {
+            *errorPosition = nr;
+        }
+
+        return static_cast<ss_size_t>(-1);
+    default:
+
+        if (NULL != numRead)
+        {
+            *numRead = nr;
+        }
+
+        return nw;
+    }
+}
+
+/** Validates a UTF-16 or UTF-32 string, according to the size of the
+ * character type, and calculates the number of bytes required to
+ * represent it in UTF-8.
+ *
+ * \ingroup group__library__Conversion
+ *
+ * \param s The UTF-16/UTF-32 string. May be <code>NULL</code> only if
+ *   <code>cch</code> is 0
+ * \param cch The number of units in <code>s</code>
+ * \param errorPosition Optional pointer to a variable that will receive
+ *   the offset of the first unpaired surrogate or out-of-range value. May
+ *   be <code>NULL</code>
+ *
+ * \return The number of bytes, or <code>(ss_size_t)-1</code> if the
+ *   string is not well-formed
+ */
+template <ss_typename_param_k T_wide>
+inline
+ss_size_t
+wide_to_utf8_length(
+    T_wide const*   s
+,   ss_size_t       cch
+,   ss_size_t*      errorPosition
+) STLSOFT_NOEXCEPT
+{
+    STLSOFT_STATIC_ASSERT(2 == sizeof(T_wide) || 4 == sizeof(T_wide));
+
+    T_wide const* const begin   =   s;
+    T_wide const* const end     =   s + cch;
+    ss_size_t           n       =   0;
+
+    for (; end != s; )
+    {
+        ss_size_t const a = ximpl_utf8_transcoding::count_ascii(s, static_cast<ss_size_t>(end - s));
+
+        s   +=  a;
+        n   +=  a;
+
+        if (end == s)
+        {
+            break;
+        }
+
+        ss_uint32_t v = 0;
+        int const   r = ximpl_utf8_transcoding::get_point(s, end, &v);
+
+        if (r <= 0)
+        {
+            if (NULL != errorPosition)
+            {
+                *errorPosition = static_cast<ss_size_t>(s - begin);
+            }
+
+            return static_cast<ss_size_t>(-1);
+        }
+
+        s   +=  r;
+        n   +=  ximpl_utf8_transcoding::utf8_length_of(v);
+    }
+
+    return n;
+}
+
+/** Transcodes a UTF-16 or UTF-32 string, according to the size of the
+ * character type, to UTF-8.
+ *
+ * \ingroup group__library__Conversion
+ *
+ * Conversion stops at the first unpaired surrogate or out-of-range value,
+ * or at the first code point that will not fit in the destination: no
+ * more than <code>3 * cch</code> bytes are required for UTF-16, and
+ * <code>4 * cch</code> for UTF-32.
+ *
+ * \param s The UTF-16/UTF-32 string. May be <code>NULL</code> only if
+ *   <code>cch</code> is 0
+ * \param cch The number of units in <code>s</code>
+ * \param dest The destination buffer
+ * \param cchDest The number of bytes available in <code>dest</code>
+ * \param numRead Optional pointer to a variable that will receive the
+ *   number of units consumed, which will be less than <code>cch</code> if
+ *   <code>dest</code> is too small. May be <code>NULL</code>
+ * \param errorPosition Optional pointer to a variable that will receive
+ *   the offset of the first unpaired surrogate or out-of-range value. May
+ *   be <code>NULL</code>
+ *
+ * \return The number of bytes written (without a nul-terminator), or
+ *   <code>(ss_size_t)-1</code> if the string is not well-formed
+ */
+template <ss_typename_param_k T_wide>
+inline
+ss_size_t
+wide_to_utf8(
+    T_wide const*   s
+,   ss_size_t       cch
+,   ss_char_a_t*    dest
+,   ss_size_t       cchDest
+,   ss_size_t*      numRead
+,   ss_size_t*      errorPosition
+) STLSOFT_NOEXCEPT
+{
+    STLSOFT_STATIC_ASSERT(2 == sizeof(T_wide) || 4 == sizeof(T_wide));
+
+    ss_size_t   nr;
+    ss_size_t   nw;
+
+    switch (ximpl_utf8_transcoding::wide_to_utf8(s, cch, reinterpret_cast<ss_uint8_t*>(dest), cchDest, &nr, &nw))
+    {
+    case    ximpl_utf8_transcoding::status_ill_formed:
+    case    ximpl_utf8_transcoding::status_incomplete:
+
+        if (NULL != errorPosition)
+        {
+            *errorPosition = nr;
+        }
+
+        return static_cast<ss_size_t>(-1);
+    default:
+
+        if (NULL != numRead)
+        {
+            *numRead = nr;
+        }
+
+        return nw;
+    }
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * classes
+ */
+
+/** Streaming UTF-8 to UTF-16/UTF-32 decoder, which accepts its input in
+ * arbitrarily-sized chunks, carrying any sequence that is split between
+ * chunks over to the next.
+ *
+ * \ingroup group__library__Conversion
+ *
+ * \tparam T_wide The destination character type, whose size (2 or 4)
+ *   determines whether UTF-16 or UTF-32 is produced
+ */
+template <ss_typename_param_k T_wide>
+class basic_utf8_decoder
+{
+public: // types
+    /// The destination character type
+    typedef T_wide                                          char_type;
+    /// The size type
+    typedef ss_size_t                                       size_type;
+    /// This type
+    typedef basic_utf8_decoder<T_wide>                      class_type;
+
+public: // construction
+    basic_utf8_decoder() STLSOFT_NOEXCEPT
+        : m_numPending(0)
+        , m_position(0)
+        , m_errorPosition(0)
+        , m_failed(false)
+    {}
+
+    /// Returns the decoder to its initial state
+    void reset() STLSOFT_NOEXCEPT
+    {
+        m_numPending    =   0;
+        m_position      =   0;
+        m_errorPosition =   0;
+        m_failed        =   false;
+    }
+
+public: // operations
+    /// The number of units that <code>decode()</code> may write for a
+    /// chunk of the given number of bytes
+    static size_type max_output_length(size_type cch) STLSOFT_NOEXCEPT
+    {
+        // a pending sequence can be completed by a single byte, and
+        // yield a surrogate pair
+        return cch + 1;
+    }
+
+    /// Decodes the next chunk of input
+    ///
+    /// \param s The chunk. May be <code>NULL</code> only if
+    ///   <code>cch</code> is 0
+    /// \param cch The number of bytes in <code>s</code>
+    /// \param dest The destination buffer
+    /// \param cchDest The number of units available in <code>dest</code>,
+    ///   which must be at least <code>max_output_length(cch)</code>
+    ///
+    /// \return The number of units written, or <code>(size_type)-1</code>
+    ///   if the input is ill-formed - in which case
+    ///   <code>error_position()</code> reports the offset, from the start
+    ///   of the stream, of the ill-formed sequence, and all subsequent
+    ///   calls fail until <code>reset()</code> is called - or if
+    ///   <code>cchDest</code> is insufficient
+    size_type decode(ss_char_a_t const* s, size_type cch, char_type* dest, size_type cchDest) STLSOFT_NOEXCEPT
+    {
+        STLSOFT_MESSAGE_ASSERT("destination too small", cchDest >= max_output_length(cch));
+
+        if (m_failed ||
+            cchDest < max_output_length(cch))
+        {
+            return static_cast<size_type>(-1);
+        }
+
+        ss_uint8_t const*   p   =   reinterpret_cast<ss_uint8_t const*>(s);
+        size_type           n   =   0;
+
+        if (0 != m_numPending)
+        {
+            ss_uint8_t      seq[4];
+            size_type const q = ximpl_utf8_transcoding::minimum_(4 - m_numPending, cch);
+            ss_uint32_t     v = 0;
+
+            { for (size_type i = 0; i != m_numPending; ++i)
+            {
+                seq[i] = m_pending[i];
+            }}
+            { for (size_type i = 0; i != q; ++i)
+            {
+                seq[m_numPending + i] = p[i];
+            }}
+
+            int const r = ximpl_utf8_transcoding::decode_sequence(&seq[0], &seq[0] + m_numPending + q, &v);
+
+            if (r < 0)
+            {
+                // still incomplete, so all of the input has been used
+
+                { for (size_type i = 0; i != q; ++i)
+                {
+                    m_pending[m_numPending++] = p[i];
+                }}
+
+                return 0;
+            }
+            else if (0 == r)
+            {
+                return fail_(m_position);
+            }
+            else
+            {
+                size_type const used = static_cast<size_type>(r) - m_numPending;
+
+                p           +=  used;
+                cch         -=  used;
+                n           +=  ximpl_utf8_transcoding::put_point(v, dest);
+                m_position  +=  static_cast<size_type>(r);
+                m_numPending =  0;
+            }
+        }
+
+        size_type nr;
+        size_type nw;
+
+        switch (ximpl_utf8_transcoding::utf8_to_wide(p, cch, dest + n, cchDest - n, &nr, &nw))
+        {
+        case    ximpl_utf8_transcoding::status_ok:
+            break;
+        case    ximpl_utf8_transcoding::status_incomplete:
+
+            STLSOFT_ASSERT(cch - nr < 4);
+
+            { for (size_type i = nr; i != cch; ++i)
+            {
+                m_pending[m_numPending++] = p[i];
+            }}
+            break;
+        default:
+
+            // the destination cannot be exhausted, so this is ill-formed
+            return fail_(m_position + nr);
+        }
+
+        m_position += nr;
+
+        return n + nw;
+    }
+
+    /// Indicates the end of the input
+    ///
+    /// \return <code>true</code> if the input was well-formed; otherwise
+    ///   <code>false</code> - in which case <code>error_position()</code>
+    ///   reports the offset of the ill-formed, or incomplete, sequence
+    bool finish() STLSOFT_NOEXCEPT
+    {
+        if (!m_failed &&
+            0 != m_numPending)
+        {
+            fail_(m_position);
+        }
+
+        return !m_failed;
+    }
+
+public: // attributes
+    /// The number of bytes decoded, which does not include those of any
+    /// sequence awaiting completion by the next chunk
+    size_type position() const STLSOFT_NOEXCEPT
+    {
+        return m_position;
+    }
+    /// The number of bytes awaiting completion by the next chunk
+    size_type num_pending() const STLSOFT_NOEXCEPT
+    {
+        return m_numPending;
+    }
+    /// Indicates whether ill-formed input has been encountered
+    bool failed() const STLSOFT_NOEXCEPT
+    {
+        return m_failed;
+    }
+    /// The offset, from the start of the stream, of the ill-formed
+    /// sequence. Only meaningful when <code>failed()</code>
+    size_type error_position() const STLSOFT_NOEXCEPT
+    {
+        return m_errorPosition;
+    }
+
+private:
+    size_type fail_(size_type errorPosition) STLSOFT_NOEXCEPT
+    {
+        m_errorPosition =   errorPosition;
+        m_failed        =   true;
+
+        return static_cast<size_type>(-1);
+    }
+
+private: // fields
+    ss_uint8_t  m_pending[4];
+    size_type   m_numPending;
+    size_type   m_position;
+    size_type   m_errorPosition;
+    bool        m_failed;
+};
+
+/** Streaming UTF-16/UTF-32 to UTF-8 encoder, which accepts its input in
+ * arbitrarily-sized chunks, carrying any UTF-16 surrogate pair that is
+ * split between chunks over to the next.
+ *
+ * \ingroup group__library__Conversion
+ *
+ * \tparam T_wide The source character type, whose size (2 or 4)
+ *   determines whether UTF-16 or UTF-32 is consumed
+ */
+template <ss_typename_param_k T_wide>
+class basic_utf8_encoder
+{
+public: // types
+    /// The source character type
+    typedef T_wide                                          char_type;
+    /// The size type
+    typedef ss_size_t                                       size_type;
+    /// This type
+    typedef basic_utf8_encoder<T_wide>                      class_type;
+
+public: // construction
+    basic_utf8_encoder() STLSOFT_NOEXCEPT
+        : m_pending(0)
+        , m_numPending(0)
+        , m_position(0)
+        , m_errorPosition(0)
+        , m_failed(false)
+    {}
+
+    /// Returns the encoder to its initial state
+    void reset() STLSOFT_NOEXCEPT
+    {
+        m_numPending    =   0;
+        m_position      =   0;
+        m_errorPosition =   0;
+        m_failed        =   false;
+    }
+
+public: // operations
+    /// The number of bytes that <code>encode()</code> may write for a
+    /// chunk of the given number of units
+    static size_type max_output_length(size_type cch) STLSOFT_NOEXCEPT
+    {
+        // a pending high surrogate can be completed by a single unit,
+        // yielding a 4-byte sequence
+        return (2 == sizeof(char_type)) ? (3 * cch + 1) : (4 * cch);
+    }
+
+    /// Encodes the next chunk of input
+    ///
+    /// \param s The chunk. May be <code>NULL</code> only if
+    ///   <code>cch</code> is 0
+    /// \param cch The number of units in <code>s</code>
+    /// \param dest The destination buffer
+    /// \param cchDest The number of bytes available in <code>dest</code>,
+    ///   which must be at least <code>max_output_length(cch)</code>
+    ///
+    /// \return The number of bytes written, or <code>(size_type)-1</code>
+    ///   if the input is ill-formed - in which case
+    ///   <code>error_position()</code> reports the offset, from the start
+    ///   of the stream, of the unpaired surrogate or out-of-range value,
+    ///   and all subsequent calls fail until <code>reset()</code> is called
+    ///   - or if <code>cchDest</code> is insufficient
+    size_type encode(char_type const* s, size_type cch, ss_char_a_t* dest, size_type cchDest) STLSOFT_NOEXCEPT
+    {
+        STLSOFT_STATIC_ASSERT(2 == sizeof(T_wide) || 4 == sizeof(T_wide));
+        STLSOFT_MESSAGE_ASSERT("destination too small", cchDest >= max_output_length(cch));
+
+        if (m_failed ||
+            cchDest < max_output_length(cch))
+        {
+            return static_cast<size_type>(-1);
+        }
+
+        ss_uint8_t* const   d   =   reinterpret_cast<ss_uint8_t*>(dest);
+        size_type           n   =   0;
+
+        if (0 != m_numPending &&
+            0 != cch)
+        {
+            char_type const pair[2] = { m_pending, s[0] };
+            ss_uint32_t     v = 0;
+
+            if (2 != ximpl_utf8_transcoding::get_point(&pair[0], &pair[0] + 2, &v))
+            {
+                return fail_(m_position);
+            }
+
+            s           +=  1;
+            cch         -=  1;
+            n           +=  ximpl_utf8_transcoding::put_utf8(v, d);
+            m_position  +=  2;
+            m_numPending =  0;
+        }
+
+        size_type nr;
+        size_type nw;
+
+        switch (ximpl_utf8_transcoding::wide_to_utf8(s, cch, d + n, cchDest - n, &nr, &nw))
+        {
+        case    ximpl_utf8_transcoding::status_ok:
+            break;
+        case    ximpl_utf8_transcoding::status_incomplete:
+
+            STLSOFT_ASSERT(cch - nr == 1);
+
+            m_pending       =   s[nr];
+            m_numPending    =   1;
+            break;
+        default:
+
+            return fail_(m_position + nr);
+        }
+
+        m_position += nr;
+
+        return n + nw;
+    }
+
+    /// Indicates the end of the input
+    ///
+    /// \return <code>true</code> if the input was well-formed; otherwise
+    ///   <code>false</code> - in which case <code>error_position()</code>
+    ///   reports the offset of the unpaired surrogate or out-of-range
+    ///   value
+    bool finish() STLSOFT_NOEXCEPT
+    {
+        if (!m_failed &&
+            0 != m_numPending)
+        {
+            fail_(m_position);
+        }
+
+        return !m_failed;
+    }
+
+public: // attributes
+    /// The number of units encoded, which does not include a high
+    /// surrogate awaiting completion by the next chunk
+    size_type position() const STLSOFT_NOEXCEPT
+    {
+        return m_position;
+    }
+    /// The number of units (0 or 1) awaiting completion by the next chunk
+    size_type num_pending() const STLSOFT_NOEXCEPT
+    {
+        return m_numPending;
+    }
+    /// Indicates whether ill-formed input has been encountered
+    bool failed() const STLSOFT_NOEXCEPT
+    {
+        return m_failed;
+    }
+    /// The offset, from the start of the stream, of the unpaired surrogate
+    /// or out-of-range value. Only meaningful when <code>failed()</code>
+    size_type error_position() const STLSOFT_NOEXCEPT
+    {
+        return m_errorPosition;
+    }
+
+private:
+    size_type fail_(size_type errorPosition) STLSOFT_NOEXCEPT
+    {
+        m_errorPosition =   errorPosition;
+        m_failed        =   true;
+
+        return static_cast<size_type>(-1);
+    }
+
+private: // fields
+    char_type   m_pending;
+    size_type   m_numPending;
+    size_type   m_position;
+    size_type   m_errorPosition;
+    bool        m_failed;
+};
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * typedefs
+ */
+
+/** Specialisation of basic_utf8_decoder for <code>wchar_t</code>
+ *
+ * \ingroup group__library__Conversion
+ */
+typedef basic_utf8_decoder<ss_char_w_t>                     utf8_decoder;
+
+/** Specialisation of basic_utf8_encoder for <code>wchar_t</code>
+ *
+ * \ingroup group__library__Conversion
+ */
+typedef basic_utf8_encoder<ss_char_w_t>                     utf8_encoder;
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef STLSOFT_NO_NAMESPACE
+} /* namespace stlsoft */
+#endif /* STLSOFT_NO_NAMESPACE */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !STLSOFT_INCL_STLSOFT_CONVERSION_HPP_UTF8_TRANSCODING */
+
+/* ///////////////////////////// end of file //////////////////////////// */
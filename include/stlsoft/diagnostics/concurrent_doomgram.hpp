@@ -0,0 +1,551 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    stlsoft/diagnostics/concurrent_doomgram.hpp
+ *
+ * Purpose: Definition of the concurrent_doomgram class.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * Home:    http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* STLSOFT:C++98:FILE_EXCEPTED */
+/* STLSOFT:C++03:FILE_EXCEPTED */
+
+/** \file stlsoft/diagnostics/concurrent_doomgram.hpp
+ *
+ * \brief [C++] Definition of the concurrent_doomgram class
+ *   (\ref group__library__Diagnostic "Diagnostic" Library).
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_DIAGNOSTICS_HPP_CONCURRENT_DOOMGRAM
+#define STLSOFT_INCL_STLSOFT_DIAGNOSTICS_HPP_CONCURRENT_DOOMGRAM
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define STLSOFT_VER_STLSOFT_DIAGNOSTICS_HPP_CONCURRENT_DOOMGRAM_MAJOR      1
+# define STLSOFT_VER_STLSOFT_DIAGNOSTICS_HPP_CONCURRENT_DOOMGRAM_MINOR      0
+# define STLSOFT_VER_STLSOFT_DIAGNOSTICS_HPP_CONCURRENT_DOOMGRAM_REVISION   0
+# define STLSOFT_VER_STLSOFT_DIAGNOSTICS_HPP_CONCURRENT_DOOMGRAM_EDIT       1
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_H_STLSOFT
+# include <stlsoft/stlsoft.h>
+#endif /* !STLSOFT_INCL_STLSOFT_H_STLSOFT */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+#ifndef STLSOFT_INCL_STLSOFT_DIAGNOSTICS_HPP_DOOMGRAM
+# include <stlsoft/diagnostics/doomgram.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_DIAGNOSTICS_HPP_DOOMGRAM */
+#ifndef STLSOFT_INCL_STLSOFT_UTIL_INCL_COUNT_DIGITS_H_COUNT_DECIMAL_DIGITS
+# include <stlsoft/util/count_digits/count_decimal_digits.h>
+#endif /* !STLSOFT_INCL_STLSOFT_UTIL_INCL_COUNT_DIGITS_H_COUNT_DECIMAL_DIGITS */
+
+#ifndef STLSOFT_INCL_ATOMIC
+# define STLSOFT_INCL_ATOMIC
+# include <atomic>
+#endif /* !STLSOFT_INCL_ATOMIC */
+#ifndef STLSOFT_INCL_THREAD
+# define STLSOFT_INCL_THREAD
+# include <thread>
+#endif /* !STLSOFT_INCL_THREAD */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef STLSOFT_NO_NAMESPACE
+namespace stlsoft
+{
+#endif /* STLSOFT_NO_NAMESPACE */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * classes
+ */
+
+/** Thread-safe counterpart of \link stlsoft::doomgram doomgram\endlink
+ *
+ * \ingroup group__library__Diagnostic
+ *
+ * This class records events into per-thread cells, each of which is a
+ * cache-line-separated set of atomic counters that is written only by its
+ * owning thread. Recording therefore requires no locks and no atomic
+ * read-modify-write operations - only relaxed loads and stores - and
+ * recording threads do not contend with one another. A cell is created
+ * (and linked, lock-free, into the instance) the first time a given thread
+ * records an event, and persists until the instance is destroyed, so that
+ * events recorded by threads that have since exited are retained.
+ *
+ * The cells are combined into a normal \c doomgram on demand, via
+ * snapshot().
+ *
+ * Since it provides the same push_event_time_ns() (etc.) methods, an
+ * instance may be used with
+ * \link stlsoft::gram_scope gram_scope\endlink.
+ *
+ * \note A snapshot taken while other threads are recording is not a single
+ *   point-in-time view: each counter is read atomically, but the set of
+ *   counters is not.
+ */
+class concurrent_doomgram
+{
+public: // types
+    /// This type
+    typedef concurrent_doomgram                             class_type;
+    /// The integer type
+    typedef doomgram::integer_type                          integer_type;
+    /// The snapshot type
+    typedef doomgram                                        snapshot_type;
+private:
+    typedef integral_limits<integer_type>                   integral_limits_type;
+    typedef std::atomic<integer_type>                       atomic_integer_type_;
+
+    enum { num_buckets_ = 12 };
+    enum { cache_line_size_ = 64 };
+    enum { num_cached_cells_ = 4 };
+
+    struct cell_type_
+    {
+        char                    leading_padding_[cache_line_size_];
+        atomic_integer_type_    event_count;
+        atomic_integer_type_    total_event_time_ns;
+        atomic_integer_type_    min_event_time_ns;
+        atomic_integer_type_    max_event_time_ns;
+        atomic_integer_type_    num_events[num_buckets_];
+        std::atomic<bool>       has_overflowed;
+        std::thread::id         owner;
+        cell_type_*             next;
+        char                    trailing_padding_[cache_line_size_];
+    };
+
+    struct cached_cell_type_
+    {
+        ss_uint64_t             instance_id;
+        cell_type_*             cell;
+    };
+
+
+public: // construction
+    /// Constructs an instance
+    concurrent_doomgram();
+    /// Destroys an instance
+    ///
+    /// \note Must not be called while other threads are recording
+    ~concurrent_doomgram() STLSOFT_NOEXCEPT;
+private:
+    concurrent_doomgram(class_type const&) STLSOFT_COPY_CONSTRUCTION_PROSCRIBED;
+    void operator =(class_type const&) STLSOFT_COPY_ASSIGNMENT_PROSCRIBED;
+
+
+public: // operations
+    /// Pushes an event with the given number of nanoseconds
+    bool push_event_time_ns(integer_type time_in_ns);
+    /// Pushes an event with the given number of microseconds
+    bool push_event_time_us(integer_type time_in_us);
+    /// Pushes an event with the given number of milliseconds
+    bool push_event_time_ms(integer_type time_in_ms);
+    /// Pushes an event with the given number of seconds
+    bool push_event_time_s(integer_type time_in_s);
+
+    /// Resets all counters
+    ///
+    /// \note Must not be called while other threads are recording
+    void clear() STLSOFT_NOEXCEPT;
+
+
+public: // accessors
+    /// The number of threads that have recorded events
+    ss_size_t num_cells() const STLSOFT_NOEXCEPT;
+    /// Number of events counted
+    integer_type event_count() const STLSOFT_NOEXCEPT;
+    /// Indicates whether overflow has occurred
+    bool has_overflowed() const STLSOFT_NOEXCEPT;
+
+    /// Combines all cells into a \c doomgram
+    snapshot_type snapshot() const STLSOFT_NOEXCEPT;
+
+
+private: // implementation
+    static ss_uint64_t  next_instance_id_() STLSOFT_NOEXCEPT;
+    static void         clear_cell_(cell_type_& cell) STLSOFT_NOEXCEPT;
+    static void         store_relaxed_(atomic_integer_type_& v, integer_type n) STLSOFT_NOEXCEPT;
+
+    cell_type_&         this_threads_cell_();
+    cell_type_&         find_or_create_this_threads_cell_();
+
+
+private: // fields
+    ss_uint64_t const           m_instance_id;
+    std::atomic<cell_type_*>    m_head;
+};
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * implementation
+ */
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+// implementation
+
+inline
+/* static */
+ss_uint64_t
+concurrent_doomgram::next_instance_id_() STLSOFT_NOEXCEPT
+{
+    // Instance ids are never reused, so a thread's cached cell pointers
+    // can never be mistaken for those of a later instance that happens to
+    // occupy the same address
+
+    static std::atomic<ss_uint64_t> s_next_id(1);
+
+    return s_next_id.fetch_add(1, std::memory_order_relaxed);
+}
+
+inline
+/* static */
+void
+concurrent_doomgram::clear_cell_(
+    cell_type_& cell
+) STLSOFT_NOEXCEPT
+{
+    cell.event_count.store(0, std::memory_order_relaxed);
+    cell.total_event_time_ns.store(0, std::memory_order_relaxed);
+    cell.min_event_time_ns.store(integral_limits_type::maximum(), std::memory_order_relaxed);
+    cell.max_event_time_ns.store(integral_limits_type::minimum(), std::memory_order_relaxed);
+
+    for (int i = 0; i != num_buckets_; ++i)
+    {
+        cell.num_events[i].store(0, std::memory_order_relaxed);
+    }
+
+    cell.has_overflowed.store(false, std::memory_order_relaxed);
+}
+
+inline
+/* static */
+void
+concurrent_doomgram::store_relaxed_(
+    atomic_integer_type_&   v
+,   integer_type            n
+) STLSOFT_NOEXCEPT
+{
+    v.store(n, std::memory_order_relaxed);
+}
+
+inline
+concurrent_doomgram::cell_type_&
+concurrent_doomgram::this_threads_cell_()
+{
+    static thread_local cached_cell_type_   s_cache[num_cached_cells_];
+
+    for (int i = 0; i != num_cached_cells_; ++i)
+    {
+        if (m_instance_id == s_cache[i].instance_id)
+        {
+            return *s_cache[i].cell;
+        }
+    }
+
+    cell_type_& cell = find_or_create_this_threads_cell_();
+
+    // replace the oldest entry
+
+    for (int i = num_cached_cells_ - 1; i != 0; --i)
+    {
+        s_cache[i] = s_cache[i - 1];
+    }
+
+    s_cache[0].instance_id  =   m_instance_id;
+    s_cache[0].cell         =   &cell;
+
+    return cell;
+}
+
+inline
+concurrent_doomgram::cell_type_&
+concurrent_doomgram::find_or_create_this_threads_cell_()
+{
+    std::thread::id const this_thread = std::this_thread::get_id();
+
+    for (cell_type_* cell = m_head.load(std::memory_order_acquire); ss_nullptr_k != cell; cell = cell->next)
+    {
+        if (this_thread == cell->owner)
+        {
+            return *cell;
+        }
+    }
+
+    cell_type_* const cell = new cell_type_();
+
+    clear_cell_(*cell);
+
+    cell->owner = this_thread;
+    cell->next  = m_head.load(std::memory_order_relaxed);
+
+    for (; !m_head.compare_exchange_weak(cell->next, cell, std::memory_order_release, std::memory_order_relaxed); )
+    {}
+
+    return *cell;
+}
+
+
+// construction
+
+inline
+concurrent_doomgram::concurrent_doomgram()
+    : m_instance_id(next_instance_id_())
+    , m_head(ss_nullptr_k)
+{}
+
+inline
+concurrent_doomgram::~concurrent_doomgram() STLSOFT_NOEXCEPT
+{
+    for (cell_type_* cell = m_head.load(std::memory_order_acquire); ss_nullptr_k != cell; )
+    {
+        cell_type_* const next = cell->next;
+
+        delete cell;
+
+        cell = next;
+    }
+}
+
+
+// operations
+
+inline
+bool
+concurrent_doomgram::push_event_time_ns(
+    integer_type time_in_ns
+)
+{
+    // Only the owning thread writes to a cell, so each update is a relaxed
+    // load followed by a relaxed store, rather than an atomic RMW
+
+    cell_type_&         cell        =   this_threads_cell_();
+    integer_type const  prev_total  =   cell.total_event_time_ns.load(std::memory_order_relaxed);
+    integer_type const  new_total   =   prev_total + time_in_ns;
+
+    if (new_total < prev_total)
+    {
+        cell.has_overflowed.store(true, std::memory_order_relaxed);
+
+        return false;
+    }
+
+    store_relaxed_(cell.total_event_time_ns, new_total);
+    store_relaxed_(cell.event_count, cell.event_count.load(std::memory_order_relaxed) + 1);
+
+    if (time_in_ns < cell.min_event_time_ns.load(std::memory_order_relaxed))
+    {
+        store_relaxed_(cell.min_event_time_ns, time_in_ns);
+    }
+
+    if (time_in_ns > cell.max_event_time_ns.load(std::memory_order_relaxed))
+    {
+        store_relaxed_(cell.max_event_time_ns, time_in_ns);
+    }
+
+    // zero-time events are counted, but not bucketed, as in doomgram
+
+    if (0 != time_in_ns)
+    {
+        int const               num_digits  =   stlsoft_C_count_decimal_digits_uint64(time_in_ns);
+        int const               index       =   (num_digits > num_buckets_) ? (num_buckets_ - 1) : (num_digits - 1);
+        atomic_integer_type_&   bucket      =   cell.num_events[index];
+
+        store_relaxed_(bucket, bucket.load(std::memory_order_relaxed) + 1);
+    }
+
+    return true;
+}
+
+inline
+bool
+concurrent_doomgram::push_event_time_us(
+    integer_type time_in_us
+)
+{
+    return push_event_time_ns(time_in_us * 1000);
+}
+
+inline
+bool
+concurrent_doomgram::push_event_time_ms(
+    integer_type time_in_ms
+)
+{
+    return push_event_time_ns(time_in_ms * 1000000);
+}
+
+inline
+bool
+concurrent_doomgram::push_event_time_s(
+    integer_type time_in_s
+)
+{
+    return push_event_time_ns(time_in_s * 1000000000);
+}
+
+inline
+void
+concurrent_doomgram::clear() STLSOFT_NOEXCEPT
+{
+    for (cell_type_* cell = m_head.load(std::memory_order_acquire); ss_nullptr_k != cell; cell = cell->next)
+    {
+        clear_cell_(*cell);
+    }
+}
+
+
+// accessors
+
+inline
+ss_size_t
+concurrent_doomgram::num_cells() const STLSOFT_NOEXCEPT
+{
+    ss_size_t n = 0;
+
+    for (cell_type_ const* cell = m_head.load(std::memory_order_acquire); ss_nullptr_k != cell; cell = cell->next)
+    {
+        ++n;
+    }
+
+    return n;
+}
+
+inline
+concurrent_doomgram::integer_type
+concurrent_doomgram::event_count() const STLSOFT_NOEXCEPT
+{
+    integer_type n = 0;
+
+    for (cell_type_ const* cell = m_head.load(std::memory_order_acquire); ss_nullptr_k != cell; cell = cell->next)
+    {
+        n += cell->event_count.load(std::memory_order_relaxed);
+    }
+
+    return n;
+}
+
+inline
+bool
+concurrent_doomgram::has_overflowed() const STLSOFT_NOEXCEPT
+{
+    for (cell_type_ const* cell = m_head.load(std::memory_order_acquire); ss_nullptr_k != cell; cell = cell->next)
+    {
+        if (cell->has_overflowed.load(std::memory_order_relaxed))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+inline
+concurrent_doomgram::snapshot_type
+concurrent_doomgram::snapshot() const STLSOFT_NOEXCEPT
+{
+    static integer_type doomgram::* const buckets[num_buckets_] =
+    {
+        &doomgram::m_num_events_in_1ns,
+        &doomgram::m_num_events_in_10ns,
+        &doomgram::m_num_events_in_100ns,
+        &doomgram::m_num_events_in_1us,
+        &doomgram::m_num_events_in_10us,
+        &doomgram::m_num_events_in_100us,
+        &doomgram::m_num_events_in_1ms,
+        &doomgram::m_num_events_in_10ms,
+        &doomgram::m_num_events_in_100ms,
+        &doomgram::m_num_events_in_1s,
+        &doomgram::m_num_events_in_10s,
+        &doomgram::m_num_events_ge_100s,
+    };
+
+    snapshot_type dg;
+
+    for (cell_type_ const* cell = m_head.load(std::memory_order_acquire); ss_nullptr_k != cell; cell = cell->next)
+    {
+        snapshot_type cdg;
+
+        cdg.m_event_count           =   cell->event_count.load(std::memory_order_relaxed);
+        cdg.m_total_event_time_ns   =   cell->total_event_time_ns.load(std::memory_order_relaxed);
+        cdg.m_min_event_time_ns     =   cell->min_event_time_ns.load(std::memory_order_relaxed);
+        cdg.m_max_event_time_ns     =   cell->max_event_time_ns.load(std::memory_order_relaxed);
+        cdg.m_has_overflowed        =   cell->has_overflowed.load(std::memory_order_relaxed);
+
+        for (int i = 0; i != num_buckets_; ++i)
+        {
+            cdg.*buckets[i] = cell->num_events[i].load(std::memory_order_relaxed);
+        }
+
+        dg.merge(cdg);
+    }
+
+    return dg;
+}
+
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef STLSOFT_NO_NAMESPACE
+} /* namespace stlsoft */
+#endif /* STLSOFT_NO_NAMESPACE */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !STLSOFT_INCL_STLSOFT_DIAGNOSTICS_HPP_CONCURRENT_DOOMGRAM */
+
+/* ///////////////////////////// end of file //////////////////////////// */
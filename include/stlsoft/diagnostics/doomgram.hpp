@@ -4,7 +4,7 @@
  * Purpose: Definition of the doomgram class.
  *
  * Created: 13th May 2013
- * Updated: 17th December 2024
+ * Updated: 16th October 2026
  *
  * Home:    http://stlsoft.org/
  *
@@ -52,9 +52,9 @@
 
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 # define STLSOFT_VER_STLSOFT_DIAGNOSTICS_HPP_DOOMGRAM_MAJOR     2
-# define STLSOFT_VER_STLSOFT_DIAGNOSTICS_HPP_DOOMGRAM_MINOR     0
-# define STLSOFT_VER_STLSOFT_DIAGNOSTICS_HPP_DOOMGRAM_REVISION  1
-# define STLSOFT_VER_STLSOFT_DIAGNOSTICS_HPP_DOOMGRAM_EDIT      33
+# define STLSOFT_VER_STLSOFT_DIAGNOSTICS_HPP_DOOMGRAM_MINOR     1
+# define STLSOFT_VER_STLSOFT_DIAGNOSTICS_HPP_DOOMGRAM_REVISION  0
+# define STLSOFT_VER_STLSOFT_DIAGNOSTICS_HPP_DOOMGRAM_EDIT      34
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 
@@ -88,6 +88,13 @@ namespace stlsoft
 #endif /* STLSOFT_NO_NAMESPACE */
 
 
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+class concurrent_doomgram;
+
+
 /* /////////////////////////////////////////////////////////////////////////
  * classes
  */
@@ -127,6 +134,12 @@ public: // operations
     /// Pushes an event with the given number of seconds
     bool push_event_time_s(integer_type time_in_ms);
 
+    /// Merges the events recorded in another instance into this one
+    ///
+    /// \retval true No overflow has occurred
+    /// \retval false Overflow has occurred
+    bool merge(class_type const& rhs) STLSOFT_NOEXCEPT;
+
 
 public: // accessors
     /// Number of events counted
@@ -179,6 +192,8 @@ public: // accessors
 
 
 private: // implementation
+    friend class concurrent_doomgram;
+
     // Returns false if overflowed
     bool try_add_ns_to_total_and_update_minmax_and_count_(integer_type time_in_ns);
 
@@ -567,6 +582,50 @@ doomgram::push_event_time_s(
     }
 }
 
+inline
+bool
+doomgram::merge(
+    class_type const& rhs
+) STLSOFT_NOEXCEPT
+{
+    integer_type const new_total_event_time_ns = m_total_event_time_ns + rhs.m_total_event_time_ns;
+
+    if (new_total_event_time_ns < m_total_event_time_ns)
+    {
+        m_has_overflowed = true;
+    }
+
+    m_has_overflowed = m_has_overflowed || rhs.m_has_overflowed;
+
+    m_event_count           +=  rhs.m_event_count;
+    m_total_event_time_ns   =   new_total_event_time_ns;
+
+    if (rhs.m_min_event_time_ns < m_min_event_time_ns)
+    {
+        m_min_event_time_ns = rhs.m_min_event_time_ns;
+    }
+
+    if (rhs.m_max_event_time_ns > m_max_event_time_ns)
+    {
+        m_max_event_time_ns = rhs.m_max_event_time_ns;
+    }
+
+    m_num_events_in_1ns     +=  rhs.m_num_events_in_1ns;
+    m_num_events_in_10ns    +=  rhs.m_num_events_in_10ns;
+    m_num_events_in_100ns   +=  rhs.m_num_events_in_100ns;
+    m_num_events_in_1us     +=  rhs.m_num_events_in_1us;
+    m_num_events_in_10us    +=  rhs.m_num_events_in_10us;
+    m_num_events_in_100us   +=  rhs.m_num_events_in_100us;
+    m_num_events_in_1ms     +=  rhs.m_num_events_in_1ms;
+    m_num_events_in_10ms    +=  rhs.m_num_events_in_10ms;
+    m_num_events_in_100ms   +=  rhs.m_num_events_in_100ms;
+    m_num_events_in_1s      +=  rhs.m_num_events_in_1s;
+    m_num_events_in_10s     +=  rhs.m_num_events_in_10s;
+    m_num_events_ge_100s    +=  rhs.m_num_events_ge_100s;
+
+    return !m_has_overflowed;
+}
+
 
 // accessors
 
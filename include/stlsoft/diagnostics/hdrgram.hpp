@@ -0,0 +1,728 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    stlsoft/diagnostics/hdrgram.hpp
+ *
+ * Purpose: Definition of the hdrgram class.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * Home:    http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/** \file stlsoft/diagnostics/hdrgram.hpp
+ *
+ * \brief [C++] Definition of the hdrgram class
+ *   (\ref group__library__Diagnostic "Diagnostic" Library).
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_DIAGNOSTICS_HPP_HDRGRAM
+#define STLSOFT_INCL_STLSOFT_DIAGNOSTICS_HPP_HDRGRAM
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define STLSOFT_VER_STLSOFT_DIAGNOSTICS_HPP_HDRGRAM_MAJOR      1
+# define STLSOFT_VER_STLSOFT_DIAGNOSTICS_HPP_HDRGRAM_MINOR      0
+# define STLSOFT_VER_STLSOFT_DIAGNOSTICS_HPP_HDRGRAM_REVISION   0
+# define STLSOFT_VER_STLSOFT_DIAGNOSTICS_HPP_HDRGRAM_EDIT       1
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_H_STLSOFT
+# include <stlsoft/stlsoft.h>
+#endif /* !STLSOFT_INCL_STLSOFT_H_STLSOFT */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+#ifndef STLSOFT_INCL_STLSOFT_LIMITS_HPP_INTEGRAL_LIMITS
+# include <stlsoft/limits/integral_limits.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_LIMITS_HPP_INTEGRAL_LIMITS */
+#ifndef STLSOFT_INCL_STLSOFT_UTIL_BITS_H_TEST_FUNCTIONS
+# include <stlsoft/util/bits/test_functions.h>
+#endif /* !STLSOFT_INCL_STLSOFT_UTIL_BITS_H_TEST_FUNCTIONS */
+#ifndef STLSOFT_INCL_STLSOFT_UTIL_HPP_STD_SWAP
+# include <stlsoft/util/std_swap.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_UTIL_HPP_STD_SWAP */
+
+#ifndef STLSOFT_INCL_ALGORITHM
+# define STLSOFT_INCL_ALGORITHM
+# include <algorithm>
+#endif /* !STLSOFT_INCL_ALGORITHM */
+#ifndef STLSOFT_INCL_VECTOR
+# define STLSOFT_INCL_VECTOR
+# include <vector>
+#endif /* !STLSOFT_INCL_VECTOR */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef STLSOFT_NO_NAMESPACE
+namespace stlsoft
+{
+#endif /* STLSOFT_NO_NAMESPACE */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * classes
+ */
+
+/** High Dynamic Range log-linear frequency histoGRAM
+ *
+ * \ingroup group__library__Diagnostic
+ *
+ * This class is a frequency histogram whose buckets are arranged
+ * log-linearly: each power-of-2 range of values is split into
+ * <code>2^sub_bucket_bits</code> equal-width sub-buckets, so that the
+ * relative error of any reported value is no greater than
+ * <code>1 / 2^sub_bucket_bits</code> over the whole range of 64-bit
+ * values. (Values less than <code>2^sub_bucket_bits</code> are recorded
+ * exactly.)
+ *
+ * Recording an event is a constant-time operation; obtaining a quantile
+ * is linear in the number of buckets; merging is linear in the number of
+ * buckets, and so independent of the number of events recorded.
+ *
+ * Since it provides the same push_event_time_ns() (etc.) methods as
+ * \link stlsoft::doomgram doomgram\endlink, an instance may be used with
+ * \link stlsoft::gram_scope gram_scope\endlink.
+ */
+class hdrgram
+{
+public: // types
+    /// This type
+    typedef hdrgram                                         class_type;
+    /// The integer type
+    typedef ss_uint64_t                                     integer_type;
+    /// The size type
+    typedef ss_size_t                                       size_type;
+private:
+    typedef integral_limits<integer_type>                   integral_limits_type;
+    typedef std::vector<integer_type>                       counts_type_;
+
+public: // constants
+    enum
+    {
+        /// The default number of bits of sub-bucket resolution
+        default_sub_bucket_bits = 7
+    };
+
+
+public: // construction
+    /// Constructs an instance with the given sub-bucket resolution
+    ///
+    /// \param sub_bucket_bits The number of bits of sub-bucket resolution,
+    ///   which determines the number of sub-buckets (2^sub_bucket_bits)
+    ///   per power of 2. Must be in the range [1, 16]
+    explicit
+    hdrgram(unsigned sub_bucket_bits = default_sub_bucket_bits);
+
+
+public: // operations
+    /// Pushes an event with the given number of nanoseconds
+    bool push_event_time_ns(integer_type time_in_ns);
+    /// Pushes an event with the given number of microseconds
+    bool push_event_time_us(integer_type time_in_us);
+    /// Pushes an event with the given number of milliseconds
+    bool push_event_time_ms(integer_type time_in_ms);
+    /// Pushes an event with the given number of seconds
+    bool push_event_time_s(integer_type time_in_s);
+
+    /// Merges the events recorded in another instance into this one
+    ///
+    /// \pre rhs.sub_bucket_bits() == sub_bucket_bits()
+    ///
+    /// \retval true No overflow has occurred
+    /// \retval false Overflow has occurred, or the instances have different
+    ///   sub-bucket resolutions (in which case nothing is merged)
+    bool merge(class_type const& rhs) STLSOFT_NOEXCEPT;
+
+    /// Removes all recorded events
+    void clear() STLSOFT_NOEXCEPT;
+
+    /// Swaps the state of this instance with another
+    void swap(class_type& rhs) STLSOFT_NOEXCEPT;
+
+
+public: // accessors
+    /// Number of events counted
+    integer_type event_count() const STLSOFT_NOEXCEPT;
+    /// Attempts to obtain the total event time (in nanoseconds)
+    ///
+    /// \param value Pointer to variable to receive the value. May be NULL
+    ///
+    /// \retval true No overflow has occurred
+    /// \retval false Overflow has occurred
+    bool try_get_total_event_time_ns(integer_type* value) const STLSOFT_NOEXCEPT;
+    /// Obtains the total event time (in nanoseconds), regardless of whether
+    /// overflow has occurred
+    integer_type total_event_time_ns_raw() const STLSOFT_NOEXCEPT;
+    /// Attempts to obtain the minimum event time (in nanoseconds)
+    ///
+    /// \param value Pointer to variable to receive the value. May not be NULL
+    bool try_get_min_event_time_ns(integer_type* value) const STLSOFT_NOEXCEPT;
+    /// Attempts to obtain the maximum event time (in nanoseconds)
+    ///
+    /// \param value Pointer to variable to receive the value. May not be NULL
+    bool try_get_max_event_time_ns(integer_type* value) const STLSOFT_NOEXCEPT;
+
+    /// Obtains the event time (in nanoseconds) at or below which the given
+    /// fraction of events fall
+    ///
+    /// \param quantile The quantile, in the range [0.0, 1.0]
+    ///
+    /// \return The highest value equivalent (within the resolution of the
+    ///   histogram) to that of the event at the given quantile, clamped to
+    ///   the recorded minimum and maximum; 0 if no events have been
+    ///   recorded
+    integer_type value_at_quantile(double quantile) const STLSOFT_NOEXCEPT;
+    /// Obtains the event time (in nanoseconds) at or below which the given
+    /// percentage of events fall
+    ///
+    /// \param percentile The percentile, in the range [0.0, 100.0]
+    integer_type value_at_percentile(double percentile) const STLSOFT_NOEXCEPT;
+
+    /// Indicates whether overflow has occurred
+    bool has_overflowed() const STLSOFT_NOEXCEPT;
+
+
+public: // bucket accessors
+    /// The number of bits of sub-bucket resolution
+    unsigned sub_bucket_bits() const STLSOFT_NOEXCEPT;
+    /// The number of buckets
+    size_type num_buckets() const STLSOFT_NOEXCEPT;
+    /// The index of the bucket into which the given value is recorded
+    size_type bucket_index(integer_type value) const STLSOFT_NOEXCEPT;
+    /// The number of events recorded in the given bucket
+    integer_type num_events_in_bucket(size_type index) const STLSOFT_NOEXCEPT;
+    /// The lowest value recorded in the given bucket
+    integer_type bucket_lowest_value(size_type index) const STLSOFT_NOEXCEPT;
+    /// The highest value recorded in the given bucket
+    integer_type bucket_highest_value(size_type index) const STLSOFT_NOEXCEPT;
+
+
+private: // implementation
+    // Returns false if overflowed
+    bool try_add_ns_to_total_and_update_minmax_and_count_(integer_type time_in_ns);
+
+
+private: // fields
+    unsigned        m_sub_bucket_bits;
+    integer_type    m_sub_bucket_count;
+    integer_type    m_event_count;
+    integer_type    m_total_event_time_ns;
+    integer_type    m_min_event_time_ns;
+    integer_type    m_max_event_time_ns;
+    bool            m_has_overflowed;
+    counts_type_    m_counts;
+};
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * swapping
+ */
+
+inline
+void
+swap(
+    hdrgram&    lhs
+,   hdrgram&    rhs
+) STLSOFT_NOEXCEPT
+{
+    lhs.swap(rhs);
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * implementation
+ */
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+// implementation
+
+inline
+bool
+hdrgram::try_add_ns_to_total_and_update_minmax_and_count_(
+    integer_type time_in_ns
+)
+{
+    integer_type const new_total_event_time_ns = time_in_ns + m_total_event_time_ns;
+
+    if (new_total_event_time_ns < m_total_event_time_ns)
+    {
+        m_has_overflowed = true;
+
+        return false;
+    }
+    else
+    {
+        m_total_event_time_ns = new_total_event_time_ns;
+
+        ++m_event_count;
+
+        if (time_in_ns < m_min_event_time_ns)
+        {
+            m_min_event_time_ns = time_in_ns;
+        }
+
+        if (time_in_ns > m_max_event_time_ns)
+        {
+            m_max_event_time_ns = time_in_ns;
+        }
+
+        return true;
+    }
+}
+
+
+// construction
+
+inline
+hdrgram::hdrgram(
+    unsigned sub_bucket_bits
+)
+    : m_sub_bucket_bits(sub_bucket_bits)
+    , m_sub_bucket_count(integer_type(1) << sub_bucket_bits)
+    , m_event_count(0)
+    , m_total_event_time_ns(0)
+    , m_min_event_time_ns(integral_limits_type::maximum())
+    , m_max_event_time_ns(integral_limits_type::minimum())
+    , m_has_overflowed(false)
+    // The buckets comprise the 2^b exact values [0, 2^b), followed by
+    // 2^b sub-buckets for each of the powers of 2 from 2^b to 2^63
+    , m_counts(static_cast<size_type>((65 - sub_bucket_bits) * (integer_type(1) << sub_bucket_bits)), 0)
+{
+    STLSOFT_MESSAGE_ASSERT("sub-bucket bits must be in the range [1, 16]", sub_bucket_bits >= 1 && sub_bucket_bits <= 16);
+}
+
+
+// operations
+
+inline
+bool
+hdrgram::push_event_time_ns(
+    integer_type time_in_ns
+)
+{
+    STLSOFT_MESSAGE_ASSERT("timing stack has overflowed and no further events may be pushed", !m_has_overflowed);
+
+    if (!try_add_ns_to_total_and_update_minmax_and_count_(time_in_ns))
+    {
+        return false;
+    }
+    else
+    {
+        ++m_counts[bucket_index(time_in_ns)];
+
+        return true;
+    }
+}
+
+inline
+bool
+hdrgram::push_event_time_us(
+    integer_type time_in_us
+)
+{
+    return push_event_time_ns(time_in_us * 1000);
+}
+
+inline
+bool
+hdrgram::push_event_time_ms(
+    integer_type time_in_ms
+)
+{
+    return push_event_time_ns(time_in_ms * 1000000);
+}
+
+inline
+bool
+hdrgram::push_event_time_s(
+    integer_type time_in_s
+)
+{
+    return push_event_time_ns(time_in_s * 1000000000);
+}
+
+inline
+bool
+hdrgram::merge(
+    class_type const& rhs
+) STLSOFT_NOEXCEPT
+{
+    STLSOFT_MESSAGE_ASSERT("cannot merge histograms of different resolutions", rhs.m_sub_bucket_bits == m_sub_bucket_bits);
+
+    if (rhs.m_sub_bucket_bits != m_sub_bucket_bits)
+    {
+        return false;
+    }
+
+    integer_type const new_total_event_time_ns = m_total_event_time_ns + rhs.m_total_event_time_ns;
+
+    if (new_total_event_time_ns < m_total_event_time_ns)
+    {
+        m_has_overflowed = true;
+    }
+
+    m_has_overflowed = m_has_overflowed || rhs.m_has_overflowed;
+
+    m_event_count           +=  rhs.m_event_count;
+    m_total_event_time_ns   =   new_total_event_time_ns;
+
+    if (rhs.m_min_event_time_ns < m_min_event_time_ns)
+    {
+        m_min_event_time_ns = rhs.m_min_event_time_ns;
+    }
+
+    if (rhs.m_max_event_time_ns > m_max_event_time_ns)
+    {
+        m_max_event_time_ns = rhs.m_max_event_time_ns;
+    }
+
+    integer_type*       dest    =   &m_counts[0];
+    integer_type const* src     =   &rhs.m_counts[0];
+    size_type const     n       =   m_counts.size();
+
+    for (size_type i = 0; i != n; ++i)
+    {
+        dest[i] += src[i];
+    }
+
+    return !m_has_overflowed;
+}
+
+inline
+void
+hdrgram::clear() STLSOFT_NOEXCEPT
+{
+    m_event_count           =   0;
+    m_total_event_time_ns   =   0;
+    m_min_event_time_ns     =   integral_limits_type::maximum();
+    m_max_event_time_ns     =   integral_limits_type::minimum();
+    m_has_overflowed        =   false;
+
+    std::fill(m_counts.begin(), m_counts.end(), integer_type(0));
+}
+
+inline
+void
+hdrgram::swap(
+    class_type& rhs
+) STLSOFT_NOEXCEPT
+{
+    std_swap(m_sub_bucket_bits, rhs.m_sub_bucket_bits);
+    std_swap(m_sub_bucket_count, rhs.m_sub_bucket_count);
+    std_swap(m_event_count, rhs.m_event_count);
+    std_swap(m_total_event_time_ns, rhs.m_total_event_time_ns);
+    std_swap(m_min_event_time_ns, rhs.m_min_event_time_ns);
+    std_swap(m_max_event_time_ns, rhs.m_max_event_time_ns);
+    std_swap(m_has_overflowed, rhs.m_has_overflowed);
+    m_counts.swap(rhs.m_counts);
+}
+
+
+// accessors
+
+inline
+hdrgram::integer_type
+hdrgram::event_count() const STLSOFT_NOEXCEPT
+{
+    return m_event_count;
+}
+
+inline
+bool
+hdrgram::try_get_total_event_time_ns(
+    integer_type* value
+) const STLSOFT_NOEXCEPT
+{
+    if (ss_nullptr_k != value)
+    {
+        *value = m_total_event_time_ns;
+    }
+
+    return !m_has_overflowed;
+}
+
+inline
+hdrgram::integer_type
+hdrgram::total_event_time_ns_raw() const STLSOFT_NOEXCEPT
+{
+    return m_total_event_time_ns;
+}
+
+inline
+bool
+hdrgram::try_get_min_event_time_ns(
+    integer_type* value
+) const STLSOFT_NOEXCEPT
+{
+    STLSOFT_ASSERT(ss_nullptr_k != value);
+
+    if (0 != m_event_count)
+    {
+        *value = m_min_event_time_ns;
+
+        return true;
+    }
+    else
+    {
+        *value = 0;
+
+        return false;
+    }
+}
+
+inline
+bool
+hdrgram::try_get_max_event_time_ns(
+    integer_type* value
+) const STLSOFT_NOEXCEPT
+{
+    STLSOFT_ASSERT(ss_nullptr_k != value);
+
+    if (0 != m_event_count)
+    {
+        *value = m_max_event_time_ns;
+
+        return true;
+    }
+    else
+    {
+        *value = 0;
+
+        return false;
+    }
+}
+
+inline
+hdrgram::integer_type
+hdrgram::value_at_quantile(
+    double quantile
+) const STLSOFT_NOEXCEPT
+{
+    if (0 == m_event_count)
+    {
+        return 0;
+    }
+
+    if (!(quantile > 0.0))
+    {
+        return m_min_event_time_ns;
+    }
+
+    if (quantile >= 1.0)
+    {
+        return m_max_event_time_ns;
+    }
+
+    // the (1-based) rank of the event at the quantile, rounded to the
+    // nearest so as to be immune to representation error in the quantile
+    // (e.g. 99.9 / 100.0 > 0.999)
+
+    integer_type rank = static_cast<integer_type>(quantile * static_cast<double>(m_event_count) + 0.5);
+
+    if (0 == rank)
+    {
+        rank = 1;
+    }
+
+    integer_type    cumulative  =   0;
+    size_type const n           =   m_counts.size();
+
+    for (size_type i = 0; i != n; ++i)
+    {
+        cumulative += m_counts[i];
+
+        if (cumulative >= rank)
+        {
+            integer_type const v = bucket_highest_value(i);
+
+            if (v < m_min_event_time_ns)
+            {
+                return m_min_event_time_ns;
+            }
+
+            if (v > m_max_event_time_ns)
+            {
+                return m_max_event_time_ns;
+            }
+
+            return v;
+        }
+    }
+
+    return m_max_event_time_ns;
+}
+
+inline
+hdrgram::integer_type
+hdrgram::value_at_percentile(
+    double percentile
+) const STLSOFT_NOEXCEPT
+{
+    return value_at_quantile(percentile / 100.0);
+}
+
+inline
+bool
+hdrgram::has_overflowed() const STLSOFT_NOEXCEPT
+{
+    return m_has_overflowed;
+}
+
+
+// bucket accessors
+
+inline
+unsigned
+hdrgram::sub_bucket_bits() const STLSOFT_NOEXCEPT
+{
+    return m_sub_bucket_bits;
+}
+
+inline
+hdrgram::size_type
+hdrgram::num_buckets() const STLSOFT_NOEXCEPT
+{
+    return m_counts.size();
+}
+
+inline
+hdrgram::size_type
+hdrgram::bucket_index(
+    integer_type value
+) const STLSOFT_NOEXCEPT
+{
+    if (value < m_sub_bucket_count)
+    {
+        return static_cast<size_type>(value);
+    }
+    else
+    {
+        // For a value whose highest set bit is at (0-based) position m,
+        // where m >= b, the bucket group is g = m - b + 1, and the
+        // sub-bucket is the b bits following the highest set bit
+
+        unsigned const      msb     =   stlsoft_C_find_highest_bit_in_64bit_unsigned_integer(value) - 1u;
+        unsigned const      shift   =   msb - m_sub_bucket_bits;
+        integer_type const  group   =   shift + 1u;
+        integer_type const  sub     =   (value >> shift) - m_sub_bucket_count;
+
+        return static_cast<size_type>((group << m_sub_bucket_bits) + sub);
+    }
+}
+
+inline
+hdrgram::integer_type
+hdrgram::num_events_in_bucket(
+    size_type index
+) const STLSOFT_NOEXCEPT
+{
+    STLSOFT_ASSERT(index < m_counts.size());
+
+    return m_counts[index];
+}
+
+inline
+hdrgram::integer_type
+hdrgram::bucket_lowest_value(
+    size_type index
+) const STLSOFT_NOEXCEPT
+{
+    STLSOFT_ASSERT(index < m_counts.size());
+
+    integer_type const group = static_cast<integer_type>(index) >> m_sub_bucket_bits;
+
+    if (0 == group)
+    {
+        return static_cast<integer_type>(index);
+    }
+    else
+    {
+        integer_type const sub = static_cast<integer_type>(index) & (m_sub_bucket_count - 1);
+
+        return (m_sub_bucket_count + sub) << (group - 1);
+    }
+}
+
+inline
+hdrgram::integer_type
+hdrgram::bucket_highest_value(
+    size_type index
+) const STLSOFT_NOEXCEPT
+{
+    STLSOFT_ASSERT(index < m_counts.size());
+
+    integer_type const group = static_cast<integer_type>(index) >> m_sub_bucket_bits;
+
+    if (0 == group)
+    {
+        return static_cast<integer_type>(index);
+    }
+    else
+    {
+        return bucket_lowest_value(index) + ((integer_type(1) << (group - 1)) - 1);
+    }
+}
+
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef STLSOFT_NO_NAMESPACE
+} /* namespace stlsoft */
+#endif /* STLSOFT_NO_NAMESPACE */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !STLSOFT_INCL_STLSOFT_DIAGNOSTICS_HPP_HDRGRAM */
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -4,11 +4,11 @@
  * Purpose: Definition of stlsoft::read_line() function template.
  *
  * Created: 2nd January 2007
- * Updated: 10th October 2024
+ * Updated: 16th October 2026
  *
  * Home:    http://stlsoft.org/
  *
- * Copyright (c) 2019-2024, Matthew Wilson and Synesis Information Systems
+ * Copyright (c) 2019-2026, Matthew Wilson and Synesis Information Systems
  * Copyright (c) 2007-2019, Matthew Wilson and Synesis Software
  * All rights reserved.
  *
@@ -53,9 +53,9 @@
 
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 # define STLSOFT_VER_STLSOFT_FILESYSTEM_IO_FUNCTIONS_HPP_READ_LINE_MAJOR    3
-# define STLSOFT_VER_STLSOFT_FILESYSTEM_IO_FUNCTIONS_HPP_READ_LINE_MINOR    0
-# define STLSOFT_VER_STLSOFT_FILESYSTEM_IO_FUNCTIONS_HPP_READ_LINE_REVISION 3
-# define STLSOFT_VER_STLSOFT_FILESYSTEM_IO_FUNCTIONS_HPP_READ_LINE_EDIT     29
+# define STLSOFT_VER_STLSOFT_FILESYSTEM_IO_FUNCTIONS_HPP_READ_LINE_MINOR    1
+# define STLSOFT_VER_STLSOFT_FILESYSTEM_IO_FUNCTIONS_HPP_READ_LINE_REVISION 0
+# define STLSOFT_VER_STLSOFT_FILESYSTEM_IO_FUNCTIONS_HPP_READ_LINE_EDIT     30
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 
@@ -79,6 +79,27 @@
 # define STLSOFT_INCL_H_STDIO
 # include <stdio.h>
 #endif /* !STLSOFT_INCL_H_STDIO */
+#ifndef STLSOFT_INCL_H_STRING
+# define STLSOFT_INCL_H_STRING
+# include <string.h>
+#endif /* !STLSOFT_INCL_H_STRING */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#if 0
+#elif defined(STLSOFT_COMPILER_IS_MSVC) && \
+      STLSOFT_MSVC_VER >= 0x08000000
+# define STLSOFT_FILESYSTEM_READ_LINE_HAS_MSVC_NOLOCK_
+#elif defined(unix) || \
+      defined(__unix) || \
+      defined(__unix__) || \
+      (   defined(__APPLE__) && \
+          defined(__MACH__))
+# define STLSOFT_FILESYSTEM_READ_LINE_HAS_POSIX_UNLOCKED_
+#endif
 
 
 /* /////////////////////////////////////////////////////////////////////////
@@ -177,6 +198,94 @@ namespace readers
         FILE* const m_stm;
     };
 
+    /* Reads from a C stream whose lock is held by the caller, via the
+     * non-locking character functions (where available), avoiding the
+     * lock/unlock on every character that is incurred by fgetc()
+     */
+    class read_from_locked_FILE
+    {
+    public: // types
+        typedef read_from_locked_FILE   class_type;
+
+    public:
+        ss_explicit_k read_from_locked_FILE(FILE* stm) STLSOFT_NOEXCEPT
+            : m_stm(stm)
+        {}
+        read_from_locked_FILE(class_type const& rhs) STLSOFT_NOEXCEPT
+            : m_stm(rhs.m_stm)
+        {}
+    private:
+        void operator =(class_type const&) STLSOFT_COPY_ASSIGNMENT_PROSCRIBED;
+
+    public: // operations
+        int read_char() STLSOFT_NOEXCEPT
+        {
+#if 0
+#elif defined(STLSOFT_FILESYSTEM_READ_LINE_HAS_MSVC_NOLOCK_)
+            return ::_getc_nolock(m_stm);
+#elif defined(STLSOFT_FILESYSTEM_READ_LINE_HAS_POSIX_UNLOCKED_)
+            return getc_unlocked(m_stm);
+#else
+            return ::fgetc(m_stm);
+#endif
+        }
+
+        int peek_next_char() STLSOFT_NOEXCEPT
+        {
+            int ch = read_char();
+
+            if (EOF != ch)
+            {
+#if 0
+#elif defined(STLSOFT_FILESYSTEM_READ_LINE_HAS_MSVC_NOLOCK_)
+                ::_ungetc_nolock(ch, m_stm);
+#else
+                ::ungetc(ch, m_stm);
+#endif
+            }
+
+            return ch;
+        }
+
+    private: // fields
+        FILE* const m_stm;
+    };
+
+    /* Scoping class that holds the lock of a C stream for its lifetime
+     */
+    class FILE_lock_scope
+    {
+    public: // types
+        typedef FILE_lock_scope         class_type;
+
+    public:
+        ss_explicit_k FILE_lock_scope(FILE* stm) STLSOFT_NOEXCEPT
+            : m_stm(stm)
+        {
+#if 0
+#elif defined(STLSOFT_FILESYSTEM_READ_LINE_HAS_MSVC_NOLOCK_)
+            ::_lock_file(m_stm);
+#elif defined(STLSOFT_FILESYSTEM_READ_LINE_HAS_POSIX_UNLOCKED_)
+            ::flockfile(m_stm);
+#endif
+        }
+        ~FILE_lock_scope() STLSOFT_NOEXCEPT
+        {
+#if 0
+#elif defined(STLSOFT_FILESYSTEM_READ_LINE_HAS_MSVC_NOLOCK_)
+            ::_unlock_file(m_stm);
+#elif defined(STLSOFT_FILESYSTEM_READ_LINE_HAS_POSIX_UNLOCKED_)
+            ::funlockfile(m_stm);
+#endif
+        }
+    private:
+        FILE_lock_scope(class_type const&) STLSOFT_COPY_CONSTRUCTION_PROSCRIBED;
+        void operator =(class_type const&) STLSOFT_COPY_ASSIGNMENT_PROSCRIBED;
+
+    private: // fields
+        FILE* const m_stm;
+    };
+
     template <
         ss_typename_param_k I
     >
@@ -299,16 +408,289 @@ namespace readers
             }
         }
 
+    public: // contiguous access
+        char const* span_begin() const STLSOFT_NOEXCEPT
+        {
+            return m_buffer + m_current;
+        }
+        char const* span_end() const STLSOFT_NOEXCEPT
+        {
+            return m_buffer + m_size;
+        }
+        void consume_to(char const* p) STLSOFT_NOEXCEPT
+        {
+            STLSOFT_ASSERT(p >= span_begin() && p <= span_end());
+
+            m_current = static_cast<ss_size_t>(p - m_buffer);
+        }
+
     private: // fields
         char const* const   m_buffer;
         ss_size_t const     m_size;
         ss_size_t           m_current;
     };
 
+    class read_from_char_range
+    {
+    public: // types
+        typedef read_from_char_range    class_type;
+
+    public: // construction
+        read_from_char_range(char const* from, char const* to) STLSOFT_NOEXCEPT
+            : m_from(from)
+            , m_to(to)
+        {}
+        read_from_char_range(class_type const& rhs) STLSOFT_NOEXCEPT
+            : m_from(rhs.m_from)
+            , m_to(rhs.m_to)
+        {}
+    private:
+        void operator =(class_type const&) STLSOFT_COPY_ASSIGNMENT_PROSCRIBED;
+
+    public: // operations
+        int read_char() STLSOFT_NOEXCEPT
+        {
+            if (m_from == m_to)
+            {
+                return -1;
+            }
+            else
+            {
+                return *m_from++;
+            }
+        }
+
+        int peek_next_char() STLSOFT_NOEXCEPT
+        {
+            if (m_from == m_to)
+            {
+                return -1;
+            }
+            else
+            {
+                return *m_from;
+            }
+        }
+
+    public: // contiguous access
+        char const* span_begin() const STLSOFT_NOEXCEPT
+        {
+            return m_from;
+        }
+        char const* span_end() const STLSOFT_NOEXCEPT
+        {
+            return m_to;
+        }
+        void consume_to(char const* p) STLSOFT_NOEXCEPT
+        {
+            STLSOFT_ASSERT(p >= m_from && p <= m_to);
+
+            m_from = p;
+        }
+
+    private: // fields
+        char const*         m_from;
+        char const* const   m_to;
+    };
+
 } /* namespace readers */
 
 namespace read_line_impl
 {
+    /* Accumulates characters into a local buffer, appending them to the
+     * line in blocks, rather than one at a time
+     */
+    template <ss_typename_param_k S>
+    class line_appender
+    {
+    public: // types
+        typedef line_appender<S>        class_type;
+
+    public:
+        ss_explicit_k line_appender(S& line) STLSOFT_NOEXCEPT
+            : m_line(line)
+            , m_len(0)
+        {}
+    private:
+        line_appender(class_type const&) STLSOFT_COPY_CONSTRUCTION_PROSCRIBED;
+        void operator =(class_type const&) STLSOFT_COPY_ASSIGNMENT_PROSCRIBED;
+
+    public: // operations
+        void push(char ch)
+        {
+            if (STLSOFT_NUM_ELEMENTS(m_buffer) == m_len)
+            {
+                flush();
+            }
+
+            m_buffer[m_len++] = ch;
+        }
+        void push(ss_size_t n, char ch)
+        {
+            if (0 != n)
+            {
+                flush();
+
+                m_line.append(n, ch);
+            }
+        }
+        void flush()
+        {
+            if (0 != m_len)
+            {
+                m_line.append(&m_buffer[0], m_len);
+
+                m_len = 0;
+            }
+        }
+
+    private: // fields
+        S&          m_line;
+        ss_size_t   m_len;
+        char        m_buffer[256];
+    };
+
+    /* Locates the first CR or LF in [from, to), or returns to
+     */
+    inline
+    char const*
+    find_cr_or_lf(
+        char const* from
+    ,   char const* to
+    ) STLSOFT_NOEXCEPT
+    {
+        ss_size_t const     n   =   static_cast<ss_size_t>(to - from);
+        char const* const   lf  =   static_cast<char const*>(::memchr(from, '\n', n));
+        char const* const   end =   (NULL == lf) ? to : lf;
+        char const* const   cr  =   static_cast<char const*>(::memchr(from, '\r', static_cast<ss_size_t>(end - from)));
+
+        return (NULL == cr) ? end : cr;
+    }
+
+    /* Reads a line from a policy that provides contiguous access to its
+     * characters, by searching (with the library's memchr()) for each
+     * CR/LF and appending the line in one operation
+     *
+     * The results are identical to those of the char-by-char form, below,
+     * including that trailing literal CRs at the end of the input are
+     * discarded.
+     */
+    template <
+        ss_typename_param_k S
+    ,   ss_typename_param_k P
+    >
+    static
+    ss_bool_t
+    read_line_from_span(
+        P&                          policy
+    ,   S&                          line
+    ,   read_line_flags::flags_t    flags
+    )
+    {
+        if (0 == (read_line_flags::mask & flags))
+        {
+            flags = read_line_flags::recogniseAll;
+        }
+
+        S().swap(line);
+
+        char const* const   b   =   policy.span_begin();
+        char const* const   e   =   policy.span_end();
+
+        for (char const* p = b; ; )
+        {
+            char const* const q = find_cr_or_lf(p, e);
+
+            if (e == q)
+            {
+                char const* t = e;
+
+                for (; b != t && '\r' == t[-1]; --t)
+                {}
+
+                if (b != t)
+                {
+                    line.append(b, static_cast<ss_size_t>(t - b));
+                }
+
+                policy.consume_to(e);
+
+                return !line.empty();
+            }
+
+            char const* eol     =   NULL;
+            char const* next    =   NULL;
+
+            if ('\n' == *q)
+            {
+                if (read_line_flags::recogniseLfAsEOL & flags)
+                {
+                    eol     =   q;
+                    next    =   q + 1;
+                }
+            }
+            else
+            {
+                if ((read_line_flags::recogniseCrLfAsEOL & flags) &&
+                    q + 1 != e &&
+                    '\n' == q[1])
+                {
+                    eol     =   q;
+                    next    =   q + 2;
+                }
+                else if (read_line_flags::recogniseCrAsEOL & flags)
+                {
+                    eol     =   q;
+                    next    =   q + 1;
+                }
+            }
+
+            if (NULL != eol)
+            {
+                if (b != eol)
+                {
+                    line.append(b, static_cast<ss_size_t>(eol - b));
+                }
+
+                policy.consume_to(next);
+
+                return true;
+            }
+
+            // a literal CR or LF, so keep looking
+
+            p = q + 1;
+        }
+    }
+
+    template <
+        ss_typename_param_k S
+    >
+    static
+    ss_bool_t
+    read_line(
+        readers::read_from_char_buffer& policy
+    ,   S&                              line
+    ,   read_line_flags::flags_t        flags
+    )
+    {
+        return read_line_from_span(policy, line, flags);
+    }
+
+    template <
+        ss_typename_param_k S
+    >
+    static
+    ss_bool_t
+    read_line(
+        readers::read_from_char_range&  policy
+    ,   S&                              line
+    ,   read_line_flags::flags_t        flags
+    )
+    {
+        return read_line_from_span(policy, line, flags);
+    }
+
     template <
         ss_typename_param_k S
     ,   ss_typename_param_k P
@@ -330,6 +712,8 @@ namespace read_line_impl
 
         S().swap(line);
 
+        line_appender<S> appender(line);
+
         { for (int ch; EOF != (ch = policy.read_char()); )
         {
             switch (ch)
@@ -355,7 +739,8 @@ namespace read_line_impl
                         {
                             policy.read_char();
 
-                            line.append(numCr, '\r');
+                            appender.push(numCr, '\r');
+                            appender.flush();
 
                             return true;
                         }
@@ -363,6 +748,8 @@ namespace read_line_impl
 
                     if (read_line_flags::recogniseCrAsEOL & flags)
                     {
+                        appender.flush();
+
                         return true;
                     }
                 }
@@ -387,13 +774,15 @@ namespace read_line_impl
                     // characters in the line, and then return the
                     // line
 
-                    line.append(numCr - 1, '\r');
+                    appender.push(numCr - 1, '\r');
+                    appender.flush();
 
                     return true;
                 }
                 else if (read_line_flags::recogniseLfAsEOL & flags)
                 {
-                    line.append(numCr, '\r');
+                    appender.push(numCr, '\r');
+                    appender.flush();
 
                     return true;
                 }
@@ -403,7 +792,7 @@ namespace read_line_impl
 
                 if (numCr > 0)
                 {
-                    line.append(numCr, '\r');
+                    appender.push(numCr, '\r');
 
                     numCr = 0;
                 }
@@ -411,9 +800,11 @@ namespace read_line_impl
                 break;
             }
 
-            line.append(1, static_cast<char>(ch));
+            appender.push(static_cast<char>(ch));
         }}
 
+        appender.flush();
+
         return !line.empty();
     }
 
@@ -433,8 +824,8 @@ namespace read_line_impl
  * \param line The object into which the next line is read. Must be an
  *   instance of a type that is structurally conformant to `std::string` in
  *   the following ways: it has a default constructor; it has a `swap()`
- *   method; and it has a block `append()` method (taking repeat count and
- *   character to add)
+ *   method; and it has block `append()` methods (taking repeat count and
+ *   character to add, and taking pointer and length)
  * \param flags The flags that control what line-termination sequences are
  *   recognised
  *
@@ -446,6 +837,10 @@ namespace read_line_impl
  *   line-termination sequences: carriage-return (<code>'\\r'</code>),
  *   line-feed (<code>'\\n'</code>), or carriage-return+line-feed
  *   (<code>"\\r\\n"</code>).
+ *
+ * \remarks The stream is locked for the duration of the call, and read
+ *   with the non-locking character functions where the platform provides
+ *   them.
  */
 template <
     ss_typename_param_k S
@@ -457,7 +852,8 @@ read_line(
 ,   read_line_flags::flags_t    flags = read_line_flags::recogniseAll
 )
 {
-    readers::read_from_FILE  policy(stm);
+    readers::FILE_lock_scope        scope(stm);
+    readers::read_from_locked_FILE  policy(stm);
 
     return read_line_impl::read_line(policy, line, flags);
 }
@@ -472,8 +868,8 @@ read_line(
  * \param line The object into which the next line is read. Must be an
  *   instance of a type that is structurally conformant to `std::string` in
  *   the following ways: it has a default constructor; it has a `swap()`
- *   method; and it has a block `append()` method (taking repeat count and
- *   character to add)
+ *   method; and it has block `append()` methods (taking repeat count and
+ *   character to add, and taking pointer and length)
  * \param flags The flags that control what line-termination sequences are
  *   recognised
  *
@@ -496,6 +892,53 @@ read_line(
     return read_line_impl::read_line(policy, line, flags);
 }
 
+/** Reads a line from a contiguous range of characters
+ *
+ * \tparam S Type of the string into which to read
+ *
+ * This overload searches the range for line-ends a block at a time, and
+ * appends the line in one operation.
+ *
+ * \see read_line(I, I, S&, read_line_flags::flags_t)
+ */
+template <
+    ss_typename_param_k S
+>
+ss_bool_t
+read_line(
+    char const*                 from
+,   char const*                 to
+,   S&                          line
+,   read_line_flags::flags_t    flags = read_line_flags::recogniseAll
+)
+{
+    readers::read_from_char_range policy(from, to);
+
+    return read_line_impl::read_line(policy, line, flags);
+}
+
+/** Reads a line from a contiguous range of characters
+ *
+ * \tparam S Type of the string into which to read
+ *
+ * \see read_line(char const*, char const*, S&, read_line_flags::flags_t)
+ */
+template <
+    ss_typename_param_k S
+>
+ss_bool_t
+read_line(
+    char*                       from
+,   char*                       to
+,   S&                          line
+,   read_line_flags::flags_t    flags = read_line_flags::recogniseAll
+)
+{
+    readers::read_from_char_range policy(from, to);
+
+    return read_line_impl::read_line(policy, line, flags);
+}
+
 
 /* /////////////////////////////////////////////////////////////////////////
  * namespace
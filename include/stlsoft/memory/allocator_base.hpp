@@ -4,7 +4,7 @@
  * Purpose:     Allocator commmon features.
  *
  * Created:     20th August 2003
- * Updated:     11th March 2024
+ * Updated:     16th October 2026
  *
  * Home:        http://stlsoft.org/
  *
@@ -55,7 +55,7 @@
 # define STLSOFT_VER_STLSOFT_MEMORY_HPP_ALLOCATOR_BASE_MAJOR    4
 # define STLSOFT_VER_STLSOFT_MEMORY_HPP_ALLOCATOR_BASE_MINOR    1
 # define STLSOFT_VER_STLSOFT_MEMORY_HPP_ALLOCATOR_BASE_REVISION 16
-# define STLSOFT_VER_STLSOFT_MEMORY_HPP_ALLOCATOR_BASE_EDIT     67
+# define STLSOFT_VER_STLSOFT_MEMORY_HPP_ALLOCATOR_BASE_EDIT     69
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 
@@ -124,9 +124,12 @@ namespace stlsoft
  * - <code>void do_deallocate(void* pv);</code> - deallocates the memory block
  *    pointed to by <code>pv</code>.
  *
- * \see stlsoft::malloc_allocator |
+ * \see stlsoft::arena_allocator |
+ *      stlsoft::counting_allocator_adaptor |
+ *      stlsoft::malloc_allocator |
  *      stlsoft::new_allocator |
  *      stlsoft::null_allocator |
+ *      stlsoft::pool_allocator |
  *      comstl::task_allocator |
  *      mfcstl::afx_allocator |
  *      winstl::global_allocator |
@@ -0,0 +1,619 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    stlsoft/memory/counting_allocator_adaptor.hpp
+ *
+ * Purpose: counting_allocator_adaptor class template - an allocator adaptor
+ *          that records allocation counts, sizes and peak usage.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * Home:    http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+
+/* STLSOFT:C++98:FILE_EXCEPTED */
+/* STLSOFT:C++03:FILE_EXCEPTED */
+
+/** \file stlsoft/memory/counting_allocator_adaptor.hpp
+ *
+ * \brief [C++] Definition of the stlsoft::counting_allocator_adaptor class
+ *   template and its counters
+ *   (\ref group__library__Memory "Memory" Library).
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_MEMORY_HPP_COUNTING_ALLOCATOR_ADAPTOR
+#define STLSOFT_INCL_STLSOFT_MEMORY_HPP_COUNTING_ALLOCATOR_ADAPTOR
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define STLSOFT_VER_STLSOFT_MEMORY_HPP_COUNTING_ALLOCATOR_ADAPTOR_MAJOR    1
+# define STLSOFT_VER_STLSOFT_MEMORY_HPP_COUNTING_ALLOCATOR_ADAPTOR_MINOR    0
+# define STLSOFT_VER_STLSOFT_MEMORY_HPP_COUNTING_ALLOCATOR_ADAPTOR_REVISION 0
+# define STLSOFT_VER_STLSOFT_MEMORY_HPP_COUNTING_ALLOCATOR_ADAPTOR_EDIT     1
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_H_STLSOFT
+# include <stlsoft/stlsoft.h>
+#endif /* !STLSOFT_INCL_STLSOFT_H_STLSOFT */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+#ifndef STLSOFT_INCL_STLSOFT_MEMORY_HPP_ALLOCATOR_BASE
+# include <stlsoft/memory/allocator_base.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_MEMORY_HPP_ALLOCATOR_BASE */
+#ifndef STLSOFT_INCL_STLSOFT_UTIL_BITS_H_TEST_FUNCTIONS
+# include <stlsoft/util/bits/test_functions.h>
+#endif /* !STLSOFT_INCL_STLSOFT_UTIL_BITS_H_TEST_FUNCTIONS */
+
+#ifndef STLSOFT_INCL_ATOMIC
+# define STLSOFT_INCL_ATOMIC
+# include <atomic>
+#endif /* !STLSOFT_INCL_ATOMIC */
+#ifndef STLSOFT_INCL_MEMORY
+# define STLSOFT_INCL_MEMORY
+# include <memory>
+#endif /* !STLSOFT_INCL_MEMORY */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef STLSOFT_NO_NAMESPACE
+namespace stlsoft
+{
+#endif /* STLSOFT_NO_NAMESPACE */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * classes
+ */
+
+/** A snapshot of the allocation activity recorded by a set of counters
+ *
+ * \ingroup group__library__Memory
+ *
+ * In the manner of \link stlsoft::doomgram doomgram\endlink, allocation
+ * sizes are counted in order-of-magnitude size classes - binary, rather
+ * than decimal, since that is how allocators usually round. Size class
+ * 0 counts zero-byte requests; size class <em>i</em> (for 0 < <em>i</em>
+ * < <code>num_size_classes - 1</code>) counts requests of
+ * [2<sup><em>i</em>-1</sup>, 2<sup><em>i</em></sup>) bytes; and the last
+ * size class counts all larger requests.
+ */
+class allocation_profile
+{
+public: // types
+    /// This type
+    typedef allocation_profile                              class_type;
+    /// The size type
+    typedef ss_size_t                                       size_type;
+
+public: // constants
+    enum {
+        /// The number of size classes
+        num_size_classes = 32
+    };
+
+public: // construction
+    /// Constructs an empty profile
+    allocation_profile() STLSOFT_NOEXCEPT
+        : num_allocations(0)
+        , num_deallocations(0)
+        , num_unsized_deallocations(0)
+        , bytes_allocated(0)
+        , bytes_in_flight(0)
+        , peak_bytes_in_flight(0)
+    {
+        for (int i = 0; i != num_size_classes; ++i)
+        {
+            num_allocations_in_size_class[i] = 0;
+        }
+    }
+
+public: // size classes
+    /// The size class of an allocation of the given number of bytes
+    static int size_class_of(size_type cb) STLSOFT_NOEXCEPT
+    {
+        unsigned const bit = stlsoft_C_find_highest_bit_in_64bit_unsigned_integer(static_cast<ss_uint64_t>(cb));
+
+        return (bit < unsigned(num_size_classes)) ? int(bit) : (num_size_classes - 1);
+    }
+    /// The smallest number of bytes counted in the given size class
+    static size_type size_class_lower_bound(int index) STLSOFT_NOEXCEPT
+    {
+        STLSOFT_ASSERT(index >= 0 && index < num_size_classes);
+
+        return (0 == index) ? 0 : (size_type(1) << (index - 1));
+    }
+
+public: // fields
+    /// The number of allocations
+    size_type   num_allocations;
+    /// The number of deallocations
+    size_type   num_deallocations;
+    /// The number of deallocations whose size was not known, and which
+    /// could not, therefore, be subtracted from \c bytes_in_flight
+    size_type   num_unsized_deallocations;
+    /// The total number of bytes allocated
+    size_type   bytes_allocated;
+    /// The number of bytes allocated and not (known to be) deallocated
+    size_type   bytes_in_flight;
+    /// The highest value of \c bytes_in_flight
+    size_type   peak_bytes_in_flight;
+    /// The number of allocations in each size class
+    size_type   num_allocations_in_size_class[num_size_classes];
+};
+
+
+/** Non-thread-safe counters for
+ *   \link stlsoft::counting_allocator_adaptor counting_allocator_adaptor\endlink
+ *
+ * \ingroup group__library__Memory
+ *
+ * \see stlsoft::concurrent_counting_allocator_counters
+ */
+class counting_allocator_counters
+{
+public: // types
+    /// This type
+    typedef counting_allocator_counters                     class_type;
+    /// The size type
+    typedef ss_size_t                                       size_type;
+    /// The profile type
+    typedef allocation_profile                              profile_type;
+
+public: // construction
+    /// Constructs an instance with all counters zero
+    counting_allocator_counters() STLSOFT_NOEXCEPT
+    {}
+private:
+    counting_allocator_counters(class_type const&) STLSOFT_COPY_CONSTRUCTION_PROSCRIBED;
+    void operator =(class_type const&) STLSOFT_COPY_ASSIGNMENT_PROSCRIBED;
+
+public: // operations
+    /// Records an allocation of the given number of bytes
+    void on_allocate(size_type cb) STLSOFT_NOEXCEPT
+    {
+        ++m_profile.num_allocations;
+        ++m_profile.num_allocations_in_size_class[profile_type::size_class_of(cb)];
+
+        m_profile.bytes_allocated += cb;
+        m_profile.bytes_in_flight += cb;
+
+        if (m_profile.bytes_in_flight > m_profile.peak_bytes_in_flight)
+        {
+            m_profile.peak_bytes_in_flight = m_profile.bytes_in_flight;
+        }
+    }
+    /// Records a deallocation of the given number of bytes, or of an
+    /// unknown number if \c cb is 0
+    void on_deallocate(size_type cb) STLSOFT_NOEXCEPT
+    {
+        ++m_profile.num_deallocations;
+
+        if (0 == cb)
+        {
+            ++m_profile.num_unsized_deallocations;
+        }
+        else
+        {
+            STLSOFT_ASSERT(cb <= m_profile.bytes_in_flight);
+
+            m_profile.bytes_in_flight -= cb;
+        }
+    }
+    /// Resets all counters
+    void clear() STLSOFT_NOEXCEPT
+    {
+        m_profile = profile_type();
+    }
+
+public: // accessors
+    /// A snapshot of the counters
+    profile_type profile() const STLSOFT_NOEXCEPT
+    {
+        return m_profile;
+    }
+
+private: // fields
+    profile_type    m_profile;
+};
+
+
+/** Thread-safe counters for
+ *   \link stlsoft::counting_allocator_adaptor counting_allocator_adaptor\endlink
+ *
+ * \ingroup group__library__Memory
+ *
+ * The counters are relaxed atomics, so recording is lock-free, but every
+ * allocation and deallocation performs three or four atomic
+ * read-modify-write operations on shared cache lines. It is therefore
+ * intended for finding allocation hot spots under load, rather than for
+ * permanent instrumentation of highly contended code.
+ *
+ * \note A profile taken while other threads are allocating is not a
+ *   single point-in-time view: each counter is read atomically, but the
+ *   set of counters is not.
+ *
+ * \see stlsoft::counting_allocator_counters
+ */
+class concurrent_counting_allocator_counters
+{
+public: // types
+    /// This type
+    typedef concurrent_counting_allocator_counters          class_type;
+    /// The size type
+    typedef ss_size_t                                       size_type;
+    /// The profile type
+    typedef allocation_profile                              profile_type;
+private:
+    typedef std::atomic<size_type>                          atomic_size_type_;
+
+    enum { num_size_classes_ = profile_type::num_size_classes };
+
+public: // construction
+    /// Constructs an instance with all counters zero
+    concurrent_counting_allocator_counters() STLSOFT_NOEXCEPT
+        : m_numAllocations(0)
+        , m_numDeallocations(0)
+        , m_numUnsizedDeallocations(0)
+        , m_bytesAllocated(0)
+        , m_bytesInFlight(0)
+        , m_peakBytesInFlight(0)
+    {
+        for (int i = 0; i != num_size_classes_; ++i)
+        {
+            m_numAllocationsInSizeClass[i].store(0, std::memory_order_relaxed);
+        }
+    }
+private:
+    concurrent_counting_allocator_counters(class_type const&) STLSOFT_COPY_CONSTRUCTION_PROSCRIBED;
+    void operator =(class_type const&) STLSOFT_COPY_ASSIGNMENT_PROSCRIBED;
+
+public: // operations
+    /// Records an allocation of the given number of bytes
+    void on_allocate(size_type cb) STLSOFT_NOEXCEPT
+    {
+        m_numAllocations.fetch_add(1, std::memory_order_relaxed);
+        m_numAllocationsInSizeClass[profile_type::size_class_of(cb)].fetch_add(1, std::memory_order_relaxed);
+        m_bytesAllocated.fetch_add(cb, std::memory_order_relaxed);
+
+        size_type const inFlight    =   m_bytesInFlight.fetch_add(cb, std::memory_order_relaxed) + cb;
+        size_type       peak        =   m_peakBytesInFlight.load(std::memory_order_relaxed);
+
+        for (; peak < inFlight && !m_peakBytesInFlight.compare_exchange_weak(peak, inFlight, std::memory_order_relaxed); )
+        {}
+    }
+    /// Records a deallocation of the given number of bytes, or of an
+    /// unknown number if \c cb is 0
+    void on_deallocate(size_type cb) STLSOFT_NOEXCEPT
+    {
+        m_numDeallocations.fetch_add(1, std::memory_order_relaxed);
+
+        if (0 == cb)
+        {
+            m_numUnsizedDeallocations.fetch_add(1, std::memory_order_relaxed);
+        }
+        else
+        {
+            m_bytesInFlight.fetch_sub(cb, std::memory_order_relaxed);
+        }
+    }
+    /// Resets all counters
+    ///
+    /// \note Should not be called while other threads are allocating
+    void clear() STLSOFT_NOEXCEPT
+    {
+        m_numAllocations.store(0, std::memory_order_relaxed);
+        m_numDeallocations.store(0, std::memory_order_relaxed);
+        m_numUnsizedDeallocations.store(0, std::memory_order_relaxed);
+        m_bytesAllocated.store(0, std::memory_order_relaxed);
+        m_bytesInFlight.store(0, std::memory_order_relaxed);
+        m_peakBytesInFlight.store(0, std::memory_order_relaxed);
+
+        for (int i = 0; i != num_size_classes_; ++i)
+        {
+            m_numAllocationsInSizeClass[i].store(0, std::memory_order_relaxed);
+        }
+    }
+
+public: // accessors
+    /// A snapshot of the counters
+    profile_type profile() const STLSOFT_NOEXCEPT
+    {
+        profile_type r;
+
+        r.num_allocations           =   m_numAllocations.load(std::memory_order_relaxed);
+        r.num_deallocations         =   m_numDeallocations.load(std::memory_order_relaxed);
+        r.num_unsized_deallocations =   m_numUnsizedDeallocations.load(std::memory_order_relaxed);
+        r.bytes_allocated           =   m_bytesAllocated.load(std::memory_order_relaxed);
+        r.bytes_in_flight           =   m_bytesInFlight.load(std::memory_order_relaxed);
+        r.peak_bytes_in_flight      =   m_peakBytesInFlight.load(std::memory_order_relaxed);
+
+        for (int i = 0; i != num_size_classes_; ++i)
+        {
+            r.num_allocations_in_size_class[i] = m_numAllocationsInSizeClass[i].load(std::memory_order_relaxed);
+        }
+
+        return r;
+    }
+
+private: // fields
+    atomic_size_type_   m_numAllocations;
+    atomic_size_type_   m_numDeallocations;
+    atomic_size_type_   m_numUnsizedDeallocations;
+    atomic_size_type_   m_bytesAllocated;
+    atomic_size_type_   m_bytesInFlight;
+    atomic_size_type_   m_peakBytesInFlight;
+    atomic_size_type_   m_numAllocationsInSizeClass[num_size_classes_];
+};
+
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+namespace ximpl_counting_allocator_adaptor {
+
+    template<
+        ss_typename_param_k T_tag
+    ,   ss_typename_param_k T_counters
+    >
+    T_counters&
+    counters_instance() STLSOFT_NOEXCEPT
+    {
+        static T_counters s_counters;
+
+        return s_counters;
+    }
+} // namespace ximpl_counting_allocator_adaptor
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+
+/** STL Allocator adaptor that records the allocation activity of the
+ *   allocator it wraps
+ *
+ * \ingroup group__library__Memory
+ *
+ * \param A The underlying allocator. It is rebound, via
+ *   <code>std::allocator_traits</code>, as required
+ * \param T_tag A type that identifies the set of counters. All
+ *   specialisations with the same \c T_tag and \c T_counters - whatever
+ *   their value type or underlying allocator - share a set of counters.
+ *   Defaults to \c void
+ * \param T_counters The counters type, which must provide
+ *   <code>on_allocate(cb)</code> and <code>on_deallocate(cb)</code>.
+ *   Defaults to
+ *   \link stlsoft::counting_allocator_counters counting_allocator_counters\endlink;
+ *   use
+ *   \link stlsoft::concurrent_counting_allocator_counters concurrent_counting_allocator_counters\endlink
+ *   when allocating from multiple threads
+ *
+ * Because the counters are shared, per-\c T_tag, rather than held in the
+ * instance, the adaptor is as stateless as \c A, and so may be used as the
+ * allocator parameter of the STLSoft containers (which default-construct
+ * their allocators) as well as of the standard containers, e.g.
+ *
+\code
+struct load_test_tag;
+
+typedef stlsoft::counting_allocator_adaptor<
+    std::allocator<char>
+,   load_test_tag
+>                                                   ator_t;
+
+stlsoft::basic_simple_string<char, stlsoft::stlsoft_char_traits<char>, ator_t>  s;
+
+. . .
+
+stlsoft::allocation_profile const profile = ator_t::counters().profile();
+\endcode
+ *
+ * Since the size of each deallocation must be forwarded to \c A, the
+ * sizeless <code>deallocate(p)</code> is not supported (and does not
+ * compile).
+ */
+template<
+    ss_typename_param_k A
+,   ss_typename_param_k T_tag = void
+,   ss_typename_param_k T_counters = counting_allocator_counters
+>
+class counting_allocator_adaptor
+    : public allocator_base<
+        ss_typename_type_k A::value_type
+    ,   counting_allocator_adaptor<A, T_tag, T_counters>
+    >
+{
+private:
+    typedef allocator_base<
+        ss_typename_type_k A::value_type
+    ,   counting_allocator_adaptor<A, T_tag, T_counters>
+    >                                                               parent_class_type;
+public:
+    /// The current specialisation of the type
+    typedef counting_allocator_adaptor<A, T_tag, T_counters>        class_type;
+    /// The underlying allocator type
+    typedef A                                                       allocator_type;
+    /// The tag type
+    typedef T_tag                                                   tag_type;
+    /// The counters type
+    typedef T_counters                                              counters_type;
+    /// The value type
+    typedef ss_typename_type_k parent_class_type::value_type        value_type;
+    /// The pointer type
+    typedef ss_typename_type_k parent_class_type::pointer           pointer;
+    /// The non-mutating (const) pointer type
+    typedef ss_typename_type_k parent_class_type::const_pointer     const_pointer;
+    /// The reference type
+    typedef ss_typename_type_k parent_class_type::reference         reference;
+    /// The non-mutating (const) reference type
+    typedef ss_typename_type_k parent_class_type::const_reference   const_reference;
+    /// The difference type
+    typedef ss_typename_type_k parent_class_type::difference_type   difference_type;
+    /// The size type
+    typedef ss_typename_type_k parent_class_type::size_type         size_type;
+private:
+    typedef std::allocator_traits<allocator_type>                   allocator_traits_type_;
+
+public:
+    /// The allocator's <b><code>rebind</code></b> structure
+    template <ss_typename_param_k U>
+    struct rebind
+    {
+        typedef counting_allocator_adaptor<
+            ss_typename_type_k allocator_traits_type_::ss_template_qual_k rebind_alloc<U>
+        ,   T_tag
+        ,   T_counters
+        >                                                           other;
+    };
+
+/// \name Construction
+/// @{
+public:
+    /// Default constructor
+    counting_allocator_adaptor()
+        : m_allocator()
+    {}
+    /// Constructs an instance that wraps a copy of the given allocator
+    explicit
+    counting_allocator_adaptor(allocator_type const& ator)
+        : m_allocator(ator)
+    {}
+    /// Copy constructor
+    template <ss_typename_param_k U>
+    counting_allocator_adaptor(counting_allocator_adaptor<U, T_tag, T_counters> const& rhs)
+        : m_allocator(rhs.get_allocator())
+    {}
+/// @}
+
+/// \name Attributes
+/// @{
+public:
+    /// The underlying allocator
+    allocator_type const& get_allocator() const STLSOFT_NOEXCEPT
+    {
+        return m_allocator;
+    }
+
+    /// The counters shared by all specialisations with the same \c T_tag
+    /// and \c T_counters
+    static counters_type& counters() STLSOFT_NOEXCEPT
+    {
+        return ximpl_counting_allocator_adaptor::counters_instance<T_tag, T_counters>();
+    }
+/// @}
+
+private:
+    friend class allocator_base<value_type, class_type>;
+
+    void* do_allocate(size_type n, void const* hint)
+    {
+        STLSOFT_SUPPRESS_UNUSED(hint);
+
+        void* const p = allocator_traits_type_::allocate(m_allocator, n);
+
+        if (ss_nullptr_k != p)
+        {
+            counters().on_allocate(n * sizeof(value_type));
+        }
+
+        return p;
+    }
+    void do_deallocate(void* pv, size_type cb)
+    {
+        if (ss_nullptr_k != pv)
+        {
+            counters().on_deallocate(cb);
+
+            allocator_traits_type_::deallocate(m_allocator, static_cast<pointer>(pv), cb / sizeof(value_type));
+        }
+    }
+    // NOTE: there is no do_deallocate(void*), since the underlying
+    // allocator must be given the size
+
+private:
+    allocator_type  m_allocator;
+};
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * operators
+ */
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+template<
+    ss_typename_param_k A1
+,   ss_typename_param_k A2
+,   ss_typename_param_k T_tag
+,   ss_typename_param_k T_counters
+>
+inline ss_bool_t operator ==(counting_allocator_adaptor<A1, T_tag, T_counters> const& lhs, counting_allocator_adaptor<A2, T_tag, T_counters> const& rhs)
+{
+    return lhs.get_allocator() == rhs.get_allocator();
+}
+
+template<
+    ss_typename_param_k A1
+,   ss_typename_param_k A2
+,   ss_typename_param_k T_tag
+,   ss_typename_param_k T_counters
+>
+inline ss_bool_t operator !=(counting_allocator_adaptor<A1, T_tag, T_counters> const& lhs, counting_allocator_adaptor<A2, T_tag, T_counters> const& rhs)
+{
+    return !(lhs == rhs);
+}
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+
+/* ////////////////////////////////////////////////////////////////////// */
+
+#ifndef STLSOFT_NO_NAMESPACE
+} /* namespace stlsoft */
+#endif /* STLSOFT_NO_NAMESPACE */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !STLSOFT_INCL_STLSOFT_MEMORY_HPP_COUNTING_ALLOCATOR_ADAPTOR */
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,365 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    stlsoft/memory/fixed_size_pool.hpp
+ *
+ * Purpose: Definition of the fixed_size_pool class.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * Home:    http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+
+/* STLSOFT:C++98:FILE_EXCEPTED */
+/* STLSOFT:C++03:FILE_EXCEPTED */
+
+/** \file stlsoft/memory/fixed_size_pool.hpp
+ *
+ * \brief [C++] Definition of the stlsoft::fixed_size_pool class
+ *   (\ref group__library__Memory "Memory" Library).
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_MEMORY_HPP_FIXED_SIZE_POOL
+#define STLSOFT_INCL_STLSOFT_MEMORY_HPP_FIXED_SIZE_POOL
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define STLSOFT_VER_STLSOFT_MEMORY_HPP_FIXED_SIZE_POOL_MAJOR       1
+# define STLSOFT_VER_STLSOFT_MEMORY_HPP_FIXED_SIZE_POOL_MINOR       0
+# define STLSOFT_VER_STLSOFT_MEMORY_HPP_FIXED_SIZE_POOL_REVISION    0
+# define STLSOFT_VER_STLSOFT_MEMORY_HPP_FIXED_SIZE_POOL_EDIT        1
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_H_STLSOFT
+# include <stlsoft/stlsoft.h>
+#endif /* !STLSOFT_INCL_STLSOFT_H_STLSOFT */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+#ifndef STLSOFT_INCL_CSTDDEF
+# define STLSOFT_INCL_CSTDDEF
+# include <cstddef>
+#endif /* !STLSOFT_INCL_CSTDDEF */
+#ifndef STLSOFT_INCL_NEW
+# define STLSOFT_INCL_NEW
+# include <new>
+#endif /* !STLSOFT_INCL_NEW */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef STLSOFT_NO_NAMESPACE
+namespace stlsoft
+{
+#endif /* STLSOFT_NO_NAMESPACE */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * classes
+ */
+
+/** A pool of fixed-size memory nodes
+ *
+ * \ingroup group__library__Memory
+ *
+ * Nodes are carved from chunks obtained from <code>::operator new</code>,
+ * each chunk holding twice as many nodes as its predecessor, and are
+ * recycled through an intrusive free list, so that - once the pool has
+ * grown to its working size - allocate() and deallocate() are each a
+ * handful of instructions, and involve no heap traffic.
+ *
+ * Chunks are only freed by release() or the destructor.
+ *
+ * Instances are not thread-safe, and may not be copied.
+ *
+ * \see stlsoft::pool_allocator
+ */
+class fixed_size_pool
+{
+public: // types
+    /// This type
+    typedef fixed_size_pool                                 class_type;
+    /// The size type
+    typedef ss_size_t                                       size_type;
+
+public: // constants
+    /// The alignment of every node
+    static size_type const  alignment   =   alignof(std::max_align_t);
+
+public: // construction
+    /// Constructs an instance whose nodes are (at least) the given size
+    ///
+    /// \param nodeSize The size of each node. It is rounded up to a
+    ///   multiple of \c alignment
+    /// \param nodesPerChunk The number of nodes in the first chunk. If 0,
+    ///   enough to fill 4KB (and at least 8) are used
+    explicit
+    fixed_size_pool(
+        size_type nodeSize
+    ,   size_type nodesPerChunk = 0
+    ) STLSOFT_NOEXCEPT
+        : m_nodeSize(round_node_size_(nodeSize))
+        , m_initialNodesPerChunk(initial_nodes_per_chunk_(m_nodeSize, nodesPerChunk))
+        , m_nextNodesPerChunk(m_initialNodesPerChunk)
+        , m_freeList(ss_nullptr_k)
+        , m_cur(ss_nullptr_k)
+        , m_end(ss_nullptr_k)
+        , m_chunks(ss_nullptr_k)
+        , m_numChunks(0)
+        , m_numAllocated(0)
+    {}
+    /// Frees all chunks
+    ~fixed_size_pool() STLSOFT_NOEXCEPT
+    {
+        free_chunks_();
+    }
+private:
+    fixed_size_pool(class_type const&) STLSOFT_COPY_CONSTRUCTION_PROSCRIBED;
+    void operator =(class_type const&) STLSOFT_COPY_ASSIGNMENT_PROSCRIBED;
+
+public: // operations
+    /// Allocates a node
+    ///
+    /// \exception std::bad_alloc If a required chunk cannot be allocated
+    void* allocate()
+    {
+        if (ss_nullptr_k != m_freeList)
+        {
+            free_node_* const node = m_freeList;
+
+            m_freeList = node->next;
+
+            ++m_numAllocated;
+
+            return node;
+        }
+
+        if (m_cur == m_end)
+        {
+            add_chunk_();
+        }
+
+        void* const p = m_cur;
+
+        m_cur += m_nodeSize;
+
+        ++m_numAllocated;
+
+        return p;
+    }
+
+    /// Returns a node to the pool
+    ///
+    /// \param pv The node. May be \c nullptr; otherwise, must have been
+    ///   obtained from allocate() on this instance
+    void deallocate(void* pv) STLSOFT_NOEXCEPT
+    {
+        if (ss_nullptr_k != pv)
+        {
+            STLSOFT_MESSAGE_ASSERT("node does not belong to this pool", owns(pv));
+
+            free_node_* const node = static_cast<free_node_*>(pv);
+
+            node->next = m_freeList;
+            m_freeList = node;
+
+            --m_numAllocated;
+        }
+    }
+
+    /// Frees all chunks
+    ///
+    /// \warning All nodes previously allocated from the pool are
+    ///   invalidated
+    void release() STLSOFT_NOEXCEPT
+    {
+        free_chunks_();
+
+        m_nextNodesPerChunk =   m_initialNodesPerChunk;
+        m_freeList          =   ss_nullptr_k;
+        m_cur               =   ss_nullptr_k;
+        m_end               =   ss_nullptr_k;
+        m_numAllocated      =   0;
+    }
+
+public: // attributes
+    /// The size of each node
+    size_type node_size() const STLSOFT_NOEXCEPT
+    {
+        return m_nodeSize;
+    }
+
+    /// The number of nodes currently allocated
+    size_type num_allocated() const STLSOFT_NOEXCEPT
+    {
+        return m_numAllocated;
+    }
+
+    /// The number of chunks currently held by the pool
+    size_type num_chunks() const STLSOFT_NOEXCEPT
+    {
+        return m_numChunks;
+    }
+
+    /// Indicates whether the given pointer lies within one of the pool's
+    /// chunks
+    ///
+    /// \remarks This is linear in the number of chunks, which, because
+    ///   chunk sizes increase geometrically, is logarithmic in the number
+    ///   of nodes
+    bool owns(void const* pv) const STLSOFT_NOEXCEPT
+    {
+        ss_byte_t const* const p = static_cast<ss_byte_t const*>(pv);
+
+        for (chunk_header_ const* chunk = m_chunks; ss_nullptr_k != chunk; chunk = chunk->prev)
+        {
+            ss_byte_t const* const begin = reinterpret_cast<ss_byte_t const*>(chunk) + header_size_;
+
+            if (p >= begin &&
+                p < begin + chunk->numNodes * m_nodeSize)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+private: // implementation
+    struct free_node_
+    {
+        free_node_*     next;
+    };
+    struct chunk_header_
+    {
+        chunk_header_*  prev;
+        size_type       numNodes;
+    };
+
+    static size_type const header_size_ = (sizeof(chunk_header_) + alignment - 1) & ~(alignment - 1);
+
+    static size_type round_node_size_(size_type nodeSize) STLSOFT_NOEXCEPT
+    {
+        if (nodeSize < sizeof(free_node_))
+        {
+            nodeSize = sizeof(free_node_);
+        }
+
+        return (nodeSize + alignment - 1) & ~(alignment - 1);
+    }
+
+    static size_type initial_nodes_per_chunk_(size_type nodeSize, size_type nodesPerChunk) STLSOFT_NOEXCEPT
+    {
+        if (0 == nodesPerChunk)
+        {
+            nodesPerChunk = (4096 - header_size_) / nodeSize;
+
+            if (nodesPerChunk < 8)
+            {
+                nodesPerChunk = 8;
+            }
+        }
+
+        return nodesPerChunk;
+    }
+
+    void add_chunk_()
+    {
+        size_type const         numNodes    =   m_nextNodesPerChunk;
+        chunk_header_* const    chunk       =   static_cast<chunk_header_*>(::operator new(header_size_ + numNodes * m_nodeSize));
+
+        chunk->prev     =   m_chunks;
+        chunk->numNodes =   numNodes;
+
+        m_chunks            =   chunk;
+        m_cur               =   reinterpret_cast<ss_byte_t*>(chunk) + header_size_;
+        m_end               =   m_cur + numNodes * m_nodeSize;
+        m_nextNodesPerChunk =   2 * numNodes;
+
+        ++m_numChunks;
+    }
+
+    void free_chunks_() STLSOFT_NOEXCEPT
+    {
+        for (chunk_header_* chunk = m_chunks; ss_nullptr_k != chunk; )
+        {
+            chunk_header_* const prev = chunk->prev;
+
+            ::operator delete(chunk);
+
+            chunk = prev;
+        }
+
+        m_chunks    =   ss_nullptr_k;
+        m_numChunks =   0;
+    }
+
+private: // fields
+    size_type const     m_nodeSize;
+    size_type const     m_initialNodesPerChunk;
+    size_type           m_nextNodesPerChunk;
+    free_node_*         m_freeList;
+    ss_byte_t*          m_cur;
+    ss_byte_t*          m_end;
+    chunk_header_*      m_chunks;
+    size_type           m_numChunks;
+    size_type           m_numAllocated;
+};
+
+
+/* ////////////////////////////////////////////////////////////////////// */
+
+#ifndef STLSOFT_NO_NAMESPACE
+} /* namespace stlsoft */
+#endif /* STLSOFT_NO_NAMESPACE */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !STLSOFT_INCL_STLSOFT_MEMORY_HPP_FIXED_SIZE_POOL */
+
+/* ///////////////////////////// end of file //////////////////////////// */
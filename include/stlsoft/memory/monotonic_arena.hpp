@@ -0,0 +1,397 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    stlsoft/memory/monotonic_arena.hpp
+ *
+ * Purpose: Definition of the monotonic_arena class.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * Home:    http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+
+/* STLSOFT:C++98:FILE_EXCEPTED */
+/* STLSOFT:C++03:FILE_EXCEPTED */
+
+/** \file stlsoft/memory/monotonic_arena.hpp
+ *
+ * \brief [C++] Definition of the stlsoft::monotonic_arena class
+ *   (\ref group__library__Memory "Memory" Library).
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_MEMORY_HPP_MONOTONIC_ARENA
+#define STLSOFT_INCL_STLSOFT_MEMORY_HPP_MONOTONIC_ARENA
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define STLSOFT_VER_STLSOFT_MEMORY_HPP_MONOTONIC_ARENA_MAJOR       1
+# define STLSOFT_VER_STLSOFT_MEMORY_HPP_MONOTONIC_ARENA_MINOR       0
+# define STLSOFT_VER_STLSOFT_MEMORY_HPP_MONOTONIC_ARENA_REVISION    1
+# define STLSOFT_VER_STLSOFT_MEMORY_HPP_MONOTONIC_ARENA_EDIT        2
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_H_STLSOFT
+# include <stlsoft/stlsoft.h>
+#endif /* !STLSOFT_INCL_STLSOFT_H_STLSOFT */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+#ifndef STLSOFT_INCL_CSTDDEF
+# define STLSOFT_INCL_CSTDDEF
+# include <cstddef>
+#endif /* !STLSOFT_INCL_CSTDDEF */
+#ifndef STLSOFT_INCL_NEW
+# define STLSOFT_INCL_NEW
+# include <new>
+#endif /* !STLSOFT_INCL_NEW */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef STLSOFT_NO_NAMESPACE
+namespace stlsoft
+{
+#endif /* STLSOFT_NO_NAMESPACE */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * classes
+ */
+
+/** A monotonic (bump-pointer) memory arena
+ *
+ * \ingroup group__library__Memory
+ *
+ * Allocations are carved, in order, from the current block by advancing a
+ * pointer. When the current block is exhausted, a new block - twice the
+ * size of its predecessor, or larger if required - is obtained from
+ * <code>::operator new</code> and chained to the others. Memory is not
+ * returned by deallocate() (other than for the most recent allocation,
+ * which is simply un-bumped), but all at once, by release() or the
+ * destructor.
+ *
+ * An arena may optionally be given an initial buffer - typically on the
+ * stack, in the manner of
+ * \link stlsoft::auto_buffer auto_buffer\endlink - which is used before
+ * any block is allocated, so that short-lived work that fits within it
+ * causes no heap traffic at all.
+ *
+ * Instances are not thread-safe, and may not be copied.
+ *
+ * \see stlsoft::arena_allocator
+ */
+class monotonic_arena
+{
+public: // types
+    /// This type
+    typedef monotonic_arena                                 class_type;
+    /// The size type
+    typedef ss_size_t                                       size_type;
+
+public: // constants
+    enum
+    {
+        /// The default size of the first heap block
+        default_block_size  =   4096
+    };
+    /// The alignment of allocations for which no alignment is specified
+    static size_type const  default_alignment   =   alignof(std::max_align_t);
+
+public: // construction
+    /// Constructs an instance that allocates its first heap block, of the
+    /// given size, when first required
+    explicit
+    monotonic_arena(
+        size_type blockSize = default_block_size
+    ) STLSOFT_NOEXCEPT
+        : m_cur(ss_nullptr_k)
+        , m_end(ss_nullptr_k)
+        , m_blocks(ss_nullptr_k)
+        , m_numBlocks(0)
+        , m_initialBuffer(ss_nullptr_k)
+        , m_initialSize(0)
+        , m_initialBlockSize(adjust_block_size_(blockSize))
+        , m_nextBlockSize(m_initialBlockSize)
+        , m_bytesAllocated(0)
+    {}
+    /// Constructs an instance that first allocates from the given buffer,
+    /// and then from heap blocks, the first of the given size
+    ///
+    /// \param buffer The initial buffer. Must remain valid for the
+    ///   lifetime of the instance
+    /// \param cbBuffer The size, in bytes, of \c buffer
+    /// \param blockSize The size of the first heap block
+    monotonic_arena(
+        void*       buffer
+    ,   size_type   cbBuffer
+    ,   size_type   blockSize = default_block_size
+    ) STLSOFT_NOEXCEPT
+        : m_cur(static_cast<ss_byte_t*>(buffer))
+        , m_end(static_cast<ss_byte_t*>(buffer) + cbBuffer)
+        , m_blocks(ss_nullptr_k)
+        , m_numBlocks(0)
+        , m_initialBuffer(static_cast<ss_byte_t*>(buffer))
+        , m_initialSize(cbBuffer)
+        , m_initialBlockSize(adjust_block_size_(blockSize))
+        , m_nextBlockSize(m_initialBlockSize)
+        , m_bytesAllocated(0)
+    {
+        STLSOFT_ASSERT(ss_nullptr_k != buffer || 0 == cbBuffer);
+    }
+    /// Releases all heap blocks
+    ~monotonic_arena() STLSOFT_NOEXCEPT
+    {
+        free_blocks_();
+    }
+private:
+    monotonic_arena(class_type const&) STLSOFT_COPY_CONSTRUCTION_PROSCRIBED;
+    void operator =(class_type const&) STLSOFT_COPY_ASSIGNMENT_PROSCRIBED;
+
+public: // operations
+    /// Allocates a block of (at least) the given size and alignment
+    ///
+    /// \param cb The number of bytes
+    /// \param alignment The alignment. Must be a power of 2
+    ///
+    /// \exception std::bad_alloc If a required heap block cannot be
+    ///   allocated, including if \c cb is too large for any block
+    void* allocate(
+        size_type   cb
+    ,   size_type   alignment = default_alignment
+    )
+    {
+        STLSOFT_ASSERT(0 != alignment && 0 == (alignment & (alignment - 1)));
+
+        if (0 == cb)
+        {
+            cb = 1;
+        }
+
+        size_type const pad     =   pad_(m_cur, alignment);
+        size_type const avail   =   static_cast<size_type>(m_end - m_cur);
+
+        // (written so as not to overflow for very large cb)
+        if (pad > avail ||
+            cb > avail - pad)
+        {
+            return allocate_from_new_block_(cb, alignment);
+        }
+
+        ss_byte_t* const p = m_cur + pad;
+
+        m_cur = p + cb;
+        m_bytesAllocated += cb;
+
+        return p;
+    }
+
+    /// Deallocates a block
+    ///
+    /// \param pv The block. May be \c nullptr
+    /// \param cb The size of the block, as passed to allocate(), or 0 if
+    ///   unknown
+    ///
+    /// \remarks The memory of a block is only reclaimed if it was the most
+    ///   recently allocated (and \c cb is specified); otherwise, this does
+    ///   nothing
+    void deallocate(
+        void*       pv
+    ,   size_type   cb = 0
+    ) STLSOFT_NOEXCEPT
+    {
+        ss_byte_t* const p = static_cast<ss_byte_t*>(pv);
+
+        if (ss_nullptr_k != p &&
+            0 != cb &&
+            p + cb == m_cur)
+        {
+            m_cur = p;
+            m_bytesAllocated -= cb;
+        }
+    }
+
+    /// Releases all memory allocated from the arena, freeing all heap
+    /// blocks, and rewinding to the start of the initial buffer (if any)
+    ///
+    /// \warning All blocks previously allocated from the arena are
+    ///   invalidated
+    void release() STLSOFT_NOEXCEPT
+    {
+        free_blocks_();
+
+        m_cur               =   m_initialBuffer;
+        m_end               =   m_initialBuffer + m_initialSize;
+        m_nextBlockSize     =   m_initialBlockSize;
+        m_bytesAllocated    =   0;
+    }
+
+public: // attributes
+    /// The total number of bytes currently allocated from the arena
+    size_type bytes_allocated() const STLSOFT_NOEXCEPT
+    {
+        return m_bytesAllocated;
+    }
+
+    /// The number of heap blocks currently held by the arena
+    size_type num_blocks() const STLSOFT_NOEXCEPT
+    {
+        return m_numBlocks;
+    }
+
+    /// Indicates whether the given pointer lies within the initial
+    /// buffer
+    bool in_initial_buffer(void const* pv) const STLSOFT_NOEXCEPT
+    {
+        ss_byte_t const* const p = static_cast<ss_byte_t const*>(pv);
+
+        return p >= m_initialBuffer && p < m_initialBuffer + m_initialSize;
+    }
+
+private: // implementation
+    struct block_header_
+    {
+        block_header_*  prev;
+    };
+
+    // the header is padded, so that the first allocation in a block
+    // requires no alignment padding in the common case
+    static size_type const header_size_ = (sizeof(block_header_) + default_alignment - 1) & ~(default_alignment - 1);
+
+    static size_type adjust_block_size_(size_type blockSize) STLSOFT_NOEXCEPT
+    {
+        return (blockSize < 2 * header_size_) ? 2 * header_size_ : blockSize;
+    }
+
+    static size_type pad_(ss_byte_t const* p, size_type alignment) STLSOFT_NOEXCEPT
+    {
+        return static_cast<size_type>(0 - reinterpret_cast<ss_uintptr_t>(p)) & (alignment - 1);
+    }
+
+    static size_type max_size_() STLSOFT_NOEXCEPT
+    {
+        return ~size_type(0);
+    }
+
+    void* allocate_from_new_block_(size_type cb, size_type alignment)
+    {
+        size_type const extra = header_size_ + (alignment > default_alignment ? alignment : 0);
+
+        if (cb > max_size_() - extra)
+        {
+            STLSOFT_THROW_X(std::bad_alloc());
+        }
+
+        size_type const required    =   extra + cb;
+        size_type       blockSize   =   m_nextBlockSize;
+
+        // the block size is doubled until sufficient, unless doubling
+        // would overflow, in which case just what is required is used
+
+        for (; blockSize < required; blockSize *= 2)
+        {
+            if (blockSize > max_size_() / 2)
+            {
+                blockSize = required;
+
+                break;
+            }
+        }
+
+        block_header_* const block = static_cast<block_header_*>(::operator new(blockSize));
+
+        block->prev = m_blocks;
+
+        m_blocks        =   block;
+        m_nextBlockSize =   (blockSize > max_size_() / 2) ? blockSize : 2 * blockSize;
+        m_cur           =   reinterpret_cast<ss_byte_t*>(block) + header_size_;
+        m_end           =   reinterpret_cast<ss_byte_t*>(block) + blockSize;
+
+        ++m_numBlocks;
+
+        return allocate(cb, alignment);
+    }
+
+    void free_blocks_() STLSOFT_NOEXCEPT
+    {
+        for (block_header_* block = m_blocks; ss_nullptr_k != block; )
+        {
+            block_header_* const prev = block->prev;
+
+            ::operator delete(block);
+
+            block = prev;
+        }
+
+        m_blocks    =   ss_nullptr_k;
+        m_numBlocks =   0;
+    }
+
+private: // fields
+    ss_byte_t*          m_cur;
+    ss_byte_t*          m_end;
+    block_header_*      m_blocks;
+    size_type           m_numBlocks;
+    ss_byte_t* const    m_initialBuffer;
+    size_type const     m_initialSize;
+    size_type const     m_initialBlockSize;
+    size_type           m_nextBlockSize;
+    size_type           m_bytesAllocated;
+};
+
+
+/* ////////////////////////////////////////////////////////////////////// */
+
+#ifndef STLSOFT_NO_NAMESPACE
+} /* namespace stlsoft */
+#endif /* STLSOFT_NO_NAMESPACE */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !STLSOFT_INCL_STLSOFT_MEMORY_HPP_MONOTONIC_ARENA */
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,281 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    stlsoft/memory/pool_allocator.hpp
+ *
+ * Purpose: pool_allocator class - allocates from a fixed_size_pool.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * Home:    http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+
+/* STLSOFT:C++98:FILE_EXCEPTED */
+/* STLSOFT:C++03:FILE_EXCEPTED */
+
+/** \file stlsoft/memory/pool_allocator.hpp
+ *
+ * \brief [C++] Definition of the stlsoft::pool_allocator class
+ *   (\ref group__library__Memory "Memory" Library).
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_MEMORY_HPP_POOL_ALLOCATOR
+#define STLSOFT_INCL_STLSOFT_MEMORY_HPP_POOL_ALLOCATOR
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define STLSOFT_VER_STLSOFT_MEMORY_HPP_POOL_ALLOCATOR_MAJOR       1
+# define STLSOFT_VER_STLSOFT_MEMORY_HPP_POOL_ALLOCATOR_MINOR       0
+# define STLSOFT_VER_STLSOFT_MEMORY_HPP_POOL_ALLOCATOR_REVISION    0
+# define STLSOFT_VER_STLSOFT_MEMORY_HPP_POOL_ALLOCATOR_EDIT        1
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_H_STLSOFT
+# include <stlsoft/stlsoft.h>
+#endif /* !STLSOFT_INCL_STLSOFT_H_STLSOFT */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+#ifndef STLSOFT_INCL_STLSOFT_MEMORY_HPP_ALLOCATOR_BASE
+# include <stlsoft/memory/allocator_base.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_MEMORY_HPP_ALLOCATOR_BASE */
+#ifndef STLSOFT_INCL_STLSOFT_MEMORY_HPP_FIXED_SIZE_POOL
+# include <stlsoft/memory/fixed_size_pool.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_MEMORY_HPP_FIXED_SIZE_POOL */
+#ifndef STLSOFT_INCL_STLSOFT_MEMORY_UTIL_HPP_THREAD_SCOPED_RESOURCE
+# include <stlsoft/memory/util/thread_scoped_resource.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_MEMORY_UTIL_HPP_THREAD_SCOPED_RESOURCE */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef STLSOFT_NO_NAMESPACE
+namespace stlsoft
+{
+#endif /* STLSOFT_NO_NAMESPACE */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * classes
+ */
+
+/** STL Allocator that allocates from a
+ *   \link stlsoft::fixed_size_pool fixed_size_pool\endlink
+ *
+ * \ingroup group__library__Memory
+ *
+ * \param T The value_type of the allocator
+ * \param S The source type, whose static <code>get()</code> method
+ *   returns the pool. Defaults to
+ *   <code>thread_scoped_resource<fixed_size_pool></code>
+ *
+ * The allocator is stateless - all instances of a given specialisation
+ * compare equal - and so may be used as the allocator parameter of any of
+ * the STLSoft containers (which default-construct their allocators) as
+ * well as of the standard containers.
+ *
+ * Requests no larger than the pool's node size are satisfied from the
+ * pool's free list; larger ones fall back to <code>::operator new</code>.
+ * The allocator is therefore best suited to node-based containers, such
+ * as <code>std::list</code> and <code>std::map</code>, and to containers
+ * whose buffers have a bounded size, with a pool whose node size is that
+ * of the node or buffer.
+ *
+ * When the size of a block being deallocated is not known (as when
+ * deallocate() is called without it, or with 0) the pool is asked whether
+ * it owns the block, which costs time logarithmic in the pool's size.
+ *
+ * \see stlsoft::thread_scoped_resource
+ */
+template<
+    ss_typename_param_k T
+,   ss_typename_param_k S = thread_scoped_resource<fixed_size_pool>
+>
+class pool_allocator
+    : public allocator_base<T, pool_allocator<T, S> >
+{
+private:
+    typedef allocator_base<T, pool_allocator<T, S> >                parent_class_type;
+public:
+    /// The current specialisation of the type
+    typedef pool_allocator<T, S>                                    class_type;
+    /// The source type
+    typedef S                                                       source_type;
+    /// The value type
+    typedef ss_typename_type_k parent_class_type::value_type        value_type;
+    /// The pointer type
+    typedef ss_typename_type_k parent_class_type::pointer           pointer;
+    /// The non-mutating (const) pointer type
+    typedef ss_typename_type_k parent_class_type::const_pointer     const_pointer;
+    /// The reference type
+    typedef ss_typename_type_k parent_class_type::reference         reference;
+    /// The non-mutating (const) reference type
+    typedef ss_typename_type_k parent_class_type::const_reference   const_reference;
+    /// The difference type
+    typedef ss_typename_type_k parent_class_type::difference_type   difference_type;
+    /// The size type
+    typedef ss_typename_type_k parent_class_type::size_type         size_type;
+
+public:
+    /// The allocator's <b><code>rebind</code></b> structure
+    template <ss_typename_param_k U>
+    struct rebind
+    {
+        typedef pool_allocator<U, S>                                other;
+    };
+
+/// \name Construction
+/// @{
+public:
+    /// Default constructor
+    pool_allocator() STLSOFT_NOEXCEPT
+    {}
+    /// Copy constructor
+    template <ss_typename_param_k U>
+    pool_allocator(pool_allocator<U, S> const&) STLSOFT_NOEXCEPT
+    {}
+/// @}
+
+private:
+    friend class allocator_base<T, pool_allocator<T, S> >;
+
+    void* do_allocate(size_type n, void const* hint)
+    {
+        STLSOFT_SUPPRESS_UNUSED(hint);
+
+        fixed_size_pool&    pool    =   source_type::get();
+        size_type const     cb      =   n * sizeof(value_type);
+
+        if (cb <= pool.node_size())
+        {
+            return pool.allocate();
+        }
+        else
+        {
+            return ::operator new(cb);
+        }
+    }
+    void do_deallocate(void* pv, size_type cb)
+    {
+        fixed_size_pool& pool = source_type::get();
+
+        if (0 != cb ? (cb <= pool.node_size()) : pool.owns(pv))
+        {
+            pool.deallocate(pv);
+        }
+        else
+        {
+            ::operator delete(pv);
+        }
+    }
+    void do_deallocate(void* pv)
+    {
+        do_deallocate(pv, 0);
+    }
+};
+
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+// Specialisation for void
+template <ss_typename_param_k S>
+class pool_allocator<void, S>
+{
+public:
+    typedef void                        value_type;
+    typedef pool_allocator<void, S>     class_type;
+    typedef void*                       pointer;
+    typedef void const*                 const_pointer;
+    typedef ss_ptrdiff_t                difference_type;
+    typedef ss_size_t                   size_type;
+
+    /// The allocator <b><code>rebind</code></b> structure
+    template <ss_typename_param_k U>
+    struct rebind
+    {
+        typedef pool_allocator<U, S>    other;
+    };
+};
+
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+template<
+    ss_typename_param_k T1
+,   ss_typename_param_k T2
+,   ss_typename_param_k S
+>
+inline ss_bool_t operator ==(pool_allocator<T1, S> const& /* lhs */, pool_allocator<T2, S> const& /* rhs */)
+{
+    return ss_true_v;
+}
+
+template<
+    ss_typename_param_k T1
+,   ss_typename_param_k T2
+,   ss_typename_param_k S
+>
+inline ss_bool_t operator !=(pool_allocator<T1, S> const& /* lhs */, pool_allocator<T2, S> const& /* rhs */)
+{
+    return ss_false_v;
+}
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+
+/* ////////////////////////////////////////////////////////////////////// */
+
+#ifndef STLSOFT_NO_NAMESPACE
+} /* namespace stlsoft */
+#endif /* STLSOFT_NO_NAMESPACE */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !STLSOFT_INCL_STLSOFT_MEMORY_HPP_POOL_ALLOCATOR */
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,211 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    stlsoft/memory/util/thread_scoped_resource.hpp
+ *
+ * Purpose: Definition of the thread_scoped_resource class template.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * Home:    http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+
+/* STLSOFT:C++98:FILE_EXCEPTED */
+/* STLSOFT:C++03:FILE_EXCEPTED */
+
+/** \file stlsoft/memory/util/thread_scoped_resource.hpp
+ *
+ * \brief [C++] Definition of the stlsoft::thread_scoped_resource class
+ *   template
+ *   (\ref group__library__Memory "Memory" Library).
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_MEMORY_UTIL_HPP_THREAD_SCOPED_RESOURCE
+#define STLSOFT_INCL_STLSOFT_MEMORY_UTIL_HPP_THREAD_SCOPED_RESOURCE
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define STLSOFT_VER_STLSOFT_MEMORY_UTIL_HPP_THREAD_SCOPED_RESOURCE_MAJOR       1
+# define STLSOFT_VER_STLSOFT_MEMORY_UTIL_HPP_THREAD_SCOPED_RESOURCE_MINOR       0
+# define STLSOFT_VER_STLSOFT_MEMORY_UTIL_HPP_THREAD_SCOPED_RESOURCE_REVISION    0
+# define STLSOFT_VER_STLSOFT_MEMORY_UTIL_HPP_THREAD_SCOPED_RESOURCE_EDIT        1
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_H_STLSOFT
+# include <stlsoft/stlsoft.h>
+#endif /* !STLSOFT_INCL_STLSOFT_H_STLSOFT */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef STLSOFT_NO_NAMESPACE
+namespace stlsoft
+{
+#endif /* STLSOFT_NO_NAMESPACE */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * classes
+ */
+
+/** Binds, for the current thread, a memory resource - such as a
+ *   \link stlsoft::monotonic_arena monotonic_arena\endlink or a
+ *   \link stlsoft::fixed_size_pool fixed_size_pool\endlink - to be used by
+ *   stateless allocators
+ *
+ * \ingroup group__library__Memory
+ *
+ * \tparam T_resource The resource type
+ * \tparam T_tag A tag type, by which distinct bindings of the same
+ *   resource type may be distinguished
+ *
+ * The containers of STLSoft - \link stlsoft::auto_buffer auto_buffer\endlink,
+ * \link stlsoft::pod_vector pod_vector\endlink,
+ * \link stlsoft::basic_simple_string basic_simple_string\endlink, and so
+ * on - default-construct their allocators as and when required, so an
+ * allocator cannot be given its resource at construction. Instead,
+ * allocators such as \link stlsoft::arena_allocator arena_allocator\endlink
+ * obtain it from a <em>source</em> type, whose static <code>get()</code>
+ * method returns it. This class template is such a source: a resource is
+ * bound to it, for the current thread, for the lifetime of a
+ * <code>scope</code> instance:
+ *
+\code
+  typedef stlsoft::thread_scoped_resource<stlsoft::monotonic_arena> source_t;
+
+  ss_byte_t                 buffer[1024];
+  stlsoft::monotonic_arena  arena(buffer, sizeof(buffer));
+  source_t::scope           scope(arena);
+
+  stlsoft::pod_vector<int, stlsoft::arena_allocator<int, source_t> > v;
+\endcode
+ *
+ * Scopes may be nested, each restoring the previous binding on exit.
+ *
+ * \warning Any container that uses the resource must be destroyed before
+ *   the scope that binds it exits.
+ */
+template<
+    ss_typename_param_k T_resource
+,   ss_typename_param_k T_tag       =   void
+>
+class thread_scoped_resource
+{
+public: // types
+    /// The resource type
+    typedef T_resource                                      resource_type;
+    /// This type
+    typedef thread_scoped_resource<
+        T_resource
+    ,   T_tag
+    >                                                       class_type;
+
+    /// Binds a resource for the lifetime of the instance
+    class scope
+    {
+    public:
+        /// Binds the given resource, which must outlive the instance
+        explicit
+        scope(resource_type& resource) STLSOFT_NOEXCEPT
+            : m_previous(current_())
+        {
+            current_() = &resource;
+        }
+        /// Restores the previous binding
+        ~scope() STLSOFT_NOEXCEPT
+        {
+            current_() = m_previous;
+        }
+    private:
+        scope(scope const&) STLSOFT_COPY_CONSTRUCTION_PROSCRIBED;
+        void operator =(scope const&) STLSOFT_COPY_ASSIGNMENT_PROSCRIBED;
+
+    private:
+        resource_type* const m_previous;
+    };
+
+public: // accessors
+    /// Indicates whether a resource is currently bound on this thread
+    static bool is_bound() STLSOFT_NOEXCEPT
+    {
+        return ss_nullptr_k != current_();
+    }
+
+    /// Returns the resource currently bound on this thread
+    ///
+    /// \pre is_bound()
+    static resource_type& get() STLSOFT_NOEXCEPT
+    {
+        STLSOFT_MESSAGE_ASSERT("no resource is bound on this thread", is_bound());
+
+        return *current_();
+    }
+
+private: // implementation
+    static resource_type*& current_() STLSOFT_NOEXCEPT
+    {
+        static thread_local resource_type* s_current = ss_nullptr_k;
+
+        return s_current;
+    }
+};
+
+
+/* ////////////////////////////////////////////////////////////////////// */
+
+#ifndef STLSOFT_NO_NAMESPACE
+} /* namespace stlsoft */
+#endif /* STLSOFT_NO_NAMESPACE */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !STLSOFT_INCL_STLSOFT_MEMORY_UTIL_HPP_THREAD_SCOPED_RESOURCE */
+
+/* ///////////////////////////// end of file //////////////////////////// */
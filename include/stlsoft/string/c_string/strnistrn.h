@@ -4,11 +4,11 @@
  * Purpose:     Definition of stlsoft_C_strnistrn() and stlsoft_C_wcsnistrn()
  *
  * Created:     1st October 2020
- * Updated:     11th March 2024
+ * Updated:     16th October 2026
  *
  * Home:        http://stlsoft.org/
  *
- * Copyright (c) 2020-2024, Matthew Wilson and Synesis Information Systems
+ * Copyright (c) 2020-2026, Matthew Wilson and Synesis Information Systems
  * All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
@@ -52,9 +52,9 @@
 
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 # define STLSOFT_VER_STLSOFT_STRING_C_STRING_H_STRNISTRN_MAJOR      1
-# define STLSOFT_VER_STLSOFT_STRING_C_STRING_H_STRNISTRN_MINOR      0
-# define STLSOFT_VER_STLSOFT_STRING_C_STRING_H_STRNISTRN_REVISION   2
-# define STLSOFT_VER_STLSOFT_STRING_C_STRING_H_STRNISTRN_EDIT       3
+# define STLSOFT_VER_STLSOFT_STRING_C_STRING_H_STRNISTRN_MINOR      1
+# define STLSOFT_VER_STLSOFT_STRING_C_STRING_H_STRNISTRN_REVISION   0
+# define STLSOFT_VER_STLSOFT_STRING_C_STRING_H_STRNISTRN_EDIT       4
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 
@@ -69,6 +69,10 @@
 # pragma message(__FILE__)
 #endif /* STLSOFT_TRACE_INCLUDE */
 
+#ifndef STLSOFT_INCL_STLSOFT_STRING_C_STRING_H_STRNSTRN_SEARCHER
+# include <stlsoft/string/c_string/strnstrn_searcher.h>
+#endif /* !STLSOFT_INCL_STLSOFT_STRING_C_STRING_H_STRNSTRN_SEARCHER */
+
 #ifndef STLSOFT_INCL_H_CTYPE
 # define STLSOFT_INCL_H_CTYPE
 # include <ctype.h>
@@ -92,6 +96,12 @@
  * \param n2 Length of the string to find
  *
  * \retval nullptr The string [s2, s2 + n2) is not found in [s1, s1 + n1)
+ *
+ * \note For long haystacks a case-folding searcher is prepared, which
+ *   filters candidates by their first and last characters (or, for long
+ *   needles, uses the Boyer-Moore-Horspool algorithm). To search many
+ *   haystacks for the same needle, use a searcher (see
+ *   stlsoft/string/c_string/strnstrn_searcher.h).
  */
 STLSOFT_INLINE
 char const*
@@ -106,30 +116,51 @@ stlsoft_C_strnistrn(
     {
         return s1;
     }
+    if (n1 < n2)
+    {
+        return ss_nullptr_k;
+    }
 
-    for (; n1 >= n2; --n1, ++s1)
+    if (n1 >= STLSOFT_C_STRNSTRN_TABLE_MIN_HAYSTACK)
     {
-        if (*s1 == *s2 ||
-            STLSOFT_NS_GLOBAL(toupper)(*s1) == STLSOFT_NS_GLOBAL(toupper)(*s2))
-        {
-            size_t i;
+        stlsoft_C_strnstrn_searcher_t searcher;
 
-            for (i = 1; i != n2; ++i)
+        stlsoft_C_strnstrn_searcher_init(&searcher, s2, n2, STLSOFT_C_STRNSTRN_SEARCHER_F_IGNORE_CASE);
+
+        return stlsoft_C_strnstrn_searcher_find(&searcher, s1, n1);
+    }
+    else
+    {
+        unsigned char const* const  h   =   STLSOFT_C_CAST(unsigned char const*, s1);
+        unsigned char const* const  p   =   STLSOFT_C_CAST(unsigned char const*, s2);
+        int const                   f0  =   STLSOFT_NS_GLOBAL(toupper)(p[0]);
+        size_t                      j;
+
+        for (j = 0; n1 - j >= n2; ++j)
+        {
+            if (h[j] == p[0] ||
+                STLSOFT_NS_GLOBAL(toupper)(h[j]) == f0)
             {
-                if (STLSOFT_NS_GLOBAL(toupper)(*s1) != STLSOFT_NS_GLOBAL(toupper)(*s2))
+                size_t i;
+
+                for (i = 1; i != n2; ++i)
                 {
-                    break;
+                    if (h[j + i] != p[i] &&
+                        STLSOFT_NS_GLOBAL(toupper)(h[j + i]) != STLSOFT_NS_GLOBAL(toupper)(p[i]))
+                    {
+                        break;
+                    }
                 }
-            }
 
-            if (i == n2)
-            {
-                return s1;
+                if (i == n2)
+                {
+                    return s1 + j;
+                }
             }
         }
-    }
 
-    return ss_nullptr_k;
+        return ss_nullptr_k;
+    }
 }
 
 /** Finds a specific-length (slice of a) string within a specific-length
@@ -165,7 +196,8 @@ stlsoft_C_wcsnistrn(
 
             for (i = 1; i != n2; ++i)
             {
-                if (STLSOFT_NS_GLOBAL(toupper)(*s1) != STLSOFT_NS_GLOBAL(toupper)(*s2))
+                if (s1[i] != s2[i] &&
+                    STLSOFT_NS_GLOBAL(towupper)(s1[i]) != STLSOFT_NS_GLOBAL(towupper)(s2[i]))
                 {
                     break;
                 }
@@ -4,11 +4,11 @@
  * Purpose:     Definition of stlsoft_C_strnpbrkn() and stlsoft_C_wcsnpbrkn()
  *
  * Created:     11th December 2020
- * Updated:     11th March 2024
+ * Updated:     16th October 2026
  *
  * Home:        http://stlsoft.org/
  *
- * Copyright (c) 2020, Matthew Wilson and Synesis Information Systems
+ * Copyright (c) 2020-2026, Matthew Wilson and Synesis Information Systems
  * All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
@@ -52,9 +52,9 @@
 
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 # define STLSOFT_VER_STLSOFT_STRING_C_STRING_H_STRNPBRKN_MAJOR      1
-# define STLSOFT_VER_STLSOFT_STRING_C_STRING_H_STRNPBRKN_MINOR      0
-# define STLSOFT_VER_STLSOFT_STRING_C_STRING_H_STRNPBRKN_REVISION   2
-# define STLSOFT_VER_STLSOFT_STRING_C_STRING_H_STRNPBRKN_EDIT       4
+# define STLSOFT_VER_STLSOFT_STRING_C_STRING_H_STRNPBRKN_MINOR      1
+# define STLSOFT_VER_STLSOFT_STRING_C_STRING_H_STRNPBRKN_REVISION   0
+# define STLSOFT_VER_STLSOFT_STRING_C_STRING_H_STRNPBRKN_EDIT       5
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 
@@ -69,14 +69,62 @@
 # pragma message(__FILE__)
 #endif /* STLSOFT_TRACE_INCLUDE */
 
+#ifndef STLSOFT_INCL_STLSOFT_STRING_C_STRING_H_STRNCHR
+# include <stlsoft/string/c_string/strnchr.h>
+#endif /* !STLSOFT_INCL_STLSOFT_STRING_C_STRING_H_STRNCHR */
+#ifndef STLSOFT_INCL_STLSOFT_UTIL_BITS_H_TEST_FUNCTIONS
+# include <stlsoft/util/bits/test_functions.h>
+#endif /* !STLSOFT_INCL_STLSOFT_UTIL_BITS_H_TEST_FUNCTIONS */
+
 
 /* /////////////////////////////////////////////////////////////////////////
- * API functions
+ * compatibility
+ */
+
+#if !defined(STLSOFT_STRING_C_STRING_STRNPBRKN_NO_USE_SIMD)
+# if defined(__SSE2__) || \
+     defined(_M_X64) || \
+     (   defined(_M_IX86_FP) && \
+         _M_IX86_FP >= 2)
+#  define STLSOFT_STRING_C_STRING_STRNPBRKN_USE_SSE2_
+# endif
+#endif /* !STLSOFT_STRING_C_STRING_STRNPBRKN_NO_USE_SIMD */
+
+#if defined(STLSOFT_STRING_C_STRING_STRNPBRKN_USE_SSE2_)
+# include <emmintrin.h>
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * constants
+ */
+
+/** The largest (multibyte) character set that stlsoft_C_strnpbrkn() will
+ * search for by comparing a block of the string with each of its members
+ * (where SIMD is available); larger sets are searched for by table lookup
+ */
+#ifndef STLSOFT_C_STRNPBRKN_SIMD_MAX_CHARSET
+# define STLSOFT_C_STRNPBRKN_SIMD_MAX_CHARSET               (8)
+#endif /* !STLSOFT_C_STRNPBRKN_SIMD_MAX_CHARSET */
+
+/** The smallest string length for which stlsoft_C_strnpbrkn() will build
+ * a lookup table of the character set, rather than comparing each
+ * character of the string with each member of the set
+ */
+#ifndef STLSOFT_C_STRNPBRKN_TABLE_MIN_STRING
+# define STLSOFT_C_STRNPBRKN_TABLE_MIN_STRING               (64)
+#endif /* !STLSOFT_C_STRNPBRKN_TABLE_MIN_STRING */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * implementation
  */
 
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
 STLSOFT_INLINE
 char const*
-stlsoft_C_strnpbrkn(
+stlsoft_C_strnpbrkn_naive_(
     char const* str
 ,   size_t      cchStr
 ,   char const* charSet
@@ -100,6 +148,147 @@ stlsoft_C_strnpbrkn(
     return ss_nullptr_k;
 }
 
+STLSOFT_INLINE
+char const*
+stlsoft_C_strnpbrkn_table_(
+    char const* str
+,   size_t      cchStr
+,   char const* charSet
+,   size_t      cchCharSet
+)
+{
+    unsigned char   table[256];
+
+    STLSOFT_NS_GLOBAL(memset)(table, 0, sizeof(table));
+
+    for (; 0 != cchCharSet; ++charSet, --cchCharSet)
+    {
+        table[STLSOFT_STATIC_CAST(unsigned char, *charSet)] = 1;
+    }
+
+    for (; 0 != cchStr; ++str, --cchStr)
+    {
+        if (0 != table[STLSOFT_STATIC_CAST(unsigned char, *str)])
+        {
+            return str;
+        }
+    }
+
+    return ss_nullptr_k;
+}
+
+# if defined(STLSOFT_STRING_C_STRING_STRNPBRKN_USE_SSE2_)
+
+/* Compares sixteen characters at a time with each member of the set, where
+ * 2 <= cchCharSet <= STLSOFT_C_STRNPBRKN_SIMD_MAX_CHARSET
+ */
+STLSOFT_INLINE
+char const*
+stlsoft_C_strnpbrkn_sse2_(
+    char const* str
+,   size_t      cchStr
+,   char const* charSet
+,   size_t      cchCharSet
+)
+{
+    __m128i set[STLSOFT_C_STRNPBRKN_SIMD_MAX_CHARSET];
+    size_t  i;
+
+    for (i = 0; i != cchCharSet; ++i)
+    {
+        set[i] = _mm_set1_epi8(charSet[i]);
+    }
+
+    for (; cchStr >= 16; str += 16, cchStr -= 16)
+    {
+        __m128i const                   a   =   _mm_loadu_si128(STLSOFT_C_CAST(__m128i const*, str));
+        __m128i                         m   =   _mm_cmpeq_epi8(a, set[0]);
+        STLSOFT_NS_QUAL(ss_uint32_t)    mask;
+
+        for (i = 1; i != cchCharSet; ++i)
+        {
+            m = _mm_or_si128(m, _mm_cmpeq_epi8(a, set[i]));
+        }
+
+        mask = STLSOFT_STATIC_CAST(STLSOFT_NS_QUAL(ss_uint32_t), _mm_movemask_epi8(m));
+
+        if (0 != mask)
+        {
+            return str + STLSOFT_NS_QUAL(stlsoft_C_count_trailing_zero_bits_in_32bit_unsigned_integer)(mask);
+        }
+    }
+
+    return stlsoft_C_strnpbrkn_naive_(str, cchStr, charSet, cchCharSet);
+}
+# endif /* STLSOFT_STRING_C_STRING_STRNPBRKN_USE_SSE2_ */
+
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+/** Finds the first character in the string that is in the character set
+ *
+ * \param str The string to search. May be \c NULL only if \c cchStr is 0
+ * \param cchStr The number of characters in \c str
+ * \param charSet The character set. May be \c NULL only if \c cchCharSet
+ *   is 0
+ * \param cchCharSet The number of characters in \c charSet
+ *
+ * \return A pointer to the first character in
+ *   <code>[str, str + cchStr)</code> that is in the set, or \c NULL if
+ *   there is none
+ */
+STLSOFT_INLINE
+char const*
+stlsoft_C_strnpbrkn(
+    char const* str
+,   size_t      cchStr
+,   char const* charSet
+,   size_t      cchCharSet
+)
+{
+    switch (cchCharSet)
+    {
+    case 0:
+        return ss_nullptr_k;
+    case 1:
+        return stlsoft_C_strnchr(str, cchStr, charSet[0]);
+    default:
+        break;
+    }
+
+#if defined(STLSOFT_STRING_C_STRING_STRNPBRKN_USE_SSE2_)
+
+    if (cchStr >= 16 &&
+        cchCharSet <= STLSOFT_C_STRNPBRKN_SIMD_MAX_CHARSET)
+    {
+        return stlsoft_C_strnpbrkn_sse2_(str, cchStr, charSet, cchCharSet);
+    }
+#endif /* STLSOFT_STRING_C_STRING_STRNPBRKN_USE_SSE2_ */
+
+    if (cchStr >= STLSOFT_C_STRNPBRKN_TABLE_MIN_STRING)
+    {
+        return stlsoft_C_strnpbrkn_table_(str, cchStr, charSet, cchCharSet);
+    }
+
+    return stlsoft_C_strnpbrkn_naive_(str, cchStr, charSet, cchCharSet);
+}
+
+/** Finds the first character in the string that is in the character set
+ *
+ * \param str The string to search. May be \c NULL only if \c cchStr is 0
+ * \param cchStr The number of characters in \c str
+ * \param charSet The character set. May be \c NULL only if \c cchCharSet
+ *   is 0
+ * \param cchCharSet The number of characters in \c charSet
+ *
+ * \return A pointer to the first character in
+ *   <code>[str, str + cchStr)</code> that is in the set, or \c NULL if
+ *   there is none
+ */
 STLSOFT_INLINE
 wchar_t const*
 stlsoft_C_wcsnpbrkn(
@@ -109,6 +298,11 @@ stlsoft_C_wcsnpbrkn(
 ,   size_t          cchCharSet
 )
 {
+    if (1 == cchCharSet)
+    {
+        return stlsoft_C_wcsnchr(str, cchStr, charSet[0]);
+    }
+
     for (; 0 != cchStr; ++str, --cchStr)
     {
         wchar_t const*  s   =   charSet;
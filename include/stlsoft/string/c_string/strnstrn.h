@@ -4,11 +4,11 @@
  * Purpose:     Definition of stlsoft_C_strnstrn() and stlsoft_C_wcsnstrn()
  *
  * Created:     1st October 2020
- * Updated:     11th March 2024
+ * Updated:     16th October 2026
  *
  * Home:        http://stlsoft.org/
  *
- * Copyright (c) 2020, Matthew Wilson and Synesis Information Systems
+ * Copyright (c) 2020-2026, Matthew Wilson and Synesis Information Systems
  * All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
@@ -52,9 +52,9 @@
 
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 # define STLSOFT_VER_STLSOFT_STRING_C_STRING_H_STRNSTRN_MAJOR       1
-# define STLSOFT_VER_STLSOFT_STRING_C_STRING_H_STRNSTRN_MINOR       0
-# define STLSOFT_VER_STLSOFT_STRING_C_STRING_H_STRNSTRN_REVISION    1
-# define STLSOFT_VER_STLSOFT_STRING_C_STRING_H_STRNSTRN_EDIT        2
+# define STLSOFT_VER_STLSOFT_STRING_C_STRING_H_STRNSTRN_MINOR       1
+# define STLSOFT_VER_STLSOFT_STRING_C_STRING_H_STRNSTRN_REVISION    0
+# define STLSOFT_VER_STLSOFT_STRING_C_STRING_H_STRNSTRN_EDIT        3
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 
@@ -69,6 +69,19 @@
 # pragma message(__FILE__)
 #endif /* STLSOFT_TRACE_INCLUDE */
 
+#ifndef STLSOFT_INCL_STLSOFT_STRING_C_STRING_H_STRNSTRN_SEARCHER
+# include <stlsoft/string/c_string/strnstrn_searcher.h>
+#endif /* !STLSOFT_INCL_STLSOFT_STRING_C_STRING_H_STRNSTRN_SEARCHER */
+
+#ifndef STLSOFT_INCL_H_STRING
+# define STLSOFT_INCL_H_STRING
+# include <string.h>
+#endif /* !STLSOFT_INCL_H_STRING */
+#ifndef STLSOFT_INCL_H_WCHAR
+# define STLSOFT_INCL_H_WCHAR
+# include <wchar.h>
+#endif /* !STLSOFT_INCL_H_WCHAR */
+
 
 /* /////////////////////////////////////////////////////////////////////////
  * API functions
@@ -83,6 +96,13 @@
  * \param n2 Length of the string to find
  *
  * \retval nullptr The string [s2, s2 + n2) is not found in [s1, s1 + n1)
+ *
+ * \note Candidate positions are located by their first and last characters,
+ *   a block at a time with SSE2/AVX2 where available, and otherwise by
+ *   <code>memchr()</code>; long needles in long haystacks are sought by
+ *   the Boyer-Moore-Horspool algorithm. To search many haystacks for the
+ *   same needle, use a searcher (see
+ *   stlsoft/string/c_string/strnstrn_searcher.h).
  */
 STLSOFT_INLINE
 char const*
@@ -97,29 +117,26 @@ stlsoft_C_strnstrn(
     {
         return s1;
     }
+    if (n1 < n2)
+    {
+        return ss_nullptr_k;
+    }
+    if (1 == n2)
+    {
+        return STLSOFT_STATIC_CAST(char const*, STLSOFT_NS_GLOBAL(memchr)(s1, *s2, n1));
+    }
 
-    for (; n1 >= n2; --n1, ++s1)
+    if (n2 >= STLSOFT_C_STRNSTRN_HORSPOOL_MIN_NEEDLE &&
+        n1 >= STLSOFT_C_STRNSTRN_TABLE_MIN_HAYSTACK)
     {
-        if (*s1 == *s2)
-        {
-            size_t i;
-
-            for (i = 1; i != n2; ++i)
-            {
-                if (s1[i] != s2[i])
-                {
-                    break;
-                }
-            }
-
-            if (i == n2)
-            {
-                return s1;
-            }
-        }
+        stlsoft_C_strnstrn_searcher_t searcher;
+
+        stlsoft_C_strnstrn_searcher_init(&searcher, s2, n2, 0);
+
+        return stlsoft_C_strnstrn_searcher_find(&searcher, s1, n1);
     }
 
-    return ss_nullptr_k;
+    return stlsoft_C_strnstrn_filter_exact_(s1, n1, s2, n2);
 }
 
 /** Finds a specific-length (slice of a) string within a specific-length
@@ -141,30 +158,34 @@ stlsoft_C_wcsnstrn(
 ,   size_t          n2
 )
 {
+    size_t i;
+
     if (0 == n2)
     {
         return s1;
     }
+    if (n1 < n2)
+    {
+        return ss_nullptr_k;
+    }
+
+    /* candidates are located by wmemchr(), and then compared */
 
-    for (; n1 >= n2; --n1, ++s1)
+    for (i = 0; i <= n1 - n2; ++i)
     {
-        if (*s1 == *s2)
+        wchar_t const* const p = STLSOFT_NS_GLOBAL(wmemchr)(s1 + i, *s2, n1 - n2 + 1 - i);
+
+        if (ss_nullptr_k == p)
         {
-            size_t i;
-
-            for (i = 1; i != n2; ++i)
-            {
-                if (s1[i] != s2[i])
-                {
-                    break;
-                }
-            }
-
-            if (i == n2)
-            {
-                return s1;
-            }
+            break;
         }
+
+        if (0 == STLSOFT_NS_GLOBAL(wmemcmp)(p + 1, s2 + 1, n2 - 1))
+        {
+            return p;
+        }
+
+        i = STLSOFT_STATIC_CAST(size_t, p - s1);
     }
 
     return ss_nullptr_k;
@@ -0,0 +1,725 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    stlsoft/string/c_string/strnstrn_searcher.h
+ *
+ * Purpose: Definition of stlsoft_C_strnstrn_searcher_t, and its functions, and
+ *          of the stlsoft::c_string::strnstrn_searcher class.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * Home:    http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+
+
+/** \file stlsoft/string/c_string/strnstrn_searcher.h
+ *
+ * \brief [C, C++] Definition of stlsoft_C_strnstrn_searcher_t, and its
+ *   functions, and of the stlsoft::c_string::strnstrn_searcher class
+ *
+ *   (\ref group__library__String "String" Library).
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_STRING_C_STRING_H_STRNSTRN_SEARCHER
+#define STLSOFT_INCL_STLSOFT_STRING_C_STRING_H_STRNSTRN_SEARCHER
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define STLSOFT_VER_STLSOFT_STRING_C_STRING_H_STRNSTRN_SEARCHER_MAJOR      1
+# define STLSOFT_VER_STLSOFT_STRING_C_STRING_H_STRNSTRN_SEARCHER_MINOR      0
+# define STLSOFT_VER_STLSOFT_STRING_C_STRING_H_STRNSTRN_SEARCHER_REVISION   0
+# define STLSOFT_VER_STLSOFT_STRING_C_STRING_H_STRNSTRN_SEARCHER_EDIT       1
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_H_STLSOFT
+# include <stlsoft/stlsoft.h>
+#endif /* !STLSOFT_INCL_STLSOFT_H_STLSOFT */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+#ifndef STLSOFT_INCL_STLSOFT_UTIL_BITS_H_TEST_FUNCTIONS
+# include <stlsoft/util/bits/test_functions.h>
+#endif /* !STLSOFT_INCL_STLSOFT_UTIL_BITS_H_TEST_FUNCTIONS */
+#ifndef STLSOFT_INCL_H_CTYPE
+# define STLSOFT_INCL_H_CTYPE
+# include <ctype.h>
+#endif /* !STLSOFT_INCL_H_CTYPE */
+#ifndef STLSOFT_INCL_H_STRING
+# define STLSOFT_INCL_H_STRING
+# include <string.h>
+#endif /* !STLSOFT_INCL_H_STRING */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#if !defined(STLSOFT_STRING_C_STRING_STRNSTRN_NO_USE_SIMD)
+# if defined(__AVX2__)
+#  define STLSOFT_STRING_C_STRING_STRNSTRN_USE_AVX2_
+# endif
+# if defined(__SSE2__) || \
+     defined(_M_X64) || \
+     (   defined(_M_IX86_FP) && \
+         _M_IX86_FP >= 2)
+#  define STLSOFT_STRING_C_STRING_STRNSTRN_USE_SSE2_
+# endif
+#endif /* !STLSOFT_STRING_C_STRING_STRNSTRN_NO_USE_SIMD */
+
+#if defined(STLSOFT_STRING_C_STRING_STRNSTRN_USE_AVX2_)
+# include <immintrin.h>
+#elif defined(STLSOFT_STRING_C_STRING_STRNSTRN_USE_SSE2_)
+# include <emmintrin.h>
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * constants
+ */
+
+/** Flag that causes a searcher to compare case-insensitively, according
+ * to <code>toupper()</code> in the locale current at its initialisation
+ */
+#define STLSOFT_C_STRNSTRN_SEARCHER_F_IGNORE_CASE           (0x0001)
+
+/** The needle length from which the Boyer-Moore-Horspool algorithm is used
+ * in preference to filtering on the first and last characters
+ *
+ * \note This may be defined by the user, to tune for a given platform
+ */
+#ifndef STLSOFT_C_STRNSTRN_HORSPOOL_MIN_NEEDLE
+# if defined(STLSOFT_STRING_C_STRING_STRNSTRN_USE_SSE2_)
+#  define STLSOFT_C_STRNSTRN_HORSPOOL_MIN_NEEDLE            (64)
+# else
+#  define STLSOFT_C_STRNSTRN_HORSPOOL_MIN_NEEDLE            (8)
+# endif
+#endif /* !STLSOFT_C_STRNSTRN_HORSPOOL_MIN_NEEDLE */
+
+/** The haystack length from which the one-shot search functions prepare
+ * the tables of the Boyer-Moore-Horspool algorithm (for long needles) or
+ * case-folding (for case-insensitive searches)
+ *
+ * \note This may be defined by the user, to tune for a given platform
+ */
+#ifndef STLSOFT_C_STRNSTRN_TABLE_MIN_HAYSTACK
+# define STLSOFT_C_STRNSTRN_TABLE_MIN_HAYSTACK              (1024)
+#endif /* !STLSOFT_C_STRNSTRN_TABLE_MIN_HAYSTACK */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+/** Precompiled needle, for searching any number of haystacks for the same
+ * (slice of a) string
+ *
+ * \see stlsoft_C_strnstrn_searcher_init()
+ * \see stlsoft_C_strnstrn_searcher_find()
+ */
+struct stlsoft_C_strnstrn_searcher_t
+{
+    char const*     needle;     /*!< The needle, which must outlive the searcher */
+    size_t          len;        /*!< The length of the needle */
+    int             flags;      /*!< The flags */
+    int             filterable; /*!< Non-zero if the first and last characters of the needle each fold from no more than two values */
+    unsigned char   first[2];   /*!< The values that fold to the first character of the needle */
+    unsigned char   last[2];    /*!< The values that fold to the last character of the needle */
+    unsigned char   fold[256];  /*!< The folding of each value: identity, or toupper() */
+    size_t          skip[256];  /*!< The Boyer-Moore-Horspool shifts, by folded value */
+};
+#ifndef __cplusplus
+typedef struct stlsoft_C_strnstrn_searcher_t                stlsoft_C_strnstrn_searcher_t;
+#endif /* !__cplusplus */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * implementation
+ */
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+/* Compares [p, p + n) with [s2, s2 + n) under the given folding */
+STLSOFT_INLINE
+int
+stlsoft_C_strnstrn_equal_folded_(
+    unsigned char const*    p
+,   unsigned char const*    s2
+,   size_t                  n
+,   unsigned char const*    fold
+)
+{
+    size_t i;
+
+    for (i = 0; i != n; ++i)
+    {
+        if (fold[p[i]] != fold[s2[i]])
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/* Finds [s2, s2 + n2) in [s1, s1 + n1), where 2 <= n2 <= n1, by locating
+ * the candidate positions - those whose first and last characters match
+ * those of the needle - a block at a time, and comparing only those.
+ */
+STLSOFT_INLINE
+char const*
+stlsoft_C_strnstrn_filter_exact_(
+    char const* s1
+,   size_t      n1
+,   char const* s2
+,   size_t      n2
+)
+{
+    size_t const    lastOff =   n2 - 1;
+    size_t const    end     =   n1 - lastOff; /* one past the last candidate */
+    size_t          i       =   0;
+
+#if defined(STLSOFT_STRING_C_STRING_STRNSTRN_USE_AVX2_)
+
+    if (end >= 32)
+    {
+        __m256i const   f32 =   _mm256_set1_epi8(s2[0]);
+        __m256i const   l32 =   _mm256_set1_epi8(s2[lastOff]);
+
+        for (; end - i >= 32; i += 32)
+        {
+            __m256i const                   a       =   _mm256_loadu_si256(STLSOFT_C_CAST(__m256i const*, s1 + i));
+            __m256i const                   b       =   _mm256_loadu_si256(STLSOFT_C_CAST(__m256i const*, s1 + i + lastOff));
+            STLSOFT_NS_QUAL(ss_uint32_t)    mask    =   STLSOFT_STATIC_CAST(STLSOFT_NS_QUAL(ss_uint32_t), _mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(a, f32), _mm256_cmpeq_epi8(b, l32))));
+
+            for (; 0 != mask; mask &= mask - 1)
+            {
+                char const* const p = s1 + i + STLSOFT_NS_QUAL(stlsoft_C_count_trailing_zero_bits_in_32bit_unsigned_integer)(mask);
+
+                if (0 == STLSOFT_NS_GLOBAL(memcmp)(p + 1, s2 + 1, n2 - 2))
+                {
+                    return p;
+                }
+            }
+        }
+    }
+#endif /* STLSOFT_STRING_C_STRING_STRNSTRN_USE_AVX2_ */
+
+#if defined(STLSOFT_STRING_C_STRING_STRNSTRN_USE_SSE2_)
+
+    if (end - i >= 16)
+    {
+        __m128i const   f16 =   _mm_set1_epi8(s2[0]);
+        __m128i const   l16 =   _mm_set1_epi8(s2[lastOff]);
+
+        for (; end - i >= 16; i += 16)
+        {
+            __m128i const                   a       =   _mm_loadu_si128(STLSOFT_C_CAST(__m128i const*, s1 + i));
+            __m128i const                   b       =   _mm_loadu_si128(STLSOFT_C_CAST(__m128i const*, s1 + i + lastOff));
+            STLSOFT_NS_QUAL(ss_uint32_t)    mask    =   STLSOFT_STATIC_CAST(STLSOFT_NS_QUAL(ss_uint32_t), _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, f16), _mm_cmpeq_epi8(b, l16))));
+
+            for (; 0 != mask; mask &= mask - 1)
+            {
+                char const* const p = s1 + i + STLSOFT_NS_QUAL(stlsoft_C_count_trailing_zero_bits_in_32bit_unsigned_integer)(mask);
+
+                if (0 == STLSOFT_NS_GLOBAL(memcmp)(p + 1, s2 + 1, n2 - 2))
+                {
+                    return p;
+                }
+            }
+        }
+    }
+#endif /* STLSOFT_STRING_C_STRING_STRNSTRN_USE_SSE2_ */
+
+    /* remaining candidates (or all, in the absence of SIMD) are located
+     * by memchr()
+     */
+    for (; i != end; ++i)
+    {
+        char const* const p = STLSOFT_STATIC_CAST(char const*, STLSOFT_NS_GLOBAL(memchr)(s1 + i, s2[0], end - i));
+
+        if (ss_nullptr_k == p)
+        {
+            break;
+        }
+
+        i = STLSOFT_STATIC_CAST(size_t, p - s1);
+
+        if (p[lastOff] == s2[lastOff] &&
+            0 == STLSOFT_NS_GLOBAL(memcmp)(p + 1, s2 + 1, n2 - 2))
+        {
+            return p;
+        }
+    }
+
+    return ss_nullptr_k;
+}
+
+/* As stlsoft_C_strnstrn_filter_exact_(), but where each of the first and
+ * last characters of the needle is matched by (either of) two values, and
+ * the rest is compared under the searcher's folding.
+ */
+STLSOFT_INLINE
+char const*
+stlsoft_C_strnstrn_filter_folded_(
+    struct stlsoft_C_strnstrn_searcher_t const* searcher
+,   char const*                                 s1
+,   size_t                                      n1
+)
+{
+    unsigned char const* const  h       =   STLSOFT_C_CAST(unsigned char const*, s1);
+    unsigned char const* const  s2      =   STLSOFT_C_CAST(unsigned char const*, searcher->needle);
+    size_t const                n2      =   searcher->len;
+    size_t const                lastOff =   n2 - 1;
+    size_t const                end     =   n1 - lastOff;
+    size_t                      i       =   0;
+
+#if defined(STLSOFT_STRING_C_STRING_STRNSTRN_USE_SSE2_)
+
+    if (end >= 16)
+    {
+        __m128i const   f16a    =   _mm_set1_epi8(STLSOFT_STATIC_CAST(char, searcher->first[0]));
+        __m128i const   f16b    =   _mm_set1_epi8(STLSOFT_STATIC_CAST(char, searcher->first[1]));
+        __m128i const   l16a    =   _mm_set1_epi8(STLSOFT_STATIC_CAST(char, searcher->last[0]));
+        __m128i const   l16b    =   _mm_set1_epi8(STLSOFT_STATIC_CAST(char, searcher->last[1]));
+
+        for (; end - i >= 16; i += 16)
+        {
+            __m128i const                   a       =   _mm_loadu_si128(STLSOFT_C_CAST(__m128i const*, h + i));
+            __m128i const                   b       =   _mm_loadu_si128(STLSOFT_C_CAST(__m128i const*, h + i + lastOff));
+            __m128i const                   ma      =   _mm_or_si128(_mm_cmpeq_epi8(a, f16a), _mm_cmpeq_epi8(a, f16b));
+            __m128i const                   mb      =   _mm_or_si128(_mm_cmpeq_epi8(b, l16a), _mm_cmpeq_epi8(b, l16b));
+            STLSOFT_NS_QUAL(ss_uint32_t)    mask    =   STLSOFT_STATIC_CAST(STLSOFT_NS_QUAL(ss_uint32_t), _mm_movemask_epi8(_mm_and_si128(ma, mb)));
+
+            for (; 0 != mask; mask &= mask - 1)
+            {
+                size_t const j = i + STLSOFT_NS_QUAL(stlsoft_C_count_trailing_zero_bits_in_32bit_unsigned_integer)(mask);
+
+                if (stlsoft_C_strnstrn_equal_folded_(h + j + 1, s2 + 1, n2 - 2, searcher->fold))
+                {
+                    return s1 + j;
+                }
+            }
+        }
+    }
+#endif /* STLSOFT_STRING_C_STRING_STRNSTRN_USE_SSE2_ */
+
+    for (; i != end; ++i)
+    {
+        unsigned char const c = h[i];
+
+        if ((c == searcher->first[0] || c == searcher->first[1]) &&
+            (h[i + lastOff] == searcher->last[0] || h[i + lastOff] == searcher->last[1]) &&
+            stlsoft_C_strnstrn_equal_folded_(h + i + 1, s2 + 1, n2 - 2, searcher->fold))
+        {
+            return s1 + i;
+        }
+    }
+
+    return ss_nullptr_k;
+}
+
+/* Finds [s2, s2 + n2) in [s1, s1 + n1), where 2 <= n2 <= n1, by the
+ * Boyer-Moore-Horspool algorithm, under the given folding.
+ */
+STLSOFT_INLINE
+char const*
+stlsoft_C_strnstrn_horspool_(
+    char const*             s1
+,   size_t                  n1
+,   char const*             s2
+,   size_t                  n2
+,   unsigned char const*    fold
+,   size_t const*           skip
+,   int                     exact
+)
+{
+    unsigned char const* const  h       =   STLSOFT_C_CAST(unsigned char const*, s1);
+    unsigned char const* const  p       =   STLSOFT_C_CAST(unsigned char const*, s2);
+    size_t const                lastOff =   n2 - 1;
+    unsigned char const         last    =   fold[p[lastOff]];
+    size_t                      i;
+
+    for (i = 0; n1 - i >= n2; )
+    {
+        unsigned char const c = fold[h[i + lastOff]];
+
+        if (c == last)
+        {
+            if (exact
+                    ? 0 == STLSOFT_NS_GLOBAL(memcmp)(h + i, p, lastOff)
+                    : stlsoft_C_strnstrn_equal_folded_(h + i, p, lastOff, fold))
+            {
+                return s1 + i;
+            }
+        }
+
+        i += skip[c];
+    }
+
+    return ss_nullptr_k;
+}
+
+STLSOFT_INLINE
+void
+stlsoft_C_strnstrn_searcher_init_skip_(
+    struct stlsoft_C_strnstrn_searcher_t* searcher
+)
+{
+    unsigned char const* const  p       =   STLSOFT_C_CAST(unsigned char const*, searcher->needle);
+    size_t const                lastOff =   searcher->len - 1;
+    size_t                      i;
+
+    for (i = 0; i != 256; ++i)
+    {
+        searcher->skip[i] = searcher->len;
+    }
+
+    for (i = 0; i != lastOff; ++i)
+    {
+        searcher->skip[searcher->fold[p[i]]] = lastOff - i;
+    }
+}
+
+/* Determines the (up to two) values that fold to the same as c, returning
+ * 0 if there are more than two
+ */
+STLSOFT_INLINE
+int
+stlsoft_C_strnstrn_searcher_init_filter_(
+    struct stlsoft_C_strnstrn_searcher_t*   searcher
+,   unsigned char                           c
+,   unsigned char*                          values
+)
+{
+    unsigned char const f = searcher->fold[c];
+    int                 n = 0;
+    unsigned            i;
+
+    values[0] = values[1] = c;
+
+    for (i = 0; i != 256; ++i)
+    {
+        if (f == searcher->fold[i])
+        {
+            if (2 == n)
+            {
+                return 0;
+            }
+
+            values[n++] = STLSOFT_STATIC_CAST(unsigned char, i);
+        }
+    }
+
+    return 1;
+}
+
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * API functions
+ */
+
+/** Initialises a searcher for the given needle
+ *
+ * \param searcher Pointer to the searcher to initialise. May not be NULL
+ * \param s2 Pointer to the string to find. The string must outlive the
+ *   searcher
+ * \param n2 Length of the string to find
+ * \param flags Flags that moderate the search. Either 0 or
+ *   STLSOFT_C_STRNSTRN_SEARCHER_F_IGNORE_CASE
+ *
+ * The initialisation costs a few hundred operations, so a searcher is
+ * worthwhile when a needle is to be sought in many haystacks, or in long
+ * ones.
+ */
+STLSOFT_INLINE
+void
+stlsoft_C_strnstrn_searcher_init(
+    struct stlsoft_C_strnstrn_searcher_t*   searcher
+,   char const*                             s2
+,   size_t                                  n2
+,   int                                     flags
+)
+{
+    unsigned i;
+
+    STLSOFT_ASSERT(ss_nullptr_k != searcher);
+    STLSOFT_ASSERT(0 == n2 || ss_nullptr_k != s2);
+
+    searcher->needle        =   s2;
+    searcher->len           =   n2;
+    searcher->flags         =   flags;
+    searcher->filterable    =   0;
+
+    for (i = 0; i != 256; ++i)
+    {
+        searcher->fold[i] = STLSOFT_STATIC_CAST(unsigned char, (STLSOFT_C_STRNSTRN_SEARCHER_F_IGNORE_CASE & flags) ? STLSOFT_NS_GLOBAL(toupper)(STLSOFT_STATIC_CAST(int, i)) : STLSOFT_STATIC_CAST(int, i));
+    }
+
+    if (n2 > 1)
+    {
+        unsigned char const* const p = STLSOFT_C_CAST(unsigned char const*, s2);
+
+        if (0 == (STLSOFT_C_STRNSTRN_SEARCHER_F_IGNORE_CASE & flags))
+        {
+            searcher->first[0]  =   searcher->first[1]  =   p[0];
+            searcher->last[0]   =   searcher->last[1]   =   p[n2 - 1];
+            searcher->filterable = 1;
+        }
+        else
+        {
+            searcher->filterable = stlsoft_C_strnstrn_searcher_init_filter_(searcher, p[0], searcher->first) &&
+                                   stlsoft_C_strnstrn_searcher_init_filter_(searcher, p[n2 - 1], searcher->last);
+        }
+
+        stlsoft_C_strnstrn_searcher_init_skip_(searcher);
+    }
+}
+
+/** Finds the needle of the given searcher within a specific-length (slice
+ * of a) string
+ *
+ * \param searcher Pointer to the searcher. May not be NULL
+ * \param s1 Pointer to the string in which to search
+ * \param n1 Length of the string in which to search
+ *
+ * \retval nullptr The needle is not found in [s1, s1 + n1)
+ */
+STLSOFT_INLINE
+char const*
+stlsoft_C_strnstrn_searcher_find(
+    struct stlsoft_C_strnstrn_searcher_t const* searcher
+,   char const*                                 s1
+,   size_t                                      n1
+)
+{
+    size_t  n2;
+    int     exact;
+
+    STLSOFT_ASSERT(ss_nullptr_k != searcher);
+
+    n2      =   searcher->len;
+    exact   =   0 == (STLSOFT_C_STRNSTRN_SEARCHER_F_IGNORE_CASE & searcher->flags);
+
+    if (0 == n2)
+    {
+        return s1;
+    }
+    if (n1 < n2)
+    {
+        return ss_nullptr_k;
+    }
+
+    if (1 == n2)
+    {
+        if (exact)
+        {
+            return STLSOFT_STATIC_CAST(char const*, STLSOFT_NS_GLOBAL(memchr)(s1, searcher->needle[0], n1));
+        }
+    }
+    else if (n2 < STLSOFT_C_STRNSTRN_HORSPOOL_MIN_NEEDLE)
+    {
+        if (exact)
+        {
+            return stlsoft_C_strnstrn_filter_exact_(s1, n1, searcher->needle, n2);
+        }
+        else if (searcher->filterable)
+        {
+            return stlsoft_C_strnstrn_filter_folded_(searcher, s1, n1);
+        }
+    }
+    else
+    {
+        return stlsoft_C_strnstrn_horspool_(s1, n1, searcher->needle, n2, searcher->fold, searcher->skip, exact);
+    }
+
+    /* case-insensitive, and either a single character or not filterable */
+    {
+        unsigned char const* const  h   =   STLSOFT_C_CAST(unsigned char const*, s1);
+        unsigned char const* const  p   =   STLSOFT_C_CAST(unsigned char const*, searcher->needle);
+        size_t                      i;
+
+        for (i = 0; n1 - i >= n2; ++i)
+        {
+            if (stlsoft_C_strnstrn_equal_folded_(h + i, p, n2, searcher->fold))
+            {
+                return s1 + i;
+            }
+        }
+
+        return ss_nullptr_k;
+    }
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifdef __cplusplus
+# ifndef STLSOFT_NO_NAMESPACE
+namespace stlsoft
+{
+namespace c_string
+{
+# endif /* STLSOFT_NO_NAMESPACE */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * classes
+ */
+
+/** Precompiled needle, for searching any number of haystacks for the same
+ * (slice of a) string
+ *
+ * \ingroup group__library__String
+ *
+\code
+  stlsoft::c_string::strnstrn_searcher searcher("ERROR", 5);
+
+  for (each line)
+  {
+    if (NULL != searcher.find(line.data(), line.size()))
+    {
+      . . .
+    }
+  }
+\endcode
+ *
+ * \note The searcher refers to, rather than copies, the needle, which must
+ *   therefore outlive it
+ */
+class strnstrn_searcher
+{
+/// \name Member Types
+/// @{
+public:
+    /// This type
+    typedef strnstrn_searcher                               class_type;
+    /// The character type
+    typedef ss_char_a_t                                     char_type;
+    /// The size type
+    typedef ss_size_t                                       size_type;
+/// @}
+
+/// \name Member Constants
+/// @{
+public:
+    enum
+    {
+        ignoreCase = STLSOFT_C_STRNSTRN_SEARCHER_F_IGNORE_CASE  /*!< Causes the search to be case-insensitive */
+    };
+/// @}
+
+/// \name Construction
+/// @{
+public:
+    /// Constructs a searcher for the given needle
+    strnstrn_searcher(
+        char_type const*    s2
+    ,   size_type           n2
+    ,   int                 flags = 0
+    )
+    {
+        stlsoft_C_strnstrn_searcher_init(&m_searcher, s2, n2, flags);
+    }
+/// @}
+
+/// \name Operations
+/// @{
+public:
+    /// Finds the needle within [s1, s1 + n1)
+    ///
+    /// \retval nullptr The needle is not found
+    char_type const*
+    find(
+        char_type const*    s1
+    ,   size_type           n1
+    ) const
+    {
+        return stlsoft_C_strnstrn_searcher_find(&m_searcher, s1, n1);
+    }
+/// @}
+
+/// \name Attributes
+/// @{
+public:
+    /// The needle
+    char_type const*    data() const STLSOFT_NOEXCEPT
+    {
+        return m_searcher.needle;
+    }
+    /// The length of the needle
+    size_type           size() const STLSOFT_NOEXCEPT
+    {
+        return m_searcher.len;
+    }
+/// @}
+
+/// \name Members
+/// @{
+private:
+    stlsoft_C_strnstrn_searcher_t m_searcher;
+/// @}
+};
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+# ifndef STLSOFT_NO_NAMESPACE
+} /* namespace c_string */
+} /* namespace stlsoft */
+# endif /* STLSOFT_NO_NAMESPACE */
+#endif /* __cplusplus */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !STLSOFT_INCL_STLSOFT_STRING_C_STRING_H_STRNSTRN_SEARCHER */
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -4,11 +4,11 @@
  * Purpose:     String token parsing class using char-sets.
  *
  * Created:     17th October 2005
- * Updated:     11th March 2024
+ * Updated:     16th October 2026
  *
  * Home:        http://stlsoft.org/
  *
- * Copyright (c) 2019-2024, Matthew Wilson and Synesis Information Systems
+ * Copyright (c) 2019-2026, Matthew Wilson and Synesis Information Systems
  * Copyright (c) 2005-2019, Matthew Wilson and Synesis Software
  * All rights reserved.
  *
@@ -53,9 +53,9 @@
 
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 # define STLSOFT_VER_STLSOFT_STRING_HPP_CHARSET_TOKENISER_MAJOR     2
-# define STLSOFT_VER_STLSOFT_STRING_HPP_CHARSET_TOKENISER_MINOR     0
-# define STLSOFT_VER_STLSOFT_STRING_HPP_CHARSET_TOKENISER_REVISION  8
-# define STLSOFT_VER_STLSOFT_STRING_HPP_CHARSET_TOKENISER_EDIT      39
+# define STLSOFT_VER_STLSOFT_STRING_HPP_CHARSET_TOKENISER_MINOR     1
+# define STLSOFT_VER_STLSOFT_STRING_HPP_CHARSET_TOKENISER_REVISION  0
+# define STLSOFT_VER_STLSOFT_STRING_HPP_CHARSET_TOKENISER_EDIT      40
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 
@@ -78,6 +78,9 @@
 #ifndef STLSOFT_INCL_STLSOFT_STRING_HPP_STRING_TOKENISER
 # include <stlsoft/string/string_tokeniser.hpp>
 #endif /* !STLSOFT_INCL_STLSOFT_STRING_HPP_STRING_TOKENISER */
+#ifndef STLSOFT_INCL_STLSOFT_STRING_C_STRING_H_STRNPBRKN
+# include <stlsoft/string/c_string/strnpbrkn.h>
+#endif /* !STLSOFT_INCL_STLSOFT_STRING_C_STRING_H_STRNPBRKN */
 
 #ifndef STLSOFT_INCL_ALGORITHM
 # define STLSOFT_INCL_ALGORITHM
@@ -168,6 +171,44 @@ public:
     }
 };
 
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+// Overloads of string_tokeniser_find_delimiter_() (see
+// stlsoft/string/string_tokeniser.hpp) for contiguous ranges, which search
+// for any member of the set with stlsoft_C_strnpbrkn() (which uses SIMD,
+// where available) / stlsoft_C_wcsnpbrkn().
+
+template <ss_typename_param_k S>
+inline
+ss_char_a_t const*
+string_tokeniser_find_delimiter_(
+    charset_comparator<S>*  /* comparator */
+,   ss_char_a_t const*      from
+,   ss_char_a_t const*      to
+,   S const&                delimiter
+)
+{
+    ss_char_a_t const* const p = stlsoft_C_strnpbrkn(from, static_cast<ss_size_t>(to - from), c_str_data_a(delimiter), c_str_len_a(delimiter));
+
+    return (ss_nullptr_k == p) ? to : p;
+}
+
+template <ss_typename_param_k S>
+inline
+ss_char_w_t const*
+string_tokeniser_find_delimiter_(
+    charset_comparator<S>*  /* comparator */
+,   ss_char_w_t const*      from
+,   ss_char_w_t const*      to
+,   S const&                delimiter
+)
+{
+    ss_char_w_t const* const p = stlsoft_C_wcsnpbrkn(from, static_cast<ss_size_t>(to - from), c_str_data_w(delimiter), c_str_len_w(delimiter));
+
+    return (ss_nullptr_k == p) ? to : p;
+}
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
 /** A class template that provides string tokenising behaviour, where the delimiter is a character set, a la <code>strtok()</code>
  *
  * \ingroup group__library__String
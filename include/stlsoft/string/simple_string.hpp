@@ -4,7 +4,7 @@
  * Purpose: basic_simple_string class template.
  *
  * Created: 19th March 1993
- * Updated: 5th November 2024
+ * Updated: 16th October 2026
  *
  * Home:    http://stlsoft.org/
  *
@@ -53,9 +53,9 @@
 
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 # define STLSOFT_VER_STLSOFT_STRING_HPP_SIMPLE_STRING_MAJOR     4
-# define STLSOFT_VER_STLSOFT_STRING_HPP_SIMPLE_STRING_MINOR     8
-# define STLSOFT_VER_STLSOFT_STRING_HPP_SIMPLE_STRING_REVISION  3
-# define STLSOFT_VER_STLSOFT_STRING_HPP_SIMPLE_STRING_EDIT      283
+# define STLSOFT_VER_STLSOFT_STRING_HPP_SIMPLE_STRING_MINOR     9
+# define STLSOFT_VER_STLSOFT_STRING_HPP_SIMPLE_STRING_REVISION  0
+# define STLSOFT_VER_STLSOFT_STRING_HPP_SIMPLE_STRING_EDIT      286
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 
@@ -119,6 +119,16 @@
 #ifdef STLSOFT_CF_EXCEPTION_SUPPORT
 # include <stdexcept>                       // for std::out_of_range
 #endif /* !STLSOFT_CF_EXCEPTION_SUPPORT */
+#ifndef STLSOFT_INCL_H_STDDEF
+# define STLSOFT_INCL_H_STDDEF
+# include <stddef.h>                        // for offsetof
+#endif /* !STLSOFT_INCL_H_STDDEF */
+#ifdef STLSOFT_LF_ALLOCATOR_TRAITS_SUPPORT
+# ifndef STLSOFT_INCL_MEMORY
+#  define STLSOFT_INCL_MEMORY
+#  include <memory>                         // for std::allocator_traits
+# endif /* !STLSOFT_INCL_MEMORY */
+#endif /* STLSOFT_LF_ALLOCATOR_TRAITS_SUPPORT */
 
 #ifndef STLSOFT_INCL_STLSOFT_API_internal_h_memfns
 # include <stlsoft/api/internal/memfns.h>
@@ -135,6 +145,22 @@
 #endif /* compiler */
 
 
+/* /////////////////////////////////////////////////////////////////////////
+ * constants
+ */
+
+/** The number of bytes of string contents, including the nul-terminator,
+ * that are held within a basic_simple_string instance, rather than
+ * allocated
+ *
+ * \note This may be defined by the user, before inclusion, to tune the
+ *   instance size against the proportion of strings that are allocated
+ */
+#ifndef STLSOFT_SIMPLE_STRING_INTERNAL_BYTES
+# define STLSOFT_SIMPLE_STRING_INTERNAL_BYTES               (16)
+#endif /* !STLSOFT_SIMPLE_STRING_INTERNAL_BYTES */
+
+
 /* /////////////////////////////////////////////////////////////////////////
  * namespace
  */
@@ -155,6 +181,14 @@ namespace stlsoft
  * \param T The traits type. On translators that support default template arguments this is defaulted to char_traits<C>
  * \param A The allocator type. On translators that support default template arguments this is defaulted to allocator_selector<C>::allocator_type
  *
+ * Strings short enough to fit, along with their nul-terminator, within
+ * STLSOFT_SIMPLE_STRING_INTERNAL_BYTES are held within the instance; only
+ * longer strings are allocated.
+ *
+ * \note Because short strings are held within the instance, pointers and
+ *   iterators to them are invalidated by swap() and by move construction,
+ *   as well as by modification
+ *
  * \ingroup group__library__String
  */
 template<
@@ -244,7 +278,15 @@ private:
     ///
     /// \note This has to be defined here, rather than on a use-by-use basis, because
     /// Borland gets very upset.
-#ifdef STLSOFT_LF_ALLOCATOR_REBIND_SUPPORT
+#if 0
+#elif defined(STLSOFT_LF_ALLOCATOR_TRAITS_SUPPORT)
+
+    typedef ss_typename_type_k STLSOFT_NS_QUAL_STD(allocator_traits)<
+        A
+    >::ss_template_qual_k rebind_alloc<
+        ss_byte_t
+    >                                                       byte_ator_type;
+#elif defined(STLSOFT_LF_ALLOCATOR_REBIND_SUPPORT)
 
     typedef ss_typename_type_k A::ss_template_qual_k rebind<
         ss_byte_t
@@ -595,6 +637,24 @@ private:
         char_type   contents[1];    // The first element in the array
     };
 
+    // The number of char places in the internal buffer
+    enum
+    {
+        internal_size = (STLSOFT_SIMPLE_STRING_INTERNAL_BYTES / sizeof(char_type)) < 2
+                            ? 2
+                            : (STLSOFT_SIMPLE_STRING_INTERNAL_BYTES / sizeof(char_type))
+    };
+
+    // Holds strings of up to (internal_size - 1) characters in the
+    // instance. It has the same initial members as string_buffer, so that
+    // m_buffer may refer to either
+    struct internal_buffer
+    {
+        size_type   capacity;
+        size_type   length;
+        char_type   contents[internal_size];
+    };
+
     typedef auto_buffer<
         char_type
     ,   auto_buffer_internal_size_calculator<char_type>::value
@@ -621,16 +681,28 @@ private:
 
     // Creating buffer
     static member_pointer       alloc_buffer_(char_type const* s, size_type capacity, size_type length);
-    static member_pointer       alloc_buffer_(char_type const* s, size_type cch);
-    static member_pointer       alloc_buffer_(char_type const* s);
+
+    // Creating buffer, in the internal buffer if it will fit
+    member_pointer              make_buffer_(char_type const* s, size_type capacity, size_type length);
+    member_pointer              make_buffer_(char_type const* s, size_type cch);
+    member_pointer              make_buffer_(char_type const* s);
 
     // Copying a buffer
-    static member_pointer       copy_buffer_(member_pointer );
+    member_pointer              copy_buffer_(member_pointer );
 
     // Destroying buffer
     static void                 destroy_buffer_(string_buffer*) STLSOFT_NOEXCEPT;
     static void                 destroy_buffer_(char_type*) STLSOFT_NOEXCEPT;
 
+    // Releasing buffer, which is destroyed unless it is the internal buffer
+    void                        release_buffer_(string_buffer*) STLSOFT_NOEXCEPT;
+    void                        release_buffer_(char_type*) STLSOFT_NOEXCEPT;
+
+    // Internal buffer
+    member_pointer              internal_pointer_() STLSOFT_NOEXCEPT;
+    ss_bool_t                   is_internal_() const STLSOFT_NOEXCEPT;
+    void                        take_internal_(class_type& rhs) STLSOFT_NOEXCEPT;
+
     // Iteration
     pointer                     begin_() STLSOFT_NOEXCEPT;
     pointer                     end_() STLSOFT_NOEXCEPT;
@@ -751,6 +823,7 @@ private:
 /// \name Members
 /// @{
 private:
+    internal_buffer m_internal;
     member_pointer  m_buffer;
 /// @}
 };
@@ -1791,9 +1864,50 @@ template <
 ,   ss_typename_param_k A
 >
 inline
-/* static */
 ss_typename_type_ret_k basic_simple_string<C, T, A>::member_pointer
-basic_simple_string<C, T, A>::alloc_buffer_(
+basic_simple_string<C, T, A>::make_buffer_(
+    ss_typename_type_k basic_simple_string<C, T, A>::char_type const*   s
+,   ss_typename_type_k basic_simple_string<C, T, A>::size_type          capacity
+,   ss_typename_type_k basic_simple_string<C, T, A>::size_type          length
+)
+{
+    // Pre-conditions
+    STLSOFT_ASSERT(length <= capacity);
+
+    if (capacity < internal_size)
+    {
+        // NOTE: s may refer to the internal buffer (as in self-assignment)
+        // so the contents are moved, rather than copied
+
+        if (ss_nullptr_k == s)
+        {
+            STLSOFT_ASSERT(0 == length);
+        }
+        else
+        {
+            traits_type::move(m_internal.contents, s, length);
+        }
+
+        m_internal.contents[length] =   traits_type::to_char_type(0);
+        m_internal.length           =   length;
+        m_internal.capacity         =   internal_size;
+
+        return internal_pointer_();
+    }
+    else
+    {
+        return alloc_buffer_(s, capacity, length);
+    }
+}
+
+template <
+    ss_typename_param_k C
+,   ss_typename_param_k T
+,   ss_typename_param_k A
+>
+inline
+ss_typename_type_ret_k basic_simple_string<C, T, A>::member_pointer
+basic_simple_string<C, T, A>::make_buffer_(
     ss_typename_type_k basic_simple_string<C, T, A>::char_type const*   s
 ,   ss_typename_type_k basic_simple_string<C, T, A>::size_type          cch
 )
@@ -1806,7 +1920,7 @@ basic_simple_string<C, T, A>::alloc_buffer_(
         length = cch;
     }
 
-    return alloc_buffer_(s, capacity, length);
+    return make_buffer_(s, capacity, length);
 }
 
 template <
@@ -1815,9 +1929,8 @@ template <
 ,   ss_typename_param_k A
 >
 inline
-/* static */
 ss_typename_type_ret_k basic_simple_string<C, T, A>::member_pointer
-basic_simple_string<C, T, A>::alloc_buffer_(ss_typename_type_k basic_simple_string<C, T, A>::char_type const* s)
+basic_simple_string<C, T, A>::make_buffer_(ss_typename_type_k basic_simple_string<C, T, A>::char_type const* s)
 {
     member_pointer res;
 
@@ -1829,7 +1942,7 @@ basic_simple_string<C, T, A>::alloc_buffer_(ss_typename_type_k basic_simple_stri
     {
         size_type len = traits_type::length(s);
 
-        res = alloc_buffer_(s, len, len);
+        res = make_buffer_(s, len, len);
     }
 
     return res;
@@ -1841,15 +1954,23 @@ template <
 ,   ss_typename_param_k A
 >
 inline
-/* static */
 ss_typename_type_ret_k basic_simple_string<C, T, A>::member_pointer
 basic_simple_string<C, T, A>::copy_buffer_(ss_typename_type_k basic_simple_string<C, T, A>::member_pointer m)
 {
+    if (ss_nullptr_k != m &&
+        string_buffer_from_member_pointer_(m)->length < internal_size)
+    {
+        string_buffer const* const buffer = string_buffer_from_member_pointer_(m);
+
+        return make_buffer_(buffer->contents, buffer->length, buffer->length);
+    }
+
     if (ss_nullptr_k != m)
     {
         byte_ator_type          byte_ator;
         string_buffer* const    buffer      =   string_buffer_from_member_pointer_(m);
-        ss_size_t const         cb          =   buffer->capacity * sizeof(char_type) + STLSOFT_RAW_OFFSETOF(string_buffer, contents);
+        ss_size_t const         members     =   (STLSOFT_RAW_OFFSETOF(string_buffer, contents) + (sizeof(char_type) - 1)) / sizeof(char_type);
+        ss_size_t const         cb          =   (buffer->capacity + members) * sizeof(char_type);
 # ifdef STLSOFT_LF_ALLOCATOR_ALLOCATE_HAS_HINT
 
         void* const             raw_buffer  =   byte_ator.allocate(cb, ss_nullptr_k);
@@ -1892,9 +2013,15 @@ basic_simple_string<C, T, A>::destroy_buffer_(ss_typename_type_k basic_simple_st
 # endif
 #endif
 
+    // pass the size that was allocated, for the benefit of allocators
+    // that use (or record) it
+
+    ss_size_t const members = (STLSOFT_RAW_OFFSETOF(string_buffer, contents) + (sizeof(char_type) - 1)) / sizeof(char_type);
+    ss_size_t const cb      = (buffer->capacity + members) * sizeof(char_type);
+
     byte_ator_type byte_ator;
 
-    byte_ator.deallocate(sap_cast<ss_byte_t*>(buffer), 0);
+    byte_ator.deallocate(sap_cast<ss_byte_t*>(buffer), cb);
 
 #ifndef STLSOFT_SIMPLE_STRING_NO_PTR_ADJUST
 
@@ -1918,6 +2045,88 @@ basic_simple_string<C, T, A>::destroy_buffer_(ss_typename_type_k basic_simple_st
     destroy_buffer_(string_buffer_from_member_pointer_(s));
 }
 
+template <
+    ss_typename_param_k C
+,   ss_typename_param_k T
+,   ss_typename_param_k A
+>
+inline
+void
+basic_simple_string<C, T, A>::release_buffer_(ss_typename_type_k basic_simple_string<C, T, A>::string_buffer* buffer) STLSOFT_NOEXCEPT
+{
+    if (STLSOFT_C_CAST(void*, buffer) != STLSOFT_C_CAST(void*, &m_internal))
+    {
+        destroy_buffer_(buffer);
+    }
+}
+
+template <
+    ss_typename_param_k C
+,   ss_typename_param_k T
+,   ss_typename_param_k A
+>
+inline
+void
+basic_simple_string<C, T, A>::release_buffer_(ss_typename_type_k basic_simple_string<C, T, A>::char_type* s) STLSOFT_NOEXCEPT
+{
+    release_buffer_(string_buffer_from_member_pointer_(s));
+}
+
+template <
+    ss_typename_param_k C
+,   ss_typename_param_k T
+,   ss_typename_param_k A
+>
+inline
+ss_typename_type_ret_k basic_simple_string<C, T, A>::member_pointer
+basic_simple_string<C, T, A>::internal_pointer_() STLSOFT_NOEXCEPT
+{
+    // The internal buffer is accessed as a string_buffer, in the same way
+    // as the allocated buffers (which are larger than string_buffer, to
+    // hold their contents). The two types are standard-layout and differ
+    // only in the bound of contents, so their members have the same
+    // offsets, which is verified here; the members are accessed only
+    // individually - as size_type and char_type - and never as whole
+    // objects of either type.
+
+    STLSOFT_STATIC_ASSERT(offsetof(internal_buffer, capacity) == offsetof(string_buffer, capacity));
+    STLSOFT_STATIC_ASSERT(offsetof(internal_buffer, length) == offsetof(string_buffer, length));
+    STLSOFT_STATIC_ASSERT(offsetof(internal_buffer, contents) == offsetof(string_buffer, contents));
+
+    return member_pointer_from_string_buffer_(reinterpret_cast<string_buffer*>(&m_internal));
+}
+
+template <
+    ss_typename_param_k C
+,   ss_typename_param_k T
+,   ss_typename_param_k A
+>
+inline
+ss_bool_t
+basic_simple_string<C, T, A>::is_internal_() const STLSOFT_NOEXCEPT
+{
+    return ss_nullptr_k != m_buffer &&
+           STLSOFT_C_CAST(void const*, string_buffer_from_member_pointer_(m_buffer)) == STLSOFT_C_CAST(void const*, &m_internal);
+}
+
+template <
+    ss_typename_param_k C
+,   ss_typename_param_k T
+,   ss_typename_param_k A
+>
+inline
+void
+basic_simple_string<C, T, A>::take_internal_(ss_typename_type_k basic_simple_string<C, T, A>::class_type& rhs) STLSOFT_NOEXCEPT
+{
+    STLSOFT_ASSERT(rhs.is_internal_());
+
+    traits_type::copy(m_internal.contents, rhs.m_internal.contents, rhs.m_internal.length + 1);
+    m_internal.length   =   rhs.m_internal.length;
+    m_internal.capacity =   internal_size;
+
+    m_buffer = internal_pointer_();
+}
+
 template <
     ss_typename_param_k C
 ,   ss_typename_param_k T
@@ -2008,7 +2217,8 @@ template <
 inline
 ss_constexpr_2014_k
 basic_simple_string<C, T, A>::basic_simple_string() STLSOFT_NOEXCEPT
-    : m_buffer(ss_nullptr_k)
+    : m_internal()
+    , m_buffer(ss_nullptr_k)
 {
     STLSOFT_ASSERT(is_valid());
 }
@@ -2020,9 +2230,12 @@ template <
 >
 inline
 basic_simple_string<C, T, A>::basic_simple_string(class_type const& rhs)
-    : m_buffer(copy_buffer_(rhs.m_buffer))
+    : m_buffer(ss_nullptr_k)
 {
     STLSOFT_ASSERT(rhs.is_valid());
+
+    m_buffer = copy_buffer_(rhs.m_buffer);
+
     STLSOFT_ASSERT(is_valid());
 }
 
@@ -2036,8 +2249,9 @@ basic_simple_string<C, T, A>::basic_simple_string(
     ss_typename_type_k basic_simple_string<C, T, A>::class_type const&  rhs
 ,   ss_typename_type_k basic_simple_string<C, T, A>::size_type          pos
 )
-    : m_buffer(alloc_buffer_(&rhs[pos], rhs.size() - pos))
+    : m_buffer(ss_nullptr_k)
 {
+    m_buffer = make_buffer_(rhs.data() + pos, rhs.size() - pos);
 
     STLSOFT_ASSERT(is_valid());
 }
@@ -2053,8 +2267,10 @@ basic_simple_string<C, T, A>::basic_simple_string(
 ,   ss_typename_type_k basic_simple_string<C, T, A>::size_type          pos
 ,   ss_typename_type_k basic_simple_string<C, T, A>::size_type          cch
 )
-    : m_buffer(alloc_buffer_(&rhs[pos], cch, minimum(cch, rhs.size() - pos)))
+    : m_buffer(ss_nullptr_k)
 {
+    m_buffer = make_buffer_(rhs.data() + pos, cch, minimum(cch, rhs.size() - pos));
+
     STLSOFT_ASSERT(is_valid());
 }
 
@@ -2065,8 +2281,10 @@ template <
 >
 inline
 basic_simple_string<C, T, A>::basic_simple_string(ss_typename_type_k basic_simple_string<C, T, A>::char_type const* s)
-    : m_buffer(alloc_buffer_(s))
+    : m_buffer(ss_nullptr_k)
 {
+    m_buffer = make_buffer_(s);
+
     STLSOFT_ASSERT(is_valid());
 }
 
@@ -2080,8 +2298,10 @@ basic_simple_string<C, T, A>::basic_simple_string(
     ss_typename_type_k basic_simple_string<C, T, A>::char_type const* s
 ,   ss_typename_type_k basic_simple_string<C, T, A>::size_type cch
 )
-    : m_buffer(alloc_buffer_(s, cch))
+    : m_buffer(ss_nullptr_k)
 {
+    m_buffer = make_buffer_(s, cch);
+
     STLSOFT_ASSERT(is_valid());
 }
 
@@ -2113,8 +2333,10 @@ basic_simple_string<C, T, A>::basic_simple_string(
     ss_typename_type_k basic_simple_string<C, T, A>::char_type const*   first
 ,   ss_typename_type_k basic_simple_string<C, T, A>::char_type const*   last
 )
-    : m_buffer(alloc_buffer_(first, last - first))
+    : m_buffer(ss_nullptr_k)
 {
+    m_buffer = make_buffer_(first, last - first);
+
     STLSOFT_ASSERT(is_valid());
 }
 #endif /* !STLSOFT_CF_MEMBER_TEMPLATE_RANGE_METHOD_SUPPORT */
@@ -2130,6 +2352,11 @@ inline
 basic_simple_string<C, T, A>::basic_simple_string(class_type&& rhs) STLSOFT_NOEXCEPT
     : m_buffer(rhs.m_buffer)
 {
+    if (rhs.is_internal_())
+    {
+        take_internal_(rhs);
+    }
+
     rhs.m_buffer = ss_nullptr_k;
 }
 #endif /* STLSOFT_CF_RVALUE_REFERENCES_SUPPORT */
@@ -2168,7 +2395,7 @@ basic_simple_string<C, T, A>::~basic_simple_string() STLSOFT_NOEXCEPT
 
     if (ss_nullptr_k != m_buffer)
     {
-        destroy_buffer_(m_buffer);
+        release_buffer_(m_buffer);
     }
 }
 
@@ -3388,14 +3615,14 @@ basic_simple_string<C, T, A>::assign(
         }
         else
         {
-            m_buffer = alloc_buffer_(s, cch);
+            m_buffer = make_buffer_(s, cch);
         }
     }
     else
     {
         if (ss_nullptr_k == s)
         {
-            destroy_buffer_(m_buffer);
+            release_buffer_(m_buffer);
 
             m_buffer = ss_nullptr_k;
         }
@@ -3422,9 +3649,13 @@ basic_simple_string<C, T, A>::assign(
             }
             else
             {
-                member_pointer const new_buffer = alloc_buffer_(s, cch, cch);
+                member_pointer const old_buffer = m_buffer;
+                member_pointer const new_buffer = make_buffer_(s, cch, cch);
 
-                destroy_buffer_(m_buffer);
+                if (old_buffer != new_buffer)
+                {
+                    release_buffer_(old_buffer);
+                }
 
                 m_buffer = new_buffer;
             }
@@ -3620,7 +3851,7 @@ basic_simple_string<C, T, A>::append(
             if (buffer->capacity - buf_len < 1 + cch)
             {
                 // Allocate a new buffer of sufficient size
-                member_pointer const new_buffer = alloc_buffer_(buffer->contents, buf_len + cch);
+                member_pointer const new_buffer = make_buffer_(buffer->contents, buf_len + cch);
 
                 if (ss_nullptr_k == new_buffer) // Some allocators do not throw on failure!
                 {
@@ -3640,7 +3871,7 @@ basic_simple_string<C, T, A>::append(
 
             if (ss_nullptr_k != old_buffer)
             {
-                destroy_buffer_(old_buffer);
+                release_buffer_(old_buffer);
             }
         }
     }
@@ -3844,13 +4075,13 @@ basic_simple_string<C, T, A>::reserve(ss_typename_type_k basic_simple_string<C,
     {
         if (ss_nullptr_k == m_buffer)
         {
-            m_buffer = alloc_buffer_(ss_nullptr_k, cch, 0);
+            m_buffer = make_buffer_(ss_nullptr_k, cch, 0);
         }
         else
         {
-            if (cch <= string_buffer_from_member_pointer_(m_buffer)->capacity)
+            if (cch < string_buffer_from_member_pointer_(m_buffer)->capacity)
             {
-                ; // Nothing to do
+                ; // Nothing to do (capacity includes the nul-terminator)
             }
             else
             {
@@ -3859,7 +4090,7 @@ basic_simple_string<C, T, A>::reserve(ss_typename_type_k basic_simple_string<C,
 
                 if (ss_nullptr_k != new_buffer) // Some allocators do not throw on failure!
                 {
-                    destroy_buffer_(m_buffer);
+                    release_buffer_(m_buffer);
                     m_buffer = new_buffer;
                 }
             }
@@ -3879,7 +4110,51 @@ basic_simple_string<C, T, A>::swap(ss_typename_type_k basic_simple_string<C, T,
     STLSOFT_ASSERT(is_valid());
     STLSOFT_ASSERT(other.is_valid());
 
-    std_swap(m_buffer, other.m_buffer);
+    if (this == &other)
+    {
+        ; // Nothing to do
+    }
+    else if (is_internal_() ||
+             other.is_internal_())
+    {
+        // The contents of an internal buffer must be moved into the other
+        // instance, so the swap is effected via a temporary
+
+        class_type  t;
+
+        if (other.is_internal_())
+        {
+            t.take_internal_(other);
+        }
+        else
+        {
+            t.m_buffer = other.m_buffer;
+        }
+
+        if (is_internal_())
+        {
+            other.take_internal_(*this);
+        }
+        else
+        {
+            other.m_buffer = m_buffer;
+        }
+
+        if (t.is_internal_())
+        {
+            take_internal_(t);
+        }
+        else
+        {
+            m_buffer = t.m_buffer;
+        }
+
+        t.m_buffer = ss_nullptr_k;
+    }
+    else
+    {
+        std_swap(m_buffer, other.m_buffer);
+    }
 }
 
 template <
@@ -3902,8 +4177,8 @@ basic_simple_string<C, T, A>::resize(
     {
         if (len < cch)
         {
-            /* Expand the string, using self-assignemt. */
-            assign(c_str(), cch);
+            /* Expand the string, preserving the existing contents. */
+            reserve(cch);
 
             traits_type::assign(char_pointer_from_member_pointer_(m_buffer) + len, cch - len, ch);
         }
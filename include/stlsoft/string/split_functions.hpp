@@ -4,11 +4,11 @@
  * Purpose: String split functions.
  *
  * Created: 28th January 2005
- * Updated: 10th October 2024
+ * Updated: 16th October 2026
  *
  * Home:    http://stlsoft.org/
  *
- * Copyright (c) 2019-2024, Matthew Wilson and Synesis Information Systems
+ * Copyright (c) 2019-2026, Matthew Wilson and Synesis Information Systems
  * Copyright (c) 2005-2019, Matthew Wilson and Synesis Software
  * All rights reserved.
  *
@@ -52,9 +52,9 @@
 
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 # define STLSOFT_VER_INCL_STLSOFT_STRING_HPP_SPLIT_FUNCTIONS_MAJOR      2
-# define STLSOFT_VER_INCL_STLSOFT_STRING_HPP_SPLIT_FUNCTIONS_MINOR      5
-# define STLSOFT_VER_INCL_STLSOFT_STRING_HPP_SPLIT_FUNCTIONS_REVISION   3
-# define STLSOFT_VER_INCL_STLSOFT_STRING_HPP_SPLIT_FUNCTIONS_EDIT       65
+# define STLSOFT_VER_INCL_STLSOFT_STRING_HPP_SPLIT_FUNCTIONS_MINOR      6
+# define STLSOFT_VER_INCL_STLSOFT_STRING_HPP_SPLIT_FUNCTIONS_REVISION   0
+# define STLSOFT_VER_INCL_STLSOFT_STRING_HPP_SPLIT_FUNCTIONS_EDIT       66
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 
@@ -81,9 +81,18 @@
 # define STLSOFT_STRING_SPLIT_FUNCTIONS_CANNOT_USE_STATIC_ARRAY
 #endif /* compiler */
 
+#ifndef STLSOFT_INCL_STLSOFT_COLLECTIONS_HPP_ARRAY_VIEW
+# include <stlsoft/collections/array_view.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_COLLECTIONS_HPP_ARRAY_VIEW */
 #ifndef STLSOFT_INCL_STLSOFT_SHIMS_ACCESS_HPP_STRING
 # include <stlsoft/shims/access/string.hpp>
 #endif /* !STLSOFT_INCL_STLSOFT_SHIMS_ACCESS_HPP_STRING */
+#ifndef STLSOFT_INCL_STLSOFT_STRING_C_STRING_H_STRNCHR
+# include <stlsoft/string/c_string/strnchr.h>
+#endif /* !STLSOFT_INCL_STLSOFT_STRING_C_STRING_H_STRNCHR */
+#ifndef STLSOFT_INCL_STLSOFT_UTIL_BITS_H_TEST_FUNCTIONS
+# include <stlsoft/util/bits/test_functions.h>
+#endif /* !STLSOFT_INCL_STLSOFT_UTIL_BITS_H_TEST_FUNCTIONS */
 #ifndef STLSOFT_STRING_SPLIT_FUNCTIONS_CANNOT_USE_STATIC_ARRAY
 # ifndef STLSOFT_INCL_STLSOFT_CONTAINERS_HPP_STATIC_ARRAY
 #  include <stlsoft/containers/static_array.hpp>
@@ -105,6 +114,19 @@
 # include <vector>
 #endif /* !STLSOFT_INCL_VECTOR */
 
+#if !defined(STLSOFT_STRING_SPLIT_FUNCTIONS_NO_USE_SIMD)
+# if defined(__SSE2__) || \
+     defined(_M_X64) || \
+     (   defined(_M_IX86_FP) && \
+         _M_IX86_FP >= 2)
+#  define STLSOFT_STRING_SPLIT_FUNCTIONS_USE_SSE2_
+# endif
+#endif /* !STLSOFT_STRING_SPLIT_FUNCTIONS_NO_USE_SIMD */
+
+#if defined(STLSOFT_STRING_SPLIT_FUNCTIONS_USE_SSE2_)
+# include <emmintrin.h>
+#endif
+
 
 /* /////////////////////////////////////////////////////////////////////////
  * namespace
@@ -150,6 +172,44 @@ public: // fields
     ss_ptrdiff_t const  d;
 };
 
+template <ss_typename_param_k C>
+inline
+C const*
+split_find_(
+    C const*    b
+,   C const*    e
+,   C           delim
+)
+{
+    return STLSOFT_NS_QUAL_STD(find)(b, e, delim);
+}
+
+inline
+ss_char_a_t const*
+split_find_(
+    ss_char_a_t const*  b
+,   ss_char_a_t const*  e
+,   ss_char_a_t         delim
+)
+{
+    ss_char_a_t const* const p = stlsoft_C_strnchr(b, static_cast<ss_size_t>(e - b), delim);
+
+    return (ss_nullptr_k != p) ? p : e;
+}
+
+inline
+ss_char_w_t const*
+split_find_(
+    ss_char_w_t const*  b
+,   ss_char_w_t const*  e
+,   ss_char_w_t         delim
+)
+{
+    ss_char_w_t const* const p = stlsoft_C_wcsnchr(b, static_cast<ss_size_t>(e - b), delim);
+
+    return (ss_nullptr_k != p) ? p : e;
+}
+
 template<
     ss_typename_param_k S0
 ,   ss_typename_param_k S1
@@ -168,7 +228,7 @@ split_impl_2(
     C const* const  b   =   s;
     C const* const  e   =   s + cch;
     C const*        it0 =   b;
-    C const*        it1 =   STLSOFT_NS_QUAL_STD(find)(it0, e, delim);
+    C const*        it1 =   split_find_(it0, e, delim);
     ss_uint_t       n   =   b != e;
 
     s0 = S0(it0, flexible_integer(it1 - it0));
@@ -209,7 +269,7 @@ split_impl_3(
     C const* const  b   =   s;
     C const* const  e   =   s + cch;
     C const*        it0 =   b;
-    C const*        it1 =   STLSOFT_NS_QUAL_STD(find)(it0, e, delim);
+    C const*        it1 =   split_find_(it0, e, delim);
     ss_uint_t       n   =   b != e;
 
     s0 = S0(it0, flexible_integer(it1 - it0));
@@ -218,7 +278,7 @@ split_impl_3(
     {
         ++n;
         it0 = ++it1;
-        it1 = STLSOFT_NS_QUAL_STD(find)(it0, e, delim);
+        it1 = split_find_(it0, e, delim);
     }
     else
     {
@@ -265,7 +325,7 @@ split_impl_4(
     C const* const  b   =   s;
     C const* const  e   =   s + cch;
     C const*        it0 =   b;
-    C const*        it1 =   STLSOFT_NS_QUAL_STD(find)(it0, e, delim);
+    C const*        it1 =   split_find_(it0, e, delim);
     ss_uint_t       n   =   b != e;
 
     s0 = S0(it0, flexible_integer(it1 - it0));
@@ -274,7 +334,7 @@ split_impl_4(
     {
         ++n;
         it0 = ++it1;
-        it1 = STLSOFT_NS_QUAL_STD(find)(it0, e, delim);
+        it1 = split_find_(it0, e, delim);
     }
     else
     {
@@ -287,7 +347,7 @@ split_impl_4(
     {
         ++n;
         it0 = ++it1;
-        it1 = STLSOFT_NS_QUAL_STD(find)(it0, e, delim);
+        it1 = split_find_(it0, e, delim);
     }
     else
     {
@@ -336,7 +396,7 @@ split_impl_5(
     C const* const  b   =   s;
     C const* const  e   =   s + cch;
     C const*        it0 =   b;
-    C const*        it1 =   STLSOFT_NS_QUAL_STD(find)(it0, e, delim);
+    C const*        it1 =   split_find_(it0, e, delim);
     ss_uint_t       n   =   b != e;
 
     s0 = S0(it0, flexible_integer(it1 - it0));
@@ -345,7 +405,7 @@ split_impl_5(
     {
         ++n;
         it0 = ++it1;
-        it1 = STLSOFT_NS_QUAL_STD(find)(it0, e, delim);
+        it1 = split_find_(it0, e, delim);
     }
     else
     {
@@ -358,7 +418,7 @@ split_impl_5(
     {
         ++n;
         it0 = ++it1;
-        it1 = STLSOFT_NS_QUAL_STD(find)(it0, e, delim);
+        it1 = split_find_(it0, e, delim);
     }
     else
     {
@@ -371,7 +431,7 @@ split_impl_5(
     {
         ++n;
         it0 = ++it1;
-        it1 = STLSOFT_NS_QUAL_STD(find)(it0, e, delim);
+        it1 = split_find_(it0, e, delim);
     }
     else
     {
@@ -422,7 +482,7 @@ split_impl_6(
     C const* const  b   =   s;
     C const* const  e   =   s + cch;
     C const*        it0 =   b;
-    C const*        it1 =   STLSOFT_NS_QUAL_STD(find)(it0, e, delim);
+    C const*        it1 =   split_find_(it0, e, delim);
     ss_uint_t       n   =   b != e;
 
     s0 = S0(it0, flexible_integer(it1 - it0));
@@ -431,7 +491,7 @@ split_impl_6(
     {
         ++n;
         it0 = ++it1;
-        it1 = STLSOFT_NS_QUAL_STD(find)(it0, e, delim);
+        it1 = split_find_(it0, e, delim);
     }
     else
     {
@@ -444,7 +504,7 @@ split_impl_6(
     {
         ++n;
         it0 = ++it1;
-        it1 = STLSOFT_NS_QUAL_STD(find)(it0, e, delim);
+        it1 = split_find_(it0, e, delim);
     }
     else
     {
@@ -457,7 +517,7 @@ split_impl_6(
     {
         ++n;
         it0 = ++it1;
-        it1 = STLSOFT_NS_QUAL_STD(find)(it0, e, delim);
+        it1 = split_find_(it0, e, delim);
     }
     else
     {
@@ -470,7 +530,7 @@ split_impl_6(
     {
         ++n;
         it0 = ++it1;
-        it1 = STLSOFT_NS_QUAL_STD(find)(it0, e, delim);
+        it1 = split_find_(it0, e, delim);
     }
     else
     {
@@ -495,6 +555,287 @@ split_impl_6(
     return n;
 }
 
+template<
+    ss_typename_param_k V
+,   ss_typename_param_k C
+>
+inline
+V
+split_csv_field_(
+    C const*    b
+,   C const*    e
+)
+{
+    C const quote = C('"');
+
+    if (e - b >= 2 &&
+        quote == b[0] &&
+        quote == e[-1])
+    {
+        ++b;
+        --e;
+    }
+
+    return V(b, flexible_integer(e - b));
+}
+
+/* The scan functions fill at most (maxFields - 1) fields - where
+ * maxFields > 1 - with the ranges preceding each (unquoted) delimiter,
+ * returning the number filled, and setting *pf to the start of the
+ * remainder, which is left to the caller
+ */
+
+template<
+    ss_typename_param_k V
+,   ss_typename_param_k C
+>
+inline
+ss_size_t
+split_fields_scan_(
+    C const*    s
+,   C const*    e
+,   C           delim
+,   V*          fields
+,   ss_size_t   maxFields
+,   C const**   pf
+)
+{
+    ss_size_t   n   =   0;
+    C const*    f   =   s;
+
+    for (C const* p; e != (p = split_find_(f, e, delim)); )
+    {
+        fields[n++] = V(f, flexible_integer(p - f));
+
+        f = p + 1;
+
+        if (n + 1 == maxFields)
+        {
+            break;
+        }
+    }
+
+    *pf = f;
+
+    return n;
+}
+
+template<
+    ss_typename_param_k V
+,   ss_typename_param_k C
+>
+inline
+ss_size_t
+split_csv_fields_scan_(
+    C const*    s
+,   C const*    e
+,   C           delim
+,   V*          fields
+,   ss_size_t   maxFields
+,   C const**   pf
+)
+{
+    C const     quote       =   C('"');
+    ss_size_t   n           =   0;
+    C const*    f           =   s;
+    bool        inQuotes    =   false;
+
+    for (C const* p = s; e != p; ++p)
+    {
+        if (quote == *p)
+        {
+            inQuotes = !inQuotes;
+        }
+        else
+        if (delim == *p &&
+            !inQuotes)
+        {
+            fields[n++] = split_csv_field_<V>(f, p);
+
+            f = p + 1;
+
+            if (n + 1 == maxFields)
+            {
+                break;
+            }
+        }
+    }
+
+    *pf = f;
+
+    return n;
+}
+
+# if defined(STLSOFT_STRING_SPLIT_FUNCTIONS_USE_SSE2_)
+
+/* Writes a field for each unquoted delimiter whose position (relative to
+ * p) is marked in mask - which also marks each quote - returning true if
+ * the fields are exhausted
+ */
+template <ss_typename_param_k V>
+inline
+bool
+split_csv_fields_mask_(
+    ss_char_a_t const*  p
+,   ss_uint32_t         mask
+,   V*                  fields
+,   ss_size_t           maxFields
+,   ss_size_t*          n
+,   ss_char_a_t const** f
+,   bool*               inQuotes
+)
+{
+    for (; 0 != mask; mask &= mask - 1)
+    {
+        ss_char_a_t const* const q = p + stlsoft_C_count_trailing_zero_bits_in_32bit_unsigned_integer(mask);
+
+        if ('"' == *q)
+        {
+            *inQuotes = !*inQuotes;
+        }
+        else
+        if (!*inQuotes)
+        {
+            fields[(*n)++] = split_csv_field_<V>(*f, q);
+
+            *f = q + 1;
+
+            if (*n + 1 == maxFields)
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+/* Locates every delimiter and quote in each block of sixteen characters
+ * with a single pair of comparisons, visiting only those positions to
+ * track the quoting state
+ */
+template <ss_typename_param_k V>
+inline
+ss_size_t
+split_csv_fields_scan_(
+    ss_char_a_t const*  s
+,   ss_char_a_t const*  e
+,   ss_char_a_t         delim
+,   V*                  fields
+,   ss_size_t           maxFields
+,   ss_char_a_t const** pf
+)
+{
+    __m128i const       d           =   _mm_set1_epi8(delim);
+    __m128i const       dq          =   _mm_set1_epi8('"');
+    ss_size_t           n           =   0;
+    ss_char_a_t const*  f           =   s;
+    ss_char_a_t const*  p           =   s;
+    bool                inQuotes    =   false;
+
+    if (e - s < 16)
+    {
+        return split_csv_fields_scan_<V, ss_char_a_t>(s, e, delim, fields, maxFields, pf);
+    }
+
+    for (; e - p >= 16; p += 16)
+    {
+        __m128i const       a       =   _mm_loadu_si128(reinterpret_cast<__m128i const*>(p));
+        ss_uint32_t const   mask    =   static_cast<ss_uint32_t>(_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(a, d), _mm_cmpeq_epi8(a, dq))));
+
+        if (split_csv_fields_mask_(p, mask, fields, maxFields, &n, &f, &inQuotes))
+        {
+            *pf = f;
+
+            return n;
+        }
+    }
+
+    if (e != p)
+    {
+        // examine the last sixteen characters, discarding those already
+        // examined, rather than the remainder one at a time
+
+        __m128i const       a       =   _mm_loadu_si128(reinterpret_cast<__m128i const*>(e - 16));
+        ss_uint32_t const   mask    =   static_cast<ss_uint32_t>(_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(a, d), _mm_cmpeq_epi8(a, dq)))) >> (16 - (e - p));
+
+        split_csv_fields_mask_(p, mask, fields, maxFields, &n, &f, &inQuotes);
+    }
+
+    *pf = f;
+
+    return n;
+}
+# endif /* STLSOFT_STRING_SPLIT_FUNCTIONS_USE_SSE2_ */
+
+template<
+    ss_typename_param_k V
+,   ss_typename_param_k C
+>
+inline
+ss_size_t
+split_fields_impl_(
+    C const*    s
+,   ss_size_t   cch
+,   C           delim
+,   V*          fields
+,   ss_size_t   maxFields
+)
+{
+    if (0 == cch ||
+        0 == maxFields)
+    {
+        return 0;
+    }
+
+    C const* const  e   =   s + cch;
+    C const*        f   =   s;
+    ss_size_t       n   =   0;
+
+    if (maxFields > 1)
+    {
+        n = split_fields_scan_(s, e, delim, fields, maxFields, &f);
+    }
+
+    fields[n++] = V(f, flexible_integer(e - f));
+
+    return n;
+}
+
+template<
+    ss_typename_param_k V
+,   ss_typename_param_k C
+>
+inline
+ss_size_t
+split_csv_fields_impl_(
+    C const*    s
+,   ss_size_t   cch
+,   C           delim
+,   V*          fields
+,   ss_size_t   maxFields
+)
+{
+    if (0 == cch ||
+        0 == maxFields)
+    {
+        return 0;
+    }
+
+    C const* const  e   =   s + cch;
+    C const*        f   =   s;
+    ss_size_t       n   =   0;
+
+    if (maxFields > 1)
+    {
+        n = split_csv_fields_scan_(s, e, delim, fields, maxFields, &f);
+    }
+
+    fields[n++] = split_csv_field_<V>(f, e);
+
+    return n;
+}
+
 STLSOFT_CLOSE_WORKER_NS_(ximpl_split_functions)
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
@@ -746,6 +1087,197 @@ split(
     return STLSOFT_WORKER_NS_QUAL_(ximpl_split_functions, split_impl_6)(c_str_data(s), c_str_len(s), delim, s0, s1, s2, s3, s4, s5);
 }
 
+/** Splits a string into as many as \c maxFields fields, at every incidence
+ * of a delimiter, in a single pass
+ *
+ * \ingroup group__library__String
+ *
+ * Where there are more than <code>maxFields - 1</code> delimiters, the
+ * last field receives the remainder of the string, as with the
+ * fixed-arity split() overloads. When \c V is a view type - such as
+ * stlsoft::string_view - no memory is allocated, and the fields refer into
+ * the source string, which must outlive them.
+ *
+ * \param s Pointer to the string to be split. May be \c NULL only if
+ *   \c cch is 0
+ * \param cch The number of characters in \c s
+ * \param delim The delimiter
+ * \param fields Pointer to an array of at least \c maxFields recipients,
+ *   each of which must be constructible from a pointer and a length
+ * \param maxFields The number of recipients in \c fields
+ *
+ * \return The number of fields written to \c fields, which is 0 for an
+ *   empty string; the remaining elements are not modified
+ */
+template<
+    ss_typename_param_k C
+,   ss_typename_param_k V
+>
+inline
+ss_size_t
+split_fields(
+    C const*    s
+,   ss_size_t   cch
+,   C           delim
+,   V*          fields
+,   ss_size_t   maxFields
+)
+{
+    STLSOFT_ASSERT(ss_nullptr_k != s || 0 == cch);
+    STLSOFT_ASSERT(ss_nullptr_k != fields || 0 == maxFields);
+
+    return STLSOFT_WORKER_NS_QUAL_(ximpl_split_functions, split_fields_impl_)(s, cch, delim, fields, maxFields);
+}
+
+/** Splits a string into as many fields as there are elements in an
+ * array view, at every incidence of a delimiter, in a single pass
+ *
+ * \ingroup group__library__String
+ *
+ * \see split_fields(C const*, ss_size_t, C, V*, ss_size_t)
+ */
+template<
+    ss_typename_param_k S
+,   ss_typename_param_k C
+,   ss_typename_param_k V
+>
+inline
+ss_size_t
+split_fields(
+    S const&        s
+,   C               delim
+,   array_view<V>   fields
+)
+{
+    return split_fields(c_str_data(s), c_str_len(s), delim, fields.base(), fields.size());
+}
+
+/** Splits a string into as many fields as there are elements in an
+ * array, at every incidence of a delimiter, in a single pass
+ *
+ * \ingroup group__library__String
+ *
+ * \see split_fields(C const*, ss_size_t, C, V*, ss_size_t)
+ */
+template<
+    ss_typename_param_k S
+,   ss_typename_param_k C
+,   ss_typename_param_k V
+,   ss_size_t           N
+>
+inline
+ss_size_t
+split_fields(
+    S const&    s
+,   C           delim
+,   V         (&fields)[N]
+)
+{
+    return split_fields(c_str_data(s), c_str_len(s), delim, &fields[0], N);
+}
+
+/** Splits a CSV record into as many as \c maxFields fields, at every
+ * incidence of a delimiter that is not within double quotes, in a single
+ * pass
+ *
+ * \ingroup group__library__String
+ *
+ * A field that begins and ends with a double quote is written without
+ * them, but is otherwise not unescaped: a quote within it remains in its
+ * doubled form (<code>""</code>), since a view cannot elide it. Where
+ * there are more than <code>maxFields - 1</code> unquoted delimiters, the
+ * last field receives the remainder of the record, which is treated as a
+ * single field.
+ *
+ * \param s Pointer to the record to be split. May be \c NULL only if
+ *   \c cch is 0
+ * \param cch The number of characters in \c s
+ * \param delim The delimiter. Must not be the double quote
+ * \param fields Pointer to an array of at least \c maxFields recipients,
+ *   each of which must be constructible from a pointer and a length
+ * \param maxFields The number of recipients in \c fields
+ *
+ * \return The number of fields written to \c fields, which is 0 for an
+ *   empty record; the remaining elements are not modified
+ *
+| Input                 | Return value  | fields                    |
+| --------------------- | ------------: | ------------------------- |
+| ""                    |             0 |                           |
+| "a,b"                 |             2 | "a", "b"                  |
+| "\"a,b\",c"           |             2 | "a,b", "c"                |
+| "\"a \"\"b\"\"\",c"   |             2 | "a \"\"b\"\"", "c"        |
+| "a,\"\","             |             3 | "a", "", ""               |
+ */
+template<
+    ss_typename_param_k C
+,   ss_typename_param_k V
+>
+inline
+ss_size_t
+split_csv_fields(
+    C const*    s
+,   ss_size_t   cch
+,   C           delim
+,   V*          fields
+,   ss_size_t   maxFields
+)
+{
+    STLSOFT_ASSERT(ss_nullptr_k != s || 0 == cch);
+    STLSOFT_ASSERT(ss_nullptr_k != fields || 0 == maxFields);
+    STLSOFT_MESSAGE_ASSERT("the double quote cannot be the delimiter", C('"') != delim);
+
+    return STLSOFT_WORKER_NS_QUAL_(ximpl_split_functions, split_csv_fields_impl_)(s, cch, delim, fields, maxFields);
+}
+
+/** Splits a CSV record into as many fields as there are elements in an
+ * array view, at every incidence of a delimiter that is not within double
+ * quotes, in a single pass
+ *
+ * \ingroup group__library__String
+ *
+ * \see split_csv_fields(C const*, ss_size_t, C, V*, ss_size_t)
+ */
+template<
+    ss_typename_param_k S
+,   ss_typename_param_k C
+,   ss_typename_param_k V
+>
+inline
+ss_size_t
+split_csv_fields(
+    S const&        s
+,   C               delim
+,   array_view<V>   fields
+)
+{
+    return split_csv_fields(c_str_data(s), c_str_len(s), delim, fields.base(), fields.size());
+}
+
+/** Splits a CSV record into as many fields as there are elements in an
+ * array, at every incidence of a delimiter that is not within double
+ * quotes, in a single pass
+ *
+ * \ingroup group__library__String
+ *
+ * \see split_csv_fields(C const*, ss_size_t, C, V*, ss_size_t)
+ */
+template<
+    ss_typename_param_k S
+,   ss_typename_param_k C
+,   ss_typename_param_k V
+,   ss_size_t           N
+>
+inline
+ss_size_t
+split_csv_fields(
+    S const&    s
+,   C           delim
+,   V         (&fields)[N]
+)
+{
+    return split_csv_fields(c_str_data(s), c_str_len(s), delim, &fields[0], N);
+}
+
 #if STLSOFT_SPLIT_FUNCTION_OLD_FORM_N
 
 /** Splits a string into two, at the first incidence of a delimiter
@@ -815,21 +1347,27 @@ split(
     case 6:
 
         t = s5;
+        STLSOFT_FALLTHROUGH();
     case 5:
 
         r[4] = s4;
+        STLSOFT_FALLTHROUGH();
     case 4:
 
         r[3] = s3;
+        STLSOFT_FALLTHROUGH();
     case 3:
 
         r[2] = s2;
+        STLSOFT_FALLTHROUGH();
     case 2:
 
         r[1] = s1;
+        STLSOFT_FALLTHROUGH();
     case 1:
 
         r[0] = s0;
+        STLSOFT_FALLTHROUGH();
     case 0:
 
         break;
@@ -868,21 +1406,27 @@ split(
             case 6:
 
                 t = s5;
+                STLSOFT_FALLTHROUGH();
             case 5:
 
                 r[z + 4] = s4;
+                STLSOFT_FALLTHROUGH();
             case 4:
 
                 r[z + 3] = s3;
+                STLSOFT_FALLTHROUGH();
             case 3:
 
                 r[z + 2] = s2;
+                STLSOFT_FALLTHROUGH();
             case 2:
 
                 r[z + 1] = s1;
+                STLSOFT_FALLTHROUGH();
             case 1:
 
                 r[z + 0] = s0;
+                STLSOFT_FALLTHROUGH();
             case 0:
 
                 break;
@@ -4,11 +4,11 @@
  * Purpose: String token parsing class.
  *
  * Created: 6th January 2001
- * Updated: 18th October 2024
+ * Updated: 16th October 2026
  *
  * Home:    http://stlsoft.org/
  *
- * Copyright (c) 2019-2024, Matthew Wilson and Synesis Information Systems
+ * Copyright (c) 2019-2026, Matthew Wilson and Synesis Information Systems
  * Copyright (c) 2001-2019, Matthew Wilson and Synesis Software
  * All rights reserved.
  *
@@ -53,9 +53,9 @@
 
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 # define STLSOFT_VER_STLSOFT_STRING_HPP_STRING_TOKENISER_MAJOR     5
-# define STLSOFT_VER_STLSOFT_STRING_HPP_STRING_TOKENISER_MINOR     1
-# define STLSOFT_VER_STLSOFT_STRING_HPP_STRING_TOKENISER_REVISION  17
-# define STLSOFT_VER_STLSOFT_STRING_HPP_STRING_TOKENISER_EDIT      245
+# define STLSOFT_VER_STLSOFT_STRING_HPP_STRING_TOKENISER_MINOR     2
+# define STLSOFT_VER_STLSOFT_STRING_HPP_STRING_TOKENISER_REVISION  1
+# define STLSOFT_VER_STLSOFT_STRING_HPP_STRING_TOKENISER_EDIT      246
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 
@@ -88,6 +88,9 @@
 #ifndef STLSOFT_INCL_STLSOFT_COLLECTIONS_UTIL_HPP_COLLECTIONS
 # include <stlsoft/collections/util/collections.hpp>
 #endif /* !STLSOFT_INCL_STLSOFT_COLLECTIONS_UTIL_HPP_COLLECTIONS */
+#ifndef STLSOFT_INCL_STLSOFT_STRING_C_STRING_H_STRNCHR
+# include <stlsoft/string/c_string/strnchr.h>
+#endif /* !STLSOFT_INCL_STLSOFT_STRING_C_STRING_H_STRNCHR */
 
 #ifndef STLSOFT_INCL_ITERATOR
 # define STLSOFT_INCL_ITERATOR
@@ -446,6 +449,80 @@ public:
 /// @}
 };
 
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+/* string_tokeniser_find_delimiter_()
+ *
+ * Returns the position of the first delimiter in [from, to), or to if
+ * there is none. The general form tests each position with the
+ * comparator; the overloads for the single-character comparator, and for
+ * stlsoft::charset_comparator (in stlsoft/string/charset_tokeniser.hpp),
+ * scan contiguous ranges a block at a time. The overload is selected by
+ * the (null) comparator pointer.
+ */
+
+template<
+    ss_typename_param_k P
+,   ss_typename_param_k I
+,   ss_typename_param_k D
+>
+inline
+I
+string_tokeniser_find_delimiter_(
+    P*          /* comparator */
+,   I           from
+,   I           to
+,   D const&    delim
+)
+{
+    for (; from != to; ++from)
+    {
+        if (!P::not_equal(delim, from))
+        {
+            break;
+        }
+    }
+
+    return from;
+}
+
+template<
+    ss_typename_param_k S
+,   ss_typename_param_k T
+>
+inline
+ss_char_a_t const*
+string_tokeniser_find_delimiter_(
+    string_tokeniser_comparator<ss_char_a_t, S, T>* /* comparator */
+,   ss_char_a_t const*                              from
+,   ss_char_a_t const*                              to
+,   ss_char_a_t const&                              delim
+)
+{
+    ss_char_a_t const* const p = stlsoft_C_strnchr(from, static_cast<ss_size_t>(to - from), delim);
+
+    return (ss_nullptr_k == p) ? to : p;
+}
+
+template<
+    ss_typename_param_k S
+,   ss_typename_param_k T
+>
+inline
+ss_char_w_t const*
+string_tokeniser_find_delimiter_(
+    string_tokeniser_comparator<ss_char_w_t, S, T>* /* comparator */
+,   ss_char_w_t const*                              from
+,   ss_char_w_t const*                              to
+,   ss_char_w_t const&                              delim
+)
+{
+    ss_char_w_t const* const p = stlsoft_C_wcsnchr(from, static_cast<ss_size_t>(to - from), delim);
+
+    return (ss_nullptr_k == p) ? to : p;
+}
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
 /** A class template that provides string tokenising behaviour
  *
  * \ingroup group__library__String
@@ -559,10 +636,35 @@ stlsoft::string_tokeniser<std::string, std::string>  tokens("\r\nabc\r\n\r\ndef\
 std::copy(tokens.begin(), tokens.end(), std::ostream_iterator<std::string>(std::cout, ","));
 \endcode
  *
- * \note The tokeniser instance takes a copy of the incident string to be
- *   tokenised and then issues tokens (via its iterator(s)) from that copy,
- *   so if you wish to use string views (e.g. `stlsoft::basic_string_view` or
- *   `std::basic_string_view`) for the token type
+ * <b>3. Tokenising without allocation.</b>
+ *
+ * The tokeniser instance takes a copy of the incident string (of type
+ * \c S) to be tokenised, and then issues tokens (via its iterator(s)),
+ * each constructed (as type \c V) from a range of that copy. When both
+ * are a view type, such as stlsoft::basic_string_view, the tokeniser
+ * refers to the caller's buffer - which must outlive the tokeniser and
+ * its iterators - and neither construction nor iteration allocates
+ * memory. The following will output: <b>abc,def,ghi,jkl,</b>
+ *
+\code
+
+std::string                 line(":abc::def:ghi:jkl::::::::::");
+
+stlsoft::string_tokeniser<
+    stlsoft::string_view
+,   char
+,   stlsoft::skip_blank_tokens<true>
+,   stlsoft::string_view
+>                           tokens(line, ':');
+
+std::copy(tokens.begin(), tokens.end(), std::ostream_iterator<stlsoft::string_view>(std::cout, ","));
+\endcode
+ *
+ * \note When the iterator type of \c S is a pointer - as it is for
+ *   stlsoft::basic_string_view and stlsoft::basic_simple_string - tokens
+ *   delimited by a single character are located with
+ *   <code>memchr()</code>/<code>wmemchr()</code>, rather than a character
+ *   at a time.
  */
 template<
     ss_typename_param_k S
@@ -991,27 +1093,18 @@ public:
         void determine_end_()
         {
             // 2. Determine the end-of-item (m_find1), starting from m_find0
-            for (m_find1 = m_find0; ; )
-            {
-                if (m_find1 == m_end)
-                {
-                    // End of sequence. Item will be [m_find0, m_end (== m_find1))
-                    m_next = m_find1;
-                    break;
-                }
-                else if (comparator_type::not_equal(get_delim_ref_(m_delimiter), m_find1))
-                {
-                    // current item does not hold a delimiter, so advance one position
-                    ++m_find1;
-                }
-                else
-                {
-                    // Determine the start of the next potential element, ready
-                    // for the next call of increment_()
-                    m_next = m_find1 + static_cast<ss_ptrdiff_t>(m_cchDelimiter);
+            m_find1 = string_tokeniser_find_delimiter_(static_cast<comparator_type*>(ss_nullptr_k), m_find0, m_end, get_delim_ref_(m_delimiter));
 
-                    break;
-                }
+            if (m_find1 == m_end)
+            {
+                // End of sequence. Item will be [m_find0, m_end (== m_find1))
+                m_next = m_find1;
+            }
+            else
+            {
+                // Determine the start of the next potential element, ready
+                // for the next call of increment_()
+                m_next = m_find1 + static_cast<ss_ptrdiff_t>(m_cchDelimiter);
             }
         }
     /// @}
@@ -4,11 +4,11 @@
  * Purpose: Efficient drop-in replacement for strftime().
  *
  * Created: 23rd December 2018
- * Updated: 3rd September 2024
+ * Updated: 16th October 2026
  *
  * Home:    http://stlsoft.org/
  *
- * Copyright (c) 2019-2024, Matthew Wilson and Synesis Information Systems
+ * Copyright (c) 2019-2026, Matthew Wilson and Synesis Information Systems
  * Copyright (c) 2018-2019, Matthew Wilson and Synesis Software
  * All rights reserved.
  *
@@ -53,9 +53,9 @@
 
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 # define STLSOFT_VER_STLSOFT_TIME_HPP_FAST_STRFTIME_MAJOR       1
-# define STLSOFT_VER_STLSOFT_TIME_HPP_FAST_STRFTIME_MINOR       3
-# define STLSOFT_VER_STLSOFT_TIME_HPP_FAST_STRFTIME_REVISION    1
-# define STLSOFT_VER_STLSOFT_TIME_HPP_FAST_STRFTIME_EDIT        16
+# define STLSOFT_VER_STLSOFT_TIME_HPP_FAST_STRFTIME_MINOR       4
+# define STLSOFT_VER_STLSOFT_TIME_HPP_FAST_STRFTIME_REVISION    0
+# define STLSOFT_VER_STLSOFT_TIME_HPP_FAST_STRFTIME_EDIT        17
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 
@@ -78,6 +78,15 @@
 # include <stlsoft/shims/access/string/fwd.h>
 #endif /* !STLSOFT_INCL_STLSOFT_SHIMS_ACCESS_STRING_H_FWD */
 
+#ifndef STLSOFT_INCL_STRING
+# define STLSOFT_INCL_STRING
+# include <string>
+#endif /* !STLSOFT_INCL_STRING */
+#ifndef STLSOFT_INCL_VECTOR
+# define STLSOFT_INCL_VECTOR
+# include <vector>
+#endif /* !STLSOFT_INCL_VECTOR */
+
 #ifndef STLSOFT_INCL_H_TIME
 # define STLSOFT_INCL_H_TIME
 # include <time.h>
@@ -136,6 +145,70 @@ struct fast_strftime_traits_<char>
 {
     typedef char                        char_type;
     typedef stlsoft_C_string_slice_a_t  slice_type;
+    typedef fast_strftime_info_a_t      info_type;
+
+    static info_type const& default_info()
+    {
+        static
+        info_type const s_info =
+        {
+                0
+
+            ,   0
+
+            ,   {
+                    { 6, "Sunday" }
+                ,   { 6, "Monday" }
+                ,   { 7, "Tuesday" }
+                ,   { 9, "Wednesday" }
+                ,   { 8, "Thursday" }
+                ,   { 6, "Friday" }
+                ,   { 8, "Saturday" }
+                }
+
+            ,   {
+                    { 3, "Sun" }
+                ,   { 3, "Mon" }
+                ,   { 3, "Tue" }
+                ,   { 3, "Wed" }
+                ,   { 3, "Thu" }
+                ,   { 3, "Fri" }
+                ,   { 3, "Sat" }
+                }
+
+            ,   {
+                    { 7, "January" }
+                ,   { 8, "February" }
+                ,   { 5, "March" }
+                ,   { 5, "April" }
+                ,   { 3, "May" }
+                ,   { 4, "June" }
+                ,   { 4, "July" }
+                ,   { 6, "August" }
+                ,   { 9, "September" }
+                ,   { 7, "October" }
+                ,   { 8, "November" }
+                ,   { 8, "December" }
+                }
+
+            ,   {
+                    { 3, "Jan" }
+                ,   { 3, "Feb" }
+                ,   { 3, "Mar" }
+                ,   { 3, "Apr" }
+                ,   { 3, "May" }
+                ,   { 3, "Jun" }
+                ,   { 3, "Jul" }
+                ,   { 3, "Aug" }
+                ,   { 3, "Sep" }
+                ,   { 3, "Oct" }
+                ,   { 3, "Nov" }
+                ,   { 3, "Dec" }
+                }
+        };
+
+        return s_info;
+    }
 
     static char_type const* const* tens_and_units()
     {
@@ -252,6 +325,70 @@ struct fast_strftime_traits_<wchar_t>
 {
     typedef wchar_t                     char_type;
     typedef stlsoft_C_string_slice_w_t  slice_type;
+    typedef fast_strftime_info_w_t      info_type;
+
+    static info_type const& default_info()
+    {
+        static
+        info_type const s_info =
+        {
+                0
+
+            ,   0
+
+            ,   {
+                    { 6, L"Sunday" }
+                ,   { 6, L"Monday" }
+                ,   { 7, L"Tuesday" }
+                ,   { 9, L"Wednesday" }
+                ,   { 8, L"Thursday" }
+                ,   { 6, L"Friday" }
+                ,   { 8, L"Saturday" }
+                }
+
+            ,   {
+                    { 3, L"Sun" }
+                ,   { 3, L"Mon" }
+                ,   { 3, L"Tue" }
+                ,   { 3, L"Wed" }
+                ,   { 3, L"Thu" }
+                ,   { 3, L"Fri" }
+                ,   { 3, L"Sat" }
+                }
+
+            ,   {
+                    { 7, L"January" }
+                ,   { 8, L"February" }
+                ,   { 5, L"March" }
+                ,   { 5, L"April" }
+                ,   { 3, L"May" }
+                ,   { 4, L"June" }
+                ,   { 4, L"July" }
+                ,   { 6, L"August" }
+                ,   { 9, L"September" }
+                ,   { 7, L"October" }
+                ,   { 8, L"November" }
+                ,   { 8, L"December" }
+                }
+
+            ,   {
+                    { 3, L"Jan" }
+                ,   { 3, L"Feb" }
+                ,   { 3, L"Mar" }
+                ,   { 3, L"Apr" }
+                ,   { 3, L"May" }
+                ,   { 3, L"Jun" }
+                ,   { 3, L"Jul" }
+                ,   { 3, L"Aug" }
+                ,   { 3, L"Sep" }
+                ,   { 3, L"Oct" }
+                ,   { 3, L"Nov" }
+                ,   { 3, L"Dec" }
+                }
+        };
+
+        return s_info;
+    }
 
     static char_type const* const* tens_and_units()
     {
@@ -364,16 +501,28 @@ struct fast_strftime_traits_<wchar_t>
 };
 
 
+enum fast_strftime_field_result_t
+{
+        fast_strftime_field_emitted_
+    ,   fast_strftime_field_unsupported_
+    ,   fast_strftime_field_insufficient_
+};
+
+// Writes the field for the format code `ch` into `dest`, advancing `*pn`,
+// and returns whether the code was emitted, is not supported, or there
+// was insufficient space
 template <
     ss_typename_param_k T_char
 ,   ss_typename_param_k T_info
 >
 inline
-size_t
-fast_strftime_(
+fast_strftime_field_result_t
+fast_strftime_field_(
     T_char              dest[]
 ,   size_t const        cchDest
-,   T_char const*       fmt
+,   size_t*             pn
+,   T_char              ch
+,   bool                hashed
 ,   struct tm const*    tm
 ,   T_info const&       info
 )
@@ -381,68 +530,13 @@ fast_strftime_(
     typedef fast_strftime_traits_<T_char>           traits_t;
     typedef ss_typename_type_k traits_t::slice_type slice_t;
 
-    // References:
-    //
-    // - https://docs.microsoft.com/en-us/cpp/c-runtime-library/reference/strftime-wcsftime-strftime-l-wcsftime-l
-    // - http://www.cplusplus.com/reference/ctime/strftime/
-    // - https://en.cppreference.com/w/cpp/chrono/c/strftime
-
-#ifndef NDEBUG
-
-    STLSOFT_ASSERT(0 == cchDest || NULL != dest);
-
-    STLSOFT_ASSERT(NULL != fmt);
-
-    STLSOFT_ASSERT(NULL != tm);
-    STLSOFT_ASSERT(tm->tm_sec >= 0 && tm->tm_sec < 60);
-    STLSOFT_ASSERT(tm->tm_min >= 0 && tm->tm_min < 60);
-    STLSOFT_ASSERT(tm->tm_hour >= 0 && tm->tm_hour < 24);
-    STLSOFT_ASSERT(tm->tm_mday >= 1 && tm->tm_mday <= 31);
-    STLSOFT_ASSERT(tm->tm_mon >= 0 && tm->tm_mon < 12);
-    STLSOFT_ASSERT(tm->tm_year >= 0 && tm->tm_year < 9900);
-    STLSOFT_ASSERT(tm->tm_wday >= 0 && tm->tm_wday < 7);
-    STLSOFT_ASSERT(tm->tm_yday >= 0 && tm->tm_yday < 366);
-
-    { for (size_t i = 0; i != STLSOFT_NUM_ELEMENTS(info.weekdays_long); ++i)
-    {
-        STLSOFT_ASSERT(0 != info.weekdays_long[i].len);
-        STLSOFT_ASSERT(NULL != info.weekdays_long[i].ptr);
-    }}
-    { for (size_t i = 0; i != STLSOFT_NUM_ELEMENTS(info.weekdays_short); ++i)
-    {
-        STLSOFT_ASSERT(0 != info.weekdays_short[i].len);
-        STLSOFT_ASSERT(NULL != info.weekdays_short[i].ptr);
-    }}
-    { for (size_t i = 0; i != STLSOFT_NUM_ELEMENTS(info.months_long); ++i)
-    {
-        STLSOFT_ASSERT(0 != info.months_long[i].len);
-        STLSOFT_ASSERT(NULL != info.months_long[i].ptr);
-    }}
-    { for (size_t i = 0; i != STLSOFT_NUM_ELEMENTS(info.months_short); ++i)
-    {
-        STLSOFT_ASSERT(0 != info.months_short[i].len);
-        STLSOFT_ASSERT(NULL != info.months_short[i].ptr);
-    }}
-#endif
-
-    enum state_t
-    {
-            state_literal
-        ,   state_percent
-        ,   state_percent_hash
-    };
+    STLSOFT_ASSERT(NULL != pn);
+    STLSOFT_ASSERT(*pn <= cchDest);
 
     static
     T_char const* const* tens_and_units = traits_t::tens_and_units();
 
-    state_t             state   =   state_literal;
-
-    size_t              n       =   0;
-
-    size_t const        cch_fmt =   stlsoft::c_str_len(fmt);
-    T_char const*       b_fmt   =   fmt;
-    T_char const* const e_fmt   =   b_fmt + cch_fmt;
-    bool                hashed  =   false;
+    size_t              n       =   *pn;
 
     int                 v       =   -1;
     int                 wd      =   -1;
@@ -450,617 +544,712 @@ fast_strftime_(
 
     slice_t const*      sl;
 
-    for (; b_fmt != e_fmt; ++b_fmt)
+    switch (ch)
     {
-        T_char const ch = *b_fmt;
-
-        STLSOFT_ASSERT(n <= cchDest);
+    case '%':
 
-        switch (state)
+        if (!(n + 1 < cchDest))
         {
-        case state_literal:
-
-            switch (ch)
-            {
-            case '%':
+            return fast_strftime_field_insufficient_;
+        }
 
-                state = state_percent;
-                break;
-            default:
+        dest[n++] = ch;
 
-                if (!(n + 1 < cchDest))
-                {
-                    return 0;
-                }
+        *pn = n;
 
-                dest[n++] = ch;
-                break;
-            }
-            break;
-        case state_percent:
+        return fast_strftime_field_emitted_;
 
-            if ('%' == ch)
-            {
+    case 0:
+week_number_U:
 
-                if (!(n + 1 < cchDest))
-                {
-                    return 0;
-                }
+        if (tm->tm_yday < wd)
+        {
+            v = 0;
+        }
+        else
+        {
+            v = tm->tm_yday / 7;
 
-                dest[n++] = ch;
-                state = state_literal;
-                break;
-            }
-            else if ('#' == ch)
+            if (wd <= (tm->tm_yday % 7))
             {
-                state = state_percent_hash;
-                break;
+                ++v;
             }
-            else
-            {
-        case state_percent_hash:
+        }
 
-                hashed = (state_percent_hash == state);
+finish_two_digit:
 
-                switch (ch)
-                {
-                case '%':
+        if ((cchDest - n) < 3)
+        {
+            return fast_strftime_field_insufficient_;
+        }
 
-                    if (!(n + 1 < cchDest))
-                    {
-                        return 0;
-                    }
+        STLSOFT_ASSERT(v >= 0 && v < 100);
 
-                    dest[n++] = ch;
-                    break;
+        s = tens_and_units[v];
 
-                case 0:
-week_number_U:
+        if (!hashed || '0' != s[0])
+        {
+            if (!(n + 1 < cchDest))
+            {
+                return fast_strftime_field_insufficient_;
+            }
 
-                    if (tm->tm_yday < wd)
-                    {
-                        v = 0;
-                    }
-                    else
-                    {
-                        v = tm->tm_yday / 7;
+            dest[n++] = s[0];
+        }
 
-                        if (wd <= (tm->tm_yday % 7))
-                        {
-                            ++v;
-                        }
-                    }
+        if (!(n + 1 < cchDest))
+        {
+            return fast_strftime_field_insufficient_;
+        }
 
-finish_two_digit:
+        dest[n++] = s[1];
 
-                    if ((cchDest - n) < 3)
-                    {
-                        return 0;
-                    }
+        *pn = n;
 
-                    STLSOFT_ASSERT(v >= 0 && v < 100);
+        return fast_strftime_field_emitted_;
 
-                    s = tens_and_units[v];
+finish_three_digit:
 
-                    if (!hashed || '0' != s[0])
-                    {
-                        if (!(n + 1 < cchDest))
-                        {
-                            return 0;
-                        }
+        STLSOFT_ASSERT(v >= 0 && v < 1000);
 
-                        dest[n++] = s[0];
-                    }
+        if ((cchDest - n) < 4)
+        {
+            return fast_strftime_field_insufficient_;
+        }
 
-                    if (!(n + 1 < cchDest))
-                    {
-                        return 0;
-                    }
+        if (v > 99)
+        {
+            int const       ix0 = v % 100;
+            int const       ix1 = v / 100;
+            T_char const*   tu0 = tens_and_units[ix0];
+            T_char const*   tu1 = tens_and_units[ix1];
 
-                    dest[n++] = s[1];
+            if (!(n + 3 < cchDest))
+            {
+                return fast_strftime_field_insufficient_;
+            }
 
-                    state = state_literal;
+            dest[n++] = tu1[1];
+            dest[n++] = tu0[0];
+            dest[n++] = tu0[1];
+        }
+        else
+        {
+            T_char const* tu0 = tens_and_units[v];
 
-                    break;
+            if (hashed)
+            {
+                if (v > 10)
+                {
+                    if (!(n + 1 < cchDest))
+                    {
+                        return fast_strftime_field_insufficient_;
+                    }
 
-finish_three_digit:
+                    dest[n++] = tu0[0];
+                }
 
-                    STLSOFT_ASSERT(v >= 0 && v < 1000);
+                if (!(n + 1 < cchDest))
+                {
+                    return fast_strftime_field_insufficient_;
+                }
 
-                    if ((cchDest - n) < 4)
-                    {
-                        return 0;
-                    }
+                dest[n++] = tu0[1];
+            }
+            else
+            {
+                if (!(n + 3 < cchDest))
+                {
+                    return fast_strftime_field_insufficient_;
+                }
 
-                    if (v > 99)
-                    {
-                        int const       ix0 = v % 100;
-                        int const       ix1 = v / 100;
-                        T_char const*   tu0 = tens_and_units[ix0];
-                        T_char const*   tu1 = tens_and_units[ix1];
-
-                        if (!(n + 3 < cchDest))
-                        {
-                            return 0;
-                        }
-
-                        dest[n++] = tu1[1];
-                        dest[n++] = tu0[0];
-                        dest[n++] = tu0[1];
-                    }
-                    else
-                    {
-                        T_char const* tu0 = tens_and_units[v];
-
-                        if (hashed)
-                        {
-                            if (v > 10)
-                            {
-                                if (!(n + 1 < cchDest))
-                                {
-                                    return 0;
-                                }
-
-                                dest[n++] = tu0[0];
-                            }
-
-                            if (!(n + 1 < cchDest))
-                            {
-                                return 0;
-                            }
-
-                            dest[n++] = tu0[1];
-                        }
-                        else
-                        {
-                            if (!(n + 3 < cchDest))
-                            {
-                                return 0;
-                            }
-
-                            dest[n++] = '0';
-                            dest[n++] = tu0[0];
-                            dest[n++] = tu0[1];
-                        }
-                    }
+                dest[n++] = '0';
+                dest[n++] = tu0[0];
+                dest[n++] = tu0[1];
+            }
+        }
 
-                    state = state_literal;
+        *pn = n;
 
-                    break;
+        return fast_strftime_field_emitted_;
 
 finish_sliced_item:
 
-                    if ((cchDest - n) < (1 + sl->len))
-                    {
-                        return 0;
-                    }
-
-                    { for (size_t i = 0, l = sl->len; i != l; ++i, ++n)
-                    {
-                        dest[n] = sl->ptr[i];
-                    }}
+        if ((cchDest - n) < (1 + sl->len))
+        {
+            return fast_strftime_field_insufficient_;
+        }
 
-                    state = state_literal;
+        { for (size_t i = 0, l = sl->len; i != l; ++i, ++n)
+        {
+            dest[n] = sl->ptr[i];
+        }}
 
-                    break;
+        *pn = n;
 
-                case 'A':
+        return fast_strftime_field_emitted_;
 
-                    sl = &info.weekdays_long[tm->tm_wday];
+    case 'A':
 
-                    goto finish_sliced_item;
+        sl = &info.weekdays_long[tm->tm_wday];
 
-                case 'a':
+        goto finish_sliced_item;
 
-                    sl = &info.weekdays_short[tm->tm_wday];
+    case 'a':
 
-                    goto finish_sliced_item;
+        sl = &info.weekdays_short[tm->tm_wday];
 
-                case 'B':
+        goto finish_sliced_item;
 
-                    sl = &info.months_long[tm->tm_mon];
+    case 'B':
 
-                    goto finish_sliced_item;
+        sl = &info.months_long[tm->tm_mon];
 
-                case 'b':
-                case 'h':
+        goto finish_sliced_item;
 
-                    sl = &info.months_short[tm->tm_mon];
+    case 'b':
+    case 'h':
 
-                    goto finish_sliced_item;
+        sl = &info.months_short[tm->tm_mon];
 
-                case 'd':
+        goto finish_sliced_item;
 
-                    v = tm->tm_mday;
+    case 'd':
 
-                    goto finish_two_digit;
+        v = tm->tm_mday;
 
-                case 'H':
+        goto finish_two_digit;
 
-                    v = tm->tm_hour;
+    case 'H':
 
-                    goto finish_two_digit;
+        v = tm->tm_hour;
 
-                case 'I':
+        goto finish_two_digit;
 
-                    v = tm->tm_hour % 12;
+    case 'I':
 
-                    if (0 == v)
-                    {
-                        v = 12;
-                    }
+        v = tm->tm_hour % 12;
 
-                    goto finish_two_digit;
+        if (0 == v)
+        {
+            v = 12;
+        }
 
-                case 'j':
+        goto finish_two_digit;
 
-                    v = 1 + tm->tm_yday;
+    case 'j':
 
-                    goto finish_three_digit;
+        v = 1 + tm->tm_yday;
 
-                case 'M':
+        goto finish_three_digit;
 
-                    v = tm->tm_min;
+    case 'M':
 
-                    goto finish_two_digit;
+        v = tm->tm_min;
 
-                case 'm':
+        goto finish_two_digit;
 
-                    v = tm->tm_mon + 1;
+    case 'm':
 
-                    goto finish_two_digit;
+        v = tm->tm_mon + 1;
 
-                case 'S':
+        goto finish_two_digit;
 
-                    v = tm->tm_sec;
+    case 'S':
 
-                    goto finish_two_digit;
+        v = tm->tm_sec;
 
-                case 'U':
+        goto finish_two_digit;
 
-                    wd = tm->tm_wday;
+    case 'U':
 
-                    goto week_number_U;
+        wd = tm->tm_wday;
 
-                case 'W':
+        goto week_number_U;
 
-                    if (0 == tm->tm_wday)
-                    {
-                        wd = 6;
-                    }
-                    else
-                    {
-                        wd = tm->tm_wday - 1;
-                    }
+    case 'W':
 
-                    goto week_number_U;
+        if (0 == tm->tm_wday)
+        {
+            wd = 6;
+        }
+        else
+        {
+            wd = tm->tm_wday - 1;
+        }
 
-                case 'w':
+        goto week_number_U;
 
-                    v = tm->tm_wday;
+    case 'w':
 
-                    if ((cchDest - n) < 2)
-                    {
-                        return 0;
-                    }
+        v = tm->tm_wday;
 
-                    dest[n++] = T_char('0' + v);
+        if ((cchDest - n) < 2)
+        {
+            return fast_strftime_field_insufficient_;
+        }
 
-                    state = state_literal;
+        dest[n++] = T_char('0' + v);
 
-                    break;
+        *pn = n;
 
-                case 'Y':
+        return fast_strftime_field_emitted_;
 
-                    v = 1900 + tm->tm_year;
+    case 'Y':
 
-                    if ((cchDest - n) < 5)
-                    {
-                        return 0;
-                    }
-                    else
-                    {
-                        int const       ix0 = v % 100;
-                        int const       ix1 = v / 100;
-                        T_char const*   tu0 = tens_and_units[ix0];
-                        T_char const*   tu1 = tens_and_units[ix1];
-
-                        if (!(n + 4 < cchDest))
-                        {
-                            return 0;
-                        }
-
-                        dest[n++] = tu1[0];
-                        dest[n++] = tu1[1];
-                        dest[n++] = tu0[0];
-                        dest[n++] = tu0[1];
-                    }
+        v = 1900 + tm->tm_year;
 
-                    state = state_literal;
+        if ((cchDest - n) < 5)
+        {
+            return fast_strftime_field_insufficient_;
+        }
+        else
+        {
+            int const       ix0 = v % 100;
+            int const       ix1 = v / 100;
+            T_char const*   tu0 = tens_and_units[ix0];
+            T_char const*   tu1 = tens_and_units[ix1];
 
-                    break;
+            if (!(n + 4 < cchDest))
+            {
+                return fast_strftime_field_insufficient_;
+            }
 
-                case 'y':
+            dest[n++] = tu1[0];
+            dest[n++] = tu1[1];
+            dest[n++] = tu0[0];
+            dest[n++] = tu0[1];
+        }
 
-                    v = (tm->tm_year % 100);
+        *pn = n;
 
-                    goto finish_two_digit;
+        return fast_strftime_field_emitted_;
 
+    case 'y':
 
-                // The extensions
+        v = (tm->tm_year % 100);
 
-                case 'C': // century (zero-padded)
+        goto finish_two_digit;
 
-                    v = (1900 + tm->tm_year) / 100;
 
-                    goto finish_two_digit;
+    // The extensions
 
-                case 'c': // locale-specific date and time
+    case 'C': // century (zero-padded)
 
-                    break;
+        v = (1900 + tm->tm_year) / 100;
 
-                case 'D': // %m/%d/%y
+        goto finish_two_digit;
 
-                    if ((cchDest - n) < 9)
-                    {
-                        return 0;
-                    }
-                    else
-                    {
-                        s = tens_and_units[tm->tm_mon + 1];
+    case 'c': // locale-specific date and time
 
-                        dest[n++] = s[0];
-                        dest[n++] = s[1];
+        break;
 
-                        dest[n++] = '/';
+    case 'D': // %m/%d/%y
 
-                        s = tens_and_units[tm->tm_mday];
+        if ((cchDest - n) < 9)
+        {
+            return fast_strftime_field_insufficient_;
+        }
+        else
+        {
+            s = tens_and_units[tm->tm_mon + 1];
 
-                        dest[n++] = s[0];
-                        dest[n++] = s[1];
+            dest[n++] = s[0];
+            dest[n++] = s[1];
 
-                        dest[n++] = '/';
+            dest[n++] = '/';
 
-                        s = tens_and_units[tm->tm_year % 100];
+            s = tens_and_units[tm->tm_mday];
 
-                        dest[n++] = s[0];
-                        dest[n++] = s[1];
+            dest[n++] = s[0];
+            dest[n++] = s[1];
 
-                        state = state_literal;
-                    }
+            dest[n++] = '/';
 
-                    break;
+            s = tens_and_units[tm->tm_year % 100];
 
-                case 'e': // space-leading-padded day-of-month
+            dest[n++] = s[0];
+            dest[n++] = s[1];
 
-                    if ((cchDest - n) < 3)
-                    {
-                        return 0;
-                    }
+            *pn = n;
 
-                    s = tens_and_units[tm->tm_mday];
+            return fast_strftime_field_emitted_;
+        }
 
-                    if ('0' == s[0])
-                    {
-                        if (!hashed)
-                        {
-                            dest[n++] = ' ';
-                        }
-                    }
-                    else
-                    {
-                        dest[n++] = s[0];
-                    }
+    case 'e': // space-leading-padded day-of-month
 
-                    dest[n++] = s[1];
+        if ((cchDest - n) < 3)
+        {
+            return fast_strftime_field_insufficient_;
+        }
 
-                    state = state_literal;
+        s = tens_and_units[tm->tm_mday];
 
-                    break;
+        if ('0' == s[0])
+        {
+            if (!hashed)
+            {
+                dest[n++] = ' ';
+            }
+        }
+        else
+        {
+            dest[n++] = s[0];
+        }
 
-                case 'F': // %Y-%m-%d
+        dest[n++] = s[1];
 
-                    if ((cchDest - n) < 11)
-                    {
-                        return 0;
-                    }
-                    else
-                    {
-                        v = 1900 + tm->tm_year;
+        *pn = n;
 
-                        int const       ix0 = v % 100;
-                        int const       ix1 = v / 100;
-                        T_char const*   tu0 = tens_and_units[ix0];
-                        T_char const*   tu1 = tens_and_units[ix1];
+        return fast_strftime_field_emitted_;
 
-                        dest[n++] = tu1[0];
-                        dest[n++] = tu1[1];
-                        dest[n++] = tu0[0];
-                        dest[n++] = tu0[1];
+    case 'F': // %Y-%m-%d
 
-                        dest[n++] = '-';
+        if ((cchDest - n) < 11)
+        {
+            return fast_strftime_field_insufficient_;
+        }
+        else
+        {
+            v = 1900 + tm->tm_year;
 
-                        s = tens_and_units[tm->tm_mon + 1];
+            int const       ix0 = v % 100;
+            int const       ix1 = v / 100;
+            T_char const*   tu0 = tens_and_units[ix0];
+            T_char const*   tu1 = tens_and_units[ix1];
 
-                        if (!hashed || '0' != s[0])
-                        {
-                            dest[n++] = s[0];
-                        }
+            dest[n++] = tu1[0];
+            dest[n++] = tu1[1];
+            dest[n++] = tu0[0];
+            dest[n++] = tu0[1];
 
-                        dest[n++] = s[1];
+            dest[n++] = '-';
 
-                        dest[n++] = '-';
+            s = tens_and_units[tm->tm_mon + 1];
 
-                        s = tens_and_units[tm->tm_mday];
+            if (!hashed || '0' != s[0])
+            {
+                dest[n++] = s[0];
+            }
 
-                        if (!hashed || '0' != s[0])
-                        {
-                            dest[n++] = s[0];
-                        }
+            dest[n++] = s[1];
 
-                        dest[n++] = s[1];
+            dest[n++] = '-';
 
-                        state = state_literal;
-                    }
+            s = tens_and_units[tm->tm_mday];
 
-                    break;
+            if (!hashed || '0' != s[0])
+            {
+                dest[n++] = s[0];
+            }
 
-                case 'G': // week-based year
+            dest[n++] = s[1];
 
-                    break;
+            *pn = n;
 
-                case 'g': // week-based year - last two digits
+            return fast_strftime_field_emitted_;
+        }
 
-                    break;
+    case 'G': // week-based year
 
-                case 'n': // a '\n'
+        break;
 
-                    if ((cchDest - n) < 2)
-                    {
-                        return 0;
-                    }
+    case 'g': // week-based year - last two digits
 
-                    dest[n++] = '\n';
+        break;
 
-                    state = state_literal;
+    case 'n': // a '\n'
 
-                    break;
+        if ((cchDest - n) < 2)
+        {
+            return fast_strftime_field_insufficient_;
+        }
 
-                case 'p': // locale's AM/PM indicator
+        dest[n++] = '\n';
 
-                    break;
+        *pn = n;
 
-                case 'R': // %H:%M
+        return fast_strftime_field_emitted_;
 
-                    if ((cchDest - n) < 6)
-                    {
-                        return 0;
-                    }
-                    else
-                    {
-                        s = tens_and_units[tm->tm_hour];
+    case 'p': // locale's AM/PM indicator
 
-                        if (!hashed || '0' != s[0])
-                        {
-                            dest[n++] = s[0];
-                        }
+        break;
 
-                        dest[n++] = s[1];
+    case 'R': // %H:%M
 
-                        dest[n++] = ':';
+        if ((cchDest - n) < 6)
+        {
+            return fast_strftime_field_insufficient_;
+        }
+        else
+        {
+            s = tens_and_units[tm->tm_hour];
 
-                        s = tens_and_units[tm->tm_min];
+            if (!hashed || '0' != s[0])
+            {
+                dest[n++] = s[0];
+            }
 
-                        if (!hashed || '0' != s[0])
-                        {
-                            dest[n++] = s[0];
-                        }
+            dest[n++] = s[1];
 
-                        dest[n++] = s[1];
+            dest[n++] = ':';
 
-                        state = state_literal;
-                    }
+            s = tens_and_units[tm->tm_min];
 
-                    break;
+            if (!hashed || '0' != s[0])
+            {
+                dest[n++] = s[0];
+            }
 
-                case 'r': // locale's 12-hr clock time
+            dest[n++] = s[1];
 
-                    break;
+            *pn = n;
 
-                case 'T': // %H:%M:%S
+            return fast_strftime_field_emitted_;
+        }
 
-                    if ((cchDest - n) < 9)
-                    {
-                        return 0;
-                    }
-                    else
-                    {
-                        s = tens_and_units[tm->tm_hour];
+    case 'r': // locale's 12-hr clock time
 
-                        if (!hashed || '0' != s[0])
-                        {
-                            dest[n++] = s[0];
-                        }
+        break;
 
-                        dest[n++] = s[1];
+    case 'T': // %H:%M:%S
 
-                        dest[n++] = ':';
+        if ((cchDest - n) < 9)
+        {
+            return fast_strftime_field_insufficient_;
+        }
+        else
+        {
+            s = tens_and_units[tm->tm_hour];
 
-                        s = tens_and_units[tm->tm_min];
+            if (!hashed || '0' != s[0])
+            {
+                dest[n++] = s[0];
+            }
 
-                        if (!hashed || '0' != s[0])
-                        {
-                            dest[n++] = s[0];
-                        }
+            dest[n++] = s[1];
 
-                        dest[n++] = s[1];
+            dest[n++] = ':';
 
-                        dest[n++] = ':';
+            s = tens_and_units[tm->tm_min];
 
-                        s = tens_and_units[tm->tm_sec];
+            if (!hashed || '0' != s[0])
+            {
+                dest[n++] = s[0];
+            }
 
-                        if (!hashed || '0' != s[0])
-                        {
-                            dest[n++] = s[0];
-                        }
+            dest[n++] = s[1];
 
-                        dest[n++] = s[1];
+            dest[n++] = ':';
 
-                        state = state_literal;
-                    }
+            s = tens_and_units[tm->tm_sec];
 
-                    break;
+            if (!hashed || '0' != s[0])
+            {
+                dest[n++] = s[0];
+            }
 
-                case 't': // a '\t'
+            dest[n++] = s[1];
 
-                    if ((cchDest - n) < 2)
-                    {
-                        return 0;
-                    }
+            *pn = n;
 
-                    dest[n++] = '\t';
+            return fast_strftime_field_emitted_;
+        }
 
-                    state = state_literal;
+    case 't': // a '\t'
 
-                    break;
+        if ((cchDest - n) < 2)
+        {
+            return fast_strftime_field_insufficient_;
+        }
 
-                case 'u': // ISO 8601 weekday (1 - 7, Monday == 1)
+        dest[n++] = '\t';
 
-                    if ((cchDest - n) < 2)
-                    {
-                        return 0;
-                    }
+        *pn = n;
 
-                    v = tm->tm_wday;
+        return fast_strftime_field_emitted_;
 
-                    if (0 == v)
-                    {
-                        v = 7;
-                    }
+    case 'u': // ISO 8601 weekday (1 - 7, Monday == 1)
 
-                    dest[n++] = tens_and_units[v][1];
+        if ((cchDest - n) < 2)
+        {
+            return fast_strftime_field_insufficient_;
+        }
 
-                    state = state_literal;
+        v = tm->tm_wday;
 
-                    break;
+        if (0 == v)
+        {
+            v = 7;
+        }
 
-                case 'V': // ISO 8601 week number
+        dest[n++] = tens_and_units[v][1];
 
-                    break;
+        *pn = n;
 
-                case 'X': // locale-dependent time
+        return fast_strftime_field_emitted_;
 
-                    break;
+    case 'V': // ISO 8601 week number
 
-                case 'x': // locale-dependent date
+        break;
 
-                    break;
+    case 'X': // locale-dependent time
+
+        break;
+
+    case 'x': // locale-dependent date
+
+        break;
+
+    case 'Z': // Timezone abbreviation
+
+        break;
+
+    case 'z': // ISO 8601 offset
+
+        break;
+    }
+
+    return fast_strftime_field_unsupported_;
+}
+
+template <
+    ss_typename_param_k T_char
+,   ss_typename_param_k T_info
+>
+inline
+size_t
+fast_strftime_(
+    T_char              dest[]
+,   size_t const        cchDest
+,   T_char const*       fmt
+,   struct tm const*    tm
+,   T_info const&       info
+)
+{
+    // References:
+    //
+    // - https://docs.microsoft.com/en-us/cpp/c-runtime-library/reference/strftime-wcsftime-strftime-l-wcsftime-l
+    // - http://www.cplusplus.com/reference/ctime/strftime/
+    // - https://en.cppreference.com/w/cpp/chrono/c/strftime
+
+#ifndef NDEBUG
+
+    STLSOFT_ASSERT(0 == cchDest || NULL != dest);
+
+    STLSOFT_ASSERT(NULL != fmt);
+
+    STLSOFT_ASSERT(NULL != tm);
+    STLSOFT_ASSERT(tm->tm_sec >= 0 && tm->tm_sec < 60);
+    STLSOFT_ASSERT(tm->tm_min >= 0 && tm->tm_min < 60);
+    STLSOFT_ASSERT(tm->tm_hour >= 0 && tm->tm_hour < 24);
+    STLSOFT_ASSERT(tm->tm_mday >= 1 && tm->tm_mday <= 31);
+    STLSOFT_ASSERT(tm->tm_mon >= 0 && tm->tm_mon < 12);
+    STLSOFT_ASSERT(tm->tm_year >= 0 && tm->tm_year < 9900);
+    STLSOFT_ASSERT(tm->tm_wday >= 0 && tm->tm_wday < 7);
+    STLSOFT_ASSERT(tm->tm_yday >= 0 && tm->tm_yday < 366);
+
+    { for (size_t i = 0; i != STLSOFT_NUM_ELEMENTS(info.weekdays_long); ++i)
+    {
+        STLSOFT_ASSERT(0 != info.weekdays_long[i].len);
+        STLSOFT_ASSERT(NULL != info.weekdays_long[i].ptr);
+    }}
+    { for (size_t i = 0; i != STLSOFT_NUM_ELEMENTS(info.weekdays_short); ++i)
+    {
+        STLSOFT_ASSERT(0 != info.weekdays_short[i].len);
+        STLSOFT_ASSERT(NULL != info.weekdays_short[i].ptr);
+    }}
+    { for (size_t i = 0; i != STLSOFT_NUM_ELEMENTS(info.months_long); ++i)
+    {
+        STLSOFT_ASSERT(0 != info.months_long[i].len);
+        STLSOFT_ASSERT(NULL != info.months_long[i].ptr);
+    }}
+    { for (size_t i = 0; i != STLSOFT_NUM_ELEMENTS(info.months_short); ++i)
+    {
+        STLSOFT_ASSERT(0 != info.months_short[i].len);
+        STLSOFT_ASSERT(NULL != info.months_short[i].ptr);
+    }}
+#endif
+
+    enum state_t
+    {
+            state_literal
+        ,   state_percent
+        ,   state_percent_hash
+    };
+
+    state_t             state   =   state_literal;
+
+    size_t              n       =   0;
+
+    size_t const        cch_fmt =   stlsoft::c_str_len(fmt);
+    T_char const*       b_fmt   =   fmt;
+    T_char const* const e_fmt   =   b_fmt + cch_fmt;
+    bool                hashed  =   false;
+
+    for (; b_fmt != e_fmt; ++b_fmt)
+    {
+        T_char const ch = *b_fmt;
+
+        STLSOFT_ASSERT(n <= cchDest);
+
+        switch (state)
+        {
+        case state_literal:
+
+            switch (ch)
+            {
+            case '%':
+
+                state = state_percent;
+                break;
+            default:
 
-                case 'Z': // Timezone abbreviation
+                if (!(n + 1 < cchDest))
+                {
+                    return 0;
+                }
+
+                dest[n++] = ch;
+                break;
+            }
+            break;
+        case state_percent:
 
+            if ('%' == ch)
+            {
+
+                if (!(n + 1 < cchDest))
+                {
+                    return 0;
+                }
+
+                dest[n++] = ch;
+                state = state_literal;
+                break;
+            }
+            else if ('#' == ch)
+            {
+                state = state_percent_hash;
+                break;
+            }
+            else
+            {
+                STLSOFT_FALLTHROUGH();
+        case state_percent_hash:
+
+                hashed = (state_percent_hash == state);
+
+                switch (fast_strftime_field_(dest, cchDest, &n, ch, hashed, tm, info))
+                {
+                case fast_strftime_field_emitted_:
+
+                    state = state_literal;
                     break;
+                case fast_strftime_field_insufficient_:
 
-                case 'z': // ISO 8601 offset
+                    return 0;
+                default:
 
                     break;
                 }
@@ -1187,65 +1376,7 @@ fast_strftime(
 ,   struct tm const*            tm
 )
 {
-    static
-    fast_strftime_info_a_t const s_info =
-    {
-            0
-
-        ,   0
-
-        ,   {
-                { 6, "Sunday" }
-            ,   { 6, "Monday" }
-            ,   { 7, "Tuesday" }
-            ,   { 9, "Wednesday" }
-            ,   { 8, "Thursday" }
-            ,   { 6, "Friday" }
-            ,   { 8, "Saturday" }
-            }
-
-        ,   {
-                { 3, "Sun" }
-            ,   { 3, "Mon" }
-            ,   { 3, "Tue" }
-            ,   { 3, "Wed" }
-            ,   { 3, "Thu" }
-            ,   { 3, "Fri" }
-            ,   { 3, "Sat" }
-            }
-
-        ,   {
-                { 7, "January" }
-            ,   { 8, "February" }
-            ,   { 5, "March" }
-            ,   { 5, "April" }
-            ,   { 3, "May" }
-            ,   { 4, "June" }
-            ,   { 4, "July" }
-            ,   { 6, "August" }
-            ,   { 9, "September" }
-            ,   { 7, "October" }
-            ,   { 8, "November" }
-            ,   { 8, "December" }
-            }
-
-        ,   {
-                { 3, "Jan" }
-            ,   { 3, "Feb" }
-            ,   { 3, "Mar" }
-            ,   { 3, "Apr" }
-            ,   { 3, "May" }
-            ,   { 3, "Jun" }
-            ,   { 3, "Jul" }
-            ,   { 3, "Aug" }
-            ,   { 3, "Sep" }
-            ,   { 3, "Oct" }
-            ,   { 3, "Nov" }
-            ,   { 3, "Dec" }
-            }
-    };
-
-    return ximpl_fast_strftime_::fast_strftime_(dest, cchDest, fmt, tm, s_info);
+    return ximpl_fast_strftime_::fast_strftime_(dest, cchDest, fmt, tm, ximpl_fast_strftime_::fast_strftime_traits_<char>::default_info());
 }
 
 /** wide-string form */
@@ -1258,65 +1389,7 @@ fast_wcsftime(
 ,   struct tm const*            tm
 )
 {
-    static
-    fast_strftime_info_w_t const s_info =
-    {
-            0
-
-        ,   0
-
-        ,   {
-                { 6, L"Sunday" }
-            ,   { 6, L"Monday" }
-            ,   { 7, L"Tuesday" }
-            ,   { 9, L"Wednesday" }
-            ,   { 8, L"Thursday" }
-            ,   { 6, L"Friday" }
-            ,   { 8, L"Saturday" }
-            }
-
-        ,   {
-                { 3, L"Sun" }
-            ,   { 3, L"Mon" }
-            ,   { 3, L"Tue" }
-            ,   { 3, L"Wed" }
-            ,   { 3, L"Thu" }
-            ,   { 3, L"Fri" }
-            ,   { 3, L"Sat" }
-            }
-
-        ,   {
-                { 7, L"January" }
-            ,   { 8, L"February" }
-            ,   { 5, L"March" }
-            ,   { 5, L"April" }
-            ,   { 3, L"May" }
-            ,   { 4, L"June" }
-            ,   { 4, L"July" }
-            ,   { 6, L"August" }
-            ,   { 9, L"September" }
-            ,   { 7, L"October" }
-            ,   { 8, L"November" }
-            ,   { 8, L"December" }
-            }
-
-        ,   {
-                { 3, L"Jan" }
-            ,   { 3, L"Feb" }
-            ,   { 3, L"Mar" }
-            ,   { 3, L"Apr" }
-            ,   { 3, L"May" }
-            ,   { 3, L"Jun" }
-            ,   { 3, L"Jul" }
-            ,   { 3, L"Aug" }
-            ,   { 3, L"Sep" }
-            ,   { 3, L"Oct" }
-            ,   { 3, L"Nov" }
-            ,   { 3, L"Dec" }
-            }
-    };
-
-    return ximpl_fast_strftime_::fast_strftime_(dest, cchDest, fmt, tm, s_info);
+    return ximpl_fast_strftime_::fast_strftime_(dest, cchDest, fmt, tm, ximpl_fast_strftime_::fast_strftime_traits_<wchar_t>::default_info());
 }
 
 /** wide-string form */
@@ -1350,6 +1423,310 @@ fast_strftime(
 }
 #endif /* STLSOFT_CF_STATIC_ARRAY_SIZE_DETERMINATION_SUPPORT */
 
+
+/* /////////////////////////////////////////////////////////////////////////
+ * classes
+ */
+
+/** A format for fast_strftime() that is parsed once, at construction, into
+ * a list of literal runs and fields, so that each format() call performs
+ * no parsing of the format string
+ *
+ * \ingroup group__library__Time
+ *
+ * \tparam T_char The character type
+ *
+ * The supported format codes, and the effect of the '#' modifier, are as
+ * for fast_strftime(). Unsupported codes produce no output (rather than
+ * disrupting the interpretation of the remainder of the format).
+ *
+ * \code
+  stlsoft::fast_strftime_format const fmt("%Y-%m-%d %H:%M:%S");
+
+  for (...)
+  {
+    char buff[101];
+
+    size_t const n = fmt.format(buff, &tm);
+
+    . . .
+  }
+ * \endcode
+ */
+template <ss_typename_param_k T_char>
+class basic_fast_strftime_format
+{
+public: // types
+    /// The character type
+    typedef T_char                                          char_type;
+    /// The size type
+    typedef ss_size_t                                       size_type;
+    /// This type
+    typedef basic_fast_strftime_format<T_char>              class_type;
+private:
+    typedef ximpl_fast_strftime_::fast_strftime_traits_<
+        char_type
+    >                                                       traits_type_;
+    typedef STLSOFT_NS_QUAL_STD(basic_string)<char_type>    string_type_;
+
+    struct op_t
+    {
+        char_type   code;   // 0 for a literal run
+        bool        hashed;
+        size_type   offset; // of the literal run in m_literals
+        size_type   len;    // of the literal run
+    };
+    typedef STLSOFT_NS_QUAL_STD(vector)<op_t>               ops_type_;
+
+public: // construction
+    /// Constructs from the given (nul-terminated) format string
+    ///
+    /// \pre NULL != fmt
+    explicit
+    basic_fast_strftime_format(char_type const* fmt)
+    {
+        STLSOFT_ASSERT(NULL != fmt);
+
+        parse_(fmt, fmt + stlsoft::c_str_len(fmt));
+    }
+    /// Constructs from the given format string slice
+    ///
+    /// \pre 0 == cchFmt || NULL != fmt
+    basic_fast_strftime_format(
+        char_type const*    fmt
+    ,   size_type           cchFmt
+    )
+    {
+        STLSOFT_ASSERT(0 == cchFmt || NULL != fmt);
+
+        parse_(fmt, fmt + cchFmt);
+    }
+
+public: // operations
+    /// Formats the given calendar time into the given buffer
+    ///
+    /// \param dest The destination buffer
+    /// \param cchDest The number of characters available in \c dest
+    /// \param tm Pointer to \c tm data structure. May not be \c nullptr
+    ///
+    /// \return The number of characters written, excluding the
+    ///   nul-terminator, or 0 if \c cchDest is insufficient
+    ///
+    /// \pre NULL != tm
+    /// \pre 0 == cchDest || NULL != dest
+    size_type
+    format(
+        char_type           dest[]
+    ,   size_type           cchDest
+    ,   struct tm const*    tm
+    ) const
+    {
+        STLSOFT_ASSERT(0 == cchDest || NULL != dest);
+        STLSOFT_ASSERT(NULL != tm);
+
+        if (0 == cchDest)
+        {
+            return 0;
+        }
+
+        ss_typename_type_k traits_type_::info_type const&   info    =   traits_type_::default_info();
+        char_type const* const                              lits    =   m_literals.data();
+        size_type                                           n       =   0;
+
+        { for (ss_typename_type_k ops_type_::const_iterator i = m_ops.begin(); i != m_ops.end(); ++i)
+        {
+            op_t const& op = *i;
+
+            if (0 == op.code)
+            {
+                if (!(n + op.len < cchDest))
+                {
+                    return 0;
+                }
+
+                { for (size_type j = 0; j != op.len; ++j)
+                {
+                    dest[n + j] = lits[op.offset + j];
+                }}
+
+                n += op.len;
+            }
+            else
+            {
+                if (ximpl_fast_strftime_::fast_strftime_field_insufficient_ == ximpl_fast_strftime_::fast_strftime_field_(dest, cchDest, &n, op.code, op.hashed, tm, info))
+                {
+                    return 0;
+                }
+            }
+        }}
+
+        dest[n] = '\0';
+
+        return n;
+    }
+
+#ifdef STLSOFT_CF_STATIC_ARRAY_SIZE_DETERMINATION_SUPPORT
+
+    /// Formats the given calendar time into the given buffer
+    template <ss_size_t V_dimension>
+    size_type
+    format(
+        char_type         (&dest)[V_dimension]
+    ,   struct tm const*    tm
+    ) const
+    {
+        return format(dest, V_dimension, tm);
+    }
+#endif /* STLSOFT_CF_STATIC_ARRAY_SIZE_DETERMINATION_SUPPORT */
+
+private: // implementation
+    static
+    bool
+    is_supported_code_(
+        char_type ch
+    )
+    {
+        switch (ch)
+        {
+        case 'a':
+        case 'A':
+        case 'b':
+        case 'B':
+        case 'C':
+        case 'd':
+        case 'D':
+        case 'e':
+        case 'F':
+        case 'h':
+        case 'H':
+        case 'I':
+        case 'j':
+        case 'm':
+        case 'M':
+        case 'R':
+        case 'S':
+        case 'T':
+        case 'u':
+        case 'U':
+        case 'w':
+        case 'W':
+        case 'y':
+        case 'Y':
+
+            return true;
+        default:
+
+            return false;
+        }
+    }
+
+    void
+    add_literal_(
+        char_type ch
+    )
+    {
+        if (m_ops.empty() ||
+            0 != m_ops.back().code)
+        {
+            op_t const op = { 0, false, m_literals.size(), 0 };
+
+            m_ops.push_back(op);
+        }
+
+        m_literals.append(1, ch);
+
+        ++m_ops.back().len;
+    }
+
+    void
+    add_field_(
+        char_type   ch
+    ,   bool        hashed
+    )
+    {
+        if (is_supported_code_(ch))
+        {
+            op_t const op = { ch, hashed, 0, 0 };
+
+            m_ops.push_back(op);
+        }
+    }
+
+    void
+    parse_(
+        char_type const*    b
+    ,   char_type const*    e
+    )
+    {
+        for (; b != e; )
+        {
+            char_type ch = *b++;
+
+            if ('%' != ch)
+            {
+                add_literal_(ch);
+
+                continue;
+            }
+
+            if (b == e)
+            {
+                break;
+            }
+
+            bool hashed = false;
+
+            ch = *b++;
+
+            if ('#' == ch)
+            {
+                if (b == e)
+                {
+                    break;
+                }
+
+                hashed = true;
+                ch = *b++;
+            }
+
+            switch (ch)
+            {
+            case '%':
+
+                add_literal_('%');
+                break;
+            case 'n':
+
+                add_literal_('\n');
+                break;
+            case 't':
+
+                add_literal_('\t');
+                break;
+            default:
+
+                add_field_(ch, hashed);
+                break;
+            }
+        }
+    }
+
+private: // fields
+    ops_type_       m_ops;
+    string_type_    m_literals;
+};
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * typedefs
+ */
+
+/** Specialisation of basic_fast_strftime_format for \c char */
+typedef basic_fast_strftime_format<ss_char_a_t>             fast_strftime_format;
+/** Specialisation of basic_fast_strftime_format for \c wchar_t */
+typedef basic_fast_strftime_format<ss_char_w_t>             fast_wcsftime_format;
+
+
 /* /////////////////////////////////////////////////////////////////////////
  * namespace
  */
@@ -0,0 +1,559 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    stlsoft/time/fast_timestamp_formatter.hpp
+ *
+ * Purpose: Timestamp formatter that caches the rendering of the current
+ *          second.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * Home:    http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/** \file stlsoft/time/fast_timestamp_formatter.hpp
+ *
+ * \brief [C++] Definition of the stlsoft::basic_fast_timestamp_formatter
+ *   class template
+ *  (\ref group__library__Time "Time" Library).
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_TIME_HPP_FAST_TIMESTAMP_FORMATTER
+#define STLSOFT_INCL_STLSOFT_TIME_HPP_FAST_TIMESTAMP_FORMATTER
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define STLSOFT_VER_STLSOFT_TIME_HPP_FAST_TIMESTAMP_FORMATTER_MAJOR    1
+# define STLSOFT_VER_STLSOFT_TIME_HPP_FAST_TIMESTAMP_FORMATTER_MINOR    0
+# define STLSOFT_VER_STLSOFT_TIME_HPP_FAST_TIMESTAMP_FORMATTER_REVISION 0
+# define STLSOFT_VER_STLSOFT_TIME_HPP_FAST_TIMESTAMP_FORMATTER_EDIT     1
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_H_STLSOFT
+# include <stlsoft/stlsoft.h>
+#endif /* !STLSOFT_INCL_STLSOFT_H_STLSOFT */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+#ifndef STLSOFT_INCL_STLSOFT_TIME_HPP_FAST_STRFTIME
+# include <stlsoft/time/fast_strftime.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_TIME_HPP_FAST_STRFTIME */
+
+#ifndef STLSOFT_INCL_STLSOFT_API_internal_h_time
+# include <stlsoft/api/internal/time.h>
+#endif /* !STLSOFT_INCL_STLSOFT_API_internal_h_time */
+
+#ifndef STLSOFT_INCL_STRING
+# define STLSOFT_INCL_STRING
+# include <string>
+#endif /* !STLSOFT_INCL_STRING */
+#ifndef STLSOFT_INCL_VECTOR
+# define STLSOFT_INCL_VECTOR
+# include <vector>
+#endif /* !STLSOFT_INCL_VECTOR */
+
+#ifndef STLSOFT_INCL_H_TIME
+# define STLSOFT_INCL_H_TIME
+# include <time.h>
+#endif /* !STLSOFT_INCL_H_TIME */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef STLSOFT_NO_NAMESPACE
+namespace stlsoft
+{
+#endif /* STLSOFT_NO_NAMESPACE */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions
+ */
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+namespace ximpl_fast_timestamp_formatter_
+{
+
+// floor division, for negative (pre-1970) times
+inline
+ss_sint64_t
+floor_div_(
+    ss_sint64_t n
+,   ss_sint64_t d
+)
+{
+    ss_sint64_t const q = n / d;
+
+    return (q * d > n) ? q - 1 : q;
+}
+
+// The number of days since 1970-01-01 of the given (proleptic Gregorian)
+// date. See http://howardhinnant.github.io/date_algorithms.html
+inline
+ss_sint64_t
+days_from_civil_(
+    ss_sint64_t y
+,   unsigned    m
+,   unsigned    d
+)
+{
+    y -= (m <= 2);
+
+    ss_sint64_t const   era =   floor_div_(y, 400);
+    unsigned const      yoe =   static_cast<unsigned>(y - era * 400);
+    unsigned const      doy =   (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+    unsigned const      doe =   yoe * 365 + yoe / 4 - yoe / 100 + doy;
+
+    return era * 146097 + static_cast<ss_sint64_t>(doe) - 719468;
+}
+
+// Converts a number of seconds since 1970-01-01 (in the target timezone)
+// into calendar time, without recourse to the C library
+inline
+void
+seconds_to_tm_(
+    ss_sint64_t s
+,   struct tm*  tm
+)
+{
+    ss_sint64_t const   days    =   floor_div_(s, 86400);
+    int const           secs    =   static_cast<int>(s - days * 86400);
+
+    tm->tm_hour =   secs / 3600;
+    tm->tm_min  =   (secs / 60) % 60;
+    tm->tm_sec  =   secs % 60;
+
+    // 1970-01-01 was a Thursday
+    tm->tm_wday =   static_cast<int>((days + 4) - floor_div_(days + 4, 7) * 7);
+
+    ss_sint64_t const   z       =   days + 719468;
+    ss_sint64_t const   era     =   floor_div_(z, 146097);
+    unsigned const      doe     =   static_cast<unsigned>(z - era * 146097);
+    unsigned const      yoe     =   (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    unsigned const      doy     =   doe - (365 * yoe + yoe / 4 - yoe / 100);
+    unsigned const      mp      =   (5 * doy + 2) / 153;
+    unsigned const      d       =   doy - (153 * mp + 2) / 5 + 1;
+    unsigned const      m       =   mp < 10 ? mp + 3 : mp - 9;
+    ss_sint64_t const   y       =   static_cast<ss_sint64_t>(yoe) + era * 400 + (m <= 2);
+
+    tm->tm_year =   static_cast<int>(y - 1900);
+    tm->tm_mon  =   static_cast<int>(m - 1);
+    tm->tm_mday =   static_cast<int>(d);
+    tm->tm_yday =   static_cast<int>(days - days_from_civil_(y, 1, 1));
+}
+
+} /* namespace ximpl_fast_timestamp_formatter_ */
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * classes
+ */
+
+/** Formats timestamps - seconds since the epoch plus nanoseconds - with a
+ * fixed format, caching the rendering of the current second so that only
+ * the sub-second fields are rendered in each call
+ *
+ * \ingroup group__library__Time
+ *
+ * \tparam T_char The character type
+ *
+ * The format is as for basic_fast_strftime_format, with the addition of the
+ * sub-second field \c %N (nanoseconds, 9 digits), which may be given a
+ * precision of 1-9 digits, as in \c %3N (milliseconds) and \c %6N
+ * (microseconds).
+ *
+ * Calendar time is obtained from the timestamp arithmetically, rather
+ * than by \c localtime_r() / \c gmtime_r() (which acquire a global lock).
+ * For local time the offset from UTC is obtained from \c localtime_r() at
+ * most once per 15 minutes (the granularity at which changes of offset
+ * occur).
+ *
+ * \note Instances hold a mutable cache and so are not thread-safe: use
+ *  one instance per thread.
+ *
+ * \code
+  stlsoft::fast_timestamp_formatter fmt("%Y-%m-%d %H:%M:%S.%3N");
+
+  struct timespec ts;
+
+  clock_gettime(CLOCK_REALTIME, &ts);
+
+  char        buff[101];
+  size_t const n = fmt.format(buff, ts.tv_sec, ts.tv_nsec);
+ * \endcode
+ */
+template <ss_typename_param_k T_char>
+class basic_fast_timestamp_formatter
+{
+public: // types
+    /// The character type
+    typedef T_char                                          char_type;
+    /// The size type
+    typedef ss_size_t                                       size_type;
+    /// The (whole-second) format type
+    typedef basic_fast_strftime_format<T_char>              format_type;
+    /// This type
+    typedef basic_fast_timestamp_formatter<T_char>          class_type;
+private:
+    typedef STLSOFT_NS_QUAL_STD(basic_string)<char_type>    string_type_;
+    typedef STLSOFT_NS_QUAL_STD(vector)<format_type>        formats_type_;
+    typedef STLSOFT_NS_QUAL_STD(vector)<size_type>          sizes_type_;
+
+public: // construction
+    /// Constructs from the given (nul-terminated) format string
+    ///
+    /// \param fmt The format
+    /// \param useUtc If \c true the timestamps are formatted as UTC;
+    ///   otherwise as local time
+    ///
+    /// \pre NULL != fmt
+    explicit
+    basic_fast_timestamp_formatter(
+        char_type const*    fmt
+    ,   bool                useUtc = false
+    )
+        : m_useUtc(useUtc)
+        , m_length(0)
+        , m_cachedSecond(0)
+        , m_cacheValid(false)
+        , m_offsetBlock(0)
+        , m_offsetValid(false)
+        , m_offset(0)
+        , m_isdst(0)
+    {
+        STLSOFT_ASSERT(NULL != fmt);
+
+        parse_(fmt, fmt + stlsoft::c_str_len(fmt));
+    }
+
+public: // operations
+    /// Formats the given timestamp into the given buffer
+    ///
+    /// \param dest The destination buffer
+    /// \param cchDest The number of characters available in \c dest
+    /// \param t The number of seconds since the epoch
+    /// \param nanoseconds The number of nanoseconds in the second
+    ///
+    /// \return The number of characters written, excluding the
+    ///   nul-terminator, or 0 if \c cchDest is insufficient
+    ///
+    /// \pre 0 == cchDest || NULL != dest
+    /// \pre nanoseconds >= 0 && nanoseconds < 1000000000
+    size_type
+    format(
+        char_type   dest[]
+    ,   size_type   cchDest
+    ,   time_t      t
+    ,   long        nanoseconds
+    )
+    {
+        STLSOFT_ASSERT(0 == cchDest || NULL != dest);
+        STLSOFT_ASSERT(nanoseconds >= 0 && nanoseconds < 1000000000);
+
+        if (!m_cacheValid ||
+            t != m_cachedSecond)
+        {
+            render_second_(t);
+        }
+
+        if (!(m_length < cchDest))
+        {
+            return 0;
+        }
+
+        char_type const* const  cache   =   m_cache.data();
+        size_type const         n       =   m_widths.size();
+        char_type*              p       =   dest;
+
+        { for (size_type i = 0;; ++i)
+        {
+            char_type const*        b   =   cache + m_offsets[i];
+            char_type const* const  e   =   b + m_lengths[i];
+
+            for (; b != e; ++b, ++p)
+            {
+                *p = *b;
+            }
+
+            if (i == n)
+            {
+                break;
+            }
+
+            p = write_fraction_(p, static_cast<unsigned long>(nanoseconds), m_widths[i]);
+        }}
+
+        *p = '\0';
+
+        STLSOFT_ASSERT(static_cast<size_type>(p - dest) == m_length);
+
+        return m_length;
+    }
+
+#ifdef STLSOFT_CF_STATIC_ARRAY_SIZE_DETERMINATION_SUPPORT
+
+    /// Formats the given timestamp into the given buffer
+    template <ss_size_t V_dimension>
+    size_type
+    format(
+        char_type (&dest)[V_dimension]
+    ,   time_t      t
+    ,   long        nanoseconds
+    )
+    {
+        return format(dest, V_dimension, t, nanoseconds);
+    }
+#endif /* STLSOFT_CF_STATIC_ARRAY_SIZE_DETERMINATION_SUPPORT */
+
+private: // implementation
+    static
+    char_type*
+    write_fraction_(
+        char_type*      p
+    ,   unsigned long   nanoseconds
+    ,   size_type       width
+    )
+    {
+        { for (size_type i = width; i != 9; ++i)
+        {
+            nanoseconds /= 10;
+        }}
+
+        { for (size_type i = width; i != 0; --i)
+        {
+            p[i - 1] = static_cast<char_type>('0' + nanoseconds % 10);
+
+            nanoseconds /= 10;
+        }}
+
+        return p + width;
+    }
+
+    void
+    add_segment_(
+        char_type const*    b
+    ,   char_type const*    e
+    )
+    {
+        size_type const cch = static_cast<size_type>(e - b);
+
+        m_formats.push_back(format_type(b, cch));
+        // a format code renders to at most 10 characters (as in "%F"),
+        // so no segment renders to more than 5 times its length
+        m_offsets.push_back(m_cache.size());
+        m_lengths.push_back(0);
+        m_cache.append(1 + 5 * cch, char_type(' '));
+    }
+
+    void
+    parse_(
+        char_type const*    b
+    ,   char_type const*    e
+    )
+    {
+        char_type const* segment = b;
+
+        for (; b != e; )
+        {
+            if ('%' != *b++)
+            {
+                continue;
+            }
+
+            char_type const* const directive = b - 1;
+
+            if (b == e)
+            {
+                break;
+            }
+
+            size_type width = 9;
+
+            if ('1' <= *b &&
+                '9' >= *b &&
+                b + 1 != e &&
+                'N' == b[1])
+            {
+                width = static_cast<size_type>(*b - '0');
+
+                ++b;
+            }
+
+            if ('N' == *b)
+            {
+                add_segment_(segment, directive);
+
+                m_widths.push_back(width);
+
+                segment = ++b;
+            }
+            else
+            {
+                // skip the code, so that "%%N" is a literal "%N"
+                if ('#' == *b &&
+                    b + 1 != e)
+                {
+                    ++b;
+                }
+
+                ++b;
+            }
+        }
+
+        add_segment_(segment, e);
+    }
+
+    void
+    update_offset_(
+        time_t t
+    )
+    {
+        ss_sint64_t const block = ximpl_fast_timestamp_formatter_::floor_div_(static_cast<ss_sint64_t>(t), 900);
+
+        if (!m_offsetValid ||
+            block != m_offsetBlock)
+        {
+            struct tm tm;
+
+            if (0 == STLSOFT_API_INTERNAL_Time_localtime(&tm, &t))
+            {
+                ss_sint64_t const local = ximpl_fast_timestamp_formatter_::days_from_civil_(1900 + tm.tm_year, static_cast<unsigned>(1 + tm.tm_mon), static_cast<unsigned>(tm.tm_mday)) * 86400 + tm.tm_hour * 3600 + tm.tm_min * 60 + tm.tm_sec;
+
+                m_offset    =   local - static_cast<ss_sint64_t>(t);
+                m_isdst     =   tm.tm_isdst;
+            }
+            else
+            {
+                m_offset    =   0;
+                m_isdst     =   0;
+            }
+
+            m_offsetBlock   =   block;
+            m_offsetValid   =   true;
+        }
+    }
+
+    void
+    render_second_(
+        time_t t
+    )
+    {
+        struct tm tm = {};
+
+        if (!m_useUtc)
+        {
+            update_offset_(t);
+        }
+
+        ximpl_fast_timestamp_formatter_::seconds_to_tm_(static_cast<ss_sint64_t>(t) + m_offset, &tm);
+
+        tm.tm_isdst = m_isdst;
+
+        char_type* const cache = &m_cache[0];
+
+        m_length = 0;
+
+        { for (size_type i = 0; i != m_formats.size(); ++i)
+        {
+            size_type const cch = (i + 1 == m_formats.size() ? m_cache.size() : m_offsets[i + 1]) - m_offsets[i];
+
+            m_lengths[i] = m_formats[i].format(cache + m_offsets[i], cch, &tm);
+
+            m_length += m_lengths[i];
+        }}
+
+        { for (size_type i = 0; i != m_widths.size(); ++i)
+        {
+            m_length += m_widths[i];
+        }}
+
+        m_cachedSecond  =   t;
+        m_cacheValid    =   true;
+    }
+
+private: // fields
+    bool            m_useUtc;
+    formats_type_   m_formats;  // the whole-second formats, either side of each sub-second field
+    sizes_type_     m_widths;   // the widths of the sub-second fields
+    string_type_    m_cache;    // the rendering of each format, for m_cachedSecond
+    sizes_type_     m_offsets;  // the offset of each format's rendering in m_cache
+    sizes_type_     m_lengths;  // the length of each format's rendering in m_cache
+    size_type       m_length;   // the total length of the formatted timestamp
+    time_t          m_cachedSecond;
+    bool            m_cacheValid;
+    ss_sint64_t     m_offsetBlock;
+    bool            m_offsetValid;
+    ss_sint64_t     m_offset;   // seconds east of UTC
+    int             m_isdst;
+};
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * typedefs
+ */
+
+/** Specialisation of basic_fast_timestamp_formatter for \c char */
+typedef basic_fast_timestamp_formatter<ss_char_a_t>         fast_timestamp_formatter;
+/** Specialisation of basic_fast_timestamp_formatter for \c wchar_t */
+typedef basic_fast_timestamp_formatter<ss_char_w_t>         fast_wtimestamp_formatter;
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef STLSOFT_NO_NAMESPACE
+} /* namespace stlsoft */
+#endif /* STLSOFT_NO_NAMESPACE */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !STLSOFT_INCL_STLSOFT_TIME_HPP_FAST_TIMESTAMP_FORMATTER */
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -4,7 +4,7 @@
  * Purpose:     Bit test functions
  *
  * Created:     2nd June 2010
- * Updated:     11th March 2024
+ * Updated:     16th October 2026
  *
  * Home:        http://stlsoft.org/
  *
@@ -52,9 +52,9 @@
 
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 # define STLSOFT_VER_STLSOFT_UTIL_BITS_H_TEST_FUNCTIONS_MAJOR       1
-# define STLSOFT_VER_STLSOFT_UTIL_BITS_H_TEST_FUNCTIONS_MINOR       0
-# define STLSOFT_VER_STLSOFT_UTIL_BITS_H_TEST_FUNCTIONS_REVISION    3
-# define STLSOFT_VER_STLSOFT_UTIL_BITS_H_TEST_FUNCTIONS_EDIT        12
+# define STLSOFT_VER_STLSOFT_UTIL_BITS_H_TEST_FUNCTIONS_MINOR       2
+# define STLSOFT_VER_STLSOFT_UTIL_BITS_H_TEST_FUNCTIONS_REVISION    2
+# define STLSOFT_VER_STLSOFT_UTIL_BITS_H_TEST_FUNCTIONS_EDIT        16
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 
@@ -77,6 +77,19 @@
 #endif /* !STLSOFT_INCL_STLSOFT_QUALITY_H_COVER */
 
 
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#if defined(STLSOFT_COMPILER_IS_CLANG) || \
+    defined(STLSOFT_COMPILER_IS_GCC)
+# define STLSOFT_UTIL_BITS_TEST_FUNCTIONS_USE_BUILTIN_CLZ_
+#elif defined(STLSOFT_COMPILER_IS_MSVC)
+# define STLSOFT_UTIL_BITS_TEST_FUNCTIONS_USE_BITSCAN_
+# include <intrin.h>
+#endif /* compiler */
+
+
 /* /////////////////////////////////////////////////////////////////////////
  * namespace
  */
@@ -142,6 +155,16 @@ stlsoft_C_find_highest_bit_in_32bit_unsigned_integer(
     ss_uint32_t v
 ) STLSOFT_NOEXCEPT
 {
+#if defined(STLSOFT_UTIL_BITS_TEST_FUNCTIONS_USE_BUILTIN_CLZ_)
+
+    return (0 == v) ? 0u : (32u - STLSOFT_STATIC_CAST(unsigned, __builtin_clz(v)));
+#elif defined(STLSOFT_UTIL_BITS_TEST_FUNCTIONS_USE_BITSCAN_)
+
+    unsigned long r;
+
+    return _BitScanReverse(&r, v) ? (STLSOFT_STATIC_CAST(unsigned, r) + 1u) : 0u;
+#else /* ? compiler */
+
     unsigned const r_high = stlsoft_C_find_highest_bit_in_16bit_unsigned_integer(STLSOFT_STATIC_CAST(ss_uint16_t, v >> 16));
 
     if (0 != r_high)
@@ -150,6 +173,7 @@ stlsoft_C_find_highest_bit_in_32bit_unsigned_integer(
     }
 
     return stlsoft_C_find_highest_bit_in_16bit_unsigned_integer(STLSOFT_STATIC_CAST(ss_uint16_t, v));
+#endif /* compiler */
 }
 
 /** Find the 1-based index of the highest non-zero bit in a 64-bit unsigned
@@ -163,6 +187,18 @@ stlsoft_C_find_highest_bit_in_64bit_unsigned_integer(
     ss_uint64_t v
 ) STLSOFT_NOEXCEPT
 {
+#if defined(STLSOFT_UTIL_BITS_TEST_FUNCTIONS_USE_BUILTIN_CLZ_)
+
+    return (0 == v) ? 0u : (64u - STLSOFT_STATIC_CAST(unsigned, __builtin_clzll(v)));
+#elif defined(STLSOFT_UTIL_BITS_TEST_FUNCTIONS_USE_BITSCAN_) && \
+      (   defined(_M_X64) || \
+          defined(_M_ARM64))
+
+    unsigned long r;
+
+    return _BitScanReverse64(&r, v) ? (STLSOFT_STATIC_CAST(unsigned, r) + 1u) : 0u;
+#else /* ? compiler */
+
     unsigned const r_high = stlsoft_C_find_highest_bit_in_32bit_unsigned_integer(STLSOFT_STATIC_CAST(ss_uint32_t, v >> 32));
 
     if (0 != r_high)
@@ -171,6 +207,93 @@ stlsoft_C_find_highest_bit_in_64bit_unsigned_integer(
     }
 
     return stlsoft_C_find_highest_bit_in_32bit_unsigned_integer(STLSOFT_STATIC_CAST(ss_uint32_t, v));
+#endif /* compiler */
+}
+
+/** Counts the number of trailing (least significant) zero bits in a
+ * 32-bit unsigned integer, i.e. the 0-based index of the lowest non-zero
+ * bit
+ *
+ * \retval 32 no bits are found
+ */
+STLSOFT_INLINE
+unsigned
+stlsoft_C_count_trailing_zero_bits_in_32bit_unsigned_integer(
+    ss_uint32_t v
+) STLSOFT_NOEXCEPT
+{
+    if (0 == v)
+    {
+        return 32u;
+    }
+    else
+    {
+#if defined(STLSOFT_UTIL_BITS_TEST_FUNCTIONS_USE_BUILTIN_CLZ_)
+
+        return STLSOFT_STATIC_CAST(unsigned, __builtin_ctz(v));
+#elif defined(STLSOFT_UTIL_BITS_TEST_FUNCTIONS_USE_BITSCAN_)
+
+        unsigned long r;
+
+        _BitScanForward(&r, v);
+
+        return STLSOFT_STATIC_CAST(unsigned, r);
+#else /* ? compiler */
+
+        unsigned r = 0;
+
+        for (; 0 == (v & 1u); v >>= 1)
+        {
+            ++r;
+        }
+
+        return r;
+#endif /* compiler */
+    }
+}
+
+/** Counts the number of trailing (least significant) zero bits in a
+ * 64-bit unsigned integer, i.e. the 0-based index of the lowest non-zero
+ * bit
+ *
+ * \retval 64 no bits are found
+ */
+STLSOFT_INLINE
+unsigned
+stlsoft_C_count_trailing_zero_bits_in_64bit_unsigned_integer(
+    ss_uint64_t v
+) STLSOFT_NOEXCEPT
+{
+    if (0 == v)
+    {
+        return 64u;
+    }
+    else
+    {
+#if defined(STLSOFT_UTIL_BITS_TEST_FUNCTIONS_USE_BUILTIN_CLZ_)
+
+        return STLSOFT_STATIC_CAST(unsigned, __builtin_ctzll(v));
+#elif defined(STLSOFT_UTIL_BITS_TEST_FUNCTIONS_USE_BITSCAN_) && \
+      (   defined(_M_X64) || \
+          defined(_M_ARM64))
+
+        unsigned long r;
+
+        _BitScanForward64(&r, v);
+
+        return STLSOFT_STATIC_CAST(unsigned, r);
+#else /* ? compiler */
+
+        ss_uint32_t const v_low = STLSOFT_STATIC_CAST(ss_uint32_t, v);
+
+        if (0 != v_low)
+        {
+            return stlsoft_C_count_trailing_zero_bits_in_32bit_unsigned_integer(v_low);
+        }
+
+        return 32u + stlsoft_C_count_trailing_zero_bits_in_32bit_unsigned_integer(STLSOFT_STATIC_CAST(ss_uint32_t, v >> 32));
+#endif /* compiler */
+    }
 }
 
 
@@ -232,6 +355,32 @@ find_highest_bit(
     return stlsoft_C_find_highest_bit_in_8bit_unsigned_integer(v);
 }
 
+/**
+ *
+ * \see stlsoft_C_count_trailing_zero_bits_in_64bit_unsigned_integer
+ */
+inline
+unsigned
+count_trailing_zero_bits(
+    ss_uint64_t v
+) STLSOFT_NOEXCEPT
+{
+    return stlsoft_C_count_trailing_zero_bits_in_64bit_unsigned_integer(v);
+}
+
+/**
+ *
+ * \see stlsoft_C_count_trailing_zero_bits_in_32bit_unsigned_integer
+ */
+inline
+unsigned
+count_trailing_zero_bits(
+    ss_uint32_t v
+) STLSOFT_NOEXCEPT
+{
+    return stlsoft_C_count_trailing_zero_bits_in_32bit_unsigned_integer(v);
+}
+
 
 #endif /* __cplusplus */
 
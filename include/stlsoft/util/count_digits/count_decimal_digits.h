@@ -4,11 +4,11 @@
  * Purpose: Functions for efficient counting of decimal digits in integers
  *
  * Created: 7th June 2011
- * Updated: 19th December 2024
+ * Updated: 16th October 2026
  *
  * Home:    http://stlsoft.org/
  *
- * Copyright (c) 2019-2024, Matthew Wilson and Synesis Information Systems
+ * Copyright (c) 2019-2026, Matthew Wilson and Synesis Information Systems
  * Copyright (c) 2011-2019, Matthew Wilson and Synesis Software
  * All rights reserved.
  *
@@ -53,9 +53,9 @@
 
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 # define STLSOFT_VER_STLSOFT_UTIL_INCL_COUNT_DIGITS_H_COUNT_DECIMAL_DIGITS_MAJOR    3
-# define STLSOFT_VER_STLSOFT_UTIL_INCL_COUNT_DIGITS_H_COUNT_DECIMAL_DIGITS_MINOR    0
+# define STLSOFT_VER_STLSOFT_UTIL_INCL_COUNT_DIGITS_H_COUNT_DECIMAL_DIGITS_MINOR    1
 # define STLSOFT_VER_STLSOFT_UTIL_INCL_COUNT_DIGITS_H_COUNT_DECIMAL_DIGITS_REVISION 1
-# define STLSOFT_VER_STLSOFT_UTIL_INCL_COUNT_DIGITS_H_COUNT_DECIMAL_DIGITS_EDIT     16
+# define STLSOFT_VER_STLSOFT_UTIL_INCL_COUNT_DIGITS_H_COUNT_DECIMAL_DIGITS_EDIT     18
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 
@@ -70,6 +70,30 @@
 # pragma message(__FILE__)
 #endif /* STLSOFT_TRACE_INCLUDE */
 
+#ifndef STLSOFT_INCL_STLSOFT_UTIL_BITS_H_TEST_FUNCTIONS
+# include <stlsoft/util/bits/test_functions.h>
+#endif /* !STLSOFT_INCL_STLSOFT_UTIL_BITS_H_TEST_FUNCTIONS */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+/* The decimal digit count is derived from the bit-width of the value, which
+ * is obtained from stlsoft_C_find_highest_bit_in_32bit_unsigned_integer()
+ * and stlsoft_C_find_highest_bit_in_64bit_unsigned_integer(), which use a
+ * count-leading-zeros instruction with the compilers selected here.
+ * Defining STLSOFT_COUNT_DIGITS_NO_USE_CLZ selects the comparison-based
+ * implementation instead.
+ */
+
+#if !defined(STLSOFT_COUNT_DIGITS_NO_USE_CLZ) && \
+    (   defined(STLSOFT_COMPILER_IS_CLANG) || \
+        defined(STLSOFT_COMPILER_IS_GCC) || \
+        defined(STLSOFT_COMPILER_IS_MSVC))
+# define STLSOFT_COUNT_DECIMAL_DIGITS_USE_CLZ_
+#endif
+
 
 /* /////////////////////////////////////////////////////////////////////////
  * API functions (C)
@@ -82,6 +106,35 @@ stlsoft_C_count_decimal_digits_uint32(
     STLSOFT_NS_QUAL(ss_uint32_t) i
 )
 {
+#if defined(STLSOFT_COUNT_DECIMAL_DIGITS_USE_CLZ_)
+
+    static STLSOFT_NS_QUAL(ss_uint32_t) const s_powers[] =
+    {
+            0
+        ,   10
+        ,   100
+        ,   1000
+        ,   10000
+        ,   100000
+        ,   1000000
+        ,   10000000
+        ,   100000000
+        ,   1000000000
+    };
+
+    /* The number of bits, b, in i (made non-0), gives an estimate,
+     * t = floor(b * log10(2)) (with log10(2) ~= 1233 / 4096), of the
+     * number of digits that is either exact or one too few, which is then
+     * corrected by a single comparison against the power-of-10 table,
+     * whose first element is 0 so that single-digit values are never
+     * adjusted.
+     */
+
+    unsigned const t = (STLSOFT_NS_QUAL(stlsoft_C_find_highest_bit_in_32bit_unsigned_integer)(i | 1u) * 1233u) >> 12;
+
+    return STLSOFT_STATIC_CAST(int, t) + 1 - (i < s_powers[t]);
+#else /* ? STLSOFT_COUNT_DECIMAL_DIGITS_USE_CLZ_ */
+
     if (0 == i)
     {
         return 1u;
@@ -156,6 +209,7 @@ stlsoft_C_count_decimal_digits_uint32(
             }
         }
     }
+#endif /* STLSOFT_COUNT_DECIMAL_DIGITS_USE_CLZ_ */
 }
 
 STLSOFT_INLINE
@@ -164,6 +218,37 @@ stlsoft_C_count_decimal_digits_uint64(
     STLSOFT_NS_QUAL(ss_uint64_t) i
 )
 {
+#if defined(STLSOFT_COUNT_DECIMAL_DIGITS_USE_CLZ_)
+
+    static STLSOFT_NS_QUAL(ss_uint64_t) const s_powers[] =
+    {
+            0
+        ,   10
+        ,   100
+        ,   1000
+        ,   10000
+        ,   100000
+        ,   1000000
+        ,   10000000
+        ,   100000000
+        ,   1000000000
+        ,   10000000000
+        ,   100000000000
+        ,   1000000000000
+        ,   10000000000000
+        ,   100000000000000
+        ,   1000000000000000
+        ,   10000000000000000
+        ,   100000000000000000
+        ,   1000000000000000000
+        ,   10000000000000000000u
+    };
+
+    unsigned const t = (STLSOFT_NS_QUAL(stlsoft_C_find_highest_bit_in_64bit_unsigned_integer)(i | 1u) * 1233u) >> 12;
+
+    return STLSOFT_STATIC_CAST(int, t) + 1 - (i < s_powers[t]);
+#else /* ? STLSOFT_COUNT_DECIMAL_DIGITS_USE_CLZ_ */
+
     if (0 == i)
     {
         return 1u;
@@ -308,6 +393,7 @@ stlsoft_C_count_decimal_digits_uint64(
             }
         }
     }
+#endif /* STLSOFT_COUNT_DECIMAL_DIGITS_USE_CLZ_ */
 }
 
 
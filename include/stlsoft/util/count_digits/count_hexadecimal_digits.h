@@ -5,11 +5,11 @@
  *          integers.
  *
  * Created: 18th December 2024
- * Updated: 18th December 2024
+ * Updated: 16th October 2026
  *
  * Home:    http://stlsoft.org/
  *
- * Copyright (c) 2024, Matthew Wilson and Synesis Information Systems
+ * Copyright (c) 2024-2026, Matthew Wilson and Synesis Information Systems
  * All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
@@ -53,9 +53,9 @@
 
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 # define STLSOFT_VER_STLSOFT_UTIL_INCL_COUNT_DIGITS_H_COUNT_HEXADECIMAL_DIGITS_MAJOR    1
-# define STLSOFT_VER_STLSOFT_UTIL_INCL_COUNT_DIGITS_H_COUNT_HEXADECIMAL_DIGITS_MINOR    0
+# define STLSOFT_VER_STLSOFT_UTIL_INCL_COUNT_DIGITS_H_COUNT_HEXADECIMAL_DIGITS_MINOR    1
 # define STLSOFT_VER_STLSOFT_UTIL_INCL_COUNT_DIGITS_H_COUNT_HEXADECIMAL_DIGITS_REVISION 1
-# define STLSOFT_VER_STLSOFT_UTIL_INCL_COUNT_DIGITS_H_COUNT_HEXADECIMAL_DIGITS_EDIT     1
+# define STLSOFT_VER_STLSOFT_UTIL_INCL_COUNT_DIGITS_H_COUNT_HEXADECIMAL_DIGITS_EDIT     3
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 
@@ -70,6 +70,30 @@
 # pragma message(__FILE__)
 #endif /* STLSOFT_TRACE_INCLUDE */
 
+#ifndef STLSOFT_INCL_STLSOFT_UTIL_BITS_H_TEST_FUNCTIONS
+# include <stlsoft/util/bits/test_functions.h>
+#endif /* !STLSOFT_INCL_STLSOFT_UTIL_BITS_H_TEST_FUNCTIONS */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+/* The hexadecimal digit count is derived from the bit-width of the value,
+ * which is obtained from stlsoft_C_find_highest_bit_in_32bit_unsigned_integer()
+ * and stlsoft_C_find_highest_bit_in_64bit_unsigned_integer(), which use a
+ * count-leading-zeros instruction with the compilers selected here.
+ * Defining STLSOFT_COUNT_DIGITS_NO_USE_CLZ selects the comparison-based
+ * implementation instead.
+ */
+
+#if !defined(STLSOFT_COUNT_DIGITS_NO_USE_CLZ) && \
+    (   defined(STLSOFT_COMPILER_IS_CLANG) || \
+        defined(STLSOFT_COMPILER_IS_GCC) || \
+        defined(STLSOFT_COMPILER_IS_MSVC))
+# define STLSOFT_COUNT_HEXADECIMAL_DIGITS_USE_CLZ_
+#endif
+
 
 /* /////////////////////////////////////////////////////////////////////////
  * API functions (C)
@@ -81,6 +105,16 @@ stlsoft_C_count_hexadecimal_digits_uint32(
     STLSOFT_NS_QUAL(ss_uint32_t) i
 )
 {
+#if defined(STLSOFT_COUNT_HEXADECIMAL_DIGITS_USE_CLZ_)
+
+    /* Each hexadecimal digit represents 4 bits, so the number of digits
+     * is the number of bits in i (made non-0), rounded up to a multiple
+     * of 4, divided by 4.
+     */
+
+    return STLSOFT_STATIC_CAST(int, (STLSOFT_NS_QUAL(stlsoft_C_find_highest_bit_in_32bit_unsigned_integer)(i | 1u) + 3u) >> 2);
+#else /* ? STLSOFT_COUNT_HEXADECIMAL_DIGITS_USE_CLZ_ */
+
     if (0 == i)
     {
         return 1u;
@@ -138,6 +172,7 @@ stlsoft_C_count_hexadecimal_digits_uint32(
             }
         }
     }
+#endif /* STLSOFT_COUNT_HEXADECIMAL_DIGITS_USE_CLZ_ */
 }
 
 STLSOFT_INLINE
@@ -146,6 +181,11 @@ stlsoft_C_count_hexadecimal_digits_uint64(
     STLSOFT_NS_QUAL(ss_uint64_t) i
 )
 {
+#if defined(STLSOFT_COUNT_HEXADECIMAL_DIGITS_USE_CLZ_)
+
+    return STLSOFT_STATIC_CAST(int, (STLSOFT_NS_QUAL(stlsoft_C_find_highest_bit_in_64bit_unsigned_integer)(i | 1u) + 3u) >> 2);
+#else /* ? STLSOFT_COUNT_HEXADECIMAL_DIGITS_USE_CLZ_ */
+
     if (0 == i)
     {
         return 1u;
@@ -259,6 +299,7 @@ stlsoft_C_count_hexadecimal_digits_uint64(
             }
         }
     }
+#endif /* STLSOFT_COUNT_HEXADECIMAL_DIGITS_USE_CLZ_ */
 }
 
 
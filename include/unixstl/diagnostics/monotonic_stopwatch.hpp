@@ -0,0 +1,517 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    unixstl/diagnostics/monotonic_stopwatch.hpp
+ *
+ * Purpose: monotonic_stopwatch class.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * Home:    http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/** \file unixstl/diagnostics/monotonic_stopwatch.hpp
+ *
+ * \brief [C++] Definition of the
+ *  \link unixstl::monotonic_stopwatch monotonic_stopwatch\endlink class
+ *   (\ref group__library__Diagnostic "Diagnostic" Library).
+ */
+
+#ifndef UNIXSTL_INCL_UNIXSTL_DIAGNOSTICS_HPP_MONOTONIC_STOPWATCH
+#define UNIXSTL_INCL_UNIXSTL_DIAGNOSTICS_HPP_MONOTONIC_STOPWATCH
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define UNIXSTL_VER_UNIXSTL_DIAGNOSTICS_HPP_MONOTONIC_STOPWATCH_MAJOR      1
+# define UNIXSTL_VER_UNIXSTL_DIAGNOSTICS_HPP_MONOTONIC_STOPWATCH_MINOR      0
+# define UNIXSTL_VER_UNIXSTL_DIAGNOSTICS_HPP_MONOTONIC_STOPWATCH_REVISION   0
+# define UNIXSTL_VER_UNIXSTL_DIAGNOSTICS_HPP_MONOTONIC_STOPWATCH_EDIT       1
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef UNIXSTL_INCL_UNIXSTL_H_UNIXSTL
+# include <unixstl/unixstl.h>
+#endif /* !UNIXSTL_INCL_UNIXSTL_H_UNIXSTL */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+#ifndef STLSOFT_INCL_H_TIME
+# define STLSOFT_INCL_H_TIME
+# include <time.h>
+#endif /* !STLSOFT_INCL_H_TIME */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#if defined(CLOCK_MONOTONIC_RAW) && \
+    !defined(UNIXSTL_MONOTONIC_STOPWATCH_NO_USE_CLOCK_MONOTONIC_RAW)
+# define UNIXSTL_MONOTONIC_STOPWATCH_CLOCK_ID_                  CLOCK_MONOTONIC_RAW
+#else
+# define UNIXSTL_MONOTONIC_STOPWATCH_CLOCK_ID_                  CLOCK_MONOTONIC
+#endif
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef UNIXSTL_NO_NAMESPACE
+# if defined(STLSOFT_NO_NAMESPACE) || \
+     defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+/* There is no stlsoft namespace, so must define ::unixstl */
+namespace unixstl
+{
+# else
+/* Define stlsoft::unixstl_project */
+namespace stlsoft
+{
+namespace unixstl_project
+{
+# endif /* STLSOFT_NO_NAMESPACE */
+#endif /* !UNIXSTL_NO_NAMESPACE */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * classes
+ */
+
+/** A stopwatch using \c clock_gettime() with a monotonic clock
+ *
+ * \ingroup group__library__Diagnostic
+ *
+ * This class provides nanosecond-resolution performance monitoring based
+ * around the POSIX \c clock_gettime() API, using \c CLOCK_MONOTONIC_RAW
+ * where it is available (and \c CLOCK_MONOTONIC otherwise), and has the
+ * same interface as \link unixstl::stopwatch stopwatch\endlink.
+ *
+ * Unlike \c gettimeofday(), the clock is not affected by changes to the
+ * system time (nor, with \c CLOCK_MONOTONIC_RAW, by NTP slewing), and the
+ * epoch is held as a single count of nanoseconds, so measurements and
+ * interval calculations are cheaper.
+ *
+ * \note Define the pre-processor symbol
+ *  <code>UNIXSTL_MONOTONIC_STOPWATCH_NO_USE_CLOCK_MONOTONIC_RAW</code> to
+ *  use \c CLOCK_MONOTONIC even when \c CLOCK_MONOTONIC_RAW is available.
+ */
+class monotonic_stopwatch
+{
+public: // types
+    /// The epoch type
+    ///
+    /// The type of the epoch measurement, a 64-bit signed integer count of
+    /// nanoseconds from an arbitrary (but fixed) point.
+    typedef us_sint64_t                                     epoch_type;
+    /// The interval type
+    ///
+    /// The type of the interval measurement, a 64-bit signed integer
+    typedef us_sint64_t                                     interval_type;
+    /// The class type
+    typedef monotonic_stopwatch                             class_type;
+
+
+public: // construction
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+    monotonic_stopwatch() // This is needed only to suppress compiler warnings about unused variables
+        : m_start(0)
+        , m_end(0)
+        , m_pause(0)
+        , m_paused_ns(0)
+    {}
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+
+public: // operations
+    /// Starts measurement
+    ///
+    /// Begins the measurement period
+    void    start();
+    /// Pauses the measurement
+    ///
+    void    pause();
+    /// Unpauses the measurement
+    ///
+    void    unpause();
+    /// Ends measurement
+    ///
+    /// Ends the measurement period
+    void    stop();
+    /// Ends the current measurement period and start the next
+    ///
+    /// \remarks This is equivalent to an atomic invocation of stop() and
+    ///  start()
+    void    restart();
+
+
+public: // attributes
+    /// The current epoch
+    static epoch_type       get_epoch();
+
+    /// The number of whole seconds in the given measurement period
+    static interval_type    get_seconds(epoch_type start, epoch_type end);
+    /// The number of whole milliseconds in the given measurement period
+    static interval_type    get_milliseconds(epoch_type start, epoch_type end);
+    /// The number of whole microseconds in the given measurement period
+    static interval_type    get_microseconds(epoch_type start, epoch_type end);
+    /// The number of whole nanoseconds in the given measurement period
+    static interval_type    get_nanoseconds(epoch_type start, epoch_type end);
+
+    /// The elapsed count in the measurement period
+    ///
+    /// This represents the extent, in nanoseconds, of the measurement
+    /// period
+    interval_type   get_period_count() const;
+    /// The number of whole seconds in the measurement period
+    ///
+    /// This represents the extent, in whole seconds, of the measurement
+    /// period
+    interval_type   get_seconds() const;
+    /// The number of whole milliseconds in the measurement period
+    ///
+    /// This represents the extent, in whole milliseconds, of the
+    /// measurement period
+    interval_type   get_milliseconds() const;
+    /// The number of whole microseconds in the measurement period
+    ///
+    /// This represents the extent, in whole microseconds, of the
+    /// measurement period
+    interval_type   get_microseconds() const;
+    /// The number of whole nanoseconds in the measurement period
+    ///
+    /// This represents the extent, in whole nanoseconds, of the
+    /// measurement period
+    interval_type   get_nanoseconds() const;
+
+    /// Stops the current period, starts the next, and returns the period
+    /// count for the prior period.
+    interval_type   stop_get_period_count_and_restart();
+
+    /// Stops the current period, starts the next, and returns the interval,
+    /// in seconds, for the prior period.
+    interval_type   stop_get_seconds_and_restart();
+
+    /// Stops the current period, starts the next, and returns the interval,
+    /// in milliseconds, for the prior period.
+    interval_type   stop_get_milliseconds_and_restart();
+
+    /// Stops the current period, starts the next, and returns the interval,
+    /// in microseconds, for the prior period.
+    interval_type   stop_get_microseconds_and_restart();
+
+    /// Stops the current period, starts the next, and returns the interval,
+    /// in nanoseconds, for the prior period.
+    interval_type   stop_get_nanoseconds_and_restart();
+
+
+private: // implementation
+    // take a measurement, in nanoseconds
+    static
+    epoch_type
+    measure_();
+
+    // the (unpaused) nanoseconds in the measurement period
+    interval_type
+    elapsed_ns_() const;
+
+
+private: // fields
+    /// Stores the start epoch
+    epoch_type      m_start;
+    /// Stores the end epoch
+    epoch_type      m_end;
+    /// Stores the pause epoch
+    epoch_type      m_pause;
+    /// Stores the (cumulate) pause time (in nanoseconds)
+    interval_type   m_paused_ns;
+};
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * implementation
+ */
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+inline
+/* static */
+monotonic_stopwatch::epoch_type
+monotonic_stopwatch::measure_()
+{
+    struct timespec ts;
+
+    ::clock_gettime(UNIXSTL_MONOTONIC_STOPWATCH_CLOCK_ID_, &ts);
+
+    return static_cast<epoch_type>(ts.tv_sec) * (1000 * 1000 * 1000) + ts.tv_nsec;
+}
+
+inline
+monotonic_stopwatch::interval_type
+monotonic_stopwatch::elapsed_ns_() const
+{
+    UNIXSTL_MESSAGE_ASSERT("end before start: stop() must be called after start()", m_start <= m_end);
+
+    return (m_end - m_start) - m_paused_ns;
+}
+
+inline
+void
+monotonic_stopwatch::start()
+{
+    m_start = measure_();
+
+    m_end = m_start;
+    m_pause = 0;
+    m_paused_ns = 0;
+}
+
+inline
+void
+monotonic_stopwatch::pause()
+{
+    m_pause = measure_();
+}
+
+inline
+void
+monotonic_stopwatch::unpause()
+{
+    m_paused_ns += measure_() - m_pause;
+}
+
+inline
+void
+monotonic_stopwatch::stop()
+{
+    m_end = measure_();
+}
+
+inline
+void
+monotonic_stopwatch::restart()
+{
+    m_start = measure_();
+
+    m_end = m_start;
+    m_paused_ns = 0;
+}
+
+inline
+/* static */
+monotonic_stopwatch::epoch_type
+monotonic_stopwatch::get_epoch()
+{
+    return measure_();
+}
+
+inline
+/* static */
+monotonic_stopwatch::interval_type
+monotonic_stopwatch::get_seconds(
+    monotonic_stopwatch::epoch_type start
+,   monotonic_stopwatch::epoch_type end
+)
+{
+    return get_nanoseconds(start, end) / (1000 * 1000 * 1000);
+}
+
+inline
+/* static */
+monotonic_stopwatch::interval_type
+monotonic_stopwatch::get_milliseconds(
+    monotonic_stopwatch::epoch_type start
+,   monotonic_stopwatch::epoch_type end
+)
+{
+    return get_nanoseconds(start, end) / (1000 * 1000);
+}
+
+inline
+/* static */
+monotonic_stopwatch::interval_type
+monotonic_stopwatch::get_microseconds(
+    monotonic_stopwatch::epoch_type start
+,   monotonic_stopwatch::epoch_type end
+)
+{
+    return get_nanoseconds(start, end) / 1000;
+}
+
+inline
+/* static */
+monotonic_stopwatch::interval_type
+monotonic_stopwatch::get_nanoseconds(
+    monotonic_stopwatch::epoch_type start
+,   monotonic_stopwatch::epoch_type end
+)
+{
+    UNIXSTL_MESSAGE_ASSERT("end before start", start <= end);
+
+    return end - start;
+}
+
+inline
+monotonic_stopwatch::interval_type
+monotonic_stopwatch::get_period_count() const
+{
+    return elapsed_ns_();
+}
+
+inline
+monotonic_stopwatch::interval_type
+monotonic_stopwatch::get_seconds() const
+{
+    return elapsed_ns_() / (1000 * 1000 * 1000);
+}
+
+inline
+monotonic_stopwatch::interval_type
+monotonic_stopwatch::get_milliseconds() const
+{
+    return elapsed_ns_() / (1000 * 1000);
+}
+
+inline
+monotonic_stopwatch::interval_type
+monotonic_stopwatch::get_microseconds() const
+{
+    return elapsed_ns_() / 1000;
+}
+
+inline
+monotonic_stopwatch::interval_type
+monotonic_stopwatch::get_nanoseconds() const
+{
+    return elapsed_ns_();
+}
+
+inline
+monotonic_stopwatch::interval_type
+monotonic_stopwatch::stop_get_period_count_and_restart()
+{
+    stop();
+
+    interval_type interval = get_period_count();
+
+    m_start = m_end;
+    m_paused_ns = 0;
+
+    return interval;
+}
+
+inline
+monotonic_stopwatch::interval_type
+monotonic_stopwatch::stop_get_seconds_and_restart()
+{
+    stop();
+
+    interval_type interval = get_seconds();
+
+    m_start = m_end;
+    m_paused_ns = 0;
+
+    return interval;
+}
+
+inline
+monotonic_stopwatch::interval_type
+monotonic_stopwatch::stop_get_milliseconds_and_restart()
+{
+    stop();
+
+    interval_type interval = get_milliseconds();
+
+    m_start = m_end;
+    m_paused_ns = 0;
+
+    return interval;
+}
+
+inline
+monotonic_stopwatch::interval_type
+monotonic_stopwatch::stop_get_microseconds_and_restart()
+{
+    stop();
+
+    interval_type interval = get_microseconds();
+
+    m_start = m_end;
+    m_paused_ns = 0;
+
+    return interval;
+}
+
+inline
+monotonic_stopwatch::interval_type
+monotonic_stopwatch::stop_get_nanoseconds_and_restart()
+{
+    stop();
+
+    interval_type interval = get_nanoseconds();
+
+    m_start = m_end;
+    m_paused_ns = 0;
+
+    return interval;
+}
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+
+/* ////////////////////////////////////////////////////////////////////// */
+
+#ifndef UNIXSTL_NO_NAMESPACE
+# if defined(STLSOFT_NO_NAMESPACE) || \
+     defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+} /* namespace unixstl */
+# else
+} /* namespace unixstl_project */
+} /* namespace stlsoft */
+# endif /* STLSOFT_NO_NAMESPACE */
+#endif /* !UNIXSTL_NO_NAMESPACE */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !UNIXSTL_INCL_UNIXSTL_DIAGNOSTICS_HPP_MONOTONIC_STOPWATCH */
+
+/* ///////////////////////////// end of file //////////////////////////// */
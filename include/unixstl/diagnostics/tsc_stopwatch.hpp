@@ -0,0 +1,673 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    unixstl/diagnostics/tsc_stopwatch.hpp
+ *
+ * Purpose: tsc_stopwatch class.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * Home:    http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/** \file unixstl/diagnostics/tsc_stopwatch.hpp
+ *
+ * \brief [C++] Definition of the
+ *  \link unixstl::tsc_stopwatch tsc_stopwatch\endlink class
+ *   (\ref group__library__Diagnostic "Diagnostic" Library).
+ */
+
+#ifndef UNIXSTL_INCL_UNIXSTL_DIAGNOSTICS_HPP_TSC_STOPWATCH
+#define UNIXSTL_INCL_UNIXSTL_DIAGNOSTICS_HPP_TSC_STOPWATCH
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define UNIXSTL_VER_UNIXSTL_DIAGNOSTICS_HPP_TSC_STOPWATCH_MAJOR    1
+# define UNIXSTL_VER_UNIXSTL_DIAGNOSTICS_HPP_TSC_STOPWATCH_MINOR    0
+# define UNIXSTL_VER_UNIXSTL_DIAGNOSTICS_HPP_TSC_STOPWATCH_REVISION 0
+# define UNIXSTL_VER_UNIXSTL_DIAGNOSTICS_HPP_TSC_STOPWATCH_EDIT     1
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef UNIXSTL_INCL_UNIXSTL_H_UNIXSTL
+# include <unixstl/unixstl.h>
+#endif /* !UNIXSTL_INCL_UNIXSTL_H_UNIXSTL */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+#if !defined(__GNUC__) || \
+    (   !defined(__i386__) && \
+        !defined(__x86_64__))
+# error unixstl/diagnostics/tsc_stopwatch.hpp is only supported by GCC-compatible compilers on x86 and x86-64 architectures
+#endif /* compiler / architecture */
+
+#ifndef UNIXSTL_INCL_UNIXSTL_DIAGNOSTICS_HPP_MONOTONIC_STOPWATCH
+# include <unixstl/diagnostics/monotonic_stopwatch.hpp>
+#endif /* !UNIXSTL_INCL_UNIXSTL_DIAGNOSTICS_HPP_MONOTONIC_STOPWATCH */
+
+#include <cpuid.h>
+#include <x86intrin.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#ifndef UNIXSTL_TSC_STOPWATCH_CALIBRATION_MS
+# define UNIXSTL_TSC_STOPWATCH_CALIBRATION_MS                   10
+#endif /* !UNIXSTL_TSC_STOPWATCH_CALIBRATION_MS */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef UNIXSTL_NO_NAMESPACE
+# if defined(STLSOFT_NO_NAMESPACE) || \
+     defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+/* There is no stlsoft namespace, so must define ::unixstl */
+namespace unixstl
+{
+# else
+/* Define stlsoft::unixstl_project */
+namespace stlsoft
+{
+namespace unixstl_project
+{
+# endif /* STLSOFT_NO_NAMESPACE */
+#endif /* !UNIXSTL_NO_NAMESPACE */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * classes
+ */
+
+/** A stopwatch using the processor's time-stamp counter
+ *
+ * \ingroup group__library__Diagnostic
+ *
+ * This class provides very low overhead performance monitoring based
+ * around the x86 \c RDTSC / \c RDTSCP instructions, and has the same
+ * interface as \link unixstl::stopwatch stopwatch\endlink. The counter is
+ * calibrated - once per process, on first use - against
+ * \link unixstl::monotonic_stopwatch monotonic_stopwatch\endlink, and
+ * counts are converted to nanoseconds by a fixed-point multiplication.
+ *
+ * The start of a measurement is fenced by \c LFENCE, so that it is not
+ * taken before preceding instructions complete, and the end is taken with
+ * \c RDTSCP (followed by \c LFENCE), so that it is not taken before the
+ * measured instructions complete.
+ *
+ * \note Meaningful timings require an invariant time-stamp counter, which
+ *  is provided by all recent processors (see is_invariant()). Where it is
+ *  not, use \link unixstl::monotonic_stopwatch monotonic_stopwatch\endlink.
+ *
+ * \note Define the pre-processor symbol
+ *  <code>UNIXSTL_TSC_STOPWATCH_NO_USE_RDTSCP</code> for processors (or
+ *  virtual machines) that do not support the \c RDTSCP instruction, and
+ *  <code>UNIXSTL_TSC_STOPWATCH_CALIBRATION_MS</code> to change the
+ *  calibration period (default 10ms).
+ */
+class tsc_stopwatch
+{
+public: // types
+    /// The epoch type
+    ///
+    /// The type of the epoch measurement, a 64-bit unsigned integer count
+    /// of time-stamp counter ticks.
+    typedef us_uint64_t                                     epoch_type;
+    /// The interval type
+    ///
+    /// The type of the interval measurement, a 64-bit signed integer
+    typedef us_sint64_t                                     interval_type;
+    /// The class type
+    typedef tsc_stopwatch                                   class_type;
+
+
+public: // construction
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+    tsc_stopwatch() // This is needed only to suppress compiler warnings about unused variables
+        : m_start(0)
+        , m_end(0)
+        , m_pause(0)
+        , m_paused_ticks(0)
+    {}
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+
+public: // operations
+    /// Starts measurement
+    ///
+    /// Begins the measurement period
+    void    start();
+    /// Pauses the measurement
+    ///
+    void    pause();
+    /// Unpauses the measurement
+    ///
+    void    unpause();
+    /// Ends measurement
+    ///
+    /// Ends the measurement period
+    void    stop();
+    /// Ends the current measurement period and start the next
+    ///
+    /// \remarks This is equivalent to an atomic invocation of stop() and
+    ///  start()
+    void    restart();
+
+
+public: // attributes
+    /// Indicates whether the processor reports an invariant time-stamp
+    /// counter, i.e. one that runs at a constant rate regardless of
+    /// frequency scaling and power states
+    static bool             is_invariant();
+    /// The (calibrated) number of time-stamp counter ticks per second
+    static interval_type    get_frequency();
+
+    /// The current epoch
+    static epoch_type       get_epoch();
+
+    /// The number of whole seconds in the given measurement period
+    static interval_type    get_seconds(epoch_type start, epoch_type end);
+    /// The number of whole milliseconds in the given measurement period
+    static interval_type    get_milliseconds(epoch_type start, epoch_type end);
+    /// The number of whole microseconds in the given measurement period
+    static interval_type    get_microseconds(epoch_type start, epoch_type end);
+    /// The number of whole nanoseconds in the given measurement period
+    static interval_type    get_nanoseconds(epoch_type start, epoch_type end);
+
+    /// The elapsed count in the measurement period
+    ///
+    /// This represents the extent, in time-stamp counter ticks, of the
+    /// measurement period
+    interval_type   get_period_count() const;
+    /// The number of whole seconds in the measurement period
+    ///
+    /// This represents the extent, in whole seconds, of the measurement
+    /// period
+    interval_type   get_seconds() const;
+    /// The number of whole milliseconds in the measurement period
+    ///
+    /// This represents the extent, in whole milliseconds, of the
+    /// measurement period
+    interval_type   get_milliseconds() const;
+    /// The number of whole microseconds in the measurement period
+    ///
+    /// This represents the extent, in whole microseconds, of the
+    /// measurement period
+    interval_type   get_microseconds() const;
+    /// The number of whole nanoseconds in the measurement period
+    ///
+    /// This represents the extent, in whole nanoseconds, of the
+    /// measurement period
+    interval_type   get_nanoseconds() const;
+
+    /// Stops the current period, starts the next, and returns the period
+    /// count for the prior period.
+    interval_type   stop_get_period_count_and_restart();
+
+    /// Stops the current period, starts the next, and returns the interval,
+    /// in seconds, for the prior period.
+    interval_type   stop_get_seconds_and_restart();
+
+    /// Stops the current period, starts the next, and returns the interval,
+    /// in milliseconds, for the prior period.
+    interval_type   stop_get_milliseconds_and_restart();
+
+    /// Stops the current period, starts the next, and returns the interval,
+    /// in microseconds, for the prior period.
+    interval_type   stop_get_microseconds_and_restart();
+
+    /// Stops the current period, starts the next, and returns the interval,
+    /// in nanoseconds, for the prior period.
+    interval_type   stop_get_nanoseconds_and_restart();
+
+
+private: // implementation
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+    struct calibration_t
+    {
+        /// nanoseconds-per-tick, in 32.32 fixed-point
+        us_uint64_t     multiplier;
+        /// ticks-per-second
+        interval_type   frequency;
+    };
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+    // reads the counter at the start of a measured period
+    static
+    epoch_type
+    read_start_();
+
+    // reads the counter at the end of a measured period
+    static
+    epoch_type
+    read_stop_();
+
+    static
+    calibration_t
+    calibrate_();
+
+    static
+    calibration_t const&
+    calibration_();
+
+    // converts a number of ticks into nanoseconds
+    static
+    interval_type
+    ticks_to_ns_(
+        us_uint64_t ticks
+    );
+
+    // the (unpaused) ticks in the measurement period
+    us_uint64_t
+    elapsed_ticks_() const;
+
+
+private: // fields
+    /// Stores the start epoch
+    epoch_type      m_start;
+    /// Stores the end epoch
+    epoch_type      m_end;
+    /// Stores the pause epoch
+    epoch_type      m_pause;
+    /// Stores the (cumulate) pause time (in ticks)
+    us_uint64_t     m_paused_ticks;
+};
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * implementation
+ */
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+inline
+/* static */
+tsc_stopwatch::epoch_type
+tsc_stopwatch::read_start_()
+{
+    __asm__ __volatile__("lfence" : : : "memory");
+
+    return __rdtsc();
+}
+
+inline
+/* static */
+tsc_stopwatch::epoch_type
+tsc_stopwatch::read_stop_()
+{
+#ifdef UNIXSTL_TSC_STOPWATCH_NO_USE_RDTSCP
+
+    __asm__ __volatile__("lfence" : : : "memory");
+
+    epoch_type const ticks = __rdtsc();
+#else /* ? UNIXSTL_TSC_STOPWATCH_NO_USE_RDTSCP */
+
+    unsigned int        aux;
+    epoch_type const    ticks = __rdtscp(&aux);
+#endif /* UNIXSTL_TSC_STOPWATCH_NO_USE_RDTSCP */
+
+    __asm__ __volatile__("lfence" : : : "memory");
+
+    return ticks;
+}
+
+inline
+/* static */
+tsc_stopwatch::calibration_t
+tsc_stopwatch::calibrate_()
+{
+    monotonic_stopwatch::interval_type const    period_ns   =   monotonic_stopwatch::interval_type(UNIXSTL_TSC_STOPWATCH_CALIBRATION_MS) * (1000 * 1000);
+    monotonic_stopwatch::epoch_type const       t0          =   monotonic_stopwatch::get_epoch();
+    epoch_type const                            c0          =   read_start_();
+    monotonic_stopwatch::epoch_type             t1;
+
+    do
+    {
+        t1 = monotonic_stopwatch::get_epoch();
+    }
+    while (t1 - t0 < period_ns);
+
+    epoch_type const                            c1          =   read_stop_();
+    us_uint64_t const                           ticks       =   c1 - c0;
+    us_uint64_t const                           ns          =   static_cast<us_uint64_t>(t1 - t0);
+    calibration_t                               calibration;
+
+    if (0 == ticks)
+    {
+        // no counter, so all timed periods will evaluate to 0
+        calibration.multiplier  =   0;
+        calibration.frequency   =   0;
+    }
+    else
+    {
+        calibration.multiplier  =   (ns << 32) / ticks;
+        calibration.frequency   =   static_cast<interval_type>((ticks * 1000000000) / ns);
+    }
+
+    return calibration;
+}
+
+inline
+/* static */
+tsc_stopwatch::calibration_t const&
+tsc_stopwatch::calibration_()
+{
+    static calibration_t const s_calibration = calibrate_();
+
+    return s_calibration;
+}
+
+inline
+/* static */
+tsc_stopwatch::interval_type
+tsc_stopwatch::ticks_to_ns_(
+    us_uint64_t ticks
+)
+{
+    // (ticks * multiplier) >> 32, without overflowing 64-bits
+
+    us_uint64_t const   m   =   calibration_().multiplier;
+    us_uint64_t const   t_h =   ticks >> 32;
+    us_uint64_t const   t_l =   ticks & 0xffffffffu;
+    us_uint64_t const   m_h =   m >> 32;
+    us_uint64_t const   m_l =   m & 0xffffffffu;
+
+    return static_cast<interval_type>(((t_h * m_h) << 32) + t_h * m_l + t_l * m_h + ((t_l * m_l) >> 32));
+}
+
+inline
+us_uint64_t
+tsc_stopwatch::elapsed_ticks_() const
+{
+    UNIXSTL_MESSAGE_ASSERT("end before start: stop() must be called after start()", m_start <= m_end);
+
+    return (m_end - m_start) - m_paused_ticks;
+}
+
+inline
+void
+tsc_stopwatch::start()
+{
+    m_start = read_start_();
+
+    m_end = m_start;
+    m_pause = 0;
+    m_paused_ticks = 0;
+}
+
+inline
+void
+tsc_stopwatch::pause()
+{
+    m_pause = read_stop_();
+}
+
+inline
+void
+tsc_stopwatch::unpause()
+{
+    m_paused_ticks += read_start_() - m_pause;
+}
+
+inline
+void
+tsc_stopwatch::stop()
+{
+    m_end = read_stop_();
+}
+
+inline
+void
+tsc_stopwatch::restart()
+{
+    m_start = read_start_();
+
+    m_end = m_start;
+    m_paused_ticks = 0;
+}
+
+inline
+/* static */
+bool
+tsc_stopwatch::is_invariant()
+{
+    unsigned int eax, ebx, ecx, edx;
+
+    if (__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx))
+    {
+        return 0 != (edx & (1u << 8));
+    }
+
+    return false;
+}
+
+inline
+/* static */
+tsc_stopwatch::interval_type
+tsc_stopwatch::get_frequency()
+{
+    return calibration_().frequency;
+}
+
+inline
+/* static */
+tsc_stopwatch::epoch_type
+tsc_stopwatch::get_epoch()
+{
+    return read_stop_();
+}
+
+inline
+/* static */
+tsc_stopwatch::interval_type
+tsc_stopwatch::get_seconds(
+    tsc_stopwatch::epoch_type   start
+,   tsc_stopwatch::epoch_type   end
+)
+{
+    return get_nanoseconds(start, end) / (1000 * 1000 * 1000);
+}
+
+inline
+/* static */
+tsc_stopwatch::interval_type
+tsc_stopwatch::get_milliseconds(
+    tsc_stopwatch::epoch_type   start
+,   tsc_stopwatch::epoch_type   end
+)
+{
+    return get_nanoseconds(start, end) / (1000 * 1000);
+}
+
+inline
+/* static */
+tsc_stopwatch::interval_type
+tsc_stopwatch::get_microseconds(
+    tsc_stopwatch::epoch_type   start
+,   tsc_stopwatch::epoch_type   end
+)
+{
+    return get_nanoseconds(start, end) / 1000;
+}
+
+inline
+/* static */
+tsc_stopwatch::interval_type
+tsc_stopwatch::get_nanoseconds(
+    tsc_stopwatch::epoch_type   start
+,   tsc_stopwatch::epoch_type   end
+)
+{
+    UNIXSTL_MESSAGE_ASSERT("end before start", start <= end);
+
+    return ticks_to_ns_(end - start);
+}
+
+inline
+tsc_stopwatch::interval_type
+tsc_stopwatch::get_period_count() const
+{
+    return static_cast<interval_type>(elapsed_ticks_());
+}
+
+inline
+tsc_stopwatch::interval_type
+tsc_stopwatch::get_seconds() const
+{
+    return ticks_to_ns_(elapsed_ticks_()) / (1000 * 1000 * 1000);
+}
+
+inline
+tsc_stopwatch::interval_type
+tsc_stopwatch::get_milliseconds() const
+{
+    return ticks_to_ns_(elapsed_ticks_()) / (1000 * 1000);
+}
+
+inline
+tsc_stopwatch::interval_type
+tsc_stopwatch::get_microseconds() const
+{
+    return ticks_to_ns_(elapsed_ticks_()) / 1000;
+}
+
+inline
+tsc_stopwatch::interval_type
+tsc_stopwatch::get_nanoseconds() const
+{
+    return ticks_to_ns_(elapsed_ticks_());
+}
+
+inline
+tsc_stopwatch::interval_type
+tsc_stopwatch::stop_get_period_count_and_restart()
+{
+    stop();
+
+    interval_type interval = get_period_count();
+
+    m_start = m_end;
+    m_paused_ticks = 0;
+
+    return interval;
+}
+
+inline
+tsc_stopwatch::interval_type
+tsc_stopwatch::stop_get_seconds_and_restart()
+{
+    stop();
+
+    interval_type interval = get_seconds();
+
+    m_start = m_end;
+    m_paused_ticks = 0;
+
+    return interval;
+}
+
+inline
+tsc_stopwatch::interval_type
+tsc_stopwatch::stop_get_milliseconds_and_restart()
+{
+    stop();
+
+    interval_type interval = get_milliseconds();
+
+    m_start = m_end;
+    m_paused_ticks = 0;
+
+    return interval;
+}
+
+inline
+tsc_stopwatch::interval_type
+tsc_stopwatch::stop_get_microseconds_and_restart()
+{
+    stop();
+
+    interval_type interval = get_microseconds();
+
+    m_start = m_end;
+    m_paused_ticks = 0;
+
+    return interval;
+}
+
+inline
+tsc_stopwatch::interval_type
+tsc_stopwatch::stop_get_nanoseconds_and_restart()
+{
+    stop();
+
+    interval_type interval = get_nanoseconds();
+
+    m_start = m_end;
+    m_paused_ticks = 0;
+
+    return interval;
+}
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+
+/* ////////////////////////////////////////////////////////////////////// */
+
+#ifndef UNIXSTL_NO_NAMESPACE
+# if defined(STLSOFT_NO_NAMESPACE) || \
+     defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+} /* namespace unixstl */
+# else
+} /* namespace unixstl_project */
+} /* namespace stlsoft */
+# endif /* STLSOFT_NO_NAMESPACE */
+#endif /* !UNIXSTL_NO_NAMESPACE */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !UNIXSTL_INCL_UNIXSTL_DIAGNOSTICS_HPP_TSC_STOPWATCH */
+
+/* ///////////////////////////// end of file //////////////////////////// */
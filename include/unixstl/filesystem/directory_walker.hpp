@@ -0,0 +1,1547 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    unixstl/filesystem/directory_walker.hpp
+ *
+ * Purpose: directory_walker class, for parallel recursive directory traversal.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * Home:    http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+
+
+/* STLSOFT:C++98:FILE_EXCEPTED */
+/* STLSOFT:C++03:FILE_EXCEPTED */
+
+/** \file unixstl/filesystem/directory_walker.hpp
+ *
+ * \brief [C++] Definition of the unixstl::directory_walker class
+ *   (\ref group__library__FileSystem "File System" Library).
+ */
+
+#ifndef UNIXSTL_INCL_UNIXSTL_FILESYSTEM_HPP_DIRECTORY_WALKER
+#define UNIXSTL_INCL_UNIXSTL_FILESYSTEM_HPP_DIRECTORY_WALKER
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define UNIXSTL_VER_UNIXSTL_FILESYSTEM_HPP_DIRECTORY_WALKER_MAJOR      1
+# define UNIXSTL_VER_UNIXSTL_FILESYSTEM_HPP_DIRECTORY_WALKER_MINOR      0
+# define UNIXSTL_VER_UNIXSTL_FILESYSTEM_HPP_DIRECTORY_WALKER_REVISION   0
+# define UNIXSTL_VER_UNIXSTL_FILESYSTEM_HPP_DIRECTORY_WALKER_EDIT       1
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef UNIXSTL_INCL_UNIXSTL_H_UNIXSTL
+# include <unixstl/unixstl.h>
+#endif /* !UNIXSTL_INCL_UNIXSTL_H_UNIXSTL */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+#ifndef UNIXSTL_INCL_UNIXSTL_FILESYSTEM_HPP_FILESYSTEM_TRAITS
+# include <unixstl/filesystem/filesystem_traits.hpp>
+#endif /* !UNIXSTL_INCL_UNIXSTL_FILESYSTEM_HPP_FILESYSTEM_TRAITS */
+#ifndef UNIXSTL_INCL_UNIXSTL_HPP_EXCEPTION_UNIXSTL_EXCEPTION
+# include <unixstl/exception/unixstl_exception.hpp>
+#endif /* !UNIXSTL_INCL_UNIXSTL_HPP_EXCEPTION_UNIXSTL_EXCEPTION */
+#ifndef STLSOFT_INCL_STLSOFT_SHIMS_ACCESS_STRING_H_FWD
+# include <stlsoft/shims/access/string/fwd.h>
+#endif /* !STLSOFT_INCL_STLSOFT_SHIMS_ACCESS_STRING_H_FWD */
+#ifndef STLSOFT_INCL_STLSOFT_SHIMS_ACCESS_STRING_STD_HPP_BASIC_STRING
+# include <stlsoft/shims/access/string/std/basic_string.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_SHIMS_ACCESS_STRING_STD_HPP_BASIC_STRING */
+
+#ifndef STLSOFT_INCL_ATOMIC
+# define STLSOFT_INCL_ATOMIC
+# include <atomic>
+#endif /* !STLSOFT_INCL_ATOMIC */
+#ifndef STLSOFT_INCL_CONDITION_VARIABLE
+# define STLSOFT_INCL_CONDITION_VARIABLE
+# include <condition_variable>
+#endif /* !STLSOFT_INCL_CONDITION_VARIABLE */
+#ifndef STLSOFT_INCL_DEQUE
+# define STLSOFT_INCL_DEQUE
+# include <deque>
+#endif /* !STLSOFT_INCL_DEQUE */
+#ifndef STLSOFT_INCL_EXCEPTION
+# define STLSOFT_INCL_EXCEPTION
+# include <exception>
+#endif /* !STLSOFT_INCL_EXCEPTION */
+#ifndef STLSOFT_INCL_FUNCTIONAL
+# define STLSOFT_INCL_FUNCTIONAL
+# include <functional>
+#endif /* !STLSOFT_INCL_FUNCTIONAL */
+#ifndef STLSOFT_INCL_MEMORY
+# define STLSOFT_INCL_MEMORY
+# include <memory>
+#endif /* !STLSOFT_INCL_MEMORY */
+#ifndef STLSOFT_INCL_MUTEX
+# define STLSOFT_INCL_MUTEX
+# include <mutex>
+#endif /* !STLSOFT_INCL_MUTEX */
+#ifndef STLSOFT_INCL_SET
+# define STLSOFT_INCL_SET
+# include <set>
+#endif /* !STLSOFT_INCL_SET */
+#ifndef STLSOFT_INCL_STRING
+# define STLSOFT_INCL_STRING
+# include <string>
+#endif /* !STLSOFT_INCL_STRING */
+#ifndef STLSOFT_INCL_SYSTEM_ERROR
+# define STLSOFT_INCL_SYSTEM_ERROR
+# include <system_error>
+#endif /* !STLSOFT_INCL_SYSTEM_ERROR */
+#ifndef STLSOFT_INCL_THREAD
+# define STLSOFT_INCL_THREAD
+# include <thread>
+#endif /* !STLSOFT_INCL_THREAD */
+#ifndef STLSOFT_INCL_UTILITY
+# define STLSOFT_INCL_UTILITY
+# include <utility>
+#endif /* !STLSOFT_INCL_UTILITY */
+#ifndef STLSOFT_INCL_VECTOR
+# define STLSOFT_INCL_VECTOR
+# include <vector>
+#endif /* !STLSOFT_INCL_VECTOR */
+
+#ifndef STLSOFT_INCL_H_ERRNO
+# define STLSOFT_INCL_H_ERRNO
+# include <errno.h>
+#endif /* !STLSOFT_INCL_H_ERRNO */
+#ifndef STLSOFT_INCL_H_UNISTD
+# define STLSOFT_INCL_H_UNISTD
+# include <unistd.h>
+#endif /* !STLSOFT_INCL_H_UNISTD */
+#ifndef STLSOFT_INCL_SYS_H_TYPES
+# define STLSOFT_INCL_SYS_H_TYPES
+# include <sys/types.h>
+#endif /* !STLSOFT_INCL_SYS_H_TYPES */
+#ifndef STLSOFT_INCL_SYS_H_STAT
+# define STLSOFT_INCL_SYS_H_STAT
+# include <sys/stat.h>
+#endif /* !STLSOFT_INCL_SYS_H_STAT */
+#ifndef STLSOFT_INCL_H_DIRENT
+# define STLSOFT_INCL_H_DIRENT
+# include <dirent.h>
+#endif /* !STLSOFT_INCL_H_DIRENT */
+#ifndef STLSOFT_INCL_H_FCNTL
+# define STLSOFT_INCL_H_FCNTL
+# include <fcntl.h>
+#endif /* !STLSOFT_INCL_H_FCNTL */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef UNIXSTL_NO_NAMESPACE
+# if defined(STLSOFT_NO_NAMESPACE) || \
+     defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+/* There is no stlsoft namespace, so must define ::unixstl */
+namespace unixstl
+{
+# else
+/* Define stlsoft::unixstl_project */
+namespace stlsoft
+{
+namespace unixstl_project
+{
+# endif /* STLSOFT_NO_NAMESPACE */
+#endif /* !UNIXSTL_NO_NAMESPACE */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * classes
+ */
+
+/** Exception class thrown by unixstl::directory_walker.
+ *
+ * \ingroup group__library__FileSystem
+ */
+class directory_walker_exception
+    : public unixstl_exception
+{
+/// \name Types
+/// @{
+public:
+    typedef unixstl_exception                               parent_class_type;
+    typedef directory_walker_exception                      class_type;
+    typedef parent_class_type::string_type                  string_type;
+/// @}
+
+/// \name Construction
+/// @{
+public:
+    directory_walker_exception(us_char_a_t const* message, us_int_t erno, us_char_a_t const* directory)
+        : parent_class_type(message, erno)
+        , Directory(directory)
+    {}
+    ~directory_walker_exception() STLSOFT_NOEXCEPT
+    {}
+    directory_walker_exception(class_type const&) = default;
+    class_type& operator =(class_type const&) = default;
+/// @}
+
+/// \name Fields
+/// @{
+public:
+    /// The name of this field is subject to change in a future revision
+    string_type const   Directory;
+/// @}
+};
+
+
+/** An entry found by unixstl::directory_walker.
+ *
+ * \ingroup group__library__FileSystem
+ */
+class directory_walker_entry
+{
+/// \name Member Types
+/// @{
+public:
+    /// This class
+    typedef directory_walker_entry                          class_type;
+    /// The size type
+    typedef us_size_t                                       size_type;
+    /// The string type
+    typedef std::string                                     string_type;
+/// @}
+
+/// \name Construction
+/// @{
+public:
+    directory_walker_entry()
+        : m_path()
+        , m_nameOffset(0)
+        , m_depth(0)
+        , m_type(0)
+        , m_isLink(false)
+    {}
+/// @}
+
+/// \name Attributes
+/// @{
+public:
+    /// The path of the entry, which is the root directory passed to the
+    /// walker followed by the names of each directory descended
+    string_type const&  path() const STLSOFT_NOEXCEPT
+    {
+        return m_path;
+    }
+    /// The name of the entry within its directory
+    us_char_a_t const*  name() const STLSOFT_NOEXCEPT
+    {
+        return m_path.c_str() + m_nameOffset;
+    }
+    /// The depth of the entry, where entries in the root directory are at
+    /// depth 1
+    size_type           depth() const STLSOFT_NOEXCEPT
+    {
+        return m_depth;
+    }
+    /// The type of the entry, as one of the \c S_IFMT values, e.g.
+    /// \c S_IFREG
+    ///
+    /// \note For a symbolic link that is followed this is the type of the
+    ///   entry to which it refers; otherwise it is \c S_IFLNK
+    mode_t              type() const STLSOFT_NOEXCEPT
+    {
+        return m_type;
+    }
+    /// Indicates whether the entry is a directory
+    us_bool_t           is_directory() const STLSOFT_NOEXCEPT
+    {
+        return S_IFDIR == m_type;
+    }
+    /// Indicates whether the entry is a regular file
+    us_bool_t           is_file() const STLSOFT_NOEXCEPT
+    {
+        return S_IFREG == m_type;
+    }
+    /// Indicates whether the entry is a symbolic link, whether or not it
+    /// was followed
+    us_bool_t           is_link() const STLSOFT_NOEXCEPT
+    {
+        return m_isLink || S_IFLNK == m_type;
+    }
+/// @}
+
+/// \name Members
+/// @{
+private:
+    friend class directory_walker;
+
+    string_type m_path;
+    size_type   m_nameOffset;
+    size_type   m_depth;
+    mode_t      m_type;
+    us_bool_t   m_isLink;
+/// @}
+};
+
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+namespace ximpl_directory_walker {
+
+    /* Maps `dirent::d_type` to the corresponding `S_IFMT` value, or 0 when
+     * the type is not available.
+     */
+    inline
+    mode_t
+    mode_from_entry(
+        struct dirent const* entry
+    ) STLSOFT_NOEXCEPT
+    {
+#if defined(_DIRENT_HAVE_D_TYPE) || \
+    defined(DT_UNKNOWN)
+
+        switch (entry->d_type)
+        {
+        case DT_DIR:    return S_IFDIR;
+        case DT_REG:    return S_IFREG;
+        case DT_LNK:    return S_IFLNK;
+# ifdef DT_SOCK
+        case DT_SOCK:   return S_IFSOCK;
+# endif /* DT_SOCK */
+# ifdef DT_FIFO
+        case DT_FIFO:   return S_IFIFO;
+# endif /* DT_FIFO */
+# ifdef DT_CHR
+        case DT_CHR:    return S_IFCHR;
+# endif /* DT_CHR */
+# ifdef DT_BLK
+        case DT_BLK:    return S_IFBLK;
+# endif /* DT_BLK */
+        default:        return 0;
+        }
+#else
+
+        STLSOFT_SUPPRESS_UNUSED(entry);
+
+        return 0;
+#endif
+    }
+
+    /* The flags with which directories are opened */
+    inline
+    int
+    open_flags(
+        bool followLinks
+    ) STLSOFT_NOEXCEPT
+    {
+        int flags = O_RDONLY;
+
+#ifdef O_DIRECTORY
+        flags |= O_DIRECTORY;
+#endif /* O_DIRECTORY */
+#ifdef O_CLOEXEC
+        flags |= O_CLOEXEC;
+#endif /* O_CLOEXEC */
+#ifdef O_NOFOLLOW
+        if (!followLinks)
+        {
+            flags |= O_NOFOLLOW;
+        }
+#else /* ? O_NOFOLLOW */
+        STLSOFT_SUPPRESS_UNUSED(followLinks);
+#endif /* O_NOFOLLOW */
+
+        return flags;
+    }
+
+    /* Closes a file descriptor on scope exit, unless it is released. */
+    class descriptor_guard
+    {
+    public:
+        explicit descriptor_guard(int fd) STLSOFT_NOEXCEPT
+            : m_fd(fd)
+        {}
+        ~descriptor_guard() STLSOFT_NOEXCEPT
+        {
+            if (m_fd >= 0)
+            {
+                ::close(m_fd);
+            }
+        }
+    private:
+        descriptor_guard(descriptor_guard const&) STLSOFT_COPY_CONSTRUCTION_PROSCRIBED;
+        void operator =(descriptor_guard const&) STLSOFT_COPY_ASSIGNMENT_PROSCRIBED;
+
+    public:
+        void release() STLSOFT_NOEXCEPT
+        {
+            m_fd = -1;
+        }
+
+    private:
+        int m_fd;
+    };
+
+    /* An open directory, shared by the tasks of its subdirectories so that
+     * they may be opened relative to it.
+     */
+    class directory_handle
+    {
+    public:
+        explicit directory_handle(DIR* dir) STLSOFT_NOEXCEPT
+            : m_dir(dir)
+        {}
+        ~directory_handle() STLSOFT_NOEXCEPT
+        {
+            ::closedir(m_dir);
+        }
+    private:
+        directory_handle(directory_handle const&) STLSOFT_COPY_CONSTRUCTION_PROSCRIBED;
+        void operator =(directory_handle const&) STLSOFT_COPY_ASSIGNMENT_PROSCRIBED;
+
+    public:
+        DIR* get() const STLSOFT_NOEXCEPT
+        {
+            return m_dir;
+        }
+        int fd() const STLSOFT_NOEXCEPT
+        {
+            return ::dirfd(m_dir);
+        }
+
+    private:
+        DIR* const m_dir;
+    };
+
+    /* A directory to be enumerated. */
+    struct task
+    {
+        std::shared_ptr<directory_handle>   parent; // NULL for the root
+        std::string                         path;
+        us_size_t                           nameOffset;
+        us_size_t                           depth;
+        bool                                isLink;
+        int                                 fd;     // open descriptor, for the root, or -1
+    };
+
+    /* A worker's deque of tasks. The owner takes from the back, so each
+     * worker proceeds depth-first (which bounds the number of directories
+     * held open), and thieves take from the front, where the tasks nearest
+     * the root, and so representing the most work, are found.
+     */
+    struct task_deque
+    {
+        std::mutex          mx;
+        std::deque<task>    tasks;
+    };
+
+    /* A bounded multi-producer queue, by which entries are delivered when
+     * the walker is iterated.
+     */
+    template <ss_typename_param_k T>
+    class bounded_queue
+    {
+    public:
+        explicit bounded_queue(us_size_t capacity)
+            : m_capacity(capacity)
+            , m_closed(false)
+        {}
+    private:
+        bounded_queue(bounded_queue const&) STLSOFT_COPY_CONSTRUCTION_PROSCRIBED;
+        void operator =(bounded_queue const&) STLSOFT_COPY_ASSIGNMENT_PROSCRIBED;
+
+    public:
+        // Blocks while full. Returns false if the queue is closed
+        bool push(T const& item)
+        {
+            std::unique_lock<std::mutex> lock(m_mx);
+
+            m_notFull.wait(lock, [this] { return m_closed || m_items.size() < m_capacity; });
+
+            if (m_closed)
+            {
+                return false;
+            }
+
+            m_items.push_back(item);
+
+            lock.unlock();
+
+            m_notEmpty.notify_one();
+
+            return true;
+        }
+
+        // Blocks while empty and not closed. Returns false if the queue is
+        // empty and closed
+        bool pop(T& item)
+        {
+            std::unique_lock<std::mutex> lock(m_mx);
+
+            m_notEmpty.wait(lock, [this] { return m_closed || !m_items.empty(); });
+
+            if (m_items.empty())
+            {
+                return false;
+            }
+
+            item = std::move(m_items.front());
+            m_items.pop_front();
+
+            lock.unlock();
+
+            m_notFull.notify_one();
+
+            return true;
+        }
+
+        void close()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mx);
+
+                m_closed = true;
+            }
+
+            m_notEmpty.notify_all();
+            m_notFull.notify_all();
+        }
+
+    private:
+        std::mutex              m_mx;
+        std::condition_variable m_notEmpty;
+        std::condition_variable m_notFull;
+        std::deque<T>           m_items;
+        us_size_t const         m_capacity;
+        bool                    m_closed;
+    };
+
+} // namespace ximpl_directory_walker
+
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+
+/** Parallel recursive directory traversal.
+ *
+ * \ingroup group__library__FileSystem
+ *
+ * The directory tree is walked by a pool of threads, each of which takes
+ * directories from its own deque and, when that is empty, steals them from
+ * those of the others. Directories are opened with \c openat() relative to
+ * their (still open) parent, so paths are not resolved repeatedly from the
+ * root, and entries are classified from \c dirent::d_type where available,
+ * and otherwise with \c fstatat().
+ *
+ * Entries may be delivered to a callback:
+ *
+\code
+  unixstl::directory_walker walker(unixstl::directory_walker::files);
+
+  std::atomic<size_t> n(0);
+
+  walker.walk("/usr", [&](unixstl::directory_walker_entry const& entry) {
+
+    ++n;
+  });
+\endcode
+ *
+ * in which case the callback is invoked concurrently from the walking
+ * threads; or they may be obtained, on one thread, from a bounded queue:
+ *
+\code
+  unixstl::directory_walker         walker;
+  unixstl::directory_walker_entry   entry;
+
+  walker.start("/usr");
+
+  while (walker.next(entry))
+  {
+    std::cout << entry.path() << std::endl;
+  }
+\endcode
+ *
+ * The order in which entries are delivered is unspecified.
+ *
+ * Unless \c followLinks is specified, symbolic links are not followed, and
+ * are delivered (if \c links is specified) as type \c S_IFLNK. When it is
+ * specified, links are delivered as the type of what they refer to (if it
+ * exists) and links to directories are descended; each directory is then
+ * descended at most once, so that cycles are not followed.
+ */
+class directory_walker
+{
+/// \name Member Types
+/// @{
+public:
+    /// This class
+    typedef directory_walker                                class_type;
+    /// The entry type
+    typedef directory_walker_entry                          entry_type;
+    /// The size type
+    typedef us_size_t                                       size_type;
+    /// The flags type
+    typedef us_int_t                                        flags_type;
+    /// The callback type, by which entries are delivered by walk()
+    typedef std::function<void (entry_type const&)>         callback_type;
+    /// The filter type. An entry for which the filter returns \c false is
+    /// not delivered and, if a directory, not descended
+    typedef std::function<bool (entry_type const&)>         filter_type;
+    /// The error handler type, which receives the path of an entry that
+    /// could not be examined or a directory that could not be enumerated,
+    /// and the error code
+    typedef std::function<void (us_char_a_t const* path, int err)> error_handler_type;
+private:
+    typedef filesystem_traits<us_char_a_t>                  traits_type;
+    typedef ximpl_directory_walker::task                    task_type_;
+    typedef ximpl_directory_walker::task_deque              task_deque_type_;
+    typedef ximpl_directory_walker::directory_handle        directory_handle_type_;
+    typedef ximpl_directory_walker::bounded_queue<
+        entry_type
+    >                                                       queue_type_;
+    struct walk_state_;
+/// @}
+
+/// \name Member Constants
+/// @{
+public:
+    enum
+    {
+            directories     =   0x0010  /*!< Causes directories to be delivered */
+        ,   files           =   0x0020  /*!< Causes regular files to be delivered */
+        ,   links           =   0x0040  /*!< Causes symbolic links that are not followed (including dangling links) to be delivered */
+        ,   others          =   0x0080  /*!< Causes FIFOs, sockets, and devices to be delivered */
+        ,   typeMask        =   0x00f0
+        ,   followLinks     =   0x1000  /*!< Causes symbolic links to be followed */
+    };
+/// @}
+
+/// \name Construction
+/// @{
+public:
+    /// Constructs a walker
+    ///
+    /// \param flags Flags to alter the behaviour of the walk. If none of
+    ///   the entry type flags is specified, then \c directories and
+    ///   \c files are used
+    /// \param numThreads The number of threads with which to walk. If 0,
+    ///   the number of hardware threads is used
+    ss_explicit_k
+    directory_walker(
+        flags_type  flags       =   directories | files
+    ,   size_type   numThreads  =   0
+    )
+        : m_flags(validate_flags_(flags))
+        , m_numThreads(validate_num_threads_(numThreads))
+        , m_maxDepth(0)
+        , m_queueCapacity(1024)
+        , m_filter()
+        , m_errorHandler()
+        , m_state()
+        , m_threads()
+    {}
+    /// Cancels any iteration in progress
+    ~directory_walker() STLSOFT_NOEXCEPT
+    {
+        stop();
+    }
+private:
+    directory_walker(class_type const&) STLSOFT_COPY_CONSTRUCTION_PROSCRIBED;
+    void operator =(class_type const&) STLSOFT_COPY_ASSIGNMENT_PROSCRIBED;
+/// @}
+
+/// \name Configuration
+/// @{
+public:
+    /// Limits the depth of the walk, such that entries deeper than
+    /// \c maxDepth are not visited. 0 - the default - means unlimited
+    class_type& set_max_depth(size_type maxDepth) STLSOFT_NOEXCEPT
+    {
+        m_maxDepth = maxDepth;
+
+        return *this;
+    }
+    /// Sets the filter, which is invoked concurrently from the walking
+    /// threads
+    class_type& set_filter(filter_type filter)
+    {
+        m_filter = std::move(filter);
+
+        return *this;
+    }
+    /// Sets the error handler, which is invoked concurrently from the
+    /// walking threads. By default, errors are ignored
+    class_type& set_error_handler(error_handler_type errorHandler)
+    {
+        m_errorHandler = std::move(errorHandler);
+
+        return *this;
+    }
+    /// Sets the capacity of the queue by which entries are delivered to
+    /// next(). The walking threads block while it is full
+    class_type& set_queue_capacity(size_type capacity) STLSOFT_NOEXCEPT
+    {
+        m_queueCapacity = (0 == capacity) ? 1 : capacity;
+
+        return *this;
+    }
+/// @}
+
+/// \name Operations
+/// @{
+public:
+    /// Walks the tree from the given root directory, delivering each entry
+    /// to the callback, and returns when the walk is complete
+    ///
+    /// \param root The root directory. It is always followed, even if a
+    ///   symbolic link
+    /// \param callback The callback, which is invoked concurrently from the
+    ///   walking threads (of which the calling thread is one)
+    ///
+    /// \return The number of entries delivered
+    ///
+    /// \exception directory_walker_exception Thrown if the root directory
+    ///   cannot be opened
+    ///
+    /// \note Should the callback or the filter throw an exception, the walk
+    ///   is abandoned and the (first) exception is rethrown
+    template <ss_typename_param_k S>
+    size_type walk(S const& root, callback_type callback)
+    {
+        STLSOFT_NS_USING(c_str_ptr);
+
+        return walk_(c_str_ptr(root), std::move(callback));
+    }
+
+    /// Begins a walk from the given root directory, the entries of which
+    /// are obtained by calling next()
+    ///
+    /// \exception directory_walker_exception Thrown if the root directory
+    ///   cannot be opened
+    template <ss_typename_param_k S>
+    void start(S const& root)
+    {
+        STLSOFT_NS_USING(c_str_ptr);
+
+        start_(c_str_ptr(root));
+    }
+
+    /// Obtains the next entry of the walk begun by start(), blocking until
+    /// one is available
+    ///
+    /// \retval true An entry was obtained
+    /// \retval false The walk is complete (or was not started)
+    ///
+    /// \note Should the filter throw an exception, the walk is abandoned and
+    ///   the (first) exception is rethrown
+    bool next(entry_type& entry);
+
+    /// Abandons the walk begun by start(), if any
+    void stop() STLSOFT_NOEXCEPT;
+/// @}
+
+/// \name Attributes
+/// @{
+public:
+    /// The flags used by the walker
+    flags_type get_flags() const STLSOFT_NOEXCEPT
+    {
+        return m_flags;
+    }
+    /// The number of threads with which the walker walks
+    size_type num_threads() const STLSOFT_NOEXCEPT
+    {
+        return m_numThreads;
+    }
+/// @}
+
+/// \name Implementation
+/// @{
+private:
+    static flags_type   validate_flags_(flags_type flags) STLSOFT_NOEXCEPT;
+    static size_type    validate_num_threads_(size_type numThreads) STLSOFT_NOEXCEPT;
+
+    std::unique_ptr<walk_state_> make_state_(us_char_a_t const* root, std::function<bool (entry_type const&)> sink) const;
+    size_type   walk_(us_char_a_t const* root, callback_type callback);
+    void        start_(us_char_a_t const* root);
+
+    static void run_(walk_state_& state, size_type index);
+    static bool acquire_(walk_state_& state, size_type index, task_type_& task);
+    static void push_(walk_state_& state, size_type index, task_type_&& task);
+    static void process_(walk_state_& state, size_type index, task_type_& task, entry_type& entry);
+    static void cancel_(walk_state_& state);
+    static void forgo_workers_(walk_state_& state, size_type n) STLSOFT_NOEXCEPT;
+    static void report_error_(walk_state_& state, us_char_a_t const* path, int err);
+/// @}
+
+/// \name Members
+/// @{
+private:
+    flags_type const                m_flags;
+    size_type const                 m_numThreads;
+    size_type                       m_maxDepth;
+    size_type                       m_queueCapacity;
+    filter_type                     m_filter;
+    error_handler_type              m_errorHandler;
+    std::unique_ptr<walk_state_>    m_state;
+    std::vector<std::thread>        m_threads;
+/// @}
+};
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * implementation
+ */
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+// directory_walker::walk_state_
+
+struct directory_walker::walk_state_
+{
+    typedef std::pair<dev_t, ino_t>                         file_id_type;
+
+    walk_state_(
+        flags_type                              flags
+    ,   size_type                               numThreads
+    ,   size_type                               maxDepth
+    ,   filter_type const&                      filter
+    ,   error_handler_type const&               errorHandler
+    ,   std::function<bool (entry_type const&)> sink
+    )
+        : flags(flags)
+        , maxDepth(maxDepth)
+        , filter(filter)
+        , errorHandler(errorHandler)
+        , sink(std::move(sink))
+        , deques(numThreads)
+        , numPending(0)
+        , numQueued(0)
+        , numIdle(0)
+        , numRunning(numThreads)
+        , numDelivered(0)
+        , cancelled(false)
+    {
+        for (auto& d : deques)
+        {
+            d.reset(new task_deque_type_());
+        }
+    }
+    ~walk_state_() STLSOFT_NOEXCEPT
+    {
+        // the root is opened before the walk, so may yet be unprocessed if
+        // the walk was abandoned
+
+        for (auto& d : deques)
+        {
+            for (auto& t : d->tasks)
+            {
+                if (t.fd >= 0)
+                {
+                    ::close(t.fd);
+                }
+            }
+        }
+    }
+
+    flags_type const                                flags;
+    size_type const                                 maxDepth;
+    filter_type const                               filter;
+    error_handler_type const                        errorHandler;
+    std::function<bool (entry_type const&)> const   sink;
+    std::unique_ptr<queue_type_>                    queue;      // only when iterating
+
+    std::vector<std::unique_ptr<task_deque_type_> > deques;
+    std::atomic<size_type>                          numPending; // tasks queued or in progress
+    std::atomic<size_type>                          numQueued;  // tasks in the deques
+    std::atomic<size_type>                          numIdle;
+    std::atomic<size_type>                          numRunning;
+    std::atomic<size_type>                          numDelivered;
+    std::atomic<bool>                               cancelled;
+    std::mutex                                      idleMx;
+    std::condition_variable                         idleCv;
+
+    std::mutex                                      exceptionMx;
+    std::exception_ptr                              exception;
+
+    std::mutex                                      visitedMx;
+    std::set<file_id_type>                          visited;    // only when following links
+};
+
+
+// directory_walker
+
+inline
+/* static */
+directory_walker::flags_type
+directory_walker::validate_flags_(
+    directory_walker::flags_type flags
+) STLSOFT_NOEXCEPT
+{
+    const flags_type    validFlags  =   0
+                                    |   directories
+                                    |   files
+                                    |   links
+                                    |   others
+                                    |   followLinks
+                                    |   0;
+
+    UNIXSTL_MESSAGE_ASSERT("Specification of unrecognised/unsupported flags", flags == (flags & validFlags));
+    STLSOFT_SUPPRESS_UNUSED(validFlags);
+
+    if (0 == (flags & typeMask))
+    {
+        flags |= (directories | files);
+    }
+
+    return flags;
+}
+
+inline
+/* static */
+directory_walker::size_type
+directory_walker::validate_num_threads_(
+    directory_walker::size_type numThreads
+) STLSOFT_NOEXCEPT
+{
+    if (0 == numThreads)
+    {
+        numThreads = std::thread::hardware_concurrency();
+    }
+
+    return (0 == numThreads) ? 1 : numThreads;
+}
+
+inline
+std::unique_ptr<directory_walker::walk_state_>
+directory_walker::make_state_(
+    us_char_a_t const*                      root
+,   std::function<bool (entry_type const&)> sink
+) const
+{
+    std::string path((NULL == root || '\0' == *root) ? "." : root);
+
+    // Trim trailing separators, other than that of the file-system root
+
+    for (; path.size() > 1 && '/' == path[path.size() - 1]; )
+    {
+        path.resize(path.size() - 1);
+    }
+
+    std::unique_ptr<walk_state_> state(new walk_state_(m_flags, m_numThreads, m_maxDepth, m_filter, m_errorHandler, std::move(sink)));
+
+    int const fd = ::open(path.c_str(), ximpl_directory_walker::open_flags(true));
+
+    if (fd < 0)
+    {
+        STLSOFT_THROW_X(directory_walker_exception("failed to open directory", errno, path.c_str()));
+    }
+
+    state->numPending = 1;
+    state->numQueued = 1;
+    state->deques[0]->tasks.push_back(task_type_{ nullptr, std::move(path), 0, 0, false, fd });
+
+    return state;
+}
+
+inline
+directory_walker::size_type
+directory_walker::walk_(
+    us_char_a_t const*  root
+,   callback_type       callback
+)
+{
+    std::unique_ptr<walk_state_> state = make_state_(root, [&callback](entry_type const& entry) {
+
+        callback(entry);
+
+        return true;
+    });
+
+    std::vector<std::thread> threads;
+
+    // the calling thread is the first worker. If a thread cannot be
+    // created, the walk proceeds with those that have been
+
+    threads.reserve(m_numThreads - 1);
+    for (size_type i = 1; i != m_numThreads; ++i)
+    {
+        try
+        {
+            threads.emplace_back(&class_type::run_, std::ref(*state), i);
+        }
+        catch (std::system_error&)
+        {
+            forgo_workers_(*state, m_numThreads - i);
+
+            break;
+        }
+    }
+
+    run_(*state, 0);
+
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    if (state->exception)
+    {
+        std::rethrow_exception(state->exception);
+    }
+
+    return state->numDelivered;
+}
+
+inline
+void
+directory_walker::start_(
+    us_char_a_t const* root
+)
+{
+    stop();
+
+    std::unique_ptr<queue_type_>    queue(new queue_type_(m_queueCapacity));
+    queue_type_* const              q = queue.get();
+
+    m_state = make_state_(root, [q](entry_type const& entry) {
+
+        return q->push(entry);
+    });
+    m_state->queue = std::move(queue);
+
+    // If a thread cannot be created, the walk proceeds with those that
+    // have been, unless there are none
+
+    m_threads.reserve(m_numThreads);
+    for (size_type i = 0; i != m_numThreads; ++i)
+    {
+        try
+        {
+            m_threads.emplace_back(&class_type::run_, std::ref(*m_state), i);
+        }
+        catch (std::system_error&)
+        {
+            forgo_workers_(*m_state, m_numThreads - i);
+
+            if (0 == i)
+            {
+                m_state.reset();
+
+                throw;
+            }
+
+            break;
+        }
+    }
+}
+
+inline
+bool
+directory_walker::next(
+    directory_walker::entry_type& entry
+)
+{
+    if (!m_state)
+    {
+        return false;
+    }
+
+    if (m_state->queue->pop(entry))
+    {
+        return true;
+    }
+
+    // the queue is closed and drained, so the walk is complete
+
+    std::exception_ptr const x = m_state->exception;
+
+    stop();
+
+    if (x)
+    {
+        std::rethrow_exception(x);
+    }
+
+    return false;
+}
+
+inline
+void
+directory_walker::stop() STLSOFT_NOEXCEPT
+{
+    if (m_state)
+    {
+        cancel_(*m_state);
+
+        for (auto& t : m_threads)
+        {
+            t.join();
+        }
+
+        m_threads.clear();
+        m_state.reset();
+    }
+}
+
+inline
+/* static */
+void
+directory_walker::run_(
+    directory_walker::walk_state_&  state
+,   directory_walker::size_type     index
+)
+{
+    entry_type  entry;
+    task_type_  task;
+
+    try
+    {
+        for (; acquire_(state, index, task); )
+        {
+            process_(state, index, task, entry);
+
+            task.parent.reset();
+
+            if (1 == state.numPending.fetch_sub(1))
+            {
+                // the walk is complete, so wake the idle workers
+
+                std::lock_guard<std::mutex> lock(state.idleMx);
+
+                state.idleCv.notify_all();
+            }
+        }
+    }
+    catch (...)
+    {
+        {
+            std::lock_guard<std::mutex> lock(state.exceptionMx);
+
+            if (!state.exception)
+            {
+                state.exception = std::current_exception();
+            }
+        }
+
+        cancel_(state);
+    }
+
+    if (1 == state.numRunning.fetch_sub(1) &&
+        state.queue)
+    {
+        state.queue->close();
+    }
+}
+
+inline
+/* static */
+bool
+directory_walker::acquire_(
+    directory_walker::walk_state_&  state
+,   directory_walker::size_type     index
+,   directory_walker::task_type_&   task
+)
+{
+    size_type const n = state.deques.size();
+
+    for (;;)
+    {
+        if (state.cancelled)
+        {
+            return false;
+        }
+
+        // own deque first, from the back, ...
+
+        {
+            task_deque_type_& d = *state.deques[index];
+
+            std::lock_guard<std::mutex> lock(d.mx);
+
+            if (!d.tasks.empty())
+            {
+                task = std::move(d.tasks.back());
+                d.tasks.pop_back();
+                --state.numQueued;
+
+                return true;
+            }
+        }
+
+        // ... then those of the others, from the front
+
+        for (size_type i = 1; i != n; ++i)
+        {
+            task_deque_type_& d = *state.deques[(index + i) % n];
+
+            std::lock_guard<std::mutex> lock(d.mx);
+
+            if (!d.tasks.empty())
+            {
+                task = std::move(d.tasks.front());
+                d.tasks.pop_front();
+                --state.numQueued;
+
+                return true;
+            }
+        }
+
+        // Nothing to do, so wait until there is, or the walk is complete.
+        //
+        // NOTE: `numIdle` is incremented before `numQueued` is tested, and
+        // push_() increments `numQueued` before testing `numIdle`, so a
+        // wake-up cannot be lost
+
+        std::unique_lock<std::mutex> lock(state.idleMx);
+
+        ++state.numIdle;
+        state.idleCv.wait(lock, [&state] {
+
+            return state.cancelled || 0 == state.numPending || 0 != state.numQueued;
+        });
+        --state.numIdle;
+
+        if (0 == state.numPending)
+        {
+            return false;
+        }
+    }
+}
+
+inline
+/* static */
+void
+directory_walker::push_(
+    directory_walker::walk_state_&  state
+,   directory_walker::size_type     index
+,   directory_walker::task_type_&&  task
+)
+{
+    ++state.numPending;
+
+    {
+        task_deque_type_& d = *state.deques[index];
+
+        std::lock_guard<std::mutex> lock(d.mx);
+
+        d.tasks.push_back(std::move(task));
+    }
+
+    ++state.numQueued;
+
+    if (0 != state.numIdle)
+    {
+        std::lock_guard<std::mutex> lock(state.idleMx);
+
+        state.idleCv.notify_one();
+    }
+}
+
+inline
+/* static */
+void
+directory_walker::process_(
+    directory_walker::walk_state_&  state
+,   directory_walker::size_type     index
+,   directory_walker::task_type_&   task
+,   directory_walker::entry_type&   entry
+)
+{
+    bool const  followingLinks  =   0 != (followLinks & state.flags);
+    int         fd              =   task.fd;
+
+    if (fd < 0)
+    {
+        UNIXSTL_ASSERT(task.parent);
+
+        int const flags = ximpl_directory_walker::open_flags(task.isLink);
+
+        fd = ::openat(task.parent->fd(), task.path.c_str() + task.nameOffset, flags);
+
+        if (fd < 0 &&
+            (   EMFILE == errno ||
+                ENFILE == errno))
+        {
+            // Too many directories are held open, so release this one's
+            // parent (if no other task holds it) and open it by path
+
+            task.parent.reset();
+
+            fd = ::open(task.path.c_str(), flags);
+        }
+
+        if (fd < 0)
+        {
+            report_error_(state, task.path.c_str(), errno);
+
+            return;
+        }
+    }
+
+    // the descriptor is owned by the guard until it is adopted by the
+    // directory stream, so that it is not leaked if anything throws
+
+    ximpl_directory_walker::descriptor_guard fdGuard(fd);
+
+    task.fd = -1;
+
+    if (followingLinks)
+    {
+        struct stat st;
+
+        if (0 == ::fstat(fd, &st))
+        {
+            std::lock_guard<std::mutex> lock(state.visitedMx);
+
+            if (!state.visited.insert(walk_state_::file_id_type(st.st_dev, st.st_ino)).second)
+            {
+                // already visited, via another link
+
+                return;
+            }
+        }
+    }
+
+    DIR* const dir = ::fdopendir(fd);
+
+    if (NULL == dir)
+    {
+        report_error_(state, task.path.c_str(), errno);
+
+        return;
+    }
+
+    fdGuard.release();
+
+    std::unique_ptr<DIR, int (*)(DIR*)>     dirGuard(dir, &::closedir);
+    std::shared_ptr<directory_handle_type_> const handle = std::make_shared<directory_handle_type_>(dir);
+
+    dirGuard.release();
+
+    task.parent.reset();
+
+    for (;;)
+    {
+        errno = 0;
+
+        struct dirent const* const de = ::readdir(dir);
+
+        if (NULL == de)
+        {
+            if (0 != errno)
+            {
+                report_error_(state, task.path.c_str(), errno);
+            }
+
+            break;
+        }
+
+        if (traits_type::is_dots(de->d_name))
+        {
+            continue;
+        }
+
+        // Determine the path ...
+
+        entry.m_path.assign(task.path);
+        if ('/' != entry.m_path[entry.m_path.size() - 1])
+        {
+            entry.m_path += '/';
+        }
+        entry.m_nameOffset = entry.m_path.size();
+        entry.m_path += de->d_name;
+        entry.m_depth = task.depth + 1;
+        entry.m_isLink = false;
+
+        // ... and the type
+
+        mode_t type = ximpl_directory_walker::mode_from_entry(de);
+
+        if (0 == type)
+        {
+            struct stat st;
+
+            if (0 != ::fstatat(handle->fd(), de->d_name, &st, AT_SYMLINK_NOFOLLOW))
+            {
+                report_error_(state, entry.m_path.c_str(), errno);
+
+                continue;
+            }
+
+            type = st.st_mode & S_IFMT;
+        }
+
+        if (S_IFLNK == type &&
+            followingLinks)
+        {
+            struct stat st;
+
+            // a dangling link remains a link
+
+            if (0 == ::fstatat(handle->fd(), de->d_name, &st, 0))
+            {
+                type            =   st.st_mode & S_IFMT;
+                entry.m_isLink  =   true;
+            }
+        }
+
+        entry.m_type = type;
+
+        if (state.filter &&
+            !state.filter(entry))
+        {
+            continue;
+        }
+
+        flags_type typeFlag;
+
+        switch (type)
+        {
+        case S_IFDIR:   typeFlag = directories; break;
+        case S_IFREG:   typeFlag = files;       break;
+        case S_IFLNK:   typeFlag = links;       break;
+        default:        typeFlag = others;      break;
+        }
+
+        if (0 != (typeFlag & state.flags))
+        {
+            if (!state.sink(entry))
+            {
+                // the walk has been abandoned
+
+                return;
+            }
+
+            ++state.numDelivered;
+        }
+
+        if (S_IFDIR == type &&
+            (   0 == state.maxDepth ||
+                entry.m_depth < state.maxDepth))
+        {
+            push_(state, index, task_type_{ handle, entry.m_path, entry.m_nameOffset, entry.m_depth, entry.m_isLink, -1 });
+        }
+
+        if (state.cancelled)
+        {
+            return;
+        }
+    }
+}
+
+inline
+/* static */
+void
+directory_walker::cancel_(
+    directory_walker::walk_state_& state
+)
+{
+    state.cancelled = true;
+
+    {
+        std::lock_guard<std::mutex> lock(state.idleMx);
+
+        state.idleCv.notify_all();
+    }
+
+    if (state.queue)
+    {
+        state.queue->close();
+    }
+}
+
+inline
+/* static */
+void
+directory_walker::forgo_workers_(
+    directory_walker::walk_state_&  state
+,   directory_walker::size_type     n
+) STLSOFT_NOEXCEPT
+{
+    // Workers that were never started do not finish, so they are
+    // discounted here, and if those that were started have all already
+    // finished then the queue must be closed on their behalf
+
+    if (n == state.numRunning.fetch_sub(n) &&
+        state.queue)
+    {
+        state.queue->close();
+    }
+}
+
+inline
+/* static */
+void
+directory_walker::report_error_(
+    directory_walker::walk_state_&  state
+,   us_char_a_t const*              path
+,   int                             err
+)
+{
+    if (state.errorHandler)
+    {
+        state.errorHandler(path, err);
+    }
+}
+
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef UNIXSTL_NO_NAMESPACE
+# if defined(STLSOFT_NO_NAMESPACE) || \
+     defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+} /* namespace unixstl */
+# else
+} /* namespace unixstl_project */
+} /* namespace stlsoft */
+# endif /* STLSOFT_NO_NAMESPACE */
+#endif /* !UNIXSTL_NO_NAMESPACE */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !UNIXSTL_INCL_UNIXSTL_FILESYSTEM_HPP_DIRECTORY_WALKER */
+
+/* ///////////////////////////// end of file //////////////////////////// */
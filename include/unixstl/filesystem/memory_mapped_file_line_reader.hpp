@@ -0,0 +1,808 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    unixstl/filesystem/memory_mapped_file_line_reader.hpp
+ *
+ * Purpose: Streaming line reader over a sliding memory-mapped window.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * Home:    http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/** \file unixstl/filesystem/memory_mapped_file_line_reader.hpp
+ *
+ * \brief [C++] Definition of the unixstl::memory_mapped_file_line_reader
+ *   class
+ *   (\ref group__library__FileSystem "File System" Library).
+ */
+
+#ifndef UNIXSTL_INCL_UNIXSTL_FILESYSTEM_HPP_MEMORY_MAPPED_FILE_LINE_READER
+#define UNIXSTL_INCL_UNIXSTL_FILESYSTEM_HPP_MEMORY_MAPPED_FILE_LINE_READER
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define UNIXSTL_VER_UNIXSTL_FILESYSTEM_HPP_MEMORY_MAPPED_FILE_LINE_READER_MAJOR    1
+# define UNIXSTL_VER_UNIXSTL_FILESYSTEM_HPP_MEMORY_MAPPED_FILE_LINE_READER_MINOR    0
+# define UNIXSTL_VER_UNIXSTL_FILESYSTEM_HPP_MEMORY_MAPPED_FILE_LINE_READER_REVISION 0
+# define UNIXSTL_VER_UNIXSTL_FILESYSTEM_HPP_MEMORY_MAPPED_FILE_LINE_READER_EDIT     1
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef UNIXSTL_INCL_UNIXSTL_H_UNIXSTL
+# include <unixstl/unixstl.h>
+#endif /* !UNIXSTL_INCL_UNIXSTL_H_UNIXSTL */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+#ifndef UNIXSTL_INCL_UNIXSTL_FILESYSTEM_HPP_FILESYSTEM_TRAITS
+# include <unixstl/filesystem/filesystem_traits.hpp>
+#endif /* !UNIXSTL_INCL_UNIXSTL_FILESYSTEM_HPP_FILESYSTEM_TRAITS */
+#ifndef UNIXSTL_INCL_UNIXSTL_FILESYSTEM_H_MEMORY_MAP_FUNCTIONS
+# include <unixstl/filesystem/memory_map_functions.h>
+#endif /* !UNIXSTL_INCL_UNIXSTL_FILESYSTEM_H_MEMORY_MAP_FUNCTIONS */
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+# ifndef UNIXSTL_INCL_UNIXSTL_EXCEPTION_HPP_ACCESS_EXCEPTION
+#  include <unixstl/exception/access_exception.hpp>
+# endif /* !UNIXSTL_INCL_UNIXSTL_EXCEPTION_HPP_ACCESS_EXCEPTION */
+# ifndef UNIXSTL_INCL_UNIXSTL_EXCEPTION_HPP_FILE_NOT_FOUND_EXCEPTION
+#  include <unixstl/exception/file_not_found_exception.hpp>
+# endif /* !UNIXSTL_INCL_UNIXSTL_EXCEPTION_HPP_FILE_NOT_FOUND_EXCEPTION */
+# ifndef UNIXSTL_INCL_UNIXSTL_EXCEPTION_HPP_FILESYSTEM_EXCEPTION
+#  include <unixstl/exception/filesystem_exception.hpp>
+# endif /* !UNIXSTL_INCL_UNIXSTL_EXCEPTION_HPP_FILESYSTEM_EXCEPTION */
+# ifndef STLSOFT_INCL_STLSOFT_EXCEPTION_HPP_OUT_OF_MEMORY_EXCEPTION
+#  include <stlsoft/exception/out_of_memory_exception.hpp>
+# endif /* !STLSOFT_INCL_STLSOFT_EXCEPTION_HPP_OUT_OF_MEMORY_EXCEPTION */
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+#ifndef STLSOFT_INCL_STLSOFT_SHIMS_ACCESS_STRING_H_FWD
+# include <stlsoft/shims/access/string/fwd.h>
+#endif /* !STLSOFT_INCL_STLSOFT_SHIMS_ACCESS_STRING_H_FWD */
+#ifndef STLSOFT_INCL_STLSOFT_STRING_HPP_STRING_VIEW
+# include <stlsoft/string/string_view.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_STRING_HPP_STRING_VIEW */
+
+#ifndef STLSOFT_INCL_ITERATOR
+# define STLSOFT_INCL_ITERATOR
+# include <iterator>
+#endif /* !STLSOFT_INCL_ITERATOR */
+#ifndef STLSOFT_INCL_VECTOR
+# define STLSOFT_INCL_VECTOR
+# include <vector>
+#endif /* !STLSOFT_INCL_VECTOR */
+
+#ifndef STLSOFT_INCL_H_ERRNO
+# define STLSOFT_INCL_H_ERRNO
+# include <errno.h>
+#endif /* !STLSOFT_INCL_H_ERRNO */
+#ifndef STLSOFT_INCL_H_STRING
+# define STLSOFT_INCL_H_STRING
+# include <string.h>
+#endif /* !STLSOFT_INCL_H_STRING */
+#ifndef STLSOFT_INCL_SYS_H_MMAN
+# define STLSOFT_INCL_SYS_H_MMAN
+# include <sys/mman.h>
+#endif /* !STLSOFT_INCL_SYS_H_MMAN */
+#ifndef STLSOFT_INCL_SYS_H_STAT
+# define STLSOFT_INCL_SYS_H_STAT
+# include <sys/stat.h>
+#endif /* !STLSOFT_INCL_SYS_H_STAT */
+#ifndef STLSOFT_INCL_H_UNISTD
+# define STLSOFT_INCL_H_UNISTD
+# include <unistd.h>
+#endif /* !STLSOFT_INCL_H_UNISTD */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef UNIXSTL_NO_NAMESPACE
+# if defined(STLSOFT_NO_NAMESPACE) || \
+     defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+/* There is no stlsoft namespace, so must define ::unixstl */
+namespace unixstl
+{
+# else
+/* Define stlsoft::unixstl_project */
+namespace stlsoft
+{
+namespace unixstl_project
+{
+# endif /* STLSOFT_NO_NAMESPACE */
+#endif /* !UNIXSTL_NO_NAMESPACE */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * classes
+ */
+
+/** Reads the lines of a text file, in order, through a fixed-size
+ * memory-mapped window that slides along the file.
+ *
+ * \ingroup group__library__FileSystem
+ *
+ * Only one window (of window_size() bytes, which is a multiple of the page
+ * size) is mapped at any time, and it is advised as sequential, so that
+ * the resident set size is bounded by the window size regardless of the
+ * size of the file. Reading may begin at any offset, allowing, say, only
+ * the last part of a very large log file to be processed.
+ *
+ * Lines are returned as views that refer either into the window or, for a
+ * line that is not wholly contained in any one window, into an internal
+ * buffer. In both cases a view remains valid only until the next call to
+ * read_line(), or the next iterator increment.
+ *
+ * Lines are delimited by CRLF, LF, or CR, in any combination, exactly as
+ * for \link platformstl::basic_file_lines file_lines\endlink.
+ */
+class memory_mapped_file_line_reader
+{
+/// \name Member Types
+/// @{
+private:
+    /// The character type
+    typedef us_char_a_t                         char_type;
+    /// The traits type
+    typedef filesystem_traits<us_char_a_t>      traits_type;
+public:
+    /// This type
+    typedef memory_mapped_file_line_reader      class_type;
+    /// The size type
+    typedef us_size_t                           size_type;
+    /// The offset type
+    typedef off_t                               offset_type;
+    /// The status code type
+    typedef int                                 status_code_type;
+    /// The boolean type
+    typedef us_bool_t                           bool_type;
+    /// The line type
+    typedef STLSOFT_NS_QUAL(basic_string_view)<char_type>
+                                                string_view_type;
+    class                                       const_iterator;
+/// @}
+
+/// \name Member Constants
+/// @{
+public:
+    enum
+    {
+        /// The default size of the mapped window
+        default_window_size =   16 * 1024 * 1024
+    };
+/// @}
+
+/// \name Construction
+/// @{
+public:
+    /// Opens the given file for reading from its start
+    ///
+    /// \param fileName The path of the file
+    /// \param windowSize The size of the mapped window, which will be
+    ///   rounded up to a multiple of the page size
+    ss_explicit_k
+    memory_mapped_file_line_reader(
+        char_type const*    fileName
+    ,   size_type           windowSize = default_window_size
+    )
+        : m_fd(-1)
+        , m_fileSize(0)
+        , m_pageSize(0)
+        , m_windowSize(0)
+        , m_window(NULL)
+        , m_windowOffset(0)
+        , m_windowLength(0)
+        , m_pos(0)
+        , m_carry()
+#ifndef STLSOFT_CF_EXCEPTION_SUPPORT
+        , m_lastStatusCode(0)
+#endif /* !STLSOFT_CF_EXCEPTION_SUPPORT */
+    {
+        open_(fileName, 0, windowSize);
+    }
+    /// Opens the given file for reading from its start
+    template <ss_typename_param_k S>
+    ss_explicit_k
+    memory_mapped_file_line_reader(
+        S const&            fileName
+    ,   size_type           windowSize = default_window_size
+    )
+        : m_fd(-1)
+        , m_fileSize(0)
+        , m_pageSize(0)
+        , m_windowSize(0)
+        , m_window(NULL)
+        , m_windowOffset(0)
+        , m_windowLength(0)
+        , m_pos(0)
+        , m_carry()
+#ifndef STLSOFT_CF_EXCEPTION_SUPPORT
+        , m_lastStatusCode(0)
+#endif /* !STLSOFT_CF_EXCEPTION_SUPPORT */
+    {
+        open_(STLSOFT_NS_QUAL(c_str_ptr)(fileName), 0, windowSize);
+    }
+    /// Opens the given file for reading from the given offset
+    ///
+    /// \param fileName The path of the file
+    /// \param offset The offset at which to begin reading. If this does not
+    ///   correspond to the start of a line, the first line read will be
+    ///   the remainder of the line containing it. If it is beyond the end
+    ///   of the file, no lines will be read
+    /// \param windowSize The size of the mapped window, which will be
+    ///   rounded up to a multiple of the page size
+    memory_mapped_file_line_reader(
+        char_type const*    fileName
+    ,   offset_type         offset
+    ,   size_type           windowSize
+    )
+        : m_fd(-1)
+        , m_fileSize(0)
+        , m_pageSize(0)
+        , m_windowSize(0)
+        , m_window(NULL)
+        , m_windowOffset(0)
+        , m_windowLength(0)
+        , m_pos(0)
+        , m_carry()
+#ifndef STLSOFT_CF_EXCEPTION_SUPPORT
+        , m_lastStatusCode(0)
+#endif /* !STLSOFT_CF_EXCEPTION_SUPPORT */
+    {
+        open_(fileName, offset, windowSize);
+    }
+    /// Opens the given file for reading from the given offset
+    template <ss_typename_param_k S>
+    memory_mapped_file_line_reader(
+        S const&            fileName
+    ,   offset_type         offset
+    ,   size_type           windowSize
+    )
+        : m_fd(-1)
+        , m_fileSize(0)
+        , m_pageSize(0)
+        , m_windowSize(0)
+        , m_window(NULL)
+        , m_windowOffset(0)
+        , m_windowLength(0)
+        , m_pos(0)
+        , m_carry()
+#ifndef STLSOFT_CF_EXCEPTION_SUPPORT
+        , m_lastStatusCode(0)
+#endif /* !STLSOFT_CF_EXCEPTION_SUPPORT */
+    {
+        open_(STLSOFT_NS_QUAL(c_str_ptr)(fileName), offset, windowSize);
+    }
+
+    /// Unmaps the window and closes the file
+    ~memory_mapped_file_line_reader() STLSOFT_NOEXCEPT
+    {
+        unmap_();
+
+        if (-1 != m_fd)
+        {
+            traits_type::close(m_fd);
+        }
+    }
+private:
+    memory_mapped_file_line_reader(class_type const&) STLSOFT_COPY_CONSTRUCTION_PROSCRIBED;
+    void operator =(class_type const&) STLSOFT_COPY_ASSIGNMENT_PROSCRIBED;
+/// @}
+
+/// \name Operations
+/// @{
+public:
+    /// Reads the next line, excluding its line-end
+    ///
+    /// \param line Receives a view of the line, which remains valid until
+    ///   the next call
+    ///
+    /// \retval true A line was read
+    /// \retval false There are no more lines (or, when exception support is
+    ///   not enabled, the file could not be mapped)
+    bool_type read_line(string_view_type& line);
+
+    /// Begins the iteration, by reading the next line
+    ///
+    /// \note As with any input iterator, the sequence may be traversed only
+    ///   once
+    const_iterator begin();
+
+    /// Ends the iteration
+    const_iterator end();
+/// @}
+
+/// \name Accessors
+/// @{
+public:
+    /// The size of the file, in bytes
+    offset_type file_size() const STLSOFT_NOEXCEPT
+    {
+        return m_fileSize;
+    }
+    /// The offset of the first byte that has not yet been read
+    offset_type offset() const STLSOFT_NOEXCEPT
+    {
+        return m_pos;
+    }
+    /// The size of the mapped window
+    size_type window_size() const STLSOFT_NOEXCEPT
+    {
+        return m_windowSize;
+    }
+
+#ifndef STLSOFT_CF_EXCEPTION_SUPPORT
+    /// The status code associated with the last failed operation
+    status_code_type status_code() const STLSOFT_NOEXCEPT
+    {
+        return m_lastStatusCode;
+    }
+#endif /* !STLSOFT_CF_EXCEPTION_SUPPORT */
+/// @}
+
+/// \name Implementation
+/// @{
+private:
+    void
+    open_(
+        char_type const*    fileName
+    ,   offset_type         offset
+    ,   size_type           windowSize
+    )
+    {
+        long const pageSize = ::sysconf(_SC_PAGESIZE);
+
+        m_pageSize      =   (pageSize > 0) ? static_cast<size_type>(pageSize) : 4096u;
+        m_windowSize    =   (0 == windowSize) ? m_pageSize : ((windowSize + m_pageSize - 1) / m_pageSize) * m_pageSize;
+
+        m_fd = traits_type::open(fileName, O_RDONLY, 0);
+
+        if (-1 == m_fd)
+        {
+            on_failure_("Failed to open file for mapping");
+
+            return;
+        }
+
+        struct stat st;
+
+        if (0 != ::fstat(m_fd, &st))
+        {
+            // The file is closed before the failure is reported, since
+            // on_failure_() may throw out of the constructor, in which case
+            // the destructor will not be called
+
+            int const e = errno;
+
+            traits_type::close(m_fd);
+            m_fd = -1;
+
+            on_failure_("Failed to determine mapped file size", e);
+
+            return;
+        }
+
+        m_fileSize  =   st.st_size;
+        m_pos       =   (offset < 0) ? 0 : (offset > m_fileSize) ? m_fileSize : offset;
+    }
+
+    bool_type
+    on_failure_(
+        char const*         message
+    ,   status_code_type    scode = errno
+    )
+    {
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+
+        switch (scode)
+        {
+        case ENOMEM:
+            STLSOFT_THROW_X(STLSOFT_NS_QUAL(out_of_memory_exception)(STLSoftProjectIdentifier_UNIXSTL, STLSoftLibraryIdentifier_FileSystem, scode));
+        case ENOENT:
+            STLSOFT_THROW_X(file_not_found_exception(message, scode));
+        case EACCES:
+            STLSOFT_THROW_X(access_exception(message, scode));
+        default:
+            STLSOFT_THROW_X(filesystem_exception(message, scode));
+        }
+#else /* ? STLSOFT_CF_EXCEPTION_SUPPORT */
+
+        STLSOFT_SUPPRESS_UNUSED(message);
+
+        m_lastStatusCode    =   scode;
+        m_fileSize          =   0;
+        m_pos               =   0;
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+
+        return true;
+    }
+
+    void unmap_() STLSOFT_NOEXCEPT
+    {
+        if (NULL != m_window)
+        {
+            unmap_view_of_file(m_window, m_windowLength);
+
+            m_window        =   NULL;
+            m_windowLength  =   0;
+        }
+    }
+
+    // Maps the window beginning at the page containing pos
+    bool_type map_(offset_type pos)
+    {
+        UNIXSTL_ASSERT(pos < m_fileSize);
+
+        offset_type const   windowOffset    =   pos - (pos % static_cast<offset_type>(m_pageSize));
+        offset_type const   remaining       =   m_fileSize - windowOffset;
+        size_type const     windowLength    =   (remaining < static_cast<offset_type>(m_windowSize)) ? static_cast<size_type>(remaining) : m_windowSize;
+
+        // The previous window is released before the next is mapped, so
+        // that there is only ever one window's worth of pages mapped
+
+        unmap_();
+
+        void* const memory = ::mmap(NULL, windowLength, PROT_READ, MAP_PRIVATE, m_fd, windowOffset);
+
+        if (MAP_FAILED == memory)
+        {
+            on_failure_("Failed to map view of file");
+
+            return false;
+        }
+
+#if defined(MADV_SEQUENTIAL)
+        ::madvise(memory, windowLength, MADV_SEQUENTIAL);
+#endif /* MADV_SEQUENTIAL */
+
+        m_window        =   static_cast<char_type*>(memory);
+        m_windowOffset  =   windowOffset;
+        m_windowLength  =   windowLength;
+
+        return true;
+    }
+
+    offset_type window_end_() const STLSOFT_NOEXCEPT
+    {
+        return m_windowOffset + static_cast<offset_type>(m_windowLength);
+    }
+/// @}
+
+/// \name Fields
+/// @{
+private:
+    int                     m_fd;
+    offset_type             m_fileSize;
+    size_type               m_pageSize;
+    size_type               m_windowSize;
+    char_type*              m_window;
+    offset_type             m_windowOffset;
+    size_type               m_windowLength;
+    offset_type             m_pos;
+    std::vector<char_type>  m_carry;
+#ifndef STLSOFT_CF_EXCEPTION_SUPPORT
+    status_code_type        m_lastStatusCode;
+#endif /* !STLSOFT_CF_EXCEPTION_SUPPORT */
+/// @}
+};
+
+
+/** Input iterator over the lines read by a
+ * \link unixstl::memory_mapped_file_line_reader memory_mapped_file_line_reader\endlink
+ *
+ * \ingroup group__library__FileSystem
+ */
+class memory_mapped_file_line_reader::const_iterator
+{
+/// \name Member Types
+/// @{
+public:
+    typedef std::input_iterator_tag                             iterator_category;
+    typedef memory_mapped_file_line_reader::string_view_type    value_type;
+    typedef us_ptrdiff_t                                        difference_type;
+    typedef value_type const*                                   pointer;
+    typedef value_type const&                                   reference;
+    typedef const_iterator                                      class_type;
+/// @}
+
+/// \name Construction
+/// @{
+public:
+    /// Creates an end iterator
+    const_iterator()
+        : m_reader(NULL)
+        , m_line()
+    {}
+private:
+    friend class memory_mapped_file_line_reader;
+
+    explicit
+    const_iterator(memory_mapped_file_line_reader* reader)
+        : m_reader(reader)
+        , m_line()
+    {
+        operator ++();
+    }
+/// @}
+
+/// \name Operations
+/// @{
+public:
+    reference operator *() const
+    {
+        UNIXSTL_MESSAGE_ASSERT("dereferencing an end iterator", NULL != m_reader);
+
+        return m_line;
+    }
+    pointer operator ->() const
+    {
+        UNIXSTL_MESSAGE_ASSERT("dereferencing an end iterator", NULL != m_reader);
+
+        return &m_line;
+    }
+
+    class_type& operator ++()
+    {
+        UNIXSTL_MESSAGE_ASSERT("incrementing an end iterator", NULL != m_reader);
+
+        if (!m_reader->read_line(m_line))
+        {
+            m_reader = NULL;
+        }
+
+        return *this;
+    }
+    void operator ++(int)
+    {
+        operator ++();
+    }
+/// @}
+
+/// \name Comparison
+/// @{
+public:
+    bool operator ==(class_type const& rhs) const
+    {
+        return m_reader == rhs.m_reader;
+    }
+    bool operator !=(class_type const& rhs) const
+    {
+        return m_reader != rhs.m_reader;
+    }
+/// @}
+
+/// \name Fields
+/// @{
+private:
+    memory_mapped_file_line_reader* m_reader;
+    value_type                      m_line;
+/// @}
+};
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * implementation
+ */
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+inline
+memory_mapped_file_line_reader::bool_type
+memory_mapped_file_line_reader::read_line(
+    memory_mapped_file_line_reader::string_view_type& line
+)
+{
+    // Algorithm:
+    //
+    // Search the current window for the line-end following the current
+    // position. If found, the line is returned as a view into the window.
+    //
+    // If not, and the line starts beyond the window's first page, the
+    // window is slid forward to the line's page and the search repeated.
+    //
+    // Otherwise the line is longer than the window, so what is in the
+    // window is copied into the carry buffer, the next window is mapped,
+    // and the search continues; the line is eventually returned as a view
+    // of the carry buffer.
+    //
+    // A CR in the last byte of a window (that is not the last of the file)
+    // requires that the next window be examined, to see whether it is part
+    // of a CRLF, and is treated in the same way as a long line.
+
+    bool    inCarry     =   false;
+    bool    pendingCR   =   false;
+
+    m_carry.clear();
+
+    for (;;)
+    {
+        if (m_pos == m_fileSize)
+        {
+            if (!inCarry)
+            {
+                return false;
+            }
+
+            line = string_view_type(m_carry.empty() ? NULL : &m_carry[0], m_carry.size());
+
+            return true;
+        }
+
+        if (NULL == m_window ||
+            m_pos < m_windowOffset ||
+            m_pos >= window_end_())
+        {
+            if (!map_(m_pos))
+            {
+                return false;
+            }
+        }
+
+        char_type const* const  b   =   m_window + static_cast<size_type>(m_pos - m_windowOffset);
+        char_type const* const  e   =   m_window + m_windowLength;
+
+        if (pendingCR)
+        {
+            if ('\n' == *b)
+            {
+                ++m_pos;
+            }
+
+            line = string_view_type(m_carry.empty() ? NULL : &m_carry[0], m_carry.size());
+
+            return true;
+        }
+
+        char_type const* const  lf  =   static_cast<char_type const*>(::memchr(b, '\n', static_cast<size_type>(e - b)));
+        char_type const* const  cr  =   static_cast<char_type const*>(::memchr(b, '\r', static_cast<size_type>(((NULL != lf) ? lf : e) - b)));
+        char_type const*        eol =   NULL;
+        size_type               cchEol;
+
+        if (NULL != cr)
+        {
+            if (cr + 1 != e)
+            {
+                eol     =   cr;
+                cchEol  =   ('\n' == cr[1]) ? 2 : 1;
+            }
+            else if (window_end_() == m_fileSize)
+            {
+                eol     =   cr;
+                cchEol  =   1;
+            }
+        }
+        else if (NULL != lf)
+        {
+            eol     =   lf;
+            cchEol  =   1;
+        }
+        else if (window_end_() == m_fileSize)
+        {
+            eol     =   e;
+            cchEol  =   0;
+        }
+
+        if (NULL != eol)
+        {
+            size_type const cch = static_cast<size_type>(eol - b);
+
+            m_pos += static_cast<offset_type>(cch + cchEol);
+
+            if (inCarry)
+            {
+                m_carry.insert(m_carry.end(), b, eol);
+
+                line = string_view_type(m_carry.empty() ? NULL : &m_carry[0], m_carry.size());
+            }
+            else
+            {
+                line = string_view_type(b, cch);
+            }
+
+            return true;
+        }
+
+        // The line continues beyond the window
+
+        if (!inCarry &&
+            m_pos - (m_pos % static_cast<offset_type>(m_pageSize)) > m_windowOffset)
+        {
+            if (!map_(m_pos))
+            {
+                return false;
+            }
+
+            continue;
+        }
+
+        if (NULL != cr)
+        {
+            UNIXSTL_ASSERT(cr + 1 == e);
+
+            pendingCR = true;
+        }
+
+        m_carry.insert(m_carry.end(), b, (NULL != cr) ? cr : e);
+
+        inCarry =   true;
+        m_pos   =   window_end_();
+    }
+}
+
+inline
+memory_mapped_file_line_reader::const_iterator
+memory_mapped_file_line_reader::begin()
+{
+    return const_iterator(this);
+}
+
+inline
+memory_mapped_file_line_reader::const_iterator
+memory_mapped_file_line_reader::end()
+{
+    return const_iterator();
+}
+
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef UNIXSTL_NO_NAMESPACE
+# if defined(STLSOFT_NO_NAMESPACE) || \
+     defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+} /* namespace unixstl */
+# else
+} /* namespace unixstl_project */
+} /* namespace stlsoft */
+# endif /* STLSOFT_NO_NAMESPACE */
+#endif /* !UNIXSTL_NO_NAMESPACE */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !UNIXSTL_INCL_UNIXSTL_FILESYSTEM_HPP_MEMORY_MAPPED_FILE_LINE_READER */
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -4,11 +4,11 @@
  * Purpose: readdir_sequence class.
  *
  * Created: 15th January 2002
- * Updated: 11th October 2024
+ * Updated: 16th October 2026
  *
  * Home:    http://stlsoft.org/
  *
- * Copyright (c) 2019-2024, Matthew Wilson and Synesis Information Systems
+ * Copyright (c) 2019-2026, Matthew Wilson and Synesis Information Systems
  * Copyright (c) 2002-2019, Matthew Wilson and Synesis Software
  * All rights reserved.
  *
@@ -52,9 +52,9 @@
 
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 # define UNIXSTL_VER_UNIXSTL_FILESYSTEM_HPP_READDIR_SEQUENCE_MAJOR      5
-# define UNIXSTL_VER_UNIXSTL_FILESYSTEM_HPP_READDIR_SEQUENCE_MINOR      2
-# define UNIXSTL_VER_UNIXSTL_FILESYSTEM_HPP_READDIR_SEQUENCE_REVISION   5
-# define UNIXSTL_VER_UNIXSTL_FILESYSTEM_HPP_READDIR_SEQUENCE_EDIT       164
+# define UNIXSTL_VER_UNIXSTL_FILESYSTEM_HPP_READDIR_SEQUENCE_MINOR      3
+# define UNIXSTL_VER_UNIXSTL_FILESYSTEM_HPP_READDIR_SEQUENCE_REVISION   1
+# define UNIXSTL_VER_UNIXSTL_FILESYSTEM_HPP_READDIR_SEQUENCE_EDIT       165
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 
@@ -113,6 +113,39 @@
 # define STLSOFT_INCL_H_DIRENT
 # include <dirent.h>
 #endif /* !STLSOFT_INCL_H_DIRENT */
+#ifndef STLSOFT_INCL_H_FCNTL
+# define STLSOFT_INCL_H_FCNTL
+# include <fcntl.h>
+#endif /* !STLSOFT_INCL_H_FCNTL */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+/* Entries are classified from dirent::d_type where the platform provides
+ * it (and it is not DT_UNKNOWN), and otherwise with fstatat() relative to
+ * the open directory, falling back to stat() of the full path only where
+ * neither is available.
+ */
+
+#ifdef UNIXSTL_READDIR_SEQUENCE_USE_D_TYPE_
+# undef UNIXSTL_READDIR_SEQUENCE_USE_D_TYPE_
+#endif /* UNIXSTL_READDIR_SEQUENCE_USE_D_TYPE_ */
+#ifdef UNIXSTL_READDIR_SEQUENCE_USE_FSTATAT_
+# undef UNIXSTL_READDIR_SEQUENCE_USE_FSTATAT_
+#endif /* UNIXSTL_READDIR_SEQUENCE_USE_FSTATAT_ */
+
+#if !defined(UNIXSTL_READDIR_SEQUENCE_NO_USE_D_TYPE) && \
+    (   defined(_DIRENT_HAVE_D_TYPE) || \
+        defined(DT_UNKNOWN))
+# define UNIXSTL_READDIR_SEQUENCE_USE_D_TYPE_
+#endif
+
+#if !defined(UNIXSTL_READDIR_SEQUENCE_NO_USE_FSTATAT) && \
+    defined(AT_FDCWD)
+# define UNIXSTL_READDIR_SEQUENCE_USE_FSTATAT_
+#endif
 
 
 /* /////////////////////////////////////////////////////////////////////////
@@ -231,6 +264,8 @@ public:
 #endif /* UNIXSTL_READDIR_SEQUENCE_OLD_VALUE_TYPE */
     /// The flags type
     typedef us_int_t                                        flags_type;
+    /// The stat data type
+    typedef traits_type::stat_data_type                     stat_data_type;
 
 public:
     typedef STLSOFT_NS_QUAL(basic_simple_string)<
@@ -378,6 +413,8 @@ public:
     typedef readdir_sequence::value_type                    value_type;
     /// The flags type
     typedef readdir_sequence::flags_type                    flags_type;
+    /// The stat data type
+    typedef readdir_sequence::stat_data_type                stat_data_type;
 //    typedef value_type*                                     pointer;
 //    typedef value_type&                                     reference;
 /// @}
@@ -426,6 +463,41 @@ public:
     bool equal(class_type const& rhs) const;
 /// @}
 
+/// \name Attributes
+/// @{
+public:
+    /// Indicates whether the iterator already holds the stat data of the
+    /// current entry
+    ///
+    /// \note The stat data is obtained during the iteration only when the
+    /// type of the entry cannot be determined from \c dirent::d_type
+    us_bool_t has_stat_data() const;
+
+    /// Obtains the stat data of the current entry
+    ///
+    /// If the iterator does not already hold the stat data, it is obtained
+    /// (and retained) on demand, relative to the open directory where the
+    /// platform allows. The data is that of \c stat(), i.e. symbolic links
+    /// are followed.
+    ///
+    /// \param sd Pointer to the structure to receive the data. May not be
+    ///   \c NULL
+    ///
+    /// \retval true The data was obtained
+    /// \retval false The data could not be obtained, and \c errno
+    ///   indicates the reason
+    us_bool_t get_stat_data(stat_data_type* sd) const;
+/// @}
+
+/// \name Implementation
+/// @{
+private:
+#ifdef UNIXSTL_READDIR_SEQUENCE_USE_D_TYPE_
+    static mode_t mode_from_d_type_(struct dirent const* entry);
+#endif /* UNIXSTL_READDIR_SEQUENCE_USE_D_TYPE_ */
+    us_bool_t stat_entry_(stat_data_type* sd) const;
+/// @}
+
 /// \name Members
 /// @{
 private:
@@ -436,6 +508,8 @@ private:
     flags_type      m_flags;    // flags. (Only non-const, to allow copy assignment)
     string_type     m_scratch;  // Holds the directory, and is a scratch area
     size_type       m_dirLen;   // The length of the directory (in `m_scratch`)
+    mutable stat_data_type  m_stat;     // The stat data of the current entry, if `m_hasStat`
+    mutable us_bool_t       m_hasStat;  // Whether `m_stat` is valid for the current entry
 /// @}
 };
 
@@ -731,6 +805,8 @@ readdir_sequence::const_iterator::const_iterator(
     , m_flags(flags)
     , m_scratch(directory)
     , m_dirLen(directory.size())
+    , m_stat()
+    , m_hasStat(false)
 {
     UNIXSTL_ASSERT(traits_type::has_dir_end(m_scratch.c_str()));
 
@@ -751,6 +827,8 @@ readdir_sequence::const_iterator::const_iterator()
     , m_flags(0)
     , m_scratch()
     , m_dirLen(0)
+    , m_stat()
+    , m_hasStat(false)
 {}
 
 inline
@@ -762,6 +840,8 @@ readdir_sequence::const_iterator::const_iterator(
     , m_flags(rhs.m_flags)
     , m_scratch(rhs.m_scratch)
     , m_dirLen(rhs.m_dirLen)
+    , m_stat(rhs.m_stat)
+    , m_hasStat(rhs.m_hasStat)
 {
     if (NULL != m_handle)
     {
@@ -791,6 +871,8 @@ readdir_sequence::const_iterator::operator =(
     m_flags   =   rhs.m_flags;
     m_scratch =   rhs.m_scratch;
     m_dirLen  =   rhs.m_dirLen;
+    m_stat    =   rhs.m_stat;
+    m_hasStat =   rhs.m_hasStat;
 
     if (NULL != m_handle)
     {
@@ -855,15 +937,14 @@ readdir_sequence::const_iterator::operator ++()
                 }
             }
 
-            // If either
-            //
-            // - eliding files or directories, or
-            // - requiring absolute path
-            //
-            // then need to construct it.
-#ifdef _WIN32
-            if ((m_flags & (fullPath | directories | files)) != (directories | files))
-#endif /* _WIN32 */
+            m_hasStat = false;
+
+            // The full path is needed for the result if `fullPath` is
+            // specified, and also for stat-ing the entry if that cannot
+            // be done relative to the directory
+#ifdef UNIXSTL_READDIR_SEQUENCE_USE_FSTATAT_
+            if (fullPath & m_flags)
+#endif /* UNIXSTL_READDIR_SEQUENCE_USE_FSTATAT_ */
             {
                 // Truncate the scratch to the directory path, ...
                 m_scratch.resize(m_dirLen);
@@ -875,45 +956,56 @@ readdir_sequence::const_iterator::operator ++()
             if ((m_flags & (directories | files)) != (directories | files))
 #endif /* _WIN32 */
             {
-                // Now need to process the file, by using stat
-                traits_type::stat_data_type st;
+                mode_t mode = 0;
 
-                if (!traits_type::stat(m_scratch.c_str(), &st))
-                {
-                    // Failed to get info from entry. Must assume it is
-                    // dead, so skip it
-                    continue;
-                }
-                else
+#ifdef UNIXSTL_READDIR_SEQUENCE_USE_D_TYPE_
+                mode = mode_from_d_type_(m_entry);
+
+                if (0 == mode)
+#endif /* UNIXSTL_READDIR_SEQUENCE_USE_D_TYPE_ */
                 {
-#ifndef _WIN32
-                    // Test for sockets : this version does not support sockets,
-                    // but does elide them from the search results.
-                    if (traits_type::is_socket(&st))
+                    // Type not known (or a link), so need to stat it
+
+                    if (!stat_entry_(&m_stat))
                     {
+                        // Failed to get info from entry. Must assume it is
+                        // dead, so skip it
                         continue;
                     }
+
+                    m_hasStat   =   true;
+                    mode        =   m_stat.st_mode;
+                }
+
+                mode &= S_IFMT;
+
+#ifndef _WIN32
+                // Test for sockets : this version does not support sockets,
+                // but does elide them from the search results.
+                if (S_IFSOCK == mode)
+                {
+                    continue;
+                }
 #endif /* !_WIN32 */
 
-                    if (m_flags & directories) // Want directories
+                if (m_flags & directories) // Want directories
+                {
+                    if (S_IFDIR == mode)
                     {
-                        if (traits_type::is_directory(&st))
-                        {
-                            // It is a directory, so accept it
-                            break;
-                        }
+                        // It is a directory, so accept it
+                        break;
                     }
-                    if (m_flags & files) // Want files
+                }
+                if (m_flags & files) // Want files
+                {
+                    if (S_IFREG == mode)
                     {
-                        if (traits_type::is_file(&st))
-                        {
-                            // It is a file, so accept it
-                            break;
-                        }
+                        // It is a file, so accept it
+                        break;
                     }
-
-                    continue; // Not a match, so skip this entry
                 }
+
+                continue; // Not a match, so skip this entry
             }
         }
 
@@ -943,6 +1035,88 @@ readdir_sequence::const_iterator::operator ++(int)
     return ret;
 }
 
+inline
+us_bool_t
+readdir_sequence::const_iterator::has_stat_data() const
+{
+    UNIXSTL_MESSAGE_ASSERT("Querying invalid iterator", NULL != m_entry);
+
+    return m_hasStat;
+}
+
+inline
+us_bool_t
+readdir_sequence::const_iterator::get_stat_data(
+    readdir_sequence::const_iterator::stat_data_type* sd
+) const
+{
+    UNIXSTL_MESSAGE_ASSERT("Querying invalid iterator", NULL != m_entry);
+    UNIXSTL_ASSERT(NULL != sd);
+
+    if (!m_hasStat)
+    {
+        if (!stat_entry_(&m_stat))
+        {
+            return false;
+        }
+
+        m_hasStat = true;
+    }
+
+    *sd = m_stat;
+
+    return true;
+}
+
+#ifdef UNIXSTL_READDIR_SEQUENCE_USE_D_TYPE_
+inline
+/* static */
+mode_t
+readdir_sequence::const_iterator::mode_from_d_type_(
+    struct dirent const* entry
+)
+{
+    // Links are reported as 0, along with DT_UNKNOWN, since the type of
+    // the entry must reflect that of what it refers to
+
+    switch (entry->d_type)
+    {
+    case DT_DIR:    return S_IFDIR;
+    case DT_REG:    return S_IFREG;
+# ifdef DT_SOCK
+    case DT_SOCK:   return S_IFSOCK;
+# endif /* DT_SOCK */
+# ifdef DT_FIFO
+    case DT_FIFO:   return S_IFIFO;
+# endif /* DT_FIFO */
+# ifdef DT_CHR
+    case DT_CHR:    return S_IFCHR;
+# endif /* DT_CHR */
+# ifdef DT_BLK
+    case DT_BLK:    return S_IFBLK;
+# endif /* DT_BLK */
+    default:        return 0;
+    }
+}
+#endif /* UNIXSTL_READDIR_SEQUENCE_USE_D_TYPE_ */
+
+inline
+us_bool_t
+readdir_sequence::const_iterator::stat_entry_(
+    readdir_sequence::const_iterator::stat_data_type* sd
+) const
+{
+    UNIXSTL_ASSERT(NULL != m_handle);
+    UNIXSTL_ASSERT(NULL != m_entry);
+
+#ifdef UNIXSTL_READDIR_SEQUENCE_USE_FSTATAT_
+    return 0 == ::fstatat(::dirfd(m_handle->m_dir), m_entry->d_name, sd, 0);
+#else /* ? UNIXSTL_READDIR_SEQUENCE_USE_FSTATAT_ */
+    // `m_scratch` holds the full path of the entry (see `operator ++()`)
+    return traits_type::stat(m_scratch.c_str(), sd);
+#endif /* UNIXSTL_READDIR_SEQUENCE_USE_FSTATAT_ */
+}
+
 inline
 bool
 readdir_sequence::const_iterator::equal(
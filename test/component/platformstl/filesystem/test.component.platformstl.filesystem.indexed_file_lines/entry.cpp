@@ -0,0 +1,336 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.component.platformstl.filesystem.indexed_file_lines/entry.cpp
+ *
+ * Purpose: Component-tests for `platformstl::indexed_file_lines`.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* /////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <platformstl/filesystem/indexed_file_lines.hpp>
+
+/* /////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <platformstl/filesystem/file_lines.hpp>
+#include <stlsoft/stlsoft.h>
+
+/* Standard C++ header files */
+#include <algorithm>
+#include <string>
+
+/* Standard C header files */
+#include <stdio.h>
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_default_ctor(void);
+    static void test_empty_file(void);
+    static void test_one_line_no_eol(void);
+    static void test_mixed_eols(void);
+    static void test_matches_file_lines(void);
+    static void test_iterators(void);
+    static void test_binary_file(void);
+    static void test_parallel_matches_serial(void);
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char *argv[])
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.component.platformstl.filesystem.indexed_file_lines", verbosity))
+    {
+        XTESTS_RUN_CASE(test_default_ctor);
+        XTESTS_RUN_CASE(test_empty_file);
+        XTESTS_RUN_CASE(test_one_line_no_eol);
+        XTESTS_RUN_CASE(test_mixed_eols);
+        XTESTS_RUN_CASE(test_matches_file_lines);
+        XTESTS_RUN_CASE(test_iterators);
+        XTESTS_RUN_CASE(test_binary_file);
+        XTESTS_RUN_CASE(test_parallel_matches_serial);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * names
+ */
+
+namespace {
+
+    using platformstl::file_lines;
+    using platformstl::indexed_file_lines;
+} /* anonymous namespace */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helpers
+ */
+
+namespace {
+
+    char const TEMP_FILE_PATH[] = "test.component.platformstl.filesystem.indexed_file_lines.tmp";
+
+    // Writes the given contents to the temporary file, and removes it when
+    // the scope is exited
+    class temp_file
+    {
+    public:
+        explicit temp_file(std::string const& contents)
+        {
+            FILE* const f = ::fopen(TEMP_FILE_PATH, "wb");
+
+            if (NULL != f)
+            {
+                ::fwrite(contents.data(), 1, contents.size(), f);
+                ::fclose(f);
+            }
+        }
+        ~temp_file()
+        {
+            ::remove(TEMP_FILE_PATH);
+        }
+    private:
+        temp_file(temp_file const&);
+        void operator =(temp_file const&);
+    };
+
+    std::string
+    make_large_contents(
+        size_t  numLines
+    )
+    {
+        static char const* const EOLS[] =
+        {
+            "\n", "\r\n", "\r", "\n", "\n",
+        };
+
+        std::string contents;
+
+        for (size_t i = 0; i != numLines; ++i)
+        {
+            contents.append(1 + i % 97, static_cast<char>('a' + i % 26));
+            contents += EOLS[i % STLSOFT_NUM_ELEMENTS(EOLS)];
+        }
+
+        return contents;
+    }
+} /* anonymous namespace */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+static void test_default_ctor(void)
+{
+    indexed_file_lines lines;
+
+    XTESTS_TEST_BOOLEAN_TRUE(lines.empty());
+    XTESTS_TEST_INTEGER_EQUAL(0u, lines.size());
+    XTESTS_TEST_BOOLEAN_TRUE(lines.begin() == lines.end());
+}
+
+static void test_empty_file(void)
+{
+    temp_file tf("");
+
+    indexed_file_lines lines(TEMP_FILE_PATH);
+
+    XTESTS_TEST_BOOLEAN_TRUE(lines.empty());
+    XTESTS_TEST_INTEGER_EQUAL(0u, lines.size());
+}
+
+static void test_one_line_no_eol(void)
+{
+    temp_file tf("abc");
+
+    indexed_file_lines lines(TEMP_FILE_PATH);
+
+    XTESTS_TEST_INTEGER_EQUAL(1u, lines.size());
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc", lines[0]);
+    XTESTS_TEST_INTEGER_EQUAL(0u, lines.line_offset(0));
+}
+
+static void test_mixed_eols(void)
+{
+    temp_file tf("line-1\r\nline-2\nline-3\rline-4\n\n\r\n\r\rline-9\r");
+
+    indexed_file_lines lines(TEMP_FILE_PATH);
+
+    XTESTS_TEST_INTEGER_EQUAL(9u, lines.size());
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("line-1", lines[0]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("line-2", lines[1]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("line-3", lines[2]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("line-4", lines[3]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", lines[4]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", lines[5]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", lines[6]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", lines[7]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("line-9", lines[8]);
+
+    XTESTS_TEST_INTEGER_EQUAL(8u, lines.line_offset(1));
+    XTESTS_TEST_INTEGER_EQUAL(15u, lines.line_offset(2));
+}
+
+static void test_matches_file_lines(void)
+{
+    static char const* const CONTENTS[] =
+    {
+        "\n",
+        "\r",
+        "\r\n",
+        "\n\r",
+        "\r\r",
+        "\n\n",
+        "a\n",
+        "a\r\n",
+        "a\r",
+        "\r\r\n",
+        "x\r\r\n",
+        "a\nb",
+        "a\r\rb\n\rc\r\n",
+        "0123456789abcdef0123456789abcdef\r\n0123456789abcdef\n0123456789abcdef0123456789abcdef012\r",
+    };
+
+    for (size_t i = 0; i != STLSOFT_NUM_ELEMENTS(CONTENTS); ++i)
+    {
+        temp_file tf(CONTENTS[i]);
+
+        file_lines          expected(TEMP_FILE_PATH);
+        indexed_file_lines  actual(TEMP_FILE_PATH);
+
+        XTESTS_TEST_INTEGER_EQUAL(expected.size(), actual.size());
+
+        for (size_t j = 0; j != expected.size() && j != actual.size(); ++j)
+        {
+            XTESTS_TEST_MULTIBYTE_STRING_EQUAL(expected[j], actual[j]);
+        }
+    }
+}
+
+static void test_iterators(void)
+{
+    temp_file tf("abc\ndef\nghi\n");
+
+    indexed_file_lines lines(TEMP_FILE_PATH);
+
+    XTESTS_TEST_INTEGER_EQUAL(3, lines.end() - lines.begin());
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc", *lines.begin());
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("ghi", *(lines.end() - 1));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("def", lines.begin()[1]);
+
+    indexed_file_lines::const_iterator it = lines.begin();
+
+    ++it;
+    it++;
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("ghi", *it);
+    XTESTS_TEST_BOOLEAN_TRUE(lines.begin() < it);
+
+    XTESTS_TEST_INTEGER_EQUAL(1, std::count(lines.begin(), lines.end(), indexed_file_lines::value_type("def")));
+}
+
+static void test_binary_file(void)
+{
+    temp_file tf(std::string("abc\ndef\0ghi\n", 12));
+
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+
+    try
+    {
+        indexed_file_lines lines(TEMP_FILE_PATH);
+
+        XTESTS_TEST_FAIL("should not get here");
+    }
+    catch (platformstl::invalid_file_type_exception&)
+    {
+        XTESTS_TEST_PASSED();
+    }
+#else /* ? STLSOFT_CF_EXCEPTION_SUPPORT */
+
+    indexed_file_lines lines(TEMP_FILE_PATH);
+
+    XTESTS_TEST_BOOLEAN_TRUE(lines.empty());
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+}
+
+static void test_parallel_matches_serial(void)
+{
+    // large enough to be split into several chunks, with chunk boundaries
+    // falling at arbitrary points with respect to the line-ends
+
+    std::string const contents = make_large_contents(200000);
+
+    XTESTS_TEST_INTEGER_GREATER(4u * indexed_file_lines::min_chars_per_thread, contents.size());
+
+    temp_file tf(contents);
+
+    file_lines          expected(TEMP_FILE_PATH);
+    indexed_file_lines  serial(TEMP_FILE_PATH, 1);
+    indexed_file_lines  parallel(TEMP_FILE_PATH, 4);
+    indexed_file_lines  parallel7(TEMP_FILE_PATH, 7);
+
+    XTESTS_TEST_INTEGER_EQUAL(200000u, expected.size());
+    XTESTS_TEST_INTEGER_EQUAL(expected.size(), serial.size());
+    XTESTS_TEST_INTEGER_EQUAL(expected.size(), parallel.size());
+    XTESTS_TEST_INTEGER_EQUAL(expected.size(), parallel7.size());
+
+    size_t numMismatches = 0;
+
+    for (size_t i = 0; i != expected.size() && i != parallel.size() && i != parallel7.size(); ++i)
+    {
+        if (expected[i] != serial[i] ||
+            expected[i] != parallel[i] ||
+            expected[i] != parallel7[i])
+        {
+            ++numMismatches;
+        }
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, numMismatches);
+}
+
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,572 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.component.unixstl.filesystem.directory_walker/entry.cpp
+ *
+ * Purpose: Component test for `unixstl::directory_walker`.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <unixstl/filesystem/directory_walker.hpp>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+#include <xtests/util/temp_directory.hpp>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+
+/* Standard C++ header files */
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <string>
+
+/* Standard C header files */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* UNIX header files */
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_nonexistent_root(void);
+    static void test_empty_directory(void);
+    static void test_walk(void);
+    static void test_walk_threads(void);
+    static void test_entry_attributes(void);
+    static void test_max_depth(void);
+    static void test_filter(void);
+    static void test_links_not_followed(void);
+    static void test_links_followed(void);
+    static void test_callback_exception(void);
+    static void test_next(void);
+    static void test_next_stop(void);
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char *argv[])
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.component.unixstl.filesystem.directory_walker", verbosity))
+    {
+        XTESTS_RUN_CASE_THAT_THROWS(test_nonexistent_root, unixstl::directory_walker_exception);
+        XTESTS_RUN_CASE(test_empty_directory);
+        XTESTS_RUN_CASE(test_walk);
+        XTESTS_RUN_CASE(test_walk_threads);
+        XTESTS_RUN_CASE(test_entry_attributes);
+        XTESTS_RUN_CASE(test_max_depth);
+        XTESTS_RUN_CASE(test_filter);
+        XTESTS_RUN_CASE(test_links_not_followed);
+        XTESTS_RUN_CASE(test_links_followed);
+        XTESTS_RUN_CASE(test_callback_exception);
+        XTESTS_RUN_CASE(test_next);
+        XTESTS_RUN_CASE(test_next_stop);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+    typedef unixstl::directory_walker                       walker_t;
+    typedef unixstl::directory_walker_entry                 entry_t;
+    typedef std::set<std::string>                           paths_t;
+
+    using ::xtests::cpp::util::temp_directory;
+
+    int const TEMP_DIRECTORY_FLAGS = temp_directory::EmptyOnClose | temp_directory::EmptyOnOpen | temp_directory::RemoveOnClose;
+
+    // The number of directories at each level of the tree
+    int const   FAN_OUT     =   3;
+    // The number of files in each directory
+    int const   NUM_FILES   =   4;
+    // The depth of the tree
+    int const   TREE_DEPTH  =   4;
+
+    void
+    make_file(
+        std::string const& path
+    )
+    {
+        fclose(fopen(path.c_str(), "w"));
+    }
+
+    // Creates a tree of TREE_DEPTH levels of directories, each of which has
+    // FAN_OUT subdirectories (other than those at the lowest level) and
+    // NUM_FILES files, adding all entries' paths to `dirs` and `files`
+    void
+    make_tree(
+        std::string const&  path
+    ,   int                 depth
+    ,   paths_t&            dirs
+    ,   paths_t&            files
+    )
+    {
+        for (int i = 0; i != NUM_FILES; ++i)
+        {
+            std::string const file = path + "/f" + std::to_string(i);
+
+            make_file(file);
+            files.insert(file);
+        }
+
+        if (depth < TREE_DEPTH)
+        {
+            for (int i = 0; i != FAN_OUT; ++i)
+            {
+                std::string const dir = path + "/d" + std::to_string(i);
+
+                ::mkdir(dir.c_str(), 0700);
+                dirs.insert(dir);
+
+                make_tree(dir, depth + 1, dirs, files);
+            }
+        }
+    }
+
+    // Walks, collecting the paths of the entries
+    paths_t
+    collect(
+        walker_t&           walker
+    ,   std::string const&  root
+    )
+    {
+        std::mutex  mx;
+        paths_t     paths;
+
+        walker_t::size_type const n = walker.walk(root, [&](entry_t const& entry) {
+
+            std::lock_guard<std::mutex> lock(mx);
+
+            paths.insert(entry.path());
+        });
+
+        XTESTS_TEST_INTEGER_EQUAL(paths.size(), n);
+
+        return paths;
+    }
+
+    paths_t
+    merge(
+        paths_t const& lhs
+    ,   paths_t const& rhs
+    )
+    {
+        paths_t r(lhs);
+
+        r.insert(rhs.begin(), rhs.end());
+
+        return r;
+    }
+
+
+static void test_nonexistent_root(void)
+{
+    walker_t walker;
+
+    walker.walk("/this/directory/does/not/exist", [](entry_t const&) {});
+}
+
+static void test_empty_directory(void)
+{
+    temp_directory  dir(TEMP_DIRECTORY_FLAGS);
+    walker_t        walker;
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, walker.walk(dir.c_str(), [](entry_t const&) {}));
+}
+
+static void test_walk(void)
+{
+    temp_directory  dir(TEMP_DIRECTORY_FLAGS);
+    paths_t         dirs;
+    paths_t         files;
+
+    make_tree(dir.c_str(), 1, dirs, files);
+
+    {
+        walker_t walker;
+
+        XTESTS_TEST_BOOLEAN_TRUE(merge(dirs, files) == collect(walker, dir.c_str()));
+    }
+
+    {
+        walker_t walker(walker_t::files);
+
+        XTESTS_TEST_BOOLEAN_TRUE(files == collect(walker, dir.c_str()));
+    }
+
+    {
+        walker_t walker(walker_t::directories);
+
+        XTESTS_TEST_BOOLEAN_TRUE(dirs == collect(walker, dir.c_str()));
+    }
+
+    // trailing separators on the root are ignored
+
+    {
+        walker_t walker(walker_t::directories);
+
+        XTESTS_TEST_BOOLEAN_TRUE(dirs == collect(walker, std::string(dir.c_str()) + "//"));
+    }
+}
+
+static void test_walk_threads(void)
+{
+    temp_directory  dir(TEMP_DIRECTORY_FLAGS);
+    paths_t         dirs;
+    paths_t         files;
+
+    make_tree(dir.c_str(), 1, dirs, files);
+
+    paths_t const all = merge(dirs, files);
+
+    for (unsigned n = 1; n <= 16; n *= 2)
+    {
+        walker_t walker(walker_t::directories | walker_t::files, n);
+
+        XTESTS_TEST_INTEGER_EQUAL(n, walker.num_threads());
+        XTESTS_TEST_BOOLEAN_TRUE(all == collect(walker, dir.c_str()));
+    }
+}
+
+static void test_entry_attributes(void)
+{
+    temp_directory  dir(TEMP_DIRECTORY_FLAGS);
+    std::string     root(dir.c_str());
+
+    ::mkdir((root + "/a").c_str(), 0700);
+    ::mkdir((root + "/a/b").c_str(), 0700);
+    make_file(root + "/a/b/c");
+    ::mkfifo((root + "/a/p").c_str(), 0600);
+
+    walker_t                        walker(walker_t::directories | walker_t::files | walker_t::others);
+    std::mutex                      mx;
+    std::map<std::string, entry_t>  entries;
+
+    walker.walk(root, [&](entry_t const& entry) {
+
+        std::lock_guard<std::mutex> lock(mx);
+
+        entries[entry.name()] = entry;
+    });
+
+    XTESTS_TEST_INTEGER_EQUAL(4u, entries.size());
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL(root + "/a", entries["a"].path());
+    XTESTS_TEST_INTEGER_EQUAL(1u, entries["a"].depth());
+    XTESTS_TEST_BOOLEAN_TRUE(entries["a"].is_directory());
+    XTESTS_TEST_BOOLEAN_FALSE(entries["a"].is_link());
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL(root + "/a/b", entries["b"].path());
+    XTESTS_TEST_INTEGER_EQUAL(2u, entries["b"].depth());
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL(root + "/a/b/c", entries["c"].path());
+    XTESTS_TEST_INTEGER_EQUAL(3u, entries["c"].depth());
+    XTESTS_TEST_BOOLEAN_TRUE(entries["c"].is_file());
+    XTESTS_TEST_BOOLEAN_FALSE(entries["c"].is_directory());
+
+    XTESTS_TEST_INTEGER_EQUAL(2u, entries["p"].depth());
+    XTESTS_TEST_BOOLEAN_TRUE(S_IFIFO == entries["p"].type());
+}
+
+static void test_max_depth(void)
+{
+    temp_directory  dir(TEMP_DIRECTORY_FLAGS);
+    paths_t         dirs;
+    paths_t         files;
+
+    make_tree(dir.c_str(), 1, dirs, files);
+
+    for (unsigned maxDepth = 1; maxDepth <= TREE_DEPTH; ++maxDepth)
+    {
+        walker_t    walker(walker_t::directories | walker_t::files, 4);
+        std::mutex  mx;
+        unsigned    maxSeen = 0;
+
+        walker.set_max_depth(maxDepth);
+
+        walker_t::size_type const n = walker.walk(dir.c_str(), [&](entry_t const& entry) {
+
+            std::lock_guard<std::mutex> lock(mx);
+
+            maxSeen = std::max<unsigned>(maxSeen, entry.depth());
+        });
+
+        // each level has FAN_OUT times as many directories as the one
+        // above, and each directory (and the root) NUM_FILES files
+
+        walker_t::size_type expected    =   0;
+        walker_t::size_type numDirs     =   1;
+
+        for (unsigned level = 1; level <= maxDepth; ++level)
+        {
+            expected += numDirs * NUM_FILES;
+            numDirs *= FAN_OUT;
+            if (level < TREE_DEPTH)
+            {
+                expected += numDirs;
+            }
+        }
+
+        XTESTS_TEST_INTEGER_EQUAL(maxDepth, maxSeen);
+        XTESTS_TEST_INTEGER_EQUAL(expected, n);
+    }
+}
+
+static void test_filter(void)
+{
+    temp_directory  dir(TEMP_DIRECTORY_FLAGS);
+    paths_t         dirs;
+    paths_t         files;
+
+    make_tree(dir.c_str(), 1, dirs, files);
+
+    // a filtered directory is not descended, at whatever depth
+
+    walker_t walker(walker_t::files, 3);
+
+    walker.set_filter([](entry_t const& entry) {
+
+        return 0 != ::strcmp("d0", entry.name());
+    });
+
+    paths_t const   paths = collect(walker, dir.c_str());
+    paths_t         expected;
+
+    for (auto const& f : files)
+    {
+        if (std::string::npos == f.find("/d0/"))
+        {
+            expected.insert(f);
+        }
+    }
+
+    XTESTS_TEST_INTEGER_LESS(files.size(), expected.size());
+    XTESTS_TEST_BOOLEAN_TRUE(expected == paths);
+}
+
+static void test_links_not_followed(void)
+{
+    temp_directory  dir(TEMP_DIRECTORY_FLAGS);
+    std::string     root(dir.c_str());
+
+    ::mkdir((root + "/a").c_str(), 0700);
+    make_file(root + "/a/f");
+    ::symlink("..", (root + "/a/up").c_str());
+    ::symlink("f", (root + "/a/lf").c_str());
+    ::symlink("nonexistent", (root + "/a/dangling").c_str());
+
+    {
+        walker_t walker;
+
+        paths_t const paths = collect(walker, root);
+
+        XTESTS_TEST_INTEGER_EQUAL(2u, paths.size());
+        XTESTS_TEST_INTEGER_EQUAL(1u, paths.count(root + "/a/f"));
+    }
+
+    {
+        walker_t walker(walker_t::links);
+
+        std::atomic<int> numLinks(0);
+
+        walker.walk(root, [&](entry_t const& entry) {
+
+            if (S_IFLNK == entry.type() && entry.is_link())
+            {
+                ++numLinks;
+            }
+        });
+
+        XTESTS_TEST_INTEGER_EQUAL(3, numLinks.load());
+    }
+}
+
+static void test_links_followed(void)
+{
+    temp_directory  dir(TEMP_DIRECTORY_FLAGS);
+    std::string     root(dir.c_str());
+
+    ::mkdir((root + "/a").c_str(), 0700);
+    ::mkdir((root + "/b").c_str(), 0700);
+    make_file(root + "/b/f");
+    ::symlink("../b", (root + "/a/lb").c_str());
+    ::symlink("..", (root + "/a/up").c_str());
+    ::symlink("nonexistent", (root + "/a/dangling").c_str());
+
+    walker_t    walker(walker_t::directories | walker_t::files | walker_t::links | walker_t::followLinks, 2);
+    std::mutex  mx;
+    paths_t     paths;
+    paths_t     links;
+
+    walker.walk(root, [&](entry_t const& entry) {
+
+        std::lock_guard<std::mutex> lock(mx);
+
+        paths.insert(entry.path());
+
+        if (entry.is_link())
+        {
+            links.insert(entry.name());
+        }
+    });
+
+    // the links are delivered as what they refer to (if anything), and the
+    // walk terminates despite the cycle; "b" is descended once, via either
+    // the directory or the link
+
+    XTESTS_TEST_INTEGER_EQUAL(3u, links.size());
+    XTESTS_TEST_INTEGER_EQUAL(1u, paths.count(root + "/a/up"));
+    XTESTS_TEST_INTEGER_EQUAL(1u, paths.count(root + "/a/dangling"));
+    XTESTS_TEST_INTEGER_EQUAL(1, int(paths.count(root + "/b/f") + paths.count(root + "/a/lb/f")));
+}
+
+static void test_callback_exception(void)
+{
+    temp_directory  dir(TEMP_DIRECTORY_FLAGS);
+    paths_t         dirs;
+    paths_t         files;
+
+    make_tree(dir.c_str(), 1, dirs, files);
+
+    walker_t    walker(walker_t::files, 4);
+    bool        caught = false;
+
+    try
+    {
+        walker.walk(dir.c_str(), [](entry_t const& entry) {
+
+            if (0 == ::strcmp("f2", entry.name()))
+            {
+                throw std::runtime_error("stop");
+            }
+        });
+    }
+    catch (std::runtime_error&)
+    {
+        caught = true;
+    }
+
+    XTESTS_TEST_BOOLEAN_TRUE(caught);
+}
+
+static void test_next(void)
+{
+    temp_directory  dir(TEMP_DIRECTORY_FLAGS);
+    paths_t         dirs;
+    paths_t         files;
+
+    make_tree(dir.c_str(), 1, dirs, files);
+
+    walker_t    walker(walker_t::directories | walker_t::files, 4);
+    entry_t     entry;
+    paths_t     paths;
+
+    // a small queue, so that the walking threads block
+
+    walker.set_queue_capacity(2);
+
+    XTESTS_TEST_BOOLEAN_FALSE(walker.next(entry));
+
+    walker.start(dir.c_str());
+
+    for (; walker.next(entry); )
+    {
+        XTESTS_TEST_BOOLEAN_TRUE(paths.insert(entry.path()).second);
+    }
+
+    XTESTS_TEST_BOOLEAN_TRUE(merge(dirs, files) == paths);
+    XTESTS_TEST_BOOLEAN_FALSE(walker.next(entry));
+
+    // and again
+
+    paths.clear();
+
+    walker.start(dir.c_str());
+
+    for (; walker.next(entry); )
+    {
+        paths.insert(entry.path());
+    }
+
+    XTESTS_TEST_BOOLEAN_TRUE(merge(dirs, files) == paths);
+}
+
+static void test_next_stop(void)
+{
+    temp_directory  dir(TEMP_DIRECTORY_FLAGS);
+    paths_t         dirs;
+    paths_t         files;
+
+    make_tree(dir.c_str(), 1, dirs, files);
+
+    {
+        walker_t    walker(walker_t::files, 4);
+        entry_t     entry;
+
+        walker.set_queue_capacity(1);
+        walker.start(dir.c_str());
+
+        XTESTS_TEST_BOOLEAN_TRUE(walker.next(entry));
+
+        walker.stop();
+
+        XTESTS_TEST_BOOLEAN_FALSE(walker.next(entry));
+    }
+
+    // abandoned by destruction
+
+    {
+        walker_t walker(walker_t::files, 4);
+
+        walker.set_queue_capacity(1);
+        walker.start(dir.c_str());
+    }
+}
+
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,300 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.component.unixstl.filesystem.memory_mapped_file_line_reader/entry.cpp
+ *
+ * Purpose: Component test for `unixstl::memory_mapped_file_line_reader`.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <unixstl/filesystem/memory_mapped_file_line_reader.hpp>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+#include <xtests/util/temp_file.hpp>
+
+/* STLSoft header files */
+#include <platformstl/filesystem/file_lines.hpp>
+#include <stlsoft/stlsoft.h>
+
+/* Standard C++ header files */
+#include <string>
+#include <vector>
+
+/* Standard C header files */
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_nonexisting_file(void);
+    static void test_empty_file(void);
+    static void test_short_file(void);
+    static void test_from_offset(void);
+    static void test_iterator(void);
+    static void test_lines_straddling_windows(void);
+    static void test_lines_longer_than_window(void);
+    static void test_cr_at_end_of_window(void);
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char *argv[])
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.component.unixstl.filesystem.memory_mapped_file_line_reader", verbosity))
+    {
+        XTESTS_RUN_CASE_THAT_THROWS(test_nonexisting_file, unixstl::filesystem_exception);
+        XTESTS_RUN_CASE(test_empty_file);
+        XTESTS_RUN_CASE(test_short_file);
+        XTESTS_RUN_CASE(test_from_offset);
+        XTESTS_RUN_CASE(test_iterator);
+        XTESTS_RUN_CASE(test_lines_straddling_windows);
+        XTESTS_RUN_CASE(test_lines_longer_than_window);
+        XTESTS_RUN_CASE(test_cr_at_end_of_window);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helpers
+ */
+
+namespace
+{
+
+    using ::xtests::cpp::util::temp_file;
+
+    typedef unixstl::memory_mapped_file_line_reader         reader_t;
+    typedef std::vector<std::string>                        strings_t;
+
+    strings_t
+    read_all_lines(
+        reader_t& reader
+    )
+    {
+        strings_t               lines;
+        reader_t::string_view_type line;
+
+        for (; reader.read_line(line); )
+        {
+            lines.push_back(std::string(line.data(), line.size()));
+        }
+
+        return lines;
+    }
+
+    // Verifies that the reader, with the smallest possible window, gives
+    // the same lines as platformstl::file_lines
+    void
+    verify_as_file_lines(
+        std::string const& contents
+    )
+    {
+        temp_file f(temp_file::DeleteOnClose | temp_file::EmptyOnOpen | temp_file::CloseOnOpen, contents.data(), contents.size());
+
+        platformstl::file_lines expected(f.c_str());
+        reader_t                reader(f.c_str(), 1);
+        strings_t const         actual = read_all_lines(reader);
+
+        XTESTS_TEST_INTEGER_EQUAL(expected.size(), actual.size());
+
+        size_t numMismatches = 0;
+
+        for (size_t i = 0; i != expected.size() && i != actual.size(); ++i)
+        {
+            if (std::string(expected[i].data(), expected[i].size()) != actual[i])
+            {
+                ++numMismatches;
+            }
+        }
+
+        XTESTS_TEST_INTEGER_EQUAL(0u, numMismatches);
+        XTESTS_TEST_INTEGER_EQUAL(reader.file_size(), reader.offset());
+    }
+
+
+static void test_nonexisting_file(void)
+{
+    temp_file f(temp_file::DeleteOnOpen | temp_file::DeleteOnClose);
+
+    reader_t reader(f.c_str());
+
+    XTESTS_TEST_FAIL("should not get here");
+
+    STLSOFT_SUPPRESS_UNUSED(reader);
+}
+
+static void test_empty_file(void)
+{
+    temp_file f(temp_file::DeleteOnClose | temp_file::EmptyOnOpen | temp_file::CloseOnOpen);
+
+    reader_t                    reader(f.c_str());
+    reader_t::string_view_type  line;
+
+    XTESTS_TEST_INTEGER_EQUAL(0, reader.file_size());
+    XTESTS_TEST_BOOLEAN_FALSE(reader.read_line(line));
+    XTESTS_TEST_BOOLEAN_FALSE(reader.read_line(line));
+}
+
+static void test_short_file(void)
+{
+    char const contents[] = "abc\r\ndef\n\rghi";
+
+    temp_file f(temp_file::DeleteOnClose | temp_file::EmptyOnOpen | temp_file::CloseOnOpen, contents, STLSOFT_NUM_ELEMENTS(contents) - 1);
+
+    reader_t        reader(f.c_str());
+    strings_t const lines = read_all_lines(reader);
+
+    XTESTS_TEST_INTEGER_EQUAL(4u, lines.size());
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc", lines[0]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("def", lines[1]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", lines[2]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("ghi", lines[3]);
+}
+
+static void test_from_offset(void)
+{
+    char const contents[] = "first\nsecond\nthird\n";
+
+    temp_file f(temp_file::DeleteOnClose | temp_file::EmptyOnOpen | temp_file::CloseOnOpen, contents, STLSOFT_NUM_ELEMENTS(contents) - 1);
+
+    {
+        reader_t        reader(f.c_str(), 6, 0);
+        strings_t const lines = read_all_lines(reader);
+
+        XTESTS_TEST_INTEGER_EQUAL(2u, lines.size());
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("second", lines[0]);
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("third", lines[1]);
+    }
+
+    {
+        reader_t        reader(f.c_str(), 9, 0);
+        strings_t const lines = read_all_lines(reader);
+
+        XTESTS_TEST_INTEGER_EQUAL(2u, lines.size());
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("ond", lines[0]);
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("third", lines[1]);
+    }
+
+    {
+        reader_t        reader(f.c_str(), 1000, 0);
+        strings_t const lines = read_all_lines(reader);
+
+        XTESTS_TEST_INTEGER_EQUAL(0u, lines.size());
+    }
+}
+
+static void test_iterator(void)
+{
+    char const contents[] = "a\nbb\nccc";
+
+    temp_file f(temp_file::DeleteOnClose | temp_file::EmptyOnOpen | temp_file::CloseOnOpen, contents, STLSOFT_NUM_ELEMENTS(contents) - 1);
+
+    reader_t    reader(f.c_str());
+    strings_t   lines;
+
+    for (reader_t::const_iterator i = reader.begin(); i != reader.end(); ++i)
+    {
+        lines.push_back(std::string(i->data(), i->size()));
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(3u, lines.size());
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("a", lines[0]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("bb", lines[1]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("ccc", lines[2]);
+}
+
+static void test_lines_straddling_windows(void)
+{
+    static char const* const EOLS[] = { "\n", "\r\n", "\r" };
+
+    std::string contents;
+
+    for (size_t i = 0; i != 5000; ++i)
+    {
+        contents.append(1 + (i * 7) % 300, static_cast<char>('a' + i % 26));
+        contents += EOLS[i % STLSOFT_NUM_ELEMENTS(EOLS)];
+    }
+
+    verify_as_file_lines(contents);
+}
+
+static void test_lines_longer_than_window(void)
+{
+    std::string contents;
+
+    contents.append(20000, 'x');
+    contents += "\r\n";
+    contents += "short\n";
+    contents.append(9000, 'y');
+    contents += "\r";
+    contents.append(12345, 'z');
+
+    verify_as_file_lines(contents);
+}
+
+static void test_cr_at_end_of_window(void)
+{
+    // with CR, and CRLF split, at the ends of the first one or two pages,
+    // in each case with the line both shorter and longer than a page
+
+    long const      pageSize    =   ::sysconf(_SC_PAGESIZE);
+    size_t const    cchPage     =   static_cast<size_t>(pageSize);
+
+    for (size_t n = 1; n != 4; ++n)
+    {
+        std::string contents;
+
+        contents.append(n * cchPage - 1, 'a');
+        contents += "\r\nb\n";
+
+        verify_as_file_lines(contents);
+
+        contents.assign(n * cchPage - 1, 'a');
+        contents += "\rb\r";
+
+        verify_as_file_lines(contents);
+
+        contents.assign(10, 'c');
+        contents += '\n';
+        contents.append(n * cchPage - 12, 'a');
+        contents += "\r\nb\n";
+
+        verify_as_file_lines(contents);
+    }
+}
+
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -4,7 +4,7 @@
  * Purpose: Component test for `unixstl::readdir_sequence`.
  *
  * Created: sometime in 2010s
- * Updated: 11th October 2024
+ * Updated: 16th October 2026
  *
  * ////////////////////////////////////////////////////////////////////// */
 
@@ -27,9 +27,18 @@
 /* STLSoft header files */
 #include <stlsoft/stlsoft.h>
 
+/* Standard C++ header files */
+#include <set>
+#include <string>
+
 /* Standard C header files */
+#include <stdio.h>
 #include <stdlib.h>
 
+/* UNIX header files */
+#include <sys/stat.h>
+#include <unistd.h>
+
 
 /* /////////////////////////////////////////////////////////////////////////
  * forward declarations
@@ -40,6 +49,9 @@ namespace
 
     static void test_empty_directory(void);
     static void test_non_empty_directory(void);
+    static void test_entry_types(void);
+    static void test_full_path(void);
+    static void test_stat_data(void);
 } // anonymous namespace
 
 
@@ -58,6 +70,9 @@ int main(int argc, char *argv[])
     {
         XTESTS_RUN_CASE(test_empty_directory);
         XTESTS_RUN_CASE(test_non_empty_directory);
+        XTESTS_RUN_CASE(test_entry_types);
+        XTESTS_RUN_CASE(test_full_path);
+        XTESTS_RUN_CASE(test_stat_data);
 
         XTESTS_PRINT_RESULTS();
 
@@ -79,6 +94,56 @@ namespace
 
     using ::xtests::cpp::util::temp_directory;
 
+    typedef std::set<std::string>                           names_t;
+
+    int const TEMP_DIRECTORY_FLAGS = temp_directory::EmptyOnClose | temp_directory::EmptyOnOpen | temp_directory::RemoveOnClose;
+
+    std::string
+    make_path(
+        temp_directory const&   dir
+    ,   char const*             name
+    )
+    {
+        return std::string(dir.c_str()) + '/' + name;
+    }
+
+    // Populates the directory with:
+    //
+    // - files "f1" and "f2";
+    // - directories "d1" and "d2";
+    // - a link "l1" to "d1", and a link "l2" to "f1";
+    // - a dangling link "l3";
+    // - a FIFO "p1";
+    void
+    populate_directory(
+        temp_directory const& dir
+    )
+    {
+        fclose(fopen(make_path(dir, "f1").c_str(), "w"));
+        fclose(fopen(make_path(dir, "f2").c_str(), "w"));
+        ::mkdir(make_path(dir, "d1").c_str(), 0700);
+        ::mkdir(make_path(dir, "d2").c_str(), 0700);
+        ::symlink("d1", make_path(dir, "l1").c_str());
+        ::symlink("f1", make_path(dir, "l2").c_str());
+        ::symlink("nonexistent", make_path(dir, "l3").c_str());
+        ::mkfifo(make_path(dir, "p1").c_str(), 0600);
+    }
+
+    names_t
+    collect(
+        readdir_sequence_t const& rds
+    )
+    {
+        names_t names;
+
+        { for (readdir_sequence_t::const_iterator i = rds.begin(); rds.end() != i; ++i)
+        {
+            names.insert(*i);
+        }}
+
+        return names;
+    }
+
 
 static void test_empty_directory(void)
 {
@@ -97,6 +162,116 @@ static void test_non_empty_directory(void)
     XTESTS_TEST_BOOLEAN_FALSE(rds.empty());
 }
 
+static void test_entry_types(void)
+{
+    temp_directory dir(TEMP_DIRECTORY_FLAGS);
+
+    populate_directory(dir);
+
+    // links are classified by what they refer to, and dangling links,
+    // FIFOs, and dots directories are elided
+
+    {
+        readdir_sequence_t  rds(dir, readdir_sequence_t::files);
+        names_t const       names = collect(rds);
+
+        XTESTS_TEST_INTEGER_EQUAL(3u, names.size());
+        XTESTS_TEST_INTEGER_EQUAL(1u, names.count("f1"));
+        XTESTS_TEST_INTEGER_EQUAL(1u, names.count("f2"));
+        XTESTS_TEST_INTEGER_EQUAL(1u, names.count("l2"));
+    }
+
+    {
+        readdir_sequence_t  rds(dir, readdir_sequence_t::directories);
+        names_t const       names = collect(rds);
+
+        XTESTS_TEST_INTEGER_EQUAL(3u, names.size());
+        XTESTS_TEST_INTEGER_EQUAL(1u, names.count("d1"));
+        XTESTS_TEST_INTEGER_EQUAL(1u, names.count("d2"));
+        XTESTS_TEST_INTEGER_EQUAL(1u, names.count("l1"));
+    }
+
+    {
+        readdir_sequence_t  rds(dir);
+        names_t const       names = collect(rds);
+
+        XTESTS_TEST_INTEGER_EQUAL(6u, names.size());
+    }
+
+    {
+        readdir_sequence_t  rds(dir, readdir_sequence_t::directories | readdir_sequence_t::includeDots);
+        names_t const       names = collect(rds);
+
+        XTESTS_TEST_INTEGER_EQUAL(5u, names.size());
+        XTESTS_TEST_INTEGER_EQUAL(1u, names.count("."));
+        XTESTS_TEST_INTEGER_EQUAL(1u, names.count(".."));
+    }
+}
+
+static void test_full_path(void)
+{
+    temp_directory dir(TEMP_DIRECTORY_FLAGS);
+
+    populate_directory(dir);
+
+    readdir_sequence_t  rds(dir, readdir_sequence_t::files | readdir_sequence_t::fullPath);
+    names_t const       names = collect(rds);
+
+    XTESTS_TEST_INTEGER_EQUAL(3u, names.size());
+    XTESTS_TEST_INTEGER_EQUAL(1u, names.count(make_path(dir, "f1")));
+    XTESTS_TEST_INTEGER_EQUAL(1u, names.count(make_path(dir, "l2")));
+}
+
+static void test_stat_data(void)
+{
+    temp_directory dir(TEMP_DIRECTORY_FLAGS);
+
+    populate_directory(dir);
+
+    {
+        FILE* stm = fopen(make_path(dir, "f2").c_str(), "w");
+
+        fputs("abc", stm);
+        fclose(stm);
+    }
+
+    readdir_sequence_t rds(dir);
+
+    { for (readdir_sequence_t::const_iterator i = rds.begin(); rds.end() != i; ++i)
+    {
+        std::string const                   name(*i);
+        readdir_sequence_t::stat_data_type  sd;
+        struct stat                         st;
+
+        // a link is always stat-ed to classify it, so its data is held
+
+        if ('l' == name[0])
+        {
+            XTESTS_TEST_BOOLEAN_TRUE(i.has_stat_data());
+        }
+
+        XTESTS_TEST_BOOLEAN_TRUE(i.get_stat_data(&sd));
+        XTESTS_TEST_BOOLEAN_TRUE(i.has_stat_data());
+        XTESTS_TEST_INTEGER_EQUAL(0, ::stat(make_path(dir, name.c_str()).c_str(), &st));
+        XTESTS_TEST_INTEGER_EQUAL(st.st_ino, sd.st_ino);
+        XTESTS_TEST_INTEGER_EQUAL(st.st_mode, sd.st_mode);
+
+        if ("f2" == name)
+        {
+            XTESTS_TEST_INTEGER_EQUAL(3, sd.st_size);
+        }
+
+        // copies carry the data with them
+
+        readdir_sequence_t::const_iterator const    j(i);
+        readdir_sequence_t::stat_data_type          sd2;
+
+        XTESTS_TEST_BOOLEAN_TRUE(j.has_stat_data());
+        XTESTS_TEST_BOOLEAN_TRUE(j.get_stat_data(&sd2));
+        XTESTS_TEST_INTEGER_EQUAL(sd.st_ino, sd2.st_ino);
+    }}
+}
+
 } // anonymous namespace
 
 
@@ -0,0 +1,203 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.performance.platformstl.indexed_file_lines/main.cpp
+ *
+ * Purpose: Perf-test for `platformstl::indexed_file_lines`, comparing it
+ *          with `platformstl::file_lines`.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * feature control
+ */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* /////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <platformstl/filesystem/indexed_file_lines.hpp>
+
+/* /////////////////////////////////////
+ * general includes
+ */
+
+/* STLSoft header files */
+
+#include <platformstl/filesystem/file_lines.hpp>
+#include <stlsoft/diagnostics/std_chrono_hrc_stopwatch.hpp>
+
+/* Standard header files */
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+typedef stlsoft::std_chrono_hrc_stopwatch                   stopwatch_t;
+typedef stopwatch_t::interval_type                          interval_t;
+
+using stlsoft::ss_size_t;
+
+using platformstl::file_lines;
+using platformstl::indexed_file_lines;
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * constants
+ */
+
+namespace {
+
+    char const      TEMP_FILE_PATH[]    =   "test.performance.platformstl.indexed_file_lines.tmp";
+    ss_size_t const NUM_LINES           =   4000000;
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * functions
+ */
+
+template <typename T_fn>
+interval_t
+test_(
+    T_fn    fn
+,   size_t* numLines
+)
+{
+    stopwatch_t sw;
+    interval_t  interval = 0;
+
+    for (int W = 2; W != 0; --W)
+    {
+        sw.start();
+
+        *numLines = fn();
+
+        sw.stop();
+
+        interval = sw.get_nanoseconds();
+    }
+
+    return interval;
+}
+
+void
+display_results(
+    std::ostream&       stm
+,   char const*         test_name
+,   interval_t          interval
+,   ss_size_t           num_lines
+,   interval_t          baseline
+)
+{
+    stm
+        << '\t'
+        << test_name
+        << '\t'
+        << std::setw(12) << std::right << interval
+        << '\t'
+        << std::setw(12) << std::right << num_lines
+        << '\t'
+        << std::setw(8) << std::fixed << std::setprecision(2) << (100.0 * static_cast<double>(interval) / static_cast<double>(baseline)) << '%'
+        << std::endl;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int /* argc */, char* /* argv */[])
+{
+    // pipe to expand: `test.performance.platformstl.indexed_file_lines | expand -t 8,48,64,80`
+
+    {
+        FILE* const f = ::fopen(TEMP_FILE_PATH, "wb");
+
+        if (NULL == f)
+        {
+            std::cerr << "could not create " << TEMP_FILE_PATH << std::endl;
+
+            return EXIT_FAILURE;
+        }
+
+        std::string line;
+
+        for (ss_size_t i = 0; i != NUM_LINES; ++i)
+        {
+            line.assign(20 + i % 120, static_cast<char>('a' + i % 26));
+            line += (0 == i % 10) ? "\r\n" : "\n";
+
+            ::fwrite(line.data(), 1, line.size(), f);
+        }
+
+        ::fclose(f);
+    }
+
+    unsigned const max_threads = std::thread::hardware_concurrency();
+
+    std::cout << std::endl;
+    std::cout
+        << '\t'
+        << "test"
+        << '\t'
+        << "total (ns)"
+        << '\t'
+        << "#lines"
+        << '\t'
+        << "%"
+        << std::endl;
+    std::cout << std::endl;
+
+    size_t nl_fl;
+    size_t nl_ifl_1;
+    size_t nl_ifl_n;
+
+    interval_t const r_fl = test_([]() {
+
+        file_lines lines(TEMP_FILE_PATH);
+
+        return lines.size();
+    }, &nl_fl);
+
+    interval_t const r_ifl_1 = test_([]() {
+
+        indexed_file_lines lines(TEMP_FILE_PATH, 1);
+
+        return lines.size();
+    }, &nl_ifl_1);
+
+    interval_t const r_ifl_n = test_([max_threads]() {
+
+        indexed_file_lines lines(TEMP_FILE_PATH, max_threads);
+
+        return lines.size();
+    }, &nl_ifl_n);
+
+    display_results(std::cout, "file_lines", r_fl, nl_fl, r_fl);
+    display_results(std::cout, "indexed_file_lines (1 thread)", r_ifl_1, nl_ifl_1, r_fl);
+    display_results(std::cout, "indexed_file_lines (N threads)", r_ifl_n, nl_ifl_n, r_fl);
+
+    ::remove(TEMP_FILE_PATH);
+
+    return EXIT_SUCCESS;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
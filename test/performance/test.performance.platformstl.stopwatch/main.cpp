@@ -4,7 +4,7 @@
  * Purpose: Perf-test for stopwatch types.
  *
  * Created: 15th March 2024
- * Updated: 16th December 2024
+ * Updated: 16th October 2026
  *
  * ////////////////////////////////////////////////////////////////////// */
 
@@ -32,6 +32,15 @@
 #include <platformstl/diagnostics/processtimes_stopwatch.hpp>
 #include <platformstl/synch/sleep_functions.h>
 #include <stlsoft/diagnostics/std_chrono_hrc_stopwatch.hpp>
+#ifdef PLATFORMSTL_OS_IS_UNIX
+# include <unixstl/diagnostics/monotonic_stopwatch.hpp>
+# if defined(__GNUC__) && \
+     (   defined(__i386__) || \
+         defined(__x86_64__))
+#  include <unixstl/diagnostics/tsc_stopwatch.hpp>
+#  define TSC_STOPWATCH_SUPPORTED
+# endif /* compiler / architecture */
+#endif /* PLATFORMSTL_OS_IS_UNIX */
 
 #include <iomanip>
 #include <iostream>
@@ -336,6 +345,34 @@ int main(int /* argc */, char* /* argv */[])
 
             display_results(std::cout, NUM_ITERATIONS, type_name, r);
         }
+
+#ifdef PLATFORMSTL_OS_IS_UNIX
+
+        {
+            DEFINE_TYPE_AND_NAME(unixstl::monotonic_stopwatch);
+
+            std::pair<
+                interval_t  // total_time_ns
+            ,   ss_size_t   // anchoring_value
+            > const r = test_start_stop_<sw_t>(NUM_ITERATIONS);
+
+            display_results(std::cout, NUM_ITERATIONS, type_name, r);
+        }
+
+# ifdef TSC_STOPWATCH_SUPPORTED
+
+        {
+            DEFINE_TYPE_AND_NAME(unixstl::tsc_stopwatch);
+
+            std::pair<
+                interval_t  // total_time_ns
+            ,   ss_size_t   // anchoring_value
+            > const r = test_start_stop_<sw_t>(NUM_ITERATIONS);
+
+            display_results(std::cout, NUM_ITERATIONS, type_name, r);
+        }
+# endif /* TSC_STOPWATCH_SUPPORTED */
+#endif /* PLATFORMSTL_OS_IS_UNIX */
     }
 
     // pause-unpause
@@ -364,6 +401,34 @@ int main(int /* argc */, char* /* argv */[])
 
             display_results(std::cout, NUM_ITERATIONS, type_name, r);
         }
+
+#ifdef PLATFORMSTL_OS_IS_UNIX
+
+        {
+            DEFINE_TYPE_AND_NAME(unixstl::monotonic_stopwatch);
+
+            std::pair<
+                interval_t  // total_time_ns
+            ,   ss_size_t   // anchoring_value
+            > const r = test_pause_unpause_<sw_t>(NUM_ITERATIONS);
+
+            display_results(std::cout, NUM_ITERATIONS, type_name, r);
+        }
+
+# ifdef TSC_STOPWATCH_SUPPORTED
+
+        {
+            DEFINE_TYPE_AND_NAME(unixstl::tsc_stopwatch);
+
+            std::pair<
+                interval_t  // total_time_ns
+            ,   ss_size_t   // anchoring_value
+            > const r = test_pause_unpause_<sw_t>(NUM_ITERATIONS);
+
+            display_results(std::cout, NUM_ITERATIONS, type_name, r);
+        }
+# endif /* TSC_STOPWATCH_SUPPORTED */
+#endif /* PLATFORMSTL_OS_IS_UNIX */
     }
 
     // pause-unpause (around delay)
@@ -397,6 +462,36 @@ int main(int /* argc */, char* /* argv */[])
 
             display_results(std::cout, num_iterations, type_name, r);
         }
+
+#ifdef PLATFORMSTL_OS_IS_UNIX
+
+        {
+            DEFINE_TYPE_AND_NAME(unixstl::monotonic_stopwatch);
+
+            std::tuple<
+                interval_t  // total_elapsed_time_ns
+            ,   interval_t  // total_measured_time_ns
+            ,   ss_size_t   // anchoring_value - this to incline the optimiser to not elide the whole thing
+            > const r = test_pause_unpause_around_delay_<sw_t>(num_iterations, delay_us);
+
+            display_results(std::cout, num_iterations, type_name, r);
+        }
+
+# ifdef TSC_STOPWATCH_SUPPORTED
+
+        {
+            DEFINE_TYPE_AND_NAME(unixstl::tsc_stopwatch);
+
+            std::tuple<
+                interval_t  // total_elapsed_time_ns
+            ,   interval_t  // total_measured_time_ns
+            ,   ss_size_t   // anchoring_value - this to incline the optimiser to not elide the whole thing
+            > const r = test_pause_unpause_around_delay_<sw_t>(num_iterations, delay_us);
+
+            display_results(std::cout, num_iterations, type_name, r);
+        }
+# endif /* TSC_STOPWATCH_SUPPORTED */
+#endif /* PLATFORMSTL_OS_IS_UNIX */
     }
 
 
@@ -0,0 +1,246 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.performance.stlsoft.allocators/main.cpp
+ *
+ * Purpose: Perf-test for `stlsoft::arena_allocator<>` and
+ *          `stlsoft::pool_allocator<>`, comparing them with
+ *          `std::allocator<>` for node-based containers and for
+ *          short-lived growing buffers.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * feature control
+ */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* /////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/memory/arena_allocator.hpp>
+#include <stlsoft/memory/pool_allocator.hpp>
+
+/* /////////////////////////////////////
+ * general includes
+ */
+
+/* STLSoft header files */
+
+#include <stlsoft/containers/pod_vector.hpp>
+#include <stlsoft/diagnostics/std_chrono_hrc_stopwatch.hpp>
+
+/* Standard header files */
+
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <list>
+#include <map>
+#include <memory>
+
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+typedef stlsoft::std_chrono_hrc_stopwatch                   stopwatch_t;
+typedef stopwatch_t::interval_type                          interval_t;
+
+using stlsoft::ss_size_t;
+
+typedef stlsoft::monotonic_arena                            arena_t;
+typedef stlsoft::fixed_size_pool                            pool_t;
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * constants
+ */
+
+namespace {
+
+    ss_size_t const NUM_ITERATIONS  =   200;
+    ss_size_t const NUM_ELEMENTS    =   10000;
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * functions
+ */
+
+// fills and empties a list
+template <typename T_allocator>
+ss_size_t
+list_churn()
+{
+    std::list<int, T_allocator> l;
+
+    for (ss_size_t i = 0; i != NUM_ELEMENTS; ++i)
+    {
+        l.push_back(static_cast<int>(i));
+    }
+
+    ss_size_t const r = l.size();
+
+    l.clear();
+
+    return r;
+}
+
+// fills a map, and erases half its elements
+template <typename T_allocator>
+ss_size_t
+map_churn()
+{
+    std::map<int, int, std::less<int>, T_allocator> m;
+
+    for (ss_size_t i = 0; i != NUM_ELEMENTS; ++i)
+    {
+        int const key = static_cast<int>((i * 2654435761u) % NUM_ELEMENTS);
+
+        m[key] = static_cast<int>(i);
+    }
+
+    for (ss_size_t i = 0; i != NUM_ELEMENTS; i += 2)
+    {
+        m.erase(static_cast<int>(i));
+    }
+
+    return m.size();
+}
+
+// grows many short-lived vectors
+template <typename T_allocator>
+ss_size_t
+vector_growth()
+{
+    ss_size_t r = 0;
+
+    for (ss_size_t i = 0; i != NUM_ELEMENTS / 100; ++i)
+    {
+        stlsoft::pod_vector<int, T_allocator, 16> v;
+
+        for (ss_size_t j = 0; j != 100 + i % 100; ++j)
+        {
+            v.push_back(static_cast<int>(j));
+        }
+
+        r += v.size();
+    }
+
+    return r;
+}
+
+template <typename T_fn>
+void
+report(
+    char const*     scenario
+,   char const*     allocator
+,   T_fn            fn
+,   void          (*reset)()
+)
+{
+    stopwatch_t sw;
+    ss_size_t   r = 0;
+
+    // warm-up
+
+    r += fn();
+    reset();
+
+    sw.start();
+    for (ss_size_t i = 0; i != NUM_ITERATIONS; ++i)
+    {
+        r += fn();
+        reset();
+    }
+    sw.stop();
+
+    interval_t const interval = sw.get_nanoseconds();
+
+    std::cout
+        << '\t'
+        << scenario
+        << '\t'
+        << allocator
+        << '\t'
+        << std::setw(12) << std::right << interval
+        << '\t'
+        << std::setw(8) << std::fixed << std::setprecision(3) << (static_cast<double>(interval) / (NUM_ITERATIONS * NUM_ELEMENTS))
+        << '\t'
+        << r
+        << std::endl;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+namespace {
+
+    arena_t*    s_arena;
+
+    void no_reset()
+    {}
+
+    // an arena only gives memory back when released, which is what a
+    // per-frame/per-request arena does between frames/requests
+    void arena_reset()
+    {
+        s_arena->release();
+    }
+} // anonymous namespace
+
+int main(int /* argc */, char* /* argv */[])
+{
+    // pipe to expand: `test.performance.stlsoft.allocators | expand -t 8,24,40,56,72`
+
+    typedef std::pair<int const, int>                       map_value_t;
+
+    arena_t                                                 arena(64 * 1024);
+    pool_t                                                  pool(64);
+    stlsoft::thread_scoped_resource<arena_t>::scope         arena_scope(arena);
+    stlsoft::thread_scoped_resource<pool_t>::scope          pool_scope(pool);
+
+    s_arena = &arena;
+
+    std::cout << std::endl;
+    std::cout
+        << '\t'
+        << "scenario"
+        << '\t'
+        << "allocator"
+        << '\t'
+        << "total (ns)"
+        << '\t'
+        << "ns / element"
+        << '\t'
+        << "(result)"
+        << std::endl;
+
+    report("list", "std::allocator", list_churn<std::allocator<int> >, no_reset);
+    report("list", "arena_allocator", list_churn<stlsoft::arena_allocator<int> >, arena_reset);
+    report("list", "pool_allocator", list_churn<stlsoft::pool_allocator<int> >, no_reset);
+
+    report("map", "std::allocator", map_churn<std::allocator<map_value_t> >, no_reset);
+    report("map", "arena_allocator", map_churn<stlsoft::arena_allocator<map_value_t> >, arena_reset);
+    report("map", "pool_allocator", map_churn<stlsoft::pool_allocator<map_value_t> >, no_reset);
+
+    report("pod_vector", "std::allocator", vector_growth<std::allocator<int> >, no_reset);
+    report("pod_vector", "arena_allocator", vector_growth<stlsoft::arena_allocator<int> >, arena_reset);
+
+    return EXIT_SUCCESS;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,261 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.performance.stlsoft.concurrent_doomgram/main.cpp
+ *
+ * Purpose: Perf-test for `stlsoft::concurrent_doomgram`, measuring
+ *          throughput scaling from 1 to N threads.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * feature control
+ */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* /////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/diagnostics/concurrent_doomgram.hpp>
+
+/* /////////////////////////////////////
+ * general includes
+ */
+
+/* STLSoft header files */
+
+#include <stlsoft/diagnostics/doomgram.hpp>
+#include <stlsoft/diagnostics/std_chrono_hrc_stopwatch.hpp>
+
+/* Standard header files */
+
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+typedef stlsoft::std_chrono_hrc_stopwatch                   stopwatch_t;
+typedef stopwatch_t::interval_type                          interval_t;
+
+using stlsoft::ss_size_t;
+using stlsoft::ss_uint64_t;
+
+using stlsoft::concurrent_doomgram;
+using stlsoft::doomgram;
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * constants
+ */
+
+namespace {
+
+    ss_size_t const NUM_ITERATIONS_PER_THREAD = 10000000;
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * functions
+ */
+
+// Runs `timed_fn(thread_index, iteration)` `num_iterations` times on each
+// of `num_threads` threads, and returns the elapsed time
+interval_t
+test_(
+    ss_size_t                   num_threads
+,   ss_size_t                   num_iterations
+,   std::function<void ()>      init_fn
+,   std::function<void (
+        ss_size_t   thread_index
+    ,   ss_size_t   iteration
+    )>                          timed_fn
+)
+{
+    stopwatch_t sw;
+    interval_t  interval = 0;
+
+    for (int W = 2; W != 0; --W)
+    {
+        std::vector<std::thread> threads;
+
+        init_fn();
+
+        sw.start();
+
+        for (ss_size_t t = 0; t != num_threads; ++t)
+        {
+            threads.emplace_back([t, num_iterations, &timed_fn]() {
+
+                for (ss_size_t i = 0; i != num_iterations; ++i)
+                {
+                    timed_fn(t, i);
+                }
+            });
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        sw.stop();
+
+        interval = sw.get_nanoseconds();
+    }
+
+    return interval;
+}
+
+void
+display_results(
+    std::ostream&       stm
+,   ss_size_t           num_threads
+,   char const*         test_name
+,   interval_t          interval
+,   ss_uint64_t         event_count
+)
+{
+    ss_size_t const num_ops = num_threads * NUM_ITERATIONS_PER_THREAD;
+
+    stm
+        << '\t'
+        << test_name
+        << '\t'
+        << num_threads
+        << '\t'
+        << std::setw(12) << std::right << interval
+        << '\t'
+        << std::setw(12) << std::setfill(' ') << std::right << std::fixed << std::setprecision(3) << (static_cast<double>(interval) / num_ops)
+        << '\t'
+        << std::setw(12) << std::setfill(' ') << std::right << std::fixed << std::setprecision(3) << (1000.0 * num_ops / static_cast<double>(interval))
+        << '\t'
+        << std::setw(20) << std::right << event_count
+        << std::endl;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int /* argc */, char* /* argv */[])
+{
+    // pipe to expand: `test.performance.stlsoft.concurrent_doomgram | expand -t 8,48,56,72,88,104,128`
+
+    ss_size_t max_threads = std::thread::hardware_concurrency();
+
+    if (max_threads < 2)
+    {
+        max_threads = 2;
+    }
+
+    std::cout << std::endl;
+    std::cout
+        << '\t'
+        << "test"
+        << '\t'
+        << "#threads"
+        << '\t'
+        << "total (ns)"
+        << '\t'
+        << "ns / op"
+        << '\t'
+        << "Mops / s"
+        << '\t'
+        << "event count"
+        << std::endl;
+
+    for (ss_size_t num_threads = 1; num_threads <= max_threads; num_threads *= 2)
+    {
+        std::cout << std::endl;
+
+        // doomgram + std::mutex
+        {
+            doomgram    dg;
+            std::mutex  mx;
+
+            interval_t const r = test_(
+                num_threads
+            ,   NUM_ITERATIONS_PER_THREAD
+            ,   [&dg]() {
+
+                dg = doomgram();
+            }
+            ,   [&dg, &mx](ss_size_t /* thread_index */, ss_size_t iteration) {
+
+                std::lock_guard<std::mutex> lock(mx);
+
+                dg.push_event_time_ns(iteration % 100000);
+            });
+
+            display_results(std::cout, num_threads, "doomgram + std::mutex", r, dg.event_count());
+        }
+
+        // doomgram per thread, merged
+        {
+            std::vector<doomgram> dgs;
+
+            interval_t const r = test_(
+                num_threads
+            ,   NUM_ITERATIONS_PER_THREAD
+            ,   [&dgs, num_threads]() {
+
+                dgs.assign(num_threads, doomgram());
+            }
+            ,   [&dgs](ss_size_t thread_index, ss_size_t iteration) {
+
+                dgs[thread_index].push_event_time_ns(iteration % 100000);
+            });
+
+            doomgram dg;
+
+            for (doomgram const& tdg : dgs)
+            {
+                dg.merge(tdg);
+            }
+
+            display_results(std::cout, num_threads, "doomgram per thread", r, dg.event_count());
+        }
+
+        // concurrent_doomgram
+        {
+            concurrent_doomgram cdg;
+
+            interval_t const r = test_(
+                num_threads
+            ,   NUM_ITERATIONS_PER_THREAD
+            ,   [&cdg]() {
+
+                cdg.clear();
+            }
+            ,   [&cdg](ss_size_t /* thread_index */, ss_size_t iteration) {
+
+                cdg.push_event_time_ns(iteration % 100000);
+            });
+
+            display_results(std::cout, num_threads, "concurrent_doomgram", r, cdg.snapshot().event_count());
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,303 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.performance.stlsoft.concurrent_frequency_map/main.cpp
+ *
+ * Purpose: Perf-test for `stlsoft::concurrent_frequency_map<>`, comparing
+ *          it with a mutex-guarded `stlsoft::frequency_map<>` and with
+ *          per-thread maps merged at the end, for 1 to N threads.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * feature control
+ */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* /////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/containers/concurrent_frequency_map.hpp>
+
+/* /////////////////////////////////////
+ * general includes
+ */
+
+/* STLSoft header files */
+
+#include <stlsoft/containers/frequency_map.hpp>
+#include <stlsoft/diagnostics/std_chrono_hrc_stopwatch.hpp>
+
+/* Standard header files */
+
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+typedef stlsoft::std_chrono_hrc_stopwatch                   stopwatch_t;
+typedef stopwatch_t::interval_type                          interval_t;
+
+using stlsoft::ss_size_t;
+
+typedef stlsoft::frequency_map<int>                         fm_t;
+typedef stlsoft::concurrent_frequency_map<int>              cfm_t;
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * constants
+ */
+
+namespace {
+
+    ss_size_t const NUM_ITERATIONS_PER_THREAD   =   2000000;
+    int const       NUM_KEYS                    =   10007;
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * functions
+ */
+
+inline
+int
+key_from(
+    ss_size_t   thread_index
+,   ss_size_t   iteration
+)
+{
+    return static_cast<int>((iteration * 31 + thread_index * 7) % NUM_KEYS);
+}
+
+// Runs `timed_fn(thread_index)` on each of `num_threads` threads, then
+// `final_fn()`, and returns the elapsed time
+interval_t
+test_(
+    ss_size_t                                   num_threads
+,   std::function<void ()>                      init_fn
+,   std::function<void (ss_size_t thread_index)> timed_fn
+,   std::function<void ()>                      final_fn
+)
+{
+    stopwatch_t sw;
+    interval_t  interval = 0;
+
+    for (int W = 2; W != 0; --W)
+    {
+        std::vector<std::thread> threads;
+
+        init_fn();
+
+        sw.start();
+
+        for (ss_size_t t = 0; t != num_threads; ++t)
+        {
+            threads.emplace_back(timed_fn, t);
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        final_fn();
+
+        sw.stop();
+
+        interval = sw.get_nanoseconds();
+    }
+
+    return interval;
+}
+
+void
+display_results(
+    std::ostream&       stm
+,   ss_size_t           num_threads
+,   char const*         test_name
+,   interval_t          interval
+,   ss_size_t           total
+)
+{
+    ss_size_t const num_ops = num_threads * NUM_ITERATIONS_PER_THREAD;
+
+    stm
+        << '\t'
+        << test_name
+        << '\t'
+        << num_threads
+        << '\t'
+        << std::setw(12) << std::right << interval
+        << '\t'
+        << std::setw(12) << std::setfill(' ') << std::right << std::fixed << std::setprecision(3) << (static_cast<double>(interval) / num_ops)
+        << '\t'
+        << std::setw(12) << std::setfill(' ') << std::right << std::fixed << std::setprecision(3) << (1000.0 * num_ops / static_cast<double>(interval))
+        << '\t'
+        << std::setw(12) << std::right << total
+        << std::endl;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int /* argc */, char* /* argv */[])
+{
+    // pipe to expand: `test.performance.stlsoft.concurrent_frequency_map | expand -t 8,48,56,72,88,104,120`
+
+    ss_size_t max_threads = std::thread::hardware_concurrency();
+
+    if (max_threads < 2)
+    {
+        max_threads = 2;
+    }
+
+    std::cout << std::endl;
+    std::cout
+        << '\t'
+        << "test"
+        << '\t'
+        << "#threads"
+        << '\t'
+        << "total (ns)"
+        << '\t'
+        << "ns / op"
+        << '\t'
+        << "Mops / s"
+        << '\t'
+        << "total"
+        << std::endl;
+
+    for (ss_size_t num_threads = 1; num_threads <= max_threads; num_threads *= 2)
+    {
+        std::cout << std::endl;
+
+        // frequency_map + std::mutex
+        {
+            fm_t        fm;
+            std::mutex  mx;
+
+            interval_t const r = test_(
+                num_threads
+            ,   [&fm]() {
+
+                fm.clear();
+            }
+            ,   [&fm, &mx](ss_size_t thread_index) {
+
+                for (ss_size_t i = 0; i != NUM_ITERATIONS_PER_THREAD; ++i)
+                {
+                    std::lock_guard<std::mutex> lock(mx);
+
+                    fm.push(key_from(thread_index, i));
+                }
+            }
+            ,   []() {});
+
+            display_results(std::cout, num_threads, "frequency_map + std::mutex", r, fm.total());
+        }
+
+        // frequency_map per thread, merged
+        {
+            std::vector<fm_t>   fms;
+            fm_t                fm;
+
+            interval_t const r = test_(
+                num_threads
+            ,   [&fms, &fm, num_threads]() {
+
+                fms.clear();
+                fms.resize(num_threads);
+                fm.clear();
+            }
+            ,   [&fms](ss_size_t thread_index) {
+
+                fm_t& tfm = fms[thread_index];
+
+                for (ss_size_t i = 0; i != NUM_ITERATIONS_PER_THREAD; ++i)
+                {
+                    tfm.push(key_from(thread_index, i));
+                }
+            }
+            ,   [&fms, &fm]() {
+
+                for (fm_t const& tfm : fms)
+                {
+                    fm.merge(tfm);
+                }
+            });
+
+            display_results(std::cout, num_threads, "frequency_map per thread", r, fm.total());
+        }
+
+        // concurrent_frequency_map
+        {
+            cfm_t cfm;
+
+            interval_t const r = test_(
+                num_threads
+            ,   [&cfm]() {
+
+                cfm.clear();
+            }
+            ,   [&cfm](ss_size_t thread_index) {
+
+                for (ss_size_t i = 0; i != NUM_ITERATIONS_PER_THREAD; ++i)
+                {
+                    cfm.push(key_from(thread_index, i));
+                }
+            }
+            ,   []() {});
+
+            display_results(std::cout, num_threads, "concurrent_frequency_map", r, cfm.snapshot().total());
+        }
+
+        // concurrent_frequency_map, merged from per-thread maps
+        {
+            cfm_t cfm;
+
+            interval_t const r = test_(
+                num_threads
+            ,   [&cfm]() {
+
+                cfm.clear();
+            }
+            ,   [&cfm](ss_size_t thread_index) {
+
+                fm_t tfm;
+
+                for (ss_size_t i = 0; i != NUM_ITERATIONS_PER_THREAD; ++i)
+                {
+                    tfm.push(key_from(thread_index, i));
+                }
+
+                cfm.merge(tfm);
+            }
+            ,   []() {});
+
+            display_results(std::cout, num_threads, "concurrent_frequency_map (merge)", r, cfm.snapshot().total());
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -1,10 +1,12 @@
 /* /////////////////////////////////////////////////////////////////////////
  * File:    test.performance.stlsoft.count_digits/main.cpp
  *
- * Purpose: Perf-test for digit-counting functions.
+ * Purpose: Perf-test for digit-counting functions, for sequential values
+ *          and for values of random magnitude (for which the branches of
+ *          a comparison-based implementation are unpredictable).
  *
  * Created: 18th December 2024
- * Updated: 18th December 2024
+ * Updated: 16th October 2026
  *
  * ////////////////////////////////////////////////////////////////////// */
 
@@ -39,6 +41,7 @@
 
 #include <iomanip>
 #include <iostream>
+#include <vector>
 
 
 /* /////////////////////////////////////////////////////////////////////////
@@ -63,7 +66,8 @@ using stlsoft::ss_size_t;
 
 namespace {
 
-    ss_size_t const NUM_ITERATIONS = 20000000;
+    ss_size_t const NUM_ITERATIONS      =   20000000;
+    ss_size_t const NUM_RANDOM_VALUES   =   0x10000; // must be a power of 2
 } // anonymous namespace
 
 
@@ -83,6 +87,30 @@ thousands(
     return std::string(dest, n);
 }
 
+// values whose bit-widths are uniformly distributed in [1, maxBits]
+std::vector<stlsoft::uint64_t>
+make_random_values(
+    unsigned maxBits
+)
+{
+    std::vector<stlsoft::uint64_t>  values(NUM_RANDOM_VALUES);
+    stlsoft::uint64_t               r = 12345;
+
+    for (ss_size_t i = 0; NUM_RANDOM_VALUES != i; ++i)
+    {
+        r = r * 6364136223846793005ull + 1442695040888963407ull;
+
+        unsigned const          numBits =   1 + static_cast<unsigned>((r >> 33) % maxBits);
+        stlsoft::uint64_t const top     =   stlsoft::uint64_t(1) << (numBits - 1);
+
+        r = r * 6364136223846793005ull + 1442695040888963407ull;
+
+        values[i] = top | (r & (top - 1));
+    }
+
+    return values;
+}
+
 
 /* /////////////////////////////////////////////////////////////////////////
  * main()
@@ -90,6 +118,37 @@ thousands(
 
 int main(int /*argc*/, char* /*argv*/[])
 {
+    std::vector<stlsoft::uint64_t> const    random32 = make_random_values(32);
+    std::vector<stlsoft::uint64_t> const    random64 = make_random_values(64);
+
+    std::cout
+        << "implementation: "
+#if defined(STLSOFT_COUNT_DECIMAL_DIGITS_USE_CLZ_)
+        << "bit-width"
+#else
+        << "comparison"
+#endif
+        << std::endl;
+
+    std::cout
+        << '\t'
+        << "function"
+        << '\t'
+        << std::setw(16) << std::right << "uint8"
+        << '\t'
+        << std::setw(16) << std::right << "uint16"
+        << '\t'
+        << std::setw(16) << std::right << "uint32"
+        << '\t'
+        << std::setw(16) << std::right << "uint64"
+        << '\t'
+        << std::setw(16) << std::right << "uint64 << 32"
+        << '\t'
+        << std::setw(16) << std::right << "random uint32"
+        << '\t'
+        << std::setw(16) << std::right << "random uint64"
+        << std::endl;
+
     // count_decimal_digits
     for (int W = 2; 0 != W; --W)
     {
@@ -158,6 +217,30 @@ int main(int /*argc*/, char* /*argv*/[])
         interval_t const int_uint64_32 = sw.get_nanoseconds();
 
 
+        sw.start();
+        for (unsigned i = 0; NUM_ITERATIONS != i; ++i)
+        {
+            stlsoft::uint32_t const v = static_cast<stlsoft::uint32_t>(random32[i & (NUM_RANDOM_VALUES - 1)]);
+
+            anchor_value += stlsoft::count_decimal_digits(v);
+        }
+        sw.stop();
+
+        interval_t const int_random32 = sw.get_nanoseconds();
+
+
+        sw.start();
+        for (unsigned i = 0; NUM_ITERATIONS != i; ++i)
+        {
+            stlsoft::uint64_t const v = random64[i & (NUM_RANDOM_VALUES - 1)];
+
+            anchor_value += stlsoft::count_decimal_digits(v);
+        }
+        sw.stop();
+
+        interval_t const int_random64 = sw.get_nanoseconds();
+
+
         if (1 == W)
         {
             std::cout
@@ -174,6 +257,10 @@ int main(int /*argc*/, char* /*argv*/[])
                 << '\t'
                 << std::setw(16) << std::right << thousands(int_uint64_32)
                 << '\t'
+                << std::setw(16) << std::right << thousands(int_random32)
+                << '\t'
+                << std::setw(16) << std::right << thousands(int_random64)
+                << '\t'
                 << anchor_value
                 << std::endl;
         }
@@ -248,6 +335,30 @@ int main(int /*argc*/, char* /*argv*/[])
         interval_t const int_uint64_32 = sw.get_nanoseconds();
 
 
+        sw.start();
+        for (unsigned i = 0; NUM_ITERATIONS != i; ++i)
+        {
+            stlsoft::uint32_t const v = static_cast<stlsoft::uint32_t>(random32[i & (NUM_RANDOM_VALUES - 1)]);
+
+            anchor_value += stlsoft::count_hexadecimal_digits(v);
+        }
+        sw.stop();
+
+        interval_t const int_random32 = sw.get_nanoseconds();
+
+
+        sw.start();
+        for (unsigned i = 0; NUM_ITERATIONS != i; ++i)
+        {
+            stlsoft::uint64_t const v = random64[i & (NUM_RANDOM_VALUES - 1)];
+
+            anchor_value += stlsoft::count_hexadecimal_digits(v);
+        }
+        sw.stop();
+
+        interval_t const int_random64 = sw.get_nanoseconds();
+
+
         if (1 == W)
         {
             std::cout
@@ -264,6 +375,10 @@ int main(int /*argc*/, char* /*argv*/[])
                 << '\t'
                 << std::setw(16) << std::right << thousands(int_uint64_32)
                 << '\t'
+                << std::setw(16) << std::right << thousands(int_random32)
+                << '\t'
+                << std::setw(16) << std::right << thousands(int_random64)
+                << '\t'
                 << anchor_value
                 << std::endl;
         }
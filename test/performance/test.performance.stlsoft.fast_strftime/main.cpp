@@ -0,0 +1,295 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.performance.stlsoft.fast_strftime/main.cpp
+ *
+ * Purpose: Perf-test for `stlsoft::fast_strftime()`,
+ *          `stlsoft::fast_strftime_format`, and
+ *          `stlsoft::fast_timestamp_formatter`, comparing them with
+ *          `strftime()`, for successive (sub-second) log-style timestamps.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * feature control
+ */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* /////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/time/fast_strftime.hpp>
+#include <stlsoft/time/fast_timestamp_formatter.hpp>
+
+/* /////////////////////////////////////
+ * general includes
+ */
+
+/* STLSoft header files */
+
+#include <stlsoft/api/internal/time.h>
+#include <stlsoft/diagnostics/std_chrono_hrc_stopwatch.hpp>
+
+/* Standard header files */
+
+#include <iomanip>
+#include <iostream>
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+typedef stlsoft::std_chrono_hrc_stopwatch                   stopwatch_t;
+typedef stopwatch_t::interval_type                          interval_t;
+
+using stlsoft::ss_size_t;
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * constants
+ */
+
+namespace {
+
+    ss_size_t const NUM_TIMESTAMPS  =   1000000;
+    ss_size_t const NUM_ITERATIONS  =   2;
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * functions
+ */
+
+namespace {
+
+// Friday 16th October 2026, 09:05:07 UTC
+time_t const T_BASE = 1792141507;
+
+// appends ".mmm", as a logging library would after strftime()
+ss_size_t
+append_milliseconds(
+    char        dest[]
+,   ss_size_t   n
+,   long        ns
+)
+{
+    long const ms = ns / 1000000;
+
+    dest[n++] = '.';
+    dest[n++] = static_cast<char>('0' + ms / 100);
+    dest[n++] = static_cast<char>('0' + (ms / 10) % 10);
+    dest[n++] = static_cast<char>('0' + ms % 10);
+    dest[n] = '\0';
+
+    return n;
+}
+
+template <typename T_fn>
+interval_t
+test_(
+    T_fn        fn
+,   ss_size_t*  numChars
+)
+{
+    stopwatch_t sw;
+    interval_t  interval = 0;
+
+    for (int W = 2; W != 0; --W)
+    {
+        sw.start();
+
+        *numChars = 0;
+
+        for (ss_size_t i = 0; i != NUM_ITERATIONS; ++i)
+        {
+            *numChars += fn();
+        }
+
+        sw.stop();
+
+        interval = sw.get_nanoseconds();
+    }
+
+    return interval;
+}
+
+void
+display_results(
+    std::ostream&       stm
+,   char const*         test_name
+,   interval_t          interval
+,   ss_size_t           num_chars
+,   interval_t          baseline
+)
+{
+    stm
+        << '\t'
+        << test_name
+        << '\t'
+        << std::setw(12) << std::right << interval
+        << '\t'
+        << std::setw(10) << std::right << num_chars
+        << '\t'
+        << std::setw(8) << std::fixed << std::setprecision(2) << (100.0 * static_cast<double>(interval) / static_cast<double>(baseline)) << '%'
+        << std::endl;
+}
+
+void
+run_tests(
+    char const* title
+,   long        nsIncrement
+)
+{
+    char const* const   FORMAT          =   "%Y-%m-%d %H:%M:%S";
+    char const* const   FORMAT_N        =   "%Y-%m-%d %H:%M:%S.%3N";
+
+    std::cout << std::endl;
+    std::cout << title << ":" << std::endl;
+
+    ss_size_t nc_strftime, nc_fast_strftime, nc_format, nc_formatter;
+
+    interval_t const r_strftime = test_([&](){
+
+        ss_size_t   n   =   0;
+        time_t      t   =   T_BASE;
+        long        ns  =   0;
+        char        buf[101];
+
+        for (ss_size_t i = 0; i != NUM_TIMESTAMPS; ++i)
+        {
+            struct tm tm;
+
+            STLSOFT_API_INTERNAL_Time_localtime(&tm, &t);
+
+            n += append_milliseconds(buf, ::strftime(buf, STLSOFT_NUM_ELEMENTS(buf), FORMAT, &tm), ns);
+
+            if ((ns += nsIncrement) >= 1000000000)
+            {
+                ns -= 1000000000;
+                ++t;
+            }
+        }
+
+        return n;
+    }, &nc_strftime);
+
+    interval_t const r_fast_strftime = test_([&](){
+
+        ss_size_t   n   =   0;
+        time_t      t   =   T_BASE;
+        long        ns  =   0;
+        char        buf[101];
+
+        for (ss_size_t i = 0; i != NUM_TIMESTAMPS; ++i)
+        {
+            struct tm tm;
+
+            STLSOFT_API_INTERNAL_Time_localtime(&tm, &t);
+
+            n += append_milliseconds(buf, stlsoft::fast_strftime(buf, STLSOFT_NUM_ELEMENTS(buf), FORMAT, &tm), ns);
+
+            if ((ns += nsIncrement) >= 1000000000)
+            {
+                ns -= 1000000000;
+                ++t;
+            }
+        }
+
+        return n;
+    }, &nc_fast_strftime);
+
+    interval_t const r_format = test_([&](){
+
+        stlsoft::fast_strftime_format const fmt(FORMAT);
+        ss_size_t                           n   =   0;
+        time_t                              t   =   T_BASE;
+        long                                ns  =   0;
+        char                                buf[101];
+
+        for (ss_size_t i = 0; i != NUM_TIMESTAMPS; ++i)
+        {
+            struct tm tm;
+
+            STLSOFT_API_INTERNAL_Time_localtime(&tm, &t);
+
+            n += append_milliseconds(buf, fmt.format(buf, &tm), ns);
+
+            if ((ns += nsIncrement) >= 1000000000)
+            {
+                ns -= 1000000000;
+                ++t;
+            }
+        }
+
+        return n;
+    }, &nc_format);
+
+    interval_t const r_formatter = test_([&](){
+
+        stlsoft::fast_timestamp_formatter   fmt(FORMAT_N);
+        ss_size_t                           n   =   0;
+        time_t                              t   =   T_BASE;
+        long                                ns  =   0;
+        char                                buf[101];
+
+        for (ss_size_t i = 0; i != NUM_TIMESTAMPS; ++i)
+        {
+            n += fmt.format(buf, t, ns);
+
+            if ((ns += nsIncrement) >= 1000000000)
+            {
+                ns -= 1000000000;
+                ++t;
+            }
+        }
+
+        return n;
+    }, &nc_formatter);
+
+    display_results(std::cout, "localtime_r() + strftime()", r_strftime, nc_strftime, r_strftime);
+    display_results(std::cout, "localtime_r() + fast_strftime()", r_fast_strftime, nc_fast_strftime, r_strftime);
+    display_results(std::cout, "localtime_r() + fast_strftime_format", r_format, nc_format, r_strftime);
+    display_results(std::cout, "fast_timestamp_formatter", r_formatter, nc_formatter, r_strftime);
+}
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int /* argc */, char* /* argv */[])
+{
+    // pipe to expand: `test.performance.stlsoft.fast_strftime | expand -t 8,48,64,80`
+
+    std::cout
+        << '\t'
+        << "test"
+        << '\t'
+        << "total (ns)"
+        << '\t'
+        << "#chars"
+        << '\t'
+        << "%"
+        << std::endl;
+
+    run_tests("1,000 timestamps per second", 1000000);
+    run_tests("1 timestamp per second", 1000000000);
+
+    return EXIT_SUCCESS;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -4,7 +4,7 @@
  * Purpose: Perf-test for `stlsoft::frequency_map<>`.
  *
  * Created: 5th October 2024
- * Updated: 17th December 2024
+ * Updated: 16th October 2026
  *
  * ////////////////////////////////////////////////////////////////////// */
 
@@ -79,6 +79,10 @@ typedef stlsoft::frequency_map<
     int
 ,   stlsoft::frequency_map_traits_unordered<int>
 >                                                           fm_unordered_int_t;
+typedef stlsoft::frequency_map<
+    int
+,   stlsoft::frequency_map_traits_flat<int>
+>                                                           fm_flat_int_t;
 #endif /* C++ */
 
 
@@ -706,15 +710,18 @@ run_tests(
 
 int main(int /* argc */, char* /* argv */[])
 {
-    // pipe to expand: `test.performance.stlsoft.frequency_map | expand -t 8,64,80,96,112,128,160`
+    // pipe to expand: `test.performance.stlsoft.frequency_map | expand -t 8,64,80,96,112,128,144,160`
 
     std::cout << std::endl;
     intervals_t const intervals_o = run_tests<fm_ordered_int_t>("O").first;
 #if __cplusplus >= 201103L
     std::cout << std::endl;
     std::pair<intervals_t, names_t> const intervals_and_names_u = run_tests<fm_unordered_int_t>("U");
+    std::cout << std::endl;
+    intervals_t const intervals_f = run_tests<fm_flat_int_t>("F").first;
 
-    if (intervals_and_names_u.first.size() != intervals_o.size())
+    if (intervals_and_names_u.first.size() != intervals_o.size() ||
+        intervals_f.size() != intervals_o.size())
     {
         std::cerr << "VIOLATION: wrong sizes" << std::endl;
 
@@ -732,7 +739,11 @@ int main(int /* argc */, char* /* argv */[])
             << '\t'
             << "U (ns)"
             << '\t'
+            << "F (ns)"
+            << '\t'
             << "U / O (%%)"
+            << '\t'
+            << "F / O (%%)"
             << std::endl;
 
         for (std::size_t i = 0; i != intervals_o.size(); ++i)
@@ -747,8 +758,14 @@ int main(int /* argc */, char* /* argv */[])
                 << std::setw(12) << std::right
                 << intervals_and_names_u.first[i]
                 << '\t'
+                << std::setw(12) << std::right
+                << intervals_f[i]
+                << '\t'
                 << std::setw(8) << std::setfill(' ') << std::right << std::fixed << std::setprecision(3)
                 << (static_cast<double>(intervals_and_names_u.first[i]) / static_cast<double>(intervals_o[i]) * 100.0)
+                << '\t'
+                << std::setw(8) << std::setfill(' ') << std::right << std::fixed << std::setprecision(3)
+                << (static_cast<double>(intervals_f[i]) / static_cast<double>(intervals_o[i]) * 100.0)
                 << std::endl;
         }
     }
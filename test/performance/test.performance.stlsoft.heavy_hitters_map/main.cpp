@@ -0,0 +1,242 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.performance.stlsoft.heavy_hitters_map/main.cpp
+ *
+ * Purpose: Perf-test for `stlsoft::heavy_hitters_map<>`, comparing it
+ *          with `stlsoft::frequency_map<>` on a skewed stream of many
+ *          distinct keys, for a range of capacities.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * feature control
+ */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* /////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/containers/heavy_hitters_map.hpp>
+
+/* /////////////////////////////////////
+ * general includes
+ */
+
+/* STLSoft header files */
+
+#include <stlsoft/containers/frequency_map.hpp>
+#include <stlsoft/diagnostics/std_chrono_hrc_stopwatch.hpp>
+
+/* Standard header files */
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+typedef stlsoft::std_chrono_hrc_stopwatch                   stopwatch_t;
+typedef stopwatch_t::interval_type                          interval_t;
+
+using stlsoft::ss_size_t;
+
+typedef stlsoft::frequency_map<
+    int
+,   stlsoft::frequency_map_traits_unordered<int>
+>                                                           fm_t;
+typedef stlsoft::heavy_hitters_map<int>                     hhm_t;
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * constants
+ */
+
+namespace {
+
+    ss_size_t const NUM_ITERATIONS  =   4000000;
+    ss_size_t const TOP_K           =   10;
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * functions
+ */
+
+// a key from a stream in which a quarter of the keys are Zipf-like - key
+// k occurring roughly in proportion to 1/(k + 1) - and the rest are
+// uniformly distributed over ~1M distinct values
+inline
+int
+skewed_key(
+    ss_size_t i
+)
+{
+    unsigned const  r       =   static_cast<unsigned>(i) * 2654435761u;
+    unsigned const  range   =   1u << 20;
+
+    if (0 == (r >> 30))
+    {
+        return static_cast<int>(range / (1 + (r >> 8) % range)) - 1;
+    }
+    else
+    {
+        return static_cast<int>((r >> 8) % range);
+    }
+}
+
+// the number of the true top-k keys that are among the reported top-k
+template <typename T_entries>
+ss_size_t
+num_correct(
+    std::vector<std::pair<int, fm_t::count_type> > const&   exact
+,   T_entries const&                                        reported
+)
+{
+    ss_size_t n = 0;
+
+    for (ss_size_t i = 0; i != exact.size(); ++i)
+    {
+        for (ss_size_t j = 0; j != reported.size(); ++j)
+        {
+            if (exact[i].first == reported[j].first)
+            {
+                ++n;
+
+                break;
+            }
+        }
+    }
+
+    return n;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int /* argc */, char* /* argv */[])
+{
+    // pipe to expand: `test.performance.stlsoft.heavy_hitters_map | expand -t 8,32,48,64,80,96,112`
+
+    std::vector<int> keys(NUM_ITERATIONS);
+
+    for (ss_size_t i = 0; i != NUM_ITERATIONS; ++i)
+    {
+        keys[i] = skewed_key(i);
+    }
+
+    stopwatch_t sw;
+
+    std::cout << std::endl;
+    std::cout
+        << '\t'
+        << "container"
+        << '\t'
+        << "capacity"
+        << '\t'
+        << "total (ns)"
+        << '\t'
+        << "ns / push"
+        << '\t'
+        << "size"
+        << '\t'
+        << "error bound"
+        << '\t'
+        << "top-" << TOP_K << " hits"
+        << std::endl;
+
+    // frequency_map
+
+    std::vector<std::pair<int, fm_t::count_type> > exact;
+
+    {
+        fm_t fm;
+
+        sw.start();
+        for (int key : keys)
+        {
+            fm.push(key);
+        }
+        sw.stop();
+
+        interval_t const interval = sw.get_nanoseconds();
+
+        exact.assign(fm.begin(), fm.end());
+
+        std::partial_sort(exact.begin(), exact.begin() + TOP_K, exact.end(), [](std::pair<int, fm_t::count_type> const& lhs, std::pair<int, fm_t::count_type> const& rhs) {
+
+            return lhs.second > rhs.second;
+        });
+        exact.resize(TOP_K);
+
+        std::cout
+            << '\t'
+            << "frequency_map"
+            << '\t'
+            << "-"
+            << '\t'
+            << std::setw(12) << std::right << interval
+            << '\t'
+            << std::setw(8) << std::fixed << std::setprecision(3) << (static_cast<double>(interval) / NUM_ITERATIONS)
+            << '\t'
+            << std::setw(8) << fm.size()
+            << '\t'
+            << std::setw(8) << 0
+            << '\t'
+            << std::setw(4) << TOP_K
+            << std::endl;
+    }
+
+    // heavy_hitters_map
+
+    for (ss_size_t capacity = 16; capacity <= 16384; capacity *= 4)
+    {
+        hhm_t hhm(capacity);
+
+        sw.start();
+        for (int key : keys)
+        {
+            hhm.push(key);
+        }
+        sw.stop();
+
+        interval_t const interval = sw.get_nanoseconds();
+
+        std::cout
+            << '\t'
+            << "heavy_hitters_map"
+            << '\t'
+            << capacity
+            << '\t'
+            << std::setw(12) << std::right << interval
+            << '\t'
+            << std::setw(8) << std::fixed << std::setprecision(3) << (static_cast<double>(interval) / NUM_ITERATIONS)
+            << '\t'
+            << std::setw(8) << hhm.size()
+            << '\t'
+            << std::setw(8) << hhm.error_bound()
+            << '\t'
+            << std::setw(4) << num_correct(exact, hhm.top(TOP_K))
+            << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,317 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.performance.stlsoft.integer_to_decimal_string/main.cpp
+ *
+ * Purpose: Perf-test for `stlsoft::integer_to_decimal_string()` and
+ *          `stlsoft::integer_to_decimal_chars()`, comparing them with the
+ *          previous (digit-at-a-time) implementation, `sprintf()`, and
+ *          (where available) `std::to_chars()`, for values of small,
+ *          mixed, and large magnitudes.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * feature control
+ */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* /////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/conversion/integer_to_string/integer_to_decimal_string.hpp>
+
+/* /////////////////////////////////////
+ * general includes
+ */
+
+/* STLSoft header files */
+
+#include <stlsoft/diagnostics/std_chrono_hrc_stopwatch.hpp>
+
+/* Standard header files */
+
+#if __cplusplus >= 201703L
+# include <charconv>
+#endif /* C++17+ */
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+typedef stlsoft::std_chrono_hrc_stopwatch                   stopwatch_t;
+typedef stopwatch_t::interval_type                          interval_t;
+
+using stlsoft::ss_size_t;
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * constants
+ */
+
+namespace {
+
+    ss_size_t const NUM_VALUES      =   1000000;
+    ss_size_t const NUM_ITERATIONS  =   10;
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * functions
+ */
+
+namespace {
+
+// the previous (digit-at-a-time) implementation, as the baseline
+char const*
+digit_at_a_time(
+    char*       buf
+,   ss_size_t   cchBuf
+,   uint64_t    i
+)
+{
+    char* p = buf + (cchBuf - 1);
+
+    *p = '\0';
+
+    do
+    {
+        *--p = static_cast<char>('0' + static_cast<unsigned>(i % 10));
+
+        i /= 10;
+    }
+    while (0 != i);
+
+    return p;
+}
+
+std::vector<uint64_t>
+make_values(
+    unsigned minDigits
+,   unsigned maxDigits
+)
+{
+    std::vector<uint64_t>   values;
+    uint64_t                r = 12345;
+
+    values.reserve(NUM_VALUES);
+
+    for (ss_size_t i = 0; i != NUM_VALUES; ++i)
+    {
+        r = r * 6364136223846793005ull + 1442695040888963407ull;
+
+        unsigned const numDigits = minDigits + static_cast<unsigned>((r >> 33) % (1 + maxDigits - minDigits));
+
+        if (numDigits >= 20)
+        {
+            values.push_back(r | 10000000000000000000ull);
+        }
+        else
+        {
+            uint64_t lo = 1;
+
+            for (unsigned j = 1; j != numDigits; ++j)
+            {
+                lo *= 10;
+            }
+
+            values.push_back(lo + r % (9 * lo));
+        }
+    }
+
+    return values;
+}
+
+template <typename T_fn>
+interval_t
+test_(
+    T_fn        fn
+,   ss_size_t*  numChars
+)
+{
+    stopwatch_t sw;
+    interval_t  interval = 0;
+
+    for (int W = 2; W != 0; --W)
+    {
+        sw.start();
+
+        *numChars = 0;
+
+        for (ss_size_t i = 0; i != NUM_ITERATIONS; ++i)
+        {
+            *numChars += fn();
+        }
+
+        sw.stop();
+
+        interval = sw.get_nanoseconds();
+    }
+
+    return interval;
+}
+
+void
+display_results(
+    std::ostream&       stm
+,   char const*         test_name
+,   interval_t          interval
+,   ss_size_t           num_chars
+,   interval_t          baseline
+)
+{
+    stm
+        << '\t'
+        << test_name
+        << '\t'
+        << std::setw(12) << std::right << interval
+        << '\t'
+        << std::setw(10) << std::right << num_chars
+        << '\t'
+        << std::setw(8) << std::fixed << std::setprecision(2) << (100.0 * static_cast<double>(interval) / static_cast<double>(baseline)) << '%'
+        << std::endl;
+}
+
+void
+run_tests(
+    char const* title
+,   unsigned    minDigits
+,   unsigned    maxDigits
+)
+{
+    std::vector<uint64_t> const values = make_values(minDigits, maxDigits);
+
+    std::cout << std::endl;
+    std::cout << title << ":" << std::endl;
+
+    ss_size_t nc_sprintf, nc_previous, nc_string, nc_chars;
+
+    interval_t const r_sprintf = test_([&](){
+
+        ss_size_t   n = 0;
+        char        buf[21];
+
+        for (std::vector<uint64_t>::const_iterator i = values.begin(); i != values.end(); ++i)
+        {
+            n += static_cast<ss_size_t>(::snprintf(buf, sizeof(buf), "%llu", static_cast<unsigned long long>(*i)));
+        }
+
+        return n;
+    }, &nc_sprintf);
+
+    interval_t const r_previous = test_([&](){
+
+        ss_size_t   n = 0;
+        char        buf[21];
+
+        for (std::vector<uint64_t>::const_iterator i = values.begin(); i != values.end(); ++i)
+        {
+            char const* const s = digit_at_a_time(buf, STLSOFT_NUM_ELEMENTS(buf), *i);
+
+            n += static_cast<ss_size_t>((buf + STLSOFT_NUM_ELEMENTS(buf) - 1) - s);
+        }
+
+        return n;
+    }, &nc_previous);
+
+    interval_t const r_string = test_([&](){
+
+        ss_size_t   n = 0;
+        char        buf[21];
+
+        for (std::vector<uint64_t>::const_iterator i = values.begin(); i != values.end(); ++i)
+        {
+            ss_size_t nw;
+
+            stlsoft::integer_to_decimal_string(buf, STLSOFT_NUM_ELEMENTS(buf), *i, &nw);
+
+            n += nw;
+        }
+
+        return n;
+    }, &nc_string);
+
+    interval_t const r_chars = test_([&](){
+
+        ss_size_t   n = 0;
+        char        buf[20];
+
+        for (std::vector<uint64_t>::const_iterator i = values.begin(); i != values.end(); ++i)
+        {
+            n += stlsoft::integer_to_decimal_chars(buf, STLSOFT_NUM_ELEMENTS(buf), *i);
+        }
+
+        return n;
+    }, &nc_chars);
+
+    display_results(std::cout, "snprintf()", r_sprintf, nc_sprintf, r_sprintf);
+    display_results(std::cout, "previous", r_previous, nc_previous, r_sprintf);
+    display_results(std::cout, "integer_to_decimal_string()", r_string, nc_string, r_sprintf);
+    display_results(std::cout, "integer_to_decimal_chars()", r_chars, nc_chars, r_sprintf);
+
+#if __cplusplus >= 201703L
+
+    ss_size_t nc_to_chars;
+
+    interval_t const r_to_chars = test_([&](){
+
+        ss_size_t   n = 0;
+        char        buf[20];
+
+        for (std::vector<uint64_t>::const_iterator i = values.begin(); i != values.end(); ++i)
+        {
+            n += static_cast<ss_size_t>(std::to_chars(buf, buf + sizeof(buf), *i).ptr - buf);
+        }
+
+        return n;
+    }, &nc_to_chars);
+
+    display_results(std::cout, "std::to_chars()", r_to_chars, nc_to_chars, r_sprintf);
+#endif /* C++17+ */
+}
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int /* argc */, char* /* argv */[])
+{
+    // pipe to expand: `test.performance.stlsoft.integer_to_decimal_string | expand -t 8,40,56,72`
+
+    std::cout
+        << '\t'
+        << "test"
+        << '\t'
+        << "total (ns)"
+        << '\t'
+        << "#chars"
+        << '\t'
+        << "%"
+        << std::endl;
+
+    run_tests("1-4 digits", 1, 4);
+    run_tests("1-20 digits", 1, 20);
+    run_tests("16-20 digits", 16, 20);
+
+    return EXIT_SUCCESS;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
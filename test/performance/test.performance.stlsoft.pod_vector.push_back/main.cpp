@@ -0,0 +1,187 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.performance.stlsoft.pod_vector.push_back/main.cpp
+ *
+ * Purpose: Perf-test for `stlsoft::pod_vector<>::push_back()` under each
+ *          of the growth policies, compared with `std::vector<>`.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * feature control
+ */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* /////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/containers/pod_vector.hpp>
+
+/* /////////////////////////////////////
+ * general includes
+ */
+
+/* STLSoft header files */
+
+#include <stlsoft/diagnostics/std_chrono_hrc_stopwatch.hpp>
+
+/* Standard header files */
+
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+typedef stlsoft::std_chrono_hrc_stopwatch                   stopwatch_t;
+typedef stopwatch_t::interval_type                          interval_t;
+
+using stlsoft::ss_size_t;
+
+struct pod_t
+{
+    int     i;
+    double  d;
+};
+
+typedef stlsoft::pod_vector<
+    pod_t
+,   std::allocator<pod_t>
+,   64
+,   stlsoft::pod_vector_linear_growth_policy
+>                                                           linear_vector_t;
+typedef stlsoft::pod_vector<
+    pod_t
+,   std::allocator<pod_t>
+,   64
+,   stlsoft::pod_vector_geometric_growth_policy<>
+>                                                           geometric_1_5_vector_t;
+typedef stlsoft::pod_vector<
+    pod_t
+,   std::allocator<pod_t>
+,   64
+,   stlsoft::pod_vector_geometric_growth_policy<2, 1>
+>                                                           geometric_2_vector_t;
+typedef stlsoft::pod_vector<
+    pod_t
+,   std::allocator<pod_t>
+,   64
+,   stlsoft::pod_vector_exact_growth_policy
+>                                                           exact_vector_t;
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * constants
+ */
+
+namespace {
+
+    ss_size_t const MAX_ELEMENTS            =   10000000;
+
+    // the linear and exact policies copy O(n^2) elements, so are measured
+    // only up to this many elements
+    ss_size_t const MAX_QUADRATIC_ELEMENTS  =   100000;
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * functions
+ */
+
+template <typename T_vector>
+void
+report(
+    char const* name
+,   ss_size_t   numElements
+,   bool        reserve
+)
+{
+    stopwatch_t sw;
+    T_vector    v;
+
+    sw.start();
+    if (reserve)
+    {
+        v.reserve(numElements);
+    }
+    for (ss_size_t i = 0; i != numElements; ++i)
+    {
+        pod_t const pod = { static_cast<int>(i), 0.0 };
+
+        v.push_back(pod);
+    }
+    sw.stop();
+
+    interval_t const interval = sw.get_nanoseconds();
+
+    std::cout
+        << '\t'
+        << name
+        << '\t'
+        << std::setw(10) << std::right << numElements
+        << '\t'
+        << std::setw(14) << interval
+        << '\t'
+        << std::setw(10) << std::fixed << std::setprecision(3) << (static_cast<double>(interval) / numElements)
+        << '\t'
+        << std::setw(10) << v.capacity()
+        << std::endl;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int /* argc */, char* /* argv */[])
+{
+    // pipe to expand: `test.performance.stlsoft.pod_vector.push_back | expand -t 8,40,56,72,88`
+
+    std::cout << std::endl;
+    std::cout
+        << '\t'
+        << "container"
+        << '\t'
+        << "# elements"
+        << '\t'
+        << "total (ns)"
+        << '\t'
+        << "ns / push_back"
+        << '\t'
+        << "capacity"
+        << std::endl;
+
+    for (ss_size_t n = 1000; n <= MAX_ELEMENTS; n *= 10)
+    {
+        if (n <= MAX_QUADRATIC_ELEMENTS)
+        {
+            report<linear_vector_t>("pod_vector (linear)", n, false);
+            report<exact_vector_t>("pod_vector (exact)", n, false);
+        }
+        report<geometric_1_5_vector_t>("pod_vector (geometric 1.5)", n, false);
+        report<geometric_2_vector_t>("pod_vector (geometric 2)", n, false);
+        report<linear_vector_t>("pod_vector (reserve)", n, true);
+        report<std::vector<pod_t> >("std::vector", n, false);
+
+        std::cout << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,257 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.performance.stlsoft.read_line/main.cpp
+ *
+ * Purpose: Perf-test for `stlsoft::read_line()`, comparing the
+ *          char-by-char and the block forms, for LF and CRLF input.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * feature control
+ */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* /////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/filesystem/io_functions/read_line.hpp>
+
+/* /////////////////////////////////////
+ * general includes
+ */
+
+/* STLSoft header files */
+
+#include <stlsoft/diagnostics/std_chrono_hrc_stopwatch.hpp>
+
+/* Standard header files */
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+typedef stlsoft::std_chrono_hrc_stopwatch                   stopwatch_t;
+typedef stopwatch_t::interval_type                          interval_t;
+
+using stlsoft::ss_size_t;
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * constants
+ */
+
+namespace {
+
+    ss_size_t const NUM_LINES = 1000000;
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * functions
+ */
+
+std::string
+make_contents(
+    char const* eol
+)
+{
+    std::string contents;
+
+    for (ss_size_t i = 0; i != NUM_LINES; ++i)
+    {
+        contents.append(10 + i % 150, static_cast<char>('a' + i % 26));
+        contents += eol;
+    }
+
+    return contents;
+}
+
+template <typename T_fn>
+interval_t
+test_(
+    T_fn        fn
+,   ss_size_t*  numLines
+,   ss_size_t*  numChars
+)
+{
+    stopwatch_t sw;
+    interval_t  interval = 0;
+
+    for (int W = 2; W != 0; --W)
+    {
+        sw.start();
+
+        fn(numLines, numChars);
+
+        sw.stop();
+
+        interval = sw.get_nanoseconds();
+    }
+
+    return interval;
+}
+
+void
+display_results(
+    std::ostream&       stm
+,   char const*         test_name
+,   interval_t          interval
+,   ss_size_t           num_lines
+,   ss_size_t           num_chars
+,   interval_t          baseline
+)
+{
+    stm
+        << '\t'
+        << test_name
+        << '\t'
+        << std::setw(12) << std::right << interval
+        << '\t'
+        << std::setw(10) << std::right << num_lines
+        << '\t'
+        << std::setw(12) << std::right << num_chars
+        << '\t'
+        << std::setw(8) << std::fixed << std::setprecision(2) << (100.0 * static_cast<double>(interval) / static_cast<double>(baseline)) << '%'
+        << std::endl;
+}
+
+void
+run_tests(
+    char const* eol_name
+,   char const* eol
+)
+{
+    std::string const   contents = make_contents(eol);
+    FILE* const         stm = ::tmpfile();
+
+    if (NULL == stm)
+    {
+        std::cerr << "could not create temporary file" << std::endl;
+
+        ::exit(EXIT_FAILURE);
+    }
+
+    ::fwrite(contents.data(), 1, contents.size(), stm);
+
+    std::cout << std::endl;
+    std::cout << eol_name << ':' << std::endl;
+
+    ss_size_t nl_fgetc, nc_fgetc;
+    ss_size_t nl_FILE, nc_FILE;
+    ss_size_t nl_iter, nc_iter;
+    ss_size_t nl_span, nc_span;
+
+    // FILE*, char-by-char via fgetc() (the previous implementation)
+    interval_t const r_fgetc = test_([stm](ss_size_t* nl, ss_size_t* nc) {
+
+        std::string                         line;
+        stlsoft::readers::read_from_FILE    policy(stm);
+
+        *nl = *nc = 0;
+
+        ::rewind(stm);
+
+        for (; stlsoft::read_line_impl::read_line(policy, line, stlsoft::read_line_flags::recogniseAll); ++*nl)
+        {
+            *nc += line.size();
+        }
+    }, &nl_fgetc, &nc_fgetc);
+
+    // FILE*, via read_line()
+    interval_t const r_FILE = test_([stm](ss_size_t* nl, ss_size_t* nc) {
+
+        std::string line;
+
+        *nl = *nc = 0;
+
+        ::rewind(stm);
+
+        for (; stlsoft::read_line(stm, line); ++*nl)
+        {
+            *nc += line.size();
+        }
+    }, &nl_FILE, &nc_FILE);
+
+    // in-memory, char-by-char via iterator range
+    interval_t const r_iter = test_([&contents](ss_size_t* nl, ss_size_t* nc) {
+
+        std::string                                                     line;
+        stlsoft::readers::read_from_iterator_range<char const*>         policy(contents.data(), contents.data() + contents.size());
+
+        *nl = *nc = 0;
+
+        for (; stlsoft::read_line_impl::read_line(policy, line, stlsoft::read_line_flags::recogniseAll); ++*nl)
+        {
+            *nc += line.size();
+        }
+    }, &nl_iter, &nc_iter);
+
+    // in-memory, contiguous
+    interval_t const r_span = test_([&contents](ss_size_t* nl, ss_size_t* nc) {
+
+        std::string                             line;
+        stlsoft::readers::read_from_char_range  policy(contents.data(), contents.data() + contents.size());
+
+        *nl = *nc = 0;
+
+        for (; stlsoft::read_line_impl::read_line(policy, line, stlsoft::read_line_flags::recogniseAll); ++*nl)
+        {
+            *nc += line.size();
+        }
+    }, &nl_span, &nc_span);
+
+    display_results(std::cout, "FILE* (fgetc)", r_fgetc, nl_fgetc, nc_fgetc, r_fgetc);
+    display_results(std::cout, "FILE* (read_line)", r_FILE, nl_FILE, nc_FILE, r_fgetc);
+    display_results(std::cout, "iterator range", r_iter, nl_iter, nc_iter, r_iter);
+    display_results(std::cout, "contiguous range", r_span, nl_span, nc_span, r_iter);
+
+    ::fclose(stm);
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int /* argc */, char* /* argv */[])
+{
+    // pipe to expand: `test.performance.stlsoft.read_line | expand -t 8,32,48,64,80`
+
+    std::cout
+        << '\t'
+        << "test"
+        << '\t'
+        << "total (ns)"
+        << '\t'
+        << "#lines"
+        << '\t'
+        << "#chars"
+        << '\t'
+        << "%"
+        << std::endl;
+
+    run_tests("LF", "\n");
+    run_tests("CRLF", "\r\n");
+
+    return EXIT_SUCCESS;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
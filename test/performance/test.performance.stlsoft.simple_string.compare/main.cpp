@@ -4,7 +4,7 @@
  * Purpose: Perf-test for `stlsoft::basic_simple_string#compare()`.
  *
  * Created: 15th March 2024
- * Updated: 5th May 2024
+ * Updated: 16th October 2026
  *
  * ////////////////////////////////////////////////////////////////////// */
 
@@ -354,6 +354,12 @@ very small (unequal contents)|abcd|abce
 very small (unequal lengths)|abcd|abcde
 )EOS"
 R"EOS(
+short (internal, equal)|abcdefghijklmno|abcdefghijklmno
+short (internal, unequal contents)|abcdefghijklmno|abcdefghijklmnO
+short (internal, unequal lengths)|abcdefghijklmno|abcdefghijklmn
+short (external, equal)|abcdefghijklmnop|abcdefghijklmnop
+)EOS"
+R"EOS(
 small (equal)|abcdefghijklmnopqrstuvwxyz|abcdefghijklmnopqrstuvwxyz
 small (unequal contents)|abcdefghijklmnopqrstuvwxyz|abcdefghijklmnopqrstuvwxyZ
 small (unequal lengths)|abcdefghijklmnopqrstuvwxyz|abcdefghijklmnopqrstuvwxy
@@ -1,10 +1,11 @@
 /* /////////////////////////////////////////////////////////////////////////
  * File:    test.performance.stlsoft.simple_string.op_eq/main.cpp
  *
- * Purpose: Perf-test for `stlsoft::basic_simple_string#operator ==()`.
+ * Purpose: Perf-test for `stlsoft::basic_simple_string#operator ==()`,
+ *          alone and together with construction of one of the operands.
  *
  * Created: 15th March 2024
- * Updated: 5th May 2024
+ * Updated: 16th October 2026
  *
  * ////////////////////////////////////////////////////////////////////// */
 
@@ -167,6 +168,46 @@ do_equal_as_scr(
     return std::make_pair(sw.get_nanoseconds(), anchoring_value);
 }
 
+STLSOFT_NOINLINE
+std::pair<
+    interval_type   // total_time_ns
+,   ss_sint64_t     // anchoring_value - this to incline the optimiser to not elide the whole thing
+>
+do_construct_and_equal_as_scr(
+    string_t const&     s1
+,   string_t const&     s2
+,   ss_size_t           num_iterations
+)
+{
+    stopwatch   sw;
+    ss_sint64_t anchoring_value = 0;
+
+    for (int W = 2; W > 0; --W)
+    {
+        anchoring_value = 0;
+
+        sw.start();
+
+        for (ss_size_t i = 0; i != num_iterations; ++i)
+        {
+            string_t const s3(s2.data(), s2.size());
+
+            if (s1 == s3)
+            {
+                anchoring_value += i;
+            }
+            else
+            {
+                anchoring_value -= 1;
+            }
+        }
+
+        sw.stop();
+    }
+
+    return std::make_pair(sw.get_nanoseconds(), anchoring_value);
+}
+
 void
 display_results(
     std::ostream&       stm
@@ -227,6 +268,12 @@ very small (unequal contents)|abcd|abce
 very small (unequal lengths)|abcd|abcde
 )EOS"
 R"EOS(
+short (internal, equal)|abcdefghijklmno|abcdefghijklmno
+short (internal, unequal contents)|abcdefghijklmno|abcdefghijklmnO
+short (internal, unequal lengths)|abcdefghijklmno|abcdefghijklmn
+short (external, equal)|abcdefghijklmnop|abcdefghijklmnop
+)EOS"
+R"EOS(
 small (equal)|abcdefghijklmnopqrstuvwxyz|abcdefghijklmnopqrstuvwxyz
 small (unequal contents)|abcdefghijklmnopqrstuvwxyz|abcdefghijklmnopqrstuvwxyZ
 small (unequal lengths)|abcdefghijklmnopqrstuvwxyz|abcdefghijklmnopqrstuvwxy
@@ -366,6 +413,56 @@ large (unequal lengths)|abcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyzabcd
         }
     }
 
+    // sc(p, n) <=> sc&
+    {
+        std::cout << "sc(p, n) <=> sc&:" << std::endl;
+
+        for (auto i : line_tokeniser)
+        {
+            field_tokeniser_t       field_tokeniser(i, field_delim);
+            std::vector<string_t>   fields(field_tokeniser.begin(), field_tokeniser.end());
+
+            if (0 == fields.size())
+            {
+                continue;
+            }
+
+            if (3 != fields.size())
+            {
+                std::cerr
+                    << program_name << ": "
+                    << "UNEXPECTED: "
+                    << "scenario line '"
+                    << i
+                    << "' contains " << fields.size() << " field(s), not 3 as required"
+                    << std::endl;
+
+                return EXIT_FAILURE;
+            }
+
+            string_t const& s1  =   fields[1];
+            string_t const& s2  =   fields[2];
+
+            auto const      r   =   do_construct_and_equal_as_scr(s1, s2, NUM_ITERATIONS);
+
+            display_results(
+                std::cout
+            ,   fields[0].c_str()
+            ,   NUM_ITERATIONS
+#if 0
+#elif defined(USE_std_string)
+            ,   "std::string"
+#else
+            ,   "stlsoft::simple_string"
+# ifdef STLSOFT_SIMPLE_STRING_HAS_equal
+                "(HAS_equal)"
+# endif
+#endif
+            ,   r
+            );
+        }
+    }
+
     return EXIT_SUCCESS;
 }
 
@@ -0,0 +1,298 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.performance.stlsoft.split_functions/main.cpp
+ *
+ * Purpose: Perf-test for `stlsoft::split()`, `stlsoft::split_fields()`,
+ *          and `stlsoft::split_csv_fields()`, comparing splitting of lines
+ *          of comma-separated fields into a vector of strings with that
+ *          into an array of views of the lines.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * feature control
+ */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* /////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/string/split_functions.hpp>
+
+/* /////////////////////////////////////
+ * general includes
+ */
+
+/* STLSoft header files */
+
+#include <stlsoft/diagnostics/std_chrono_hrc_stopwatch.hpp>
+#include <stlsoft/string/string_view.hpp>
+
+/* Standard header files */
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+typedef stlsoft::std_chrono_hrc_stopwatch                   stopwatch_t;
+typedef stopwatch_t::interval_type                          interval_t;
+
+using stlsoft::ss_size_t;
+using stlsoft::string_view;
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * constants
+ */
+
+namespace {
+
+    ss_size_t const NUM_LINES       =   100000;
+    ss_size_t const NUM_ITERATIONS  =   10;
+    ss_size_t const MAX_FIELDS      =   32;
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * functions
+ */
+
+namespace {
+
+std::vector<std::string>
+make_lines(
+    bool quoting
+)
+{
+    static char const* const fields[] =
+    {
+        "2026-10-16T09:14:07.123", "INFO", "accepted", "10.0.0.1", "443",
+        "GET", "/api/v1/items", "200", "1532", "0.004", "Mozilla/5.0 (X11; Linux x86_64)",
+        "-", "cache-miss", "eu-west-1", "a3f9c2e1d4b5",
+    };
+
+    std::vector<std::string>    lines;
+    ss_size_t                   r = 12345;
+
+    lines.reserve(NUM_LINES);
+
+    for (ss_size_t i = 0; i != NUM_LINES; ++i)
+    {
+        std::string line;
+
+        for (ss_size_t j = 0; j != 6 + i % 10; ++j)
+        {
+            r = r * 1103515245 + 12345;
+
+            if (0 != j)
+            {
+                line += ',';
+            }
+
+            if (quoting &&
+                0 == (r >> 28) % 4)
+            {
+                line += "\"Smith, J\"";
+            }
+            else
+            {
+                line += fields[(r >> 16) % STLSOFT_NUM_ELEMENTS(fields)];
+            }
+        }
+
+        lines.push_back(line);
+    }
+
+    return lines;
+}
+
+template <typename T_fn>
+interval_t
+test_(
+    T_fn        fn
+,   ss_size_t*  numChars
+)
+{
+    stopwatch_t sw;
+    interval_t  interval = 0;
+
+    for (int W = 2; W != 0; --W)
+    {
+        sw.start();
+
+        *numChars = 0;
+
+        for (ss_size_t i = 0; i != NUM_ITERATIONS; ++i)
+        {
+            *numChars += fn();
+        }
+
+        sw.stop();
+
+        interval = sw.get_nanoseconds();
+    }
+
+    return interval;
+}
+
+void
+display_results(
+    std::ostream&       stm
+,   char const*         test_name
+,   interval_t          interval
+,   ss_size_t           num_chars
+,   interval_t          baseline
+)
+{
+    stm
+        << '\t'
+        << test_name
+        << '\t'
+        << std::setw(12) << std::right << interval
+        << '\t'
+        << std::setw(10) << std::right << num_chars
+        << '\t'
+        << std::setw(8) << std::fixed << std::setprecision(2) << (100.0 * static_cast<double>(interval) / static_cast<double>(baseline)) << '%'
+        << std::endl;
+}
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int /* argc */, char* /* argv */[])
+{
+    // pipe to expand: `test.performance.stlsoft.split_functions | expand -t 8,40,56,72`
+
+    std::vector<std::string> const lines = make_lines(false);
+    std::vector<std::string> const records = make_lines(true);
+
+    ss_size_t nc_vector, nc_split_6, nc_fields_6, nc_fields, nc_csv_fields;
+
+    interval_t const r_vector = test_([&](){
+
+        ss_size_t n = 0;
+
+        for (std::vector<std::string>::const_iterator i = lines.begin(); i != lines.end(); ++i)
+        {
+            std::vector<std::string> const fields = stlsoft::split<std::string>(*i, ',');
+
+            for (std::vector<std::string>::const_iterator j = fields.begin(); j != fields.end(); ++j)
+            {
+                n += j->size();
+            }
+        }
+
+        return n;
+    }, &nc_vector);
+
+    interval_t const r_split_6 = test_([&](){
+
+        ss_size_t n = 0;
+
+        for (std::vector<std::string>::const_iterator i = lines.begin(); i != lines.end(); ++i)
+        {
+            string_view s0, s1, s2, s3, s4, s5;
+
+            stlsoft::split(*i, ',', s0, s1, s2, s3, s4, s5);
+
+            n += s0.size() + s1.size() + s2.size() + s3.size() + s4.size() + s5.size();
+        }
+
+        return n;
+    }, &nc_split_6);
+
+    interval_t const r_fields_6 = test_([&](){
+
+        ss_size_t   n = 0;
+        string_view fields[6];
+
+        for (std::vector<std::string>::const_iterator i = lines.begin(); i != lines.end(); ++i)
+        {
+            ss_size_t const nf = stlsoft::split_fields(*i, ',', fields);
+
+            for (ss_size_t j = 0; j != nf; ++j)
+            {
+                n += fields[j].size();
+            }
+        }
+
+        return n;
+    }, &nc_fields_6);
+
+    interval_t const r_fields = test_([&](){
+
+        ss_size_t   n = 0;
+        string_view fields[MAX_FIELDS];
+
+        for (std::vector<std::string>::const_iterator i = lines.begin(); i != lines.end(); ++i)
+        {
+            ss_size_t const nf = stlsoft::split_fields(*i, ',', fields);
+
+            for (ss_size_t j = 0; j != nf; ++j)
+            {
+                n += fields[j].size();
+            }
+        }
+
+        return n;
+    }, &nc_fields);
+
+    interval_t const r_csv_fields = test_([&](){
+
+        ss_size_t   n = 0;
+        string_view fields[MAX_FIELDS];
+
+        for (std::vector<std::string>::const_iterator i = records.begin(); i != records.end(); ++i)
+        {
+            ss_size_t const nf = stlsoft::split_csv_fields(*i, ',', fields);
+
+            for (ss_size_t j = 0; j != nf; ++j)
+            {
+                n += fields[j].size();
+            }
+        }
+
+        return n;
+    }, &nc_csv_fields);
+
+    std::cout
+        << '\t'
+        << "test"
+        << '\t'
+        << "total (ns)"
+        << '\t'
+        << "#chars"
+        << '\t'
+        << "%"
+        << std::endl;
+
+    display_results(std::cout, "split<std::string>()", r_vector, nc_vector, r_vector);
+    display_results(std::cout, "split(6 x string_view)", r_split_6, nc_split_6, r_vector);
+    display_results(std::cout, "split_fields(6 x string_view)", r_fields_6, nc_fields_6, r_vector);
+    display_results(std::cout, "split_fields()", r_fields, nc_fields, r_vector);
+    display_results(std::cout, "split_csv_fields()", r_csv_fields, nc_csv_fields, r_vector);
+
+    return EXIT_SUCCESS;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
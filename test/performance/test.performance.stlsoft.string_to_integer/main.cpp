@@ -0,0 +1,339 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.performance.stlsoft.string_to_integer/main.cpp
+ *
+ * Purpose: Perf-test for `stlsoft::try_parse_to()` and
+ *          `stlsoft::parse_integer_sequence()`, comparing them with a
+ *          digit-at-a-time parser, `strtoull()`, and (where available)
+ *          `std::from_chars()`, for a buffer of comma-separated numbers
+ *          of small and mixed magnitudes.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * feature control
+ */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* /////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/conversion/string_to_integer.hpp>
+
+/* /////////////////////////////////////
+ * general includes
+ */
+
+/* STLSoft header files */
+
+#include <stlsoft/diagnostics/std_chrono_hrc_stopwatch.hpp>
+
+/* Standard header files */
+
+#if __cplusplus >= 201703L
+# include <charconv>
+#endif /* C++17+ */
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+typedef stlsoft::std_chrono_hrc_stopwatch                   stopwatch_t;
+typedef stopwatch_t::interval_type                          interval_t;
+
+using stlsoft::ss_size_t;
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * constants
+ */
+
+namespace {
+
+    ss_size_t const NUM_VALUES      =   1000000;
+    ss_size_t const NUM_ITERATIONS  =   10;
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * functions
+ */
+
+namespace {
+
+// digit-at-a-time parser, as the baseline
+char const*
+digit_at_a_time(
+    char const* s
+,   char const* end
+,   uint64_t*   pv
+)
+{
+    uint64_t v = 0;
+
+    for (; s != end && '0' <= *s && *s <= '9'; ++s)
+    {
+        v = 10 * v + static_cast<unsigned>(*s - '0');
+    }
+
+    *pv = v;
+
+    return s;
+}
+
+std::string
+make_buffer(
+    unsigned maxDigits
+)
+{
+    std::string s;
+    uint64_t    r = 12345;
+
+    for (ss_size_t i = 0; i != NUM_VALUES; ++i)
+    {
+        r = r * 6364136223846793005ull + 1442695040888963407ull;
+
+        unsigned const  numDigits = 1 + static_cast<unsigned>((r >> 33) % maxDigits);
+        char            buf[21];
+
+        ::snprintf(buf, sizeof(buf), "%llu", static_cast<unsigned long long>(r));
+
+        if (0 != i)
+        {
+            s += ',';
+        }
+        s.append(buf, stlsoft::minimum(static_cast<ss_size_t>(numDigits), ::strlen(buf)));
+    }
+
+    return s;
+}
+
+template <typename T_fn>
+interval_t
+test_(
+    T_fn        fn
+,   uint64_t*   total
+)
+{
+    stopwatch_t sw;
+    interval_t  interval = 0;
+
+    for (int W = 2; W != 0; --W)
+    {
+        sw.start();
+
+        *total = 0;
+
+        for (ss_size_t i = 0; i != NUM_ITERATIONS; ++i)
+        {
+            *total += fn();
+        }
+
+        sw.stop();
+
+        interval = sw.get_nanoseconds();
+    }
+
+    return interval;
+}
+
+void
+display_results(
+    std::ostream&       stm
+,   char const*         test_name
+,   interval_t          interval
+,   uint64_t            total
+,   interval_t          baseline
+)
+{
+    stm
+        << '\t'
+        << test_name
+        << '\t'
+        << std::setw(12) << std::right << interval
+        << '\t'
+        << std::setw(22) << std::right << total
+        << '\t'
+        << std::setw(8) << std::fixed << std::setprecision(2) << (100.0 * static_cast<double>(interval) / static_cast<double>(baseline)) << '%'
+        << std::endl;
+}
+
+void
+run_tests(
+    char const* title
+,   unsigned    maxDigits
+)
+{
+    std::string const           buffer  =   make_buffer(maxDigits);
+    // read through a volatile in each test, to prevent the (pure) parsing
+    // from being hoisted out of the iterations loop
+    char const* volatile const  vbegin  =   buffer.data();
+    ss_size_t const             size    =   buffer.size();
+
+    std::cout << std::endl;
+    std::cout << title << ":" << std::endl;
+
+    uint64_t t_strtoull, t_previous, t_try_parse_to, t_sequence;
+
+    interval_t const r_strtoull = test_([&](){
+
+        char const* const   begin   =   vbegin;
+        char const* const   end     =   begin + size;
+        uint64_t            total   =   0;
+
+        for (char const* s = begin; s < end; )
+        {
+            char* ep;
+
+            total += ::strtoull(s, &ep, 10);
+
+            s = ep + 1;
+        }
+
+        return total;
+    }, &t_strtoull);
+
+    interval_t const r_previous = test_([&](){
+
+        char const* const   begin   =   vbegin;
+        char const* const   end     =   begin + size;
+        uint64_t            total   =   0;
+
+        for (char const* s = begin; s < end; )
+        {
+            uint64_t v;
+
+            s = digit_at_a_time(s, end, &v) + 1;
+
+            total += v;
+        }
+
+        return total;
+    }, &t_previous);
+
+    interval_t const r_try_parse_to = test_([&](){
+
+        char const* const   begin   =   vbegin;
+        char const* const   end     =   begin + size;
+        uint64_t            total   =   0;
+
+        for (char const* s = begin; s < end; )
+        {
+            char const* const   comma   =   static_cast<char const*>(::memchr(s, ',', static_cast<ss_size_t>(end - s)));
+            char const* const   ep      =   (NULL != comma) ? comma : end;
+            uint64_t            v;
+
+            if (stlsoft::try_parse_to(s, static_cast<ss_size_t>(ep - s), &v))
+            {
+                total += v;
+            }
+
+            s = ep + 1;
+        }
+
+        return total;
+    }, &t_try_parse_to);
+
+    interval_t const r_sequence = test_([&](){
+
+        char const* const   begin   =   vbegin;
+        char const* const   end     =   begin + size;
+        uint64_t            total   =   0;
+        uint64_t            values[1024];
+
+        for (char const* s = begin; s < end; )
+        {
+            ss_size_t const n = stlsoft::parse_integer_sequence(s, static_cast<ss_size_t>(end - s), ',', &values[0], STLSOFT_NUM_ELEMENTS(values), &s);
+
+            if (0 == n)
+            {
+                break;
+            }
+
+            for (ss_size_t i = 0; i != n; ++i)
+            {
+                total += values[i];
+            }
+        }
+
+        return total;
+    }, &t_sequence);
+
+    display_results(std::cout, "strtoull()", r_strtoull, t_strtoull, r_strtoull);
+    display_results(std::cout, "digit-at-a-time", r_previous, t_previous, r_strtoull);
+    display_results(std::cout, "try_parse_to()", r_try_parse_to, t_try_parse_to, r_strtoull);
+    display_results(std::cout, "parse_integer_sequence()", r_sequence, t_sequence, r_strtoull);
+
+#if __cplusplus >= 201703L
+
+    uint64_t t_from_chars;
+
+    interval_t const r_from_chars = test_([&](){
+
+        char const* const   begin   =   vbegin;
+        char const* const   end     =   begin + size;
+        uint64_t            total   =   0;
+
+        for (char const* s = begin; s < end; )
+        {
+            uint64_t v = 0;
+
+            s = std::from_chars(s, end, v).ptr + 1;
+
+            total += v;
+        }
+
+        return total;
+    }, &t_from_chars);
+
+    display_results(std::cout, "std::from_chars()", r_from_chars, t_from_chars, r_strtoull);
+#endif /* C++17+ */
+}
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int /* argc */, char* /* argv */[])
+{
+    // pipe to expand: `test.performance.stlsoft.string_to_integer | expand -t 8,40,56,80`
+
+    std::cout
+        << '\t'
+        << "test"
+        << '\t'
+        << "total (ns)"
+        << '\t'
+        << "sum"
+        << '\t'
+        << "%"
+        << std::endl;
+
+    run_tests("1-4 digits", 4);
+    run_tests("1-20 digits", 20);
+
+    return EXIT_SUCCESS;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
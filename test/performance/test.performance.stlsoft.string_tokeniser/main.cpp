@@ -0,0 +1,266 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.performance.stlsoft.string_tokeniser/main.cpp
+ *
+ * Purpose: Perf-test for `stlsoft::string_tokeniser` and
+ *          `stlsoft::charset_tokeniser`, comparing tokenisation of lines
+ *          of comma-separated fields into owning strings with that into
+ *          views of the lines.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * feature control
+ */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* /////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/string/charset_tokeniser.hpp>
+#include <stlsoft/string/string_tokeniser.hpp>
+
+/* /////////////////////////////////////
+ * general includes
+ */
+
+/* STLSoft header files */
+
+#include <stlsoft/diagnostics/std_chrono_hrc_stopwatch.hpp>
+#include <stlsoft/string/string_view.hpp>
+
+/* Standard header files */
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+typedef stlsoft::std_chrono_hrc_stopwatch                   stopwatch_t;
+typedef stopwatch_t::interval_type                          interval_t;
+
+using stlsoft::ss_size_t;
+using stlsoft::charset_tokeniser;
+using stlsoft::skip_blank_tokens;
+using stlsoft::string_tokeniser;
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * constants
+ */
+
+namespace {
+
+    ss_size_t const NUM_LINES       =   100000;
+    ss_size_t const NUM_ITERATIONS  =   10;
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * functions
+ */
+
+namespace {
+
+std::vector<std::string>
+make_lines()
+{
+    static char const* const fields[] =
+    {
+        "2026-10-16T09:14:07.123", "INFO", "accepted", "10.0.0.1", "443",
+        "GET", "/api/v1/items", "200", "1532", "0.004", "Mozilla/5.0 (X11; Linux x86_64)",
+        "-", "cache-miss", "eu-west-1", "a3f9c2e1d4b5",
+    };
+
+    std::vector<std::string>    lines;
+    ss_size_t                   r = 12345;
+
+    lines.reserve(NUM_LINES);
+
+    for (ss_size_t i = 0; i != NUM_LINES; ++i)
+    {
+        std::string line;
+
+        for (ss_size_t j = 0; j != 6 + i % 10; ++j)
+        {
+            r = r * 1103515245 + 12345;
+
+            if (0 != j)
+            {
+                line += (0 == (r >> 28) % 3) ? ';' : ',';
+            }
+
+            line += fields[(r >> 16) % STLSOFT_NUM_ELEMENTS(fields)];
+        }
+
+        lines.push_back(line);
+    }
+
+    return lines;
+}
+
+template <typename T_fn>
+interval_t
+test_(
+    T_fn        fn
+,   ss_size_t*  numChars
+)
+{
+    stopwatch_t sw;
+    interval_t  interval = 0;
+
+    for (int W = 2; W != 0; --W)
+    {
+        sw.start();
+
+        *numChars = 0;
+
+        for (ss_size_t i = 0; i != NUM_ITERATIONS; ++i)
+        {
+            *numChars += fn();
+        }
+
+        sw.stop();
+
+        interval = sw.get_nanoseconds();
+    }
+
+    return interval;
+}
+
+template<
+    typename T_tokeniser
+,   typename T_delimiter
+>
+ss_size_t
+tokenise_lines(
+    std::vector<std::string> const& lines
+,   T_delimiter const&              delimiter
+)
+{
+    ss_size_t n = 0;
+
+    for (std::vector<std::string>::const_iterator i = lines.begin(); i != lines.end(); ++i)
+    {
+        T_tokeniser const tokens(*i, delimiter);
+
+        for (typename T_tokeniser::const_iterator j = tokens.begin(); j != tokens.end(); ++j)
+        {
+            n += (*j).size();
+        }
+    }
+
+    return n;
+}
+
+void
+display_results(
+    std::ostream&       stm
+,   char const*         test_name
+,   interval_t          interval
+,   ss_size_t           num_chars
+,   interval_t          baseline
+)
+{
+    stm
+        << '\t'
+        << test_name
+        << '\t'
+        << std::setw(12) << std::right << interval
+        << '\t'
+        << std::setw(10) << std::right << num_chars
+        << '\t'
+        << std::setw(8) << std::fixed << std::setprecision(2) << (100.0 * static_cast<double>(interval) / static_cast<double>(baseline)) << '%'
+        << std::endl;
+}
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int /* argc */, char* /* argv */[])
+{
+    // pipe to expand: `test.performance.stlsoft.string_tokeniser | expand -t 8,40,56,72`
+
+    std::vector<std::string> const lines = make_lines();
+
+    typedef string_tokeniser<
+        std::string
+    ,   char
+    >                                                       string_char_tokeniser_t;
+    typedef string_tokeniser<
+        stlsoft::string_view
+    ,   char
+    ,   skip_blank_tokens<true>
+    ,   stlsoft::string_view
+    >                                                       view_char_tokeniser_t;
+    typedef charset_tokeniser<
+        std::string
+    >                                                       string_charset_tokeniser_t;
+    typedef charset_tokeniser<
+        stlsoft::string_view
+    ,   skip_blank_tokens<true>
+    ,   stlsoft::string_view
+    >                                                       view_charset_tokeniser_t;
+
+    ss_size_t nc_string_char, nc_view_char;
+    ss_size_t nc_string_charset, nc_view_charset;
+
+    interval_t const r_string_char = test_([&](){
+
+        return tokenise_lines<string_char_tokeniser_t>(lines, ',');
+    }, &nc_string_char);
+
+    interval_t const r_view_char = test_([&](){
+
+        return tokenise_lines<view_char_tokeniser_t>(lines, ',');
+    }, &nc_view_char);
+
+    interval_t const r_string_charset = test_([&](){
+
+        return tokenise_lines<string_charset_tokeniser_t>(lines, ",;");
+    }, &nc_string_charset);
+
+    interval_t const r_view_charset = test_([&](){
+
+        return tokenise_lines<view_charset_tokeniser_t>(lines, ",;");
+    }, &nc_view_charset);
+
+    std::cout
+        << '\t'
+        << "test"
+        << '\t'
+        << "total (ns)"
+        << '\t'
+        << "#chars"
+        << '\t'
+        << "%"
+        << std::endl;
+
+    display_results(std::cout, "char (std::string)", r_string_char, nc_string_char, r_string_char);
+    display_results(std::cout, "char (string_view)", r_view_char, nc_view_char, r_string_char);
+    display_results(std::cout, "charset (std::string)", r_string_charset, nc_string_charset, r_string_charset);
+    display_results(std::cout, "charset (string_view)", r_view_charset, nc_view_charset, r_string_charset);
+
+    return EXIT_SUCCESS;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
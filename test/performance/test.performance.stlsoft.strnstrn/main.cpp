@@ -0,0 +1,425 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.performance.stlsoft.strnstrn/main.cpp
+ *
+ * Purpose: Perf-test for `stlsoft_C_strnstrn()`, `stlsoft_C_strnistrn()`,
+ *          and `stlsoft::c_string::strnstrn_searcher`, comparing them with
+ *          the naive search, for short and long needles, over many short
+ *          lines and over one long buffer.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * feature control
+ */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* /////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/string/c_string/strnistrn.h>
+#include <stlsoft/string/c_string/strnstrn.h>
+#include <stlsoft/string/c_string/strnstrn_searcher.h>
+
+/* /////////////////////////////////////
+ * general includes
+ */
+
+/* STLSoft header files */
+
+#include <stlsoft/diagnostics/std_chrono_hrc_stopwatch.hpp>
+
+/* Standard header files */
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+typedef stlsoft::std_chrono_hrc_stopwatch                   stopwatch_t;
+typedef stopwatch_t::interval_type                          interval_t;
+
+using stlsoft::ss_size_t;
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * constants
+ */
+
+namespace {
+
+    ss_size_t const NUM_LINES       =   200000;
+    ss_size_t const NUM_ITERATIONS  =   20;
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * functions
+ */
+
+namespace {
+
+// the previous (naive) implementation, as the baseline
+char const*
+naive_strnstrn(
+    char const* s1
+,   ss_size_t   n1
+,   char const* s2
+,   ss_size_t   n2
+)
+{
+    if (0 == n2)
+    {
+        return s1;
+    }
+
+    for (; n1 >= n2; --n1, ++s1)
+    {
+        if (*s1 == *s2)
+        {
+            ss_size_t i;
+
+            for (i = 1; i != n2; ++i)
+            {
+                if (s1[i] != s2[i])
+                {
+                    break;
+                }
+            }
+
+            if (i == n2)
+            {
+                return s1;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+char const*
+naive_strnistrn(
+    char const* s1
+,   ss_size_t   n1
+,   char const* s2
+,   ss_size_t   n2
+)
+{
+    if (0 == n2)
+    {
+        return s1;
+    }
+
+    for (; n1 >= n2; --n1, ++s1)
+    {
+        ss_size_t i;
+
+        for (i = 0; i != n2; ++i)
+        {
+            if (::toupper(static_cast<unsigned char>(s1[i])) != ::toupper(static_cast<unsigned char>(s2[i])))
+            {
+                break;
+            }
+        }
+
+        if (i == n2)
+        {
+            return s1;
+        }
+    }
+
+    return NULL;
+}
+
+std::vector<std::string>
+make_lines()
+{
+    static char const* const words[] =
+    {
+        "INFO", "connection", "accepted", "from", "10.0.0.1", "request",
+        "completed", "in", "ms", "user", "session", "started", "cache",
+        "miss", "for", "key", "retrying", "timeout", "exceeded", "queue",
+    };
+
+    std::vector<std::string>    lines;
+    ss_size_t                   r = 12345;
+
+    lines.reserve(NUM_LINES);
+
+    for (ss_size_t i = 0; i != NUM_LINES; ++i)
+    {
+        std::string line;
+
+        for (ss_size_t j = 0; j != 8 + i % 12; ++j)
+        {
+            r = r * 1103515245 + 12345;
+
+            line += words[(r >> 16) % STLSOFT_NUM_ELEMENTS(words)];
+            line += ' ';
+        }
+
+        if (0 == i % 1000)
+        {
+            line += "ERROR: disk quota exceeded on volume /var/log/application";
+        }
+
+        lines.push_back(line);
+    }
+
+    return lines;
+}
+
+template <typename T_fn>
+interval_t
+test_(
+    T_fn        fn
+,   ss_size_t*  numFound
+)
+{
+    stopwatch_t sw;
+    interval_t  interval = 0;
+
+    for (int W = 2; W != 0; --W)
+    {
+        sw.start();
+
+        *numFound = 0;
+
+        for (ss_size_t i = 0; i != NUM_ITERATIONS; ++i)
+        {
+            *numFound += fn();
+        }
+
+        sw.stop();
+
+        interval = sw.get_nanoseconds();
+    }
+
+    return interval;
+}
+
+void
+display_results(
+    std::ostream&       stm
+,   char const*         test_name
+,   interval_t          interval
+,   ss_size_t           num_found
+,   interval_t          baseline
+)
+{
+    stm
+        << '\t'
+        << test_name
+        << '\t'
+        << std::setw(12) << std::right << interval
+        << '\t'
+        << std::setw(10) << std::right << num_found
+        << '\t'
+        << std::setw(8) << std::fixed << std::setprecision(2) << (100.0 * static_cast<double>(interval) / static_cast<double>(baseline)) << '%'
+        << std::endl;
+}
+
+void
+run_tests(
+    char const* needle
+)
+{
+    std::vector<std::string> const  lines   =   make_lines();
+    std::string                     buffer;
+    ss_size_t const                 n2      =   ::strlen(needle);
+
+    for (std::vector<std::string>::const_iterator i = lines.begin(); i != lines.end(); ++i)
+    {
+        buffer += *i;
+        buffer += '\n';
+    }
+
+    std::cout << std::endl;
+    std::cout << "needle \"" << needle << "\" (" << n2 << "):" << std::endl;
+
+    ss_size_t nf_naive_lines, nf_lines, nf_searcher_lines;
+    ss_size_t nf_naive_buffer, nf_buffer, nf_searcher_buffer;
+    ss_size_t nf_inaive_lines, nf_ilines, nf_isearcher_lines;
+
+    // many short haystacks
+
+    interval_t const r_naive_lines = test_([&](){
+
+        ss_size_t n = 0;
+
+        for (std::vector<std::string>::const_iterator i = lines.begin(); i != lines.end(); ++i)
+        {
+            n += NULL != naive_strnstrn(i->data(), i->size(), needle, n2);
+        }
+
+        return n;
+    }, &nf_naive_lines);
+
+    interval_t const r_lines = test_([&](){
+
+        ss_size_t n = 0;
+
+        for (std::vector<std::string>::const_iterator i = lines.begin(); i != lines.end(); ++i)
+        {
+            n += NULL != stlsoft_C_strnstrn(i->data(), i->size(), needle, n2);
+        }
+
+        return n;
+    }, &nf_lines);
+
+    interval_t const r_searcher_lines = test_([&](){
+
+        stlsoft::c_string::strnstrn_searcher const  searcher(needle, n2);
+        ss_size_t                                   n = 0;
+
+        for (std::vector<std::string>::const_iterator i = lines.begin(); i != lines.end(); ++i)
+        {
+            n += NULL != searcher.find(i->data(), i->size());
+        }
+
+        return n;
+    }, &nf_searcher_lines);
+
+    // one long haystack
+
+    interval_t const r_naive_buffer = test_([&](){
+
+        ss_size_t   n   =   0;
+        char const* s   =   buffer.data();
+        char const* e   =   s + buffer.size();
+
+        for (; NULL != (s = naive_strnstrn(s, static_cast<ss_size_t>(e - s), needle, n2)); s += n2)
+        {
+            ++n;
+        }
+
+        return n;
+    }, &nf_naive_buffer);
+
+    interval_t const r_buffer = test_([&](){
+
+        ss_size_t   n   =   0;
+        char const* s   =   buffer.data();
+        char const* e   =   s + buffer.size();
+
+        for (; NULL != (s = stlsoft_C_strnstrn(s, static_cast<ss_size_t>(e - s), needle, n2)); s += n2)
+        {
+            ++n;
+        }
+
+        return n;
+    }, &nf_buffer);
+
+    interval_t const r_searcher_buffer = test_([&](){
+
+        stlsoft::c_string::strnstrn_searcher const  searcher(needle, n2);
+        ss_size_t                                   n   =   0;
+        char const*                                 s   =   buffer.data();
+        char const*                                 e   =   s + buffer.size();
+
+        for (; NULL != (s = searcher.find(s, static_cast<ss_size_t>(e - s))); s += n2)
+        {
+            ++n;
+        }
+
+        return n;
+    }, &nf_searcher_buffer);
+
+    // many short haystacks, case-insensitive
+
+    interval_t const r_inaive_lines = test_([&](){
+
+        ss_size_t n = 0;
+
+        for (std::vector<std::string>::const_iterator i = lines.begin(); i != lines.end(); ++i)
+        {
+            n += NULL != naive_strnistrn(i->data(), i->size(), needle, n2);
+        }
+
+        return n;
+    }, &nf_inaive_lines);
+
+    interval_t const r_ilines = test_([&](){
+
+        ss_size_t n = 0;
+
+        for (std::vector<std::string>::const_iterator i = lines.begin(); i != lines.end(); ++i)
+        {
+            n += NULL != stlsoft_C_strnistrn(i->data(), i->size(), needle, n2);
+        }
+
+        return n;
+    }, &nf_ilines);
+
+    interval_t const r_isearcher_lines = test_([&](){
+
+        stlsoft::c_string::strnstrn_searcher const  searcher(needle, n2, stlsoft::c_string::strnstrn_searcher::ignoreCase);
+        ss_size_t                                   n = 0;
+
+        for (std::vector<std::string>::const_iterator i = lines.begin(); i != lines.end(); ++i)
+        {
+            n += NULL != searcher.find(i->data(), i->size());
+        }
+
+        return n;
+    }, &nf_isearcher_lines);
+
+    display_results(std::cout, "lines (naive)", r_naive_lines, nf_naive_lines, r_naive_lines);
+    display_results(std::cout, "lines (strnstrn)", r_lines, nf_lines, r_naive_lines);
+    display_results(std::cout, "lines (searcher)", r_searcher_lines, nf_searcher_lines, r_naive_lines);
+    display_results(std::cout, "buffer (naive)", r_naive_buffer, nf_naive_buffer, r_naive_buffer);
+    display_results(std::cout, "buffer (strnstrn)", r_buffer, nf_buffer, r_naive_buffer);
+    display_results(std::cout, "buffer (searcher)", r_searcher_buffer, nf_searcher_buffer, r_naive_buffer);
+    display_results(std::cout, "ilines (naive)", r_inaive_lines, nf_inaive_lines, r_inaive_lines);
+    display_results(std::cout, "ilines (strnistrn)", r_ilines, nf_ilines, r_inaive_lines);
+    display_results(std::cout, "ilines (searcher)", r_isearcher_lines, nf_isearcher_lines, r_inaive_lines);
+}
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int /* argc */, char* /* argv */[])
+{
+    // pipe to expand: `test.performance.stlsoft.strnstrn | expand -t 8,32,48,64`
+
+    std::cout
+        << '\t'
+        << "test"
+        << '\t'
+        << "total (ns)"
+        << '\t'
+        << "#found"
+        << '\t'
+        << "%"
+        << std::endl;
+
+    run_tests("ERROR");
+    run_tests("quota exceeded");
+    run_tests("disk quota exceeded on volume /var/log/application and more than sixty-four");
+    run_tests("ERROR: disk quota exceeded on volume /var/log/application");
+
+    return EXIT_SUCCESS;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
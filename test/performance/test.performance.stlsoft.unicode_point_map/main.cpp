@@ -0,0 +1,319 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.performance.stlsoft.unicode_point_map/main.cpp
+ *
+ * Purpose: Perf-test for `stlsoft::unicode_point_map::push_utf8()`,
+ *          comparing serial and parallel bulk decoding with decoding by
+ *          the caller and pushing one point at a time, for text that is
+ *          mostly ASCII and text that is mostly not.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * feature control
+ */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* /////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/containers/unicode_point_map.hpp>
+
+/* /////////////////////////////////////
+ * general includes
+ */
+
+/* STLSoft header files */
+
+#include <stlsoft/diagnostics/std_chrono_hrc_stopwatch.hpp>
+
+/* Standard header files */
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include <stdint.h>
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+typedef stlsoft::std_chrono_hrc_stopwatch                   stopwatch_t;
+typedef stopwatch_t::interval_type                          interval_t;
+
+using stlsoft::ss_size_t;
+using stlsoft::unicode_point_map;
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * constants
+ */
+
+namespace {
+
+    ss_size_t const TEXT_SIZE       =   32 * 1024 * 1024;
+    ss_size_t const NUM_ITERATIONS  =   4;
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * functions
+ */
+
+namespace {
+
+void
+append_utf8(
+    std::string&    s
+,   uint32_t        pt
+)
+{
+    if (pt < 0x80)
+    {
+        s += static_cast<char>(pt);
+    }
+    else if (pt < 0x800)
+    {
+        s += static_cast<char>(0xC0 | (pt >> 6));
+        s += static_cast<char>(0x80 | (pt & 0x3F));
+    }
+    else
+    {
+        s += static_cast<char>(0xE0 | (pt >> 12));
+        s += static_cast<char>(0x80 | ((pt >> 6) & 0x3F));
+        s += static_cast<char>(0x80 | (pt & 0x3F));
+    }
+}
+
+// makes text of words of Latin (ASCII), Cyrillic, or CJK letters, with
+// the given percentage of words being ASCII
+std::string
+make_text(
+    unsigned asciiPercent
+)
+{
+    std::string s;
+    uint64_t    r = 12345;
+
+    s.reserve(TEXT_SIZE + 64);
+
+    for (; s.size() < TEXT_SIZE; )
+    {
+        r = r * 6364136223846793005ull + 1442695040888963407ull;
+
+        unsigned const  kind    =   static_cast<unsigned>((r >> 33) % 100);
+        unsigned const  len     =   2 + static_cast<unsigned>((r >> 40) % 8);
+
+        for (unsigned i = 0; i != len; ++i)
+        {
+            unsigned const v = static_cast<unsigned>((r >> (i * 3)) % 26);
+
+            if (kind < asciiPercent)
+            {
+                append_utf8(s, 'a' + v);
+            }
+            else if (kind < asciiPercent + (100 - asciiPercent) / 2)
+            {
+                append_utf8(s, 0x430 + v);
+            }
+            else
+            {
+                append_utf8(s, 0x4E00 + v * 97);
+            }
+        }
+
+        s += ' ';
+    }
+
+    return s;
+}
+
+// decoding by the caller, one point at a time, as the baseline
+ss_size_t
+push_each(
+    unicode_point_map&  upm
+,   char const*         s
+,   ss_size_t           cch
+)
+{
+    unsigned char const* const  begin   =   reinterpret_cast<unsigned char const*>(s);
+    unsigned char const* const  end     =   begin + cch;
+    unsigned char const*        p       =   begin;
+
+    for (; end != p; )
+    {
+        uint32_t    pt  =   *p;
+        ss_size_t   n   =   1;
+
+        if (pt >= 0xF0)
+        {
+            pt &= 0x07;
+            n = 4;
+        }
+        else if (pt >= 0xE0)
+        {
+            pt &= 0x0F;
+            n = 3;
+        }
+        else if (pt >= 0xC0)
+        {
+            pt &= 0x1F;
+            n = 2;
+        }
+
+        if (static_cast<ss_size_t>(end - p) < n)
+        {
+            break;
+        }
+
+        for (ss_size_t i = 1; i != n; ++i)
+        {
+            pt = (pt << 6) | (p[i] & 0x3F);
+        }
+
+        upm.push(pt);
+
+        p += n;
+    }
+
+    return static_cast<ss_size_t>(p - begin);
+}
+
+template <typename T_fn>
+interval_t
+test_(
+    T_fn            fn
+,   ss_size_t*      numPoints
+)
+{
+    stopwatch_t sw;
+    interval_t  interval = 0;
+
+    for (int W = 2; W != 0; --W)
+    {
+        sw.start();
+
+        *numPoints = 0;
+
+        for (ss_size_t i = 0; i != NUM_ITERATIONS; ++i)
+        {
+            *numPoints += fn();
+        }
+
+        sw.stop();
+
+        interval = sw.get_nanoseconds();
+    }
+
+    return interval;
+}
+
+void
+display_results(
+    std::ostream&       stm
+,   char const*         test_name
+,   interval_t          interval
+,   ss_size_t           num_points
+,   interval_t          baseline
+)
+{
+    stm
+        << '\t'
+        << test_name
+        << '\t'
+        << std::setw(12) << std::right << interval
+        << '\t'
+        << std::setw(12) << std::right << num_points
+        << '\t'
+        << std::setw(8) << std::fixed << std::setprecision(2) << (100.0 * static_cast<double>(interval) / static_cast<double>(baseline)) << '%'
+        << std::endl;
+}
+
+void
+run_tests(
+    char const* title
+,   unsigned    asciiPercent
+)
+{
+    std::string const   text    =   make_text(asciiPercent);
+    char const* const   s       =   text.data();
+    ss_size_t const     cch     =   text.size();
+
+    std::cout << std::endl;
+    std::cout << title << ":" << std::endl;
+
+    ss_size_t np_each, np_utf8, np_parallel;
+
+    interval_t const r_each = test_([&](){
+
+        unicode_point_map upm(0x800);
+
+        push_each(upm, s, cch);
+
+        return static_cast<ss_size_t>(upm.total());
+    }, &np_each);
+
+    interval_t const r_utf8 = test_([&](){
+
+        unicode_point_map upm(0x800);
+
+        upm.push_utf8(s, cch);
+
+        return static_cast<ss_size_t>(upm.total());
+    }, &np_utf8);
+
+    interval_t const r_parallel = test_([&](){
+
+        unicode_point_map upm(0x800);
+
+        upm.push_utf8(s, cch, 0);
+
+        return static_cast<ss_size_t>(upm.total());
+    }, &np_parallel);
+
+    display_results(std::cout, "decode + push()", r_each, np_each, r_each);
+    display_results(std::cout, "push_utf8()", r_utf8, np_utf8, r_each);
+    display_results(std::cout, "push_utf8() (parallel)", r_parallel, np_parallel, r_each);
+}
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int /* argc */, char* /* argv */[])
+{
+    // pipe to expand: `test.performance.stlsoft.unicode_point_map | expand -t 8,40,56,72`
+
+    std::cout
+        << '\t'
+        << "test"
+        << '\t'
+        << "total (ns)"
+        << '\t'
+        << "#points"
+        << '\t'
+        << "%"
+        << std::endl;
+
+    run_tests("100% ASCII", 100);
+    run_tests("90% ASCII", 90);
+    run_tests("10% ASCII", 10);
+
+    return EXIT_SUCCESS;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,281 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.performance.stlsoft.unsorted_map/main.cpp
+ *
+ * Purpose: Perf-test for `stlsoft::unsorted_map`, comparing insertion and
+ *          lookup with those of a linearly-searched vector (as used by
+ *          `stlsoft::unsorted_map` prior to its hash index), `std::map`,
+ *          and `std::unordered_map`, for string keys.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * feature control
+ */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* /////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/containers/unsorted_map.hpp>
+
+/* /////////////////////////////////////
+ * general includes
+ */
+
+/* STLSoft header files */
+
+#include <stlsoft/diagnostics/std_chrono_hrc_stopwatch.hpp>
+
+/* Standard header files */
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+typedef stlsoft::std_chrono_hrc_stopwatch                   stopwatch_t;
+typedef stopwatch_t::interval_type                          interval_t;
+
+using stlsoft::ss_size_t;
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * constants
+ */
+
+namespace {
+
+    // each test performs (about) this many insertions and lookups in total
+    ss_size_t const NUM_OPERATIONS  =   1000000;
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * functions
+ */
+
+namespace {
+
+typedef std::vector<std::pair<std::string, int> >           linear_map_t;
+
+std::vector<std::string>
+make_keys(
+    ss_size_t numKeys
+)
+{
+    std::vector<std::string> keys;
+
+    keys.reserve(numKeys);
+
+    for (ss_size_t i = 0; i != numKeys; ++i)
+    {
+        char buf[41];
+
+        ::snprintf(buf, sizeof(buf), "X-Header-Field-%lu", static_cast<unsigned long>(i * 7919));
+
+        keys.push_back(buf);
+    }
+
+    return keys;
+}
+
+template <typename T_fn>
+interval_t
+test_(
+    T_fn        fn
+,   ss_size_t   numIterations
+,   ss_size_t*  total
+)
+{
+    stopwatch_t sw;
+    interval_t  interval = 0;
+
+    for (int W = 2; W != 0; --W)
+    {
+        sw.start();
+
+        *total = 0;
+
+        for (ss_size_t i = 0; i != numIterations; ++i)
+        {
+            *total += fn();
+        }
+
+        sw.stop();
+
+        interval = sw.get_nanoseconds();
+    }
+
+    return interval;
+}
+
+void
+display_results(
+    std::ostream&       stm
+,   char const*         test_name
+,   interval_t          interval
+,   ss_size_t           total
+,   interval_t          baseline
+)
+{
+    stm
+        << '\t'
+        << test_name
+        << '\t'
+        << std::setw(12) << std::right << interval
+        << '\t'
+        << std::setw(12) << std::right << total
+        << '\t'
+        << std::setw(8) << std::fixed << std::setprecision(2) << (100.0 * static_cast<double>(interval) / static_cast<double>(baseline)) << '%'
+        << std::endl;
+}
+
+void
+run_tests(
+    ss_size_t numKeys
+)
+{
+    std::vector<std::string> const  keys            =   make_keys(numKeys);
+    // the linear search is O(n^2) overall, so the number of iterations is
+    // reduced for the larger maps, and all results are scaled to match
+    ss_size_t const                 numIterations   =   std::max<ss_size_t>(1, NUM_OPERATIONS / (numKeys * numKeys / 16 + numKeys));
+
+    std::cout << std::endl;
+    std::cout << numKeys << " keys (" << numIterations << " iterations):" << std::endl;
+
+    ss_size_t t_linear, t_unsorted_map, t_map, t_unordered_map;
+
+    interval_t const r_linear = test_([&](){
+
+        linear_map_t    m;
+        ss_size_t       n = 0;
+
+        for (std::vector<std::string>::const_iterator i = keys.begin(); i != keys.end(); ++i)
+        {
+            std::string const&      key =   *i;
+            linear_map_t::iterator  it  =   std::find_if(m.begin(), m.end(), [&](linear_map_t::value_type const& v) { return v.first == key; });
+
+            if (m.end() == it)
+            {
+                m.push_back(std::make_pair(key, 1));
+            }
+        }
+        for (std::vector<std::string>::const_iterator i = keys.begin(); i != keys.end(); ++i)
+        {
+            std::string const& key = *i;
+
+            n += std::find_if(m.begin(), m.end(), [&](linear_map_t::value_type const& v) { return v.first == key; })->second;
+        }
+
+        return n;
+    }, numIterations, &t_linear);
+
+    interval_t const r_unsorted_map = test_([&](){
+
+        stlsoft::unsorted_map<std::string, int> m;
+        ss_size_t                               n = 0;
+
+        for (std::vector<std::string>::const_iterator i = keys.begin(); i != keys.end(); ++i)
+        {
+            m.push_back(*i, 1);
+        }
+        for (std::vector<std::string>::const_iterator i = keys.begin(); i != keys.end(); ++i)
+        {
+            n += (*m.find(*i)).second;
+        }
+
+        return n;
+    }, numIterations, &t_unsorted_map);
+
+    interval_t const r_map = test_([&](){
+
+        std::map<std::string, int>  m;
+        ss_size_t                   n = 0;
+
+        for (std::vector<std::string>::const_iterator i = keys.begin(); i != keys.end(); ++i)
+        {
+            m.insert(std::make_pair(*i, 1));
+        }
+        for (std::vector<std::string>::const_iterator i = keys.begin(); i != keys.end(); ++i)
+        {
+            n += m.find(*i)->second;
+        }
+
+        return n;
+    }, numIterations, &t_map);
+
+    interval_t const r_unordered_map = test_([&](){
+
+        std::unordered_map<std::string, int>    m;
+        ss_size_t                               n = 0;
+
+        for (std::vector<std::string>::const_iterator i = keys.begin(); i != keys.end(); ++i)
+        {
+            m.insert(std::make_pair(*i, 1));
+        }
+        for (std::vector<std::string>::const_iterator i = keys.begin(); i != keys.end(); ++i)
+        {
+            n += m.find(*i)->second;
+        }
+
+        return n;
+    }, numIterations, &t_unordered_map);
+
+    display_results(std::cout, "linear search", r_linear, t_linear, r_linear);
+    display_results(std::cout, "stlsoft::unsorted_map", r_unsorted_map, t_unsorted_map, r_linear);
+    display_results(std::cout, "std::map", r_map, t_map, r_linear);
+    display_results(std::cout, "std::unordered_map", r_unordered_map, t_unordered_map, r_linear);
+}
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int /* argc */, char* /* argv */[])
+{
+    // pipe to expand: `test.performance.stlsoft.unsorted_map | expand -t 8,40,56,72`
+
+    std::cout
+        << '\t'
+        << "test"
+        << '\t'
+        << "total (ns)"
+        << '\t'
+        << "sum"
+        << '\t'
+        << "%"
+        << std::endl;
+
+    run_tests(8);
+    run_tests(64);
+    run_tests(512);
+    run_tests(4096);
+
+    return EXIT_SUCCESS;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,293 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.performance.stlsoft.utf8_transcoding/main.cpp
+ *
+ * Purpose: Perf-test for `stlsoft::m2w_utf8`, `stlsoft::w2m_utf8`, and
+ *          `stlsoft::utf8_decoder`, comparing them with the
+ *          `mbstowcs()`/`wcstombs()`-based `stlsoft::m2w` and
+ *          `stlsoft::w2m` (in a UTF-8 locale), for text that is all
+ *          ASCII, mostly ASCII, and mostly not.
+ *
+ *          NOTE: `stlsoft::w2m` sizes its buffer by the number of wide
+ *          characters, so for non-ASCII text its result is truncated, and
+ *          the #chars column reflects this.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * feature control
+ */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* /////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/conversion/char_conversions.hpp>
+#include <stlsoft/conversion/utf8_transcoding.hpp>
+
+/* /////////////////////////////////////
+ * general includes
+ */
+
+/* STLSoft header files */
+
+#include <stlsoft/diagnostics/std_chrono_hrc_stopwatch.hpp>
+
+/* Standard header files */
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <locale.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+typedef stlsoft::std_chrono_hrc_stopwatch                   stopwatch_t;
+typedef stopwatch_t::interval_type                          interval_t;
+
+using stlsoft::ss_size_t;
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * constants
+ */
+
+namespace {
+
+    ss_size_t const TEXT_SIZE       =   8 * 1024 * 1024;
+    ss_size_t const NUM_ITERATIONS  =   4;
+    ss_size_t const CHUNK_SIZE      =   4096;
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * functions
+ */
+
+namespace {
+
+void
+append_utf8(
+    std::string&    s
+,   uint32_t        pt
+)
+{
+    if (pt < 0x80)
+    {
+        s += static_cast<char>(pt);
+    }
+    else if (pt < 0x800)
+    {
+        s += static_cast<char>(0xC0 | (pt >> 6));
+        s += static_cast<char>(0x80 | (pt & 0x3F));
+    }
+    else
+    {
+        s += static_cast<char>(0xE0 | (pt >> 12));
+        s += static_cast<char>(0x80 | ((pt >> 6) & 0x3F));
+        s += static_cast<char>(0x80 | (pt & 0x3F));
+    }
+}
+
+// makes text of words of Latin (ASCII), Cyrillic, or CJK letters, with
+// the given percentage of words being ASCII
+std::string
+make_text(
+    unsigned asciiPercent
+)
+{
+    std::string s;
+    uint64_t    r = 12345;
+
+    s.reserve(TEXT_SIZE + 64);
+
+    for (; s.size() < TEXT_SIZE; )
+    {
+        r = r * 6364136223846793005ull + 1442695040888963407ull;
+
+        unsigned const  kind    =   static_cast<unsigned>((r >> 33) % 100);
+        unsigned const  len     =   2 + static_cast<unsigned>((r >> 40) % 8);
+
+        for (unsigned i = 0; i != len; ++i)
+        {
+            unsigned const v = static_cast<unsigned>((r >> (i * 3)) % 26);
+
+            if (kind < asciiPercent)
+            {
+                append_utf8(s, 'a' + v);
+            }
+            else if (kind < asciiPercent + (100 - asciiPercent) / 2)
+            {
+                append_utf8(s, 0x430 + v);
+            }
+            else
+            {
+                append_utf8(s, 0x4E00 + v * 97);
+            }
+        }
+
+        s += ' ';
+    }
+
+    return s;
+}
+
+template <typename T_fn>
+interval_t
+test_(
+    T_fn            fn
+,   ss_size_t*      numChars
+)
+{
+    stopwatch_t sw;
+    interval_t  interval = 0;
+
+    for (int W = 2; W != 0; --W)
+    {
+        sw.start();
+
+        *numChars = 0;
+
+        for (ss_size_t i = 0; i != NUM_ITERATIONS; ++i)
+        {
+            *numChars += fn();
+        }
+
+        sw.stop();
+
+        interval = sw.get_nanoseconds();
+    }
+
+    return interval;
+}
+
+void
+display_results(
+    std::ostream&       stm
+,   char const*         test_name
+,   interval_t          interval
+,   ss_size_t           num_chars
+,   interval_t          baseline
+)
+{
+    stm
+        << '\t'
+        << test_name
+        << '\t'
+        << std::setw(12) << std::right << interval
+        << '\t'
+        << std::setw(12) << std::right << num_chars
+        << '\t'
+        << std::setw(8) << std::fixed << std::setprecision(2) << (100.0 * static_cast<double>(interval) / static_cast<double>(baseline)) << '%'
+        << std::endl;
+}
+
+void
+run_tests(
+    char const* title
+,   unsigned    asciiPercent
+)
+{
+    std::string const   text    =   make_text(asciiPercent);
+    std::wstring const  wtext   =   stlsoft::m2w_utf8(text).c_str();
+
+    std::cout << std::endl;
+    std::cout << title << ":" << std::endl;
+
+    ss_size_t nc_m2w, nc_m2w_utf8, nc_decoder, nc_w2m, nc_w2m_utf8;
+
+    interval_t const r_m2w = test_([&](){
+
+        return stlsoft::m2w(text).size();
+    }, &nc_m2w);
+
+    interval_t const r_m2w_utf8 = test_([&](){
+
+        return stlsoft::m2w_utf8(text).size();
+    }, &nc_m2w_utf8);
+
+    interval_t const r_decoder = test_([&](){
+
+        stlsoft::utf8_decoder   decoder;
+        std::vector<wchar_t>    dest(stlsoft::utf8_decoder::max_output_length(CHUNK_SIZE));
+        ss_size_t               n = 0;
+
+        for (ss_size_t pos = 0; pos < text.size(); pos += CHUNK_SIZE)
+        {
+            ss_size_t const cch = stlsoft::minimum(CHUNK_SIZE, text.size() - pos);
+
+            n += decoder.decode(text.data() + pos, cch, &dest[0], dest.size());
+        }
+
+        return decoder.finish() ? n : 0;
+    }, &nc_decoder);
+
+    interval_t const r_w2m = test_([&](){
+
+        return stlsoft::w2m(wtext).size();
+    }, &nc_w2m);
+
+    interval_t const r_w2m_utf8 = test_([&](){
+
+        return stlsoft::w2m_utf8(wtext).size();
+    }, &nc_w2m_utf8);
+
+    display_results(std::cout, "m2w", r_m2w, nc_m2w, r_m2w);
+    display_results(std::cout, "m2w_utf8", r_m2w_utf8, nc_m2w_utf8, r_m2w);
+    display_results(std::cout, "utf8_decoder (4KB chunks)", r_decoder, nc_decoder, r_m2w);
+    display_results(std::cout, "w2m", r_w2m, nc_w2m, r_w2m);
+    display_results(std::cout, "w2m_utf8", r_w2m_utf8, nc_w2m_utf8, r_w2m);
+}
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int /* argc */, char* /* argv */[])
+{
+    // pipe to expand: `test.performance.stlsoft.utf8_transcoding | expand -t 8,40,56,72`
+
+    // the CRT-based converters need a UTF-8 locale to be comparable
+    if (NULL == ::setlocale(LC_ALL, "C.UTF-8") &&
+        NULL == ::setlocale(LC_ALL, "en_US.UTF-8"))
+    {
+        std::cerr << "could not select a UTF-8 locale; the CRT-based results will not be comparable" << std::endl;
+    }
+
+    std::cout
+        << '\t'
+        << "test"
+        << '\t'
+        << "total (ns)"
+        << '\t'
+        << "#chars"
+        << '\t'
+        << "%"
+        << std::endl;
+
+    run_tests("100% ASCII", 100);
+    run_tests("90% ASCII", 90);
+    run_tests("10% ASCII", 10);
+
+    return EXIT_SUCCESS;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
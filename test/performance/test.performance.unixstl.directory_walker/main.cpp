@@ -0,0 +1,204 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.performance.unixstl.directory_walker/main.cpp
+ *
+ * Purpose: Perf-test for `unixstl::directory_walker`, comparing it with a
+ *          recursive walk by nested `unixstl::readdir_sequence` instances,
+ *          for 1 to N threads.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * feature control
+ */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* /////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <unixstl/filesystem/directory_walker.hpp>
+
+/* /////////////////////////////////////
+ * general includes
+ */
+
+/* STLSoft header files */
+
+#include <stlsoft/diagnostics/std_chrono_hrc_stopwatch.hpp>
+#include <unixstl/filesystem/readdir_sequence.hpp>
+
+/* Standard header files */
+
+#include <atomic>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * types
+ */
+
+typedef stlsoft::std_chrono_hrc_stopwatch                   stopwatch_t;
+typedef stopwatch_t::interval_type                          interval_t;
+
+using stlsoft::ss_size_t;
+
+typedef unixstl::directory_walker                           walker_t;
+typedef unixstl::readdir_sequence                           readdir_sequence_t;
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * functions
+ */
+
+// counts the entries beneath `directory`, descending directories (but not
+// links to them) with nested sequences
+ss_size_t
+count_nested(
+    std::string const& directory
+)
+{
+    readdir_sequence_t  files(directory, readdir_sequence_t::files);
+    readdir_sequence_t  directories(directory, readdir_sequence_t::directories);
+    ss_size_t           n = 0;
+
+    for (readdir_sequence_t::const_iterator i = files.begin(); files.end() != i; ++i)
+    {
+        ++n;
+    }
+
+    for (readdir_sequence_t::const_iterator i = directories.begin(); directories.end() != i; ++i)
+    {
+        std::string const path = directories.get_directory().c_str() + std::string(*i);
+
+        struct stat st;
+
+        ++n;
+
+        if (0 == ::lstat(path.c_str(), &st) &&
+            S_ISDIR(st.st_mode))
+        {
+            try
+            {
+                n += count_nested(path);
+            }
+            catch (unixstl::readdir_sequence_exception&)
+            {}
+        }
+    }
+
+    return n;
+}
+
+ss_size_t
+count_walker(
+    std::string const&  root
+,   ss_size_t           numThreads
+)
+{
+    walker_t                walker(walker_t::directories | walker_t::files, numThreads);
+    std::atomic<ss_size_t>  n(0);
+
+    walker.walk(root, [&n](unixstl::directory_walker_entry const&) {
+
+        n.fetch_add(1, std::memory_order_relaxed);
+    });
+
+    return n;
+}
+
+void
+report(
+    char const* name
+,   ss_size_t   numThreads
+,   ss_size_t   numEntries
+,   interval_t  interval
+)
+{
+    std::cout
+        << '\t'
+        << name
+        << '\t'
+        << std::setw(8) << std::right << numThreads
+        << '\t'
+        << std::setw(10) << numEntries
+        << '\t'
+        << std::setw(14) << interval
+        << '\t'
+        << std::setw(10) << std::fixed << std::setprecision(3) << (static_cast<double>(interval) / (0 == numEntries ? 1 : numEntries))
+        << std::endl;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char* argv[])
+{
+    // pipe to expand: `test.performance.unixstl.directory_walker [<root>] | expand -t 8,32,48,64,80`
+
+    std::string const   root        =   (argc > 1) ? argv[1] : "/usr/include";
+    ss_size_t           maxThreads  =   std::thread::hardware_concurrency();
+
+    if (maxThreads < 8)
+    {
+        maxThreads = 8;
+    }
+
+    // warm-up, to populate the directory caches
+
+    count_walker(root, 1);
+
+    std::cout << std::endl;
+    std::cout
+        << '\t'
+        << "walk"
+        << '\t'
+        << "# threads"
+        << '\t'
+        << "# entries"
+        << '\t'
+        << "total (ns)"
+        << '\t'
+        << "ns / entry"
+        << std::endl;
+
+    {
+        stopwatch_t sw;
+
+        sw.start();
+        ss_size_t const n = count_nested(root + '/');
+        sw.stop();
+
+        report("readdir_sequence", 1, n, sw.get_nanoseconds());
+    }
+
+    for (ss_size_t numThreads = 1; numThreads <= maxThreads; numThreads *= 2)
+    {
+        stopwatch_t sw;
+
+        sw.start();
+        ss_size_t const n = count_walker(root, numThreads);
+        sw.stop();
+
+        report("directory_walker", numThreads, n, sw.get_nanoseconds());
+    }
+
+    return EXIT_SUCCESS;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,521 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.stlsoft.containers.concurrent_frequency_map/entry.cpp
+ *
+ * Purpose: Unit-tests for `stlsoft::concurrent_frequency_map`.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* ///////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/containers/concurrent_frequency_map.hpp>
+
+
+/* ///////////////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+
+/* Standard C++ header files */
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/* Standard C header files */
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_ctor_default(void);
+    static void test_ctor_num_shards(void);
+    static void test_push(void);
+    static void test_push_n(void);
+    static void test_clear(void);
+    static void test_merge(void);
+    static void test_op_addassign(void);
+    static void test_snapshot(void);
+    static void test_iteration(void);
+    static void test_iteration_outlives_changes(void);
+    static void test_ordered_shards(void);
+    static void test_string_keys(void);
+    static void test_concurrent_push(void);
+    static void test_concurrent_merge(void);
+    static void test_snapshot_is_consistent(void);
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char *argv[])
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.stlsoft.containers.concurrent_frequency_map", verbosity))
+    {
+        XTESTS_RUN_CASE(test_ctor_default);
+        XTESTS_RUN_CASE(test_ctor_num_shards);
+        XTESTS_RUN_CASE(test_push);
+        XTESTS_RUN_CASE(test_push_n);
+        XTESTS_RUN_CASE(test_clear);
+        XTESTS_RUN_CASE(test_merge);
+        XTESTS_RUN_CASE(test_op_addassign);
+        XTESTS_RUN_CASE(test_snapshot);
+        XTESTS_RUN_CASE(test_iteration);
+        XTESTS_RUN_CASE(test_iteration_outlives_changes);
+        XTESTS_RUN_CASE(test_ordered_shards);
+        XTESTS_RUN_CASE(test_string_keys);
+        XTESTS_RUN_CASE(test_concurrent_push);
+        XTESTS_RUN_CASE(test_concurrent_merge);
+        XTESTS_RUN_CASE(test_snapshot_is_consistent);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * utility functions
+ */
+
+namespace
+{
+
+    typedef stlsoft::concurrent_frequency_map<int>          cfm_int_t;
+    typedef stlsoft::frequency_map<int>                     fm_int_t;
+    typedef std::vector<std::pair<int, unsigned long> >     pairs_t;
+
+    template <typename I>
+    pairs_t
+    to_sorted_pairs(
+        I   from
+    ,   I   to
+    )
+    {
+        pairs_t v;
+
+        for (I i = from; to != i; ++i)
+        {
+            v.push_back(std::make_pair((*i).first, static_cast<unsigned long>((*i).second)));
+        }
+
+        std::sort(v.begin(), v.end());
+
+        return v;
+    }
+
+    void
+    run_threads(
+        unsigned                                numThreads
+    ,   std::function<void (unsigned index)>    fn
+    )
+    {
+        std::vector<std::thread> threads;
+
+        for (unsigned t = 0; t != numThreads; ++t)
+        {
+            threads.emplace_back(fn, t);
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+    }
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+static void test_ctor_default()
+{
+    cfm_int_t fm;
+
+    XTESTS_TEST_BOOLEAN_TRUE(fm.empty());
+    XTESTS_TEST_INTEGER_EQUAL(0u, fm.size());
+    XTESTS_TEST_INTEGER_EQUAL(0u, fm.total());
+    XTESTS_TEST_BOOLEAN_TRUE(fm.begin() == fm.end());
+
+    XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(1u, fm.num_shards());
+    XTESTS_TEST_INTEGER_EQUAL(0u, fm.num_shards() & (fm.num_shards() - 1));
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, fm.count(0));
+    XTESTS_TEST_INTEGER_EQUAL(0u, fm[1]);
+    XTESTS_TEST_BOOLEAN_FALSE(fm.contains(0));
+}
+
+static void test_ctor_num_shards()
+{
+    XTESTS_TEST_INTEGER_EQUAL(1u, cfm_int_t(0).num_shards());
+    XTESTS_TEST_INTEGER_EQUAL(1u, cfm_int_t(1).num_shards());
+    XTESTS_TEST_INTEGER_EQUAL(2u, cfm_int_t(2).num_shards());
+    XTESTS_TEST_INTEGER_EQUAL(4u, cfm_int_t(3).num_shards());
+    XTESTS_TEST_INTEGER_EQUAL(64u, cfm_int_t(33).num_shards());
+    XTESTS_TEST_INTEGER_EQUAL(64u, cfm_int_t(64).num_shards());
+
+    // single shard is functional
+
+    cfm_int_t fm(1);
+
+    fm.push(1);
+    fm.push(2);
+    fm.push(1);
+
+    XTESTS_TEST_INTEGER_EQUAL(2u, fm.size());
+    XTESTS_TEST_INTEGER_EQUAL(3u, fm.total());
+    XTESTS_TEST_INTEGER_EQUAL(2u, fm.count(1));
+}
+
+static void test_push()
+{
+    cfm_int_t fm;
+
+    XTESTS_TEST_INTEGER_EQUAL(1u, fm.push(10));
+    XTESTS_TEST_INTEGER_EQUAL(1u, fm.push(20));
+    XTESTS_TEST_INTEGER_EQUAL(2u, fm.push(10));
+    XTESTS_TEST_INTEGER_EQUAL(3u, fm.push(10));
+
+    XTESTS_TEST_BOOLEAN_FALSE(fm.empty());
+    XTESTS_TEST_INTEGER_EQUAL(2u, fm.size());
+    XTESTS_TEST_INTEGER_EQUAL(4u, fm.total());
+
+    XTESTS_TEST_INTEGER_EQUAL(3u, fm.count(10));
+    XTESTS_TEST_INTEGER_EQUAL(1u, fm.count(20));
+    XTESTS_TEST_INTEGER_EQUAL(0u, fm.count(30));
+    XTESTS_TEST_BOOLEAN_TRUE(fm.contains(10));
+    XTESTS_TEST_BOOLEAN_TRUE(fm.contains(20));
+    XTESTS_TEST_BOOLEAN_FALSE(fm.contains(30));
+}
+
+static void test_push_n()
+{
+    cfm_int_t fm;
+
+    fm.push_n(-1, 10);
+    fm.push_n(-2, 20);
+    fm.push_n(-1, 5);
+
+    XTESTS_TEST_INTEGER_EQUAL(2u, fm.size());
+    XTESTS_TEST_INTEGER_EQUAL(35u, fm.total());
+    XTESTS_TEST_INTEGER_EQUAL(15u, fm[-1]);
+    XTESTS_TEST_INTEGER_EQUAL(20u, fm[-2]);
+}
+
+static void test_clear()
+{
+    cfm_int_t fm(8);
+
+    for (int i = 0; i != 1000; ++i)
+    {
+        fm.push(i);
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(1000u, fm.size());
+
+    fm.clear();
+
+    XTESTS_TEST_BOOLEAN_TRUE(fm.empty());
+    XTESTS_TEST_INTEGER_EQUAL(0u, fm.size());
+    XTESTS_TEST_INTEGER_EQUAL(0u, fm.total());
+    XTESTS_TEST_BOOLEAN_TRUE(fm.begin() == fm.end());
+}
+
+static void test_merge()
+{
+    cfm_int_t   fm(16);
+    fm_int_t    rhs;
+
+    fm.push(1);
+    fm.push(2);
+
+    for (int i = 0; i != 100; ++i)
+    {
+        rhs.push_n(i, i + 1);
+    }
+
+    fm.merge(rhs);
+
+    XTESTS_TEST_INTEGER_EQUAL(100u, fm.size());
+    XTESTS_TEST_INTEGER_EQUAL(2u + 5050u, fm.total());
+    XTESTS_TEST_INTEGER_EQUAL(1u, fm[0]);
+    XTESTS_TEST_INTEGER_EQUAL(3u, fm[1]);
+    XTESTS_TEST_INTEGER_EQUAL(4u, fm[2]);
+    XTESTS_TEST_INTEGER_EQUAL(100u, fm[99]);
+
+    fm.merge(fm_int_t());
+
+    XTESTS_TEST_INTEGER_EQUAL(100u, fm.size());
+    XTESTS_TEST_INTEGER_EQUAL(2u + 5050u, fm.total());
+}
+
+static void test_op_addassign()
+{
+    cfm_int_t   fm;
+    fm_int_t    rhs = { 1, 2, 2, 3, 3, 3 };
+
+    fm += rhs;
+    fm += rhs;
+
+    XTESTS_TEST_INTEGER_EQUAL(3u, fm.size());
+    XTESTS_TEST_INTEGER_EQUAL(12u, fm.total());
+    XTESTS_TEST_INTEGER_EQUAL(2u, fm[1]);
+    XTESTS_TEST_INTEGER_EQUAL(4u, fm[2]);
+    XTESTS_TEST_INTEGER_EQUAL(6u, fm[3]);
+}
+
+static void test_snapshot()
+{
+    cfm_int_t   fm(4);
+    fm_int_t    expected;
+
+    for (int i = 0; i != 10000; ++i)
+    {
+        int const key = (i * 7919) % 1009;
+
+        fm.push(key);
+        expected.push(key);
+    }
+
+    fm_int_t const snapshot = fm.snapshot();
+
+    XTESTS_TEST_INTEGER_EQUAL(expected.size(), snapshot.size());
+    XTESTS_TEST_INTEGER_EQUAL(expected.total(), snapshot.total());
+    XTESTS_TEST_BOOLEAN_TRUE(to_sorted_pairs(expected.begin(), expected.end()) == to_sorted_pairs(snapshot.begin(), snapshot.end()));
+}
+
+static void test_iteration()
+{
+    cfm_int_t   fm;
+    fm_int_t    expected = { 5, 4, 4, 3, 3, 3, 2, 1000, -1000 };
+
+    fm.merge(expected);
+
+    XTESTS_TEST_BOOLEAN_TRUE(to_sorted_pairs(expected.begin(), expected.end()) == to_sorted_pairs(fm.begin(), fm.end()));
+
+    size_t n = 0;
+
+    for (auto const& entry : fm)
+    {
+        XTESTS_TEST_INTEGER_EQUAL(expected[entry.first], entry.second);
+
+        ++n;
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(expected.size(), n);
+
+    cfm_int_t::const_iterator it = fm.begin();
+    cfm_int_t::const_iterator it2 = it++;
+
+    XTESTS_TEST_BOOLEAN_TRUE(it != it2);
+    XTESTS_TEST_BOOLEAN_TRUE(++cfm_int_t::const_iterator(it2) == it);
+    XTESTS_TEST_BOOLEAN_TRUE(it->second == (*it).second);
+}
+
+static void test_iteration_outlives_changes()
+{
+    cfm_int_t fm;
+
+    fm.push(1);
+    fm.push(2);
+    fm.push(2);
+
+    cfm_int_t::const_iterator b = fm.begin();
+    cfm_int_t::const_iterator e = fm.end();
+
+    fm.clear();
+    fm.push(3);
+
+    pairs_t const pairs = to_sorted_pairs(b, e);
+
+    XTESTS_TEST_INTEGER_EQUAL(2u, pairs.size());
+    XTESTS_TEST_INTEGER_EQUAL(1, pairs[0].first);
+    XTESTS_TEST_INTEGER_EQUAL(1u, pairs[0].second);
+    XTESTS_TEST_INTEGER_EQUAL(2, pairs[1].first);
+    XTESTS_TEST_INTEGER_EQUAL(2u, pairs[1].second);
+
+    XTESTS_TEST_INTEGER_EQUAL(1, std::distance(fm.begin(), fm.end()));
+}
+
+static void test_ordered_shards()
+{
+    typedef stlsoft::concurrent_frequency_map<
+        int
+    ,   stlsoft::frequency_map_traits_ordered<int>
+    >                                                       cfm_ordered_int_t;
+
+    cfm_ordered_int_t fm(8);
+
+    for (int i = 100; i != 0; --i)
+    {
+        fm.push(i);
+    }
+
+    // the snapshot of ordered shards is itself ordered
+
+    cfm_ordered_int_t::snapshot_type const snapshot = fm.snapshot();
+
+    XTESTS_TEST_INTEGER_EQUAL(100u, snapshot.size());
+    XTESTS_TEST_INTEGER_EQUAL(1, snapshot.begin()->first);
+    XTESTS_TEST_INTEGER_EQUAL(100, snapshot.rbegin()->first);
+}
+
+static void test_string_keys()
+{
+    stlsoft::concurrent_frequency_map<std::string> fm;
+
+    fm.push("abc");
+    fm.push("def");
+    fm.push("abc");
+    fm.push_n("ghi", 10);
+
+    XTESTS_TEST_INTEGER_EQUAL(3u, fm.size());
+    XTESTS_TEST_INTEGER_EQUAL(13u, fm.total());
+    XTESTS_TEST_INTEGER_EQUAL(2u, fm["abc"]);
+    XTESTS_TEST_INTEGER_EQUAL(1u, fm["def"]);
+    XTESTS_TEST_INTEGER_EQUAL(10u, fm["ghi"]);
+    XTESTS_TEST_INTEGER_EQUAL(0u, fm["jkl"]);
+}
+
+static void test_concurrent_push()
+{
+    unsigned const  NUM_THREADS     =   4;
+    int const       NUM_PUSHES      =   100000;
+    int const       NUM_KEYS        =   997;
+
+    cfm_int_t fm;
+
+    run_threads(NUM_THREADS, [&fm](unsigned t) {
+
+        for (int i = 0; i != NUM_PUSHES; ++i)
+        {
+            fm.push(static_cast<int>((i + t * 13) % NUM_KEYS));
+        }
+    });
+
+    fm_int_t expected;
+
+    for (unsigned t = 0; t != NUM_THREADS; ++t)
+    {
+        for (int i = 0; i != NUM_PUSHES; ++i)
+        {
+            expected.push(static_cast<int>((i + t * 13) % NUM_KEYS));
+        }
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(NUM_THREADS * NUM_PUSHES, fm.total());
+    XTESTS_TEST_INTEGER_EQUAL(static_cast<size_t>(NUM_KEYS), fm.size());
+    XTESTS_TEST_BOOLEAN_TRUE(to_sorted_pairs(expected.begin(), expected.end()) == to_sorted_pairs(fm.begin(), fm.end()));
+}
+
+static void test_concurrent_merge()
+{
+    unsigned const NUM_THREADS = 4;
+
+    cfm_int_t fm;
+
+    run_threads(NUM_THREADS, [&fm](unsigned t) {
+
+        fm_int_t local;
+
+        for (int i = 0; i != 10000; ++i)
+        {
+            local.push(i % 101);
+        }
+
+        for (int n = 0; n != 10; ++n)
+        {
+            fm.merge(local);
+            fm.push_n(-1, t + 1);
+        }
+    });
+
+    XTESTS_TEST_INTEGER_EQUAL(102u, fm.size());
+    XTESTS_TEST_INTEGER_EQUAL(NUM_THREADS * 10u * 10000u + 10u * (1 + 2 + 3 + 4), fm.total());
+    XTESTS_TEST_INTEGER_EQUAL(100u, fm[-1]);
+}
+
+static void test_snapshot_is_consistent()
+{
+    // a single writer pushes each key before the next key, and so any
+    // consistent view must have non-increasing counts across the keys
+
+    int const NUM_KEYS = 64;
+
+    cfm_int_t           fm(NUM_KEYS);
+    std::atomic<bool>   done(false);
+    size_t              numInconsistencies = 0;
+    size_t              numSnapshots = 0;
+
+    std::thread writer([&fm, &done]() {
+
+        for (int n = 0; n != 20000; ++n)
+        {
+            for (int k = 0; k != NUM_KEYS; ++k)
+            {
+                fm.push(k);
+            }
+        }
+
+        done = true;
+    });
+
+    for (; !done; ++numSnapshots)
+    {
+        fm_int_t const snapshot = fm.snapshot();
+
+        for (int k = 1; k != NUM_KEYS; ++k)
+        {
+            if (snapshot[k] > snapshot[k - 1])
+            {
+                ++numInconsistencies;
+            }
+        }
+    }
+
+    writer.join();
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, numInconsistencies);
+    XTESTS_TEST_INTEGER_EQUAL(20000u * NUM_KEYS, fm.total());
+}
+
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,406 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.stlsoft.containers.flat_count_table/entry.cpp
+ *
+ * Purpose: Unit-tests for `stlsoft::flat_count_table`.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* ///////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/containers/util/flat_count_table.hpp>
+
+
+/* ///////////////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+
+/* Standard C++ header files */
+#include <algorithm>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+/* Standard C header files */
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_ctor_default(void);
+    static void test_subscript(void);
+    static void test_find(void);
+    static void test_growth(void);
+    static void test_reserve(void);
+    static void test_clear(void);
+    static void test_copy(void);
+    static void test_move(void);
+    static void test_swap(void);
+    static void test_iteration(void);
+    static void test_string_keys(void);
+    static void test_colliding_hashes(void);
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char *argv[])
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.stlsoft.containers.flat_count_table", verbosity))
+    {
+        XTESTS_RUN_CASE(test_ctor_default);
+        XTESTS_RUN_CASE(test_subscript);
+        XTESTS_RUN_CASE(test_find);
+        XTESTS_RUN_CASE(test_growth);
+        XTESTS_RUN_CASE(test_reserve);
+        XTESTS_RUN_CASE(test_clear);
+        XTESTS_RUN_CASE(test_copy);
+        XTESTS_RUN_CASE(test_move);
+        XTESTS_RUN_CASE(test_swap);
+        XTESTS_RUN_CASE(test_iteration);
+        XTESTS_RUN_CASE(test_string_keys);
+        XTESTS_RUN_CASE(test_colliding_hashes);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * utility functions
+ */
+
+namespace
+{
+
+    typedef stlsoft::flat_count_table<int, unsigned>        table_t;
+    typedef std::map<int, unsigned>                         map_t;
+
+    template <typename T_table>
+    std::map<typename T_table::key_type, typename T_table::mapped_type>
+    to_map(
+        T_table const& table
+    )
+    {
+        return std::map<typename T_table::key_type, typename T_table::mapped_type>(table.begin(), table.end());
+    }
+
+    // a hash under which all keys collide
+    struct constant_hash
+    {
+        std::size_t operator ()(int) const
+        {
+            return 12345;
+        }
+    };
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+static void test_ctor_default()
+{
+    table_t const table;
+
+    XTESTS_TEST_BOOLEAN_TRUE(table.empty());
+    XTESTS_TEST_INTEGER_EQUAL(0u, table.size());
+    XTESTS_TEST_INTEGER_EQUAL(0u, table.capacity());
+    XTESTS_TEST_BOOLEAN_TRUE(table.begin() == table.end());
+    XTESTS_TEST_BOOLEAN_TRUE(table.end() == table.find(0));
+    XTESTS_TEST_INTEGER_EQUAL(0u, table.count(0));
+}
+
+static void test_subscript()
+{
+    table_t table;
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, table[10]);
+    XTESTS_TEST_INTEGER_EQUAL(1u, table.size());
+
+    ++table[10];
+    ++table[10];
+    table[20] += 5;
+
+    XTESTS_TEST_INTEGER_EQUAL(2u, table.size());
+    XTESTS_TEST_INTEGER_EQUAL(2u, table[10]);
+    XTESTS_TEST_INTEGER_EQUAL(5u, table[20]);
+    XTESTS_TEST_INTEGER_EQUAL(16u, table.capacity());
+}
+
+static void test_find()
+{
+    table_t table;
+
+    table[1] = 11;
+    table[2] = 22;
+
+    table_t::const_iterator it = table.find(2);
+
+    XTESTS_REQUIRE(XTESTS_TEST_BOOLEAN_TRUE(table.end() != it));
+    XTESTS_TEST_INTEGER_EQUAL(2, it->first);
+    XTESTS_TEST_INTEGER_EQUAL(22u, it->second);
+    XTESTS_TEST_BOOLEAN_TRUE(table.end() == table.find(3));
+    XTESTS_TEST_INTEGER_EQUAL(1u, table.count(1));
+    XTESTS_TEST_INTEGER_EQUAL(0u, table.count(3));
+}
+
+static void test_growth()
+{
+    table_t table;
+    map_t   expected;
+
+    for (int i = 0; i != 50000; ++i)
+    {
+        int const key = (i * 7919) % 20011;
+
+        ++table[key];
+        ++expected[key];
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(expected.size(), table.size());
+    XTESTS_TEST_INTEGER_LESS_OR_EQUAL(table.capacity() - table.capacity() / 8, table.size());
+    XTESTS_TEST_INTEGER_EQUAL(0u, table.capacity() & (table.capacity() - 1));
+    XTESTS_TEST_BOOLEAN_TRUE(expected == to_map(table));
+}
+
+static void test_reserve()
+{
+    table_t table;
+
+    table.reserve(1000);
+
+    size_t const capacity = table.capacity();
+
+    XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(1000u, capacity - capacity / 8);
+
+    for (int i = 0; i != 1000; ++i)
+    {
+        ++table[i];
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(capacity, table.capacity());
+    XTESTS_TEST_INTEGER_EQUAL(1000u, table.size());
+
+    table.reserve(10);
+
+    XTESTS_TEST_INTEGER_EQUAL(capacity, table.capacity());
+}
+
+static void test_clear()
+{
+    table_t table;
+
+    for (int i = 0; i != 100; ++i)
+    {
+        ++table[i];
+    }
+
+    size_t const capacity = table.capacity();
+
+    table.clear();
+
+    XTESTS_TEST_BOOLEAN_TRUE(table.empty());
+    XTESTS_TEST_INTEGER_EQUAL(capacity, table.capacity());
+    XTESTS_TEST_BOOLEAN_TRUE(table.begin() == table.end());
+    XTESTS_TEST_BOOLEAN_TRUE(table.end() == table.find(50));
+
+    ++table[50];
+
+    XTESTS_TEST_INTEGER_EQUAL(1u, table.size());
+    XTESTS_TEST_INTEGER_EQUAL(1u, table[50]);
+}
+
+static void test_copy()
+{
+    table_t table;
+
+    for (int i = 0; i != 100; ++i)
+    {
+        table[i] = static_cast<unsigned>(i * 2);
+    }
+
+    table_t copy(table);
+
+    XTESTS_TEST_BOOLEAN_TRUE(to_map(table) == to_map(copy));
+
+    ++copy[0];
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, table[0]);
+    XTESTS_TEST_INTEGER_EQUAL(1u, copy[0]);
+
+    table_t assigned;
+
+    assigned[-1] = 1;
+    assigned = table;
+
+    XTESTS_TEST_BOOLEAN_TRUE(to_map(table) == to_map(assigned));
+    XTESTS_TEST_INTEGER_EQUAL(0u, assigned.count(-1));
+
+    table_t const empty_copy((table_t()));
+
+    XTESTS_TEST_BOOLEAN_TRUE(empty_copy.empty());
+}
+
+static void test_move()
+{
+    table_t table;
+
+    table[1] = 1;
+    table[2] = 2;
+
+    table_t moved(std::move(table));
+
+    XTESTS_TEST_INTEGER_EQUAL(2u, moved.size());
+    XTESTS_TEST_INTEGER_EQUAL(2u, moved[2]);
+    XTESTS_TEST_BOOLEAN_TRUE(table.empty());
+    XTESTS_TEST_INTEGER_EQUAL(0u, table.capacity());
+
+    table_t assigned;
+
+    assigned = std::move(moved);
+
+    XTESTS_TEST_INTEGER_EQUAL(2u, assigned.size());
+    XTESTS_TEST_INTEGER_EQUAL(1u, assigned[1]);
+}
+
+static void test_swap()
+{
+    table_t t1;
+    table_t t2;
+
+    t1[1] = 1;
+    t2[2] = 2;
+    t2[3] = 3;
+
+    std::swap(t1, t2);
+
+    XTESTS_TEST_INTEGER_EQUAL(2u, t1.size());
+    XTESTS_TEST_INTEGER_EQUAL(1u, t2.size());
+    XTESTS_TEST_INTEGER_EQUAL(3u, t1[3]);
+    XTESTS_TEST_INTEGER_EQUAL(1u, t2[1]);
+
+    swap(t1, t2);
+
+    XTESTS_TEST_INTEGER_EQUAL(1u, t1.size());
+    XTESTS_TEST_INTEGER_EQUAL(2u, t2.size());
+}
+
+static void test_iteration()
+{
+    table_t table;
+
+    for (int i = 0; i != 1000; ++i)
+    {
+        table[i * 3] = 1;
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(1000, std::distance(table.begin(), table.end()));
+
+    table_t::const_iterator it = table.begin();
+    table_t::const_iterator it2 = it++;
+
+    XTESTS_TEST_BOOLEAN_TRUE(it != it2);
+    XTESTS_TEST_BOOLEAN_TRUE(++it2 == it);
+    XTESTS_TEST_BOOLEAN_TRUE(table.cend() == table.end());
+}
+
+static void test_string_keys()
+{
+    typedef stlsoft::flat_count_table<std::string, unsigned long> string_table_t;
+
+    string_table_t  table;
+    std::string     key;
+
+    for (int i = 0; i != 5000; ++i)
+    {
+        key.assign(1 + i % 37, static_cast<char>('a' + i % 26));
+
+        ++table[key];
+    }
+
+    unsigned long total = 0;
+
+    for (string_table_t::const_iterator i = table.begin(); table.end() != i; ++i)
+    {
+        total += i->second;
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(5000u, total);
+
+    string_table_t copy(table);
+
+    table.clear();
+
+    XTESTS_TEST_BOOLEAN_TRUE(table.empty());
+    XTESTS_TEST_INTEGER_EQUAL(copy.size(), to_map(copy).size());
+
+    // "a" is produced when i is a multiple of both 37 and 26
+
+    XTESTS_TEST_INTEGER_EQUAL(6u, copy["a"]);
+}
+
+static void test_colliding_hashes()
+{
+    // with every key sharing a hash (and a tag), lookups must probe across
+    // groups, and wrap around the end of the table
+
+    typedef stlsoft::flat_count_table<int, unsigned, constant_hash> colliding_table_t;
+
+    colliding_table_t   table;
+    map_t               expected;
+
+    for (int i = 0; i != 300; ++i)
+    {
+        int const key = i % 100;
+
+        ++table[key];
+        ++expected[key];
+
+        XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(expected.size(), table.size()));
+    }
+
+    XTESTS_TEST_BOOLEAN_TRUE(expected == to_map(table));
+    XTESTS_TEST_BOOLEAN_TRUE(table.end() == table.find(100));
+}
+
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
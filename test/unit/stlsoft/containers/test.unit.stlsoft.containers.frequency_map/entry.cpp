@@ -70,6 +70,10 @@ namespace
     static void test_swap(void);
     static void test_swap_std(void);
     static void test_iteration_order_1(void);
+#if __cplusplus >= 201103L
+
+    static void test_flat_traits(void);
+#endif
 
 } // anonymous namespace
 
@@ -106,6 +110,10 @@ int main(int argc, char *argv[])
         XTESTS_RUN_CASE(test_swap);
         XTESTS_RUN_CASE(test_swap_std);
         XTESTS_RUN_CASE(test_iteration_order_1);
+#if __cplusplus >= 201103L
+
+        XTESTS_RUN_CASE(test_flat_traits);
+#endif
 
         XTESTS_PRINT_RESULTS();
 
@@ -161,6 +169,11 @@ namespace
         int
     ,   stlsoft::frequency_map_traits_unordered<int>
     >                                                       fm_unordered_int_t;
+
+    typedef stlsoft::frequency_map<
+        int
+    ,   stlsoft::frequency_map_traits_flat<int>
+    >                                                       fm_flat_int_t;
 #endif /* C++ */
     typedef std::pair<
         int
@@ -1906,6 +1919,96 @@ static void test_iteration_order_1()
 #endif
 }
 
+#if __cplusplus >= 201103L
+
+static void test_flat_traits()
+{
+    {
+        fm_flat_int_t fm;
+
+        XTESTS_TEST_BOOLEAN_TRUE(fm.empty());
+        XTESTS_TEST_INTEGER_EQUAL(0u, fm.size());
+        XTESTS_TEST_INTEGER_EQUAL(0u, fm.total());
+        XTESTS_TEST_INTEGER_EQUAL(0u, fm.count(0));
+        XTESTS_TEST(fm.end() == fm.begin());
+        XTESTS_TEST(fm.end() == fm.find(0));
+    }
+
+    {
+        fm_flat_int_t fm = { 1, 2, 3, 4, 5, 4, 3, 2, 1 };
+
+        pairs_t const actual(fm.begin(), fm.end());
+        pairs_t const actual_ordered = to_ordered(actual, compare_value_type());
+        pairs_t const expected = { { 1, 2 }, { 2, 2 }, { 3, 2 }, { 4, 2 }, { 5, 1 }};
+
+        XTESTS_TEST(expected == actual_ordered);
+        XTESTS_TEST_INTEGER_EQUAL(5u, fm.size());
+        XTESTS_TEST_INTEGER_EQUAL(9u, fm.total());
+        XTESTS_TEST_BOOLEAN_TRUE(fm.contains(5));
+        XTESTS_TEST_BOOLEAN_FALSE(fm.contains(6));
+        XTESTS_TEST_INTEGER_EQUAL(1u, fm.find(5)->second);
+    }
+
+    {
+        fm_flat_int_t fm1 = { { 1, 10 }, { 2, 20 } };
+        fm_flat_int_t fm2 = { 2, 3, 3 };
+
+        fm_flat_int_t const fm3 = fm1 + fm2;
+
+        XTESTS_TEST_INTEGER_EQUAL(3u, fm3.size());
+        XTESTS_TEST_INTEGER_EQUAL(33u, fm3.total());
+        XTESTS_TEST_INTEGER_EQUAL(10u, fm3[1]);
+        XTESTS_TEST_INTEGER_EQUAL(21u, fm3[2]);
+        XTESTS_TEST_INTEGER_EQUAL(2u, fm3[3]);
+
+        std::swap(fm1, fm2);
+
+        XTESTS_TEST_INTEGER_EQUAL(3u, fm1.total());
+        XTESTS_TEST_INTEGER_EQUAL(30u, fm2.total());
+
+        fm1.clear();
+
+        XTESTS_TEST_BOOLEAN_TRUE(fm1.empty());
+        XTESTS_TEST_INTEGER_EQUAL(0u, fm1.count(3));
+    }
+
+    // many keys, compared with unordered
+
+    {
+        fm_flat_int_t       fmf;
+        fm_unordered_int_t  fmu;
+        size_t              numMismatches = 0;
+
+        for (int i = 0; i != 100000; ++i)
+        {
+            int const key = (i * 7919) % 30011 - 15000;
+
+            if (fmu.push(key) != fmf.push(key))
+            {
+                ++numMismatches;
+            }
+        }
+
+        XTESTS_TEST_INTEGER_EQUAL(0u, numMismatches);
+        XTESTS_TEST_INTEGER_EQUAL(fmu.size(), fmf.size());
+        XTESTS_TEST_INTEGER_EQUAL(fmu.total(), fmf.total());
+        XTESTS_TEST(fm_to_list(fmu) == fm_to_list(fmf));
+    }
+
+    {
+        stlsoft::frequency_map<
+            std::string
+        ,   stlsoft::frequency_map_traits_flat<std::string>
+        > fm = { "abc", "def", "abc" };
+
+        XTESTS_TEST_INTEGER_EQUAL(2u, fm.size());
+        XTESTS_TEST_INTEGER_EQUAL(2u, fm["abc"]);
+        XTESTS_TEST_INTEGER_EQUAL(1u, fm["def"]);
+        XTESTS_TEST_INTEGER_EQUAL(0u, fm["ghi"]);
+    }
+}
+#endif
+
 } // anonymous namespace
 
 
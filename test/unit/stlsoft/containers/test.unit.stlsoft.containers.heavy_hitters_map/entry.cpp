@@ -0,0 +1,491 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.stlsoft.containers.heavy_hitters_map/entry.cpp
+ *
+ * Purpose: Unit-tests for `stlsoft::heavy_hitters_map`.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* ///////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/containers/heavy_hitters_map.hpp>
+
+
+/* ///////////////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/containers/frequency_map.hpp>
+#include <stlsoft/stlsoft.h>
+
+/* Standard C++ header files */
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/* Standard C header files */
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_ctor(void);
+    static void test_exact_within_capacity(void);
+    static void test_eviction(void);
+    static void test_push_n(void);
+    static void test_error_bounds(void);
+    static void test_top(void);
+    static void test_find(void);
+    static void test_clear(void);
+    static void test_copy_and_swap(void);
+    static void test_string_keys(void);
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+    static void test_eviction_strong_guarantee(void);
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char *argv[])
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.stlsoft.containers.heavy_hitters_map", verbosity))
+    {
+        XTESTS_RUN_CASE(test_ctor);
+        XTESTS_RUN_CASE(test_exact_within_capacity);
+        XTESTS_RUN_CASE(test_eviction);
+        XTESTS_RUN_CASE(test_push_n);
+        XTESTS_RUN_CASE(test_error_bounds);
+        XTESTS_RUN_CASE(test_top);
+        XTESTS_RUN_CASE(test_find);
+        XTESTS_RUN_CASE(test_clear);
+        XTESTS_RUN_CASE(test_copy_and_swap);
+        XTESTS_RUN_CASE(test_string_keys);
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+        XTESTS_RUN_CASE(test_eviction_strong_guarantee);
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * utility functions
+ */
+
+namespace
+{
+
+    typedef stlsoft::heavy_hitters_map<int>                 hhm_int_t;
+    typedef stlsoft::frequency_map<int>                     fm_int_t;
+
+    // a Zipf-like key: key k occurs roughly in proportion to 1/(k + 1)
+    int
+    skewed_key(
+        int i
+    )
+    {
+        unsigned const  r       =   static_cast<unsigned>(i) * 2654435761u;
+        unsigned const  range   =   1u << 16;
+
+        return static_cast<int>(range / (1 + (r >> 16) % range)) - 1;
+    }
+
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+
+    // the number of copies of a throwing_key that may be made before one
+    // throws; negative for no limit
+    int s_copiesBeforeThrow = -1;
+
+    // a key whose copy construction and copy assignment can be made to
+    // throw, as might those of a key that allocates
+    struct throwing_key
+    {
+        int value;
+
+        explicit
+        throwing_key(int v)
+            : value(v)
+        {}
+        throwing_key(throwing_key const& rhs)
+            : value(rhs.value)
+        {
+            count_copy_();
+        }
+        throwing_key& operator =(throwing_key const& rhs)
+        {
+            count_copy_();
+
+            value = rhs.value;
+
+            return *this;
+        }
+
+        static void count_copy_()
+        {
+            if (0 == s_copiesBeforeThrow)
+            {
+                throw std::runtime_error("copy failed");
+            }
+
+            if (s_copiesBeforeThrow > 0)
+            {
+                --s_copiesBeforeThrow;
+            }
+        }
+    };
+
+    bool operator ==(throwing_key const& lhs, throwing_key const& rhs)
+    {
+        return lhs.value == rhs.value;
+    }
+
+    struct throwing_key_hash
+    {
+        size_t operator ()(throwing_key const& key) const
+        {
+            return static_cast<size_t>(key.value);
+        }
+    };
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+static void test_ctor()
+{
+    hhm_int_t const hhm(10);
+
+    XTESTS_TEST_BOOLEAN_TRUE(hhm.empty());
+    XTESTS_TEST_INTEGER_EQUAL(0u, hhm.size());
+    XTESTS_TEST_INTEGER_EQUAL(10u, hhm.capacity());
+    XTESTS_TEST_INTEGER_EQUAL(0u, hhm.total());
+    XTESTS_TEST_INTEGER_EQUAL(0u, hhm.error_bound());
+    XTESTS_TEST_BOOLEAN_TRUE(hhm.begin() == hhm.end());
+    XTESTS_TEST_BOOLEAN_FALSE(hhm.contains(0));
+    XTESTS_TEST_INTEGER_EQUAL(0u, hhm.count(0));
+    XTESTS_TEST_BOOLEAN_TRUE(hhm.top(5).empty());
+}
+
+static void test_exact_within_capacity()
+{
+    hhm_int_t   hhm(100);
+    fm_int_t    fm;
+
+    for (int i = 0; i != 10000; ++i)
+    {
+        int const key = (i * 37) % 100;
+
+        XTESTS_TEST_INTEGER_EQUAL(fm.push(key), hhm.push(key));
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(fm.size(), hhm.size());
+    XTESTS_TEST_INTEGER_EQUAL(fm.total(), hhm.total());
+    XTESTS_TEST_INTEGER_EQUAL(0u, hhm.error_bound());
+
+    for (hhm_int_t::const_iterator i = hhm.begin(); hhm.end() != i; ++i)
+    {
+        XTESTS_TEST_INTEGER_EQUAL(fm[i->first], i->second);
+        XTESTS_TEST_INTEGER_EQUAL(0u, i->error);
+    }
+}
+
+static void test_eviction()
+{
+    hhm_int_t hhm(2);
+
+    hhm.push(1);
+    hhm.push(1);
+    hhm.push(1);
+    hhm.push(2);
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, hhm.error_bound());
+
+    // 3 replaces 2, which has the smallest count, and inherits its count
+
+    XTESTS_TEST_INTEGER_EQUAL(2u, hhm.push(3));
+
+    XTESTS_TEST_INTEGER_EQUAL(2u, hhm.size());
+    XTESTS_TEST_INTEGER_EQUAL(5u, hhm.total());
+    XTESTS_TEST_BOOLEAN_FALSE(hhm.contains(2));
+    XTESTS_TEST_INTEGER_EQUAL(3u, hhm[1]);
+    XTESTS_TEST_INTEGER_EQUAL(2u, hhm[3]);
+    XTESTS_TEST_INTEGER_EQUAL(1u, hhm.find(3)->error);
+    XTESTS_TEST_INTEGER_EQUAL(1u, hhm.find(3)->guaranteed());
+    XTESTS_TEST_INTEGER_EQUAL(2u, hhm.error_bound());
+
+    // 2 then replaces 3
+
+    XTESTS_TEST_INTEGER_EQUAL(3u, hhm.push(2));
+    XTESTS_TEST_BOOLEAN_FALSE(hhm.contains(3));
+    XTESTS_TEST_INTEGER_EQUAL(2u, hhm.find(2)->error);
+}
+
+static void test_push_n()
+{
+    hhm_int_t hhm(2);
+
+    hhm.push_n(1, 10);
+    hhm.push_n(2, 5);
+    hhm.push_n(3, 0);
+
+    XTESTS_TEST_INTEGER_EQUAL(2u, hhm.size());
+    XTESTS_TEST_INTEGER_EQUAL(15u, hhm.total());
+    XTESTS_TEST_BOOLEAN_FALSE(hhm.contains(3));
+
+    hhm.push_n(3, 20);
+
+    XTESTS_TEST_INTEGER_EQUAL(35u, hhm.total());
+    XTESTS_TEST_INTEGER_EQUAL(25u, hhm[3]);
+    XTESTS_TEST_INTEGER_EQUAL(5u, hhm.find(3)->error);
+    XTESTS_TEST_INTEGER_EQUAL(10u, hhm.error_bound());
+}
+
+static void test_error_bounds()
+{
+    size_t const    capacity    =   64;
+    hhm_int_t       hhm(capacity);
+    fm_int_t        fm;
+
+    for (int i = 0; i != 200000; ++i)
+    {
+        int const key = skewed_key(i);
+
+        hhm.push(key);
+        fm.push(key);
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(capacity, hhm.size());
+    XTESTS_TEST_INTEGER_EQUAL(fm.total(), hhm.total());
+    XTESTS_TEST_INTEGER_LESS_OR_EQUAL(hhm.total() / capacity, hhm.error_bound());
+
+    fm_int_t::count_type sum = 0;
+
+    for (hhm_int_t::const_iterator i = hhm.begin(); hhm.end() != i; ++i)
+    {
+        fm_int_t::count_type const actual = fm[i->first];
+
+        sum += i->second;
+
+        XTESTS_TEST_INTEGER_LESS_OR_EQUAL(i->second, actual);
+        XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(i->guaranteed(), actual);
+        XTESTS_TEST_INTEGER_LESS_OR_EQUAL(hhm.error_bound(), i->error);
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(hhm.total(), sum);
+
+    for (fm_int_t::const_iterator i = fm.begin(); fm.end() != i; ++i)
+    {
+        if (i->second > hhm.error_bound())
+        {
+            XTESTS_TEST_BOOLEAN_TRUE(hhm.contains(i->first));
+        }
+    }
+
+    // the most frequent keys of a skewed stream are reported exactly enough
+    // to be ranked correctly
+
+    std::vector<hhm_int_t::value_type> const top = hhm.top(3);
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(3u, top.size()));
+    XTESTS_TEST_INTEGER_EQUAL(0, top[0].first);
+    XTESTS_TEST_INTEGER_EQUAL(1, top[1].first);
+    XTESTS_TEST_INTEGER_EQUAL(2, top[2].first);
+}
+
+static void test_top()
+{
+    hhm_int_t hhm(10);
+
+    for (int k = 1; k <= 5; ++k)
+    {
+        hhm.push_n(k, static_cast<hhm_int_t::count_type>(k * 10));
+    }
+
+    std::vector<hhm_int_t::value_type> const top3 = hhm.top(3);
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(3u, top3.size()));
+    XTESTS_TEST_INTEGER_EQUAL(5, top3[0].first);
+    XTESTS_TEST_INTEGER_EQUAL(50u, top3[0].second);
+    XTESTS_TEST_INTEGER_EQUAL(4, top3[1].first);
+    XTESTS_TEST_INTEGER_EQUAL(3, top3[2].first);
+
+    XTESTS_TEST_INTEGER_EQUAL(5u, hhm.top(100).size());
+    XTESTS_TEST_BOOLEAN_TRUE(hhm.top(0).empty());
+}
+
+static void test_find()
+{
+    hhm_int_t hhm(4);
+
+    hhm.push(7);
+    hhm.push(7);
+
+    hhm_int_t::const_iterator it = hhm.find(7);
+
+    XTESTS_REQUIRE(XTESTS_TEST_BOOLEAN_TRUE(hhm.end() != it));
+    XTESTS_TEST_INTEGER_EQUAL(7, it->first);
+    XTESTS_TEST_INTEGER_EQUAL(2u, it->second);
+    XTESTS_TEST_INTEGER_EQUAL(0u, it->error);
+    XTESTS_TEST_BOOLEAN_TRUE(hhm.end() == hhm.find(8));
+}
+
+static void test_clear()
+{
+    hhm_int_t hhm(3);
+
+    for (int i = 0; i != 100; ++i)
+    {
+        hhm.push(i);
+    }
+
+    hhm.clear();
+
+    XTESTS_TEST_BOOLEAN_TRUE(hhm.empty());
+    XTESTS_TEST_INTEGER_EQUAL(0u, hhm.total());
+    XTESTS_TEST_INTEGER_EQUAL(0u, hhm.error_bound());
+    XTESTS_TEST_INTEGER_EQUAL(3u, hhm.capacity());
+
+    XTESTS_TEST_INTEGER_EQUAL(1u, hhm.push(99));
+    XTESTS_TEST_INTEGER_EQUAL(0u, hhm.find(99)->error);
+}
+
+static void test_copy_and_swap()
+{
+    hhm_int_t hhm1(2);
+    hhm_int_t hhm2(5);
+
+    hhm1.push(1);
+    hhm1.push(2);
+    hhm1.push(3);
+
+    hhm_int_t copy(hhm1);
+
+    copy.push(4);
+
+    XTESTS_TEST_INTEGER_EQUAL(3u, hhm1.total());
+    XTESTS_TEST_INTEGER_EQUAL(4u, copy.total());
+
+    swap(hhm1, hhm2);
+
+    XTESTS_TEST_BOOLEAN_TRUE(hhm1.empty());
+    XTESTS_TEST_INTEGER_EQUAL(5u, hhm1.capacity());
+    XTESTS_TEST_INTEGER_EQUAL(3u, hhm2.total());
+    XTESTS_TEST_INTEGER_EQUAL(2u, hhm2.capacity());
+
+    hhm2.push(5);
+
+    XTESTS_TEST_INTEGER_EQUAL(2u, hhm2.size());
+}
+
+static void test_string_keys()
+{
+    stlsoft::heavy_hitters_map<std::string> hhm(2);
+
+    hhm.push("/index.html");
+    hhm.push("/index.html");
+    hhm.push("/about.html");
+    hhm.push("/favicon.ico");
+
+    XTESTS_TEST_INTEGER_EQUAL(2u, hhm.size());
+    XTESTS_TEST_INTEGER_EQUAL(2u, hhm["/index.html"]);
+    XTESTS_TEST_INTEGER_EQUAL(2u, hhm["/favicon.ico"]);
+    XTESTS_TEST_BOOLEAN_FALSE(hhm.contains("/about.html"));
+}
+
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+
+static void test_eviction_strong_guarantee()
+{
+    typedef stlsoft::heavy_hitters_map<
+        throwing_key
+    ,   unsigned
+    ,   throwing_key_hash
+    >                                                       hhm_t;
+
+    // fail each copy made by an evicting push in turn, until one succeeds
+
+    for (int n = 0; ; ++n)
+    {
+        hhm_t hhm(2);
+
+        hhm.push(throwing_key(1));
+        hhm.push(throwing_key(1));
+        hhm.push(throwing_key(2));
+
+        s_copiesBeforeThrow = n;
+
+        try
+        {
+            hhm.push(throwing_key(3));
+
+            s_copiesBeforeThrow = -1;
+
+            XTESTS_TEST_INTEGER_EQUAL(2u, hhm.size());
+            XTESTS_TEST_INTEGER_EQUAL(4u, hhm.total());
+            XTESTS_TEST_BOOLEAN_FALSE(hhm.contains(throwing_key(2)));
+            XTESTS_TEST_INTEGER_EQUAL(2u, hhm[throwing_key(3)]);
+
+            break;
+        }
+        catch (std::runtime_error&)
+        {
+            s_copiesBeforeThrow = -1;
+
+            // unchanged, and still usable
+
+            XTESTS_TEST_INTEGER_EQUAL(2u, hhm.size());
+            XTESTS_TEST_INTEGER_EQUAL(3u, hhm.total());
+            XTESTS_TEST_INTEGER_EQUAL(2u, hhm[throwing_key(1)]);
+            XTESTS_TEST_INTEGER_EQUAL(1u, hhm[throwing_key(2)]);
+            XTESTS_TEST_BOOLEAN_FALSE(hhm.contains(throwing_key(3)));
+
+            hhm.push(throwing_key(2));
+            hhm.push(throwing_key(2));
+
+            XTESTS_TEST_INTEGER_EQUAL(3u, hhm[throwing_key(2)]);
+        }
+    }
+}
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
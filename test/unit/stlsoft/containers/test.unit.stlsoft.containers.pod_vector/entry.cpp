@@ -4,7 +4,7 @@
  * Purpose: Unit-tests for `stlsoft::pod_vector`
  *
  * Created: 1st December 2008
- * Updated: 17th December 2024
+ * Updated: 16th October 2026
  *
  * ////////////////////////////////////////////////////////////////////// */
 
@@ -29,6 +29,7 @@
 #include <platformstl/performance/performance_counter.hpp>
 
 /* Standard C++ header files */
+#include <algorithm>
 #include <numeric>
 #include <stdexcept>
 #include <string>
@@ -66,6 +67,13 @@ namespace
     static void test_subscript_operator(void);
     static void test_swap(void);
 
+    static void test_shrink_to_fit(void);
+    static void test_resize_retains_capacity(void);
+    static void test_growth_policy_linear(void);
+    static void test_growth_policy_geometric(void);
+    static void test_growth_policy_exact(void);
+    static void test_growth_policy_push_back(void);
+
 } // anonymous namespace
 
 
@@ -103,6 +111,13 @@ int main(int argc, char *argv[])
         XTESTS_RUN_CASE(test_subscript_operator);
         XTESTS_RUN_CASE(test_swap);
 
+        XTESTS_RUN_CASE(test_shrink_to_fit);
+        XTESTS_RUN_CASE(test_resize_retains_capacity);
+        XTESTS_RUN_CASE(test_growth_policy_linear);
+        XTESTS_RUN_CASE(test_growth_policy_geometric);
+        XTESTS_RUN_CASE(test_growth_policy_exact);
+        XTESTS_RUN_CASE(test_growth_policy_push_back);
+
         XTESTS_PRINT_RESULTS();
 
         XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
@@ -595,6 +610,145 @@ static void test_swap()
     XTESTS_TEST_INTEGER_EQUAL(-10, std::accumulate(v2.begin(), v2.end(), 0));
 }
 
+static void test_shrink_to_fit()
+{
+    int_vector_t v;
+
+    for (int i = 0; i != 1000; ++i)
+    {
+        v.push_back(i);
+    }
+
+    v.erase(v.begin() + 100, v.end());
+
+    XTESTS_TEST_INTEGER_EQUAL(100u, v.size());
+    XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(1000u, v.capacity());
+
+    v.shrink_to_fit();
+
+    XTESTS_TEST_INTEGER_EQUAL(100u, v.size());
+    XTESTS_TEST_INTEGER_EQUAL(100u, v.capacity());
+    XTESTS_TEST_INTEGER_EQUAL(4950, std::accumulate(v.begin(), v.end(), 0));
+
+    // into the internal buffer
+
+    v.resize(10);
+    v.shrink_to_fit();
+
+    XTESTS_TEST_INTEGER_EQUAL(10u, v.size());
+    XTESTS_TEST_INTEGER_EQUAL(45, std::accumulate(v.begin(), v.end(), 0));
+
+    v.clear();
+    v.shrink_to_fit();
+
+    XTESTS_TEST_BOOLEAN_TRUE(v.empty());
+}
+
+static void test_resize_retains_capacity()
+{
+    int_vector_t v(1000, 1);
+
+    int_vector_t::size_type const capacity = v.capacity();
+
+    v.resize(10);
+
+    XTESTS_TEST_INTEGER_EQUAL(10u, v.size());
+    XTESTS_TEST_INTEGER_EQUAL(capacity, v.capacity());
+    XTESTS_TEST_INTEGER_EQUAL(10, std::accumulate(v.begin(), v.end(), 0));
+
+    v.resize(20, 2);
+
+    XTESTS_TEST_INTEGER_EQUAL(20u, v.size());
+    XTESTS_TEST_INTEGER_EQUAL(capacity, v.capacity());
+    XTESTS_TEST_INTEGER_EQUAL(30, std::accumulate(v.begin(), v.end(), 0));
+}
+
+static void test_growth_policy_linear()
+{
+    typedef stlsoft::pod_vector_linear_growth_policy    policy_t;
+
+    XTESTS_TEST_INTEGER_EQUAL(128u, policy_t::new_capacity(64, 65, 64));
+    XTESTS_TEST_INTEGER_EQUAL(192u, policy_t::new_capacity(128, 129, 64));
+    XTESTS_TEST_INTEGER_EQUAL(1024u, policy_t::new_capacity(128, 1000, 64));
+}
+
+static void test_growth_policy_geometric()
+{
+    typedef stlsoft::pod_vector_geometric_growth_policy<>       policy_t;
+    typedef stlsoft::pod_vector_geometric_growth_policy<2, 1>   doubling_policy_t;
+
+    XTESTS_TEST_INTEGER_EQUAL(96u, policy_t::new_capacity(64, 65, 64));
+    XTESTS_TEST_INTEGER_EQUAL(1500u, policy_t::new_capacity(1000, 1001, 64));
+    XTESTS_TEST_INTEGER_EQUAL(5000u, policy_t::new_capacity(1000, 5000, 64));
+    XTESTS_TEST_INTEGER_EQUAL(96u, policy_t::new_capacity(10, 11, 64));
+
+    XTESTS_TEST_INTEGER_EQUAL(128u, doubling_policy_t::new_capacity(64, 65, 64));
+    XTESTS_TEST_INTEGER_EQUAL(2000u, doubling_policy_t::new_capacity(1000, 1001, 64));
+
+    // overflow
+
+    XTESTS_TEST_INTEGER_EQUAL(~stlsoft::ss_size_t(0), doubling_policy_t::new_capacity(~stlsoft::ss_size_t(0) - 1, ~stlsoft::ss_size_t(0), 64));
+}
+
+static void test_growth_policy_exact()
+{
+    typedef stlsoft::pod_vector_exact_growth_policy     policy_t;
+
+    XTESTS_TEST_INTEGER_EQUAL(65u, policy_t::new_capacity(64, 65, 64));
+
+    stlsoft::pod_vector<int, std::allocator<int>, 16, policy_t> v;
+
+    for (int i = 0; i != 100; ++i)
+    {
+        v.push_back(i);
+
+        if (v.size() > 16)
+        {
+            XTESTS_TEST_INTEGER_EQUAL(v.size(), v.capacity());
+        }
+    }
+}
+
+static void test_growth_policy_push_back()
+{
+    typedef stlsoft::pod_vector<
+        int
+    ,   std::allocator<int>
+    ,   16
+    ,   stlsoft::pod_vector_linear_growth_policy
+    >                                                       linear_vector_t;
+    typedef stlsoft::pod_vector<
+        int
+    ,   std::allocator<int>
+    ,   16
+    ,   stlsoft::pod_vector_geometric_growth_policy<>
+    >                                                       geometric_vector_t;
+
+    linear_vector_t     lv;
+    geometric_vector_t  gv;
+    int                 numLinearReallocations      =   0;
+    int                 numGeometricReallocations   =   0;
+
+    for (int i = 0; i != 100000; ++i)
+    {
+        linear_vector_t::size_type const    lc  =   lv.capacity();
+        geometric_vector_t::size_type const gc  =   gv.capacity();
+
+        lv.push_back(i);
+        gv.push_back(i);
+
+        numLinearReallocations += (lc != lv.capacity());
+        numGeometricReallocations += (gc != gv.capacity());
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(100000u, lv.size());
+    XTESTS_TEST_INTEGER_EQUAL(100000u, gv.size());
+    XTESTS_TEST_BOOLEAN_TRUE(std::equal(lv.begin(), lv.end(), gv.begin()));
+
+    XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(6000, numLinearReallocations);
+    XTESTS_TEST_INTEGER_LESS_OR_EQUAL(30, numGeometricReallocations);
+}
+
 } // anonymous namespace
 
 
@@ -4,7 +4,7 @@
  * Purpose: Unit-tests for `stlsoft::unicode_point_map`.
  *
  * Created: 5th November 2024
- * Updated: 17th December 2024
+ * Updated: 16th October 2026
  *
  * ////////////////////////////////////////////////////////////////////// */
 
@@ -42,6 +42,7 @@
 
 /* Standard C header files */
 #include <stdlib.h>
+#include <string.h>
 
 
 /* /////////////////////////////////////////////////////////////////////////
@@ -63,9 +64,15 @@ namespace
     static void test_push_n_1(void);
     static void test_push_n_2(void);
     static void test_clear(void);
-//     static void test_merge(void);
-//     static void test_op_addassign(void);
+    static void test_merge(void);
+    static void test_merge_self(void);
+    static void test_op_addassign(void);
 //     static void test_op_add(void);
+    static void test_push_utf8_ascii(void);
+    static void test_push_utf8_multibyte(void);
+    static void test_push_utf8_ill_formed(void);
+    static void test_push_utf8_incomplete(void);
+    static void test_push_utf8_parallel(void);
     static void test_swap(void);
     static void test_swap_std(void);
     static void test_iteration_1(void);
@@ -99,6 +106,14 @@ int main(int argc, char *argv[])
         XTESTS_RUN_CASE(test_push_n_1);
         XTESTS_RUN_CASE(test_push_n_2);
         XTESTS_RUN_CASE(test_clear);
+        XTESTS_RUN_CASE(test_merge);
+        XTESTS_RUN_CASE(test_merge_self);
+        XTESTS_RUN_CASE(test_op_addassign);
+        XTESTS_RUN_CASE(test_push_utf8_ascii);
+        XTESTS_RUN_CASE(test_push_utf8_multibyte);
+        XTESTS_RUN_CASE(test_push_utf8_ill_formed);
+        XTESTS_RUN_CASE(test_push_utf8_incomplete);
+        XTESTS_RUN_CASE(test_push_utf8_parallel);
         XTESTS_RUN_CASE(test_swap);
         XTESTS_RUN_CASE(test_swap_std);
         XTESTS_RUN_CASE(test_iteration_1);
@@ -333,6 +348,244 @@ static void test_clear()
     XTESTS_TEST_INTEGER_EQUAL(0, upm['f']);
 }
 
+static void test_merge()
+{
+    unicode_point_map upm1(128);
+    unicode_point_map upm2;
+
+    upm1.push_n('a', 2);
+    upm1.push_n('b', 1);
+    upm1.push_n(0x20ACu, 3);
+
+    upm2.push_n('a', 1);
+    upm2.push_n('b', -1);
+    upm2.push_n('c', 4);
+    upm2.push_n(0x20ACu, 1);
+    upm2.push_n(0x1F600u, 5);
+
+    upm1.merge(upm2);
+
+    XTESTS_TEST_INTEGER_EQUAL(4u, upm1.size());
+    XTESTS_TEST_INTEGER_EQUAL(16, upm1.total());
+    XTESTS_TEST_INTEGER_EQUAL(3, upm1['a']);
+    XTESTS_TEST_INTEGER_EQUAL(0, upm1['b']);
+    XTESTS_TEST_BOOLEAN_FALSE(upm1.contains('b'));
+    XTESTS_TEST_INTEGER_EQUAL(4, upm1['c']);
+    XTESTS_TEST_INTEGER_EQUAL(4, upm1[0x20ACu]);
+    XTESTS_TEST_INTEGER_EQUAL(5, upm1[0x1F600u]);
+
+    XTESTS_TEST_INTEGER_EQUAL(5u, upm2.size());
+    XTESTS_TEST_INTEGER_EQUAL(10, upm2.total());
+}
+
+static void test_merge_self()
+{
+    unicode_point_map upm(128);
+
+    upm.push_n('a', 2);
+    upm.push_n('b', -1);
+    upm.push_n(0x20ACu, 3);
+
+    upm.merge(upm);
+
+    XTESTS_TEST_INTEGER_EQUAL(3u, upm.size());
+    XTESTS_TEST_INTEGER_EQUAL(8, upm.total());
+    XTESTS_TEST_INTEGER_EQUAL(4, upm['a']);
+    XTESTS_TEST_INTEGER_EQUAL(-2, upm['b']);
+    XTESTS_TEST_INTEGER_EQUAL(6, upm[0x20ACu]);
+}
+
+static void test_op_addassign()
+{
+    unicode_point_map upm1;
+    unicode_point_map upm2(1000);
+
+    upm1.push_n('x', 1);
+
+    upm2.push_n('x', 2);
+    upm2.push_n(0x3B1u, 3);
+
+    upm1 += upm2;
+    upm1 += upm2;
+
+    XTESTS_TEST_INTEGER_EQUAL(2u, upm1.size());
+    XTESTS_TEST_INTEGER_EQUAL(11, upm1.total());
+    XTESTS_TEST_INTEGER_EQUAL(5, upm1['x']);
+    XTESTS_TEST_INTEGER_EQUAL(6, upm1[0x3B1u]);
+}
+
+static void test_push_utf8_ascii()
+{
+    {
+        unicode_point_map upm;
+
+        XTESTS_TEST_INTEGER_EQUAL(0u, upm.push_utf8(NULL, 0));
+        XTESTS_TEST_BOOLEAN_TRUE(upm.empty());
+    }
+
+    // long enough to exercise the SIMD paths, with a tail, in maps with
+    // and without contiguous storage for ASCII
+
+    char const  s[] = "The quick brown fox jumps over the lazy dog, and then the quick brown fox jumps over the lazy dog again!";
+
+    { for (unsigned ceiling = 0; ceiling <= 256; ceiling += 128)
+    {
+        unicode_point_map upm(ceiling);
+
+        XTESTS_TEST_INTEGER_EQUAL(STLSOFT_NUM_ELEMENTS(s) - 1, upm.push_utf8(s, STLSOFT_NUM_ELEMENTS(s) - 1));
+        XTESTS_TEST_INTEGER_EQUAL(long(STLSOFT_NUM_ELEMENTS(s) - 1), upm.total());
+        XTESTS_TEST_INTEGER_EQUAL(20, upm[' ']);
+        XTESTS_TEST_INTEGER_EQUAL(8, upm['o']);
+        XTESTS_TEST_INTEGER_EQUAL(1, upm['!']);
+        XTESTS_TEST_INTEGER_EQUAL(1, upm['T']);
+        XTESTS_TEST_INTEGER_EQUAL(0, upm['X']);
+
+        unicode_point_map upm2(ceiling);
+
+        { for (size_t i = 0; i != STLSOFT_NUM_ELEMENTS(s) - 1; ++i)
+        {
+            upm2.push(s[i]);
+        }}
+
+        XTESTS_TEST_INTEGER_EQUAL(upm2.size(), upm.size());
+    }}
+}
+
+static void test_push_utf8_multibyte()
+{
+    // "aé€😀" repeated, then with a long ASCII run in the middle
+
+    std::string s;
+
+    { for (int i = 0; i != 10; ++i)
+    {
+        s += "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80";
+    }}
+    s += std::string(100, 'b');
+    s += "\xC2\x80\xDF\xBF\xE0\xA0\x80\xEF\xBF\xBF\xF0\x90\x80\x80\xF4\x8F\xBF\xBF";
+
+    unicode_point_map upm(256);
+
+    XTESTS_TEST_INTEGER_EQUAL(s.size(), upm.push_utf8(s.data(), s.size()));
+    XTESTS_TEST_INTEGER_EQUAL(11u, upm.size());
+    XTESTS_TEST_INTEGER_EQUAL(146, upm.total());
+    XTESTS_TEST_INTEGER_EQUAL(10, upm['a']);
+    XTESTS_TEST_INTEGER_EQUAL(100, upm['b']);
+    XTESTS_TEST_INTEGER_EQUAL(10, upm[0xE9u]);
+    XTESTS_TEST_INTEGER_EQUAL(10, upm[0x20ACu]);
+    XTESTS_TEST_INTEGER_EQUAL(10, upm[0x1F600u]);
+    XTESTS_TEST_INTEGER_EQUAL(1, upm[0x80u]);
+    XTESTS_TEST_INTEGER_EQUAL(1, upm[0x7FFu]);
+    XTESTS_TEST_INTEGER_EQUAL(1, upm[0x800u]);
+    XTESTS_TEST_INTEGER_EQUAL(1, upm[0xFFFFu]);
+    XTESTS_TEST_INTEGER_EQUAL(1, upm[0x10000u]);
+    XTESTS_TEST_INTEGER_EQUAL(1, upm[0x10FFFFu]);
+}
+
+static void test_push_utf8_ill_formed()
+{
+    struct
+    {
+        char const* s;
+        size_t      expected;
+    } const cases[] =
+    {
+        { "abc\x80" "def", 3 },           // lone continuation byte
+        { "abc\xC0\x80", 3 },              // overlong 2-byte
+        { "abc\xC1\xBF", 3 },              // overlong 2-byte
+        { "abc\xE0\x9F\xBF", 3 },          // overlong 3-byte
+        { "abc\xED\xA0\x80", 3 },          // surrogate
+        { "abc\xF0\x8F\xBF\xBF", 3 },      // overlong 4-byte
+        { "abc\xF4\x90\x80\x80", 3 },      // above U+10FFFF
+        { "abc\xF5\x80\x80\x80", 3 },      // invalid lead byte
+        { "abc\xFF", 3 },                  // invalid lead byte
+        { "\xC3\xA9\xC3(", 2 },            // bad continuation
+        { "\xE2\x82(", 0 },                // bad continuation
+    };
+
+    { for (size_t i = 0; i != STLSOFT_NUM_ELEMENTS(cases); ++i)
+    {
+        unicode_point_map   upm(128);
+        size_t const        len = ::strlen(cases[i].s);
+
+        XTESTS_TEST_INTEGER_EQUAL(cases[i].expected, upm.push_utf8(cases[i].s, len));
+
+        if (3 == cases[i].expected)
+        {
+            XTESTS_TEST_INTEGER_EQUAL(3u, upm.size());
+            XTESTS_TEST_INTEGER_EQUAL(3, upm.total());
+        }
+    }}
+}
+
+static void test_push_utf8_incomplete()
+{
+    // "€" (E2 82 AC), split across calls, as when reading in blocks
+
+    char const      s[] = "x\xE2\x82\xACy";
+    unicode_point_map upm;
+
+    XTESTS_TEST_INTEGER_EQUAL(1u, upm.push_utf8(s, 3));
+    XTESTS_TEST_INTEGER_EQUAL(4u, upm.push_utf8(s + 1, 4));
+
+    XTESTS_TEST_INTEGER_EQUAL(3u, upm.size());
+    XTESTS_TEST_INTEGER_EQUAL(3, upm.total());
+    XTESTS_TEST_INTEGER_EQUAL(1, upm['x']);
+    XTESTS_TEST_INTEGER_EQUAL(1, upm[0x20ACu]);
+    XTESTS_TEST_INTEGER_EQUAL(1, upm['y']);
+}
+
+static void test_push_utf8_parallel()
+{
+    // several chunks' worth, with multibyte sequences straddling the
+    // (initial) chunk boundaries
+
+    std::string s;
+
+    s.reserve(4 * unicode_point_map::min_chars_per_thread + 4);
+
+    for (; s.size() < 4 * unicode_point_map::min_chars_per_thread; )
+    {
+        s += "ab\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80 ";
+    }
+
+    {
+        unicode_point_map upm1(256);
+        unicode_point_map upm2(256);
+
+        XTESTS_TEST_INTEGER_EQUAL(s.size(), upm1.push_utf8(s.data(), s.size()));
+        XTESTS_TEST_INTEGER_EQUAL(s.size(), upm2.push_utf8(s.data(), s.size(), 4));
+
+        XTESTS_TEST_INTEGER_EQUAL(6u, upm2.size());
+        XTESTS_TEST_INTEGER_EQUAL(upm1.total(), upm2.total());
+
+        { for (unicode_point_map::const_iterator i = upm1.begin(); upm1.end() != i; ++i)
+        {
+            XTESTS_TEST_INTEGER_EQUAL((*i).second, upm2[(*i).first]);
+        }}
+    }
+
+    // an ill-formed byte in the third chunk is reported at the same
+    // position, and nothing after it is counted
+
+    size_t const bad = 2 * unicode_point_map::min_chars_per_thread + 101;
+
+    s[bad] = '\xFF';
+
+    {
+        unicode_point_map upm1;
+        unicode_point_map upm2;
+
+        XTESTS_TEST_INTEGER_EQUAL(bad, upm1.push_utf8(s.data(), s.size()));
+        XTESTS_TEST_INTEGER_EQUAL(bad, upm2.push_utf8(s.data(), s.size(), 4));
+
+        XTESTS_TEST_INTEGER_EQUAL(upm1.size(), upm2.size());
+        XTESTS_TEST_INTEGER_EQUAL(upm1.total(), upm2.total());
+        XTESTS_TEST_INTEGER_EQUAL(upm1[' '], upm2[' ']);
+        XTESTS_TEST_INTEGER_EQUAL(upm1[0x1F600u], upm2[0x1F600u]);
+    }
+}
+
 static void test_swap(void)
 {
     {
@@ -0,0 +1,485 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.stlsoft.containers.unsorted_map/entry.cpp
+ *
+ * Purpose: Unit-tests for `stlsoft::unsorted_map`.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* ///////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/containers/unsorted_map.hpp>
+
+
+/* ///////////////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+
+/* Standard C++ header files */
+#include <string>
+#include <utility>
+#include <vector>
+
+/* Standard C header files */
+#include <stdio.h>
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_ctor_default(void);
+    static void test_push_back(void);
+    static void test_push_back_replaces(void);
+    static void test_find(void);
+    static void test_count(void);
+    static void test_erase(void);
+    static void test_insertion_order(void);
+    static void test_many_elements(void);
+    static void test_erase_many_elements(void);
+    static void test_colliding_hashes(void);
+    static void test_copy(void);
+    static void test_unhashable_key(void);
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char *argv[])
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.stlsoft.containers.unsorted_map", verbosity))
+    {
+        XTESTS_RUN_CASE(test_ctor_default);
+        XTESTS_RUN_CASE(test_push_back);
+        XTESTS_RUN_CASE(test_push_back_replaces);
+        XTESTS_RUN_CASE(test_find);
+        XTESTS_RUN_CASE(test_count);
+        XTESTS_RUN_CASE(test_erase);
+        XTESTS_RUN_CASE(test_insertion_order);
+        XTESTS_RUN_CASE(test_many_elements);
+        XTESTS_RUN_CASE(test_erase_many_elements);
+        XTESTS_RUN_CASE(test_colliding_hashes);
+        XTESTS_RUN_CASE(test_copy);
+        XTESTS_RUN_CASE(test_unhashable_key);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+typedef stlsoft::unsorted_map<std::string, int>             string_map_t;
+typedef stlsoft::unsorted_map<int, int>                     int_map_t;
+
+std::string
+make_key(
+    int i
+)
+{
+    char buf[21];
+
+    ::sprintf(buf, "key-%d", i);
+
+    return buf;
+}
+
+// checks that the map holds exactly the keys [first, last) that are not
+// multiples of skip (if non-0), in order, each mapped to its key's value
+template <typename T_map>
+bool
+has_sequence(
+    T_map const&    m
+,   int             first
+,   int             last
+,   int             skip
+)
+{
+    typename T_map::const_iterator it = m.begin();
+
+    for (int i = first; i != last; ++i)
+    {
+        if (0 != skip &&
+            0 == i % skip)
+        {
+            continue;
+        }
+
+        if (m.end() == it ||
+            i != (*it).first ||
+            i != (*it).second)
+        {
+            return false;
+        }
+
+        ++it;
+    }
+
+    return m.end() == it;
+}
+
+
+static void test_ctor_default()
+{
+    string_map_t const m;
+
+    XTESTS_TEST_BOOLEAN_TRUE(m.empty());
+    XTESTS_TEST_INTEGER_EQUAL(0u, m.size());
+    XTESTS_TEST_BOOLEAN_TRUE(m.begin() == m.end());
+    XTESTS_TEST_BOOLEAN_TRUE(m.end() == m.find("abc"));
+    XTESTS_TEST_INTEGER_EQUAL(0u, m.count("abc"));
+}
+
+static void test_push_back()
+{
+    string_map_t m;
+
+    m.push_back("abc", 1);
+    m.push_back(string_map_t::value_type("def", 2));
+
+    XTESTS_TEST_BOOLEAN_FALSE(m.empty());
+    XTESTS_TEST_INTEGER_EQUAL(2u, m.size());
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc", m.front().first);
+    XTESTS_TEST_INTEGER_EQUAL(1, m.front().second);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("def", m.back().first);
+    XTESTS_TEST_INTEGER_EQUAL(2, m.back().second);
+}
+
+static void test_push_back_replaces()
+{
+    string_map_t m;
+
+    m.push_back("abc", 1);
+    m.push_back("def", 2);
+    m.push_back("abc", 3);
+
+    XTESTS_TEST_INTEGER_EQUAL(2u, m.size());
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc", m[0].first);
+    XTESTS_TEST_INTEGER_EQUAL(3, m[0].second);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("def", m[1].first);
+    XTESTS_TEST_INTEGER_EQUAL(2, m[1].second);
+}
+
+static void test_find()
+{
+    string_map_t m;
+
+    m.push_back("abc", 1);
+    m.push_back("def", 2);
+
+    string_map_t::iterator it = m.find("def");
+
+    XTESTS_REQUIRE(XTESTS_TEST_BOOLEAN_TRUE(m.end() != it));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("def", (*it).first);
+    XTESTS_TEST_INTEGER_EQUAL(2, (*it).second);
+
+    (*it).second = 22;
+
+    string_map_t const& cm = m;
+
+    string_map_t::const_iterator cit = cm.find("def");
+
+    XTESTS_REQUIRE(XTESTS_TEST_BOOLEAN_TRUE(cm.end() != cit));
+    XTESTS_TEST_INTEGER_EQUAL(22, (*cit).second);
+
+    XTESTS_TEST_BOOLEAN_TRUE(m.end() == m.find("ghi"));
+    XTESTS_TEST_BOOLEAN_TRUE(cm.end() == cm.find(""));
+}
+
+static void test_count()
+{
+    string_map_t m;
+
+    m.push_back("abc", 1);
+
+    XTESTS_TEST_INTEGER_EQUAL(1u, m.count("abc"));
+    XTESTS_TEST_INTEGER_EQUAL(0u, m.count("ab"));
+    XTESTS_TEST_INTEGER_EQUAL(0u, m.count("abcd"));
+}
+
+static void test_erase()
+{
+    string_map_t m;
+
+    m.push_back("abc", 1);
+    m.push_back("def", 2);
+    m.push_back("ghi", 3);
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, m.erase("xyz"));
+    XTESTS_TEST_INTEGER_EQUAL(1u, m.erase("def"));
+    XTESTS_TEST_INTEGER_EQUAL(0u, m.erase("def"));
+
+    XTESTS_TEST_INTEGER_EQUAL(2u, m.size());
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc", m[0].first);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("ghi", m[1].first);
+    XTESTS_TEST_BOOLEAN_TRUE(m.end() == m.find("def"));
+    XTESTS_TEST_INTEGER_EQUAL(3, (*m.find("ghi")).second);
+}
+
+static void test_insertion_order()
+{
+    string_map_t m;
+
+    m.push_back("zzz", 1);
+    m.push_back("aaa", 2);
+    m.push_back("mmm", 3);
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("zzz", m[0].first);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("aaa", m[1].first);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("mmm", m[2].first);
+}
+
+static void test_many_elements()
+{
+    // crosses the hash-index threshold, and grows the index several times
+
+    string_map_t m;
+
+    { for (int i = 0; i != 5000; ++i)
+    {
+        m.push_back(make_key(i), i);
+
+        XTESTS_TEST_INTEGER_EQUAL(size_t(i + 1), m.size());
+    }}
+
+    { for (int i = 0; i != 5000; ++i)
+    {
+        m.push_back(make_key(i), -i);
+    }}
+
+    XTESTS_TEST_INTEGER_EQUAL(5000u, m.size());
+
+    { for (int i = 0; i != 5000; ++i)
+    {
+        string_map_t::const_iterator const it = m.find(make_key(i));
+
+        XTESTS_REQUIRE(XTESTS_TEST_BOOLEAN_TRUE(m.end() != it));
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL(make_key(i), (*it).first);
+        XTESTS_TEST_INTEGER_EQUAL(-i, (*it).second);
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL(make_key(i), m[size_t(i)].first);
+    }}
+
+    XTESTS_TEST_BOOLEAN_TRUE(m.end() == m.find(make_key(5000)));
+    XTESTS_TEST_BOOLEAN_TRUE(m.end() == m.find(make_key(-1)));
+}
+
+static void test_erase_many_elements()
+{
+    int_map_t m;
+
+    { for (int i = 0; i != 2000; ++i)
+    {
+        m.push_back(i, i);
+    }}
+
+    // erase every 3rd, from the back, then from the front
+
+    { for (int i = 1998; i >= 0; i -= 6)
+    {
+        XTESTS_TEST_INTEGER_EQUAL(1u, m.erase(i));
+    }}
+    { for (int i = 3; i < 2000; i += 6)
+    {
+        XTESTS_TEST_INTEGER_EQUAL(1u, m.erase(i));
+    }}
+
+    XTESTS_TEST_BOOLEAN_TRUE(has_sequence(m, 0, 2000, 3));
+
+    { for (int i = 0; i != 2000; ++i)
+    {
+        XTESTS_TEST_INTEGER_EQUAL((0 == i % 3) ? 0u : 1u, m.count(i));
+    }}
+
+    // and add them back, at the end
+
+    { for (int i = 0; i < 2000; i += 3)
+    {
+        m.push_back(i, i);
+    }}
+
+    XTESTS_TEST_INTEGER_EQUAL(2000u, m.size());
+
+    { for (int i = 0; i != 2000; ++i)
+    {
+        int_map_t::const_iterator const it = m.find(i);
+
+        XTESTS_REQUIRE(XTESTS_TEST_BOOLEAN_TRUE(m.end() != it));
+        XTESTS_TEST_INTEGER_EQUAL(i, (*it).second);
+    }}
+
+    // and erase all but the last
+
+    { for (int i = 0; i != 1999; ++i)
+    {
+        XTESTS_TEST_INTEGER_EQUAL(1u, m.erase(i));
+    }}
+
+    XTESTS_TEST_INTEGER_EQUAL(1u, m.size());
+    XTESTS_TEST_INTEGER_EQUAL(1999, m.front().first);
+    XTESTS_TEST_INTEGER_EQUAL(1u, m.count(1999));
+}
+
+static void test_colliding_hashes()
+{
+#ifdef STLSOFT_UNSORTED_MAP_USE_HASH_INDEX_
+
+    // all keys in a few long probe sequences, to exercise the deletion
+    // of index entries
+
+    struct poor_hash
+    {
+        size_t operator ()(int i) const
+        {
+            return size_t(i % 4);
+        }
+    };
+
+    typedef stlsoft::unsorted_map<
+        int
+    ,   int
+    ,   std::less<int>
+    ,   std::allocator<int>
+    ,   poor_hash
+    >                               map_t;
+
+    map_t m;
+
+    { for (int i = 0; i != 200; ++i)
+    {
+        m.push_back(i, i);
+    }}
+
+    { for (int i = 0; i < 200; i += 5)
+    {
+        XTESTS_TEST_INTEGER_EQUAL(1u, m.erase(i));
+    }}
+
+    XTESTS_TEST_BOOLEAN_TRUE(has_sequence(m, 0, 200, 5));
+
+    { for (int i = 0; i != 200; ++i)
+    {
+        XTESTS_TEST_INTEGER_EQUAL((0 == i % 5) ? 0u : 1u, m.count(i));
+    }}
+#endif /* STLSOFT_UNSORTED_MAP_USE_HASH_INDEX_ */
+}
+
+static void test_copy()
+{
+    int_map_t m1;
+
+    { for (int i = 0; i != 100; ++i)
+    {
+        m1.push_back(i, i);
+    }}
+
+    int_map_t m2(m1);
+
+    m1.erase(50);
+
+    XTESTS_TEST_INTEGER_EQUAL(99u, m1.size());
+    XTESTS_TEST_INTEGER_EQUAL(100u, m2.size());
+    XTESTS_TEST_INTEGER_EQUAL(0u, m1.count(50));
+    XTESTS_TEST_INTEGER_EQUAL(1u, m2.count(50));
+    XTESTS_TEST_BOOLEAN_TRUE(has_sequence(m2, 0, 100, 0));
+
+    m2 = m1;
+
+    XTESTS_TEST_INTEGER_EQUAL(99u, m2.size());
+    XTESTS_TEST_INTEGER_EQUAL(0u, m2.count(50));
+    XTESTS_TEST_INTEGER_EQUAL(1u, m2.count(99));
+}
+
+// a key that is equality-comparable, but for which std::hash is not
+// specialised
+struct unhashable_key
+{
+    int value;
+
+    bool operator ==(unhashable_key const& rhs) const
+    {
+        return value == rhs.value;
+    }
+};
+
+static void test_unhashable_key()
+{
+    // such a map is looked up by linear search, however large it grows
+
+    typedef stlsoft::unsorted_map<unhashable_key, int>      map_t;
+
+    map_t m;
+
+    { for (int i = 0; i != 100; ++i)
+    {
+        unhashable_key const key = { i };
+
+        m.push_back(key, i);
+    }}
+
+    XTESTS_TEST_INTEGER_EQUAL(100u, m.size());
+
+    { for (int i = 0; i < 100; i += 3)
+    {
+        unhashable_key const key = { i };
+
+        XTESTS_TEST_INTEGER_EQUAL(1u, m.erase(key));
+    }}
+
+    { for (int i = 0; i != 100; ++i)
+    {
+        unhashable_key const    key = { i };
+        map_t::const_iterator   it  = m.find(key);
+
+        if (0 == i % 3)
+        {
+            XTESTS_TEST_BOOLEAN_TRUE(m.end() == it);
+            XTESTS_TEST_INTEGER_EQUAL(0u, m.count(key));
+        }
+        else
+        {
+            XTESTS_REQUIRE(XTESTS_TEST_BOOLEAN_TRUE(m.end() != it));
+            XTESTS_TEST_INTEGER_EQUAL(i, (*it).second);
+        }
+    }}
+
+    XTESTS_TEST_INTEGER_EQUAL(66u, m.size());
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
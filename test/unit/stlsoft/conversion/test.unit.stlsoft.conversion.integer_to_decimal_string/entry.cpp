@@ -0,0 +1,352 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.stlsoft.conversion.integer_to_decimal_string/entry.cpp
+ *
+ * Purpose: Unit-tests for `stlsoft::integer_to_decimal_string()` and
+ *          `stlsoft::integer_to_decimal_chars()`.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * feature control
+ */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* /////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/conversion/integer_to_string/integer_to_decimal_string.hpp>
+
+/* /////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+
+/* Standard C++ header files */
+#include <limits>
+#include <string>
+
+/* Standard C header files */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_powers_of_10_uint32(void);
+    static void test_powers_of_10_uint64(void);
+    static void test_limits(void);
+    static void test_numWritten(void);
+    static void test_wide(void);
+    static void test_against_sprintf(void);
+    static void test_chars_values(void);
+    static void test_chars_limits(void);
+    static void test_chars_insufficient_buffer(void);
+    static void test_chars_wide(void);
+    static void test_chars_against_sprintf(void);
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char *argv[])
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.stlsoft.conversion.integer_to_decimal_string", verbosity))
+    {
+        XTESTS_RUN_CASE(test_powers_of_10_uint32);
+        XTESTS_RUN_CASE(test_powers_of_10_uint64);
+        XTESTS_RUN_CASE(test_limits);
+        XTESTS_RUN_CASE(test_numWritten);
+        XTESTS_RUN_CASE(test_wide);
+        XTESTS_RUN_CASE(test_against_sprintf);
+        XTESTS_RUN_CASE(test_chars_values);
+        XTESTS_RUN_CASE(test_chars_limits);
+        XTESTS_RUN_CASE(test_chars_insufficient_buffer);
+        XTESTS_RUN_CASE(test_chars_wide);
+        XTESTS_RUN_CASE(test_chars_against_sprintf);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+    using stlsoft::integer_to_decimal_chars;
+    using stlsoft::integer_to_decimal_string;
+
+    template <typename I>
+    std::string
+    to_string_(
+        I i
+    )
+    {
+        char        sz[41];
+        char const* s = stlsoft::integer_to_decimal_string(&sz[0], STLSOFT_NUM_ELEMENTS(sz), i);
+
+        return s;
+    }
+
+    template <typename I>
+    std::string
+    to_chars_(
+        I i
+    )
+    {
+        char            sz[41];
+        size_t const    n = stlsoft::integer_to_decimal_chars(&sz[0], STLSOFT_NUM_ELEMENTS(sz), i);
+
+        return std::string(sz, n);
+    }
+
+    // sequence of values with all numbers of digits, and with each
+    // possible digit pair
+    uint64_t
+    next_value_(
+        uint64_t* r
+    )
+    {
+        *r = *r * 6364136223846793005ull + 1442695040888963407ull;
+
+        return *r >> (*r % 64);
+    }
+
+
+static void test_powers_of_10_uint32()
+{
+    uint32_t    v = 1;
+    std::string expected("1");
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("0", to_string_(uint32_t(0)));
+
+    { for (int i = 0; i != 10; ++i, v *= 10, expected += '0')
+    {
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL(expected, to_string_(v));
+
+        char buf[21];
+
+        ::sprintf(buf, "%lu", static_cast<unsigned long>(v - 1));
+
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL(buf, to_string_(v - 1));
+    }}
+}
+
+static void test_powers_of_10_uint64()
+{
+    uint64_t    v = 1;
+    std::string expected("1");
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("0", to_string_(uint64_t(0)));
+
+    { for (int i = 0; i != 20; ++i, v *= 10, expected += '0')
+    {
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL(expected, to_string_(v));
+
+        if (0 != i)
+        {
+            XTESTS_TEST_MULTIBYTE_STRING_EQUAL(std::string(static_cast<size_t>(i), '9'), to_string_(v - 1));
+        }
+    }}
+}
+
+static void test_limits()
+{
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("127", to_string_(std::numeric_limits<int8_t>::max()));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("-128", to_string_(std::numeric_limits<int8_t>::min()));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("255", to_string_(std::numeric_limits<uint8_t>::max()));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("32767", to_string_(std::numeric_limits<int16_t>::max()));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("-32768", to_string_(std::numeric_limits<int16_t>::min()));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("65535", to_string_(std::numeric_limits<uint16_t>::max()));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("2147483647", to_string_(std::numeric_limits<int32_t>::max()));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("-2147483648", to_string_(std::numeric_limits<int32_t>::min()));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("4294967295", to_string_(std::numeric_limits<uint32_t>::max()));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("9223372036854775807", to_string_(std::numeric_limits<int64_t>::max()));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("-9223372036854775808", to_string_(std::numeric_limits<int64_t>::min()));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("18446744073709551615", to_string_(std::numeric_limits<uint64_t>::max()));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("-1", to_string_(int32_t(-1)));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("-10", to_string_(int64_t(-10)));
+}
+
+static void test_numWritten()
+{
+    char        sz[21];
+    size_t      n;
+    char const* s;
+
+    s = integer_to_decimal_string(&sz[0], STLSOFT_NUM_ELEMENTS(sz), 0, &n);
+
+    XTESTS_TEST_INTEGER_EQUAL(1u, n);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("0", s);
+
+    s = integer_to_decimal_string(&sz[0], STLSOFT_NUM_ELEMENTS(sz), -987654, &n);
+
+    XTESTS_TEST_INTEGER_EQUAL(7u, n);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("-987654", s);
+    XTESTS_TEST_POINTER_EQUAL(&sz[STLSOFT_NUM_ELEMENTS(sz) - 8], s);
+}
+
+static void test_wide()
+{
+    wchar_t         sz[21];
+    wchar_t const*  s;
+
+    s = integer_to_decimal_string(&sz[0], STLSOFT_NUM_ELEMENTS(sz), 1234567890u);
+
+    XTESTS_TEST_WIDE_STRING_EQUAL(L"1234567890", s);
+
+    s = integer_to_decimal_string(&sz[0], STLSOFT_NUM_ELEMENTS(sz), -42);
+
+    XTESTS_TEST_WIDE_STRING_EQUAL(L"-42", s);
+}
+
+static void test_against_sprintf()
+{
+    uint64_t r = 1;
+
+    { for (int i = 0; i != 20000; ++i)
+    {
+        uint64_t const  u = next_value_(&r);
+        int64_t const   s = static_cast<int64_t>(u);
+        char            buf[41];
+
+        ::sprintf(buf, "%llu", static_cast<unsigned long long>(u));
+
+        if (!XTESTS_TEST_MULTIBYTE_STRING_EQUAL(buf, to_string_(u)))
+        {
+            break;
+        }
+
+        ::sprintf(buf, "%lld", static_cast<long long>(s));
+
+        if (!XTESTS_TEST_MULTIBYTE_STRING_EQUAL(buf, to_string_(s)))
+        {
+            break;
+        }
+
+        ::sprintf(buf, "%lu", static_cast<unsigned long>(static_cast<uint32_t>(u)));
+
+        if (!XTESTS_TEST_MULTIBYTE_STRING_EQUAL(buf, to_string_(static_cast<uint32_t>(u))))
+        {
+            break;
+        }
+    }}
+}
+
+static void test_chars_values()
+{
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("0", to_chars_(0));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("7", to_chars_(7u));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("10", to_chars_(10));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("99", to_chars_(99));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("100", to_chars_(100));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("-5", to_chars_(-5));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("-100", to_chars_(-100));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("1234567890123", to_chars_(int64_t(1234567890123)));
+}
+
+static void test_chars_limits()
+{
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("-128", to_chars_(std::numeric_limits<int8_t>::min()));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("255", to_chars_(std::numeric_limits<uint8_t>::max()));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("-32768", to_chars_(std::numeric_limits<int16_t>::min()));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("-2147483648", to_chars_(std::numeric_limits<int32_t>::min()));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("4294967295", to_chars_(std::numeric_limits<uint32_t>::max()));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("-9223372036854775808", to_chars_(std::numeric_limits<int64_t>::min()));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("18446744073709551615", to_chars_(std::numeric_limits<uint64_t>::max()));
+}
+
+static void test_chars_insufficient_buffer()
+{
+    char buf[8];
+
+    ::memset(buf, '#', sizeof(buf));
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, integer_to_decimal_chars(&buf[0], 3, 1234));
+    XTESTS_TEST_INTEGER_EQUAL(0u, integer_to_decimal_chars(&buf[0], 4, -1234));
+    XTESTS_TEST_INTEGER_EQUAL(0u, integer_to_decimal_chars(&buf[0], 0, 0));
+    XTESTS_TEST_CHARACTER_EQUAL('#', buf[0]);
+
+    XTESTS_TEST_INTEGER_EQUAL(4u, integer_to_decimal_chars(&buf[0], 4, 1234));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("1234", std::string(buf, 4));
+    XTESTS_TEST_CHARACTER_EQUAL('#', buf[4]);
+}
+
+static void test_chars_wide()
+{
+    wchar_t         buf[21];
+    size_t const    n = integer_to_decimal_chars(&buf[0], STLSOFT_NUM_ELEMENTS(buf), -1234567);
+
+    XTESTS_TEST_WIDE_STRING_EQUAL(L"-1234567", std::wstring(buf, n));
+}
+
+static void test_chars_against_sprintf()
+{
+    uint64_t r = 1;
+
+    { for (int i = 0; i != 20000; ++i)
+    {
+        uint64_t const  u = next_value_(&r);
+        int64_t const   s = static_cast<int64_t>(u);
+        char            buf[41];
+
+        ::sprintf(buf, "%llu", static_cast<unsigned long long>(u));
+
+        if (!XTESTS_TEST_MULTIBYTE_STRING_EQUAL(buf, to_chars_(u)))
+        {
+            break;
+        }
+
+        ::sprintf(buf, "%lld", static_cast<long long>(s));
+
+        if (!XTESTS_TEST_MULTIBYTE_STRING_EQUAL(buf, to_chars_(s)))
+        {
+            break;
+        }
+
+        ::sprintf(buf, "%d", static_cast<int>(static_cast<int16_t>(u)));
+
+        if (!XTESTS_TEST_MULTIBYTE_STRING_EQUAL(buf, to_chars_(static_cast<int16_t>(u))))
+        {
+            break;
+        }
+    }}
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,519 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.stlsoft.conversion.string_to_integer/entry.cpp
+ *
+ * Purpose: Unit-tests for `stlsoft::string_to_integer()`,
+ *          `stlsoft::try_parse_to()`, and
+ *          `stlsoft::parse_integer_sequence()`.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * feature control
+ */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* /////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/conversion/string_to_integer.hpp>
+
+/* /////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+
+/* Standard C++ header files */
+#include <string>
+
+/* Standard C header files */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_string_to_integer(void);
+    static void test_string_to_integer_len(void);
+    static void test_try_parse_to_all_lengths(void);
+    static void test_try_parse_to_trailing_characters(void);
+    static void test_try_parse_to_signed(void);
+    static void test_try_parse_to_wraps(void);
+    static void test_try_parse_to_wide(void);
+    static void test_try_parse_to_against_reference(void);
+    static void test_parse_integer_sequence(void);
+    static void test_parse_integer_sequence_failures(void);
+    static void test_parse_integer_sequence_maxValues(void);
+    static void test_parse_integer_sequence_wide(void);
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char *argv[])
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.stlsoft.conversion.string_to_integer", verbosity))
+    {
+        XTESTS_RUN_CASE(test_string_to_integer);
+        XTESTS_RUN_CASE(test_string_to_integer_len);
+        XTESTS_RUN_CASE(test_try_parse_to_all_lengths);
+        XTESTS_RUN_CASE(test_try_parse_to_trailing_characters);
+        XTESTS_RUN_CASE(test_try_parse_to_signed);
+        XTESTS_RUN_CASE(test_try_parse_to_wraps);
+        XTESTS_RUN_CASE(test_try_parse_to_wide);
+        XTESTS_RUN_CASE(test_try_parse_to_against_reference);
+        XTESTS_RUN_CASE(test_parse_integer_sequence);
+        XTESTS_RUN_CASE(test_parse_integer_sequence_failures);
+        XTESTS_RUN_CASE(test_parse_integer_sequence_maxValues);
+        XTESTS_RUN_CASE(test_parse_integer_sequence_wide);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+    using stlsoft::parse_integer_sequence;
+    using stlsoft::string_to_integer;
+    using stlsoft::try_parse_to;
+
+    // digit-at-a-time reference, which wraps in the same way as the
+    // conversion functions
+    uint64_t
+    reference_parse_(
+        char const* s
+    ,   size_t      len
+    ,   size_t*     numDigits
+    )
+    {
+        uint64_t    r = 0;
+        size_t      i = 0;
+
+        for (; i != len && '0' <= s[i] && s[i] <= '9'; ++i)
+        {
+            r = 10 * r + static_cast<unsigned>(s[i] - '0');
+        }
+
+        *numDigits = i;
+
+        return r;
+    }
+
+    uint64_t
+    next_random_(
+        uint64_t* r
+    )
+    {
+        *r = *r * 6364136223846793005ull + 1442695040888963407ull;
+
+        return *r >> 33;
+    }
+
+
+static void test_string_to_integer()
+{
+    char const* endptr;
+
+    XTESTS_TEST_INTEGER_EQUAL(1234, string_to_integer("1234", static_cast<char const**>(NULL)));
+    XTESTS_TEST_INTEGER_EQUAL(1234, string_to_integer("  1234", static_cast<char const**>(NULL)));
+    XTESTS_TEST_INTEGER_EQUAL(1234, string_to_integer("  +1234", static_cast<char const**>(NULL)));
+    XTESTS_TEST_INTEGER_EQUAL(-1234, string_to_integer("  -1234", static_cast<char const**>(NULL)));
+
+    XTESTS_TEST_INTEGER_EQUAL(1234, string_to_integer("  +1234abc", &endptr));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc", endptr);
+
+    XTESTS_TEST_INTEGER_EQUAL(123456789, string_to_integer("123456789 ", &endptr));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL(" ", endptr);
+}
+
+static void test_string_to_integer_len()
+{
+    char const  s[] = "  -123456789012,3";
+    char const* endptr;
+
+    XTESTS_TEST_INTEGER_EQUAL(-1234567, string_to_integer(s, 10, &endptr));
+    XTESTS_TEST_POINTER_EQUAL(s + 10, endptr);
+
+    XTESTS_TEST_INTEGER_EQUAL(12345, string_to_integer(s + 3, 5, &endptr));
+    XTESTS_TEST_POINTER_EQUAL(s + 8, endptr);
+
+    XTESTS_TEST_INTEGER_EQUAL(0, string_to_integer(s, 0, &endptr));
+    XTESTS_TEST_POINTER_EQUAL(NULL, endptr);
+}
+
+static void test_try_parse_to_all_lengths()
+{
+    std::string s;
+    uint64_t    expected = 0;
+
+    { for (int i = 0; i != 19; ++i)
+    {
+        char const digit = static_cast<char>('1' + i % 9);
+
+        s += digit;
+        expected = 10 * expected + static_cast<unsigned>(digit - '0');
+
+        uint64_t v;
+
+        XTESTS_TEST_BOOLEAN_TRUE(try_parse_to(s.data(), s.size(), &v));
+        XTESTS_TEST_INTEGER_EQUAL(expected, v);
+
+        XTESTS_TEST_BOOLEAN_TRUE(try_parse_to(s.c_str(), &v));
+        XTESTS_TEST_INTEGER_EQUAL(expected, v);
+
+        XTESTS_TEST_BOOLEAN_TRUE(try_parse_to(s, &v));
+        XTESTS_TEST_INTEGER_EQUAL(expected, v);
+    }}
+
+    uint64_t v;
+
+    XTESTS_TEST_BOOLEAN_TRUE(try_parse_to("18446744073709551615", &v));
+    XTESTS_TEST_INTEGER_EQUAL(18446744073709551615ull, v);
+
+    XTESTS_TEST_BOOLEAN_TRUE(try_parse_to("00000000000000000000000042", &v));
+    XTESTS_TEST_INTEGER_EQUAL(42u, v);
+}
+
+static void test_try_parse_to_trailing_characters()
+{
+    char const  s[] = "1234567890123456abc";
+    char const* endptr;
+    uint64_t    v;
+
+    XTESTS_TEST_BOOLEAN_FALSE(try_parse_to(s, &v));
+
+    XTESTS_TEST_BOOLEAN_FALSE(try_parse_to(s, &v, &endptr));
+    XTESTS_TEST_POINTER_EQUAL(s + 16, endptr);
+    XTESTS_TEST_INTEGER_EQUAL(1234567890123456ull, v);
+
+    XTESTS_TEST_BOOLEAN_FALSE(try_parse_to(s, STLSOFT_NUM_ELEMENTS(s) - 1, &v, &endptr));
+    XTESTS_TEST_POINTER_EQUAL(s + 16, endptr);
+
+    XTESTS_TEST_BOOLEAN_TRUE(try_parse_to(s, 16, &v, &endptr));
+    XTESTS_TEST_POINTER_EQUAL(s + 16, endptr);
+    XTESTS_TEST_INTEGER_EQUAL(1234567890123456ull, v);
+
+    // a non-digit in each position of a block
+    { for (size_t i = 0; i != 10; ++i)
+    {
+        char buf[] = "1234567890";
+
+        buf[i] = ':';
+
+        XTESTS_TEST_BOOLEAN_FALSE(try_parse_to(buf, STLSOFT_NUM_ELEMENTS(buf) - 1, &v, &endptr));
+        XTESTS_TEST_POINTER_EQUAL(buf + i, endptr);
+    }}
+
+    XTESTS_TEST_BOOLEAN_TRUE(try_parse_to("123456789012,", 13, ",", &v, &endptr));
+    XTESTS_TEST_INTEGER_EQUAL(123456789012ull, v);
+
+    XTESTS_TEST_BOOLEAN_FALSE(try_parse_to("123456789012;", 13, ",", &v, &endptr));
+}
+
+static void test_try_parse_to_signed()
+{
+    int64_t i64;
+    int32_t i32;
+
+    XTESTS_TEST_BOOLEAN_TRUE(try_parse_to("-123456789012", &i64));
+    XTESTS_TEST_INTEGER_EQUAL(-123456789012ll, i64);
+
+    XTESTS_TEST_BOOLEAN_TRUE(try_parse_to("  +123456789012", &i64));
+    XTESTS_TEST_INTEGER_EQUAL(123456789012ll, i64);
+
+    XTESTS_TEST_BOOLEAN_TRUE(try_parse_to("-9223372036854775807", &i64));
+    XTESTS_TEST_INTEGER_EQUAL(-9223372036854775807ll, i64);
+
+    XTESTS_TEST_BOOLEAN_TRUE(try_parse_to("-2147483647", &i32));
+    XTESTS_TEST_INTEGER_EQUAL(-2147483647, i32);
+
+    uint32_t u32;
+
+    XTESTS_TEST_BOOLEAN_FALSE(try_parse_to("-12345678", &u32));
+}
+
+static void test_try_parse_to_wraps()
+{
+    uint8_t     u8;
+    uint32_t    u32;
+    uint64_t    u64;
+
+    XTESTS_TEST_BOOLEAN_TRUE(try_parse_to("300", &u8));
+    XTESTS_TEST_INTEGER_EQUAL(44u, u8);
+
+    XTESTS_TEST_BOOLEAN_TRUE(try_parse_to("123456789012", &u8));
+    XTESTS_TEST_INTEGER_EQUAL(static_cast<uint8_t>(123456789012ull), u8);
+
+    XTESTS_TEST_BOOLEAN_TRUE(try_parse_to("123456789012", &u32));
+    XTESTS_TEST_INTEGER_EQUAL(static_cast<uint32_t>(123456789012ull), u32);
+
+    XTESTS_TEST_BOOLEAN_TRUE(try_parse_to("18446744073709551616", &u64));
+    XTESTS_TEST_INTEGER_EQUAL(0u, u64);
+
+    XTESTS_TEST_BOOLEAN_TRUE(try_parse_to("123456789012345678901234", &u64));
+    XTESTS_TEST_INTEGER_EQUAL(static_cast<uint64_t>(12345678901234567890ull * 10000 + 1234), u64);
+}
+
+static void test_try_parse_to_wide()
+{
+    wchar_t const   s[] = L"1234567890123,";
+    wchar_t const*  endptr;
+    uint64_t        v;
+
+    XTESTS_TEST_BOOLEAN_TRUE(try_parse_to(s, 13, &v, &endptr));
+    XTESTS_TEST_INTEGER_EQUAL(1234567890123ull, v);
+
+    XTESTS_TEST_BOOLEAN_FALSE(try_parse_to(s, 14, &v, &endptr));
+    XTESTS_TEST_POINTER_EQUAL(s + 13, endptr);
+}
+
+static void test_try_parse_to_against_reference()
+{
+    static char const   s_trailers[] = ",; y\n/:";
+    uint64_t            r = 1;
+
+    { for (int i = 0; i != 50000; ++i)
+    {
+        // a digit string of 0-24 digits, optionally followed by a
+        // non-digit and further digits
+        std::string s;
+
+        size_t const numDigits = static_cast<size_t>(next_random_(&r) % 25);
+
+        { for (size_t j = 0; j != numDigits; ++j)
+        {
+            s += static_cast<char>('0' + next_random_(&r) % 10);
+        }}
+
+        if (0 != next_random_(&r) % 2)
+        {
+            s += s_trailers[next_random_(&r) % (STLSOFT_NUM_ELEMENTS(s_trailers) - 1)];
+            s += "12345678";
+        }
+
+        size_t          refDigits;
+        uint64_t const  expected    =   reference_parse_(s.data(), s.size(), &refDigits);
+        bool const      isValid     =   0 != refDigits && s.size() == refDigits;
+        char const*     endptr;
+        uint64_t        u64;
+        int32_t         i32;
+
+        if (0 == refDigits)
+        {
+            continue;
+        }
+
+        if (!XTESTS_TEST_BOOLEAN_EQUAL(isValid, try_parse_to(s.data(), s.size(), &u64, &endptr)))
+        {
+            break;
+        }
+        if (!XTESTS_TEST_INTEGER_EQUAL(expected, u64))
+        {
+            break;
+        }
+        if (!XTESTS_TEST_POINTER_EQUAL(s.data() + refDigits, endptr))
+        {
+            break;
+        }
+
+        // signed overflow is undefined, so only test signed values in range
+        if (refDigits > 9)
+        {
+            continue;
+        }
+
+        if (!XTESTS_TEST_BOOLEAN_EQUAL(isValid, try_parse_to(s.data(), s.size(), &i32, &endptr)))
+        {
+            break;
+        }
+        if (!XTESTS_TEST_INTEGER_EQUAL(static_cast<int32_t>(expected), i32))
+        {
+            break;
+        }
+
+        s.insert(s.begin(), '-');
+
+        if (!XTESTS_TEST_BOOLEAN_EQUAL(isValid, try_parse_to(s.data(), s.size(), &i32, &endptr)))
+        {
+            break;
+        }
+        if (!XTESTS_TEST_INTEGER_EQUAL(-static_cast<int32_t>(expected), i32))
+        {
+            break;
+        }
+    }}
+}
+
+static void test_parse_integer_sequence()
+{
+    {
+        char const  s[] = "1,-2,3";
+        int         values[10];
+        char const* endptr;
+
+        XTESTS_TEST_INTEGER_EQUAL(3u, parse_integer_sequence(s, STLSOFT_NUM_ELEMENTS(s) - 1, ',', &values[0], STLSOFT_NUM_ELEMENTS(values), &endptr));
+        XTESTS_TEST_INTEGER_EQUAL(1, values[0]);
+        XTESTS_TEST_INTEGER_EQUAL(-2, values[1]);
+        XTESTS_TEST_INTEGER_EQUAL(3, values[2]);
+        XTESTS_TEST_POINTER_EQUAL(s + 6, endptr);
+    }
+
+    {
+        char const  s[] = "123456789012\n9876543210987654321\n0\n42\n";
+        uint64_t    values[10];
+        char const* endptr;
+
+        XTESTS_TEST_INTEGER_EQUAL(4u, parse_integer_sequence(s, STLSOFT_NUM_ELEMENTS(s) - 1, '\n', &values[0], STLSOFT_NUM_ELEMENTS(values), &endptr));
+        XTESTS_TEST_INTEGER_EQUAL(123456789012ull, values[0]);
+        XTESTS_TEST_INTEGER_EQUAL(9876543210987654321ull, values[1]);
+        XTESTS_TEST_INTEGER_EQUAL(0u, values[2]);
+        XTESTS_TEST_INTEGER_EQUAL(42u, values[3]);
+        XTESTS_TEST_POINTER_EQUAL(s + STLSOFT_NUM_ELEMENTS(s) - 1, endptr);
+    }
+
+    {
+        int values[1];
+
+        XTESTS_TEST_INTEGER_EQUAL(0u, parse_integer_sequence(static_cast<char const*>(NULL), 0, ',', &values[0], STLSOFT_NUM_ELEMENTS(values), static_cast<char const**>(NULL)));
+    }
+
+    {
+        // the output matches that of parsing each field individually
+        std::string s;
+        uint64_t    expected[1000];
+        uint64_t    values[1000];
+        uint64_t    r = 1;
+
+        { for (size_t i = 0; i != STLSOFT_NUM_ELEMENTS(expected); ++i)
+        {
+            char buf[21];
+
+            expected[i] = next_random_(&r) >> (next_random_(&r) % 31);
+
+            ::sprintf(buf, "%llu", static_cast<unsigned long long>(expected[i]));
+
+            if (0 != i)
+            {
+                s += ' ';
+            }
+            s += buf;
+        }}
+
+        char const* endptr;
+
+        XTESTS_TEST_INTEGER_EQUAL(STLSOFT_NUM_ELEMENTS(values), parse_integer_sequence(s.data(), s.size(), ' ', &values[0], STLSOFT_NUM_ELEMENTS(values), &endptr));
+        XTESTS_TEST_POINTER_EQUAL(s.data() + s.size(), endptr);
+
+        { for (size_t i = 0; i != STLSOFT_NUM_ELEMENTS(expected); ++i)
+        {
+            if (!XTESTS_TEST_INTEGER_EQUAL(expected[i], values[i]))
+            {
+                break;
+            }
+        }}
+    }
+}
+
+static void test_parse_integer_sequence_failures()
+{
+    int         values[10];
+    char const* endptr;
+
+    {
+        char const s[] = "1,2,x,4";
+
+        XTESTS_TEST_INTEGER_EQUAL(2u, parse_integer_sequence(s, STLSOFT_NUM_ELEMENTS(s) - 1, ',', &values[0], STLSOFT_NUM_ELEMENTS(values), &endptr));
+        XTESTS_TEST_POINTER_EQUAL(s + 4, endptr);
+    }
+
+    {
+        char const s[] = "1,2,,4";
+
+        XTESTS_TEST_INTEGER_EQUAL(2u, parse_integer_sequence(s, STLSOFT_NUM_ELEMENTS(s) - 1, ',', &values[0], STLSOFT_NUM_ELEMENTS(values), &endptr));
+        XTESTS_TEST_POINTER_EQUAL(s + 4, endptr);
+    }
+
+    {
+        char const s[] = "123456789,2x,4";
+
+        XTESTS_TEST_INTEGER_EQUAL(1u, parse_integer_sequence(s, STLSOFT_NUM_ELEMENTS(s) - 1, ',', &values[0], STLSOFT_NUM_ELEMENTS(values), &endptr));
+        XTESTS_TEST_POINTER_EQUAL(s + 10, endptr);
+    }
+
+    {
+        char const s[] = "1;2";
+
+        XTESTS_TEST_INTEGER_EQUAL(0u, parse_integer_sequence(s, STLSOFT_NUM_ELEMENTS(s) - 1, ',', &values[0], STLSOFT_NUM_ELEMENTS(values), &endptr));
+        XTESTS_TEST_POINTER_EQUAL(s, endptr);
+    }
+}
+
+static void test_parse_integer_sequence_maxValues()
+{
+    char const  s[] = "1,2,3,4";
+    int         values[2];
+    char const* endptr;
+
+    XTESTS_TEST_INTEGER_EQUAL(2u, parse_integer_sequence(s, STLSOFT_NUM_ELEMENTS(s) - 1, ',', &values[0], STLSOFT_NUM_ELEMENTS(values), &endptr));
+    XTESTS_TEST_INTEGER_EQUAL(1, values[0]);
+    XTESTS_TEST_INTEGER_EQUAL(2, values[1]);
+    XTESTS_TEST_POINTER_EQUAL(s + 4, endptr);
+
+    XTESTS_TEST_INTEGER_EQUAL(2u, parse_integer_sequence(endptr, static_cast<size_t>((s + STLSOFT_NUM_ELEMENTS(s) - 1) - endptr), ',', &values[0], STLSOFT_NUM_ELEMENTS(values), &endptr));
+    XTESTS_TEST_INTEGER_EQUAL(3, values[0]);
+    XTESTS_TEST_INTEGER_EQUAL(4, values[1]);
+    XTESTS_TEST_POINTER_EQUAL(s + 7, endptr);
+}
+
+static void test_parse_integer_sequence_wide()
+{
+    wchar_t const   s[] = L"10\t-20\t123456789012";
+    int64_t         values[10];
+    wchar_t const*  endptr;
+
+    XTESTS_TEST_INTEGER_EQUAL(3u, parse_integer_sequence(s, STLSOFT_NUM_ELEMENTS(s) - 1, L'\t', &values[0], STLSOFT_NUM_ELEMENTS(values), &endptr));
+    XTESTS_TEST_INTEGER_EQUAL(10, values[0]);
+    XTESTS_TEST_INTEGER_EQUAL(-20, values[1]);
+    XTESTS_TEST_INTEGER_EQUAL(123456789012ll, values[2]);
+    XTESTS_TEST_POINTER_EQUAL(s + STLSOFT_NUM_ELEMENTS(s) - 1, endptr);
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
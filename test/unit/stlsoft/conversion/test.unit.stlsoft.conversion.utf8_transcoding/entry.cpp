@@ -0,0 +1,674 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.stlsoft.conversion.utf8_transcoding/entry.cpp
+ *
+ * Purpose: Unit-tests for `stlsoft::utf8_to_wide()`,
+ *          `stlsoft::wide_to_utf8()`, `stlsoft::basic_utf8_decoder`,
+ *          `stlsoft::basic_utf8_encoder`, and the `stlsoft::m2w_utf8` and
+ *          `stlsoft::w2m_utf8` converters.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * feature control
+ */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* /////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/conversion/utf8_transcoding.hpp>
+#include <stlsoft/conversion/char_conversions.hpp>
+
+/* /////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+
+/* Standard C++ header files */
+#include <algorithm>
+#include <string>
+#include <vector>
+
+/* Standard C header files */
+#include <locale.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_utf8_to_wide_ascii(void);
+    static void test_utf8_to_wide_utf16(void);
+    static void test_utf8_to_wide_utf32(void);
+    static void test_utf8_to_wide_ill_formed(void);
+    static void test_utf8_to_wide_incomplete(void);
+    static void test_utf8_to_wide_truncated(void);
+    static void test_wide_to_utf8_utf16(void);
+    static void test_wide_to_utf8_utf32(void);
+    static void test_wide_to_utf8_ill_formed(void);
+    static void test_wide_to_utf8_truncated(void);
+    static void test_round_trip(void);
+    static void test_decoder_byte_at_a_time(void);
+    static void test_decoder_ill_formed_across_chunks(void);
+    static void test_decoder_incomplete_at_finish(void);
+    static void test_encoder_split_surrogate_pair(void);
+    static void test_encoder_unpaired_surrogate(void);
+    static void test_m2w_utf8(void);
+    static void test_w2m_utf8(void);
+    static void test_w2m_utf8_grows(void);
+    static void test_m2w_long_non_ascii(void);
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+    static void test_m2w_utf8_ill_formed(void);
+    static void test_w2m_utf8_ill_formed(void);
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char *argv[])
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.stlsoft.conversion.utf8_transcoding", verbosity))
+    {
+        XTESTS_RUN_CASE(test_utf8_to_wide_ascii);
+        XTESTS_RUN_CASE(test_utf8_to_wide_utf16);
+        XTESTS_RUN_CASE(test_utf8_to_wide_utf32);
+        XTESTS_RUN_CASE(test_utf8_to_wide_ill_formed);
+        XTESTS_RUN_CASE(test_utf8_to_wide_incomplete);
+        XTESTS_RUN_CASE(test_utf8_to_wide_truncated);
+        XTESTS_RUN_CASE(test_wide_to_utf8_utf16);
+        XTESTS_RUN_CASE(test_wide_to_utf8_utf32);
+        XTESTS_RUN_CASE(test_wide_to_utf8_ill_formed);
+        XTESTS_RUN_CASE(test_wide_to_utf8_truncated);
+        XTESTS_RUN_CASE(test_round_trip);
+        XTESTS_RUN_CASE(test_decoder_byte_at_a_time);
+        XTESTS_RUN_CASE(test_decoder_ill_formed_across_chunks);
+        XTESTS_RUN_CASE(test_decoder_incomplete_at_finish);
+        XTESTS_RUN_CASE(test_encoder_split_surrogate_pair);
+        XTESTS_RUN_CASE(test_encoder_unpaired_surrogate);
+        XTESTS_RUN_CASE(test_m2w_utf8);
+        XTESTS_RUN_CASE(test_w2m_utf8);
+        XTESTS_RUN_CASE(test_w2m_utf8_grows);
+        XTESTS_RUN_CASE(test_m2w_long_non_ascii);
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+        XTESTS_RUN_CASE_THAT_THROWS(test_m2w_utf8_ill_formed, stlsoft::conversion_error);
+        XTESTS_RUN_CASE_THAT_THROWS(test_w2m_utf8_ill_formed, stlsoft::conversion_error);
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+    using stlsoft::ss_size_t;
+    using stlsoft::ss_uint16_t;
+    using stlsoft::ss_uint32_t;
+    using stlsoft::utf8_to_utf16_length;
+    using stlsoft::utf8_to_utf32_length;
+    using stlsoft::utf8_to_wide;
+    using stlsoft::wide_to_utf8;
+    using stlsoft::wide_to_utf8_length;
+
+    ss_size_t const npos = static_cast<ss_size_t>(-1);
+
+    // "a", U+00E9, U+20AC, U+1F600, "z"
+    char const          MIXED_UTF8[]    =   "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80z";
+    ss_uint16_t const   MIXED_UTF16[]   =   { 0x61, 0xE9, 0x20AC, 0xD83D, 0xDE00, 0x7A };
+    ss_uint32_t const   MIXED_UTF32[]   =   { 0x61, 0xE9, 0x20AC, 0x1F600, 0x7A };
+
+    struct ill_formed_case_t
+    {
+        char const* s;
+        size_t      errorPosition;
+    };
+
+    ss_uint32_t
+    next_random_(
+        ss_uint32_t* r
+    )
+    {
+        *r = *r * 1664525u + 1013904223u;
+
+        return *r >> 8;
+    }
+} // anonymous namespace
+
+namespace
+{
+
+static void test_utf8_to_wide_ascii()
+{
+    // long enough to exercise any vectorised paths, with a tail
+    std::string const   s = "The quick brown fox jumps over the lazy dog; 0123456789 ~!@#$%^&*()_+ {}[] <>?";
+    std::vector<wchar_t> dest(s.size());
+    ss_size_t           numRead = 0;
+
+    XTESTS_TEST_INTEGER_EQUAL(s.size(), stlsoft::utf8_to_wide_length(s.data(), s.size(), NULL));
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(s.size(), utf8_to_wide(s.data(), s.size(), &dest[0], dest.size(), &numRead, NULL)));
+    XTESTS_TEST_INTEGER_EQUAL(s.size(), numRead);
+
+    { for (size_t i = 0; i != s.size(); ++i)
+    {
+        XTESTS_TEST_INTEGER_EQUAL(static_cast<wchar_t>(s[i]), dest[i]);
+    }}
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, utf8_to_wide(static_cast<char const*>(NULL), 0, &dest[0], dest.size(), NULL, NULL));
+}
+
+static void test_utf8_to_wide_utf16()
+{
+    size_t const    cch = STLSOFT_NUM_ELEMENTS(MIXED_UTF8) - 1;
+    ss_uint16_t     dest[20];
+
+    XTESTS_TEST_INTEGER_EQUAL(6u, utf8_to_utf16_length(MIXED_UTF8, cch, NULL));
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(6u, utf8_to_wide(MIXED_UTF8, cch, &dest[0], STLSOFT_NUM_ELEMENTS(dest), NULL, NULL)));
+
+    { for (size_t i = 0; i != 6; ++i)
+    {
+        XTESTS_TEST_INTEGER_EQUAL(MIXED_UTF16[i], dest[i]);
+    }}
+}
+
+static void test_utf8_to_wide_utf32()
+{
+    size_t const    cch = STLSOFT_NUM_ELEMENTS(MIXED_UTF8) - 1;
+    ss_uint32_t     dest[20];
+
+    XTESTS_TEST_INTEGER_EQUAL(5u, utf8_to_utf32_length(MIXED_UTF8, cch, NULL));
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(5u, utf8_to_wide(MIXED_UTF8, cch, &dest[0], STLSOFT_NUM_ELEMENTS(dest), NULL, NULL)));
+
+    { for (size_t i = 0; i != 5; ++i)
+    {
+        XTESTS_TEST_INTEGER_EQUAL(MIXED_UTF32[i], dest[i]);
+    }}
+}
+
+static void test_utf8_to_wide_ill_formed()
+{
+    ill_formed_case_t const cases[] =
+    {
+        { "abc\x80",                3 },    // lone continuation byte
+        { "ab\xC0\x80",             2 },    // overlong NUL
+        { "\xC1\xBF",               0 },    // overlong 2-byte form
+        { "a\xE0\x9F\xBF",          1 },    // overlong 3-byte form
+        { "ab\xED\xA0\x80",         2 },    // surrogate
+        { "\xF0\x8F\xBF\xBF",       0 },    // overlong 4-byte form
+        { "abcd\xF4\x90\x80\x80",   4 },    // above U+10FFFF
+        { "\xF5\x80\x80\x80",       0 },    // invalid lead byte
+        { "\xC3\xA9\xC3" "a",       2 },    // truncated by ASCII
+        { "0123456789abcdefghijklmnopqrstuvwxyz\xFF", 36 },
+    };
+
+    { for (size_t i = 0; i != STLSOFT_NUM_ELEMENTS(cases); ++i)
+    {
+        char const* const   s   =   cases[i].s;
+        size_t const        cch =   ::strlen(s);
+        wchar_t             dest[64];
+        ss_size_t           errorPosition;
+
+        errorPosition = npos;
+        XTESTS_TEST_INTEGER_EQUAL(npos, utf8_to_wide(s, cch, &dest[0], STLSOFT_NUM_ELEMENTS(dest), NULL, &errorPosition));
+        XTESTS_TEST_INTEGER_EQUAL(cases[i].errorPosition, errorPosition);
+
+        errorPosition = npos;
+        XTESTS_TEST_INTEGER_EQUAL(npos, utf8_to_utf16_length(s, cch, &errorPosition));
+        XTESTS_TEST_INTEGER_EQUAL(cases[i].errorPosition, errorPosition);
+
+        errorPosition = npos;
+        XTESTS_TEST_INTEGER_EQUAL(npos, utf8_to_utf32_length(s, cch, &errorPosition));
+        XTESTS_TEST_INTEGER_EQUAL(cases[i].errorPosition, errorPosition);
+    }}
+}
+
+static void test_utf8_to_wide_incomplete()
+{
+    // a sequence cut short by the end of the input is an error for the
+    // one-shot functions
+    char const  s[] = "abc\xF0\x9F\x98";
+    wchar_t     dest[10];
+    ss_size_t   errorPosition = npos;
+
+    XTESTS_TEST_INTEGER_EQUAL(npos, utf8_to_wide(s, STLSOFT_NUM_ELEMENTS(s) - 1, &dest[0], STLSOFT_NUM_ELEMENTS(dest), NULL, &errorPosition));
+    XTESTS_TEST_INTEGER_EQUAL(3u, errorPosition);
+}
+
+static void test_utf8_to_wide_truncated()
+{
+    size_t const    cch = STLSOFT_NUM_ELEMENTS(MIXED_UTF8) - 1;
+    ss_uint16_t     dest[6];
+    ss_size_t       numRead;
+
+    // the surrogate pair does not fit, so conversion stops before it
+    numRead = 0;
+    XTESTS_TEST_INTEGER_EQUAL(3u, utf8_to_wide(MIXED_UTF8, cch, &dest[0], 4, &numRead, NULL));
+    XTESTS_TEST_INTEGER_EQUAL(6u, numRead);
+
+    numRead = 0;
+    XTESTS_TEST_INTEGER_EQUAL(5u, utf8_to_wide(MIXED_UTF8, cch, &dest[0], 5, &numRead, NULL));
+    XTESTS_TEST_INTEGER_EQUAL(10u, numRead);
+
+    numRead = 99;
+    XTESTS_TEST_INTEGER_EQUAL(0u, utf8_to_wide(MIXED_UTF8, cch, &dest[0], 0, &numRead, NULL));
+    XTESTS_TEST_INTEGER_EQUAL(0u, numRead);
+}
+
+static void test_wide_to_utf8_utf16()
+{
+    size_t const    cch = STLSOFT_NUM_ELEMENTS(MIXED_UTF16);
+    char            dest[20];
+
+    XTESTS_TEST_INTEGER_EQUAL(11u, wide_to_utf8_length(&MIXED_UTF16[0], cch, NULL));
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(11u, wide_to_utf8(&MIXED_UTF16[0], cch, &dest[0], STLSOFT_NUM_ELEMENTS(dest), NULL, NULL)));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL_N(MIXED_UTF8, dest, 11);
+}
+
+static void test_wide_to_utf8_utf32()
+{
+    size_t const    cch = STLSOFT_NUM_ELEMENTS(MIXED_UTF32);
+    char            dest[20];
+
+    XTESTS_TEST_INTEGER_EQUAL(11u, wide_to_utf8_length(&MIXED_UTF32[0], cch, NULL));
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(11u, wide_to_utf8(&MIXED_UTF32[0], cch, &dest[0], STLSOFT_NUM_ELEMENTS(dest), NULL, NULL)));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL_N(MIXED_UTF8, dest, 11);
+}
+
+static void test_wide_to_utf8_ill_formed()
+{
+    char        dest[64];
+    ss_size_t   errorPosition;
+
+    {
+        ss_uint16_t const s[] = { 0x61, 0x62, 0xDC00, 0x63 };   // lone low surrogate
+
+        errorPosition = npos;
+        XTESTS_TEST_INTEGER_EQUAL(npos, wide_to_utf8(&s[0], STLSOFT_NUM_ELEMENTS(s), &dest[0], STLSOFT_NUM_ELEMENTS(dest), NULL, &errorPosition));
+        XTESTS_TEST_INTEGER_EQUAL(2u, errorPosition);
+
+        errorPosition = npos;
+        XTESTS_TEST_INTEGER_EQUAL(npos, wide_to_utf8_length(&s[0], STLSOFT_NUM_ELEMENTS(s), &errorPosition));
+        XTESTS_TEST_INTEGER_EQUAL(2u, errorPosition);
+    }
+
+    {
+        ss_uint16_t const s[] = { 0x61, 0xD800, 0x62 };         // high surrogate followed by non-surrogate
+
+        errorPosition = npos;
+        XTESTS_TEST_INTEGER_EQUAL(npos, wide_to_utf8(&s[0], STLSOFT_NUM_ELEMENTS(s), &dest[0], STLSOFT_NUM_ELEMENTS(dest), NULL, &errorPosition));
+        XTESTS_TEST_INTEGER_EQUAL(1u, errorPosition);
+    }
+
+    {
+        ss_uint16_t const s[] = { 0x61, 0x62, 0xD800 };         // trailing high surrogate
+
+        errorPosition = npos;
+        XTESTS_TEST_INTEGER_EQUAL(npos, wide_to_utf8(&s[0], STLSOFT_NUM_ELEMENTS(s), &dest[0], STLSOFT_NUM_ELEMENTS(dest), NULL, &errorPosition));
+        XTESTS_TEST_INTEGER_EQUAL(2u, errorPosition);
+    }
+
+    {
+        ss_uint32_t const s[] = { 0x61, 0xDFFF };               // surrogate in UTF-32
+
+        errorPosition = npos;
+        XTESTS_TEST_INTEGER_EQUAL(npos, wide_to_utf8(&s[0], STLSOFT_NUM_ELEMENTS(s), &dest[0], STLSOFT_NUM_ELEMENTS(dest), NULL, &errorPosition));
+        XTESTS_TEST_INTEGER_EQUAL(1u, errorPosition);
+    }
+
+    {
+        ss_uint32_t s[40];                                      // above U+10FFFF
+
+        { for (size_t i = 0; i != STLSOFT_NUM_ELEMENTS(s); ++i)
+        {
+            s[i] = 'x';
+        }}
+        s[33] = 0x110000;
+
+        errorPosition = npos;
+        XTESTS_TEST_INTEGER_EQUAL(npos, wide_to_utf8(&s[0], STLSOFT_NUM_ELEMENTS(s), &dest[0], STLSOFT_NUM_ELEMENTS(dest), NULL, &errorPosition));
+        XTESTS_TEST_INTEGER_EQUAL(33u, errorPosition);
+    }
+}
+
+static void test_wide_to_utf8_truncated()
+{
+    size_t const    cch = STLSOFT_NUM_ELEMENTS(MIXED_UTF16);
+    char            dest[20];
+    ss_size_t       numRead;
+
+    // the 4-byte sequence does not fit, so conversion stops before it
+    numRead = 0;
+    XTESTS_TEST_INTEGER_EQUAL(6u, wide_to_utf8(&MIXED_UTF16[0], cch, &dest[0], 9, &numRead, NULL));
+    XTESTS_TEST_INTEGER_EQUAL(3u, numRead);
+
+    numRead = 0;
+    XTESTS_TEST_INTEGER_EQUAL(10u, wide_to_utf8(&MIXED_UTF16[0], cch, &dest[0], 10, &numRead, NULL));
+    XTESTS_TEST_INTEGER_EQUAL(5u, numRead);
+}
+
+static void test_round_trip()
+{
+    ss_uint32_t r = 1;
+
+    { for (int n = 0; n != 200; ++n)
+    {
+        std::vector<ss_uint32_t>    points;
+        size_t const                len = next_random_(&r) % 100;
+
+        { for (size_t i = 0; i != len; ++i)
+        {
+            ss_uint32_t v;
+
+            switch (next_random_(&r) % 4)
+            {
+            case 0:     v = next_random_(&r) % 0x80; break;
+            case 1:     v = 0x80 + next_random_(&r) % 0x780; break;
+            case 2:     v = 0xE000 + next_random_(&r) % 0x2000; break;
+            default:    v = 0x10000 + next_random_(&r) % 0x100000; break;
+            }
+
+            points.push_back(v);
+        }}
+        points.push_back(0);
+
+        std::string                 utf8(4 * len + 1, '\0');
+        std::vector<ss_uint16_t>    utf16(2 * len + 1);
+        std::vector<ss_uint32_t>    utf32(len + 1);
+        size_t const                n8  =   wide_to_utf8(&points[0], len, &utf8[0], utf8.size(), NULL, NULL);
+
+        XTESTS_REQUIRE(XTESTS_TEST_INTEGER_NOT_EQUAL(npos, n8));
+        XTESTS_TEST_INTEGER_EQUAL(n8, wide_to_utf8_length(&points[0], len, NULL));
+
+        size_t const                n16 =   utf8_to_wide(utf8.data(), n8, &utf16[0], utf16.size(), NULL, NULL);
+        size_t const                n32 =   utf8_to_wide(utf8.data(), n8, &utf32[0], utf32.size(), NULL, NULL);
+
+        XTESTS_TEST_INTEGER_EQUAL(len, n32);
+        XTESTS_TEST_INTEGER_EQUAL(n16, utf8_to_utf16_length(utf8.data(), n8, NULL));
+        XTESTS_TEST_BOOLEAN_TRUE(std::equal(points.begin(), points.begin() + len, utf32.begin()));
+
+        std::string                 utf8b(4 * len + 1, '\0');
+
+        XTESTS_TEST_INTEGER_EQUAL(n8, wide_to_utf8(&utf16[0], n16, &utf8b[0], utf8b.size(), NULL, NULL));
+        XTESTS_TEST_BOOLEAN_TRUE(utf8 == utf8b);
+    }}
+}
+
+static void test_decoder_byte_at_a_time()
+{
+    stlsoft::basic_utf8_decoder<ss_uint16_t>    decoder;
+    std::vector<ss_uint16_t>                    result;
+    ss_uint16_t                                 dest[2];
+
+    { for (size_t i = 0; i != STLSOFT_NUM_ELEMENTS(MIXED_UTF8) - 1; ++i)
+    {
+        size_t const n = decoder.decode(&MIXED_UTF8[i], 1, &dest[0], STLSOFT_NUM_ELEMENTS(dest));
+
+        XTESTS_REQUIRE(XTESTS_TEST_INTEGER_NOT_EQUAL(npos, n));
+
+        result.insert(result.end(), &dest[0], &dest[0] + n);
+    }}
+
+    XTESTS_TEST_BOOLEAN_TRUE(decoder.finish());
+    XTESTS_TEST_INTEGER_EQUAL(STLSOFT_NUM_ELEMENTS(MIXED_UTF8) - 1, decoder.position());
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(STLSOFT_NUM_ELEMENTS(MIXED_UTF16), result.size()));
+    XTESTS_TEST_BOOLEAN_TRUE(std::equal(result.begin(), result.end(), &MIXED_UTF16[0]));
+}
+
+static void test_decoder_ill_formed_across_chunks()
+{
+    stlsoft::utf8_decoder   decoder;
+    wchar_t                 dest[10];
+
+    XTESTS_TEST_INTEGER_EQUAL(2u, decoder.decode("ab\xE2", 3, &dest[0], STLSOFT_NUM_ELEMENTS(dest)));
+    XTESTS_TEST_INTEGER_EQUAL(1u, decoder.num_pending());
+    XTESTS_TEST_INTEGER_EQUAL(npos, decoder.decode("\x82x", 2, &dest[0], STLSOFT_NUM_ELEMENTS(dest)));
+    XTESTS_TEST_BOOLEAN_TRUE(decoder.failed());
+    XTESTS_TEST_INTEGER_EQUAL(2u, decoder.error_position());
+
+    // subsequent calls fail, until reset
+
+    XTESTS_TEST_INTEGER_EQUAL(npos, decoder.decode("a", 1, &dest[0], STLSOFT_NUM_ELEMENTS(dest)));
+    XTESTS_TEST_BOOLEAN_FALSE(decoder.finish());
+
+    decoder.reset();
+
+    XTESTS_TEST_INTEGER_EQUAL(1u, decoder.decode("a", 1, &dest[0], STLSOFT_NUM_ELEMENTS(dest)));
+    XTESTS_TEST_BOOLEAN_TRUE(decoder.finish());
+
+    // an error later in the stream is reported relative to its start
+
+    decoder.reset();
+
+    XTESTS_TEST_INTEGER_EQUAL(3u, decoder.decode("abc", 3, &dest[0], STLSOFT_NUM_ELEMENTS(dest)));
+    XTESTS_TEST_INTEGER_EQUAL(npos, decoder.decode("de\xFF", 3, &dest[0], STLSOFT_NUM_ELEMENTS(dest)));
+    XTESTS_TEST_INTEGER_EQUAL(5u, decoder.error_position());
+}
+
+static void test_decoder_incomplete_at_finish()
+{
+    stlsoft::utf8_decoder   decoder;
+    wchar_t                 dest[10];
+
+    XTESTS_TEST_INTEGER_EQUAL(1u, decoder.decode("a\xF0\x9F", 3, &dest[0], STLSOFT_NUM_ELEMENTS(dest)));
+    XTESTS_TEST_INTEGER_EQUAL(0u, decoder.decode("\x98", 1, &dest[0], STLSOFT_NUM_ELEMENTS(dest)));
+    XTESTS_TEST_INTEGER_EQUAL(3u, decoder.num_pending());
+    XTESTS_TEST_INTEGER_EQUAL(1u, decoder.position());
+    XTESTS_TEST_BOOLEAN_FALSE(decoder.finish());
+    XTESTS_TEST_INTEGER_EQUAL(1u, decoder.error_position());
+}
+
+static void test_encoder_split_surrogate_pair()
+{
+    stlsoft::basic_utf8_encoder<ss_uint16_t>    encoder;
+    std::string                                 result;
+    char                                        dest[16];
+    size_t                                      n;
+
+    n = encoder.encode(&MIXED_UTF16[0], 4, &dest[0], STLSOFT_NUM_ELEMENTS(dest));
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(6u, n));
+    XTESTS_TEST_INTEGER_EQUAL(1u, encoder.num_pending());
+    result.append(dest, n);
+
+    n = encoder.encode(&MIXED_UTF16[4], 2, &dest[0], STLSOFT_NUM_ELEMENTS(dest));
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(5u, n));
+    result.append(dest, n);
+
+    XTESTS_TEST_BOOLEAN_TRUE(encoder.finish());
+    XTESTS_TEST_INTEGER_EQUAL(6u, encoder.position());
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL(MIXED_UTF8, result);
+}
+
+static void test_encoder_unpaired_surrogate()
+{
+    stlsoft::basic_utf8_encoder<ss_uint16_t>    encoder;
+    ss_uint16_t const                           s1[] = { 0x61, 0xD83D };
+    ss_uint16_t const                           s2[] = { 0x62 };
+    char                                        dest[16];
+
+    XTESTS_TEST_INTEGER_EQUAL(1u, encoder.encode(&s1[0], STLSOFT_NUM_ELEMENTS(s1), &dest[0], STLSOFT_NUM_ELEMENTS(dest)));
+    XTESTS_TEST_INTEGER_EQUAL(npos, encoder.encode(&s2[0], STLSOFT_NUM_ELEMENTS(s2), &dest[0], STLSOFT_NUM_ELEMENTS(dest)));
+    XTESTS_TEST_INTEGER_EQUAL(1u, encoder.error_position());
+
+    encoder.reset();
+
+    XTESTS_TEST_INTEGER_EQUAL(1u, encoder.encode(&s1[0], STLSOFT_NUM_ELEMENTS(s1), &dest[0], STLSOFT_NUM_ELEMENTS(dest)));
+    XTESTS_TEST_BOOLEAN_FALSE(encoder.finish());
+    XTESTS_TEST_INTEGER_EQUAL(1u, encoder.error_position());
+}
+
+static void test_m2w_utf8()
+{
+    stlsoft::m2w_utf8 const w(MIXED_UTF8);
+    std::wstring            expected;
+
+    if (2 == sizeof(wchar_t))
+    {
+        expected.assign(&MIXED_UTF16[0], &MIXED_UTF16[0] + STLSOFT_NUM_ELEMENTS(MIXED_UTF16));
+    }
+    else
+    {
+        expected.assign(&MIXED_UTF32[0], &MIXED_UTF32[0] + STLSOFT_NUM_ELEMENTS(MIXED_UTF32));
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(expected.size(), w.size());
+    XTESTS_TEST_WIDE_STRING_EQUAL(expected, w.c_str());
+    XTESTS_TEST_INTEGER_EQUAL(expected.size(), stlsoft::c_str_len(w));
+
+    stlsoft::m2w_utf8 const empty("");
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, empty.size());
+    XTESTS_TEST_WIDE_STRING_EQUAL(L"", empty.c_str());
+}
+
+static void test_w2m_utf8()
+{
+    std::wstring            s;
+
+    if (2 == sizeof(wchar_t))
+    {
+        s.assign(&MIXED_UTF16[0], &MIXED_UTF16[0] + STLSOFT_NUM_ELEMENTS(MIXED_UTF16));
+    }
+    else
+    {
+        s.assign(&MIXED_UTF32[0], &MIXED_UTF32[0] + STLSOFT_NUM_ELEMENTS(MIXED_UTF32));
+    }
+
+    stlsoft::w2m_utf8 const m(s);
+
+    XTESTS_TEST_INTEGER_EQUAL(STLSOFT_NUM_ELEMENTS(MIXED_UTF8) - 1, m.size());
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL(MIXED_UTF8, m.c_str());
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL(MIXED_UTF8, stlsoft::c_str_ptr(m));
+
+    stlsoft::w2m_utf8 const ascii(L"plain ASCII");
+
+    XTESTS_TEST_INTEGER_EQUAL(11u, ascii.size());
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("plain ASCII", ascii.c_str());
+}
+
+static void test_w2m_utf8_grows()
+{
+    // a string that is mostly ASCII, so that the buffer - sized for one
+    // byte per character - runs out only towards the end
+
+    std::wstring    s(500, L'x');
+    std::string     expected(500, 'x');
+
+    s.append(100, static_cast<wchar_t>(0x20AC));
+    { for (size_t i = 0; i != 100; ++i)
+    {
+        expected.append("\xE2\x82\xAC");
+    }}
+
+    stlsoft::w2m_utf8 const m(s);
+
+    XTESTS_TEST_INTEGER_EQUAL(expected.size(), m.size());
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL(expected, m.c_str());
+
+    stlsoft::wide2multibyte<8, stlsoft::utf8_char_conversion_policy> const m8(s.data(), 502);
+
+    XTESTS_TEST_INTEGER_EQUAL(506u, m8.size());
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL(expected.substr(0, 506), m8.c_str());
+}
+
+static void test_m2w_long_non_ascii()
+{
+    // more non-ASCII characters than the internal size, so that the
+    // buffer is allocated with more characters than are converted, which
+    // a sanitizer build will catch if it is then freed with the wrong size
+
+    std::string     s;
+    std::wstring    expected(300, static_cast<wchar_t>(0xE9));
+
+    { for (size_t i = 0; i != 300; ++i)
+    {
+        s.append("\xC3\xA9");
+    }}
+
+    {
+        stlsoft::m2w_utf8 const w(s);
+
+        XTESTS_TEST_INTEGER_EQUAL(300u, w.size());
+        XTESTS_TEST_WIDE_STRING_EQUAL(expected, w.c_str());
+
+        stlsoft::w2m_utf8 const m(w);
+
+        XTESTS_TEST_INTEGER_EQUAL(600u, m.size());
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL(s, m.c_str());
+    }
+
+    // and the same for the default (CRT) policy, in a UTF-8 locale, if
+    // one is available
+
+    std::string const   prev    =   ::setlocale(LC_ALL, NULL);
+    char const* const   utf8    =   ::setlocale(LC_ALL, "C.UTF-8");
+
+    if (NULL != utf8)
+    {
+        stlsoft::m2w const w(s);
+
+        XTESTS_TEST_INTEGER_EQUAL(300u, w.size());
+        XTESTS_TEST_WIDE_STRING_EQUAL(expected, w.c_str());
+    }
+
+    ::setlocale(LC_ALL, prev.c_str());
+}
+
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+
+static void test_m2w_utf8_ill_formed()
+{
+    stlsoft::m2w_utf8 const w("ab\xED\xA0\x80");
+
+    XTESTS_TEST_FAIL("should not get here");
+}
+
+static void test_w2m_utf8_ill_formed()
+{
+    std::wstring s(600, L'x');
+
+    s[550] = static_cast<wchar_t>(0xDC00);
+
+    stlsoft::w2m_utf8 const m(s);
+
+    XTESTS_TEST_FAIL("should not get here");
+}
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
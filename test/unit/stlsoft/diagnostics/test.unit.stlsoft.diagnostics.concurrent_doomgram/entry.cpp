@@ -0,0 +1,317 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.stlsoft.diagnostics.concurrent_doomgram/entry.cpp
+ *
+ * Purpose: Unit-tests for `stlsoft::concurrent_doomgram`.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* ///////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/diagnostics/concurrent_doomgram.hpp>
+
+/* ///////////////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/diagnostics/doomgram.hpp>
+#include <stlsoft/diagnostics/gram_utils.hpp>
+#include <stlsoft/stlsoft.h>
+
+/* Standard C++ header files */
+#include <thread>
+#include <vector>
+
+/* Standard C header files */
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void TEST_doomgram_MERGE_EMPTY();
+    static void TEST_doomgram_MERGE_DISTINCT();
+    static void TEST_concurrent_doomgram_DEFAULT_CONSTRUCT();
+    static void TEST_concurrent_doomgram_UNIFORM_SPREAD_TIMINGS();
+    static void TEST_concurrent_doomgram_ZERO_TIME_EVENTS();
+    static void TEST_concurrent_doomgram_MULTIPLE_THREADS();
+    static void TEST_concurrent_doomgram_MULTIPLE_INSTANCES();
+    static void TEST_concurrent_doomgram_CLEAR();
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char **argv)
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.stlsoft.diagnostics.concurrent_doomgram", verbosity))
+    {
+        XTESTS_RUN_CASE(TEST_doomgram_MERGE_EMPTY);
+        XTESTS_RUN_CASE(TEST_doomgram_MERGE_DISTINCT);
+        XTESTS_RUN_CASE(TEST_concurrent_doomgram_DEFAULT_CONSTRUCT);
+        XTESTS_RUN_CASE(TEST_concurrent_doomgram_UNIFORM_SPREAD_TIMINGS);
+        XTESTS_RUN_CASE(TEST_concurrent_doomgram_ZERO_TIME_EVENTS);
+        XTESTS_RUN_CASE(TEST_concurrent_doomgram_MULTIPLE_THREADS);
+        XTESTS_RUN_CASE(TEST_concurrent_doomgram_MULTIPLE_INSTANCES);
+        XTESTS_RUN_CASE(TEST_concurrent_doomgram_CLEAR);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+static void TEST_doomgram_MERGE_EMPTY()
+{
+    stlsoft::doomgram       dg1;
+    stlsoft::doomgram       dg2;
+    stlsoft::ss_uint64_t    min_event_time_ns;
+
+    XTESTS_TEST_BOOLEAN_TRUE(dg1.merge(dg2));
+
+    XTESTS_TEST_INTEGER_EQUAL(0, dg1.event_count());
+    XTESTS_TEST_INTEGER_EQUAL(0, dg1.total_event_time_ns_raw());
+    XTESTS_TEST_BOOLEAN_FALSE(dg1.try_get_min_event_time_ns(&min_event_time_ns));
+}
+
+static void TEST_doomgram_MERGE_DISTINCT()
+{
+    stlsoft::doomgram       dg1;
+    stlsoft::doomgram       dg2;
+    stlsoft::ss_uint64_t    min_event_time_ns;
+    stlsoft::ss_uint64_t    max_event_time_ns;
+
+    dg1.push_event_time_ns(  9);
+    dg1.push_event_time_us( 50);
+    dg2.push_event_time_ms(  3);
+    dg2.push_event_time_s(  80);
+
+    XTESTS_TEST_BOOLEAN_TRUE(dg1.merge(dg2));
+
+    XTESTS_TEST_INTEGER_EQUAL(4, dg1.event_count());
+    XTESTS_TEST_INTEGER_EQUAL(80003050009u, dg1.total_event_time_ns_raw());
+    XTESTS_TEST_BOOLEAN_TRUE(dg1.try_get_min_event_time_ns(&min_event_time_ns));
+    XTESTS_TEST_INTEGER_EQUAL(9, min_event_time_ns);
+    XTESTS_TEST_BOOLEAN_TRUE(dg1.try_get_max_event_time_ns(&max_event_time_ns));
+    XTESTS_TEST_INTEGER_EQUAL(80000000000u, max_event_time_ns);
+
+    {
+        char    strip[12];
+
+        stlsoft::gram_to_strip(dg1, &strip);
+
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL_N("a___a_a___a_", strip, 12);
+    }
+}
+
+static void TEST_concurrent_doomgram_DEFAULT_CONSTRUCT()
+{
+    stlsoft::concurrent_doomgram    cdg;
+    stlsoft::ss_uint64_t            min_event_time_ns;
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, cdg.num_cells());
+    XTESTS_TEST_INTEGER_EQUAL(0, cdg.event_count());
+    XTESTS_TEST_BOOLEAN_FALSE(cdg.has_overflowed());
+
+    stlsoft::doomgram const dg = cdg.snapshot();
+
+    XTESTS_TEST_INTEGER_EQUAL(0, dg.event_count());
+    XTESTS_TEST_INTEGER_EQUAL(0, dg.total_event_time_ns_raw());
+    XTESTS_TEST_BOOLEAN_FALSE(dg.try_get_min_event_time_ns(&min_event_time_ns));
+}
+
+static void TEST_concurrent_doomgram_UNIFORM_SPREAD_TIMINGS()
+{
+    stlsoft::concurrent_doomgram    cdg;
+    stlsoft::ss_uint64_t            min_event_time_ns;
+    stlsoft::ss_uint64_t            max_event_time_ns;
+
+    cdg.push_event_time_ns(  9);
+    cdg.push_event_time_ns( 80);
+    cdg.push_event_time_ns(700);
+    cdg.push_event_time_us(  6);
+    cdg.push_event_time_us( 50);
+    cdg.push_event_time_us(400);
+    cdg.push_event_time_ms(  3);
+    cdg.push_event_time_ms( 20);
+    cdg.push_event_time_ms(100);
+    cdg.push_event_time_s(   9);
+    cdg.push_event_time_s(  80);
+    cdg.push_event_time_s( 700);
+
+    XTESTS_TEST_INTEGER_EQUAL(1u, cdg.num_cells());
+    XTESTS_TEST_INTEGER_EQUAL(12, cdg.event_count());
+
+    stlsoft::doomgram const dg = cdg.snapshot();
+
+    XTESTS_TEST_BOOLEAN_FALSE(dg.has_overflowed());
+    XTESTS_TEST_INTEGER_EQUAL(12, dg.event_count());
+    XTESTS_TEST_INTEGER_EQUAL(789123456789u, dg.total_event_time_ns_raw());
+    XTESTS_TEST_BOOLEAN_TRUE(dg.try_get_min_event_time_ns(&min_event_time_ns));
+    XTESTS_TEST_INTEGER_EQUAL(9, min_event_time_ns);
+    XTESTS_TEST_BOOLEAN_TRUE(dg.try_get_max_event_time_ns(&max_event_time_ns));
+    XTESTS_TEST_INTEGER_EQUAL(700000000000u, max_event_time_ns);
+    XTESTS_TEST_INTEGER_EQUAL(1, dg.num_events_in_1ns());
+    XTESTS_TEST_INTEGER_EQUAL(1, dg.num_events_in_10ns());
+    XTESTS_TEST_INTEGER_EQUAL(1, dg.num_events_in_100ns());
+    XTESTS_TEST_INTEGER_EQUAL(1, dg.num_events_in_1us());
+    XTESTS_TEST_INTEGER_EQUAL(1, dg.num_events_in_10us());
+    XTESTS_TEST_INTEGER_EQUAL(1, dg.num_events_in_100us());
+    XTESTS_TEST_INTEGER_EQUAL(1, dg.num_events_in_1ms());
+    XTESTS_TEST_INTEGER_EQUAL(1, dg.num_events_in_10ms());
+    XTESTS_TEST_INTEGER_EQUAL(1, dg.num_events_in_100ms());
+    XTESTS_TEST_INTEGER_EQUAL(1, dg.num_events_in_1s());
+    XTESTS_TEST_INTEGER_EQUAL(1, dg.num_events_in_10s());
+    XTESTS_TEST_INTEGER_EQUAL(1, dg.num_events_ge_100s());
+}
+
+static void TEST_concurrent_doomgram_ZERO_TIME_EVENTS()
+{
+    stlsoft::concurrent_doomgram    cdg;
+    stlsoft::ss_uint64_t            min_event_time_ns;
+
+    cdg.push_event_time_ns(0);
+    cdg.push_event_time_us(0);
+    cdg.push_event_time_ms(0);
+    cdg.push_event_time_s(0);
+
+    stlsoft::doomgram const dg = cdg.snapshot();
+
+    XTESTS_TEST_INTEGER_EQUAL(4, dg.event_count());
+    XTESTS_TEST_INTEGER_EQUAL(0, dg.total_event_time_ns_raw());
+    XTESTS_TEST_BOOLEAN_TRUE(dg.try_get_min_event_time_ns(&min_event_time_ns));
+    XTESTS_TEST_INTEGER_EQUAL(0, min_event_time_ns);
+
+    {
+        char    strip[12];
+
+        stlsoft::gram_to_strip(dg, &strip);
+
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL_N("____________", strip, 12);
+    }
+}
+
+static void TEST_concurrent_doomgram_MULTIPLE_THREADS()
+{
+    stlsoft::concurrent_doomgram    cdg;
+    std::vector<std::thread>        threads;
+    stlsoft::ss_uint64_t            min_event_time_ns;
+    stlsoft::ss_uint64_t            max_event_time_ns;
+
+    for (int t = 0; t != 4; ++t)
+    {
+        threads.emplace_back([&cdg, t]() {
+
+            for (int i = 0; i != 10000; ++i)
+            {
+                cdg.push_event_time_ns(1 + t);
+                cdg.push_event_time_us(1 + t);
+            }
+        });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(4u, cdg.num_cells());
+
+    stlsoft::doomgram const dg = cdg.snapshot();
+
+    XTESTS_TEST_BOOLEAN_FALSE(dg.has_overflowed());
+    XTESTS_TEST_INTEGER_EQUAL(80000, dg.event_count());
+    XTESTS_TEST_INTEGER_EQUAL(10000u * (1 + 2 + 3 + 4) * 1001, dg.total_event_time_ns_raw());
+    XTESTS_TEST_BOOLEAN_TRUE(dg.try_get_min_event_time_ns(&min_event_time_ns));
+    XTESTS_TEST_INTEGER_EQUAL(1, min_event_time_ns);
+    XTESTS_TEST_BOOLEAN_TRUE(dg.try_get_max_event_time_ns(&max_event_time_ns));
+    XTESTS_TEST_INTEGER_EQUAL(4000, max_event_time_ns);
+    XTESTS_TEST_INTEGER_EQUAL(40000, dg.num_events_in_1ns());
+    XTESTS_TEST_INTEGER_EQUAL(40000, dg.num_events_in_1us());
+}
+
+static void TEST_concurrent_doomgram_MULTIPLE_INSTANCES()
+{
+    // exercise the per-thread cache of cells with more instances than it
+    // can hold
+
+    stlsoft::concurrent_doomgram    cdgs[7];
+
+    for (int i = 0; i != 100; ++i)
+    {
+        for (int j = 0; j != 7; ++j)
+        {
+            cdgs[j].push_event_time_ns(10 * (1 + j));
+        }
+    }
+
+    for (int j = 0; j != 7; ++j)
+    {
+        XTESTS_TEST_INTEGER_EQUAL(1u, cdgs[j].num_cells());
+        XTESTS_TEST_INTEGER_EQUAL(100, cdgs[j].event_count());
+        XTESTS_TEST_INTEGER_EQUAL(1000u * (1 + j), cdgs[j].snapshot().total_event_time_ns_raw());
+    }
+}
+
+static void TEST_concurrent_doomgram_CLEAR()
+{
+    stlsoft::concurrent_doomgram    cdg;
+    stlsoft::ss_uint64_t            max_event_time_ns;
+
+    cdg.push_event_time_ms(13);
+    cdg.push_event_time_ms(14);
+
+    XTESTS_TEST_INTEGER_EQUAL(2, cdg.event_count());
+
+    cdg.clear();
+
+    XTESTS_TEST_INTEGER_EQUAL(0, cdg.event_count());
+
+    cdg.push_event_time_us(13);
+
+    stlsoft::doomgram const dg = cdg.snapshot();
+
+    XTESTS_TEST_INTEGER_EQUAL(1, dg.event_count());
+    XTESTS_TEST_BOOLEAN_TRUE(dg.try_get_max_event_time_ns(&max_event_time_ns));
+    XTESTS_TEST_INTEGER_EQUAL(13000, max_event_time_ns);
+    XTESTS_TEST_INTEGER_EQUAL(1, dg.num_events_in_10us());
+}
+
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
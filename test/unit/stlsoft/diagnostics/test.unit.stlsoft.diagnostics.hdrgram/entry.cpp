@@ -0,0 +1,326 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.stlsoft.diagnostics.hdrgram/entry.cpp
+ *
+ * Purpose: Unit-tests for `stlsoft::hdrgram`.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* ///////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/diagnostics/hdrgram.hpp>
+
+/* ///////////////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <platformstl/diagnostics/stopwatch.hpp>
+#include <platformstl/synch/sleep_functions.h>
+#include <stlsoft/diagnostics/gram_scope.hpp>
+#include <stlsoft/stlsoft.h>
+
+/* Standard C header files */
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void TEST_hdrgram_DEFAULT_CONSTRUCT();
+    static void TEST_hdrgram_SINGLE_TIMING_EVENT();
+    static void TEST_hdrgram_EXACT_SMALL_VALUES();
+    static void TEST_hdrgram_BUCKET_BOUNDARIES();
+    static void TEST_hdrgram_QUANTILES_UNIFORM();
+    static void TEST_hdrgram_QUANTILES_WITHIN_ONE_DECADE();
+    static void TEST_hdrgram_MERGE();
+    static void TEST_hdrgram_MERGE_DIFFERENT_RESOLUTIONS();
+    static void TEST_hdrgram_CLEAR();
+    static void TEST_hdrgram_WITH_gram_scope();
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char **argv)
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.stlsoft.diagnostics.hdrgram", verbosity))
+    {
+        XTESTS_RUN_CASE(TEST_hdrgram_DEFAULT_CONSTRUCT);
+        XTESTS_RUN_CASE(TEST_hdrgram_SINGLE_TIMING_EVENT);
+        XTESTS_RUN_CASE(TEST_hdrgram_EXACT_SMALL_VALUES);
+        XTESTS_RUN_CASE(TEST_hdrgram_BUCKET_BOUNDARIES);
+        XTESTS_RUN_CASE(TEST_hdrgram_QUANTILES_UNIFORM);
+        XTESTS_RUN_CASE(TEST_hdrgram_QUANTILES_WITHIN_ONE_DECADE);
+        XTESTS_RUN_CASE(TEST_hdrgram_MERGE);
+        XTESTS_RUN_CASE(TEST_hdrgram_MERGE_DIFFERENT_RESOLUTIONS);
+        XTESTS_RUN_CASE(TEST_hdrgram_CLEAR);
+        XTESTS_RUN_CASE(TEST_hdrgram_WITH_gram_scope);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+static void TEST_hdrgram_DEFAULT_CONSTRUCT()
+{
+    stlsoft::hdrgram        hg;
+    stlsoft::ss_uint64_t    total_event_time_ns;
+    stlsoft::ss_uint64_t    min_event_time_ns;
+    stlsoft::ss_uint64_t    max_event_time_ns;
+
+    XTESTS_TEST_BOOLEAN_FALSE(hg.has_overflowed());
+
+    XTESTS_TEST_INTEGER_EQUAL(7u, hg.sub_bucket_bits());
+    XTESTS_TEST_INTEGER_EQUAL(58u * 128u, hg.num_buckets());
+    XTESTS_TEST_INTEGER_EQUAL(0, hg.event_count());
+    XTESTS_TEST_BOOLEAN_TRUE(hg.try_get_total_event_time_ns(&total_event_time_ns));
+    XTESTS_TEST_INTEGER_EQUAL(0, total_event_time_ns);
+    XTESTS_TEST_BOOLEAN_FALSE(hg.try_get_min_event_time_ns(&min_event_time_ns));
+    XTESTS_TEST_BOOLEAN_FALSE(hg.try_get_max_event_time_ns(&max_event_time_ns));
+    XTESTS_TEST_INTEGER_EQUAL(0, hg.value_at_quantile(0.5));
+    XTESTS_TEST_INTEGER_EQUAL(0, hg.value_at_percentile(99.9));
+}
+
+static void TEST_hdrgram_SINGLE_TIMING_EVENT()
+{
+    stlsoft::hdrgram        hg;
+    stlsoft::ss_uint64_t    min_event_time_ns;
+    stlsoft::ss_uint64_t    max_event_time_ns;
+
+    hg.push_event_time_ms(13);
+
+    XTESTS_TEST_INTEGER_EQUAL(1, hg.event_count());
+    XTESTS_TEST_INTEGER_EQUAL(13000000, hg.total_event_time_ns_raw());
+    XTESTS_TEST_BOOLEAN_TRUE(hg.try_get_min_event_time_ns(&min_event_time_ns));
+    XTESTS_TEST_INTEGER_EQUAL(13000000, min_event_time_ns);
+    XTESTS_TEST_BOOLEAN_TRUE(hg.try_get_max_event_time_ns(&max_event_time_ns));
+    XTESTS_TEST_INTEGER_EQUAL(13000000, max_event_time_ns);
+
+    // all quantiles are clamped to the (single) recorded value
+
+    XTESTS_TEST_INTEGER_EQUAL(13000000, hg.value_at_quantile(0.0));
+    XTESTS_TEST_INTEGER_EQUAL(13000000, hg.value_at_quantile(0.5));
+    XTESTS_TEST_INTEGER_EQUAL(13000000, hg.value_at_quantile(1.0));
+
+    XTESTS_TEST_INTEGER_EQUAL(1, hg.num_events_in_bucket(hg.bucket_index(13000000)));
+}
+
+static void TEST_hdrgram_EXACT_SMALL_VALUES()
+{
+    stlsoft::hdrgram hg(4);
+
+    for (stlsoft::ss_uint64_t i = 0; i != 16; ++i)
+    {
+        XTESTS_TEST_INTEGER_EQUAL(i, hg.bucket_index(i));
+        XTESTS_TEST_INTEGER_EQUAL(i, hg.bucket_lowest_value(i));
+        XTESTS_TEST_INTEGER_EQUAL(i, hg.bucket_highest_value(i));
+
+        hg.push_event_time_ns(i);
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(16, hg.event_count());
+    XTESTS_TEST_INTEGER_EQUAL(7, hg.value_at_quantile(0.5));
+    XTESTS_TEST_INTEGER_EQUAL(15, hg.value_at_quantile(1.0));
+}
+
+static void TEST_hdrgram_BUCKET_BOUNDARIES()
+{
+    stlsoft::hdrgram hg(4);
+
+    // [16, 32) is recorded exactly, in buckets 16-31
+    XTESTS_TEST_INTEGER_EQUAL(16u, hg.bucket_index(16));
+    XTESTS_TEST_INTEGER_EQUAL(31u, hg.bucket_index(31));
+
+    // [32, 64) is recorded with a resolution of 2
+    XTESTS_TEST_INTEGER_EQUAL(32u, hg.bucket_index(32));
+    XTESTS_TEST_INTEGER_EQUAL(32u, hg.bucket_index(33));
+    XTESTS_TEST_INTEGER_EQUAL(33u, hg.bucket_index(34));
+    XTESTS_TEST_INTEGER_EQUAL(47u, hg.bucket_index(63));
+    XTESTS_TEST_INTEGER_EQUAL(32, hg.bucket_lowest_value(32));
+    XTESTS_TEST_INTEGER_EQUAL(33, hg.bucket_highest_value(32));
+    XTESTS_TEST_INTEGER_EQUAL(62, hg.bucket_lowest_value(47));
+    XTESTS_TEST_INTEGER_EQUAL(63, hg.bucket_highest_value(47));
+
+    // [64, 128) is recorded with a resolution of 4
+    XTESTS_TEST_INTEGER_EQUAL(48u, hg.bucket_index(64));
+    XTESTS_TEST_INTEGER_EQUAL(48u, hg.bucket_index(67));
+    XTESTS_TEST_INTEGER_EQUAL(49u, hg.bucket_index(68));
+
+    // the maximum value is recorded in the last bucket
+    XTESTS_TEST_INTEGER_EQUAL(hg.num_buckets() - 1, hg.bucket_index(~stlsoft::ss_uint64_t(0)));
+    XTESTS_TEST_INTEGER_EQUAL(~stlsoft::ss_uint64_t(0), hg.bucket_highest_value(hg.num_buckets() - 1));
+
+    // every value is within its bucket's bounds
+    for (stlsoft::ss_uint64_t v = 1; v < 100000000000u; v = v * 3 + 1)
+    {
+        stlsoft::ss_size_t const index = hg.bucket_index(v);
+
+        XTESTS_TEST_INTEGER_LESS_OR_EQUAL(v, hg.bucket_lowest_value(index));
+        XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(v, hg.bucket_highest_value(index));
+    }
+}
+
+static void TEST_hdrgram_QUANTILES_UNIFORM()
+{
+    stlsoft::hdrgram hg;
+
+    for (stlsoft::ss_uint64_t i = 1; i <= 100000; ++i)
+    {
+        hg.push_event_time_ns(i);
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(100000, hg.event_count());
+    XTESTS_TEST_INTEGER_EQUAL(1, hg.value_at_quantile(0.0));
+    XTESTS_TEST_INTEGER_EQUAL(100000, hg.value_at_quantile(1.0));
+
+    // within the resolution of 1/128
+
+    XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(50000, hg.value_at_percentile(50.0));
+    XTESTS_TEST_INTEGER_LESS_OR_EQUAL(50000 + 50000 / 128, hg.value_at_percentile(50.0));
+    XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(99000, hg.value_at_percentile(99.0));
+    XTESTS_TEST_INTEGER_LESS_OR_EQUAL(99000 + 99000 / 128, hg.value_at_percentile(99.0));
+    XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(99900, hg.value_at_percentile(99.9));
+    XTESTS_TEST_INTEGER_LESS_OR_EQUAL(100000, hg.value_at_percentile(99.9));
+}
+
+static void TEST_hdrgram_QUANTILES_WITHIN_ONE_DECADE()
+{
+    // 990 events at 1.5ms, 9 at 4ms, 1 at 9ms: p99 and p99.9 lie in the
+    // same decimal order of magnitude, but are distinguished
+
+    stlsoft::hdrgram hg;
+
+    for (int i = 0; i != 990; ++i)
+    {
+        hg.push_event_time_us(1500);
+    }
+    for (int i = 0; i != 9; ++i)
+    {
+        hg.push_event_time_us(4000);
+    }
+    hg.push_event_time_us(9000);
+
+    stlsoft::ss_uint64_t const p50  = hg.value_at_percentile(50.0);
+    stlsoft::ss_uint64_t const p99  = hg.value_at_percentile(99.0);
+    stlsoft::ss_uint64_t const p999 = hg.value_at_percentile(99.9);
+
+    XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(1500000, p50);
+    XTESTS_TEST_INTEGER_LESS(1500000 + 1500000 / 64, p50);
+    XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(1500000, p99);
+    XTESTS_TEST_INTEGER_LESS(1500000 + 1500000 / 64, p99);
+    XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(4000000, p999);
+    XTESTS_TEST_INTEGER_LESS(4000000 + 4000000 / 64, p999);
+    XTESTS_TEST_INTEGER_EQUAL(9000000, hg.value_at_percentile(100.0));
+}
+
+static void TEST_hdrgram_MERGE()
+{
+    stlsoft::hdrgram        hg1;
+    stlsoft::hdrgram        hg2;
+    stlsoft::ss_uint64_t    min_event_time_ns;
+    stlsoft::ss_uint64_t    max_event_time_ns;
+
+    for (stlsoft::ss_uint64_t i = 1; i <= 1000; ++i)
+    {
+        hg1.push_event_time_ns(i);
+        hg2.push_event_time_ns(1000 + i);
+    }
+
+    XTESTS_TEST_BOOLEAN_TRUE(hg1.merge(hg2));
+
+    XTESTS_TEST_INTEGER_EQUAL(2000, hg1.event_count());
+    XTESTS_TEST_INTEGER_EQUAL(2001000, hg1.total_event_time_ns_raw());
+    XTESTS_TEST_BOOLEAN_TRUE(hg1.try_get_min_event_time_ns(&min_event_time_ns));
+    XTESTS_TEST_INTEGER_EQUAL(1, min_event_time_ns);
+    XTESTS_TEST_BOOLEAN_TRUE(hg1.try_get_max_event_time_ns(&max_event_time_ns));
+    XTESTS_TEST_INTEGER_EQUAL(2000, max_event_time_ns);
+    XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(1000, hg1.value_at_quantile(0.5));
+    XTESTS_TEST_INTEGER_LESS_OR_EQUAL(1000 + 1000 / 128, hg1.value_at_quantile(0.5));
+}
+
+static void TEST_hdrgram_MERGE_DIFFERENT_RESOLUTIONS()
+{
+#ifdef NDEBUG
+
+    stlsoft::hdrgram    hg1(7);
+    stlsoft::hdrgram    hg2(5);
+
+    hg2.push_event_time_ns(10);
+
+    XTESTS_TEST_BOOLEAN_FALSE(hg1.merge(hg2));
+    XTESTS_TEST_INTEGER_EQUAL(0, hg1.event_count());
+#else /* ? NDEBUG */
+
+    XTESTS_TEST_PASSED();
+#endif /* NDEBUG */
+}
+
+static void TEST_hdrgram_CLEAR()
+{
+    stlsoft::hdrgram        hg;
+    stlsoft::ss_uint64_t    min_event_time_ns;
+
+    hg.push_event_time_s(2);
+    hg.clear();
+
+    XTESTS_TEST_INTEGER_EQUAL(0, hg.event_count());
+    XTESTS_TEST_INTEGER_EQUAL(0, hg.total_event_time_ns_raw());
+    XTESTS_TEST_BOOLEAN_FALSE(hg.try_get_min_event_time_ns(&min_event_time_ns));
+    XTESTS_TEST_INTEGER_EQUAL(0, hg.num_events_in_bucket(hg.bucket_index(2000000000)));
+}
+
+static void TEST_hdrgram_WITH_gram_scope()
+{
+    platformstl::stopwatch  sw;
+    stlsoft::hdrgram        hg;
+
+    {
+        stlsoft::gram_scope<stlsoft::hdrgram, platformstl::stopwatch> scope(hg, sw);
+
+        platformstl::micro_sleep(10000);
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(1, hg.event_count());
+    XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(10000000, hg.total_event_time_ns_raw());
+    XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(10000000, hg.value_at_percentile(50.0));
+}
+
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
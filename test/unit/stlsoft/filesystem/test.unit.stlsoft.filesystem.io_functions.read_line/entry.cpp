@@ -4,7 +4,7 @@
  * Purpose: Unit-test
  *
  * Created: 11th August 2008
- * Updated: 17th December 2024
+ * Updated: 16th October 2026
  *
  * ////////////////////////////////////////////////////////////////////// */
 
@@ -33,6 +33,7 @@
 #include <string>
 
 /* Standard C header files */
+#include <stdio.h>
 #include <stdlib.h>
 
 
@@ -352,6 +353,10 @@ namespace
     static void test_14_18(void);
     static void test_14_19(void);
 
+    // contiguous and FILE* forms
+    static void test_15_0(void);
+    static void test_15_1(void);
+
 } // anonymous namespace
 
 
@@ -662,6 +667,9 @@ int main(int argc, char *argv[])
         XTESTS_RUN_CASE(test_14_18);
         XTESTS_RUN_CASE(test_14_19);
 
+        XTESTS_RUN_CASE(test_15_0);
+        XTESTS_RUN_CASE(test_15_1);
+
         XTESTS_PRINT_RESULTS();
 
         XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
@@ -4692,6 +4700,97 @@ static void test_14_19()
 {
 }
 
+
+static void test_15_0()
+{
+    // every string of up to 7 characters from { 'a', '\r', '\n' } is read
+    // identically by the contiguous and the char-by-char implementations,
+    // for every combination of flags
+
+    static char const   alphabet[] = { 'a', '\r', '\n' };
+    size_t              numMismatches = 0;
+
+    for (size_t len = 0; len != 8; ++len)
+    {
+        size_t numStrings = 1;
+
+        for (size_t i = 0; i != len; ++i)
+        {
+            numStrings *= STLSOFT_NUM_ELEMENTS(alphabet);
+        }
+
+        for (size_t n = 0; n != numStrings; ++n)
+        {
+            std::string input;
+
+            for (size_t i = 0, v = n; i != len; ++i, v /= STLSOFT_NUM_ELEMENTS(alphabet))
+            {
+                input += alphabet[v % STLSOFT_NUM_ELEMENTS(alphabet)];
+            }
+
+            for (int f = 0; f != 8; ++f)
+            {
+                read_line_flags::flags_t const              flags = read_line_flags::flags_t(f);
+                stlsoft::readers::read_from_char_range      policy1(input.data(), input.data() + input.size());
+                read_from_iterator_range<char const*>       policy2(input.data(), input.data() + input.size());
+                std::string                                 line1;
+                std::string                                 line2;
+
+                for (;;)
+                {
+                    bool const r1 = read_line_from_policy(policy1, line1, flags);
+                    bool const r2 = read_line_from_policy(policy2, line2, flags);
+
+                    if (r1 != r2 ||
+                        line1 != line2)
+                    {
+                        ++numMismatches;
+
+                        break;
+                    }
+
+                    if (!r1)
+                    {
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, numMismatches);
+}
+
+static void test_15_1()
+{
+    FILE* const stm = ::tmpfile();
+
+    XTESTS_REQUIRE(XTESTS_TEST_POINTER_NOT_EQUAL(NULL, stm));
+
+    std::string const contents("abc\r\ndef\n\rghi\r\r\njkl");
+
+    ::fwrite(contents.data(), 1, contents.size(), stm);
+    ::rewind(stm);
+
+    std::string line;
+
+    XTESTS_TEST_BOOLEAN_TRUE(stlsoft::read_line(stm, line));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc", line);
+    XTESTS_TEST_BOOLEAN_TRUE(stlsoft::read_line(stm, line));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("def", line);
+    XTESTS_TEST_BOOLEAN_TRUE(stlsoft::read_line(stm, line));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", line);
+    XTESTS_TEST_BOOLEAN_TRUE(stlsoft::read_line(stm, line));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("ghi", line);
+    XTESTS_TEST_BOOLEAN_TRUE(stlsoft::read_line(stm, line));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", line);
+    XTESTS_TEST_BOOLEAN_TRUE(stlsoft::read_line(stm, line));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("jkl", line);
+    XTESTS_TEST_BOOLEAN_FALSE(stlsoft::read_line(stm, line));
+
+    ::fclose(stm);
+}
+
 } // anonymous namespace
 
 
@@ -0,0 +1,531 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.stlsoft.memory.arena_allocator/entry.cpp
+ *
+ * Purpose: Unit-tests for `stlsoft::arena_allocator` and
+ *          `stlsoft::monotonic_arena`.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* /////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/memory/arena_allocator.hpp>
+
+/* /////////////////////////////////////
+ * general includes
+ */
+
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/containers/pod_vector.hpp>
+#include <stlsoft/containers/unsorted_map.hpp>
+#include <stlsoft/memory/auto_buffer.hpp>
+#include <stlsoft/string/simple_string.hpp>
+#include <stlsoft/stlsoft.h>
+
+/* Standard C++ header files */
+#include <list>
+#include <vector>
+
+/* Standard C header files */
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_arena_initial_buffer(void);
+    static void test_arena_blocks(void);
+    static void test_arena_alignment(void);
+    static void test_arena_deallocate_last(void);
+    static void test_arena_release(void);
+    static void test_arena_huge_size(void);
+
+    static void test_scope_nesting(void);
+
+    static void test_alloc_0(void);
+    static void test_rebind_and_equality(void);
+
+    static void test_specialise_auto_buffer(void);
+    static void test_specialise_pod_vector(void);
+    static void test_specialise_simple_string(void);
+    static void test_specialise_unsorted_map(void);
+    static void test_specialise_list(void);
+    static void test_specialise_vector(void);
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char *argv[])
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.stlsoft.memory.arena_allocator", verbosity))
+    {
+        XTESTS_RUN_CASE(test_arena_initial_buffer);
+        XTESTS_RUN_CASE(test_arena_blocks);
+        XTESTS_RUN_CASE(test_arena_alignment);
+        XTESTS_RUN_CASE(test_arena_deallocate_last);
+        XTESTS_RUN_CASE(test_arena_release);
+        XTESTS_RUN_CASE(test_arena_huge_size);
+
+        XTESTS_RUN_CASE(test_scope_nesting);
+
+        XTESTS_RUN_CASE(test_alloc_0);
+        XTESTS_RUN_CASE(test_rebind_and_equality);
+
+        XTESTS_RUN_CASE(test_specialise_auto_buffer);
+        XTESTS_RUN_CASE(test_specialise_pod_vector);
+        XTESTS_RUN_CASE(test_specialise_simple_string);
+        XTESTS_RUN_CASE(test_specialise_unsorted_map);
+        XTESTS_RUN_CASE(test_specialise_list);
+        XTESTS_RUN_CASE(test_specialise_vector);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * utility functions
+ */
+
+namespace
+{
+
+    using stlsoft::ss_byte_t;
+    using stlsoft::ss_size_t;
+
+    typedef stlsoft::monotonic_arena                            arena_t;
+    typedef stlsoft::thread_scoped_resource<arena_t>            source_t;
+
+    bool
+    is_aligned(
+        void const* pv
+    ,   ss_size_t   alignment
+    )
+    {
+        return 0 == (reinterpret_cast<stlsoft::ss_uintptr_t>(pv) & (alignment - 1));
+    }
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+static void test_arena_initial_buffer(void)
+{
+    alignas(16) ss_byte_t   buffer[256];
+    arena_t                 arena(buffer, sizeof(buffer));
+
+    void* const p1 = arena.allocate(10);
+    void* const p2 = arena.allocate(20);
+
+    XTESTS_TEST_BOOLEAN_TRUE(arena.in_initial_buffer(p1));
+    XTESTS_TEST_BOOLEAN_TRUE(arena.in_initial_buffer(p2));
+    XTESTS_TEST_POINTER_NOT_EQUAL(p1, p2);
+    XTESTS_TEST_INTEGER_EQUAL(30u, arena.bytes_allocated());
+    XTESTS_TEST_INTEGER_EQUAL(0u, arena.num_blocks());
+
+    // the initial buffer is exhausted, so a heap block is allocated
+
+    void* const p3 = arena.allocate(sizeof(buffer));
+
+    XTESTS_TEST_BOOLEAN_FALSE(arena.in_initial_buffer(p3));
+    XTESTS_TEST_INTEGER_EQUAL(1u, arena.num_blocks());
+}
+
+static void test_arena_blocks(void)
+{
+    arena_t arena(128);
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, arena.num_blocks());
+
+    for (int i = 0; i != 1000; ++i)
+    {
+        ss_byte_t* const p = static_cast<ss_byte_t*>(arena.allocate(24));
+
+        ::memset(p, i & 0xff, 24);
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(24000u, arena.bytes_allocated());
+
+    // blocks double in size, so there are few of them
+
+    XTESTS_TEST_INTEGER_LESS_OR_EQUAL(10u, arena.num_blocks());
+
+    // an allocation larger than any block gets its own
+
+    void* const p = arena.allocate(1024 * 1024);
+
+    XTESTS_TEST_POINTER_NOT_EQUAL(NULL, p);
+    ::memset(p, 0, 1024 * 1024);
+}
+
+static void test_arena_alignment(void)
+{
+    arena_t arena;
+
+    for (int i = 0; i != 100; ++i)
+    {
+        arena.allocate(1 + (i % 7), 1);
+
+        XTESTS_TEST_BOOLEAN_TRUE(is_aligned(arena.allocate(8), arena_t::default_alignment));
+        XTESTS_TEST_BOOLEAN_TRUE(is_aligned(arena.allocate(8, 64), 64));
+    }
+
+    XTESTS_TEST_BOOLEAN_TRUE(is_aligned(arena.allocate(100000, 4096), 4096));
+}
+
+static void test_arena_deallocate_last(void)
+{
+    ss_byte_t   buffer[256];
+    arena_t     arena(buffer, sizeof(buffer));
+
+    void* const p1 = arena.allocate(16, 1);
+    void* const p2 = arena.allocate(16, 1);
+
+    // not the most recent, so not reclaimed
+
+    arena.deallocate(p1, 16);
+
+    XTESTS_TEST_INTEGER_EQUAL(32u, arena.bytes_allocated());
+
+    // the most recent, so reclaimed, and handed out again
+
+    arena.deallocate(p2, 16);
+
+    XTESTS_TEST_INTEGER_EQUAL(16u, arena.bytes_allocated());
+    XTESTS_TEST_POINTER_EQUAL(p2, arena.allocate(16, 1));
+
+    // size unknown, so not reclaimed
+
+    arena.deallocate(p2);
+
+    XTESTS_TEST_INTEGER_EQUAL(32u, arena.bytes_allocated());
+
+    arena.deallocate(NULL, 0);
+}
+
+static void test_arena_release(void)
+{
+    ss_byte_t   buffer[64];
+    arena_t     arena(buffer, sizeof(buffer), 256);
+
+    void* const p1 = arena.allocate(8);
+
+    for (int i = 0; i != 100; ++i)
+    {
+        arena.allocate(64);
+    }
+
+    XTESTS_TEST_INTEGER_GREATER(0u, arena.num_blocks());
+
+    arena.release();
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, arena.num_blocks());
+    XTESTS_TEST_INTEGER_EQUAL(0u, arena.bytes_allocated());
+
+    // allocation starts again from the initial buffer
+
+    XTESTS_TEST_POINTER_EQUAL(p1, arena.allocate(8));
+}
+
+static void test_arena_huge_size(void)
+{
+    // sizes that cannot be satisfied - because the block header and
+    // alignment would overflow them, or because they are too large for
+    // operator new (and for doubling of the block size) - are rejected,
+    // leaving the arena intact
+
+    ss_size_t const sizes[] =
+    {
+            ~ss_size_t(0)
+        ,   ~ss_size_t(0) - 1
+        ,   ~ss_size_t(0) - 8
+#ifndef __SANITIZE_ADDRESS__
+        // (AddressSanitizer treats such a request of operator new as fatal)
+        ,   ~ss_size_t(0) / 2 + 1
+#endif /* !__SANITIZE_ADDRESS__ */
+    };
+
+    arena_t arena;
+
+    void* const p1 = arena.allocate(8);
+
+    { for (size_t i = 0; i != STLSOFT_NUM_ELEMENTS(sizes); ++i)
+    {
+        bool threw = false;
+
+        try
+        {
+            arena.allocate(sizes[i]);
+        }
+        catch (std::bad_alloc&)
+        {
+            threw = true;
+        }
+
+        XTESTS_TEST_BOOLEAN_TRUE(threw);
+
+        threw = false;
+
+        try
+        {
+            arena.allocate(sizes[i], 4096);
+        }
+        catch (std::bad_alloc&)
+        {
+            threw = true;
+        }
+
+        XTESTS_TEST_BOOLEAN_TRUE(threw);
+    }}
+
+    XTESTS_TEST_INTEGER_EQUAL(1u, arena.num_blocks());
+    XTESTS_TEST_INTEGER_EQUAL(8u, arena.bytes_allocated());
+    XTESTS_TEST_POINTER_NOT_EQUAL(p1, arena.allocate(8));
+    XTESTS_TEST_INTEGER_EQUAL(1u, arena.num_blocks());
+}
+
+static void test_scope_nesting(void)
+{
+    XTESTS_TEST_BOOLEAN_FALSE(source_t::is_bound());
+
+    {
+        arena_t         outer;
+        source_t::scope scope1(outer);
+
+        XTESTS_TEST_BOOLEAN_TRUE(source_t::is_bound());
+        XTESTS_TEST_POINTER_EQUAL(&outer, &source_t::get());
+
+        {
+            arena_t         inner;
+            source_t::scope scope2(inner);
+
+            XTESTS_TEST_POINTER_EQUAL(&inner, &source_t::get());
+        }
+
+        XTESTS_TEST_POINTER_EQUAL(&outer, &source_t::get());
+
+        // a distinct tag is a distinct binding
+
+        struct other_tag {};
+
+        XTESTS_TEST_BOOLEAN_FALSE((stlsoft::thread_scoped_resource<arena_t, other_tag>::is_bound()));
+    }
+
+    XTESTS_TEST_BOOLEAN_FALSE(source_t::is_bound());
+}
+
+static void test_alloc_0(void)
+{
+    arena_t         arena;
+    source_t::scope scope(arena);
+
+    stlsoft::arena_allocator<int> ator;
+
+    int* const p1 = ator.allocate(0);
+    int* const p2 = ator.allocate(0);
+
+    XTESTS_TEST_POINTER_NOT_EQUAL(NULL, p1);
+    XTESTS_TEST_POINTER_NOT_EQUAL(p1, p2);
+
+    ator.deallocate(p2, 0);
+    ator.deallocate(p1, 0);
+}
+
+static void test_rebind_and_equality(void)
+{
+    typedef stlsoft::arena_allocator<int>                   int_ator_t;
+    typedef int_ator_t::rebind<double>::other               double_ator_t;
+    typedef stlsoft::arena_allocator<void>::rebind<int>::other
+                                                            void_rebound_ator_t;
+
+    arena_t         arena;
+    source_t::scope scope(arena);
+
+    int_ator_t const    a1;
+    double_ator_t const a2(a1);
+
+    XTESTS_TEST_BOOLEAN_TRUE(a1 == a2);
+    XTESTS_TEST_BOOLEAN_FALSE(a1 != a2);
+    XTESTS_TEST_BOOLEAN_TRUE(a1 == void_rebound_ator_t());
+
+    double_ator_t a3;
+
+    XTESTS_TEST_BOOLEAN_TRUE(is_aligned(a3.allocate(3), alignof(double)));
+}
+
+static void test_specialise_auto_buffer(void)
+{
+    typedef stlsoft::auto_buffer<int, 16, stlsoft::arena_allocator<int> > buffer_t;
+
+    arena_t         arena;
+    source_t::scope scope(arena);
+
+    {
+        buffer_t buffer(8);
+
+        XTESTS_TEST_INTEGER_EQUAL(0u, arena.bytes_allocated());
+
+        buffer.resize(1000);
+
+        XTESTS_TEST_INTEGER_EQUAL(1000u * sizeof(int), arena.bytes_allocated());
+
+        for (size_t i = 0; i != buffer.size(); ++i)
+        {
+            buffer[i] = static_cast<int>(i);
+        }
+
+        XTESTS_TEST_INTEGER_EQUAL(999, buffer[999]);
+    }
+
+    // as the buffer's only allocation, it is reclaimed on deallocation
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, arena.bytes_allocated());
+}
+
+static void test_specialise_pod_vector(void)
+{
+    typedef stlsoft::pod_vector<int, stlsoft::arena_allocator<int>, 16> vector_t;
+
+    ss_byte_t       buffer[1024];
+    arena_t         arena(buffer, sizeof(buffer));
+    source_t::scope scope(arena);
+
+    vector_t v;
+
+    for (int i = 0; i != 10000; ++i)
+    {
+        v.push_back(i);
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(10000u, v.size());
+    XTESTS_TEST_INTEGER_EQUAL(9999, v.back());
+    XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(10000u * sizeof(int), arena.bytes_allocated());
+}
+
+static void test_specialise_simple_string(void)
+{
+    typedef stlsoft::basic_simple_string<
+        char
+    ,   stlsoft::stlsoft_char_traits<char>
+    ,   stlsoft::arena_allocator<char>
+    >                                                       string_t;
+
+    arena_t         arena;
+    source_t::scope scope(arena);
+
+    string_t s("abc");
+
+    for (int i = 0; i != 100; ++i)
+    {
+        s += "defghijklmnopqrstuvwxyz";
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(3u + 100u * 23u, s.size());
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL_N("abcdefghij", s.c_str(), 10);
+    XTESTS_TEST_INTEGER_GREATER(0u, arena.bytes_allocated());
+
+    string_t const s2(s);
+
+    XTESTS_TEST_BOOLEAN_TRUE(s == s2);
+}
+
+static void test_specialise_unsorted_map(void)
+{
+    typedef stlsoft::unsorted_map<
+        int
+    ,   int
+    ,   std::less<int>
+    ,   stlsoft::arena_allocator<int>
+    >                                                       map_t;
+
+    arena_t         arena;
+    source_t::scope scope(arena);
+
+    {
+        map_t m;
+
+        for (int i = 0; i != 100; ++i)
+        {
+            m.push_back(i, i * i);
+        }
+
+        XTESTS_TEST_INTEGER_EQUAL(100u, m.size());
+        XTESTS_TEST_INTEGER_EQUAL(9, m[9].first);
+        XTESTS_TEST_INTEGER_EQUAL(81, m[9].second);
+    }
+
+    XTESTS_TEST_INTEGER_GREATER(0u, arena.bytes_allocated());
+}
+
+static void test_specialise_list(void)
+{
+    arena_t         arena;
+    source_t::scope scope(arena);
+
+    std::list<int, stlsoft::arena_allocator<int> > l;
+
+    for (int i = 0; i != 1000; ++i)
+    {
+        l.push_back(i);
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(1000u, l.size());
+    XTESTS_TEST_INTEGER_EQUAL(999, l.back());
+    XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(1000u * sizeof(int), arena.bytes_allocated());
+}
+
+static void test_specialise_vector(void)
+{
+    arena_t         arena;
+    source_t::scope scope(arena);
+
+    std::vector<double, stlsoft::arena_allocator<double> > v;
+
+    for (int i = 0; i != 1000; ++i)
+    {
+        v.push_back(i * 0.5);
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(1000u, v.size());
+    XTESTS_TEST_BOOLEAN_TRUE(499.5 == v.back());
+}
+
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,439 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.stlsoft.memory.counting_allocator_adaptor/entry.cpp
+ *
+ * Purpose: Unit-tests for `stlsoft::counting_allocator_adaptor`.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* /////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/memory/counting_allocator_adaptor.hpp>
+
+/* /////////////////////////////////////
+ * general includes
+ */
+
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/containers/pod_vector.hpp>
+#include <stlsoft/memory/malloc_allocator.hpp>
+#include <stlsoft/string/simple_string.hpp>
+#include <stlsoft/stlsoft.h>
+
+/* Standard C++ header files */
+#include <list>
+#include <thread>
+#include <vector>
+
+/* Standard C header files */
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_size_classes(void);
+    static void test_counters(void);
+    static void test_counters_unsized(void);
+    static void test_counters_clear(void);
+    static void test_concurrent_counters(void);
+
+    static void test_allocate_deallocate(void);
+    static void test_tags_are_independent(void);
+    static void test_rebind_shares_counters(void);
+    static void test_wraps_stlsoft_allocator(void);
+
+    static void test_specialise_pod_vector(void);
+    static void test_specialise_simple_string(void);
+    static void test_specialise_list(void);
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char *argv[])
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.stlsoft.memory.counting_allocator_adaptor", verbosity))
+    {
+        XTESTS_RUN_CASE(test_size_classes);
+        XTESTS_RUN_CASE(test_counters);
+        XTESTS_RUN_CASE(test_counters_unsized);
+        XTESTS_RUN_CASE(test_counters_clear);
+        XTESTS_RUN_CASE(test_concurrent_counters);
+
+        XTESTS_RUN_CASE(test_allocate_deallocate);
+        XTESTS_RUN_CASE(test_tags_are_independent);
+        XTESTS_RUN_CASE(test_rebind_shares_counters);
+        XTESTS_RUN_CASE(test_wraps_stlsoft_allocator);
+
+        XTESTS_RUN_CASE(test_specialise_pod_vector);
+        XTESTS_RUN_CASE(test_specialise_simple_string);
+        XTESTS_RUN_CASE(test_specialise_list);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * utility functions
+ */
+
+namespace
+{
+
+    using stlsoft::ss_size_t;
+
+    typedef stlsoft::allocation_profile                     profile_t;
+
+    struct tag_allocate_deallocate;
+    struct tag_a;
+    struct tag_b;
+    struct tag_rebind;
+    struct tag_malloc;
+    struct tag_pod_vector;
+    struct tag_simple_string;
+    struct tag_list;
+
+    ss_size_t
+    sum_of_size_classes(
+        profile_t const& profile
+    )
+    {
+        ss_size_t n = 0;
+
+        for (int i = 0; i != profile_t::num_size_classes; ++i)
+        {
+            n += profile.num_allocations_in_size_class[i];
+        }
+
+        return n;
+    }
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+static void test_size_classes(void)
+{
+    XTESTS_TEST_INTEGER_EQUAL(0, profile_t::size_class_of(0));
+    XTESTS_TEST_INTEGER_EQUAL(1, profile_t::size_class_of(1));
+    XTESTS_TEST_INTEGER_EQUAL(2, profile_t::size_class_of(2));
+    XTESTS_TEST_INTEGER_EQUAL(2, profile_t::size_class_of(3));
+    XTESTS_TEST_INTEGER_EQUAL(3, profile_t::size_class_of(4));
+    XTESTS_TEST_INTEGER_EQUAL(7, profile_t::size_class_of(127));
+    XTESTS_TEST_INTEGER_EQUAL(8, profile_t::size_class_of(128));
+    XTESTS_TEST_INTEGER_EQUAL(profile_t::num_size_classes - 1, profile_t::size_class_of(~ss_size_t(0)));
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, profile_t::size_class_lower_bound(0));
+    XTESTS_TEST_INTEGER_EQUAL(1u, profile_t::size_class_lower_bound(1));
+    XTESTS_TEST_INTEGER_EQUAL(128u, profile_t::size_class_lower_bound(8));
+
+    for (int i = 1; i != profile_t::num_size_classes; ++i)
+    {
+        XTESTS_TEST_INTEGER_EQUAL(i, profile_t::size_class_of(profile_t::size_class_lower_bound(i)));
+        XTESTS_TEST_INTEGER_EQUAL(i - 1, profile_t::size_class_of(profile_t::size_class_lower_bound(i) - 1));
+    }
+}
+
+static void test_counters(void)
+{
+    stlsoft::counting_allocator_counters counters;
+
+    counters.on_allocate(100);
+    counters.on_allocate(10);
+    counters.on_deallocate(100);
+    counters.on_allocate(50);
+
+    profile_t const profile = counters.profile();
+
+    XTESTS_TEST_INTEGER_EQUAL(3u, profile.num_allocations);
+    XTESTS_TEST_INTEGER_EQUAL(1u, profile.num_deallocations);
+    XTESTS_TEST_INTEGER_EQUAL(0u, profile.num_unsized_deallocations);
+    XTESTS_TEST_INTEGER_EQUAL(160u, profile.bytes_allocated);
+    XTESTS_TEST_INTEGER_EQUAL(60u, profile.bytes_in_flight);
+    XTESTS_TEST_INTEGER_EQUAL(110u, profile.peak_bytes_in_flight);
+
+    XTESTS_TEST_INTEGER_EQUAL(1u, profile.num_allocations_in_size_class[profile_t::size_class_of(10)]);
+    XTESTS_TEST_INTEGER_EQUAL(1u, profile.num_allocations_in_size_class[profile_t::size_class_of(50)]);
+    XTESTS_TEST_INTEGER_EQUAL(1u, profile.num_allocations_in_size_class[profile_t::size_class_of(100)]);
+    XTESTS_TEST_INTEGER_EQUAL(3u, sum_of_size_classes(profile));
+}
+
+static void test_counters_unsized(void)
+{
+    stlsoft::counting_allocator_counters counters;
+
+    counters.on_allocate(64);
+    counters.on_deallocate(0);
+
+    profile_t const profile = counters.profile();
+
+    XTESTS_TEST_INTEGER_EQUAL(1u, profile.num_deallocations);
+    XTESTS_TEST_INTEGER_EQUAL(1u, profile.num_unsized_deallocations);
+    XTESTS_TEST_INTEGER_EQUAL(64u, profile.bytes_in_flight);
+}
+
+static void test_counters_clear(void)
+{
+    stlsoft::counting_allocator_counters counters;
+
+    counters.on_allocate(64);
+    counters.clear();
+
+    profile_t const profile = counters.profile();
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, profile.num_allocations);
+    XTESTS_TEST_INTEGER_EQUAL(0u, profile.bytes_allocated);
+    XTESTS_TEST_INTEGER_EQUAL(0u, profile.peak_bytes_in_flight);
+    XTESTS_TEST_INTEGER_EQUAL(0u, sum_of_size_classes(profile));
+}
+
+static void test_concurrent_counters(void)
+{
+    stlsoft::concurrent_counting_allocator_counters counters;
+    std::vector<std::thread>                        threads;
+
+    for (int t = 0; t != 4; ++t)
+    {
+        threads.push_back(std::thread([&counters]() {
+
+            for (int i = 0; i != 10000; ++i)
+            {
+                counters.on_allocate(8);
+                counters.on_deallocate(8);
+            }
+        }));
+    }
+
+    for (ss_size_t i = 0; i != threads.size(); ++i)
+    {
+        threads[i].join();
+    }
+
+    profile_t const profile = counters.profile();
+
+    XTESTS_TEST_INTEGER_EQUAL(40000u, profile.num_allocations);
+    XTESTS_TEST_INTEGER_EQUAL(40000u, profile.num_deallocations);
+    XTESTS_TEST_INTEGER_EQUAL(320000u, profile.bytes_allocated);
+    XTESTS_TEST_INTEGER_EQUAL(0u, profile.bytes_in_flight);
+    XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(8u, profile.peak_bytes_in_flight);
+    XTESTS_TEST_INTEGER_LESS_OR_EQUAL(32u, profile.peak_bytes_in_flight);
+    XTESTS_TEST_INTEGER_EQUAL(40000u, profile.num_allocations_in_size_class[profile_t::size_class_of(8)]);
+}
+
+static void test_allocate_deallocate(void)
+{
+    typedef stlsoft::counting_allocator_adaptor<
+        std::allocator<double>
+    ,   tag_allocate_deallocate
+    >                                                       ator_t;
+
+    ator_t ator;
+
+    double* const p1 = ator.allocate(10);
+    double* const p2 = ator.allocate(1);
+
+    {
+        profile_t const profile = ator_t::counters().profile();
+
+        XTESTS_TEST_INTEGER_EQUAL(2u, profile.num_allocations);
+        XTESTS_TEST_INTEGER_EQUAL(11 * sizeof(double), profile.bytes_in_flight);
+    }
+
+    ator.deallocate(p1, 10);
+    ator.deallocate(p2, 1);
+
+    {
+        profile_t const profile = ator_t::counters().profile();
+
+        XTESTS_TEST_INTEGER_EQUAL(2u, profile.num_deallocations);
+        XTESTS_TEST_INTEGER_EQUAL(0u, profile.bytes_in_flight);
+        XTESTS_TEST_INTEGER_EQUAL(11 * sizeof(double), profile.peak_bytes_in_flight);
+    }
+}
+
+static void test_tags_are_independent(void)
+{
+    typedef stlsoft::counting_allocator_adaptor<std::allocator<int>, tag_a> ator_a_t;
+    typedef stlsoft::counting_allocator_adaptor<std::allocator<int>, tag_b> ator_b_t;
+
+    ator_a_t    ator_a;
+    int* const  p = ator_a.allocate(4);
+
+    XTESTS_TEST_INTEGER_EQUAL(1u, ator_a_t::counters().profile().num_allocations);
+    XTESTS_TEST_INTEGER_EQUAL(0u, ator_b_t::counters().profile().num_allocations);
+
+    ator_a.deallocate(p, 4);
+}
+
+static void test_rebind_shares_counters(void)
+{
+    typedef stlsoft::counting_allocator_adaptor<std::allocator<int>, tag_rebind>   int_ator_t;
+    typedef int_ator_t::rebind<double>::other                                       dbl_ator_t;
+
+    int_ator_t  ai;
+    dbl_ator_t  ad(ai);
+
+    XTESTS_TEST_BOOLEAN_TRUE(ai == ad);
+    XTESTS_TEST_BOOLEAN_FALSE(ai != ad);
+    XTESTS_TEST_POINTER_EQUAL(&int_ator_t::counters(), &dbl_ator_t::counters());
+
+    double* const p = ad.allocate(2);
+
+    XTESTS_TEST_INTEGER_EQUAL(2 * sizeof(double), int_ator_t::counters().profile().bytes_in_flight);
+
+    ad.deallocate(p, 2);
+}
+
+static void test_wraps_stlsoft_allocator(void)
+{
+    typedef stlsoft::counting_allocator_adaptor<
+        stlsoft::malloc_allocator<char>
+    ,   tag_malloc
+    >                                                       ator_t;
+
+    ator_t      ator;
+    char* const p = ator.allocate(100);
+
+    XTESTS_TEST_INTEGER_EQUAL(100u, ator_t::counters().profile().bytes_in_flight);
+
+    ator.deallocate(p, 100);
+
+    profile_t const profile = ator_t::counters().profile();
+
+    XTESTS_TEST_INTEGER_EQUAL(1u, profile.num_deallocations);
+    XTESTS_TEST_INTEGER_EQUAL(0u, profile.num_unsized_deallocations);
+    XTESTS_TEST_INTEGER_EQUAL(0u, profile.bytes_in_flight);
+}
+
+static void test_specialise_pod_vector(void)
+{
+    typedef stlsoft::counting_allocator_adaptor<
+        std::allocator<int>
+    ,   tag_pod_vector
+    >                                                       ator_t;
+
+    {
+        stlsoft::pod_vector<int, ator_t, 16> v;
+
+        for (int i = 0; i != 16; ++i)
+        {
+            v.push_back(i);
+        }
+
+        // within the internal buffer, so nothing allocated
+
+        XTESTS_TEST_INTEGER_EQUAL(0u, ator_t::counters().profile().num_allocations);
+
+        for (int i = 16; i != 1000; ++i)
+        {
+            v.push_back(i);
+        }
+
+        profile_t const profile = ator_t::counters().profile();
+
+        XTESTS_TEST_INTEGER_GREATER(0u, profile.num_allocations);
+        XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(1000 * sizeof(int), profile.bytes_in_flight);
+        XTESTS_TEST_INTEGER_EQUAL(profile.num_allocations, sum_of_size_classes(profile));
+    }
+
+    profile_t const profile = ator_t::counters().profile();
+
+    XTESTS_TEST_INTEGER_EQUAL(profile.num_allocations, profile.num_deallocations);
+    XTESTS_TEST_INTEGER_EQUAL(0u, profile.num_unsized_deallocations);
+    XTESTS_TEST_INTEGER_EQUAL(0u, profile.bytes_in_flight);
+}
+
+static void test_specialise_simple_string(void)
+{
+    typedef stlsoft::counting_allocator_adaptor<
+        std::allocator<char>
+    ,   tag_simple_string
+    >                                                       ator_t;
+    typedef stlsoft::basic_simple_string<
+        char
+    ,   stlsoft::stlsoft_char_traits<char>
+    ,   ator_t
+    >                                                       string_t;
+
+    {
+        string_t s1("abc");
+        string_t s2(s1);
+
+        s1.append(200, 'x');
+
+        XTESTS_TEST_INTEGER_EQUAL(203u, s1.size());
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc", s2);
+        XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(1u, ator_t::counters().profile().num_allocations);
+    }
+
+    profile_t const profile = ator_t::counters().profile();
+
+    XTESTS_TEST_INTEGER_EQUAL(profile.num_allocations, profile.num_deallocations);
+    XTESTS_TEST_INTEGER_EQUAL(0u, profile.num_unsized_deallocations);
+    XTESTS_TEST_INTEGER_EQUAL(0u, profile.bytes_in_flight);
+    XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(203u, profile.peak_bytes_in_flight);
+}
+
+static void test_specialise_list(void)
+{
+    typedef stlsoft::counting_allocator_adaptor<
+        std::allocator<int>
+    ,   tag_list
+    ,   stlsoft::concurrent_counting_allocator_counters
+    >                                                       ator_t;
+
+    {
+        std::list<int, ator_t> l;
+
+        for (int i = 0; i != 100; ++i)
+        {
+            l.push_back(i);
+        }
+
+        XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(100u, ator_t::counters().profile().num_allocations);
+    }
+
+    profile_t const profile = ator_t::counters().profile();
+
+    XTESTS_TEST_INTEGER_EQUAL(profile.num_allocations, profile.num_deallocations);
+    XTESTS_TEST_INTEGER_EQUAL(0u, profile.bytes_in_flight);
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
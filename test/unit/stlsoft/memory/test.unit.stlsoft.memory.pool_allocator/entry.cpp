@@ -0,0 +1,404 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.stlsoft.memory.pool_allocator/entry.cpp
+ *
+ * Purpose: Unit-tests for `stlsoft::pool_allocator` and
+ *          `stlsoft::fixed_size_pool`.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* /////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/memory/pool_allocator.hpp>
+
+/* /////////////////////////////////////
+ * general includes
+ */
+
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/memory/auto_buffer.hpp>
+#include <stlsoft/stlsoft.h>
+
+/* Standard C++ header files */
+#include <functional>
+#include <list>
+#include <map>
+#include <vector>
+
+/* Standard C header files */
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_pool_node_size(void);
+    static void test_pool_reuse(void);
+    static void test_pool_chunks(void);
+    static void test_pool_owns(void);
+    static void test_pool_release(void);
+
+    static void test_small_and_large(void);
+    static void test_deallocate_without_size(void);
+    static void test_rebind_and_equality(void);
+
+    static void test_specialise_auto_buffer(void);
+    static void test_specialise_list(void);
+    static void test_specialise_map(void);
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char *argv[])
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.stlsoft.memory.pool_allocator", verbosity))
+    {
+        XTESTS_RUN_CASE(test_pool_node_size);
+        XTESTS_RUN_CASE(test_pool_reuse);
+        XTESTS_RUN_CASE(test_pool_chunks);
+        XTESTS_RUN_CASE(test_pool_owns);
+        XTESTS_RUN_CASE(test_pool_release);
+
+        XTESTS_RUN_CASE(test_small_and_large);
+        XTESTS_RUN_CASE(test_deallocate_without_size);
+        XTESTS_RUN_CASE(test_rebind_and_equality);
+
+        XTESTS_RUN_CASE(test_specialise_auto_buffer);
+        XTESTS_RUN_CASE(test_specialise_list);
+        XTESTS_RUN_CASE(test_specialise_map);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * utility functions
+ */
+
+namespace
+{
+
+    using stlsoft::ss_byte_t;
+    using stlsoft::ss_size_t;
+
+    typedef stlsoft::fixed_size_pool                            pool_t;
+    typedef stlsoft::thread_scoped_resource<pool_t>             source_t;
+
+    bool
+    is_aligned(
+        void const* pv
+    ,   ss_size_t   alignment
+    )
+    {
+        return 0 == (reinterpret_cast<stlsoft::ss_uintptr_t>(pv) & (alignment - 1));
+    }
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+static void test_pool_node_size(void)
+{
+    pool_t pool1(1);
+    pool_t pool2(pool_t::alignment + 1);
+
+    XTESTS_TEST_INTEGER_EQUAL(pool_t::alignment, pool1.node_size());
+    XTESTS_TEST_INTEGER_EQUAL(2 * pool_t::alignment, pool2.node_size());
+
+    for (int i = 0; i != 100; ++i)
+    {
+        XTESTS_TEST_BOOLEAN_TRUE(is_aligned(pool2.allocate(), pool_t::alignment));
+    }
+}
+
+static void test_pool_reuse(void)
+{
+    pool_t pool(24);
+
+    void* const p1 = pool.allocate();
+    void* const p2 = pool.allocate();
+
+    XTESTS_TEST_POINTER_NOT_EQUAL(p1, p2);
+    XTESTS_TEST_INTEGER_EQUAL(2u, pool.num_allocated());
+
+    // freed nodes are handed out again, most recently freed first
+
+    pool.deallocate(p1);
+    pool.deallocate(p2);
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, pool.num_allocated());
+    XTESTS_TEST_POINTER_EQUAL(p2, pool.allocate());
+    XTESTS_TEST_POINTER_EQUAL(p1, pool.allocate());
+    XTESTS_TEST_INTEGER_EQUAL(1u, pool.num_chunks());
+
+    pool.deallocate(NULL);
+
+    XTESTS_TEST_INTEGER_EQUAL(2u, pool.num_allocated());
+}
+
+static void test_pool_chunks(void)
+{
+    pool_t              pool(16, 4);
+    std::vector<void*>  nodes;
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, pool.num_chunks());
+
+    for (int i = 0; i != 1000; ++i)
+    {
+        void* const p = pool.allocate();
+
+        ::memset(p, i & 0xff, 16);
+
+        nodes.push_back(p);
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(1000u, pool.num_allocated());
+
+    // chunks double in size, so there are few of them
+
+    XTESTS_TEST_INTEGER_LESS_OR_EQUAL(10u, pool.num_chunks());
+
+    for (ss_size_t i = 0; i != nodes.size(); ++i)
+    {
+        XTESTS_TEST_INTEGER_EQUAL(int(i & 0xff), *static_cast<ss_byte_t*>(nodes[i]));
+
+        pool.deallocate(nodes[i]);
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, pool.num_allocated());
+}
+
+static void test_pool_owns(void)
+{
+    pool_t  pool1(32, 8);
+    pool_t  pool2(32, 8);
+    int     i;
+
+    void* const p1 = pool1.allocate();
+    void* const p2 = pool2.allocate();
+
+    XTESTS_TEST_BOOLEAN_TRUE(pool1.owns(p1));
+    XTESTS_TEST_BOOLEAN_FALSE(pool1.owns(p2));
+    XTESTS_TEST_BOOLEAN_FALSE(pool2.owns(p1));
+    XTESTS_TEST_BOOLEAN_TRUE(pool2.owns(p2));
+    XTESTS_TEST_BOOLEAN_FALSE(pool1.owns(&i));
+}
+
+static void test_pool_release(void)
+{
+    pool_t pool(8, 8);
+
+    for (int i = 0; i != 100; ++i)
+    {
+        pool.allocate();
+    }
+
+    XTESTS_TEST_INTEGER_GREATER(1u, pool.num_chunks());
+
+    pool.release();
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, pool.num_chunks());
+    XTESTS_TEST_INTEGER_EQUAL(0u, pool.num_allocated());
+
+    void* const p = pool.allocate();
+
+    XTESTS_TEST_BOOLEAN_TRUE(pool.owns(p));
+    XTESTS_TEST_INTEGER_EQUAL(1u, pool.num_chunks());
+}
+
+static void test_small_and_large(void)
+{
+    pool_t              pool(sizeof(double) * 4);
+    source_t::scope     scope(pool);
+
+    stlsoft::pool_allocator<double> ator;
+
+    // requests that fit in a node come from the pool ...
+
+    double* const p1 = ator.allocate(4);
+
+    XTESTS_TEST_BOOLEAN_TRUE(pool.owns(p1));
+    XTESTS_TEST_INTEGER_EQUAL(1u, pool.num_allocated());
+
+    // ... and larger ones from the free store
+
+    double* const p2 = ator.allocate(100);
+
+    XTESTS_TEST_BOOLEAN_FALSE(pool.owns(p2));
+    XTESTS_TEST_INTEGER_EQUAL(1u, pool.num_allocated());
+
+    p2[99] = 1.0;
+
+    ator.deallocate(p2, 100);
+    ator.deallocate(p1, 4);
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, pool.num_allocated());
+}
+
+static void test_deallocate_without_size(void)
+{
+    pool_t              pool(64);
+    source_t::scope     scope(pool);
+
+    stlsoft::pool_allocator<char> ator;
+
+    char* const p1 = ator.allocate(10);
+    char* const p2 = ator.allocate(1000);
+
+    XTESTS_TEST_INTEGER_EQUAL(1u, pool.num_allocated());
+
+    // without the size, ownership decides where the memory goes back to
+
+    ator.deallocate(p1);
+    ator.deallocate(p2);
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, pool.num_allocated());
+}
+
+static void test_rebind_and_equality(void)
+{
+    typedef stlsoft::pool_allocator<int>                        int_ator_t;
+    typedef int_ator_t::rebind<double>::other                   dbl_ator_t;
+    typedef stlsoft::pool_allocator<void>::rebind<int>::other   void_ator_t;
+
+    int_ator_t  ai;
+    dbl_ator_t  ad(ai);
+    void_ator_t av;
+
+    XTESTS_TEST_BOOLEAN_TRUE(ai == ad);
+    XTESTS_TEST_BOOLEAN_FALSE(ai != av);
+}
+
+static void test_specialise_auto_buffer(void)
+{
+    pool_t              pool(sizeof(int) * 64);
+    source_t::scope     scope(pool);
+
+    {
+        stlsoft::auto_buffer<int, 16, stlsoft::pool_allocator<int> > buff(8);
+
+        XTESTS_TEST_INTEGER_EQUAL(0u, pool.num_allocated());
+
+        buff.resize(64);
+
+        XTESTS_TEST_INTEGER_EQUAL(1u, pool.num_allocated());
+
+        buff.resize(1000);
+
+        XTESTS_TEST_INTEGER_EQUAL(0u, pool.num_allocated());
+
+        buff[999] = 999;
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, pool.num_allocated());
+}
+
+static void test_specialise_list(void)
+{
+    pool_t              pool(64);
+    source_t::scope     scope(pool);
+
+    {
+        std::list<int, stlsoft::pool_allocator<int> > l;
+
+        for (int i = 0; i != 1000; ++i)
+        {
+            l.push_back(i);
+        }
+
+        XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(1000u, pool.num_allocated());
+
+        l.clear();
+
+        XTESTS_TEST_INTEGER_LESS_OR_EQUAL(1u, pool.num_allocated());
+
+        // the nodes are recycled, so no new chunks are needed
+
+        ss_size_t const numChunks = pool.num_chunks();
+
+        for (int i = 0; i != 1000; ++i)
+        {
+            l.push_front(i);
+        }
+
+        XTESTS_TEST_INTEGER_EQUAL(numChunks, pool.num_chunks());
+        XTESTS_TEST_INTEGER_EQUAL(999, l.front());
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, pool.num_allocated());
+}
+
+static void test_specialise_map(void)
+{
+    typedef std::map<
+        int
+    ,   int
+    ,   std::less<int>
+    ,   stlsoft::pool_allocator<std::pair<int const, int> >
+    >                                                           map_t;
+
+    pool_t              pool(64);
+    source_t::scope     scope(pool);
+
+    {
+        map_t m;
+
+        for (int i = 0; i != 500; ++i)
+        {
+            m[i] = i * i;
+        }
+
+        XTESTS_TEST_INTEGER_EQUAL(500u, m.size());
+        XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(500u, pool.num_allocated());
+        XTESTS_TEST_INTEGER_EQUAL(400, m[20]);
+
+        for (int i = 0; i != 500; i += 2)
+        {
+            m.erase(i);
+        }
+
+        XTESTS_TEST_INTEGER_EQUAL(250u, m.size());
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, pool.num_allocated());
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
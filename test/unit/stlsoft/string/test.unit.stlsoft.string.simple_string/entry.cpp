@@ -4,7 +4,7 @@
  * Purpose: Unit-tests for `stlsoft::basic_simple_string`.
  *
  * Created: 4th November 2008
- * Updated: 17th December 2024
+ * Updated: 16th October 2026
  *
  * ////////////////////////////////////////////////////////////////////// */
 
@@ -220,6 +220,16 @@ namespace
     static void test_string_access_shims(void);
 
 
+    // small-string optimisation
+
+#ifndef USE_std_string
+    static void test_sso_boundaries(void);
+    static void test_sso_reserve_and_shrink(void);
+    static void test_sso_swap(void);
+    static void test_sso_move(void);
+    static void test_sso_self_append_and_assign(void);
+#endif /* !USE_std_string */
+
 
 } // anonymous namespace
 
@@ -394,6 +404,16 @@ int main(int argc, char* argv[])
         XTESTS_RUN_CASE(test_string_access_shims);
 
 
+        // small-string optimisation
+
+#ifndef USE_std_string
+        XTESTS_RUN_CASE(test_sso_boundaries);
+        XTESTS_RUN_CASE(test_sso_reserve_and_shrink);
+        XTESTS_RUN_CASE(test_sso_swap);
+        XTESTS_RUN_CASE(test_sso_move);
+        XTESTS_RUN_CASE(test_sso_self_append_and_assign);
+#endif /* !USE_std_string */
+
         XTESTS_PRINT_RESULTS();
 
         XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
@@ -418,6 +438,49 @@ namespace
 #endif /* !USE_std_string */
     using stlsoft::ss_size_t;
 
+#ifndef USE_std_string
+
+    // The longest string held in the instance's internal buffer
+    template <typename C>
+    ss_size_t
+    max_internal_length()
+    {
+        ss_size_t const n = STLSOFT_SIMPLE_STRING_INTERNAL_BYTES / sizeof(C);
+
+        return (n < 2 ? 2 : n) - 1;
+    }
+
+    // Indicates whether the string's contents are held within the
+    // instance, rather than on the heap
+    template <typename S>
+    bool
+    is_internal(
+        S const& s
+    )
+    {
+        stlsoft::ss_uintptr_t const p = reinterpret_cast<stlsoft::ss_uintptr_t>(s.c_str());
+        stlsoft::ss_uintptr_t const b = reinterpret_cast<stlsoft::ss_uintptr_t>(&s);
+
+        return p >= b && p < b + sizeof(S);
+    }
+
+    // "abcd...", so that misplaced characters are detected
+    std::string
+    make_alphabet(
+        ss_size_t n
+    )
+    {
+        std::string r;
+
+        { for (ss_size_t i = 0; i != n; ++i)
+        {
+            r += static_cast<char>('a' + i % 26);
+        }}
+
+        return r;
+    }
+#endif /* !USE_std_string */
+
 
     struct SimpleStream
     {
@@ -3998,6 +4061,392 @@ static void test_string_access_shims()
 
 }
 
+
+// small-string optimisation
+
+#ifndef USE_std_string
+
+static void test_sso_boundaries()
+{
+    ss_size_t const N = max_internal_length<char>();
+
+    // construction and copying, either side of the internal capacity
+
+    { for (ss_size_t n = N - 1; n != N + 3; ++n)
+    {
+        std::string const   expected = make_alphabet(n);
+        string_t const      s1(expected.c_str());
+        string_t const      s2(expected.c_str(), n);
+        string_t const      s3(s1);
+
+        XTESTS_TEST_INTEGER_EQUAL(n, s1.size());
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL(expected, s1);
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL(expected, s2);
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL(expected, s3);
+        XTESTS_TEST_BOOLEAN_EQUAL(n <= N, is_internal(s1));
+        XTESTS_TEST_BOOLEAN_EQUAL(n <= N, is_internal(s2));
+        XTESTS_TEST_BOOLEAN_EQUAL(n <= N, is_internal(s3));
+        XTESTS_TEST_INTEGER_GREATER(n, s1.capacity());
+
+        if (n <= N)
+        {
+            XTESTS_TEST_INTEGER_EQUAL(N + 1, s1.capacity());
+        }
+    }}
+
+    // growth, one character at a time, out of the internal buffer
+
+    {
+        string_t    s;
+
+        { for (ss_size_t n = 1; n != N + 3; ++n)
+        {
+            s.push_back(static_cast<char>('a' + (n - 1) % 26));
+
+            XTESTS_TEST_MULTIBYTE_STRING_EQUAL(make_alphabet(n), s);
+            XTESTS_TEST_BOOLEAN_EQUAL(n <= N, is_internal(s));
+        }}
+    }
+
+    // appending exactly to, and then one past, the internal capacity
+
+    {
+        string_t    s(make_alphabet(N - 2).c_str());
+
+        s.append("yz");
+
+        XTESTS_TEST_INTEGER_EQUAL(N, s.size());
+        XTESTS_TEST_BOOLEAN_TRUE(is_internal(s));
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL(make_alphabet(N - 2) + "yz", s);
+
+        s.append(1, '!');
+
+        XTESTS_TEST_INTEGER_EQUAL(N + 1, s.size());
+        XTESTS_TEST_BOOLEAN_FALSE(is_internal(s));
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL(make_alphabet(N - 2) + "yz!", s);
+    }
+
+    // wide strings, whose internal capacity is smaller
+
+    {
+        ss_size_t const NW = max_internal_length<wchar_t>();
+
+        wstring_t const w1(NW, L'w');
+        wstring_t const w2(NW + 1, L'w');
+
+        XTESTS_TEST_BOOLEAN_TRUE(is_internal(w1));
+        XTESTS_TEST_WIDE_STRING_EQUAL(std::wstring(NW, L'w').c_str(), w1.c_str());
+        XTESTS_TEST_BOOLEAN_FALSE(is_internal(w2));
+        XTESTS_TEST_WIDE_STRING_EQUAL(std::wstring(NW + 1, L'w').c_str(), w2.c_str());
+    }
+}
+
+static void test_sso_reserve_and_shrink()
+{
+    ss_size_t const N = max_internal_length<char>();
+
+    // reserving within the internal buffer does not leave it
+
+    {
+        string_t    s;
+
+        s.reserve(N);
+
+        XTESTS_TEST_BOOLEAN_TRUE(is_internal(s));
+        XTESTS_TEST_INTEGER_EQUAL(0u, s.size());
+        XTESTS_TEST_INTEGER_EQUAL(N + 1, s.capacity());
+    }
+
+    {
+        string_t    s("abc");
+
+        s.reserve(N);
+
+        XTESTS_TEST_BOOLEAN_TRUE(is_internal(s));
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc", s);
+
+        // reserving past it moves the contents to the heap
+
+        s.reserve(N + 1);
+
+        XTESTS_TEST_BOOLEAN_FALSE(is_internal(s));
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc", s);
+        XTESTS_TEST_INTEGER_GREATER(N + 1, s.capacity());
+
+        // shrinking does not release the heap buffer ...
+
+        s.resize(2);
+
+        XTESTS_TEST_BOOLEAN_FALSE(is_internal(s));
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("ab", s);
+
+        // ... but a copy, or an assignment, of the shrunk string is held
+        // back in the internal buffer
+
+        string_t const  copy(s);
+        string_t        assigned;
+
+        assigned = s;
+
+        XTESTS_TEST_BOOLEAN_TRUE(is_internal(copy));
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("ab", copy);
+        XTESTS_TEST_BOOLEAN_TRUE(is_internal(assigned));
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("ab", assigned);
+
+        // as is the shrunk string itself, when swapped with a small one
+
+        string_t        other("xyz");
+
+        s.swap(other);
+
+        XTESTS_TEST_BOOLEAN_TRUE(is_internal(s));
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("xyz", s);
+        XTESTS_TEST_BOOLEAN_FALSE(is_internal(other));
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("ab", other);
+    }
+
+    // a heap string assigned short contents, and then grown again
+
+    {
+        string_t    s(make_alphabet(N + 10).c_str());
+
+        s.assign("xy");
+
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("xy", s);
+
+        s.append(make_alphabet(N + 10).c_str());
+
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("xy" + make_alphabet(N + 10), s);
+
+        s.clear();
+
+        XTESTS_TEST_BOOLEAN_TRUE(s.empty());
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", s);
+    }
+}
+
+static void test_sso_swap()
+{
+    ss_size_t const     N       =   max_internal_length<char>();
+    std::string const   small1  =   "abc";
+    std::string const   small2  =   make_alphabet(N);
+    std::string const   large1  =   make_alphabet(N + 1);
+    std::string const   large2  =   make_alphabet(N + 20);
+
+    // small and heap
+
+    {
+        string_t    s1(small1.c_str());
+        string_t    s2(large1.c_str());
+        char const* p2 = s2.c_str();
+
+        s1.swap(s2);
+
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL(large1, s1);
+        XTESTS_TEST_POINTER_EQUAL(p2, s1.c_str());
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL(small1, s2);
+        XTESTS_TEST_BOOLEAN_TRUE(is_internal(s2));
+
+        swap(s1, s2);
+
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL(small1, s1);
+        XTESTS_TEST_BOOLEAN_TRUE(is_internal(s1));
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL(large1, s2);
+        XTESTS_TEST_POINTER_EQUAL(p2, s2.c_str());
+
+        // each remains independent of the other
+
+        s1.append("!");
+        s2.append("?");
+
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL(small1 + "!", s1);
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL(large1 + "?", s2);
+    }
+
+    // small and small
+
+    {
+        string_t    s1(small1.c_str());
+        string_t    s2(small2.c_str());
+
+        s1.swap(s2);
+
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL(small2, s1);
+        XTESTS_TEST_BOOLEAN_TRUE(is_internal(s1));
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL(small1, s2);
+        XTESTS_TEST_BOOLEAN_TRUE(is_internal(s2));
+    }
+
+    // heap and heap
+
+    {
+        string_t    s1(large1.c_str());
+        string_t    s2(large2.c_str());
+        char const* p1 = s1.c_str();
+        char const* p2 = s2.c_str();
+
+        s1.swap(s2);
+
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL(large2, s1);
+        XTESTS_TEST_POINTER_EQUAL(p2, s1.c_str());
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL(large1, s2);
+        XTESTS_TEST_POINTER_EQUAL(p1, s2.c_str());
+    }
+
+    // empty (without a buffer) and small
+
+    {
+        string_t    s1;
+        string_t    s2(small1.c_str());
+
+        s1.swap(s2);
+
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL(small1, s1);
+        XTESTS_TEST_BOOLEAN_TRUE(is_internal(s1));
+        XTESTS_TEST_BOOLEAN_TRUE(s2.empty());
+    }
+
+    // self
+
+    {
+        string_t    s(small1.c_str());
+
+        s.swap(s);
+
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL(small1, s);
+        XTESTS_TEST_BOOLEAN_TRUE(is_internal(s));
+    }
+}
+
+static void test_sso_move()
+{
+#ifdef STLSOFT_CF_RVALUE_REFERENCES_SUPPORT
+
+    ss_size_t const N = max_internal_length<char>();
+
+    // small: the contents are moved into the new instance
+
+    {
+        std::string const   expected = make_alphabet(N);
+        string_t            s1(expected.c_str());
+        string_t            s2(std::move(s1));
+
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL(expected, s2);
+        XTESTS_TEST_BOOLEAN_TRUE(is_internal(s2));
+        XTESTS_TEST_BOOLEAN_TRUE(s1.empty());
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", s1);
+
+        s1 = "reused";
+
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("reused", s1);
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL(expected, s2);
+    }
+
+    // heap: the buffer is taken by the new instance
+
+    {
+        std::string const   expected = make_alphabet(N + 1);
+        string_t            s1(expected.c_str());
+        char const* const   p1 = s1.c_str();
+        string_t            s2(std::move(s1));
+
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL(expected, s2);
+        XTESTS_TEST_POINTER_EQUAL(p1, s2.c_str());
+        XTESTS_TEST_BOOLEAN_TRUE(s1.empty());
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", s1);
+    }
+#endif /* STLSOFT_CF_RVALUE_REFERENCES_SUPPORT */
+}
+
+static void test_sso_self_append_and_assign()
+{
+    ss_size_t const N = max_internal_length<char>();
+
+    // appending itself, remaining small
+
+    {
+        string_t    s("abc");
+
+        s.append(s);
+
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abcabc", s);
+        XTESTS_TEST_BOOLEAN_TRUE(is_internal(s));
+    }
+
+    // appending itself, so leaving the internal buffer from which the
+    // appended characters are read
+
+    {
+        std::string const   expected = make_alphabet(N - 3);
+        string_t            s(expected.c_str());
+
+        s.append(s);
+
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL(expected + expected, s);
+        XTESTS_TEST_BOOLEAN_FALSE(is_internal(s));
+    }
+
+    // appending a substring of itself, either side of the boundary
+
+    {
+        string_t    s(make_alphabet(N - 1).c_str());
+
+        s.append(s.c_str() + 1, 1);
+
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL(make_alphabet(N - 1) + "b", s);
+        XTESTS_TEST_BOOLEAN_TRUE(is_internal(s));
+
+        s.append(s, 2, 3);
+
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL(make_alphabet(N - 1) + "bcde", s);
+        XTESTS_TEST_BOOLEAN_FALSE(is_internal(s));
+    }
+
+    // assigning a substring of itself, small and heap
+
+    {
+        string_t    s(make_alphabet(N).c_str());
+
+        s.assign(s, 1, 4);
+
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("bcde", s);
+        XTESTS_TEST_BOOLEAN_TRUE(is_internal(s));
+
+        s.assign(s.c_str() + 2, 2);
+
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("de", s);
+    }
+
+    {
+        string_t    s(make_alphabet(N + 4).c_str());
+
+        s.assign(s, 2, 5);
+
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("cdefg", s);
+
+        s.assign(s.c_str() + 1);
+
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("defg", s);
+    }
+
+    // assigning itself
+
+    {
+        string_t    s(make_alphabet(N).c_str());
+        string_t&   r = s;
+
+        s = r;
+
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL(make_alphabet(N), s);
+        XTESTS_TEST_BOOLEAN_TRUE(is_internal(s));
+
+        s.assign(r.c_str());
+
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL(make_alphabet(N), s);
+    }
+}
+#endif /* !USE_std_string */
+
 } // anonymous namespace
 
 
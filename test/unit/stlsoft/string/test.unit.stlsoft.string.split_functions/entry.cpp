@@ -0,0 +1,496 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.stlsoft.string.split_functions/entry.cpp
+ *
+ * Purpose: Unit-tests for `stlsoft::split()`, `stlsoft::split_fields()`,
+ *          and `stlsoft::split_csv_fields()`.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/string/split_functions.hpp>
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+#include <stlsoft/collections/array_view.hpp>
+#include <stlsoft/string/string_view.hpp>
+
+/* Standard C++ header files */
+#include <string>
+#include <vector>
+
+/* Standard C header files */
+#include <stdlib.h>
+#include <string.h>
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_split_6(void);
+    static void test_fields_empty(void);
+    static void test_fields_like_split_6(void);
+    static void test_fields_remainder(void);
+    static void test_fields_unmodified_beyond_count(void);
+    static void test_fields_array_view(void);
+    static void test_fields_strings(void);
+    static void test_fields_wide(void);
+    static void test_fields_against_reference(void);
+    static void test_csv_unquoted(void);
+    static void test_csv_quoted(void);
+    static void test_csv_doubled_quotes(void);
+    static void test_csv_remainder(void);
+    static void test_csv_wide(void);
+    static void test_csv_against_reference(void);
+
+} // anonymous namespace
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char *argv[])
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.stlsoft.string.split_functions", verbosity))
+    {
+        XTESTS_RUN_CASE(test_split_6);
+        XTESTS_RUN_CASE(test_fields_empty);
+        XTESTS_RUN_CASE(test_fields_like_split_6);
+        XTESTS_RUN_CASE(test_fields_remainder);
+        XTESTS_RUN_CASE(test_fields_unmodified_beyond_count);
+        XTESTS_RUN_CASE(test_fields_array_view);
+        XTESTS_RUN_CASE(test_fields_strings);
+        XTESTS_RUN_CASE(test_fields_wide);
+        XTESTS_RUN_CASE(test_fields_against_reference);
+        XTESTS_RUN_CASE(test_csv_unquoted);
+        XTESTS_RUN_CASE(test_csv_quoted);
+        XTESTS_RUN_CASE(test_csv_doubled_quotes);
+        XTESTS_RUN_CASE(test_csv_remainder);
+        XTESTS_RUN_CASE(test_csv_wide);
+        XTESTS_RUN_CASE(test_csv_against_reference);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+    using stlsoft::split;
+    using stlsoft::split_csv_fields;
+    using stlsoft::split_fields;
+    using stlsoft::string_view;
+    using stlsoft::wstring_view;
+
+    typedef std::vector<std::string>                        strings_t;
+
+    // the fields, and the remainder, of splitting at each delimiter, up to
+    // the given number
+    strings_t
+    reference_split(
+        std::string const&  s
+    ,   char                delim
+    ,   size_t              maxFields
+    )
+    {
+        strings_t   r;
+        size_t      f = 0;
+
+        if (s.empty())
+        {
+            return r;
+        }
+
+        for (size_t i = 0; i != s.size() && r.size() + 1 != maxFields; ++i)
+        {
+            if (delim == s[i])
+            {
+                r.push_back(s.substr(f, i - f));
+
+                f = i + 1;
+            }
+        }
+
+        r.push_back(s.substr(f));
+
+        return r;
+    }
+
+    std::string
+    reference_csv_field(
+        std::string const& s
+    )
+    {
+        if (s.size() >= 2 &&
+            '"' == s[0] &&
+            '"' == s[s.size() - 1])
+        {
+            return s.substr(1, s.size() - 2);
+        }
+
+        return s;
+    }
+
+    strings_t
+    reference_csv_split(
+        std::string const&  s
+    ,   char                delim
+    ,   size_t              maxFields
+    )
+    {
+        strings_t   r;
+        size_t      f           =   0;
+        bool        inQuotes    =   false;
+
+        if (s.empty())
+        {
+            return r;
+        }
+
+        for (size_t i = 0; i != s.size() && r.size() + 1 != maxFields; ++i)
+        {
+            if ('"' == s[i])
+            {
+                inQuotes = !inQuotes;
+            }
+            else
+            if (delim == s[i] &&
+                !inQuotes)
+            {
+                r.push_back(reference_csv_field(s.substr(f, i - f)));
+
+                f = i + 1;
+            }
+        }
+
+        r.push_back(reference_csv_field(s.substr(f)));
+
+        return r;
+    }
+
+    strings_t
+    to_strings(
+        string_view const*  fields
+    ,   size_t              n
+    )
+    {
+        strings_t r;
+
+        for (size_t i = 0; i != n; ++i)
+        {
+            r.push_back(std::string(fields[i].data(), fields[i].size()));
+        }
+
+        return r;
+    }
+
+    std::string
+    make_line(
+        size_t      len
+    ,   char        delim
+    ,   unsigned    seed
+    ,   bool        quoting
+    )
+    {
+        std::string s;
+        unsigned    r = seed;
+
+        for (size_t i = 0; i != len; ++i)
+        {
+            r = r * 1103515245 + 12345;
+
+            switch ((r >> 16) % 11)
+            {
+            case 0:
+            case 1:
+                s += delim;
+                break;
+            case 2:
+                s += quoting ? '"' : 'q';
+                break;
+            default:
+                s += static_cast<char>('a' + (r >> 8) % 26);
+                break;
+            }
+        }
+
+        return s;
+    }
+
+
+static void test_split_6()
+{
+    std::string s0, s1, s2, s3, s4, s5;
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, split(std::string(""), ',', s0, s1, s2, s3, s4, s5));
+
+    XTESTS_TEST_INTEGER_EQUAL(2u, split(std::string("a,"), ',', s0, s1, s2, s3, s4, s5));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("a", s0);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", s1);
+
+    XTESTS_TEST_INTEGER_EQUAL(6u, split(std::string("a,b,c,d,e,f,g"), ',', s0, s1, s2, s3, s4, s5));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("a", s0);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("e", s4);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("f,g", s5);
+
+    XTESTS_TEST_INTEGER_EQUAL(6u, split(std::string(",,,,,,,"), ',', s0, s1, s2, s3, s4, s5));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", s0);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL(",,", s5);
+
+    std::wstring w0, w1, w2;
+
+    XTESTS_TEST_INTEGER_EQUAL(3u, split(std::wstring(L"ab|cd|ef|gh"), L'|', w0, w1, w2));
+    XTESTS_TEST_WIDE_STRING_EQUAL(L"ab", w0);
+    XTESTS_TEST_WIDE_STRING_EQUAL(L"cd", w1);
+    XTESTS_TEST_WIDE_STRING_EQUAL(L"ef|gh", w2);
+}
+
+static void test_fields_empty()
+{
+    string_view fields[4];
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, split_fields("", 0, ',', fields, 4));
+    XTESTS_TEST_INTEGER_EQUAL(0u, split_fields(std::string(), ',', fields));
+    XTESTS_TEST_INTEGER_EQUAL(0u, split_fields("a,b", 3, ',', fields, 0));
+}
+
+static void test_fields_like_split_6()
+{
+    static char const* const inputs[] =
+    {
+        "",
+        "a",
+        "a,",
+        "a,b",
+        "a,b,c,d,e",
+        "a,b,c,d,e,",
+        "a,b,c,d,e,f",
+        "a,b,c,d,e,f,",
+        "a,b,c,d,e,f,g",
+        ",",
+        ",,,,,",
+        ",,,,,,,,",
+    };
+
+    { for (size_t i = 0; i != STLSOFT_NUM_ELEMENTS(inputs); ++i)
+    {
+        std::string const   s(inputs[i]);
+        std::string         s0, s1, s2, s3, s4, s5;
+        string_view         fields[6];
+        unsigned const      n0 = split(s, ',', s0, s1, s2, s3, s4, s5);
+        size_t const        n1 = split_fields(s, ',', fields);
+        std::string const   expected[6] = { s0, s1, s2, s3, s4, s5 };
+
+        XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(n0, n1));
+
+        { for (size_t j = 0; j != n1; ++j)
+        {
+            XTESTS_TEST_MULTIBYTE_STRING_EQUAL(expected[j], std::string(fields[j].data(), fields[j].size()));
+        }}
+    }}
+}
+
+static void test_fields_remainder()
+{
+    char const  s[] = "2026-10-16,INFO,accepted,10.0.0.1,443,GET,/api/v1/items,200";
+    string_view fields[3];
+    size_t const n = split_fields(s, ::strlen(s), ',', &fields[0], 3);
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(3u, n));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("2026-10-16", std::string(fields[0].data(), fields[0].size()));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("INFO", std::string(fields[1].data(), fields[1].size()));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("accepted,10.0.0.1,443,GET,/api/v1/items,200", std::string(fields[2].data(), fields[2].size()));
+
+    // the fields refer into the source
+    XTESTS_TEST_POINTER_EQUAL(&s[0], fields[0].data());
+    XTESTS_TEST_POINTER_EQUAL(&s[11], fields[1].data());
+
+    string_view one[1];
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(1u, split_fields(s, ',', one)));
+    XTESTS_TEST_INTEGER_EQUAL(::strlen(s), one[0].size());
+}
+
+static void test_fields_unmodified_beyond_count()
+{
+    string_view fields[5];
+
+    fields[2] = "x";
+    fields[3] = "y";
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(2u, split_fields(std::string("a;b"), ';', fields)));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("x", std::string(fields[2].data(), fields[2].size()));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("y", std::string(fields[3].data(), fields[3].size()));
+}
+
+static void test_fields_array_view()
+{
+    std::string const           s("abcdefghijklmnopqrstuvwxyz|0123456789|ABCDEFGHIJKLMNOPQRSTUVWXYZ|");
+    std::vector<string_view>    v(8);
+    size_t const                n = split_fields(s, '|', stlsoft::make_array_view(&v[0], v.size()));
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(4u, n));
+    XTESTS_TEST_INTEGER_EQUAL(26u, v[0].size());
+    XTESTS_TEST_INTEGER_EQUAL(10u, v[1].size());
+    XTESTS_TEST_INTEGER_EQUAL(26u, v[2].size());
+    XTESTS_TEST_INTEGER_EQUAL(0u, v[3].size());
+    XTESTS_TEST_POINTER_EQUAL(s.data() + 38, v[2].data());
+}
+
+static void test_fields_strings()
+{
+    std::string fields[3];
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(3u, split_fields(std::string("abc def  ghi"), ' ', fields)));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc", fields[0]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("def", fields[1]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL(" ghi", fields[2]);
+}
+
+static void test_fields_wide()
+{
+    std::wstring const  s(L"abcdefghijklmnopqrstuvwxyz,0123456789,,XYZ");
+    wstring_view        fields[6];
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(4u, split_fields(s, L',', fields)));
+    XTESTS_TEST_WIDE_STRING_EQUAL(L"abcdefghijklmnopqrstuvwxyz", std::wstring(fields[0].data(), fields[0].size()));
+    XTESTS_TEST_WIDE_STRING_EQUAL(L"0123456789", std::wstring(fields[1].data(), fields[1].size()));
+    XTESTS_TEST_WIDE_STRING_EQUAL(L"", std::wstring(fields[2].data(), fields[2].size()));
+    XTESTS_TEST_WIDE_STRING_EQUAL(L"XYZ", std::wstring(fields[3].data(), fields[3].size()));
+}
+
+static void test_fields_against_reference()
+{
+    // lengths either side of, and well beyond, the sixteen-character blocks
+    static size_t const lengths[] = { 1, 2, 15, 16, 17, 31, 32, 33, 100, 1000 };
+    static size_t const maxima[] = { 1, 2, 3, 7, 64, 1000 };
+
+    std::vector<string_view> fields(1000);
+
+    { for (size_t i = 0; i != STLSOFT_NUM_ELEMENTS(lengths); ++i)
+    {
+        { for (size_t j = 0; j != STLSOFT_NUM_ELEMENTS(maxima); ++j)
+        {
+            { for (unsigned seed = 1; seed != 8; ++seed)
+            {
+                std::string const   s = make_line(lengths[i], ',', seed, false);
+                strings_t const     expected = reference_split(s, ',', maxima[j]);
+                size_t const        n = split_fields(s.data(), s.size(), ',', &fields[0], maxima[j]);
+
+                XTESTS_TEST_BOOLEAN_TRUE(expected == to_strings(&fields[0], n));
+            }}
+        }}
+    }}
+}
+
+static void test_csv_unquoted()
+{
+    std::string const   s("a,,c");
+    string_view         fields[8];
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, split_csv_fields(std::string(), ',', fields));
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(3u, split_csv_fields(s, ',', fields)));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("a", std::string(fields[0].data(), fields[0].size()));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", std::string(fields[1].data(), fields[1].size()));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("c", std::string(fields[2].data(), fields[2].size()));
+}
+
+static void test_csv_quoted()
+{
+    std::string const   s("\"Wilson, Matthew\",\"\",42,\"a long field that spans blocks, with commas, in it\",x");
+    string_view         fields[8];
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(5u, split_csv_fields(s, ',', fields)));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("Wilson, Matthew", std::string(fields[0].data(), fields[0].size()));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", std::string(fields[1].data(), fields[1].size()));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("42", std::string(fields[2].data(), fields[2].size()));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("a long field that spans blocks, with commas, in it", std::string(fields[3].data(), fields[3].size()));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("x", std::string(fields[4].data(), fields[4].size()));
+}
+
+static void test_csv_doubled_quotes()
+{
+    std::string const   s("\"say \"\"hi\"\", then go\",b");
+    string_view         fields[4];
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(2u, split_csv_fields(s, ',', fields)));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("say \"\"hi\"\", then go", std::string(fields[0].data(), fields[0].size()));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("b", std::string(fields[1].data(), fields[1].size()));
+}
+
+static void test_csv_remainder()
+{
+    std::string const   s("a,\"b,c\",d,e");
+    string_view         fields[2];
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(2u, split_csv_fields(s, ',', fields)));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("a", std::string(fields[0].data(), fields[0].size()));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("\"b,c\",d,e", std::string(fields[1].data(), fields[1].size()));
+}
+
+static void test_csv_wide()
+{
+    std::wstring const  s(L"\"a;b\";c;\"\"");
+    wstring_view        fields[4];
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(3u, split_csv_fields(s, L';', fields)));
+    XTESTS_TEST_WIDE_STRING_EQUAL(L"a;b", std::wstring(fields[0].data(), fields[0].size()));
+    XTESTS_TEST_WIDE_STRING_EQUAL(L"c", std::wstring(fields[1].data(), fields[1].size()));
+    XTESTS_TEST_WIDE_STRING_EQUAL(L"", std::wstring(fields[2].data(), fields[2].size()));
+}
+
+static void test_csv_against_reference()
+{
+    static size_t const lengths[] = { 1, 2, 15, 16, 17, 31, 32, 33, 100, 1000 };
+    static size_t const maxima[] = { 1, 2, 3, 7, 64, 1000 };
+
+    std::vector<string_view> fields(1000);
+
+    { for (size_t i = 0; i != STLSOFT_NUM_ELEMENTS(lengths); ++i)
+    {
+        { for (size_t j = 0; j != STLSOFT_NUM_ELEMENTS(maxima); ++j)
+        {
+            { for (unsigned seed = 1; seed != 8; ++seed)
+            {
+                std::string const   s = make_line(lengths[i], ',', seed, true);
+                strings_t const     expected = reference_csv_split(s, ',', maxima[j]);
+                size_t const        n = split_csv_fields(s.data(), s.size(), ',', &fields[0], maxima[j]);
+
+                XTESTS_TEST_BOOLEAN_TRUE(expected == to_strings(&fields[0], n));
+            }}
+        }}
+    }}
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
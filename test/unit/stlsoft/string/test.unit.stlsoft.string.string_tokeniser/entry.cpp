@@ -0,0 +1,414 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.stlsoft.string.string_tokeniser/entry.cpp
+ *
+ * Purpose: Unit-tests for `stlsoft::string_tokeniser` and
+ *          `stlsoft::charset_tokeniser`.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/string/charset_tokeniser.hpp>
+#include <stlsoft/string/string_tokeniser.hpp>
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+#include <stlsoft/string/simple_string.hpp>
+#include <stlsoft/string/string_view.hpp>
+
+/* Standard C++ header files */
+#include <string>
+#include <vector>
+
+/* Standard C header files */
+#include <stdlib.h>
+#include <string.h>
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_char_delimiter_skip_blanks(void);
+    static void test_char_delimiter_preserve_blanks(void);
+    static void test_string_delimiter(void);
+    static void test_empty(void);
+    static void test_no_delimiters(void);
+    static void test_simple_string_long(void);
+    static void test_view_tokens_refer_to_source(void);
+    static void test_view_wide(void);
+    static void test_view_against_string(void);
+    static void test_charset_1(void);
+    static void test_charset_view(void);
+    static void test_charset_view_against_string(void);
+
+} // anonymous namespace
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char *argv[])
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.stlsoft.string.string_tokeniser", verbosity))
+    {
+        XTESTS_RUN_CASE(test_char_delimiter_skip_blanks);
+        XTESTS_RUN_CASE(test_char_delimiter_preserve_blanks);
+        XTESTS_RUN_CASE(test_string_delimiter);
+        XTESTS_RUN_CASE(test_empty);
+        XTESTS_RUN_CASE(test_no_delimiters);
+        XTESTS_RUN_CASE(test_simple_string_long);
+        XTESTS_RUN_CASE(test_view_tokens_refer_to_source);
+        XTESTS_RUN_CASE(test_view_wide);
+        XTESTS_RUN_CASE(test_view_against_string);
+        XTESTS_RUN_CASE(test_charset_1);
+        XTESTS_RUN_CASE(test_charset_view);
+        XTESTS_RUN_CASE(test_charset_view_against_string);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+    using stlsoft::charset_tokeniser;
+    using stlsoft::skip_blank_tokens;
+    using stlsoft::string_tokeniser;
+
+    typedef std::vector<std::string>                        strings_t;
+
+    template <ss_typename_param_k T_tokeniser>
+    strings_t
+    collect(
+        T_tokeniser const& tokens
+    )
+    {
+        strings_t r;
+
+        for (ss_typename_type_k T_tokeniser::const_iterator i = tokens.begin(); i != tokens.end(); ++i)
+        {
+            ss_typename_type_k T_tokeniser::value_type const token = *i;
+
+            r.push_back(std::string(token.data(), token.size()));
+        }
+
+        return r;
+    }
+
+    // Produces a string of words from a small alphabet - so that the
+    // delimiters fall at all offsets of a SIMD block - and separated by
+    // runs of one or more of the given separators.
+    std::string
+    make_text(
+        size_t      n
+    ,   char const* separators
+    ,   unsigned    seed
+    )
+    {
+        std::string     r;
+        size_t const    numSeparators = ::strlen(separators);
+
+        for (; r.size() < n; )
+        {
+            seed = seed * 1103515245u + 12345u;
+
+            size_t const wordLen = (seed >> 16) % 40;
+
+            for (size_t i = 0; i != wordLen; ++i)
+            {
+                r += static_cast<char>('a' + (i + seed) % 7);
+            }
+
+            seed = seed * 1103515245u + 12345u;
+
+            size_t const sepLen = 1 + (seed >> 16) % 3;
+
+            for (size_t i = 0; i != sepLen; ++i)
+            {
+                r += separators[(seed >> (8 + i)) % numSeparators];
+            }
+        }
+
+        return r;
+    }
+
+
+static void test_char_delimiter_skip_blanks()
+{
+    string_tokeniser<std::string, char> const   tokens(":abc::def:ghi:jkl::::::::::", ':');
+    strings_t const                             r = collect(tokens);
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(4u, r.size()));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc", r[0]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("def", r[1]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("ghi", r[2]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("jkl", r[3]);
+}
+
+static void test_char_delimiter_preserve_blanks()
+{
+    string_tokeniser<
+        std::string
+    ,   char
+    ,   skip_blank_tokens<false>
+    > const         tokens(":abc::def:ghi:jkl:", ':');
+    strings_t const r = collect(tokens);
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(6u, r.size()));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", r[0]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc", r[1]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", r[2]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("def", r[3]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("ghi", r[4]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("jkl", r[5]);
+}
+
+static void test_string_delimiter()
+{
+    string_tokeniser<std::string, std::string> const    tokens("\r\nabc\r\n\r\ndef\r\nghi\r\njkl\r\n\r\n", "\r\n");
+    strings_t const                                     r = collect(tokens);
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(4u, r.size()));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc", r[0]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("def", r[1]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("ghi", r[2]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("jkl", r[3]);
+}
+
+static void test_empty()
+{
+    {
+        string_tokeniser<std::string, char> const tokens("", ':');
+
+        XTESTS_TEST_BOOLEAN_TRUE(tokens.empty());
+    }
+
+    {
+        string_tokeniser<
+            stlsoft::string_view
+        ,   char
+        ,   skip_blank_tokens<true>
+        ,   stlsoft::string_view
+        > const tokens("", ':');
+
+        XTESTS_TEST_BOOLEAN_TRUE(tokens.empty());
+    }
+
+    {
+        string_tokeniser<
+            stlsoft::string_view
+        ,   char
+        ,   skip_blank_tokens<true>
+        ,   stlsoft::string_view
+        > const tokens("::::", ':');
+
+        XTESTS_TEST_BOOLEAN_TRUE(tokens.empty());
+    }
+}
+
+static void test_no_delimiters()
+{
+    std::string const   s(100, 'x');
+
+    string_tokeniser<
+        stlsoft::string_view
+    ,   char
+    ,   skip_blank_tokens<true>
+    ,   stlsoft::string_view
+    > const             tokens(s, ':');
+    strings_t const     r = collect(tokens);
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(1u, r.size()));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL(s, r[0]);
+}
+
+static void test_simple_string_long()
+{
+    std::string const   s = make_text(5000, ",", 1);
+
+    // std::string's iterators are not pointers, so this tokeniser tests
+    // each position with the comparator ...
+    strings_t const     expected = collect(string_tokeniser<std::string, char, skip_blank_tokens<false> >(s, ','));
+
+    // ... whereas basic_simple_string's are, so this one scans with memchr()
+    strings_t const     actual = collect(string_tokeniser<stlsoft::simple_string, char, skip_blank_tokens<false> >(s, ','));
+
+    XTESTS_TEST_BOOLEAN_TRUE(expected.size() > 100u);
+    XTESTS_TEST_BOOLEAN_TRUE(expected == actual);
+}
+
+static void test_view_tokens_refer_to_source()
+{
+    std::string const   s("abc:def::ghi");
+
+    typedef string_tokeniser<
+        stlsoft::string_view
+    ,   char
+    ,   skip_blank_tokens<true>
+    ,   stlsoft::string_view
+    >                   tokeniser_t;
+
+    tokeniser_t const               tokens(s, ':');
+    tokeniser_t::const_iterator     i = tokens.begin();
+
+    XTESTS_REQUIRE(XTESTS_TEST_BOOLEAN_TRUE(i != tokens.end()));
+    XTESTS_TEST_POINTER_EQUAL(s.data() + 0, (*i).data());
+    XTESTS_TEST_INTEGER_EQUAL(3u, (*i).size());
+
+    ++i;
+    XTESTS_REQUIRE(XTESTS_TEST_BOOLEAN_TRUE(i != tokens.end()));
+    XTESTS_TEST_POINTER_EQUAL(s.data() + 4, (*i).data());
+    XTESTS_TEST_INTEGER_EQUAL(3u, (*i).size());
+
+    ++i;
+    XTESTS_REQUIRE(XTESTS_TEST_BOOLEAN_TRUE(i != tokens.end()));
+    XTESTS_TEST_POINTER_EQUAL(s.data() + 9, (*i).data());
+    XTESTS_TEST_INTEGER_EQUAL(3u, (*i).size());
+
+    ++i;
+    XTESTS_TEST_BOOLEAN_TRUE(i == tokens.end());
+}
+
+static void test_view_wide()
+{
+    std::wstring const  s(L"|abc||def|ghi|jkl||||||||||");
+
+    typedef string_tokeniser<
+        stlsoft::wstring_view
+    ,   wchar_t
+    ,   skip_blank_tokens<true>
+    ,   stlsoft::wstring_view
+    >                   tokeniser_t;
+
+    tokeniser_t const           tokens(s, L'|');
+    std::vector<std::wstring>   r;
+
+    { for (tokeniser_t::const_iterator i = tokens.begin(); i != tokens.end(); ++i)
+    {
+        r.push_back(std::wstring((*i).data(), (*i).size()));
+    }}
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(4u, r.size()));
+    XTESTS_TEST_WIDE_STRING_EQUAL(L"abc", r[0]);
+    XTESTS_TEST_WIDE_STRING_EQUAL(L"def", r[1]);
+    XTESTS_TEST_WIDE_STRING_EQUAL(L"ghi", r[2]);
+    XTESTS_TEST_WIDE_STRING_EQUAL(L"jkl", r[3]);
+}
+
+static void test_view_against_string()
+{
+    { for (unsigned seed = 1; seed != 20; ++seed)
+    {
+        std::string const   s = make_text(2000 + seed * 7, "\n", seed);
+
+        strings_t const     e1 = collect(string_tokeniser<std::string, char, skip_blank_tokens<true> >(s, '\n'));
+        strings_t const     a1 = collect(string_tokeniser<stlsoft::string_view, char, skip_blank_tokens<true>, stlsoft::string_view>(s, '\n'));
+
+        XTESTS_TEST_BOOLEAN_TRUE(e1 == a1);
+
+        strings_t const     e2 = collect(string_tokeniser<std::string, char, skip_blank_tokens<false> >(s, '\n'));
+        strings_t const     a2 = collect(string_tokeniser<stlsoft::string_view, char, skip_blank_tokens<false>, stlsoft::string_view>(s, '\n'));
+
+        XTESTS_TEST_BOOLEAN_TRUE(e2 == a2);
+    }}
+}
+
+static void test_charset_1()
+{
+    charset_tokeniser<std::string> const    tokens(" \tabc, def;ghi ,, jkl\t", " \t,;");
+    strings_t const                         r = collect(tokens);
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(4u, r.size()));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc", r[0]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("def", r[1]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("ghi", r[2]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("jkl", r[3]);
+}
+
+static void test_charset_view()
+{
+    std::string const   s(" \tabc, def;ghi ,, jkl\t");
+
+    charset_tokeniser<
+        stlsoft::string_view
+    ,   skip_blank_tokens<false>
+    ,   stlsoft::string_view
+    > const             tokens(s, " \t,;");
+    strings_t const     r = collect(tokens);
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(10u, r.size()));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", r[0]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", r[1]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc", r[2]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", r[3]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("def", r[4]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("ghi", r[5]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", r[6]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", r[7]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", r[8]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("jkl", r[9]);
+}
+
+static void test_charset_view_against_string()
+{
+    // sets of sizes that exercise each of the single-character, SIMD and
+    // table searches of stlsoft_C_strnpbrkn()
+    static char const* const sets[] =
+    {
+        ",",
+        ",;",
+        " \t,;|",
+        " \t\r\n,;|:/\\!?",
+    };
+
+    { for (size_t i = 0; i != STLSOFT_NUM_ELEMENTS(sets); ++i)
+    {
+        { for (unsigned seed = 1; seed != 10; ++seed)
+        {
+            std::string const   s = make_text(3000 + seed * 13, sets[i], seed);
+
+            strings_t const     e1 = collect(charset_tokeniser<std::string>(s, sets[i]));
+            strings_t const     a1 = collect(charset_tokeniser<stlsoft::string_view, skip_blank_tokens<true>, stlsoft::string_view>(s, sets[i]));
+
+            XTESTS_TEST_BOOLEAN_TRUE(e1.size() > 50u);
+            XTESTS_TEST_BOOLEAN_TRUE(e1 == a1);
+
+            strings_t const     e2 = collect(charset_tokeniser<std::string, skip_blank_tokens<false> >(s, sets[i]));
+            strings_t const     a2 = collect(charset_tokeniser<stlsoft::string_view, skip_blank_tokens<false>, stlsoft::string_view>(s, sets[i]));
+
+            XTESTS_TEST_BOOLEAN_TRUE(e2 == a2);
+        }}
+    }}
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,389 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.stlsoft.string.strnstrn/entry.cpp
+ *
+ * Purpose: Unit-tests for `stlsoft_C_strnstrn()`, `stlsoft_C_strnistrn()`,
+ *          and `stlsoft::c_string::strnstrn_searcher`.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/string/c_string/strnistrn.h>
+#include <stlsoft/string/c_string/strnstrn.h>
+#include <stlsoft/string/c_string/strnstrn_searcher.h>
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+
+/* Standard C++ header files */
+#include <string>
+
+/* Standard C header files */
+#include <ctype.h>
+#include <stdlib.h>
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_strnstrn_empty_needle(void);
+    static void test_strnstrn_needle_longer_than_haystack(void);
+    static void test_strnstrn_single_character(void);
+    static void test_strnstrn_short_needles(void);
+    static void test_strnstrn_long_haystack(void);
+    static void test_strnstrn_long_needle(void);
+    static void test_strnstrn_slices(void);
+    static void test_strnistrn_short_needles(void);
+    static void test_strnistrn_long_haystack(void);
+    static void test_wcsnstrn_1(void);
+    static void test_wcsnistrn_1(void);
+    static void test_searcher_exact(void);
+    static void test_searcher_ignore_case(void);
+    static void test_searcher_against_naive(void);
+
+} // anonymous namespace
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char *argv[])
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.stlsoft.string.strnstrn", verbosity))
+    {
+        XTESTS_RUN_CASE(test_strnstrn_empty_needle);
+        XTESTS_RUN_CASE(test_strnstrn_needle_longer_than_haystack);
+        XTESTS_RUN_CASE(test_strnstrn_single_character);
+        XTESTS_RUN_CASE(test_strnstrn_short_needles);
+        XTESTS_RUN_CASE(test_strnstrn_long_haystack);
+        XTESTS_RUN_CASE(test_strnstrn_long_needle);
+        XTESTS_RUN_CASE(test_strnstrn_slices);
+        XTESTS_RUN_CASE(test_strnistrn_short_needles);
+        XTESTS_RUN_CASE(test_strnistrn_long_haystack);
+        XTESTS_RUN_CASE(test_wcsnstrn_1);
+        XTESTS_RUN_CASE(test_wcsnistrn_1);
+        XTESTS_RUN_CASE(test_searcher_exact);
+        XTESTS_RUN_CASE(test_searcher_ignore_case);
+        XTESTS_RUN_CASE(test_searcher_against_naive);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+    using stlsoft::c_string::strnstrn_searcher;
+
+    char const*
+    naive_find(
+        char const* s1
+    ,   size_t      n1
+    ,   char const* s2
+    ,   size_t      n2
+    ,   bool        ignoreCase
+    )
+    {
+        for (size_t i = 0; i + n2 <= n1; ++i)
+        {
+            size_t j = 0;
+
+            for (; j != n2; ++j)
+            {
+                int c1 = static_cast<unsigned char>(s1[i + j]);
+                int c2 = static_cast<unsigned char>(s2[j]);
+
+                if (ignoreCase)
+                {
+                    c1 = ::toupper(c1);
+                    c2 = ::toupper(c2);
+                }
+
+                if (c1 != c2)
+                {
+                    break;
+                }
+            }
+
+            if (j == n2)
+            {
+                return s1 + i;
+            }
+        }
+
+        return NULL;
+    }
+
+    // a long haystack, in which "needle" occurs once, at the given offset
+    std::string
+    make_haystack(
+        size_t              length
+    ,   size_t              offset
+    ,   std::string const&  needle
+    )
+    {
+        std::string s;
+
+        for (size_t i = 0; s.size() < length; ++i)
+        {
+            s += static_cast<char>('a' + i % 7);
+        }
+
+        s.replace(offset, needle.size(), needle);
+
+        return s;
+    }
+
+
+static void test_strnstrn_empty_needle()
+{
+    char const s1[] = "abc";
+
+    XTESTS_TEST_POINTER_EQUAL(s1, stlsoft_C_strnstrn(s1, 3, "", 0));
+    XTESTS_TEST_POINTER_EQUAL(s1, stlsoft_C_strnstrn(s1, 0, "", 0));
+    XTESTS_TEST_POINTER_EQUAL(s1, stlsoft_C_strnistrn(s1, 3, "", 0));
+}
+
+static void test_strnstrn_needle_longer_than_haystack()
+{
+    char const s1[] = "abc";
+
+    XTESTS_TEST_POINTER_EQUAL(NULL, stlsoft_C_strnstrn(s1, 3, "abcd", 4));
+    XTESTS_TEST_POINTER_EQUAL(NULL, stlsoft_C_strnstrn(s1, 2, "abc", 3));
+    XTESTS_TEST_POINTER_EQUAL(NULL, stlsoft_C_strnistrn(s1, 3, "ABCD", 4));
+}
+
+static void test_strnstrn_single_character()
+{
+    char const s1[] = "abcabc";
+
+    XTESTS_TEST_POINTER_EQUAL(s1 + 0, stlsoft_C_strnstrn(s1, 6, "a", 1));
+    XTESTS_TEST_POINTER_EQUAL(s1 + 2, stlsoft_C_strnstrn(s1, 6, "c", 1));
+    XTESTS_TEST_POINTER_EQUAL(NULL, stlsoft_C_strnstrn(s1, 6, "d", 1));
+    XTESTS_TEST_POINTER_EQUAL(NULL, stlsoft_C_strnstrn(s1, 2, "c", 1));
+    XTESTS_TEST_POINTER_EQUAL(s1 + 1, stlsoft_C_strnistrn(s1, 6, "B", 1));
+}
+
+static void test_strnstrn_short_needles()
+{
+    char const s1[] = "the quick brown fox jumps over the lazy dog";
+    size_t const n1 = STLSOFT_NUM_ELEMENTS(s1) - 1;
+
+    XTESTS_TEST_POINTER_EQUAL(s1 + 0, stlsoft_C_strnstrn(s1, n1, "th", 2));
+    XTESTS_TEST_POINTER_EQUAL(s1 + 4, stlsoft_C_strnstrn(s1, n1, "quick", 5));
+    XTESTS_TEST_POINTER_EQUAL(s1 + 16, stlsoft_C_strnstrn(s1, n1, "fox", 3));
+    XTESTS_TEST_POINTER_EQUAL(s1 + 40, stlsoft_C_strnstrn(s1, n1, "dog", 3));
+    XTESTS_TEST_POINTER_EQUAL(s1 + 0, stlsoft_C_strnstrn(s1, n1, s1, n1));
+    XTESTS_TEST_POINTER_EQUAL(NULL, stlsoft_C_strnstrn(s1, n1, "cat", 3));
+    XTESTS_TEST_POINTER_EQUAL(NULL, stlsoft_C_strnstrn(s1, n1, "Quick", 5));
+    XTESTS_TEST_POINTER_EQUAL(NULL, stlsoft_C_strnstrn(s1, n1, "dogs", 4));
+
+    // first and last characters match, middle does not
+    XTESTS_TEST_POINTER_EQUAL(NULL, stlsoft_C_strnstrn(s1, n1, "qxxxk", 5));
+}
+
+static void test_strnstrn_long_haystack()
+{
+    std::string const needle("needle");
+
+    { for (size_t offset = 0; offset < 4000; offset += 333)
+    {
+        std::string const s = make_haystack(4096, offset, needle);
+
+        XTESTS_TEST_POINTER_EQUAL(s.data() + offset, stlsoft_C_strnstrn(s.data(), s.size(), needle.data(), needle.size()));
+        XTESTS_TEST_POINTER_EQUAL(s.data() + offset, stlsoft_C_strnistrn(s.data(), s.size(), "NEEDLE", 6));
+    }}
+
+    {
+        std::string const s = make_haystack(4096, 4090, needle);
+
+        XTESTS_TEST_POINTER_EQUAL(s.data() + 4090, stlsoft_C_strnstrn(s.data(), s.size(), needle.data(), needle.size()));
+        XTESTS_TEST_POINTER_EQUAL(NULL, stlsoft_C_strnstrn(s.data(), s.size() - 1, needle.data(), needle.size()));
+    }
+}
+
+static void test_strnstrn_long_needle()
+{
+    std::string needle;
+
+    { for (size_t i = 0; i != 100; ++i)
+    {
+        needle += static_cast<char>('A' + i % 23);
+    }}
+
+    { for (size_t offset = 0; offset < 3900; offset += 487)
+    {
+        std::string const s = make_haystack(4096, offset, needle);
+
+        XTESTS_TEST_POINTER_EQUAL(s.data() + offset, stlsoft_C_strnstrn(s.data(), s.size(), needle.data(), needle.size()));
+    }}
+
+    {
+        std::string s = make_haystack(4096, 1000, needle);
+
+        s[1000 + 50] = '!';
+
+        XTESTS_TEST_POINTER_EQUAL(NULL, stlsoft_C_strnstrn(s.data(), s.size(), needle.data(), needle.size()));
+    }
+}
+
+static void test_strnstrn_slices()
+{
+    // neither string need be nul-terminated
+    char const s1[] = "abcdefabcdef";
+    char const s2[] = "defXYZ";
+
+    XTESTS_TEST_POINTER_EQUAL(s1 + 3, stlsoft_C_strnstrn(s1, 12, s2, 3));
+    XTESTS_TEST_POINTER_EQUAL(s1 + 9, stlsoft_C_strnstrn(s1 + 4, 8, s2, 3));
+    XTESTS_TEST_POINTER_EQUAL(NULL, stlsoft_C_strnstrn(s1 + 4, 7, s2, 3));
+}
+
+static void test_strnistrn_short_needles()
+{
+    char const s1[] = "The Quick Brown Fox";
+    size_t const n1 = STLSOFT_NUM_ELEMENTS(s1) - 1;
+
+    XTESTS_TEST_POINTER_EQUAL(s1 + 4, stlsoft_C_strnistrn(s1, n1, "quick", 5));
+    XTESTS_TEST_POINTER_EQUAL(s1 + 4, stlsoft_C_strnistrn(s1, n1, "QUICK", 5));
+    XTESTS_TEST_POINTER_EQUAL(s1 + 16, stlsoft_C_strnistrn(s1, n1, "fOx", 3));
+    XTESTS_TEST_POINTER_EQUAL(NULL, stlsoft_C_strnistrn(s1, n1, "qUiCx", 5));
+
+    // the first character alone matching does not make a match
+    XTESTS_TEST_POINTER_EQUAL(NULL, stlsoft_C_strnistrn(s1, n1, "tax", 3));
+}
+
+static void test_strnistrn_long_haystack()
+{
+    std::string needle;
+
+    { for (size_t i = 0; i != 100; ++i)
+    {
+        needle += static_cast<char>('A' + i % 23);
+    }}
+
+    std::string const s = make_haystack(4096, 2000, needle);
+
+    XTESTS_TEST_POINTER_EQUAL(s.data() + 2000, stlsoft_C_strnistrn(s.data(), s.size(), needle.data(), needle.size()));
+    XTESTS_TEST_POINTER_EQUAL(s.data() + 2000, stlsoft_C_strnistrn(s.data(), s.size(), "abcdefghijklmnopqrstuvwABCDE", 28));
+}
+
+static void test_wcsnstrn_1()
+{
+    wchar_t const s1[] = L"the quick brown fox";
+
+    XTESTS_TEST_POINTER_EQUAL(s1 + 4, stlsoft_C_wcsnstrn(s1, 19, L"quick", 5));
+    XTESTS_TEST_POINTER_EQUAL(s1 + 16, stlsoft_C_wcsnstrn(s1, 19, L"fox", 3));
+    XTESTS_TEST_POINTER_EQUAL(NULL, stlsoft_C_wcsnstrn(s1, 18, L"fox", 3));
+    XTESTS_TEST_POINTER_EQUAL(NULL, stlsoft_C_wcsnstrn(s1, 19, L"qxxxk", 5));
+}
+
+static void test_wcsnistrn_1()
+{
+    wchar_t const s1[] = L"The Quick Brown Fox";
+
+    XTESTS_TEST_POINTER_EQUAL(s1 + 4, stlsoft_C_wcsnistrn(s1, 19, L"qUICK", 5));
+    XTESTS_TEST_POINTER_EQUAL(NULL, stlsoft_C_wcsnistrn(s1, 19, L"tax", 3));
+}
+
+static void test_searcher_exact()
+{
+    strnstrn_searcher const searcher("ERROR", 5);
+
+    XTESTS_TEST_INTEGER_EQUAL(5u, searcher.size());
+
+    char const s1[] = "INFO: ok";
+    char const s2[] = "2026-10-16 ERROR: failed";
+    char const s3[] = "2026-10-16 error: failed";
+
+    XTESTS_TEST_POINTER_EQUAL(NULL, searcher.find(s1, STLSOFT_NUM_ELEMENTS(s1) - 1));
+    XTESTS_TEST_POINTER_EQUAL(s2 + 11, searcher.find(s2, STLSOFT_NUM_ELEMENTS(s2) - 1));
+    XTESTS_TEST_POINTER_EQUAL(NULL, searcher.find(s3, STLSOFT_NUM_ELEMENTS(s3) - 1));
+}
+
+static void test_searcher_ignore_case()
+{
+    strnstrn_searcher const searcher("ERROR", 5, strnstrn_searcher::ignoreCase);
+
+    char const s2[] = "2026-10-16 ERROR: failed";
+    char const s3[] = "2026-10-16 error: failed";
+    char const s4[] = "2026-10-16 Errol: failed";
+
+    XTESTS_TEST_POINTER_EQUAL(s2 + 11, searcher.find(s2, STLSOFT_NUM_ELEMENTS(s2) - 1));
+    XTESTS_TEST_POINTER_EQUAL(s3 + 11, searcher.find(s3, STLSOFT_NUM_ELEMENTS(s3) - 1));
+    XTESTS_TEST_POINTER_EQUAL(NULL, searcher.find(s4, STLSOFT_NUM_ELEMENTS(s4) - 1));
+}
+
+static void test_searcher_against_naive()
+{
+    static char const alphabet[] = "abAB";
+
+    unsigned long r = 1;
+
+    { for (size_t t = 0; t != 2000; ++t)
+    {
+        size_t const    n1  =   (t % 10) ? t % 100 : 1000 + t;
+        size_t const    n2  =   1 + t % (t % 3 ? 7 : 90);
+        std::string     s1;
+        std::string     s2;
+
+        { for (size_t i = 0; i != n1; ++i)
+        {
+            r = r * 1103515245 + 12345;
+
+            s1 += alphabet[(r >> 16) % 4];
+        }}
+
+        { for (size_t i = 0; i != n2; ++i)
+        {
+            r = r * 1103515245 + 12345;
+
+            s2 += alphabet[(r >> 16) % 4];
+        }}
+
+        if (n2 <= n1 &&
+            0 != (t & 1))
+        {
+            s1.replace((r >> 8) % (n1 - n2 + 1), n2, s2);
+        }
+
+        strnstrn_searcher const searcher1(s2.data(), n2);
+        strnstrn_searcher const searcher2(s2.data(), n2, strnstrn_searcher::ignoreCase);
+
+        XTESTS_TEST_POINTER_EQUAL(naive_find(s1.data(), n1, s2.data(), n2, false), stlsoft_C_strnstrn(s1.data(), n1, s2.data(), n2));
+        XTESTS_TEST_POINTER_EQUAL(naive_find(s1.data(), n1, s2.data(), n2, true), stlsoft_C_strnistrn(s1.data(), n1, s2.data(), n2));
+        XTESTS_TEST_POINTER_EQUAL(naive_find(s1.data(), n1, s2.data(), n2, false), searcher1.find(s1.data(), n1));
+        XTESTS_TEST_POINTER_EQUAL(naive_find(s1.data(), n1, s2.data(), n2, true), searcher2.find(s1.data(), n1));
+    }}
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
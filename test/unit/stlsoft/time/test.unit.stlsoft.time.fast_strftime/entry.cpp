@@ -0,0 +1,308 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.stlsoft.time.fast_strftime/entry.cpp
+ *
+ * Purpose: Unit-tests for `stlsoft::fast_strftime()` and
+ *          `stlsoft::basic_fast_strftime_format`.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* /////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/time/fast_strftime.hpp>
+
+/* /////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* Standard C header files */
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_fast_strftime_fields(void);
+    static void test_fast_strftime_hashed_fields(void);
+    static void test_fast_strftime_insufficient_buffer(void);
+    static void test_fast_wcsftime(void);
+    static void test_format_empty(void);
+    static void test_format_literals(void);
+    static void test_format_fields(void);
+    static void test_format_matches_fast_strftime(void);
+    static void test_format_matches_strftime(void);
+    static void test_format_unsupported_codes(void);
+    static void test_format_insufficient_buffer(void);
+    static void test_format_wide(void);
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char *argv[])
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.stlsoft.time.fast_strftime", verbosity))
+    {
+        XTESTS_RUN_CASE(test_fast_strftime_fields);
+        XTESTS_RUN_CASE(test_fast_strftime_hashed_fields);
+        XTESTS_RUN_CASE(test_fast_strftime_insufficient_buffer);
+        XTESTS_RUN_CASE(test_fast_wcsftime);
+        XTESTS_RUN_CASE(test_format_empty);
+        XTESTS_RUN_CASE(test_format_literals);
+        XTESTS_RUN_CASE(test_format_fields);
+        XTESTS_RUN_CASE(test_format_matches_fast_strftime);
+        XTESTS_RUN_CASE(test_format_matches_strftime);
+        XTESTS_RUN_CASE(test_format_unsupported_codes);
+        XTESTS_RUN_CASE(test_format_insufficient_buffer);
+        XTESTS_RUN_CASE(test_format_wide);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+// Friday 16th October 2026, 09:05:07
+struct tm
+make_tm()
+{
+    struct tm tm;
+
+    ::memset(&tm, 0, sizeof(tm));
+
+    tm.tm_sec   =   7;
+    tm.tm_min   =   5;
+    tm.tm_hour  =   9;
+    tm.tm_mday  =   16;
+    tm.tm_mon   =   9;
+    tm.tm_year  =   126;
+    tm.tm_wday  =   5;
+    tm.tm_yday  =   288;
+
+    return tm;
+}
+
+char const* const FORMATS[] =
+{
+        ""
+    ,   "abc"
+    ,   "%a %A %b %B %C %d %D %e %F %h %H %I %j %m %M %R %S %T %u %U %w %W %y %Y"
+    ,   "%Y-%m-%d %H:%M:%S"
+    ,   "%Y%m%dT%H%M%S"
+    ,   "[%a, %d %b %Y %T]"
+    ,   "%%d=%d%%"
+    ,   "%n%t"
+    ,   "%#d/%#m/%#y %#H:%#M:%#S"
+    ,   "%#j %#F %#T %#R %#e"
+};
+
+
+static void test_fast_strftime_fields()
+{
+    struct tm const tm = make_tm();
+    char            buff[201];
+
+    XTESTS_TEST_INTEGER_EQUAL(19u, stlsoft::fast_strftime(buff, STLSOFT_NUM_ELEMENTS(buff), "%Y-%m-%d %H:%M:%S", &tm));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("2026-10-16 09:05:07", buff);
+
+    stlsoft::fast_strftime(buff, "%a %A %b %B %C %d %D %e %F %h %H %I %j %m %M %R %S %T %u %U %w %W %y %Y", &tm);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("Fri Friday Oct October 20 16 10/16/26 16 2026-10-16 Oct 09 09 289 10 05 09:05 07 09:05:07 5 41 5 41 26 2026", buff);
+
+    stlsoft::fast_strftime(buff, "100%% [%n%t]", &tm);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("100% [\n\t]", buff);
+}
+
+static void test_fast_strftime_hashed_fields()
+{
+    struct tm const tm = make_tm();
+    char            buff[101];
+
+    stlsoft::fast_strftime(buff, "%#H:%#M:%#S %#T %#m", &tm);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("9:5:7 9:5:7 10", buff);
+
+    stlsoft::fast_strftime(buff, "%#a %#%", &tm);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("Fri %", buff);
+}
+
+static void test_fast_strftime_insufficient_buffer()
+{
+    struct tm const tm = make_tm();
+    char            buff[101];
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, stlsoft::fast_strftime(buff, 19, "%Y-%m-%d %H:%M:%S", &tm));
+    XTESTS_TEST_INTEGER_EQUAL(19u, stlsoft::fast_strftime(buff, 20, "%Y-%m-%d %H:%M:%S", &tm));
+}
+
+static void test_fast_wcsftime()
+{
+    struct tm const tm = make_tm();
+    wchar_t         buff[101];
+
+    XTESTS_TEST_INTEGER_EQUAL(23u, stlsoft::fast_wcsftime(buff, STLSOFT_NUM_ELEMENTS(buff), L"%a, %d %B %Y %H", &tm));
+    XTESTS_TEST_WIDE_STRING_EQUAL(L"Fri, 16 October 2026 09", buff);
+}
+
+static void test_format_empty()
+{
+    struct tm const                     tm = make_tm();
+    stlsoft::fast_strftime_format const fmt("");
+    char                                buff[10];
+
+    ::strcpy(buff, "xyz");
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, fmt.format(buff, &tm));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", buff);
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, fmt.format(buff, 0, &tm));
+}
+
+static void test_format_literals()
+{
+    struct tm const                     tm = make_tm();
+    stlsoft::fast_strftime_format const fmt("abc%%def%n%t%#%");
+    char                                buff[101];
+
+    XTESTS_TEST_INTEGER_EQUAL(10u, fmt.format(buff, &tm));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc%def\n\t%", buff);
+}
+
+static void test_format_fields()
+{
+    struct tm const                     tm = make_tm();
+    stlsoft::fast_strftime_format const fmt("%Y-%m-%d %H:%M:%S");
+    char                                buff[101];
+
+    XTESTS_TEST_INTEGER_EQUAL(19u, fmt.format(buff, &tm));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("2026-10-16 09:05:07", buff);
+
+    // format is reusable, and copyable
+
+    stlsoft::fast_strftime_format const fmt2(fmt);
+    struct tm                           tm2 = tm;
+
+    tm2.tm_sec = 59;
+
+    XTESTS_TEST_INTEGER_EQUAL(19u, fmt2.format(buff, STLSOFT_NUM_ELEMENTS(buff), &tm2));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("2026-10-16 09:05:59", buff);
+}
+
+static void test_format_matches_fast_strftime()
+{
+    struct tm tm = make_tm();
+
+    { for (size_t i = 0; i != STLSOFT_NUM_ELEMENTS(FORMATS); ++i)
+    {
+        stlsoft::fast_strftime_format const fmt(FORMATS[i]);
+
+        { for (int day = 0; day != 400; ++day)
+        {
+            tm.tm_mday  =   1 + day % 28;
+            tm.tm_mon   =   day % 12;
+            tm.tm_wday  =   day % 7;
+            tm.tm_yday  =   day % 365;
+            tm.tm_hour  =   day % 24;
+            tm.tm_min   =   day % 60;
+            tm.tm_sec   =   (7 * day) % 60;
+            tm.tm_year  =   70 + day % 100;
+
+            char        expected[201];
+            char        actual[201];
+            size_t const n1 = stlsoft::fast_strftime(expected, STLSOFT_NUM_ELEMENTS(expected), FORMATS[i], &tm);
+            size_t const n2 = fmt.format(actual, STLSOFT_NUM_ELEMENTS(actual), &tm);
+
+            XTESTS_TEST_INTEGER_EQUAL(n1, n2);
+            XTESTS_TEST_MULTIBYTE_STRING_EQUAL(expected, actual);
+        }}
+    }}
+}
+
+static void test_format_matches_strftime()
+{
+    struct tm const tm = make_tm();
+
+    { for (size_t i = 0; i != 8; ++i) // the '#' modifier is not standard
+    {
+        stlsoft::fast_strftime_format const fmt(FORMATS[i]);
+        char                                expected[201];
+        char                                actual[201];
+
+        size_t const n1 = ::strftime(expected, STLSOFT_NUM_ELEMENTS(expected), FORMATS[i], &tm);
+        size_t const n2 = fmt.format(actual, &tm);
+
+        XTESTS_TEST_INTEGER_EQUAL(n1, n2);
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL(expected, actual);
+    }}
+}
+
+static void test_format_unsupported_codes()
+{
+    struct tm const                     tm = make_tm();
+    stlsoft::fast_strftime_format const fmt("[%c|%Z|%z|%p|%Y]%");
+    char                                buff[101];
+
+    XTESTS_TEST_INTEGER_EQUAL(10u, fmt.format(buff, &tm));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("[||||2026]", buff);
+}
+
+static void test_format_insufficient_buffer()
+{
+    struct tm const                     tm = make_tm();
+    stlsoft::fast_strftime_format const fmt("%Y-%m-%d %H:%M:%S");
+    char                                buff[101];
+
+    { for (size_t i = 0; i != 20; ++i)
+    {
+        XTESTS_TEST_INTEGER_EQUAL(0u, fmt.format(buff, i, &tm));
+    }}
+
+    XTESTS_TEST_INTEGER_EQUAL(19u, fmt.format(buff, 20, &tm));
+}
+
+static void test_format_wide()
+{
+    struct tm const                     tm = make_tm();
+    stlsoft::fast_wcsftime_format const fmt(L"%A %#d %B %Y, %T");
+    wchar_t                             buff[101];
+
+    XTESTS_TEST_INTEGER_EQUAL(32u, fmt.format(buff, &tm));
+    XTESTS_TEST_WIDE_STRING_EQUAL(L"Friday 16 October 2026, 09:05:07", buff);
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
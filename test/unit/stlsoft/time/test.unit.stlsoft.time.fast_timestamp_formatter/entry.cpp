@@ -0,0 +1,261 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.stlsoft.time.fast_timestamp_formatter/entry.cpp
+ *
+ * Purpose: Unit-tests for `stlsoft::basic_fast_timestamp_formatter`.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* /////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/time/fast_timestamp_formatter.hpp>
+
+/* /////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/api/internal/time.h>
+
+/* Standard C header files */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_no_subsecond_fields(void);
+    static void test_subsecond_fields(void);
+    static void test_subsecond_field_at_ends(void);
+    static void test_escaped_subsecond_field(void);
+    static void test_same_second(void);
+    static void test_successive_seconds(void);
+    static void test_matches_gmtime(void);
+    static void test_matches_localtime(void);
+    static void test_pre_epoch(void);
+    static void test_insufficient_buffer(void);
+    static void test_wide(void);
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char *argv[])
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.stlsoft.time.fast_timestamp_formatter", verbosity))
+    {
+        XTESTS_RUN_CASE(test_no_subsecond_fields);
+        XTESTS_RUN_CASE(test_subsecond_fields);
+        XTESTS_RUN_CASE(test_subsecond_field_at_ends);
+        XTESTS_RUN_CASE(test_escaped_subsecond_field);
+        XTESTS_RUN_CASE(test_same_second);
+        XTESTS_RUN_CASE(test_successive_seconds);
+        XTESTS_RUN_CASE(test_matches_gmtime);
+        XTESTS_RUN_CASE(test_matches_localtime);
+        XTESTS_RUN_CASE(test_pre_epoch);
+        XTESTS_RUN_CASE(test_insufficient_buffer);
+        XTESTS_RUN_CASE(test_wide);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+using stlsoft::fast_timestamp_formatter;
+
+// Friday 16th October 2026, 09:05:07 UTC
+time_t const T_2026_10_16_09_05_07 = 1792141507;
+
+
+static void test_no_subsecond_fields()
+{
+    fast_timestamp_formatter    fmt("%Y-%m-%d %H:%M:%S", true);
+    char                        buff[101];
+
+    XTESTS_TEST_INTEGER_EQUAL(19u, fmt.format(buff, T_2026_10_16_09_05_07, 123456789));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("2026-10-16 09:05:07", buff);
+}
+
+static void test_subsecond_fields()
+{
+    fast_timestamp_formatter    fmt("%H:%M:%S.%3N|%6N|%N|%1N|%9N", true);
+    char                        buff[101];
+
+    XTESTS_TEST_INTEGER_EQUAL(41u, fmt.format(buff, T_2026_10_16_09_05_07, 12345678));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("09:05:07.012|012345|012345678|0|012345678", buff);
+}
+
+static void test_subsecond_field_at_ends()
+{
+    fast_timestamp_formatter    fmt("%3N%Y%3N", true);
+    char                        buff[101];
+
+    XTESTS_TEST_INTEGER_EQUAL(10u, fmt.format(buff, T_2026_10_16_09_05_07, 999999999));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("9992026999", buff);
+}
+
+static void test_escaped_subsecond_field()
+{
+    fast_timestamp_formatter    fmt("%%N %%3N %#d %3", true);
+    char                        buff[101];
+
+    XTESTS_TEST_INTEGER_EQUAL(10u, fmt.format(buff, T_2026_10_16_09_05_07, 1));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("%N %3N 16 ", buff);
+}
+
+static void test_same_second()
+{
+    fast_timestamp_formatter    fmt("%T.%3N", true);
+    char                        buff[101];
+
+    { for (long ms = 0; ms != 1000; ++ms)
+    {
+        char expected[101];
+
+        ::sprintf(expected, "09:05:07.%03ld", ms);
+
+        XTESTS_TEST_INTEGER_EQUAL(12u, fmt.format(buff, T_2026_10_16_09_05_07, ms * 1000000 + 999));
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL(expected, buff);
+    }}
+}
+
+static void test_successive_seconds()
+{
+    fast_timestamp_formatter    fmt("%F %T.%6N", true);
+    char                        buff[101];
+
+    fmt.format(buff, T_2026_10_16_09_05_07, 0);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("2026-10-16 09:05:07.000000", buff);
+
+    fmt.format(buff, T_2026_10_16_09_05_07 + 1, 1000);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("2026-10-16 09:05:08.000001", buff);
+
+    fmt.format(buff, T_2026_10_16_09_05_07 - 7 - 5 * 60 - 9 * 3600 - 1, 999999000);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("2026-10-15 23:59:59.999999", buff);
+
+    fmt.format(buff, T_2026_10_16_09_05_07, 0);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("2026-10-16 09:05:07.000000", buff);
+}
+
+static void test_matches_gmtime()
+{
+    char const* const           FORMAT  =   "%a %A %b %B %C %d %D %e %F %H %I %j %m %M %R %S %T %u %U %w %W %y %Y";
+    fast_timestamp_formatter    fmt(FORMAT, true);
+
+    // every 997 hours (plus odd seconds) from 1970 to 2100
+
+    { for (time_t t = 0; t < 4102444800; t += 997 * 3600 + 13)
+    {
+        struct tm   tm;
+        char        expected[201];
+        char        actual[201];
+
+        STLSOFT_API_INTERNAL_Time_gmtime(&tm, &t);
+
+        ::strftime(expected, STLSOFT_NUM_ELEMENTS(expected), FORMAT, &tm);
+
+        fmt.format(actual, t, 0);
+
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL(expected, actual);
+    }}
+}
+
+static void test_matches_localtime()
+{
+    char const* const           FORMAT  =   "%Y-%m-%d %H:%M:%S";
+    fast_timestamp_formatter    fmt(FORMAT);
+
+    // every 17 minutes (plus odd seconds) over 2 years, which will include
+    // any changes to/from daylight saving time
+
+    { for (time_t t = T_2026_10_16_09_05_07; t < T_2026_10_16_09_05_07 + 2 * 366 * 86400; t += 17 * 60 + 7)
+    {
+        struct tm   tm;
+        char        expected[101];
+        char        actual[101];
+
+        STLSOFT_API_INTERNAL_Time_localtime(&tm, &t);
+
+        ::strftime(expected, STLSOFT_NUM_ELEMENTS(expected), FORMAT, &tm);
+
+        fmt.format(actual, t, 0);
+
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL(expected, actual);
+    }}
+}
+
+static void test_pre_epoch()
+{
+    fast_timestamp_formatter    fmt("%F %T %a %j", true);
+    char                        buff[101];
+
+    fmt.format(buff, -1, 0);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("1969-12-31 23:59:59 Wed 365", buff);
+
+    fmt.format(buff, -2208988800, 0);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("1900-01-01 00:00:00 Mon 001", buff);
+}
+
+static void test_insufficient_buffer()
+{
+    fast_timestamp_formatter    fmt("%T.%3N", true);
+    char                        buff[101];
+
+    { for (size_t i = 0; i != 13; ++i)
+    {
+        XTESTS_TEST_INTEGER_EQUAL(0u, fmt.format(buff, i, T_2026_10_16_09_05_07, 0));
+    }}
+
+    XTESTS_TEST_INTEGER_EQUAL(12u, fmt.format(buff, 13, T_2026_10_16_09_05_07, 0));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("09:05:07.000", buff);
+}
+
+static void test_wide()
+{
+    stlsoft::fast_wtimestamp_formatter  fmt(L"%d %B %Y %T.%3N", true);
+    wchar_t                             buff[101];
+
+    XTESTS_TEST_INTEGER_EQUAL(28u, fmt.format(buff, T_2026_10_16_09_05_07, 250000000));
+    XTESTS_TEST_WIDE_STRING_EQUAL(L"16 October 2026 09:05:07.250", buff);
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
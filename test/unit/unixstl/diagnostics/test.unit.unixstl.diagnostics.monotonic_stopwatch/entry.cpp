@@ -0,0 +1,200 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.unixstl.diagnostics.monotonic_stopwatch/entry.cpp
+ *
+ * Purpose: Unit-tests for `unixstl::monotonic_stopwatch`.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* /////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <unixstl/diagnostics/monotonic_stopwatch.hpp>
+
+/* /////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/diagnostics/doomgram.hpp>
+#include <stlsoft/diagnostics/gram_scope.hpp>
+#include <unixstl/synch/sleep_functions.h>
+
+/* Standard C header files */
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_start_stop(void);
+    static void test_measure_around_delay(void);
+    static void test_pause_unpause(void);
+    static void test_stop_get_and_restart(void);
+    static void test_static_intervals(void);
+    static void test_with_gram_scope(void);
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char *argv[])
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.unixstl.diagnostics.monotonic_stopwatch", verbosity))
+    {
+        XTESTS_RUN_CASE(test_start_stop);
+        XTESTS_RUN_CASE(test_measure_around_delay);
+        XTESTS_RUN_CASE(test_pause_unpause);
+        XTESTS_RUN_CASE(test_stop_get_and_restart);
+        XTESTS_RUN_CASE(test_static_intervals);
+        XTESTS_RUN_CASE(test_with_gram_scope);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+using unixstl::monotonic_stopwatch;
+
+
+static void test_start_stop()
+{
+    monotonic_stopwatch sw;
+
+    sw.start();
+    sw.stop();
+
+    XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(0, sw.get_nanoseconds());
+    XTESTS_TEST_INTEGER_LESS(1000 * 1000, sw.get_nanoseconds());
+    XTESTS_TEST_INTEGER_EQUAL(sw.get_nanoseconds(), sw.get_period_count());
+    XTESTS_TEST_INTEGER_EQUAL(0, sw.get_seconds());
+}
+
+static void test_measure_around_delay()
+{
+    monotonic_stopwatch sw;
+
+    sw.start();
+
+    unixstl::micro_sleep(10000);
+
+    sw.stop();
+
+    monotonic_stopwatch::interval_type const ns = sw.get_nanoseconds();
+
+    XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(10000000, ns);
+    XTESTS_TEST_INTEGER_LESS_OR_EQUAL(100000000, ns);
+
+    XTESTS_TEST_INTEGER_EQUAL(ns / 1000, sw.get_microseconds());
+    XTESTS_TEST_INTEGER_EQUAL(ns / 1000000, sw.get_milliseconds());
+    XTESTS_TEST_INTEGER_EQUAL(ns / 1000000000, sw.get_seconds());
+}
+
+static void test_pause_unpause()
+{
+    monotonic_stopwatch sw;
+
+    sw.start();
+
+    sw.pause();
+
+    unixstl::micro_sleep(20000);
+
+    sw.unpause();
+
+    unixstl::micro_sleep(1000);
+
+    sw.stop();
+
+    monotonic_stopwatch::interval_type const ns = sw.get_nanoseconds();
+
+    XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(1000000, ns);
+    XTESTS_TEST_INTEGER_LESS(20000000, ns);
+}
+
+static void test_stop_get_and_restart()
+{
+    monotonic_stopwatch sw;
+
+    sw.start();
+
+    unixstl::micro_sleep(5000);
+
+    monotonic_stopwatch::interval_type const ns1 = sw.stop_get_nanoseconds_and_restart();
+
+    monotonic_stopwatch::interval_type const ns2 = sw.stop_get_nanoseconds_and_restart();
+
+    XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(5000000, ns1);
+    XTESTS_TEST_INTEGER_LESS(ns1, ns2);
+}
+
+static void test_static_intervals()
+{
+    monotonic_stopwatch::epoch_type const start = monotonic_stopwatch::get_epoch();
+
+    unixstl::micro_sleep(2000);
+
+    monotonic_stopwatch::epoch_type const end = monotonic_stopwatch::get_epoch();
+
+    monotonic_stopwatch::interval_type const ns = monotonic_stopwatch::get_nanoseconds(start, end);
+
+    XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(2000000, ns);
+    XTESTS_TEST_INTEGER_EQUAL(ns / 1000, monotonic_stopwatch::get_microseconds(start, end));
+    XTESTS_TEST_INTEGER_EQUAL(ns / 1000000, monotonic_stopwatch::get_milliseconds(start, end));
+    XTESTS_TEST_INTEGER_EQUAL(0, monotonic_stopwatch::get_seconds(start, end));
+}
+
+static void test_with_gram_scope()
+{
+    monotonic_stopwatch sw;
+    stlsoft::doomgram   gram;
+
+    {
+        stlsoft::gram_scope<stlsoft::doomgram, monotonic_stopwatch> scope(gram, sw);
+
+        unixstl::micro_sleep(10000);
+    }
+
+    auto const total_time_ns = gram.total_event_time_ns_raw();
+
+    XTESTS_TEST_INTEGER_EQUAL(1u, gram.event_count());
+    XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(10000000, total_time_ns);
+    XTESTS_TEST_INTEGER_LESS_OR_EQUAL(100000000, total_time_ns);
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
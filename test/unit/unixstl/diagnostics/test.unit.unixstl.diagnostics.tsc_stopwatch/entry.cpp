@@ -0,0 +1,221 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.unixstl.diagnostics.tsc_stopwatch/entry.cpp
+ *
+ * Purpose: Unit-tests for `unixstl::tsc_stopwatch`.
+ *
+ * Created: 16th October 2026
+ * Updated: 16th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * feature control
+ */
+
+#if defined(__GNUC__) && \
+    (   defined(__i386__) || \
+        defined(__x86_64__))
+# define TSC_STOPWATCH_SUPPORTED
+#endif /* compiler / architecture */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* /////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#ifdef TSC_STOPWATCH_SUPPORTED
+# include <unixstl/diagnostics/tsc_stopwatch.hpp>
+#endif /* TSC_STOPWATCH_SUPPORTED */
+
+/* /////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/diagnostics/doomgram.hpp>
+#include <stlsoft/diagnostics/gram_scope.hpp>
+#include <unixstl/diagnostics/monotonic_stopwatch.hpp>
+#include <unixstl/synch/sleep_functions.h>
+
+/* Standard C header files */
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+#ifdef TSC_STOPWATCH_SUPPORTED
+
+namespace
+{
+
+    static void test_calibration(void);
+    static void test_start_stop(void);
+    static void test_measure_around_delay(void);
+    static void test_pause_unpause(void);
+    static void test_static_intervals(void);
+    static void test_with_gram_scope(void);
+} // anonymous namespace
+#endif /* TSC_STOPWATCH_SUPPORTED */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char *argv[])
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.unixstl.diagnostics.tsc_stopwatch", verbosity))
+    {
+#ifdef TSC_STOPWATCH_SUPPORTED
+
+        XTESTS_RUN_CASE(test_calibration);
+        XTESTS_RUN_CASE(test_start_stop);
+        XTESTS_RUN_CASE(test_measure_around_delay);
+        XTESTS_RUN_CASE(test_pause_unpause);
+        XTESTS_RUN_CASE(test_static_intervals);
+        XTESTS_RUN_CASE(test_with_gram_scope);
+#endif /* TSC_STOPWATCH_SUPPORTED */
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+#ifdef TSC_STOPWATCH_SUPPORTED
+
+namespace
+{
+
+using unixstl::monotonic_stopwatch;
+using unixstl::tsc_stopwatch;
+
+
+static void test_calibration()
+{
+    // any x86 processor in use has a counter of more than 100MHz
+
+    XTESTS_TEST_INTEGER_GREATER(100000000, tsc_stopwatch::get_frequency());
+}
+
+static void test_start_stop()
+{
+    tsc_stopwatch sw;
+
+    sw.start();
+    sw.stop();
+
+    XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(0, sw.get_period_count());
+    XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(0, sw.get_nanoseconds());
+    XTESTS_TEST_INTEGER_LESS(1000 * 1000, sw.get_nanoseconds());
+    XTESTS_TEST_INTEGER_EQUAL(0, sw.get_seconds());
+}
+
+static void test_measure_around_delay()
+{
+    monotonic_stopwatch msw;
+    tsc_stopwatch       sw;
+
+    msw.start();
+    sw.start();
+
+    unixstl::micro_sleep(10000);
+
+    sw.stop();
+    msw.stop();
+
+    tsc_stopwatch::interval_type const ns = sw.get_nanoseconds();
+
+    XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(9900000, ns);
+    XTESTS_TEST_INTEGER_LESS_OR_EQUAL(100000000, ns);
+
+    // within 1% of the monotonic clock
+    XTESTS_TEST_INTEGER_LESS_OR_EQUAL(msw.get_nanoseconds() / 100, (ns > msw.get_nanoseconds()) ? (ns - msw.get_nanoseconds()) : (msw.get_nanoseconds() - ns));
+
+    XTESTS_TEST_INTEGER_EQUAL(ns / 1000, sw.get_microseconds());
+    XTESTS_TEST_INTEGER_EQUAL(ns / 1000000, sw.get_milliseconds());
+    XTESTS_TEST_INTEGER_EQUAL(ns / 1000000000, sw.get_seconds());
+}
+
+static void test_pause_unpause()
+{
+    tsc_stopwatch sw;
+
+    sw.start();
+
+    sw.pause();
+
+    unixstl::micro_sleep(20000);
+
+    sw.unpause();
+
+    unixstl::micro_sleep(1000);
+
+    sw.stop();
+
+    tsc_stopwatch::interval_type const ns = sw.get_nanoseconds();
+
+    XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(990000, ns);
+    XTESTS_TEST_INTEGER_LESS(20000000, ns);
+}
+
+static void test_static_intervals()
+{
+    tsc_stopwatch::epoch_type const start = tsc_stopwatch::get_epoch();
+
+    unixstl::micro_sleep(2000);
+
+    tsc_stopwatch::epoch_type const end = tsc_stopwatch::get_epoch();
+
+    tsc_stopwatch::interval_type const ns = tsc_stopwatch::get_nanoseconds(start, end);
+
+    XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(1980000, ns);
+    XTESTS_TEST_INTEGER_EQUAL(ns / 1000, tsc_stopwatch::get_microseconds(start, end));
+    XTESTS_TEST_INTEGER_EQUAL(ns / 1000000, tsc_stopwatch::get_milliseconds(start, end));
+    XTESTS_TEST_INTEGER_EQUAL(0, tsc_stopwatch::get_seconds(start, end));
+}
+
+static void test_with_gram_scope()
+{
+    tsc_stopwatch       sw;
+    stlsoft::doomgram   gram;
+
+    {
+        stlsoft::gram_scope<stlsoft::doomgram, tsc_stopwatch> scope(gram, sw);
+
+        unixstl::micro_sleep(10000);
+    }
+
+    auto const total_time_ns = gram.total_event_time_ns_raw();
+
+    XTESTS_TEST_INTEGER_EQUAL(1u, gram.event_count());
+    XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(9900000, total_time_ns);
+    XTESTS_TEST_INTEGER_LESS_OR_EQUAL(100000000, total_time_ns);
+}
+} // anonymous namespace
+#endif /* TSC_STOPWATCH_SUPPORTED */
+
+
+/* ///////////////////////////// end of file //////////////////////////// */